@@ -36,6 +36,24 @@
 
 #include "parasites_stmlib/parasites_stmlib.h"
 
+// Tables identical to the tides ones are shared, not duplicated.
+namespace tides {
+
+    extern const uint16_t lut_attenuverter_curve[];
+    extern const uint16_t lut_slope_compression[];
+    extern const uint32_t lut_increments[];
+    extern const uint32_t lut_cutoff[];
+    extern const int16_t wav_inverse_tan_audio[];
+    extern const int16_t wav_inverse_sin_audio[];
+    extern const int16_t wav_linear_audio[];
+    extern const int16_t wav_sin_audio[];
+    extern const int16_t wav_tan_audio[];
+    extern const int16_t wav_bipolar_fold[];
+    extern const int16_t wav_unipolar_fold[];
+    extern const int16_t wt_waves[];
+
+}  // namespace tides
+
 namespace bumps {
     typedef uint8_t ResourceId;
 
@@ -49,10 +67,10 @@ namespace bumps {
 
     extern const int16_t* waveshaper_table[];
 
-    extern const uint16_t lut_attenuverter_curve[];
-    extern const uint16_t lut_slope_compression[];
-    extern const uint32_t lut_increments[];
-    extern const uint32_t lut_cutoff[];
+    using tides::lut_attenuverter_curve;
+    using tides::lut_slope_compression;
+    using tides::lut_increments;
+    using tides::lut_cutoff;
     extern const int16_t wav_sine1024[];
     extern const int16_t wav_sine128[];
     extern const int16_t wav_sine64[];
@@ -73,11 +91,11 @@ namespace bumps {
     extern const int16_t wav_bandlimited_parabola_13[];
     extern const int16_t wav_bandlimited_parabola_14[];
     extern const int16_t wav_bandlimited_parabola_15[];
-    extern const int16_t wav_inverse_tan_audio[];
-    extern const int16_t wav_inverse_sin_audio[];
-    extern const int16_t wav_linear_audio[];
-    extern const int16_t wav_sin_audio[];
-    extern const int16_t wav_tan_audio[];
+    using tides::wav_inverse_tan_audio;
+    using tides::wav_inverse_sin_audio;
+    using tides::wav_linear_audio;
+    using tides::wav_sin_audio;
+    using tides::wav_tan_audio;
     extern const int16_t wav_reversed_control[];
     extern const int16_t wav_spiky_exp_control[];
     extern const int16_t wav_spiky_control[];
@@ -85,9 +103,9 @@ namespace bumps {
     extern const int16_t wav_bump_control[];
     extern const int16_t wav_bump_exp_control[];
     extern const int16_t wav_normal_control[];
-    extern const int16_t wav_bipolar_fold[];
-    extern const int16_t wav_unipolar_fold[];
-    extern const int16_t wt_waves[];
+    using tides::wav_bipolar_fold;
+    using tides::wav_unipolar_fold;
+    using tides::wt_waves;
     extern const int16_t ws_smooth_bipolar_fold[] IN_RAM;
 #define LUT_ATTENUVERTER_CURVE 0
 #define LUT_ATTENUVERTER_CURVE_SIZE 257
@@ -48,6 +48,7 @@ namespace etesia {
     RESOLUTION_8_BIT,
     RESOLUTION_8_BIT_DITHERED,
     RESOLUTION_8_BIT_MU_LAW,
+    RESOLUTION_32_BIT_FLOAT,
   };
 
   enum InterpolationMethod {
@@ -62,14 +63,18 @@ namespace etesia {
     AudioBuffer() {}
     ~AudioBuffer() {}
 
+    // size is in samples.
     void Init(void* buffer, int32_t size, int16_t* tail_buffer) {
+      f32_ = static_cast<float*>(buffer);
       s16_ = static_cast<int16_t*>(buffer);
       s8_ = static_cast<int8_t*>(buffer);
       size_ = size - kInterpolationTail;
       write_head_ = 0;
       quantization_error_ = 0.0f;
       crossfade_counter_ = 0;
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        std::fill(&f32_[0], &f32_[size], 0.0f);
+      } else if (resolution == RESOLUTION_16_BIT) {
         std::fill(&s16_[0], &s16_[size], 0);
       } else {
         std::fill(&s8_[0], &s8_[size], resolution == RESOLUTION_8_BIT_MU_LAW ? 127 : 0);
@@ -83,7 +88,9 @@ namespace etesia {
     }
 
     inline void Write(float in) {
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        f32_[write_head_] = in;
+      } else if (resolution == RESOLUTION_16_BIT) {
         s16_[write_head_] = parasites_stmlib::Clip16(static_cast<int32_t>(in * 32768.0f));
       } else if (resolution == RESOLUTION_8_BIT_DITHERED) {
         float sample = in * 127.0f;
@@ -103,7 +110,11 @@ namespace etesia {
         s8_[write_head_] = static_cast<int8_t>(parasites_stmlib::Clip16(in * 32768.0f) >> 8);
       }
 
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        if (write_head_ < kInterpolationTail) {
+          f32_[write_head_ + size_] = f32_[write_head_];
+        }
+      } else if (resolution == RESOLUTION_16_BIT) {
         if (write_head_ < kInterpolationTail) {
           s16_[write_head_ + size_] = s16_[write_head_];
         }
@@ -130,6 +141,14 @@ namespace etesia {
             }
           }
         }
+      } else if (!crossfade_counter_ && resolution == RESOLUTION_32_BIT_FLOAT &&
+        write_head_ >= kInterpolationTail && write_head_ < (size_ - size)) {
+        // Fast write routine for the most common case.
+        while (size--) {
+          f32_[write_head_] = *in;
+          ++write_head_;
+          in += stride;
+        }
       } else if (!crossfade_counter_ && resolution == RESOLUTION_16_BIT && write_head_ >= kInterpolationTail &&
         write_head_ < (size_ - size)) {
         // Fast write routine for the most common case.
@@ -154,7 +173,14 @@ namespace etesia {
     }
 
     inline void Write(const float* in, int32_t size, int32_t stride) {
-      if (resolution == RESOLUTION_16_BIT && write_head_ >= kInterpolationTail &&
+      if (resolution == RESOLUTION_32_BIT_FLOAT && write_head_ >= kInterpolationTail &&
+        write_head_ < (size_ - size)) {
+        while (size--) {
+          f32_[write_head_] = *in;
+          ++write_head_;
+          in += stride;
+        }
+      } else if (resolution == RESOLUTION_16_BIT && write_head_ >= kInterpolationTail &&
         write_head_ < (size_ - size)) {
         // Fast write routine for the most common case.
         while (size--) {
@@ -187,7 +213,10 @@ namespace etesia {
       }
 
       float x0, scale;
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        x0 = f32_[integral];
+        scale = 1.0f;
+      } else if (resolution == RESOLUTION_16_BIT) {
         x0 = s16_[integral];
         scale = kScaleBig;
       } else if (resolution == RESOLUTION_8_BIT_MU_LAW) {
@@ -207,7 +236,11 @@ namespace etesia {
 
       float x0, x1, scale;
       float t = static_cast<float>(fractional) / 65536.0f;
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        x0 = f32_[integral];
+        x1 = f32_[integral + 1];
+        scale = 1.0f;
+      } else if (resolution == RESOLUTION_16_BIT) {
         x0 = s16_[integral];
         x1 = s16_[integral + 1];
         scale = kScaleBig;
@@ -231,7 +264,13 @@ namespace etesia {
       float xm1, x0, x1, x2, scale;
       float t = static_cast<float>(fractional) / 65536.0f;
 
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        xm1 = f32_[integral];
+        x0 = f32_[integral + 1];
+        x1 = f32_[integral + 2];
+        x2 = f32_[integral + 3];
+        scale = 1.0f;
+      } else if (resolution == RESOLUTION_16_BIT) {
         xm1 = s16_[integral];
         x0 = s16_[integral + 1];
         x1 = s16_[integral + 2];
@@ -269,6 +308,7 @@ namespace etesia {
     }
 
   private:
+    float* f32_;
     int16_t* s16_;
     int8_t* s8_;
 
@@ -42,7 +42,7 @@ namespace etesia {
     done_ = true;
   }
 
-  void Correlator::EvaluateNextCandidate() {
+  void Correlator::EvaluateNextCandidates() {
     if (done_) {
       return;
     }
@@ -52,23 +52,36 @@ namespace etesia {
     const uint32_t* source = &source_[0];
     const uint32_t* destination = &destination_[offset_words];
 
-    uint32_t xcorr = 0;
-    for (uint32_t i = 0; i < num_words; ++i) {
-      uint32_t source_bits = source[i];
-      uint32_t destination_bits = 0;
-      destination_bits |= destination[i] << offset_bits;
-      destination_bits |= destination[i + 1] >> (32 - offset_bits);
-      uint32_t count = ~(source_bits ^ destination_bits);
-      count = count - ((count >> 1) & 0x55555555);
-      count = (count & 0x33333333) + ((count >> 2) & 0x33333333);
-      count = (((count + (count >> 4)) & 0xf0f0f0f) * 0x1010101) >> 24;
-      xcorr += count;
+    // Candidates are visited in groups that never straddle a word boundary,
+    // so a whole group slides over the same destination words. Sign bits are
+    // compared 64 at a time with the hardware population count.
+    uint32_t xcorr[kCorrelatorCandidatesPerCall] = { 0 };
+    uint32_t i = 0;
+    for (; i + 1 < num_words; i += 2) {
+      uint64_t source_bits = static_cast<uint64_t>(source[i]) << 32 | source[i + 1];
+      uint64_t window = static_cast<uint64_t>(destination[i]) << 32 | destination[i + 1];
+      uint32_t next = destination[i + 2] >> 1;
+      for (uint32_t j = 0; j < kCorrelatorCandidatesPerCall; ++j) {
+        uint32_t shift = offset_bits + j;
+        uint64_t destination_bits = (window << shift) | (next >> (31 - shift));
+        xcorr[j] += __builtin_popcountll(~(source_bits ^ destination_bits));
+      }
     }
-    if (xcorr > best_score_) {
-      best_match_ = candidate_;
-      best_score_ = xcorr;
+    if (i < num_words) {
+      uint64_t window = static_cast<uint64_t>(destination[i]) << 32 | destination[i + 1];
+      for (uint32_t j = 0; j < kCorrelatorCandidatesPerCall; ++j) {
+        uint32_t destination_bits = static_cast<uint32_t>(window >> (32 - offset_bits - j));
+        xcorr[j] += __builtin_popcount(~(source[i] ^ destination_bits));
+      }
+    }
+
+    for (uint32_t j = 0; j < kCorrelatorCandidatesPerCall && candidate_ < size_; ++j) {
+      if (xcorr[j] > best_score_) {
+        best_match_ = candidate_;
+        best_score_ = xcorr[j];
+      }
+      ++candidate_;
     }
-    ++candidate_;
     done_ = candidate_ >= size_;
   }
 
@@ -35,6 +35,9 @@
 
 namespace etesia {
 
+  // Must divide 32, so that a group of candidates shares its destination words.
+  const uint32_t kCorrelatorCandidatesPerCall = 4;
+
   class Correlator {
   public:
     Correlator() {}
@@ -49,14 +52,14 @@ namespace etesia {
     }
 
     inline void EvaluateSomeCandidates() {
-      size_t num_candidates = (size_ >> 2) + 16;
-      while (num_candidates) {
-        EvaluateNextCandidate();
-        --num_candidates;
+      size_t num_calls = (size_ >> 3) + 8;
+      while (num_calls) {
+        EvaluateNextCandidates();
+        --num_calls;
       }
     }
 
-    void EvaluateNextCandidate();
+    void EvaluateNextCandidates();
 
     inline uint32_t* source() {
       return source_;
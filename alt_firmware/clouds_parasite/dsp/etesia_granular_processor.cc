@@ -28,6 +28,7 @@
 
 #include "clouds_parasite/dsp/etesia_granular_processor.h"
 
+#include <cmath>
 #include <cstring>
 
 #include "parasites_stmlib/dsp/parasites_parameter_interpolator.h"
@@ -39,9 +40,29 @@ namespace etesia {
 	using namespace std;
 	using namespace parasites_stmlib;
 
-#ifdef METAMODULE
-	float* lut_sine_window_2048;
-#endif
+	// A quarter of the output's least significant bit.
+	const float kIdleThreshold = 1.0f / 131072.0f;
+
+	// Silent samples after which the spectral textures and the resonators have
+	// faded out.
+	const int32_t kSpectralIdleHold = 16384;
+
+	static inline bool IsSilent(const ShortFrame* frames, size_t size) {
+		for (size_t i = 0; i < size; ++i) {
+			if (frames[i].l || frames[i].r) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static inline bool IsSilent(const FloatFrame* frames, size_t size) {
+		float peak = 0.0f;
+		for (size_t i = 0; i < size; ++i) {
+			peak = max(peak, max(fabsf(frames[i].l), fabsf(frames[i].r)));
+		}
+		return peak < kIdleThreshold;
+	}
 
 	void EtesiaGranularProcessor::Init(void* large_buffer, size_t large_buffer_size, void* small_buffer,
 		size_t small_buffer_size) {
@@ -49,6 +70,8 @@ namespace etesia {
 		buffer_[1] = small_buffer;
 		buffer_size_[0] = large_buffer_size;
 		buffer_size_[1] = small_buffer_size;
+		float_buffer_ = NULL;
+		float_buffer_size_ = 0;
 
 		num_channels_ = 2;
 		low_fidelity_ = false;
@@ -60,14 +83,10 @@ namespace etesia {
 
 		previous_playback_mode_ = PLAYBACK_MODE_LAST;
 		reset_buffers_ = true;
+		idle_ = false;
+		silent_samples_ = 0;
+		idle_hold_ = 0;
 		dry_wet_ = 0.0f;
-
-#ifdef METAMODULE
-		lut_sine_window_2048 = new float[2048];
-		for (int32_t i = 0; i < 2048; ++i) {
-			lut_sine_window_2048[i] = lut_sine_window_4096[i * 2];
-		}
-#endif
 	}
 
 	void EtesiaGranularProcessor::ResetFilters() {
@@ -79,13 +98,21 @@ namespace etesia {
 	}
 
 	void EtesiaGranularProcessor::ProcessGranular(FloatFrame* input, FloatFrame* output, size_t size) {
+		// Count how long the recording buffer has only been fed silence.
+		if (!parameters_.freeze || playback_mode_ == PLAYBACK_MODE_OLIVERB) {
+			silent_samples_ = IsSilent(input, size) ?
+				min(silent_samples_ + static_cast<int32_t>(size), idle_hold_) : 0;
+		}
+
 		/* Except for spectral and resonestor modes, all modes require the incoming
 		   audio signal to be written to the recording buffer. */
 		if (playback_mode_ != PLAYBACK_MODE_SPECTRAL && playback_mode_ != PLAYBACK_MODE_RESONESTOR) {
 			const float* input_samples = &input[0].l;
 			const bool play = !parameters_.freeze || playback_mode_ == PLAYBACK_MODE_OLIVERB;
 			for (int32_t i = 0; i < num_channels_; ++i) {
-				if (resolution() == 8) {
+				if (float_buffers()) {
+					buffer_float_[i].WriteFade(&input_samples[i], size, 2, play);
+				} else if (resolution() == 8) {
 					buffer_8_[i].WriteFade(&input_samples[i], size, 2, play);
 				} else {
 					buffer_16_[i].WriteFade(&input_samples[i], size, 2, play);
@@ -115,7 +142,9 @@ namespace etesia {
 			parameters_.granular.window_shape = parameters_.texture < 0.75f ? parameters_.texture * 1.333f :
 				1.0f;
 
-			if (resolution() == 8) {
+			if (float_buffers()) {
+				player_.Play(buffer_float_, parameters_, &output[0].l, size);
+			} else if (resolution() == 8) {
 				player_.Play(buffer_8_, parameters_, &output[0].l, size);
 			} else {
 				player_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -123,7 +152,9 @@ namespace etesia {
 			break;
 
 		case PLAYBACK_MODE_STRETCH:
-			if (resolution() == 8) {
+			if (float_buffers()) {
+				ws_player_.Play(buffer_float_, parameters_, &output[0].l, size);
+			} else if (resolution() == 8) {
 				ws_player_.Play(buffer_8_, parameters_, &output[0].l, size);
 			} else {
 				ws_player_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -131,7 +162,9 @@ namespace etesia {
 			break;
 
 		case PLAYBACK_MODE_LOOPING_DELAY:
-			if (resolution() == 8) {
+			if (float_buffers()) {
+				looper_.Play(buffer_float_, parameters_, &output[0].l, size);
+			} else if (resolution() == 8) {
 				looper_.Play(buffer_8_, parameters_, &output[0].l, size);
 			} else {
 				looper_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -183,7 +216,9 @@ namespace etesia {
 			};
 #pragma GCC diagnostic pop
 
-			if (resolution() == 8) {
+			if (float_buffers()) {
+				ws_player_.Play(buffer_float_, p, &output[0].l, size);
+			} else if (resolution() == 8) {
 				ws_player_.Play(buffer_8_, p, &output[0].l, size);
 			} else {
 				ws_player_.Play(buffer_16_, p, &output[0].l, size);
@@ -271,7 +306,9 @@ namespace etesia {
 
 	void EtesiaGranularProcessor::Process(ShortFrame* input, ShortFrame* output, size_t size) {
 		// TIC.
-		if (silence_ || reset_buffers_ || previous_playback_mode_ != playback_mode_) {
+		// An idle processor sleeps until its input or a trigger wakes it up.
+		idle_ = idle_ && !parameters_.trigger && IsSilent(input, size);
+		if (silence_ || reset_buffers_ || previous_playback_mode_ != playback_mode_ || idle_) {
 			short* output_samples = &output[0].l;
 			fill(&output_samples[0], &output_samples[size << 1], 0);
 			return;
@@ -406,6 +443,11 @@ namespace etesia {
 			output[i].r = SoftConvert(out_[i].r);
 		}
 
+		/* With a silent input, a silent output and a recording buffer holding
+		   nothing but silence, there is nothing left to play: skip the following
+		   blocks. */
+		idle_ = silent_samples_ >= idle_hold_ && IsSilent(input, size) && IsSilent(out_, size);
+
 		// TOC
 	}
 
@@ -481,6 +523,8 @@ namespace etesia {
 			buffer_16_[1].Resync(persistent_state_.write_head[1]);
 		}
 		parameters_.freeze = true;
+		silent_samples_ = 0;
+		idle_ = false;
 		silence_ = false;
 		return true;
 	}
@@ -531,7 +575,12 @@ namespace etesia {
 			BufferAllocator allocator(workspace, workspace_size);
 			diffuser_.Init(allocator.Allocate<float>(2048));
 
-			uint16_t* reverb_buffer = allocator.Allocate<uint16_t>(16384);
+#ifndef METAMODULE
+			// The reverbs' float delay memory does not fit in the workspace.
+			Reverb::E::T* reverb_buffer = reverb_buffer_;
+#else
+			Reverb::E::T* reverb_buffer = allocator.Allocate<Reverb::E::T>(16384);
+#endif
 			if (playback_mode_ == PLAYBACK_MODE_OLIVERB) {
 				oliverb_.Init(reverb_buffer);
 			} else {
@@ -541,22 +590,28 @@ namespace etesia {
 			size_t correlator_block_size = (kMaxWSOLASize / 32) + 2;
 			uint32_t* correlator_data = allocator.Allocate<uint32_t>(correlator_block_size * 3);
 			correlator_.Init(&correlator_data[0], &correlator_data[correlator_block_size]);
-			pitch_shifter_.Init(reinterpret_cast<uint16_t*>(correlator_data));
+			pitch_shifter_.Init(reinterpret_cast<PitchShifter::E::T*>(correlator_data));
 
 			if (playback_mode_ == PLAYBACK_MODE_SPECTRAL) {
+				// The MetaModule runs a smaller FFT, which reads every other point of the
+				// same window.
 #ifndef METAMODULE
 				phase_vocoder_.Init(buffer, buffer_size, lut_sine_window_4096, 4096, num_channels_,
 					resolution(), sr);
 #else
-				phase_vocoder_.Init(buffer, buffer_size, lut_sine_window_2048, 2048, num_channels_,
+				phase_vocoder_.Init(buffer, buffer_size, lut_sine_window_4096, 2048, num_channels_,
 					resolution(), sr);
 #endif
 			} else if (playback_mode_ == PLAYBACK_MODE_RESONESTOR) {
 				float* buf = static_cast<float*>(buffer[0]);
 				resonestor_.Init(buf);
 			} else {
+				int32_t float_buffer_size = float_buffer_size_ / num_channels_;
 				for (int32_t i = 0; i < num_channels_; ++i) {
-					if (resolution() == 8) {
+					if (float_buffers()) {
+						buffer_float_[i].Init(&float_buffer_[i * float_buffer_size], float_buffer_size,
+							tail_buffer_[i]);
+					} else if (resolution() == 8) {
 						buffer_8_[i].Init(buffer[i], (buffer_size[i]), tail_buffer_[i]);
 					} else {
 						buffer_16_[i].Init(buffer[i], ((buffer_size[i]) >> 1), tail_buffer_[i]);
@@ -568,6 +623,17 @@ namespace etesia {
 				ws_player_.Init(&correlator_, num_channels_);
 				looper_.Init(num_channels_);
 			}
+			if (playback_mode_ == PLAYBACK_MODE_SPECTRAL || playback_mode_ == PLAYBACK_MODE_RESONESTOR) {
+				idle_hold_ = kSpectralIdleHold;
+			} else if (float_buffers()) {
+				idle_hold_ = buffer_float_[0].size();
+			} else if (resolution() == 8) {
+				idle_hold_ = buffer_8_[0].size();
+			} else {
+				idle_hold_ = buffer_16_[0].size();
+			}
+			silent_samples_ = 0;
+			idle_ = false;
 			reset_buffers_ = false;
 			previous_playback_mode_ = playback_mode_;
 		}
@@ -575,7 +641,9 @@ namespace etesia {
 		if (playback_mode_ == PLAYBACK_MODE_SPECTRAL) {
 			phase_vocoder_.Buffer();
 		} else if (playback_mode_ == PLAYBACK_MODE_STRETCH || playback_mode_ == PLAYBACK_MODE_OLIVERB) {
-			if (resolution() == 8) {
+			if (float_buffers()) {
+				ws_player_.LoadCorrelator(buffer_float_);
+			} else if (resolution() == 8) {
 				ws_player_.LoadCorrelator(buffer_8_);
 			} else {
 				ws_player_.LoadCorrelator(buffer_16_);
@@ -110,6 +110,14 @@ namespace etesia {
 			low_fidelity_ = low_fidelity;
 		}
 
+		/* Records hi-fi audio as floats into buffer, size floats long, instead of
+		   into the 16-bit sample memory. NULL goes back to the sample memory. */
+		inline void set_float_buffer(float* buffer, size_t size) {
+			reset_buffers_ = reset_buffers_ || buffer != float_buffer_ || size != float_buffer_size_;
+			float_buffer_ = buffer;
+			float_buffer_size_ = size;
+		}
+
 		inline int32_t quality() const {
 			int32_t quality = 0;
 			if (num_channels_ == 1) quality |= 1;
@@ -126,6 +134,10 @@ namespace etesia {
 			return low_fidelity_ ? 8 : 16;
 		}
 
+		inline bool float_buffers() const {
+			return float_buffer_ && !low_fidelity_;
+		}
+
 		inline float sample_rate() const {
 			return 32000.0f / (low_fidelity_ ? kDownsamplingFactor : 1);
 		}
@@ -140,12 +152,20 @@ namespace etesia {
 
 		bool silence_;
 		bool reset_buffers_;
+		bool idle_;
+		// Consecutive silent samples written to the recording buffer, and how many
+		// it takes to overwrite all of it.
+		int32_t silent_samples_;
+		int32_t idle_hold_;
 		float freeze_lp_;
 		float dry_wet_;
 
 		void* buffer_[2];
 		size_t buffer_size_[2];
 
+		float* float_buffer_;
+		size_t float_buffer_size_;
+
 		Correlator correlator_;
 
 		GranularSamplePlayer player_;
@@ -164,6 +184,7 @@ namespace etesia {
 
 		AudioBuffer<RESOLUTION_8_BIT_MU_LAW> buffer_8_[2];
 		AudioBuffer<RESOLUTION_16_BIT> buffer_16_[2];
+		AudioBuffer<RESOLUTION_32_BIT_FLOAT> buffer_float_[2];
 
 		FloatFrame in_[kMaxBlockSize];
 		FloatFrame in_downsampled_[kMaxBlockSize / kDownsamplingFactor];
@@ -173,6 +194,11 @@ namespace etesia {
 
 		int16_t tail_buffer_[2][256];
 
+#ifndef METAMODULE
+		// Shared by the reverb and Oliverb.
+		Reverb::E::T reverb_buffer_[16384];
+#endif
+
 		Parameters parameters_;
 
 		SampleRateConverter<-kDownsamplingFactor, 45, src_filter_1x_2_45> src_down_;
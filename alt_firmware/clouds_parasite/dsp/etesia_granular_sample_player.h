@@ -87,11 +87,14 @@ namespace etesia {
 			// Build a list of available grains.
 			int32_t num_available_grains = FillAvailableGrainsList();
 
+			// Draws once per sample: keep the random stream local.
+			Random::Stream stream;
+
 			// Try to schedule new grains.
 			bool seed_trigger = parameters.trigger;
 			for (size_t t = 0; t < size; ++t) {
 				grain_rate_phasor_ += 1.0f;
-				bool seed_probabilistic = Random::GetFloat() < p
+				bool seed_probabilistic = stream.GetFloat() < p
 					&& target_num_grains > num_grains_;
 				bool seed_deterministic = grain_rate_phasor_ >= space_between_grains;
 				bool seed = seed_probabilistic || seed_deterministic || seed_trigger;
@@ -113,7 +116,8 @@ namespace etesia {
 						t,
 						buffer->size(),
 						buffer->head() - size + t,
-						quality);
+						quality,
+						&stream);
 					grain_rate_phasor_ = 0.0f;
 					seed_trigger = false;
 				}
@@ -188,14 +192,15 @@ namespace etesia {
 			int32_t pre_delay,
 			int32_t buffer_size,
 			int32_t buffer_head,
-			GrainQuality quality) {
+			GrainQuality quality,
+			Random::Stream* stream) {
 			float position = parameters.position;
 			float pitch = parameters.pitch;
 			float window_shape = parameters.granular.window_shape;
 			float grain_size = Interpolate(lut_grain_size, parameters.size, 256.0f);
 			float pitch_ratio = SemitonesToRatio(pitch);
 			float inv_pitch_ratio = SemitonesToRatio(-pitch);
-			float pan = 0.5f + parameters.stereo_spread * (Random::GetFloat() - 0.5f);
+			float pan = 0.5f + parameters.stereo_spread * (stream->GetFloat() - 0.5f);
 			float gain_l, gain_r;
 			if (num_channels_ == 1) {
 				gain_l = Interpolate(lut_sin, pan, 256.0f);
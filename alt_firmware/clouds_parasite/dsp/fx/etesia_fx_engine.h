@@ -95,6 +95,18 @@ namespace etesia {
     }
   };
 
+  /* Storage of an effect's delay memory. On the desktop, floats, which spare
+     a conversion on every tap; on the MetaModule, which is short of memory,
+     the effect's fixed point format. */
+  template<Format fixed_point_format>
+  struct DelayFormat {
+#ifndef METAMODULE
+    static const Format format = FORMAT_32_BIT;
+#else
+    static const Format format = fixed_point_format;
+#endif
+  };
+
   template<
     size_t size,
     Format format = FORMAT_12_BIT>
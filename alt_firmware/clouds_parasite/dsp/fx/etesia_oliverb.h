@@ -38,10 +38,12 @@ namespace etesia {
 
 	class Oliverb {
 	public:
+		typedef FxEngine<16384, DelayFormat<FORMAT_16_BIT>::format> E;
+
 		Oliverb() {}
 		~Oliverb() {}
 
-		void Init(uint16_t* buffer) {
+		void Init(E::T* buffer) {
 			engine_.Init(buffer);
 			diffusion_ = 0.625f;
 			mod_amount_ = 0.0f;
@@ -233,7 +235,6 @@ namespace etesia {
 		}
 
 	private:
-		typedef FxEngine<16384, FORMAT_16_BIT> E;
 		E engine_;
 
 		float input_gain_;
@@ -40,10 +40,12 @@ namespace etesia {
 
 	class PitchShifter {
 	public:
+		typedef FxEngine<4096, DelayFormat<FORMAT_16_BIT>::format> E;
+
 		PitchShifter() { }
 		~PitchShifter() { }
 
-		void Init(uint16_t* buffer) {
+		void Init(E::T* buffer) {
 			engine_.Init(buffer);
 			phase_ = 0;
 			size_ = 2047.0f;
@@ -117,7 +119,6 @@ namespace etesia {
 		}
 
 	private:
-		typedef FxEngine<4096, FORMAT_16_BIT> E;
 		E engine_;
 		float phase_;
 		float ratio_;
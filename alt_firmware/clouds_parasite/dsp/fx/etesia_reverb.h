@@ -37,10 +37,12 @@ namespace etesia {
 
 class Reverb {
  public:
+  typedef FxEngine<16384, DelayFormat<FORMAT_12_BIT>::format> E;
+
   Reverb() { }
   ~Reverb() { }
   
-  void Init(uint16_t* buffer) {
+  void Init(E::T* buffer) {
     engine_.Init(buffer);
     engine_.SetLFOFrequency(LFO_1, 0.5f / 32000.0f);
     engine_.SetLFOFrequency(LFO_2, 0.3f / 32000.0f);
@@ -160,7 +162,6 @@ class Reverb {
   }
   
  private:
-  typedef FxEngine<16384, FORMAT_12_BIT> E;
   E engine_;
   
   float amount_;
@@ -30,13 +30,14 @@
 
 #include <algorithm>
 
-#include "parasites_stmlib/dsp/parasites_atan.h"
 #include "parasites_stmlib/dsp/parasites_units.h"
 #include "parasites_stmlib/utils/parasites_random.h"
 
 #include "clouds_parasite/dsp/etesia_frame.h"
 #include "clouds_parasite/dsp/etesia_parameters.h"
 
+#include "clouds/dsp/pvoc/frame_kernels.h"
+
 namespace etesia {
 
   using namespace std;
@@ -101,7 +102,7 @@ namespace etesia {
     const float* imag = &fft_data[fft_size_ >> 1];
     float* magnitude = &fft_data[0];
     for (int32_t i = 1; i < size_; ++i) {
-      uint16_t angle = fast_atan2r(imag[i], real[i], &magnitude[i]);
+      uint16_t angle = clouds::BinRectangularToPolar(imag[i], real[i], &magnitude[i]);
       phases_delta_[i] = angle - phases_[i];
       phases_[i] = angle;
     }
@@ -109,7 +110,8 @@ namespace etesia {
 
   void FrameTransformation::SetPhases(float* destination, float phase_randomization, float pitch_ratio) {
     uint32_t* synthesis_phase = reinterpret_cast<uint32_t*>(&destination[fft_size_ >> 1]);
-    for (int32_t i = 0; i < size_; ++i) {
+    int32_t size = size_;
+    for (int32_t i = 0; i < size; ++i) {
       synthesis_phase[i] = phases_[i];
       phases_[i] += static_cast<uint16_t>(
         static_cast<float>(phases_delta_[i]) * pitch_ratio);
@@ -119,8 +121,10 @@ namespace etesia {
     CONSTRAIN(r, 0.0f, 1.0f);
     r *= r;
     int32_t amount = static_cast<int32_t>(r * 32768.0f);
-    for (int32_t i = 0; i < size_; ++i) {
-      synthesis_phase[i] += static_cast<int32_t>(parasites_stmlib::Random::GetSample()) * amount >> 14;
+    if (amount) {
+      uint32_t rng_state = parasites_stmlib::Random::state();
+      clouds::AddRandomPhases(synthesis_phase, size, amount, &rng_state);
+      parasites_stmlib::Random::Seed(rng_state);
     }
   }
 
@@ -130,7 +134,7 @@ namespace etesia {
     float* magnitude = &fft_data[0];
     uint32_t* angle = reinterpret_cast<uint32_t*>(&fft_data[fft_size_ >> 1]);
     for (int32_t i = 1; i < size_; ++i) {
-      fast_p2r(magnitude[i], angle[i], &real[i], &imag[i]);
+      clouds::BinPolarToRectangular(magnitude[i], angle[i], &real[i], &imag[i]);
     }
     for (int32_t i = size_; i < fft_size_ >> 1; ++i) {
       real[i] = imag[i] = 0.0f;
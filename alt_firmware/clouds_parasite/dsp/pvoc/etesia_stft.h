@@ -31,7 +31,13 @@
 
 #include "parasites_stmlib/parasites_stmlib.h"
 
-#include "parasites_stmlib/fft/parasites_shy_fft.h"
+// #define USE_SHY_FFT
+
+#ifdef USE_SHY_FFT
+  #include "parasites_stmlib/fft/parasites_shy_fft.h"
+#else
+  #include "clouds/dsp/pvoc/real_fft.h"
+#endif  // USE_SHY_FFT
 
 namespace etesia {
 
@@ -39,7 +45,11 @@ struct Parameters;
 
 const size_t kMaxFftSize = 4096;
 
-typedef parasites_stmlib::ShyFFT<float, kMaxFftSize, parasites_stmlib::RotationPhasor> FFT;
+#ifdef USE_SHY_FFT
+  typedef parasites_stmlib::ShyFFT<float, kMaxFftSize, parasites_stmlib::RotationPhasor> FFT;
+#else
+  typedef clouds::RealFFT<kMaxFftSize> FFT;
+#endif  // USE_SHY_FFT
 
 
 typedef class FrameTransformation Modifier;
@@ -36,15 +36,8 @@
 
 #include "parasites_stmlib/parasites_stmlib.h"
 
-namespace etesia {
-
-	typedef uint8_t ResourceId;
-
-	extern const float* src_filter_table[];
-
-	extern const int16_t* lookup_table_int16_table[];
-
-	extern const float* lookup_table_table[];
+// Tables identical to the clouds ones are shared, not duplicated.
+namespace clouds {
 
 	extern const float src_filter_1x_2_31[];
 	extern const float src_filter_1x_2_45[];
@@ -52,12 +45,36 @@ namespace etesia {
 	extern const float src_filter_1x_2_91[];
 	extern const int16_t lut_db[];
 	extern const float lut_sin[];
-	extern const float lut_raised_cos[];
 	extern const float lut_xfade_in[];
 	extern const float lut_xfade_out[];
 	extern const float lut_window[];
 	extern const float lut_sine_window_4096[];
 	extern const float lut_cutoff[];
+
+}  // namespace clouds
+
+namespace etesia {
+
+	typedef uint8_t ResourceId;
+
+	extern const float* src_filter_table[];
+
+	extern const int16_t* lookup_table_int16_table[];
+
+	extern const float* lookup_table_table[];
+
+	using clouds::src_filter_1x_2_31;
+	using clouds::src_filter_1x_2_45;
+	using clouds::src_filter_1x_2_63;
+	using clouds::src_filter_1x_2_91;
+	using clouds::lut_db;
+	using clouds::lut_sin;
+	extern const float lut_raised_cos[];
+	using clouds::lut_xfade_in;
+	using clouds::lut_xfade_out;
+	using clouds::lut_window;
+	using clouds::lut_sine_window_4096;
+	using clouds::lut_cutoff;
 	extern const float lut_grain_size[];
 	extern const float lut_quantized_pitch[];
 #define SRC_FILTER_1X_2_31 0
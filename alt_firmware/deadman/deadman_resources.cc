@@ -41,609 +41,6 @@ namespace deadman {
 	  str_dummy,
 	};
 
-	const uint16_t lut_delay_times[] = {
-		   5,      7,      8,     10,
-		  12,     14,     16,     18,
-		  21,     24,     27,     31,
-		  34,     39,     43,     48,
-		  53,     59,     65,     71,
-		  78,     85,     93,    101,
-		 109,    118,    128,    138,
-		 149,    160,    172,    185,
-		 198,    212,    226,    241,
-		 257,    273,    290,    308,
-		 327,    347,    367,    388,
-		 410,    433,    456,    481,
-		 506,    533,    560,    588,
-		 617,    648,    679,    711,
-		 745,    779,    815,    851,
-		 889,    928,    968,   1009,
-		1052,   1096,   1141,   1187,
-		1235,   1284,   1334,   1386,
-		1439,   1493,   1549,   1607,
-		1666,   1726,   1788,   1851,
-		1916,   1982,   2050,   2120,
-		2192,   2265,   2339,   2416,
-		2494,   2574,   2655,   2739,
-		2824,   2911,   3000,   3091,
-		3184,   3278,   3375,   3474,
-		3574,   3677,   3782,   3888,
-		3997,   4108,   4221,   4337,
-		4454,   4574,   4696,   4820,
-		4946,   5075,   5206,   5340,
-		5475,   5614,   5754,   5897,
-		6043,   6191,   6341,   6494,
-		6650,   6808,   6969,   7133,
-		7299,   7468,   7639,   7814,
-		7991,   8171,   8353,   8539,
-		8727,   8919,   9113,   9310,
-		9510,   9713,   9920,  10129,
-	   10341,  10556,  10775,  10996,
-	   11221,  11449,  11680,  11915,
-	   12152,  12393,  12638,  12885,
-	   13137,  13391,  13649,  13910,
-	   14175,  14444,  14715,  14991,
-	   15270,  15553,  15839,  16129,
-	   16423,  16720,  17021,  17326,
-	   17635,  17947,  18264,  18584,
-	   18908,  19236,  19568,  19905,
-	   20245,  20589,  20937,  21289,
-	   21646,  22007,  22371,  22740,
-	   23114,  23491,  23873,  24259,
-	   24650,  25045,  25444,  25848,
-	   26256,  26668,  27086,  27507,
-	   27934,  28365,  28800,  29240,
-	   29685,  30135,  30589,  31049,
-	   31512,  31981,  32455,  32933,
-	   33417,  33905,  34399,  34897,
-	   35400,  35909,  36422,  36941,
-	   37465,  37994,  38528,  39068,
-	   39612,  40162,  40718,  41278,
-	   41844,  42416,  42993,  43575,
-	   44163,  44756,  45355,  45960,
-	   46570,  47186,  47807,  48435,
-	   49068,  49706,  50351,  51001,
-	   51657,  52319,  52987,  53661,
-	   54341,  55027,  55719,  56417,
-	   57121,  57832,  58548,  59271,
-	   60000,
-	};
-	const uint16_t lut_gravity[] = {
-	   33140,  31065,  29132,  27330,
-	   25650,  24084,  22621,  21256,
-	   19981,  18790,  17676,  16634,
-	   15660,  14748,  13894,  13094,
-	   12344,  11642,  10983,  10365,
-		9785,   9240,   8729,   8249,
-		7797,   7373,   6973,   6598,
-		6244,   5912,   5598,   5303,
-		5025,   4763,   4516,   4283,
-		4063,   3855,   3659,   3474,
-		3299,   3134,   2978,   2830,
-		2690,   2558,   2433,   2315,
-		2203,   2097,   1996,   1901,
-		1811,   1725,   1644,   1567,
-		1494,   1425,   1359,   1297,
-		1237,   1181,   1127,   1077,
-		1028,    982,    938,    897,
-		 857,    820,    784,    750,
-		 717,    686,    657,    629,
-		 602,    576,    552,    529,
-		 506,    485,    465,    446,
-		 427,    410,    393,    377,
-		 362,    347,    333,    320,
-		 307,    295,    283,    272,
-		 261,    251,    241,    232,
-		 223,    214,    206,    198,
-		 191,    183,    176,    170,
-		 163,    157,    151,    146,
-		 140,    135,    130,    125,
-		 121,    116,    112,    108,
-		 104,    100,     97,     93,
-		  90,     87,     84,     81,
-		  78,     75,     73,     70,
-		  68,     65,     63,     61,
-		  59,     57,     55,     53,
-		  51,     50,     48,     46,
-		  45,     43,     42,     40,
-		  39,     38,     37,     35,
-		  34,     33,     32,     31,
-		  30,     29,     28,     27,
-		  26,     25,     25,     24,
-		  23,     22,     22,     21,
-		  20,     20,     19,     19,
-		  18,     17,     17,     16,
-		  16,     15,     15,     14,
-		  14,     14,     13,     13,
-		  12,     12,     12,     11,
-		  11,     11,     10,     10,
-		  10,      9,      9,      9,
-		   9,      8,      8,      8,
-		   8,      7,      7,      7,
-		   7,      7,      6,      6,
-		   6,      6,      6,      5,
-		   5,      5,      5,      5,
-		   5,      5,      4,      4,
-		   4,      4,      4,      4,
-		   4,      4,      3,      3,
-		   3,      3,      3,      3,
-		   3,      3,      3,      3,
-		   3,      2,      2,      2,
-		   2,      2,      2,      2,
-		   2,      2,      2,      2,
-		   2,      2,      2,      2,
-		   2,      2,      1,      1,
-		   1,
-	};
-	const uint16_t lut_env_linear[] = {
-		   0,    257,    514,    771,
-		1028,   1285,   1542,   1799,
-		2056,   2313,   2570,   2827,
-		3084,   3341,   3598,   3855,
-		4112,   4369,   4626,   4883,
-		5140,   5397,   5654,   5911,
-		6168,   6425,   6682,   6939,
-		7196,   7453,   7710,   7967,
-		8224,   8481,   8738,   8995,
-		9252,   9509,   9766,  10023,
-	   10280,  10537,  10794,  11051,
-	   11308,  11565,  11822,  12079,
-	   12336,  12593,  12850,  13107,
-	   13364,  13621,  13878,  14135,
-	   14392,  14649,  14906,  15163,
-	   15420,  15677,  15934,  16191,
-	   16448,  16705,  16962,  17219,
-	   17476,  17733,  17990,  18247,
-	   18504,  18761,  19018,  19275,
-	   19532,  19789,  20046,  20303,
-	   20560,  20817,  21074,  21331,
-	   21588,  21845,  22102,  22359,
-	   22616,  22873,  23130,  23387,
-	   23644,  23901,  24158,  24415,
-	   24672,  24929,  25186,  25443,
-	   25700,  25957,  26214,  26471,
-	   26728,  26985,  27242,  27499,
-	   27756,  28013,  28270,  28527,
-	   28784,  29041,  29298,  29555,
-	   29812,  30069,  30326,  30583,
-	   30840,  31097,  31354,  31611,
-	   31868,  32125,  32382,  32639,
-	   32896,  33153,  33410,  33667,
-	   33924,  34181,  34438,  34695,
-	   34952,  35209,  35466,  35723,
-	   35980,  36237,  36494,  36751,
-	   37008,  37265,  37522,  37779,
-	   38036,  38293,  38550,  38807,
-	   39064,  39321,  39578,  39835,
-	   40092,  40349,  40606,  40863,
-	   41120,  41377,  41634,  41891,
-	   42148,  42405,  42662,  42919,
-	   43176,  43433,  43690,  43947,
-	   44204,  44461,  44718,  44975,
-	   45232,  45489,  45746,  46003,
-	   46260,  46517,  46774,  47031,
-	   47288,  47545,  47802,  48059,
-	   48316,  48573,  48830,  49087,
-	   49344,  49601,  49858,  50115,
-	   50372,  50629,  50886,  51143,
-	   51400,  51657,  51914,  52171,
-	   52428,  52685,  52942,  53199,
-	   53456,  53713,  53970,  54227,
-	   54484,  54741,  54998,  55255,
-	   55512,  55769,  56026,  56283,
-	   56540,  56797,  57054,  57311,
-	   57568,  57825,  58082,  58339,
-	   58596,  58853,  59110,  59367,
-	   59624,  59881,  60138,  60395,
-	   60652,  60909,  61166,  61423,
-	   61680,  61937,  62194,  62451,
-	   62708,  62965,  63222,  63479,
-	   63736,  63993,  64250,  64507,
-	   64764,  65021,  65278,  65535,
-	   65535,
-	};
-	const uint16_t lut_env_expo[] = {
-		   0,   1035,   2054,   3057,
-		4045,   5018,   5975,   6918,
-		7846,   8760,   9659,  10545,
-	   11416,  12275,  13120,  13952,
-	   14771,  15577,  16371,  17152,
-	   17921,  18679,  19425,  20159,
-	   20881,  21593,  22294,  22983,
-	   23662,  24331,  24989,  25637,
-	   26274,  26902,  27520,  28129,
-	   28728,  29318,  29899,  30471,
-	   31034,  31588,  32133,  32670,
-	   33199,  33720,  34232,  34737,
-	   35233,  35722,  36204,  36678,
-	   37145,  37604,  38056,  38502,
-	   38940,  39371,  39796,  40215,
-	   40626,  41032,  41431,  41824,
-	   42211,  42592,  42967,  43336,
-	   43699,  44057,  44409,  44756,
-	   45097,  45434,  45764,  46090,
-	   46411,  46727,  47037,  47344,
-	   47645,  47941,  48233,  48521,
-	   48804,  49083,  49357,  49627,
-	   49893,  50155,  50412,  50666,
-	   50916,  51162,  51404,  51642,
-	   51877,  52108,  52335,  52559,
-	   52780,  52997,  53210,  53421,
-	   53628,  53831,  54032,  54230,
-	   54424,  54616,  54804,  54990,
-	   55173,  55353,  55530,  55704,
-	   55876,  56045,  56211,  56375,
-	   56536,  56695,  56851,  57005,
-	   57157,  57306,  57453,  57597,
-	   57740,  57880,  58018,  58153,
-	   58287,  58419,  58548,  58676,
-	   58801,  58925,  59047,  59167,
-	   59285,  59401,  59515,  59628,
-	   59739,  59848,  59955,  60061,
-	   60165,  60267,  60368,  60468,
-	   60566,  60662,  60757,  60850,
-	   60942,  61032,  61121,  61209,
-	   61295,  61380,  61464,  61546,
-	   61628,  61707,  61786,  61863,
-	   61939,  62014,  62088,  62161,
-	   62233,  62303,  62372,  62441,
-	   62508,  62574,  62639,  62703,
-	   62767,  62829,  62890,  62950,
-	   63010,  63068,  63125,  63182,
-	   63238,  63293,  63347,  63400,
-	   63452,  63504,  63554,  63604,
-	   63654,  63702,  63750,  63797,
-	   63843,  63888,  63933,  63977,
-	   64021,  64063,  64105,  64147,
-	   64188,  64228,  64267,  64306,
-	   64344,  64382,  64419,  64456,
-	   64492,  64527,  64562,  64596,
-	   64630,  64664,  64696,  64729,
-	   64760,  64792,  64822,  64853,
-	   64883,  64912,  64941,  64969,
-	   64997,  65025,  65052,  65079,
-	   65105,  65131,  65157,  65182,
-	   65206,  65231,  65255,  65278,
-	   65302,  65324,  65347,  65369,
-	   65391,  65412,  65434,  65454,
-	   65475,  65495,  65515,  65535,
-	   65535,
-	};
-	const uint16_t lut_env_quartic[] = {
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      1,      1,
-		   2,      3,      4,      5,
-		   6,      8,      9,     11,
-		  14,     16,     19,     22,
-		  25,     29,     33,     37,
-		  42,     48,     53,     59,
-		  66,     73,     81,     89,
-		  98,    107,    117,    128,
-		 139,    151,    164,    177,
-		 191,    206,    222,    238,
-		 256,    274,    293,    313,
-		 334,    355,    378,    402,
-		 427,    453,    480,    508,
-		 537,    567,    599,    631,
-		 665,    700,    737,    775,
-		 814,    854,    896,    939,
-		 984,   1030,   1077,   1127,
-		1177,   1230,   1283,   1339,
-		1396,   1455,   1515,   1577,
-		1641,   1707,   1775,   1844,
-		1916,   1989,   2064,   2141,
-		2220,   2302,   2385,   2470,
-		2557,   2647,   2739,   2833,
-		2929,   3027,   3128,   3231,
-		3336,   3444,   3554,   3667,
-		3782,   3899,   4019,   4142,
-		4267,   4395,   4525,   4658,
-		4794,   4933,   5074,   5218,
-		5365,   5515,   5668,   5824,
-		5983,   6144,   6309,   6477,
-		6648,   6822,   6999,   7179,
-		7363,   7550,   7740,   7933,
-		8130,   8330,   8534,   8741,
-		8951,   9165,   9383,   9604,
-		9829,  10057,  10289,  10525,
-	   10765,  11008,  11255,  11507,
-	   11761,  12020,  12283,  12550,
-	   12821,  13096,  13375,  13658,
-	   13945,  14237,  14532,  14832,
-	   15137,  15445,  15758,  16076,
-	   16397,  16724,  17054,  17390,
-	   17730,  18074,  18423,  18777,
-	   19136,  19499,  19868,  20241,
-	   20618,  21001,  21389,  21781,
-	   22179,  22582,  22990,  23403,
-	   23821,  24244,  24672,  25106,
-	   25545,  25990,  26440,  26895,
-	   27355,  27821,  28293,  28770,
-	   29253,  29742,  30236,  30735,
-	   31241,  31752,  32270,  32793,
-	   33321,  33856,  34397,  34944,
-	   35497,  36056,  36621,  37192,
-	   37769,  38353,  38943,  39539,
-	   40142,  40751,  41366,  41988,
-	   42617,  43251,  43893,  44541,
-	   45196,  45857,  46526,  47201,
-	   47882,  48571,  49267,  49969,
-	   50678,  51395,  52118,  52849,
-	   53587,  54332,  55084,  55843,
-	   56610,  57384,  58165,  58954,
-	   59750,  60553,  61364,  62183,
-	   63010,  63843,  64685,  65535,
-	   65535,
-	};
-	const uint16_t lut_raised_cosine[] = {
-		   0,      2,      9,     22,
-		  39,     61,     88,    120,
-		 157,    199,    246,    298,
-		 354,    416,    482,    553,
-		 629,    710,    796,    886,
-		 982,   1082,   1186,   1296,
-		1410,   1530,   1653,   1782,
-		1915,   2053,   2195,   2342,
-		2494,   2650,   2811,   2976,
-		3146,   3320,   3498,   3681,
-		3869,   4060,   4256,   4457,
-		4661,   4870,   5083,   5300,
-		5522,   5747,   5977,   6210,
-		6448,   6689,   6935,   7184,
-		7437,   7694,   7955,   8220,
-		8488,   8760,   9035,   9314,
-		9597,   9883,  10172,  10465,
-	   10762,  11061,  11364,  11670,
-	   11980,  12292,  12607,  12926,
-	   13247,  13572,  13899,  14229,
-	   14562,  14898,  15236,  15578,
-	   15921,  16267,  16616,  16967,
-	   17321,  17676,  18034,  18395,
-	   18757,  19122,  19488,  19857,
-	   20227,  20600,  20974,  21350,
-	   21728,  22107,  22488,  22871,
-	   23255,  23641,  24027,  24416,
-	   24805,  25196,  25588,  25980,
-	   26374,  26769,  27165,  27562,
-	   27959,  28357,  28756,  29155,
-	   29555,  29956,  30356,  30758,
-	   31159,  31561,  31963,  32365,
-	   32767,  33169,  33571,  33973,
-	   34375,  34776,  35178,  35578,
-	   35979,  36379,  36778,  37177,
-	   37575,  37972,  38369,  38765,
-	   39160,  39554,  39946,  40338,
-	   40729,  41118,  41507,  41893,
-	   42279,  42663,  43046,  43427,
-	   43806,  44184,  44560,  44934,
-	   45307,  45677,  46046,  46412,
-	   46777,  47139,  47500,  47858,
-	   48213,  48567,  48918,  49267,
-	   49613,  49956,  50298,  50636,
-	   50972,  51305,  51635,  51962,
-	   52287,  52608,  52927,  53242,
-	   53554,  53864,  54170,  54473,
-	   54772,  55069,  55362,  55651,
-	   55937,  56220,  56499,  56774,
-	   57046,  57314,  57579,  57840,
-	   58097,  58350,  58599,  58845,
-	   59086,  59324,  59557,  59787,
-	   60012,  60234,  60451,  60664,
-	   60873,  61077,  61278,  61474,
-	   61665,  61853,  62036,  62214,
-	   62388,  62558,  62723,  62884,
-	   63040,  63192,  63339,  63481,
-	   63619,  63752,  63881,  64004,
-	   64124,  64238,  64348,  64452,
-	   64552,  64648,  64738,  64824,
-	   64905,  64981,  65052,  65118,
-	   65180,  65236,  65288,  65335,
-	   65377,  65414,  65446,  65473,
-	   65495,  65512,  65525,  65532,
-	   65532,
-	};
-	const uint16_t lut_svf_cutoff[] = {
-		  35,     37,     39,     41,
-		  44,     46,     49,     52,
-		  55,     58,     62,     66,
-		  70,     74,     78,     83,
-		  88,     93,     99,    105,
-		 111,    117,    124,    132,
-		 140,    148,    157,    166,
-		 176,    187,    198,    210,
-		 222,    235,    249,    264,
-		 280,    297,    314,    333,
-		 353,    374,    396,    420,
-		 445,    471,    499,    529,
-		 561,    594,    629,    667,
-		 706,    748,    793,    840,
-		 890,    943,    999,   1059,
-		1122,   1188,   1259,   1334,
-		1413,   1497,   1586,   1681,
-		1781,   1886,   1999,   2117,
-		2243,   2377,   2518,   2668,
-		2826,   2994,   3172,   3361,
-		3560,   3772,   3996,   4233,
-		4485,   4751,   5033,   5332,
-		5648,   5983,   6337,   6713,
-		7111,   7532,   7978,   8449,
-		8949,   9477,  10037,  10628,
-	   11254,  11916,  12616,  13356,
-	   14138,  14964,  15837,  16758,
-	   17730,  18756,  19837,  20975,
-	   22174,  23435,  24761,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,  25078,  25078,  25078,
-	   25078,
-	};
-	const uint16_t lut_svf_damp[] = {
-	   65534,  49166,  46069,  43993,
-	   42386,  41058,  39917,  38910,
-	   38007,  37184,  36427,  35726,
-	   35070,  34454,  33873,  33322,
-	   32798,  32299,  31820,  31361,
-	   30920,  30496,  30086,  29690,
-	   29306,  28935,  28574,  28224,
-	   27883,  27551,  27228,  26912,
-	   26605,  26304,  26010,  25723,
-	   25441,  25166,  24896,  24631,
-	   24371,  24116,  23866,  23620,
-	   23379,  23141,  22908,  22678,
-	   22452,  22229,  22010,  21794,
-	   21581,  21371,  21164,  20960,
-	   20759,  20560,  20365,  20171,
-	   19980,  19791,  19605,  19421,
-	   19239,  19059,  18882,  18706,
-	   18532,  18360,  18190,  18022,
-	   17856,  17691,  17528,  17367,
-	   17207,  17049,  16892,  16737,
-	   16583,  16431,  16280,  16131,
-	   15982,  15836,  15690,  15546,
-	   15403,  15261,  15120,  14981,
-	   14843,  14705,  14569,  14434,
-	   14300,  14167,  14036,  13905,
-	   13775,  13646,  13518,  13391,
-	   13265,  13140,  13015,  12892,
-	   12769,  12648,  12527,  12407,
-	   12287,  12169,  12051,  11934,
-	   11818,  11703,  11588,  11474,
-	   11361,  11249,  11137,  11026,
-	   10915,  10805,  10696,  10588,
-	   10480,  10373,  10266,  10160,
-	   10055,   9950,   9846,   9742,
-		9639,   9537,   9435,   9333,
-		9233,   9132,   9033,   8933,
-		8835,   8737,   8639,   8542,
-		8445,   8349,   8253,   8158,
-		8063,   7969,   7875,   7782,
-		7689,   7596,   7504,   7413,
-		7321,   7231,   7140,   7050,
-		6961,   6872,   6783,   6695,
-		6607,   6519,   6432,   6346,
-		6259,   6173,   6088,   6003,
-		5918,   5833,   5749,   5665,
-		5582,   5499,   5416,   5334,
-		5251,   5170,   5088,   5007,
-		4926,   4846,   4766,   4686,
-		4607,   4527,   4449,   4370,
-		4292,   4214,   4136,   4059,
-		3982,   3905,   3828,   3752,
-		3676,   3601,   3525,   3450,
-		3375,   3301,   3226,   3152,
-		3078,   3005,   2932,   2859,
-		2786,   2713,   2641,   2569,
-		2497,   2426,   2355,   2284,
-		2213,   2142,   2072,   2002,
-		1932,   1862,   1793,   1724,
-		1655,   1586,   1518,   1449,
-		1381,   1313,   1246,   1178,
-		1111,   1044,    977,    911,
-		 844,    778,    712,    647,
-		 581,    516,    450,    385,
-		 321,    256,    192,    127,
-		  63,
-	};
-	const uint16_t lut_svf_scale[] = {
-	   32767,  28381,  27473,  26846,
-	   26352,  25936,  25573,  25248,
-	   24953,  24682,  24429,  24193,
-	   23970,  23759,  23557,  23365,
-	   23181,  23003,  22832,  22667,
-	   22507,  22352,  22201,  22055,
-	   21912,  21772,  21636,  21503,
-	   21373,  21245,  21120,  20998,
-	   20877,  20759,  20643,  20528,
-	   20416,  20305,  20196,  20088,
-	   19982,  19877,  19774,  19672,
-	   19571,  19471,  19373,  19275,
-	   19179,  19083,  18989,  18896,
-	   18803,  18712,  18621,  18531,
-	   18442,  18353,  18266,  18179,
-	   18092,  18007,  17922,  17837,
-	   17754,  17671,  17588,  17506,
-	   17424,  17343,  17263,  17183,
-	   17103,  17024,  16946,  16868,
-	   16790,  16713,  16636,  16559,
-	   16483,  16407,  16331,  16256,
-	   16181,  16107,  16033,  15959,
-	   15885,  15812,  15739,  15666,
-	   15594,  15522,  15450,  15378,
-	   15306,  15235,  15164,  15093,
-	   15022,  14952,  14882,  14812,
-	   14742,  14672,  14602,  14533,
-	   14464,  14395,  14326,  14257,
-	   14188,  14120,  14051,  13983,
-	   13915,  13847,  13779,  13711,
-	   13643,  13575,  13508,  13440,
-	   13372,  13305,  13238,  13170,
-	   13103,  13036,  12969,  12902,
-	   12835,  12768,  12701,  12634,
-	   12567,  12500,  12433,  12366,
-	   12299,  12232,  12165,  12098,
-	   12031,  11964,  11897,  11830,
-	   11762,  11695,  11628,  11561,
-	   11493,  11426,  11359,  11291,
-	   11223,  11156,  11088,  11020,
-	   10952,  10884,  10816,  10747,
-	   10679,  10610,  10542,  10473,
-	   10404,  10335,  10266,  10196,
-	   10127,  10057,   9987,   9917,
-		9846,   9776,   9705,   9634,
-		9563,   9491,   9420,   9348,
-		9276,   9203,   9130,   9057,
-		8984,   8910,   8836,   8762,
-		8687,   8613,   8537,   8461,
-		8385,   8309,   8232,   8155,
-		8077,   7998,   7920,   7841,
-		7761,   7680,   7600,   7518,
-		7436,   7354,   7270,   7187,
-		7102,   7017,   6931,   6844,
-		6756,   6668,   6578,   6488,
-		6397,   6305,   6211,   6117,
-		6021,   5925,   5827,   5727,
-		5626,   5524,   5420,   5315,
-		5207,   5098,   4987,   4873,
-		4758,   4639,   4518,   4394,
-		4267,   4137,   4002,   3864,
-		3720,   3571,   3417,   3255,
-		3086,   2907,   2717,   2514,
-		2293,   2049,   1774,   1447,
-		1022,
-	};
 
 
 	const uint16_t* lookup_table_table[] = {
@@ -658,167 +55,6 @@ namespace deadman {
 	  lut_svf_scale,
 	};
 
-	const uint32_t lut_lfo_increments[] = {
-		2796,   2891,   2989,   3090,
-		3195,   3303,   3415,   3531,
-		3651,   3775,   3903,   4036,
-		4172,   4314,   4460,   4612,
-		4768,   4930,   5097,   5270,
-		5449,   5634,   5825,   6023,
-		6227,   6438,   6657,   6883,
-		7116,   7357,   7607,   7865,
-		8132,   8408,   8693,   8988,
-		9293,   9608,   9934,  10271,
-	   10620,  10980,  11353,  11738,
-	   12136,  12548,  12974,  13414,
-	   13869,  14339,  14826,  15329,
-	   15849,  16387,  16943,  17517,
-	   18112,  18726,  19361,  20018,
-	   20698,  21400,  22126,  22876,
-	   23652,  24455,  25285,  26142,
-	   27029,  27946,  28894,  29875,
-	   30888,  31936,  33020,  34140,
-	   35298,  36496,  37734,  39014,
-	   40338,  41706,  43121,  44584,
-	   46097,  47660,  49277,  50949,
-	   52678,  54465,  56313,  58223,
-	   60198,  62241,  64352,  66535,
-	   68793,  71126,  73539,  76034,
-	   78614,  81281,  84039,  86890,
-	   89837,  92885,  96036,  99295,
-	  102663, 106146, 109747, 113471,
-	  117320, 121300, 125415, 129670,
-	  134069, 138618, 143321, 148183,
-	  153210, 158408, 163782, 169338,
-	  175083, 181023, 187165, 193514,
-	  200079, 206867, 213885, 221142,
-	  228644, 236401, 244421, 252713,
-	  261287, 270151, 279316, 288792,
-	  298590, 308720, 319193, 330022,
-	  341218, 352794, 364763, 377138,
-	  389933, 403162, 416839, 430981,
-	  445602, 460719, 476350, 492510,
-	  509219, 526495, 544356, 562824,
-	  581918, 601660, 622072, 643176,
-	  664997, 687557, 710883, 735000,
-	  759936, 785717, 812373, 839933,
-	  868429, 897891, 928352, 959847,
-	  992411, 1026079, 1060890, 1096881,
-	  1134094, 1172569, 1212349, 1253479,
-	  1296004, 1339972, 1385431, 1432433,
-	  1481029, 1531274, 1583224, 1636936,
-	  1692470, 1749888, 1809255, 1870635,
-	  1934097, 1999713, 2067555, 2137698,
-	  2210221, 2285204, 2362732, 2442889,
-	  2525766, 2611454, 2700050, 2791651,
-	  2886359, 2984281, 3085525, 3190204,
-	  3298434, 3410335, 3526034, 3645657,
-	  3769338, 3897216, 4029432, 4166133,
-	  4307472, 4453606, 4604698, 4760916,
-	  4922433, 5089430, 5262093, 5440613,
-	  5625190, 5816028, 6013341, 6217348,
-	  6428276, 6646360, 6871842, 7104975,
-	  7346016, 7595235, 7852908, 8119324,
-	  8394778, 8679577, 8974038, 9278488,
-	  9593267, 9918726, 10255226, 10603142,
-	  10962861, 11334784, 11719324, 12116911,
-	  12527986, 12953006, 13392446, 13846795,
-	  14316557,
-	};
-	const uint32_t lut_env_increments[] = {
-	  178956970, 162203921, 147263779, 133914742,
-	  121965179, 111249129, 101622525, 92960022,
-	  85152324, 78103929, 71731214, 65960813,
-	  60728233, 55976673, 51656020, 47721976,
-	  44135321, 40861270, 37868923, 35130786,
-	  32622357, 30321772, 28209484, 26268003,
-	  24481648, 22836346, 21319451, 19919582,
-	  18626484, 17430905, 16324491, 15299685,
-	  14349647, 13468178, 12649652, 11888959,
-	  11181454, 10522909, 9909470, 9337624,
-	  8804164, 8306157, 7840925, 7406012,
-	  6999170, 6618338, 6261623, 5927288,
-	  5613733, 5319488, 5043200, 4783621,
-	  4539601, 4310076, 4094068, 3890668,
-	  3699040, 3518407, 3348049, 3187303,
-	  3035548, 2892213, 2756766, 2628711,
-	  2507588, 2392971, 2284460, 2181685,
-	  2084301, 1991984, 1904435, 1821372,
-	  1742534, 1667676, 1596567, 1528995,
-	  1464759, 1403670, 1345553, 1290243,
-	  1237585, 1187435, 1139655, 1094119,
-	  1050706, 1009303, 969803, 932108,
-	  896122, 861758, 828932, 797565,
-	  767584, 738918, 711503, 685274,
-	  660174, 636148, 613143, 591109,
-	  569999, 549770, 530379, 511787,
-	  493956, 476850, 460436, 444683,
-	  429558, 415035, 401085, 387683,
-	  374804, 362424, 350523, 339078,
-	  328069, 317479, 307287, 297478,
-	  288035, 278942, 270184, 261748,
-	  253620, 245786, 238236, 230956,
-	  223936, 217166, 210635, 204334,
-	  198253, 192383, 186717, 181245,
-	  175961, 170858, 165927, 161162,
-	  156558, 152107, 147805, 143644,
-	  139621, 135729, 131964, 128321,
-	  124796, 121384, 118081, 114883,
-	  111787, 108788, 105883, 103069,
-	  100343,  97700,  95139,  92657,
-	   90250,  87917,  85654,  83459,
-	   81330,  79265,  77261,  75316,
-	   73428,  71596,  69817,  68090,
-	   66413,  64784,  63202,  61666,
-	   60173,  58722,  57312,  55942,
-	   54610,  53315,  52056,  50832,
-	   49641,  48484,  47357,  46262,
-	   45196,  44159,  43149,  42167,
-	   41211,  40280,  39374,  38492,
-	   37632,  36796,  35981,  35187,
-	   34414,  33660,  32926,  32211,
-	   31513,  30834,  30172,  29526,
-	   28896,  28282,  27684,  27100,
-	   26531,  25975,  25434,  24905,
-	   24390,  23886,  23395,  22916,
-	   22449,  21992,  21546,  21111,
-	   20687,  20272,  19867,  19471,
-	   19085,  18708,  18339,  17979,
-	   17627,  17283,  16947,  16619,
-	   16298,  15985,  15678,  15378,
-	   15085,  14799,  14519,  14245,
-	   13977,  13716,  13459,  13209,
-	   12964,  12724,  12490,  12260,
-	   12036,  11816,  11601,  11390,
-	   11184,
-	};
-	const uint32_t lut_oscillator_increments[] = {
-	  594570139, 598878640, 603218361, 607589530,
-	  611992374, 616427123, 620894008, 625393262,
-	  629925120, 634489817, 639087591, 643718683,
-	  648383334, 653081787, 657814287, 662581081,
-	  667382416, 672218544, 677089717, 681996188,
-	  686938214, 691916051, 696929960, 701980202,
-	  707067040, 712190739, 717351567, 722549792,
-	  727785686, 733059521, 738371572, 743722117,
-	  749111434, 754539804, 760007511, 765514839,
-	  771062075, 776649508, 782277431, 787946136,
-	  793655918, 799407076, 805199909, 811034720,
-	  816911812, 822831491, 828794068, 834799851,
-	  840849155, 846942294, 853079587, 859261354,
-	  865487916, 871759598, 878076727, 884439633,
-	  890848647, 897304104, 903806339, 910355693,
-	  916952505, 923597121, 930289887, 937031151,
-	  943821265, 950660583, 957549461, 964488259,
-	  971477339, 978517064, 985607802, 992749922,
-	  999943798, 1007189803, 1014488315, 1021839716,
-	  1029244387, 1036702717, 1044215092, 1051781905,
-	  1059403550, 1067080425, 1074812930, 1082601467,
-	  1090446444, 1098348268, 1106307352, 1114324111,
-	  1122398963, 1130532329, 1138724632, 1146976300,
-	  1155287763, 1163659455, 1172091811, 1180585271,
-	  1189140279,
-	};
 
 
 	const uint32_t* lookup_table_32_table[] = {
@@ -827,10256 +63,12 @@ namespace deadman {
 	  lut_oscillator_increments,
 	};
 
-	const uint8_t wav_digits[] = {
-		 127,     74,     21,    224,
-		 171,    118,     65,     12,
-		 215,    162,    109,     56,
-		 252,     49,    102,    155,
-		 208,      5,     58,    111,
-		 164,    217,     14,     67,
-		 120,    173,     29,    232,
-		 179,    126,     73,     20,
-		 223,    170,    138,    191,
-		 244,    214,     94,    147,
-		 200,      2,    205,    103,
-		 156,    209,      6,     59,
-		 112,     90,    218,    240,
-		 187,    134,     81,     28,
-		 231,     77,    125,     72,
-		  19,    222,     86,    116,
-		  63,    245,     42,     95,
-		 148,    201,    254,     51,
-		 151,     98,     45,    248,
-		  60,    142,    166,    219,
-		 239,     69,    122,    175,
-		  27,     25,     78,    131,
-		 184,    237,     34,     87,
-		 140,    193,    246,     43,
-		  96,    149,    202,      0,
-		 203,    150,     97,     44,
-		 247,    194,    141,     88,
-		  35,    238,    185,    132,
-		  79,     26,    229,    176,
-		 123,    185,    238,     35,
-		  88,    114,    194,      8,
-		 211,    158,    105,     52,
-		   0,    202,    149,    159,
-		  43,      9,     62,    140,
-		  87,    221,    237,     71,
-		 124,     78,    230,     27,
-		  80,    133,     69,    239,
-		  36,    166,    142,     60,
-		 248,    210,     98,    104,
-		  51,      1,    201,    107,
-		  95,    213,     10,    192,
-		 116,     86,    222,    236,
-		 183,    125,     77,    231,
-		 227,     81,    134,     68,
-		 240,    218,     90,    112,
-		 196,    249,    209,     99,
-		 103,    205,    253,     55,
-		 147,    161,     41,    244,
-		  64,    138,     85,    223,
-		 235,    182,    129,     76,
-		 232,    226,     82,    120,
-		 188,     14,    217,    164,
-		 111,     58,      5,     47,
-		 155,    153,     49,      3,
-		  56,    146,    162,    215,
-		 243,     65,    137,     84,
-		 224,     21,     74,    128,
-		 180,     22,     30,    172,
-		 119,    189,     13,    216,
-		  92,    110,     57,    251,
-		 207,    101,    154,     48,
-		 251,     57,    145,     92,
-		 216,    242,     66,    136,
-		  83,    225,    233,     75,
-		 127,    181,    234,    224,
-		  84,    118,    190,     12,
-		  40,     93,    108,    198,
-		   3,    206,    103,    101,
-		 208,      5,    197,    111,
-		 164,     38,     15,    188,
-		 135,    172,     29,    232,
-		  77,    127,    182,    234,
-		 221,     87,    116,     64,
-		 245,    215,     94,    108,
-		  55,    253,    205,    152,
-		 157,     44,      7,    196,
-		 143,    165,     37,    240,
-		  68,    121,     81,    227,
-		  24,    178,    131,     72,
-		  18,     35,    171,    139,
-		 193,     11,     40,    161,
-		 148,    201,      0,     50,
-		 151,    157,    210,    249,
-		  60,    113,     89,     36,
-		  16,     69,    132,    173,
-		  26,    230,     79,    125,
-		 184,    236,    223,     86,
-		 115,     63,    247,    213,
-		  97,    104,    203,      0,
-		 201,    106,     98,    209,
-		 247,    194,    115,     90,
-		 221,    239,     70,    123,
-		  78,    228,    229,    176,
-		 133,     71,    239,    220,
-		 167,    143,     63,    245,
-		 211,    159,    148,     54,
-		   1,    202,    149,    159,
-		  42,     11,    195,    114,
-		  87,     34,     16,    186,
-		 124,    176,     27,     25,
-		  80,    120,    184,     17,
-		  36,    166,    143,     62,
-		 249,    210,    156,    149,
-		  49,      1,     54,    148,
-		 160,     42,    245,     63,
-		 138,    168,     32,     18,
-		 183,    130,    178,     24,
-		  29,    172,    132,     70,
-		 241,     37,    164,    142,
-		  59,    249,    209,     98,
-		 102,    205,      2,    200,
-		 147,    160,     41,    244,
-		  65,    139,    170,     32,
-		  21,    183,    127,    179,
-		  21,     28,     82,    121,
-		 190,     15,    217,     90,
-		 110,    196,      5,     47,
-		 155,    153,     49,    252,
-		  57,    144,    160,     40,
-		 242,     66,    138,    170,
-		 225,    233,     73,    129,
-		  75,    233,     30,    172,
-		 137,    189,     12,     37,
-		 161,    144,     57,      4,
-		  48,    154,    154,    207,
-		 249,     56,    145,     92,
-		 217,    243,     67,    136,
-		  83,    224,    233,     75,
-		 127,    181,     21,     31,
-		  84,    118,    191,     12,
-		  40,     93,    108,    199,
-		 252,    207,    100,    101,
-		  47,      5,    196,    110,
-		  91,    216,    241,    188,
-		 121,     83,    226,     23,
-		 179,    126,    183,     21,
-		 223,     84,    116,    191,
-		 244,    212,     95,    108,
-		  54,    255,    204,    152,
-		 157,     46,      6,     59,
-		 112,     91,    218,     15,
-		 185,    123,     80,     28,
-		  26,    176,    131,     72,
-		  19,     33,    169,    139,
-		  63,    245,    212,     94,
-		 148,     52,    253,    205,
-		 150,    159,     47,      7,
-		  60,    142,     89,    219,
-		 239,    186,    122,     80,
-		  27,     25,     78,    124,
-		  71,    237,    221,    168,
-		 141,     63,    246,     43,
-		 157,    151,     53,      1,
-		  54,    151,     97,    210,
-		 245,     61,    114,     90,
-		 222,    239,    185,    122,
-		  78,    228,    231,     77,
-		 123,     70,    239,    220,
-		  88,    115,    193,     10,
-		  44,     96,    107,    202,
-		 255,    202,    106,    159,
-		  42,      9,    193,    115,
-		  86,    221,     18,    185,
-		 124,    177,     24,     27,
-		  80,    120,    184,     18,
-		 219,     91,    115,     60,
-		 250,    209,     99,    151,
-		  49,      3,    201,    148,
-		 161,     42,    245,     63,
-		 116,    169,     32,     17,
-		 182,    125,    178,     24,
-		  28,     81,    134,     68,
-		 240,    218,     90,    113,
-		 196,      6,    209,     99,
-		 103,     50,      2,     55,
-		 146,    160,    214,    245,
-		  65,    117,     84,    222,
-		 235,     73,    129,    179,
-		  23,     29,    173,    120,
-		  67,     14,     38,    164,
-		 144,     59,    248,    211,
-		 102,    102,     48,      2,
-		 198,    108,     92,    213,
-		 242,     65,    118,     84,
-		 224,    235,     72,    129,
-		 181,     23,     31,    173,
-		 137,     67,     13,     37,
-		 160,    146,     56,    251,
-		  48,    154,    154,     48,
-		 251,    198,    111,     93,
-		  39,     12,    188,    119,
-		  83,     30,     23,    181,
-		 129,     75,    234,     31,
-		 171,    136,     65,    242,
-		 214,     92,    146,     58,
-		 254,    207,    153,    153,
-		  44,      7,    197,    144,
-		 164,     38,     14,    189,
-		 121,     82,    227,    233,
-		  77,    127,    182,     20,
-		  32,    170,    117,    190,
-		   9,     40,    163,    145,
-		  53,    253,     50,    153,
-		 157,     47,      6,     58,
-		 142,    164,     37,    240,
-		  69,    135,    172,     30,
-		  26,    179,    131,     72,
-		  19,     32,    168,    138,
-		  63,    245,    213,     95,
-		 106,    203,      3,     50,
-		 104,     99,    211,    249,
-		  62,    141,    165,     37,
-		  16,     69,    122,     81,
-		 228,     25,    179,    128,
-		  70,     19,     35,     87,
-		 112,    194,      8,    212,
-		  98,    107,    203,      0,
-		  53,    148,    159,    211,
-		 245,     62,    142,    165,
-		  35,    239,     68,    134,
-		 178,     27,     27,    176,
-		 123,    184,     19,     34,
-		 167,    114,    194,      8,
-		  44,    158,    150,    203,
-		 253,     54,    145,    157,
-		 212,    247,     63,    140,
-		 168,     35,     17,    187,
-		 127,     79,    230,    228,
-		  80,    122,     69,    236,
-		 223,     90,    115,    194,
-		   6,     47,    156,    104,
-		 206,    253,     52,    149,
-		 161,     43,     11,    192,
-		 139,    169,     33,     19,
-		 183,    124,     76,    230,
-		 226,     81,    135,     70,
-		 241,    218,     90,    112,
-		 197,    249,    208,     97,
-		 101,    205,      2,     55,
-		 145,    163,     40,    244,
-		  66,    137,    169,     34,
-		  22,    181,    122,     72,
-		 234,     29,    169,    131,
-		  65,    241,     38,     91,
-		 110,    196,    250,    209,
-		 101,    102,     49,      2,
-		 198,    111,     92,     40,
-		  12,     65,    137,    171,
-		 225,    232,     75,    128,
-		  73,    235,    225,    173,
-		 138,     64,    243,     39,
-		  92,    110,    198,      4,
-		 206,     97,     96,    203,
-		 249,    198,    108,     95,
-		 220,    240,     64,    138,
-		 174,     28,     20,     75,
-		 124,    182,     20,    226,
-		  87,    118,     67,    247,
-		 212,     95,    108,    198,
-		   0,     50,    152,    101,
-		 210,    251,     59,    146,
-		 167,     36,     12,    189,
-		 120,    173,     29,    232,
-		 179,    128,     75,    234,
-		 222,     84,    117,     64,
-		 246,    212,     95,    108,
-		  55,    252,    206,    100,
-		  97,     46,      5,    192,
-		 115,     90,     37,    240,
-		  69,    135,     81,    225,
-		 227,     79,    130,     74,
-		 237,     32,    170,    136,
-		 192,      9,     40,    160,
-		 106,    200,      1,    205,
-		 105,     98,     44,      6,
-		  60,    142,     89,    219,
-		 239,    186,    132,    174,
-		  26,    231,     76,    126,
-		 185,     19,     35,    169,
-		 115,    195,     10,     40,
-		 157,    151,     52,    255,
-		  53,    149,    157,     44,
-		 246,     63,    140,     88,
-		 222,    236,     71,    123,
-		  78,    229,     26,    176,
-		 122,    187,     19,     35,
-		 167,    115,    195,      9,
-		  45,    158,    105,    203,
-		 255,    202,    149,    159,
-		  42,     11,    194,    114,
-		 168,     35,     19,     71,
-		 131,     78,    231,    231,
-		  83,    121,    187,    239,
-		 219,    167,    143,    193,
-		   3,     41,    159,    151,
-		  51,      1,     54,    149,
-		 161,     43,    245,     63,
-		 139,    169,     33,     19,
-		  72,    128,    177,     27,
-		  29,    174,    121,    187,
-		  15,     37,    164,    141,
-		  56,    250,    210,     99,
-		 153,     48,      2,     52,
-		 145,     95,    210,    247,
-		  64,    118,     86,    223,
-		  16,    176,    122,     76,
-		  21,     28,    173,    134,
-		  65,    245,    221,     88,
-		 110,     57,    253,    216,
-		  96,    103,     48,      1,
-		 197,    110,     94,    211,
-		 242,    191,    114,     82,
-		 227,    234,    182,    123,
-		  72,    235,    227,     82,
-		 136,     67,    246,    221,
-		  88,    108,     56,    249,
-		  48,    154,    100,    204,
-		 248,     56,    111,     93,
-		 216,     12,    190,    118,
-		 173,     29,     21,    180,
-		 126,    180,    234,    226,
-		  80,    116,     67,    246,
-		 210,    162,    149,     61,
-		   2,     57,    144,    155,
-		 214,    252,     59,    106,
-		  92,    216,      8,    182,
-		 126,    175,     26,     19,
-		  79,    120,    180,    238,
-		 215,     81,    142,     71,
-		 246,     45,    166,    147,
-		 206,      7,    205,    100,
-		  96,     46,      4,    197,
-		 142,    161,     38,    240,
-		  71,    130,    174,    225,
-		 230,    178,    128,     74,
-		  19,     35,    168,    117,
-		 193,     10,     42,    160,
-		 105,    202,      2,     51,
-		 105,     98,     45,      6,
-		 195,    143,    164,     38,
-		 239,     71,    133,     82,
-		 230,     24,    181,    130,
-		 188,     17,    221,     82,
-		 112,     60,    243,    214,
-		 157,    145,     52,      3,
-		  54,    150,     96,    210,
-		   9,    193,    112,     89,
-		  32,     23,    186,    134,
-		 179,    229,    227,     77,
-		 129,     78,    236,     38,
-		 161,    114,    196,     12,
-		 208,    105,    107,     50,
-		   6,     55,    146,    157,
-		 209,    243,    193,    119,
-		  87,     32,     16,     71,
-		 128,    179,     25,    229,
-		  80,    133,     71,    239,
-		  38,    165,    142,    199,
-		   7,     45,    102,    151,
-		  50,      3,     54,    150,
-		  95,     46,    241,    196,
-		 141,     84,     34,    237,
-		 183,    126,    182,    225,
-		  21,     89,    131,    191,
-		 243,    219,    163,    114,
-		  62,     10,    214,    159,
-		 100,     52,      3,     51,
-		 146,    165,    220,     14,
-		  65,    125,    175,     32,
-		  21,     73,    130,     74,
-		  19,    224,    171,    123,
-		 190,    241,    217,     90,
-		 110,    197,    249,    210,
-		 155,    152,     50,    253,
-		  58,    109,     94,     40,
-		  12,     65,    119,    173,
-		 233,     28,     67,    119,
-		 182,     21,    234,    191,
-		 123,     79,      2,    208,
-		 163,    144,    195,    244,
-		  60,    108,    156,    206,
-		   6,     56,    144,    161,
-		 222,     12,     64,    113,
-		  80,     23,    231,    164,
-		 116,     67,     19,    226,
-		  83,    133,    178,    252,
-		  37,     85,    111,     60,
-		   0,    205,    157,    100,
-		 213,      1,     57,    108,
-		  91,     45,    252,    182,
-		 142,     90,     21,    233,
-		  75,    136,    189,    231,
-		  41,     86,    119,     65,
-		   9,    215,     94,    151,
-		 192,    250,     55,    152,
-		 100,     33,    246,    207,
-		 131,     82,     38,     11,
-		  72,    118,    162,    239,
-		  17,    177,    117,     75,
-		  23,    220,     87,    131,
-		 204,    252,     46,    163,
-		 103,     36,     14,    195,
-		 154,    101,    211,     14,
-		  50,     96,    168,    209,
-		 238,    191,    130,     88,
-		  31,    230,     72,    143,
-		 182,    228,     35,    160,
-		 124,     49,      7,    218,
-		 146,    105,    205,    241,
-		  36,    102,    148,    209,
-		 243,    197,    138,     93,
-		  35,     23,     75,    117,
-		 186,    224,    227,    161,
-		 107,     72,      0,    204,
-		 174,    143,    206,    231,
-		  35,    109,    144,     52,
-		 251,    205,    145,     96,
-		 209,      5,     49,    126,
-		 160,     33,    226,    171,
-		 147,     92,      9,    239,
-		 173,    142,    169,    253,
-		  41,     80,    142,     58,
-		   0,    219,    152,    150,
-		 196,     12,     59,     98,
-		 161,     35,    231,    208,
-		 155,     89,     45,    233,
-		  78,    109,    161,    233,
-		  21,     80,    124,     67,
-		   6,    220,     91,    133,
-		 212,    232,     33,    101,
-		  99,     34,    232,    218,
-		 130,     81,     32,     11,
-		  75,     97,    190,    211,
-		  23,    178,    134,     68,
-		  31,    230,     86,    137,
-		 174,    254,     47,    164,
-		  98,     47,     16,    194,
-		 149,    108,     50,     10,
-		  43,    123,    178,    208,
-		 247,    183,    128,     94,
-		  26,     23,     70,    108,
-		 160,    231,     26,    169,
-		 100,     91,     27,    201,
-		 175,    105,    197,    247,
-		  38,    115,    150,    206,
-		 243,    204,    154,     84,
-		  37,     10,     80,     97,
-		 191,    234,     22,    185,
-		 101,     80,      3,    240,
-		 160,    117,    184,    225,
-		  49,     79,    154,     59,
-		   9,    196,    145,     98,
-		 210,     11,     47,    121,
-		 180,    223,    244,    175,
-		 155,     73,      9,    229,
-		 180,    128,    189,    252,
-		  56,     69,    137,     70,
-		   1,    220,    166,    110,
-		 192,    236,     36,    116,
-		 151,     46,    245,    222,
-		 144,     66,     52,    249,
-		 185,    126,    191,    249,
-		  14,     65,    130,     65,
-		  24,    215,    175,    138,
-		 203,    230,     63,     79,
-		 147,     50,     19,    210,
-		 138,    116,     32,    255,
-		  61,    125,    179,    194,
-		   3,     77,    135,     90,
-		  23,    238,    179,    133,
-		 183,    249,     48,     90,
-		 143,     55,     17,    246,
-		 131,    121,     63,      4,
-		  49,    121,    137,    203,
-		   7,     56,    136,     83,
-		  47,    233,     70,    114,
-		 161,    241,     21,     70,
-		 123,     75,     13,    252,
-		 191,    127,     59,      8,
-		  37,    115,    129,    223,
-		  11,     53,    159,    109,
-		  32,    240,     60,    126,
-		 188,    201,     28,     66,
-		 128,     92,      6,    249,
-		 189,    115,     71,    235,
-		  41,     74,    155,    205,
-		 253,    215,    144,    101,
-		  58,    255,     62,    120,
-		 182,    199,      0,     62,
-		 128,     76,      0,    245,
-		 186,    134,    179,    237,
-		  14,     69,    151,    178,
-		 240,    208,    171,    125,
-		  61,    251,     32,    117,
-		 141,    194,     10,    203,
-		 128,     65,     52,    231,
-		 181,    136,    175,    208,
-		   7,     90,    115,    182,
-		  18,    236,    162,    116,
-		  64,    246,     55,     77,
-		 133,    203,    255,    216,
-		 131,    123,     41,    238,
-		 206,    147,    170,    216,
-		  30,     81,    125,    168,
-		  23,    231,    184,    135,
-		 180,    227,     15,     71,
-		 155,    176,    247,    222,
-		 176,    120,     46,     19,
-		 223,    156,    155,    201,
-		   8,     52,    101,    167,
-		  36,    246,    188,    117,
-		 164,    238,      5,     89,
-		 141,    176,     17,    241,
-		 178,    109,     89,     28,
-		 223,    162,    150,    207,
-		 247,     60,    111,    154,
-		  41,    252,    197,    109,
-		 173,    201,     26,     83,
-		 117,    170,     29,    230,
-		 164,    102,     93,     26,
-		 214,    168,    117,    188,
-		 243,     35,     91,    110,
-		  63,      5,    205,     98,
-		 146,    196,     31,     47,
-		  98,    170,    216,    254,
-		 166,    152,     74,      8,
-		 233,    181,    121,    183,
-		 233,     43,     92,    143,
-		  62,      8,     47,     86,
-		 132,    218,    235,     60,
-		 102,    144,    209,    243,
-		 217,    148,     64,     48,
-		 254,    176,    131,     83,
-		 231,     19,     64,    133,
-		  71,     17,     39,     93,
-		 131,    211,    229,     36,
-		 110,    155,    206,      9,
-		 220,    143,    120,     58,
-		 228,    207,    135,     95,
-		 220,     24,     86,    115,
-		 177,     27,     29,     68,
-		 138,    171,    250,     50,
-		  87,    156,    197,     15,
-		 196,    133,    114,     44,
-		 235,    196,    159,    104,
-		 213,      3,     47,    122,
-		 169,     34,     20,     77,
-		 112,    160,    245,     10,
-		  94,    151,    179,     20,
-		 206,    189,    109,     38,
-		  17,    221,    145,     98,
-		 204,     11,     38,     98,
-		 162,    213,      9,     55,
-		 120,    186,    202,      0,
-		  71,    105,    190,     26,
-		 240,    178,    100,     88,
-		  25,    203,    168,    123,
-		  59,    240,     35,    106,
-		 157,    204,      0,     63,
-		  98,    180,    195,     31,
-		  81,     97,    167,     33,
-		 250,    171,    161,     83,
-		  15,    241,    163,    115,
-		  66,    249,     43,     86,
-		 151,    199,    250,     39,
-		 106,    141,    218,     21,
-		  43,    126,    173,    215,
-		 252,    162,    150,    116,
-		   6,    254,    187,    140,
-		  79,    236,     21,     95,
-		 143,    188,     12,     32,
-		  81,    130,    211,    236,
-		  36,    113,    138,    204,
-		 240,    220,    142,     67,
-		  62,    230,    178,    133,
-		  85,    226,     31,     70,
-		 136,    183,     21,     23,
-		  91,    157,    171,    228,
-		  61,     78,    130,    195,
-		  10,    214,    135,    122,
-		  55,    238,    213,    157,
-		  92,    216,      6,     79,
-		 127,    173,     31,     16,
-		  65,    147,    160,    252,
-		  53,     70,    155,    185,
-		  12,    193,    188,    114,
-		  47,     23,    220,    151,
-		 105,     47,      0,     48,
-		 119,    167,     37,      8,
-		  73,    106,    185,    251,
-		  14,     89,    145,    176,
-		  22,    203,    183,    107,
-		  38,     29,    198,    175,
-		  96,     52,    251,     57,
-		 111,    159,     45,      1,
-		  48,     98,    190,    204,
-		   6,     80,    104,    167,
-		  24,    242,    173,     97,
-		  94,      5,    207,    184,
-		 126,     61,    242,     34,
-		 103,    150,    202,    248,
-		  57,    122,    136,    196,
-		  29,     46,     99,    175,
-		  33,    252,    163,    152,
-		  87,     15,    247,    160,
-		 118,     66,    237,     42,
-		  95,    137,    195,    241,
-		  32,    115,    128,    221,
-		  21,     38,    120,    150,
-		  42,    231,    216,    150,
-		  64,     55,    254,    169,
-		 141,     72,    231,     28,
-		  86,    134,    187,    233,
-		  40,     75,    152,    213,
-		 237,     62,    115,    158,
-		  50,    238,    209,    141,
-		  72,     63,    231,    207,
-		 134,     80,    223,     20,
-		  79,    121,    176,    225,
-		  16,     64,    147,    174,
-		 228,     55,     75,    134,
-		  58,      9,    199,    132,
-		 113,     38,    238,    217,
-		 156,     89,    214,     13,
-		  70,    118,    171,    217,
-		  24,     88,    106,    167,
-		 251,     15,     67,    142,
-		  66,      1,    207,    188,
-		 121,     46,     23,    192,
-		 149,     96,    207,      4,
-		  62,    111,    163,    209,
-		   0,     80,     98,    190,
-		 244,      6,     91,    118,
-		  73,     25,    244,    187,
-		  98,     81,     31,    200,
-		 174,    104,    199,    254,
-		  52,    100,    155,    201,
-		  15,     41,    122,    182,
-		 203,     30,     82,    127,
-		  80,     17,    253,    161,
-		 107,     88,      5,    239,
-		 167,    112,    190,    247,
-		  43,     93,    144,    193,
-		 247,     33,    114,    143,
-		 194,     23,     52,    106,
-		  93,     54,    229,    169,
-		 148,     67,     18,    229,
-		 185,    123,    182,    232,
-		  33,    170,    136,    184,
-		 248,     56,     74,    134,
-		 219,    239,     63,     99,
-		 100,     62,    234,    215,
-		 158,     85,     40,    253,
-		 178,    133,    175,    225,
-		 231,    179,    131,    176,
-		 224,     48,     66,    159,
-		 211,    231,     38,     93,
-		  98,     38,     19,    221,
-		 135,    108,     33,    244,
-		 203,    141,    166,     36,
-		 237,    184,    120,    168,
-		 232,     11,     90,    144,
-		 170,    253,     43,    168,
-		 120,     46,     25,    219,
-		 146,     97,     63,      9,
-		 206,    151,    158,     45,
-		 244,    192,    112,    175,
-		 209,      3,     82,    104,
-		 162,    235,     29,    179,
-		 118,     86,     30,    210,
-		 171,    120,     55,      1,
-		 215,    158,    150,     54,
-		 252,    203,    105,    150,
-		 216,     25,     46,    124,
-		 167,    214,     17,    190,
-		 143,     67,     19,    236,
-		 170,    126,     64,     21,
-		 216,    164,    117,     53,
-		  13,    215,     99,    158,
-		 193,     19,     36,    122,
-		 174,    220,    245,    202,
-		 133,     91,     40,    234,
-		 181,    131,     76,     25,
-		 226,    172,    127,     78,
-		   5,    220,     91,    134,
-		 202,    235,     60,    115,
-		 147,    207,    250,    196,
-		 157,     85,     46,    246,
-		  65,    119,    174,    221,
-		  20,    181,    139,     71,
-		  28,    230,     80,    143,
-		 178,    254,     40,     80,
-		 148,     57,     13,    218,
-		 147,     99,    206,      0,
-		  61,    107,    166,    215,
-		 240,    180,    133,     89,
-		  23,    235,     78,    115,
-		 185,    231,     21,     80,
-		 117,     74,      7,    223,
-		 166,    145,    195,    252,
-		  59,    109,    158,     49,
-		 241,    200,    129,     80,
-		  34,    243,     74,    124,
-		 161,    237,     21,    181,
-		 120,     64,     19,    228,
-		  86,    142,    183,    253,
-		  35,     85,    147,     49,
-		  14,    223,    151,    108,
-		  43,      1,     61,    100,
-		 174,    219,    243,    186,
-		 142,     84,     25,     20,
-		  68,    139,    185,    230,
-		  42,     86,    114,     75,
-		  27,    216,    168,    106,
-		 201,    249,     58,    111,
-		 156,     44,    255,    194,
-		 140,     88,    223,      7,
-		  79,    118,    162,    239,
-		  26,    180,    119,     88,
-		  24,    213,    161,    117,
-		  63,    240,     40,    163,
-		 105,     49,      5,    205,
-		 151,    154,    213,     10,
-		  51,    122,    170,    218,
-		 235,    178,    137,     86,
-		  18,    227,    176,    125,
-		 187,     16,    216,    171,
-		 116,     63,      8,     40,
-		 106,    157,    197,    242,
-		  56,     99,     97,     46,
-		 254,    203,    136,     80,
-		  32,    234,    186,    132,
-		  70,     28,    224,    182,
-		 133,     71,    233,     43,
-		  80,    131,    202,    252,
-		  41,    156,    104,     60,
-		 252,    201,    144,     96,
-		  46,    244,    199,    135,
-		  84,     42,    237,     69,
-		 125,    187,    224,     23,
-		  90,    141,    179,     16,
-		  36,    164,    114,    195,
-		   4,    208,    158,    109,
-		  55,    243,    193,    145,
-		  89,    214,     10,     56,
-		 114,    175,    215,     22,
-		  78,    124,    178,     24,
-		 226,     83,    135,     70,
-		  14,    223,    161,    123,
-		  55,      5,    215,    103,
-		 155,    200,      5,     52,
-		 105,    162,    210,     10,
-		 191,    117,     85,    220,
-		  16,    182,    129,     73,
-		  17,    235,    160,    122,
-		  71,    245,     32,     95,
-		 152,    199,    251,    208,
-		 100,    103,     49,      3,
-		  58,    105,    164,    214,
-		 243,    187,    129,     94,
-		  16,    234,    181,    121,
-		 191,    239,     25,     82,
-		 118,     64,     15,    222,
-		 162,    145,    197,    253,
-		  56,    103,    101,     52,
-		 241,    205,    158,    163,
-		 218,      4,     82,    127,
-		 171,    224,    236,    177,
-		 122,     67,     20,    225,
-		  87,    129,    183,    240,
-		 215,    164,    102,     53,
-		  13,     50,     99,    144,
-		 194,     15,     60,    110,
-		  83,     32,    246,    183,
-		 133,     80,    226,     16,
-		  68,    128,     73,     28,
-		 210,    165,    124,    185,
-		 253,     57,     77,    153,
-		 205,    252,    197,    155,
-		 100,     36,    251,    199,
-		 143,    173,    222,    241,
-		 185,    141,     92,     19,
-		 230,     71,    143,    163,
-		 252,     38,     84,    117,
-		  56,      9,    211,    168,
-		 104,     53,      3,     53,
-		 150,    103,     43,    247,
-		 211,    134,    175,    213,
-		   4,     81,    118,    172,
-		 228,    228,    178,    127,
-		  67,     16,    222,    170,
-		 140,    193,      1,    221,
-		 145,    126,     36,    251,
-		  58,    123,    135,    220,
-		  14,    194,    141,     90,
-		  33,    236,    187,    133,
-		  76,     27,     27,    183,
-		 114,     75,      4,    202,
-		 163,    157,    210,    239,
-		  57,    102,    148,    202,
-		   0,     54,    107,     98,
-		 212,    244,    197,    112,
-		  83,     40,    230,    174,
-		 153,     68,    237,     21,
-		  67,    150,    179,    238,
-		  38,     95,    140,    197,
-		 249,    209,    157,    108,
-		  51,    254,    195,    159,
-		  77,     55,    249,     53,
-		 125,    166,    209,     17,
-		 183,    127,    186,    237,
-		  21,     86,    134,     69,
-		  14,    216,    164,    119,
-		  53,     23,    202,    151,
-		 149,    202,      9,     59,
-		 151,     88,    210,     12,
-		  76,    101,    162,    221,
-		  20,     73,    126,     79,
-		  17,    238,    186,     96,
-		  66,    248,     35,     81,
-		 146,     54,     12,     43,
-		  99,    149,    223,      4,
-		  57,    111,    161,    210,
-		  12,    186,    131,     76,
-		  16,     19,     79,    125,
-		 176,     17,    245,    171,
-		 143,    187,    252,     40,
-		  92,    110,    197,    253,
-		  56,    102,    154,     59,
-		 233,     60,    102,     93,
-		 218,    246,    171,    154,
-		 172,    231,     31,     70,
-		 133,     77,     23,     28,
-		  81,    128,    185,     13,
-		 220,     88,    131,    196,
-		   1,    202,    140,    121,
-		  41,      3,     57,     99,
-		 173,     44,    251,    188,
-		 121,    168,    235,     19,
-		 180,    134,    170,    230,
-		 223,     84,    100,     98,
-		   0,     47,     93,    148,
-		 207,      8,    220,    159,
-		 156,    208,      3,     49,
-		 137,    162,    254,     28,
-		  71,    122,     90,     60,
-		 247,     70,    135,    181,
-		 235,    211,    179,    127,
-		  62,     14,     47,     86,
-		 108,    193,    218,     39,
-		 105,    153,     40,    228,
-		 200,     99,    172,    216,
-		  19,    181,    155,     67,
-		  24,    229,     79,    137,
-		  70,    225,      3,     88,
-		 113,     62,     14,    195,
-		 157,    128,    216,    246,
-		  53,    153,    127,     52,
-		 254,    196,    114,    165,
-		 217,     10,     95,    125,
-		  76,     19,    247,    191,
-		 130,    175,    248,     47,
-		 166,    127,     43,     27,
-		 218,    152,    109,     55,
-		  20,     20,    100,    159,
-		  46,    228,    216,    142,
-		 185,    205,     29,     79,
-		 138,     92,     21,    236,
-		 167,    120,     66,    239,
-		   5,     67,    142,     58,
-		  12,    207,    142,    156,
-		 221,     12,     63,    144,
-		  80,     36,    242,    192,
-		 118,    168,    220,      9,
-		 106,    119,     74,     19,
-		 250,    179,    121,    168,
-		 254,     32,    160,     96,
-		  40,      8,    212,     97,
-		 155,    201,     29,     27,
-		 126,     95,     45,    227,
-		 156,    140,    164,    213,
-		  22,    177,    146,     90,
-		   6,    235,    174,    121,
-		 184,    210,     23,     66,
-		 149,    199,      9,    204,
-		 157,    136,    196,    249,
-		 202,    135,     64,     60,
-		 251,    182,    133,    170,
-		 196,     59,     82,    118,
-		 178,     30,    240,     86,
-		 158,    173,      9,    202,
-		 180,    113,     34,      8,
-		 199,    137,    102,    233,
-		  35,     52,    105,    166,
-		  43,    248,     86,     86,
-		 184,    225,    230,    162,
-		  98,     80,     31,    234,
-		 178,    116,    155,    238,
-		  41,     95,    147,     41,
-		  11,     40,     68,    139,
-		  47,    253,    213,    136,
-		  74,     34,    252,    170,
-		 115,    139,    236,    239,
-		 178,    116,     92,     20,
-		  61,     74,    141,     71,
-		  13,    218,    181,    107,
-		 203,      9,    197,    124,
-		 188,    211,    243,    194,
-		 157,     78,    221,     20,
-		  84,    130,     86,     26,
-		 246,    163,    125,    183,
-		  27,     42,    119,    157,
-		  63,     14,    209,    178,
-		 100,    194,    236,    204,
-		 158,     99,     37,    237,
-		 210,    139,     93,    221,
-		  14,    103,    106,     80,
-		  31,    225,    189,    124,
-		 180,    239,    212,    174,
-		 112,     53,     24,    196,
-		 144,    149,    211,    226,
-		  37,     97,    159,     43,
-		 242,     62,    119,     91,
-		  40,    233,    184,    134,
-		  73,     22,    241,    185,
-		 138,    160,    254,     43,
-		  94,    140,     62,    245,
-		  37,    156,    123,     58,
-		 251,    200,    106,     99,
-		  37,    243,     48,     97,
-		 162,    217,     17,     69,
-		 120,    183,    226,    231,
-		 161,    110,     74,     21,
-		  39,    167,    125,     62,
-		 232,     57,    104,    147,
-		 207,      0,     50,     98,
-		 165,     44,    255,    206,
-		 153,     93,    220,    237,
-		 186,    131,    188,    232,
-		  17,     91,    130,    186,
-		 249,     44,    167,    125,
-		  50,     12,    220,    152,
-		 152,     58,    240,    200,
-		 101,    168,    223,      0,
-		  70,    119,    163,    211,
-		 233,    162,    144,     68,
-		  16,    227,     90,    120,
-		  73,    241,     33,     90,
-		 145,    201,    247,     40,
-		 111,    146,     55,    234,
-		 210,    157,     90,    212,
-		   5,     67,    119,    173,
-		 227,    238,    183,    120,
-		 191,    231,     17,     80,
-		 123,     87,     21,    203,
-		 166,    151,    192,    248,
-		  57,    110,    152,     52,
-		   4,     62,     98,    177,
-		 213,    246,    169,    145,
-		  74,     14,    232,     76,
-		 135,    190,    225,     26,
-		 169,    117,    191,    249,
-		  62,     72,    149,     48,
-		  21,    209,    131,    105,
-		  44,      3,     42,    124,
-		 175,    216,    244,    187,
-		 120,    189,    247,     25,
-		  74,    121,     82,     10,
-		 204,    167,    114,    184,
-		 236,     60,     88,    108,
-		  54,      3,     55,    106,
-		 144,    213,    251,    201,
-		 154,     78,     53,    250,
-		  69,    107,    184,    238,
-		  27,    177,    121,    181,
-		 224,     47,     83,    126,
-		  46,      5,    196,    178,
-		 109,    197,    237,     61,
-		  97,    159,     40,    253,
-		  57,    126,    171,    218,
-		 229,    181,    138,     64,
-		  21,    229,     69,    146,
-		 182,    234,    221,    173,
-		 112,    199,    253,     45,
-		 157,     98,     60,     11,
-		 197,    157,    159,    217,
-		   3,     52,    117,    166,
-		  32,     16,     78,    127,
-		  74,     29,    225,    181,
-		 115,     64,     16,     33,
-		  91,    139,    196,    244,
-		  44,     98,    144,    201,
-		 252,    204,    145,    101,
-		  34,    241,     63,    118,
-		 172,    216,     23,     68,
-		 125,    179,    229,     25,
-		 173,    115,     77,     16,
-		 218,    161,    114,    199,
-		 252,     47,    103,    144,
-		 205,      1,     50,    111,
-		  93,     32,    252,    196,
-		 137,     87,    221,     21,
-		  75,    130,    178,    228,
-		  30,     80,    130,    189,
-		 240,    210,    174,    119,
-		  60,      0,     47,    105,
-		 148,    202,      3,     55,
-		 147,     92,     40,      8,
-		  68,    136,     93,     39,
-		 236,    189,    137,    183,
-		 230,     16,     91,    143,
-		 191,     13,    218,     91,
-		 144,     62,     13,    212,
-		 152,    110,     58,    255,
-		  63,    100,    171,    219,
-		   7,     69,    136,     85,
-		  30,    238,    188,    135,
-		  72,     16,    232,    168,
-		 137,    190,    246,     47,
-		  80,    152,    194,    249,
-		  48,    159,    111,     56,
-		 248,    197,    151,     88,
-		 218,     14,     66,    118,
-		 169,    233,     17,     77,
-		 134,    180,     18,    234,
-		 172,    112,     70,     15,
-		  44,     85,    150,    199,
-		 253,     51,    103,    152,
-		 214,      1,    199,    151,
-		  93,     33,    250,    181,
-		 135,    165,    232,     16,
-		  73,    130,     73,     22,
-		  32,     81,    138,     67,
-		   9,    212,    171,     96,
-		  50,    255,     52,    111,
-		 150,    217,      5,    198,
-		 139,     88,     36,    240,
-		  70,    122,     82,     21,
-		 239,    176,    130,    180,
-		 235,     43,     95,    136,
-		  62,     14,    210,    168,
-		 104,    203,    255,    206,
-		 149,     98,     44,    249,
-		  62,    119,    160,    223,
-		  19,     69,    128,     87,
-		  24,    230,    179,    127,
-		  70,    239,     32,     85,
-		 143,    197,    242,     42,
-		 158,    149,     53,      1,
-		 203,    105,    101,     43,
-		 242,    192,    114,    164,
-		 217,     22,     67,    123,
-		  76,     31,    224,    177,
-		 128,    190,    239,    217,
-		 175,    116,     63,    244,
-		  36,    104,    145,    202,
-		 250,    195,    156,    100,
-		 214,     15,     56,    114,
-		  83,     36,    233,    184,
-		 127,    184,    236,     29,
-		 174,    124,     77,     22,
-		 217,     91,    138,    194,
-		   6,    208,    159,    104,
-		 206,      7,     48,    111,
-		  95,     41,    246,    193,
-		 116,    169,     32,    239,
-		 178,    134,     79,    230,
-		  24,     84,    131,    191,
-		  15,    223,    161,    112,
-		 199,    250,     47,    157,
-		  98,     53,    248,    201,
-		 110,    164,    209,     14,
-		  64,    137,     86,     33,
-		  21,     74,    122,    179,
-		  20,    231,    168,    124,
-		  66,    243,     35,     93,
-		 148,    197,      6,    210,
-		 100,    152,    204,      1,
-		  57,    144,     88,     44,
-		 240,    188,    119,    175,
-		 227,     20,    181,    128,
-		  75,     22,     30,     82,
-		 136,    189,     13,    218,
-		 160,    108,     57,    250,
-		  49,    100,    155,    205,
-		   5,     57,    145,     93,
-		  38,    242,    189,    136,
-		  82,     30,    233,    180,
-		 128,    181,     20,     31,
-		  87,    138,    191,    243,
-		 215,    161,    110,     58,
-		   3,     49,    103,    154,
-		  47,    251,    196,    144,
-		 165,    219,     13,     65,
-		 120,     83,     31,    235,
-		 177,    126,    183,    232,
-		  34,     85,    119,     66,
-		  11,     40,     95,    145,
-		 202,    252,    205,    154,
-		  97,     44,    249,     57,
-		 114,    164,     37,    241,
-		 186,    134,    175,    226,
-		  25,     76,    130,     72,
-		  17,    220,    168,    116,
-		 192,    244,     42,    160,
-		 148,    201,      1,    204,
-		 104,    157,     45,      7,
-		  60,    142,     88,     36,
-		 239,    186,    122,    175,
-		  27,    230,     78,    131,
-		  71,     18,    221,    168,
-		 115,    193,    246,     43,
-		  96,    148,     53,      1,
-		 203,    105,    158,    211,
-		   8,     61,    141,     89,
-		  34,    239,    185,    122,
-		 178,    228,     26,    176,
-		 122,     70,    238,     35,
-		  89,    141,    194,      9,
-		 210,    159,    105,     52,
-		   0,     52,    107,    159,
-		  43,    246,    193,    115,
-		 168,    221,     18,    184,
-		 131,     79,     25,    228,
-		  80,    133,    186,    239,
-		  36,     89,    142,    195,
-		 248,    210,    157,    105,
-		  51,    254,    201,    148,
-		 160,    213,     10,    192,
-		 139,     86,    222,     18,
-		  73,    125,     77,     25,
-		 226,    175,    121,    187,
-		 240,     37,    165,    143,
-		  59,      6,     46,     99,
-		 152,    205,      3,     55,
-		 147,     94,     41,    244,
-		 191,    117,    170,     32,
-		 235,     73,    126,    179,
-		 233,     28,    173,    120,
-		 188,    241,    217,    164,
-		 111,     58,      5,    208,
-		 155,    153,    206,      3,
-		  56,    109,     93,     40,
-		 243,    190,    118,    171,
-		  31,    234,    181,    128,
-		  75,     22,    225,     83,
-		 137,    188,    242,     39,
-		 163,    111,     56,      4,
-		  49,    100,    154,     48,
-		 251,    198,    145,    163,
-		 216,     13,     66,    119,
-		 172,     30,    233,    180,
-		 127,     74,     21,     31,
-		  84,    137,    190,     12,
-		 215,     93,    146,    199,
-		 252,     49,    153,    100,
-		  47,      5,     58,    111,
-		 164,    217,     14,     67,
-		 120,    173,    226,    232,
-		 179,    129,    182,    235,
-		  32,    170,    117,     64,
-		  11,     41,     94,    147,
-		 200,    253,     50,    103,
-		  99,     46,    249,    196,
-		 112,    165,    218,    240,
-		 187,    134,     81,     28,
-		 231,     77,    130,    183,
-		 236,    222,    169,    116,
-		 192,    245,     42,     95,
-		 148,     54,      1,    204,
-		 104,    157,    210,      7,
-		  60,    113,     89,     36,
-		  16,    186,    133,     80,
-		  27,     25,     78,    131,
-		  71,     18,    221,    168,
-		 115,    193,    246,    212,
-		 159,    106,     53,      0,
-		  52,    105,    158,    211,
-		   8,     61,    141,     88,
-		  35,     17,     70,    123,
-		 176,    229,    229,    176,
-		 123,     70,     17,     35,
-		  88,    141,    194,      8,
-		 211,    158,    105,     52,
-		   0,     53,    106,    159,
-		  43,    246,    193,    140,
-		  87,    221,     18,     71,
-		 131,     78,     25,    228,
-		 175,    122,     69,    239,
-		  36,     89,    142,     60,
-		   7,     45,     98,    151,
-		 204,      1,     54,    148,
-		  95,    213,    245,    192,
-		 139,     86,    222,     19,
-		  72,    125,    178,     24,
-		 227,    174,    121,     68,
-		 240,     37,     90,    143,
-		  59,      6,    209,    156,
-		 103,    205,      2,     55,
-		 108,     94,     41,    244,
-		 191,    117,    170,    223,
-		  20,     73,    129,     76,
-		  23,    226,    173,    135,
-		 188,    241,    217,    164,
-		 111,     58,      5,     47,
-		 100,    153,    206,      3,
-		  56,    146,     93,     40,
-		 243,     65,    118,    171,
-		 224,    234,    181,    128,
-		  75,    233,     30,     83,
-		 136,     66,     13,    216,
-		 163,    110,    198,    251,
-		  48,    101,    101,     48,
-		 251,    198,    145,     92,
-		 216,     13,     66,    136,
-		  83,     30,    233,    180,
-		 127,    181,    234,     31,
-		 171,    118,     65,    243,
-		  40,    162,    146,     56,
-		 252,     49,    102,    155,
-		 208,      5,     58,    111,
-		 164,    217,     14,     67,
-		 135,    173,    226,     23,
-		  76,    129,    182,     20,
-		 223,    170,    117,     64,
-		  11,    214,     94,    147,
-		 200,      2,    205,    152,
-		  99,     46,    249,     59,
-		 143,    165,    218,     15,
-		  68,    121,     81,     28,
-		 231,     77,    130,    183,
-		 236,     33,     86,    139,
-		 192,    245,    213,    160,
-		 148,     54,      1,    204,
-		 151,     98,     45,      7,
-		  60,    113,    166,    219,
-		  16,    186,    133,     80,
-		  27,    230,     78,    124,
-		 184,    237,     34,     87,
-		 115,     62,      9,    212,
-		 159,    106,     53,    255,
-		  52,    105,    158,    211,
-		   8,    194,    141,     88,
-		  35,    238,     70,    123,
-		  79,    229,     26,    176,
-		 123,    185,    238,     35,
-		 167,    114,     61,      8,
-		 211,     97,    105,    203,
-		 255,     53,    107,     96,
-		 215,    246,     61,    113,
-		  87,    223,    239,     71,
-		 128,     76,     26,    230,
-		 173,    120,     68,     19,
-		 217,    175,    140,     60,
-		 250,     39,     97,    157,
-		 200,      4,     50,    144,
-		 160,     35,    245,    195,
-		 138,    160,    222,     26,
-		  76,    124,     76,      8,
-		 236,    164,    114,     69,
-		 242,     32,     80,    135,
-		 207,    250,     46,    152,
-		 105,     56,    246,    204,
-		 102,    168,    192,     25,
-		  78,    124,     93,     43,
-		 241,    151,    152,     94,
-		  17,     23,     65,    154,
-		 166,    230,     41,    164,
-		 104,     45,     18,    195,
-		 150,    159,    195,     27,
-		  34,    124,    174,     45,
-		 252,    163,    151,     67,
-		  12,    234,     68,    108,
-		 169,    245,     12,     88,
-		 113,     82,     17,    193,
-		 177,    106,    202,    234,
-		  44,    115,    150,    202,
-		 244,    220,    177,    124,
-		  48,    249,     70,    102,
-		 182,    254,     15,     90,
-		 130,     67,      5,    243,
-		 187,    117,    187,    253,
-		  62,     77,    157,     57,
-		  10,    215,    133,    114,
-		  56,    249,     63,    127,
-		 191,    193,     27,     72,
-		 134,     94,     11,    248,
-		 189,    127,    185,    251,
-		  59,     71,    129,    191,
-		  26,    204,    135,    113,
-		  46,      8,     53,    119,
-		 129,    204,     28,     52,
-		 112,     81,     61,    229,
-		 169,    130,    160,    241,
-		  56,     85,    144,    179,
-		  29,    201,    133,     87,
-		  33,     24,     44,     79,
-		 180,    232,    224,     37,
-		 108,    100,     58,    225,
-		 214,    131,    175,    212,
-		  12,     88,    105,    162,
-		  18,    245,    151,     86,
-		  88,     14,    217,     92,
-		 148,    229,    233,     48,
-		 108,    105,     58,     26,
-		 221,    132,    158,    221,
-		  29,     34,    103,    182,
-		 220,    225,    165,    174,
-		 109,      5,    234,     73,
-		 151,    155,    205,     60,
-		  78,    137,     58,     29,
-		 197,    143,     97,    195,
-		  16,     44,    114,    144,
-		 215,    248,    223,    168,
-		 117,     63,    252,     71,
-		 109,    169,    197,      7,
-		  68,    131,     79,      1,
-		 195,    182,    116,    203,
-		 237,     52,    121,    134,
-		 200,    246,    212,    179,
-		 120,      9,    224,    196,
-		 101,    181,    253,     55,
-		  95,    115,     74,     10,
-		 245,    184,    127,    190,
-		 227,     57,     65,    150,
-		 194,      3,    202,    183,
-		  64,     25,    234,    195,
-		  98,    189,    247,     33,
-		  89,    103,     81,     52,
-		 243,    171,    140,    178,
-		 230,      1,     78,    155,
-		 177,     15,    204,    131,
-		  72,     17,     27,    223,
-		 108,    141,    234,     43,
-		  37,    122,     92,     36,
-		 235,    166,    133,     85,
-		 241,      3,     84,    101,
-		 191,    235,    249,    178,
-		  80,    104,     19,    201,
-		  84,    157,    224,    219,
-		  41,    124,     97,     57,
-		 237,    210,    154,    162,
-		 202,     30,     93,     98,
-		 166,    227,    243,    148,
-		  92,     99,     12,    234,
-		 171,    147,    163,    208,
-		   9,     81,    151,     44,
-		  16,    215,    148,    145,
-		 216,     38,     45,    118,
-		 181,     44,    225,    149,
-		 167,    126,      6,    228,
-		 177,    154,    160,    193,
-		  54,     71,    117,     84,
-		   4,    203,     94,    146,
-		 220,    226,     38,     71,
-		 157,     45,    229,    230,
-		 145,    118,     43,    226,
-		  78,    106,    179,    192,
-		  10,     92,    118,     67,
-		  10,    209,     86,    143,
-		 222,    227,     53,     76,
-		 148,     62,     37,    212,
-		 190,    127,     34,    244,
-		  45,    127,    133,    194,
-		   3,     66,    139,     94,
-		   1,    238,     78,    143,
-		 165,    245,     57,     91,
-		 114,     42,     23,    207,
-		 186,    126,     58,      0,
-		  58,    124,    131,    199,
-		   7,    198,    135,     75,
-		  50,    238,     66,     98,
-		 170,    249,     15,     76,
-		 113,     88,      8,    253,
-		 187,    126,     53,    253,
-		  62,    118,    129,    199,
-		   0,    193,    134,    115,
-		  44,     13,     44,    109,
-		 183,    199,     30,    190,
-		 155,     85,     56,    250,
-		 189,    112,    188,    225,
-		  61,     77,    158,    192,
-		  11,    220,    133,     97,
-		  50,     13,     43,    117,
-		 191,    197,     11,    211,
-		 156,     75,      1,    253,
-		 185,    126,    191,    242,
-		  11,     92,    128,     72,
-		  31,    204,    180,    143,
-		 194,    229,     51,    125,
-		 143,    205,    246,    222,
-		 143,     64,     60,    248,
-		  64,    123,    188,    201,
-		  27,     77,    141,     95,
-		  15,    240,    169,    130,
-		 165,    239,      7,     67,
-		 147,     60,     23,    203,
-		 135,    126,     60,    252,
-		  54,    122,    181,    196,
-		   8,    183,    157,     77,
-		  12,    225,     78,    109,
-		 175,    246,     11,     86,
-		 136,     78,     27,    206,
-		 187,     98,     59,    246,
-		  34,    118,    137,     48,
-		 253,    210,    134,     83,
-		  42,      8,     78,    111,
-		 182,    237,     26,     75,
-		 118,     68,      2,    240,
-		 166,    137,    179,    254,
-		  63,     84,    145,     63,
-		  22,    193,    138,     99,
-		 208,      2,     44,    100,
-		 170,    215,    240,    188,
-		 138,     66,     19,    227,
-		  72,    133,    185,    224,
-		  39,     82,    114,     69,
-		   6,    218,    164,    107,
-		 206,    255,     55,    118,
-		 154,    219,      6,    193,
-		 138,     87,     36,    245,
-		  65,    122,    175,    232,
-		 231,     75,    124,     77,
-		  23,    210,    173,    122,
-		  58,    253,     40,     78,
-		 147,    206,    253,    201,
-		 104,    105,     44,    242,
-		 198,    117,     88,    203,
-		  23,     77,    126,     87,
-		  31,    241,    186,    120,
-		  64,    224,     39,     88,
-		 135,    199,    241,    211,
-		 158,    121,     61,      5,
-		 206,    102,    148,    193,
-		   0,     62,    136,     76,
-		  39,    255,    190,    132,
-		  78,    235,     29,     94,
-		 129,    186,     23,    205,
-		 175,    125,    192,    240,
-		  33,    110,    158,    204,
-		 243,    201,    146,    110,
-		  41,    253,     61,    112,
-		 163,    209,     17,     66,
-		 142,     72,     23,    226,
-		  86,    131,    170,    232,
-		  45,    160,    114,    194,
-		  12,     46,    149,    151,
-		 206,      3,     60,    148,
-		 161,     36,    253,    205,
-		 128,    175,    219,      3,
-		  67,    116,     73,     29,
-		  31,    164,    135,     66,
-		 240,     35,     94,    129,
-		 198,    248,    221,    147,
-		 105,     35,      2,     51,
-		 102,    176,    222,     10,
-		  68,    116,     86,    223,
-		 227,    180,    129,    183,
-		 225,     26,     83,    127,
-		  74,      3,    211,    166,
-		 111,    193,    240,     47,
-		 101,    145,    204,      6,
-		  57,    145,     95,     42,
-		   9,     64,    112,     86,
-		  24,    239,    187,    126,
-		 180,     22,     22,    175,
-		 115,    189,     13,     37,
-		  89,    144,    196,    251,
-		  53,     96,    155,    206,
-		 241,    206,    155,     84,
-		 208,     15,     75,    124,
-		  87,    229,    233,    178,
-		 128,     66,     23,    227,
-		  85,    131,    186,    249,
-		 215,    164,    107,     52,
-		   3,    207,    103,    147,
-		  45,      2,     49,    110,
-		 162,     34,    246,    182,
-		 141,     82,     24,     17,
-		  78,    127,    178,     17,
-		  39,     87,    138,    183,
-		   1,     40,     86,    147,
-		 196,      2,     51,    158,
-		 104,    208,    247,     59,
-		 137,     82,    216,    245,
-		  72,    126,    169,    237,
-		 237,     69,    134,     75,
-		 225,    213,     85,    127,
-		  54,    244,    219,     88,
-		 101,     50,      2,    198,
-		 102,     99,    217,     12,
-		 192,    102,    164,    215,
-		  26,    179,    127,     74,
-		  29,    246,    191,    128,
-		  73,    229,    223,     82,
-		 130,     62,    249,    210,
-		 101,    155,     49,    232,
-		 201,    110,     96,     60,
-		 246,    220,    136,     75,
-		  46,     18,    177,    105,
-		 180,    232,     17,    180,
-		 146,     66,    229,     37,
-		 160,    135,     44,    244,
-		 195,    149,    110,     32,
-		   2,    193,     98,    150,
-		 215,     24,    197,    103,
-		 163,    216,      1,    176,
-		 123,     94,     30,    233,
-		 189,    120,     80,    237,
-		 216,     92,    128,    198,
-		 247,    214,    106,    144,
-		  51,     19,    205,     98,
-		  87,     34,    253,    214,
-		 140,     79,     39,    235,
-		  73,    111,    186,    255,
-		  27,     95,    150,     64,
-		 252,    211,     91,    123,
-		  54,      3,    198,    158,
-		 113,     52,    251,    204,
-		 124,    162,    192,      1,
-		  80,    108,    175,    202,
-		 232,     73,    136,     88,
-		  29,    254,    164,    109,
-		  74,     10,    220,     75,
-		 148,    215,    241,     35,
-		 124,    159,    218,      2,
-		  59,    145,     77,     47,
-		 232,    181,    145,     90,
-		  24,    224,     69,    123,
-		 166,    230,     20,     71,
-		 143,    176,    241,    217,
-		 162,     98,     61,     10,
-		 198,    147,    106,     53,
-		 241,     58,    107,    164,
-		 214,      7,     76,    126,
-		 164,    226,    232,    177,
-		 117,     66,     31,    229,
-		 175,    117,    190,     15,
-		  45,     93,    144,    195,
-		 254,     57,    100,    147,
-		  47,    251,    199,    155,
-		  95,     45,    245,     67,
-		 135,    164,    230,     29,
-		  74,    128,    180,     16,
-		 223,    175,    116,     68,
-		  15,     41,    164,    146,
-		  54,    253,     49,    103,
-		 152,    208,      0,     63,
-		 112,    166,     33,     12,
-		 185,    143,     82,     20,
-		 227,    183,    130,    180,
-		 239,     40,     85,    141,
-		 194,     11,     41,    164,
-		 106,     55,      2,    204,
-		 149,     98,     47,    249,
-		 193,    140,    167,    219,
-		  19,     65,    126,    172,
-		 229,     24,    176,    125,
-		  68,     16,    222,    169,
-		 141,     62,    244,     43,
-		  96,    148,     53,    255,
-		 202,    151,     97,     46,
-		   8,    195,    141,    167,
-		  35,     17,    185,    121,
-		 177,    228,     24,    176,
-		 132,     71,     16,     35,
-		 166,    141,     60,      8,
-		 211,    156,    150,     54,
-		   0,     53,    104,    154,
-		 215,     15,     60,    114,
-		 168,     38,    239,    188,
-		 129,     78,     24,     27,
-		 173,    123,     68,     18,
-		 219,    166,    140,    193,
-		 251,     47,     99,    149,
-		  50,    254,    203,    150,
-		  94,     43,     10,    192,
-		 116,     87,     32,    236,
-		 183,    124,    179,    229,
-		  29,     81,    135,     69,
-		  15,    219,    165,    143,
-		  59,    250,     47,     97,
-		 153,     50,    253,    202,
-		 108,     95,    214,    244,
-		 190,    117,     84,     32,
-		 235,    182,    126,    179,
-		 234,     28,     81,    133,
-		 189,    243,    216,     91,
-		 110,     56,      4,    212,
-		 154,    101,     48,    252,
-		 199,    108,    162,    214,
-		  13,     64,    116,    170,
-		 225,     20,     74,    127,
-		  74,     23,    226,    174,
-		 117,     64,     13,     39,
-		  93,    147,    196,    249,
-		  49,    100,    154,    207,
-		 251,     57,    110,     92,
-		 216,    243,    188,    137,
-		  81,     30,    233,     74,
-		 129,    180,    234,     31,
-		  84,    118,     65,    243,
-		 215,     93,    146,     56,
-		   3,    207,    153,    101,
-		  47,      5,     58,    110,
-		 165,    216,     14,    188,
-		 134,     83,     28,    232,
-		  76,    128,    183,    234,
-		  32,    170,    117,     64,
-		  11,     41,     94,    145,
-		 201,    252,     50,    153,
-		  98,     45,    248,    197,
-		 112,    167,    219,     14,
-		  68,    134,     80,     29,
-		 230,    178,    125,    183,
-		 236,     33,     86,    116,
-		  63,     11,    212,    160,
-		 107,    200,    254,     50,
-		 105,     98,    210,    249,
-		 195,    113,    166,    219,
-		 239,     69,    122,     80,
-		 228,    230,     78,    124,
-		 184,    237,    221,     87,
-		 115,     62,      9,    212,
-		  96,    106,     53,      0,
-		 203,    150,     97,    211,
-		   8,     60,    115,    167,
-		 220,    238,    185,    133,
-		  78,     26,    229,     79,
-		 123,     70,    238,    220,
-		  88,    114,    194,    247,
-		  44,     96,    151,    202,
-		   1,     53,    149,     97,
-		  42,    247,    192,    140,
-		  87,     34,    237,    184,
-		 131,    177,    230,     27,
-		  81,    132,    187,    238,
-		  36,     89,    113,     61,
-		   6,    211,    156,    105,
-		  51,    254,    201,    148,
-		 160,    213,     10,     62,
-		 117,    168,    220,     18,
-		  72,    125,     77,     25,
-		 226,    175,    120,     68,
-		  15,    218,    165,    112,
-		 196,    249,     46,     99,
-		 153,    204,      3,     55,
-		 108,     94,     41,    244,
-		 190,    139,     84,     33,
-		 235,    183,    129,     76,
-		  23,     29,     82,    134,
-		 189,    240,     38,     91,
-		 144,     58,    250,    208,
-		 100,    102,     49,    252,
-		 199,    146,     93,     40,
-		 243,    190,    118,    171,
-		 225,     20,     74,    127,
-		 180,    233,    225,    172,
-		 119,     66,     13,    216,
-		 163,    110,     57,      4,
-		 207,    101,    154,    207,
-		   4,     57,    110,    163,
-		 216,     13,    189,    136,
-		  83,     30,    232,    180,
-		 127,     74,    234,    224,
-		  84,    137,    190,    243,
-		  40,     93,    146,    199,
-		 252,    206,    153,    100,
-		  47,    250,    197,    111,
-		 164,    217,     14,     67,
-		 120,    173,    227,     23,
-		  76,    129,     73,     20,
-		 223,    171,    116,     65,
-		  10,    214,    161,    147,
-		 200,    253,     51,    102,
-		 157,    208,      6,     59,
-		 112,     90,     37,    240,
-		 187,    135,     81,     28,
-		 231,     77,    125,    183,
-		 236,     33,     86,    139,
-		 193,    245,     42,     95,
-		 107,    201,      0,    204,
-		 151,     98,     45,    248,
-		 195,    142,    166,    219,
-		  16,     69,    122,    175,
-		 228,     25,     78,    124,
-		  71,     18,    221,    168,
-		 115,     62,      9,    212,
-		  96,    149,    202,    255,
-		  52,    105,    158,    211,
-		   8,     61,    141,     88,
-		  35,    238,    185,    132,
-		  79,     26,     26,     79,
-		 132,    185,    238,     35,
-		  88,    141,    194,    247,
-		  44,    158,    105,     52,
-		 255,    202,    149,     96,
-		  43,    246,    193,    115,
-		 168,    221,     18,     71,
-		 124,    177,    230,     27,
-		  80,    133,     69,     16,
-		 219,    166,    113,     60,
-		   7,    210,     98,    151,
-		 204,      1,     54,    107,
-		 160,    213,     10,     63,
-		 116,     86,     33,    236,
-		 183,    130,     77,     24,
-		 227,    174,    121,    187,
-		 240,     37,     90,    143,
-		 196,    249,     46,     99,
-		 152,    205,    253,    200,
-		 147,     94,     41,    244,
-		 191,    138,     85,    223,
-		 235,     73,    126,    179,
-		 232,    226,     82,    135,
-		 188,    241,     38,     91,
-		 111,     58,      5,    208,
-		 100,    102,    206,      3,
-		  56,    109,     93,    215,
-		 243,     65,    118,     84,
-		 224,     21,     74,    128,
-		  75,     22,    225,    172,
-		 119,     66,     13,     39,
-		  92,    145,    198,      4,
-		  48,    154,    101,     48,
-		 251,    198,    145,     92,
-		  39,     13,     66,    119,
-		 172,    225,     22,     75,
-		 128,    181,    234,     31,
-		  84,    137,    190,     12,
-		  40,    162,    109,     56,
-		   3,     49,    153,    155,
-		 208,      5,     58,    111,
-		 164,    217,     14,     67,
-		 135,    173,     29,    232,
-		 179,    126,     73,     20,
-		  32,     85,    117,     64,
-		  11,     41,    161,    147,
-		 200,      2,     50,    152,
-		 156,    209,    249,    196,
-		 143,     90,     37,    240,
-		 187,    134,    174,    227,
-		  24,     77,    130,    183,
-		 236,     33,     86,    139,
-		 192,     10,    213,    160,
-		 148,     54,    254,     51,
-		 151,    157,    210,      7,
-		  60,    142,     89,     36,
-		 239,    186,    133,     80,
-		  27,     25,    177,    124,
-		  71,     18,     34,     87,
-		 140,    193,    246,     43,
-		  96,    149,    202,    255,
-		 203,    105,     97,     44,
-		 247,    194,    141,     88,
-		  35,    238,    185,    123,
-		 176,    229,     26,     79,
-		 132,    185,    238,     35,
-		  88,    141,    194,      8,
-		  44,    158,    105,     52,
-		 255,    202,    149,    159,
-		 212,      9,    193,    140,
-		 168,     34,     18,     71,
-		 131,     78,     25,     27,
-		 174,    129,     69,     21,
-		  39,    165,    112,    199,
-		   6,     45,     98,    105,
-		 204,      3,     54,    149,
-		 161,     40,    245,     63,
-		 137,    168,     33,    236,
-		  75,    125,    178,    230,
-		  28,     81,    121,    184,
-		  11,    217,     90,    115,
-		 197,    248,     46,     98,
-		 152,    204,      2,     54,
-		 147,     95,     41,    246,
-		 191,    137,    175,    221,
-		 238,     76,    130,     77,
-		 235,    224,     83,    120,
-		  66,     14,     39,     90,
-		 111,    199,      4,    209,
-		 103,    100,    207,      0,
-		 193,    109,    162,     41,
-		  13,     65,    119,     85,
-		 224,     21,    180,    125,
-		  73,     22,     31,    175,
-		 138,     67,     13,     38,
-		 163,    145,    198,    251,
-		  48,    101,    154,     48,
-		 250,     57,    145,     92,
-		  39,    242,     66,    119,
-		 172,    225,     22,    180,
-		 128,     74,     21,     31,
-		 170,    118,     65,    241,
-		  40,    163,    146,     56,
-		 252,    206,    102,    100,
-		  47,    250,    196,    110,
-		  91,     38,     15,    184,
-		 124,    175,     30,     21,
-		 178,    124,    182,     20,
-		 223,     85,    117,     64,
-		 245,     41,     94,    146,
-		  54,      2,    205,    152,
-		 157,     47,      6,     59,
-		 112,    164,     36,     15,
-		  69,    135,    174,     28,
-		 229,     79,    125,     72,
-		 237,    223,     86,    116,
-		  62,    245,    213,    160,
-		 148,     54,      1,     51,
-		 104,     98,    210,      7,
-		 195,    113,     89,     37,
-		  16,    186,    133,    175,
-		 228,     25,     78,    124,
-		 184,     18,    220,     87,
-		 141,     63,    246,     42,
-		 159,    149,    202,      1,
-		  52,    105,     97,    211,
-		 247,     61,    141,     88,
-		 220,     17,     70,    123,
-		 176,     26,    229,     79,
-		 122,    185,    238,    220,
-		  88,    141,    194,      8,
-		  44,     97,    105,    203,
-		 255,    202,    106,     96,
-		 212,    246,    193,    115,
-		  87,    221,     18,    184,
-		 124,     78,     25,     27,
-		  80,    122,    186,    239,
-		 219,     89,    142,     60,
-		   7,     45,     98,    104,
-		 204,    254,     54,    107,
-		  95,     42,    245,     63,
-		 116,     86,    222,     19,
-		  72,    130,     77,     24,
-		 227,     81,    121,     68,
-		 240,    218,    165,    143,
-		  59,      6,     46,    156,
-		 152,     50,    253,     55,
-		 147,     94,    214,    245,
-		  64,    138,     85,    223,
-		 235,     73,    129,    179,
-		 232,    226,     82,    120,
-		 188,    241,    217,    164,
-		 111,     58,      5,    208,
-		 100,    102,    206,      3,
-		 199,    109,    162,     40,
-		 243,    190,    118,    171,
-		  31,     21,    181,    128,
-		 180,     22,     30,    172,
-		 119,    189,     13,    216,
-		  92,    145,     57,    251,
-		 207,    154,    154,     48,
-		 251,     57,    110,     92,
-		 216,     13,    189,    119,
-		  83,     30,     22,    180,
-		 128,     74,    234,     31,
-		 171,    137,     65,     12,
-		  40,    162,    146,     56,
-		 252,     49,    153,    155,
-		  47,      5,     58,    144,
-		 164,     38,    241,     67,
-		 135,    173,     29,    232,
-		  76,    126,    182,    235,
-		  32,    170,    138,    191,
-		  11,     41,     94,    108,
-		 200,    253,    205,    103,
-		 156,     46,      6,    196,
-		 143,     90,    218,    240,
-		 187,    121,     81,    227,
-		 231,     77,    125,     72,
-		 236,    222,     86,    116,
-		  63,    245,    213,     95,
-		 148,     54,      1,     51,
-		 151,     98,    210,    248,
-		  60,    113,     89,    219,
-		  16,    186,    122,     80,
-		  27,     25,     78,    124,
-		 184,     18,    221,     87,
-		 115,     62,      9,     43,
-		 159,    149,     53,    255,
-		 203,    105,    158,     44,
-		 247,    194,    141,    167,
-		  35,     17,     70,    132,
-		 176,     26,     26,     79,
-		 123,    185,     17,    220,
-		  88,    114,    194,    247,
-		 211,     97,    150,     52,
-		   0,     53,    106,    159,
-		 212,    246,    193,    140,
-		 168,     34,    237,     71,
-		 131,     78,     25,    228,
-		  80,    122,     69,     16,
-		  36,     89,    142,    195,
-		   7,     45,    157,    104,
-		 204,    254,     54,    107,
-		  95,    213,     10,     63,
-		 139,    169,     33,    236,
-		  72,    130,     77,    231,
-		 227,     81,    121,     68,
-		 240,    218,    165,    143,
-		 196,    249,     46,     99,
-		 152,     50,      2,    200,
-		 147,    161,     41,    244,
-		  64,    138,    170,    223,
-		 235,     73,    129,    179,
-		 232,     29,     82,    120,
-		 188,     14,     38,     91,
-		 111,    197,      5,    208,
-		 100,    102,     49,    252,
-		 199,    109,    162,    215,
-		 243,    190,    118,     84,
-		 224,     21,    181,    128,
-		  75,     22,     30,     83,
-		 119,     66,    242,    216,
-		  92,    145,    198,    251,
-		  48,    154,    154,     48,
-		 251,     57,    145,    163,
-		 216,    242,     66,    136,
-		  83,    225,    233,     75,
-		 128,     74,    234,     31,
-		  84,    137,    190,     12,
-		 215,     93,    146,    199,
-		 252,     49,    153,    100,
-		 208,    250,    197,    111,
-		  91,     38,     14,     67,
-		 120,    173,     29,     23,
-		 179,    126,     73,     20,
-		 223,    170,    117,    191,
-		  11,    214,    161,    108,
-		 200,      2,    205,    103,
-		 156,    209,      6,    196,
-		 143,    165,     37,    240,
-		 187,    134,    174,    227,
-		 231,    178,    125,     72,
-		  19,    222,     86,    139,
-		  63,    245,     42,     95,
-		 148,     54,    254,     51,
-		 104,    157,    210,      7,
-		  60,    113,    166,    219,
-		  16,    186,    122,    175,
-		  27,     25,    177,    131,
-		  71,    237,     34,     87,
-		 140,    193,    246,     43,
-		  96,    149,    202,    255,
-		  52,    105,    158,    211,
-		   8,     61,    114,    167,
-		 220,     17,     70,    123,
-		 176,    229,     26,     79,
-		 132,    185,    238,     35,
-		  88,    141,    194,    247,
-		  44,     97,    150,    203,
-		   0,     53,    106,    159,
-		 212,      9,     62,    115,
-		 168,    221,    237,     71,
-		 131,     78,     25,    228,
-		 175,    122,     69,     16,
-		 219,    166,    113,    195,
-		 248,    210,    157,    151,
-		  51,    254,     54,    148,
-		  95,     42,    245,     63,
-		 139,    169,    222,     19,
-		  72,    125,    178,    231,
-		  28,     81,    134,    187,
-		 240,     37,    165,    112,
-		  59,      6,    209,    156,
-		 103,     50,      2,     55,
-		 147,     94,    214,    244,
-		 191,    138,     85,    223,
-		  20,     73,    126,     76,
-		  23,    226,    173,    120,
-		  67,     14,    217,    164,
-		 111,     58,      5,    208,
-		 100,    153,    206,      3,
-		  56,    109,    162,    215,
-		  12,     65,    118,    171,
-		 224,     21,     74,    128,
-		  75,     22,    225,    172,
-		 119,     66,     13,    216,
-		 163,    110,    198,    251,
-		  48,    101,    154,    207,
-		   4,     57,    110,    163,
-		 216,    242,    189,    136,
-		  82,     31,    232,    181,
-		 126,     75,     21,    224,
-		  84,    137,    191,    242,
-		  41,     95,    144,    197,
-		 253,     48,    103,    154,
-		 208,    250,    197,    145,
-		  89,     37,    242,    191,
-		 132,     80,     28,    232,
-		  76,    128,    183,    233,
-		  35,     86,    137,    189,
-		 246,     43,     95,    146,
-		 200,      2,    204,    154,
-		  96,     42,    253,    192,
-		 139,     89,     39,    241,
-		 187,    120,    172,    224,
-		  28,     73,    134,    179,
-		 232,     37,     85,    136,
-		 194,    244,    213,    161,
-		 104,     51,      7,    203,
-		 144,    100,     40,    251,
-		 194,    113,    167,    216,
-		  20,     65,    126,    170,
-		 225,     31,     72,    133,
-		 190,    232,     33,     86,
-		 114,     58,     15,    221,
-		 148,    102,     62,     10,
-		 204,    146,     96,    210,
-		  11,     56,    117,    160,
-		 218,     23,     64,    125,
-		 182,    227,     28,     74,
-		 128,    186,    239,    221,
-		 163,    117,     55,      4,
-		 222,    146,     98,     61,
-		 249,    200,    107,    155,
-		 211,      1,     55,    123,
-		 175,    219,     20,     65,
-		 122,    180,    227,     31,
-		  83,    132,     68,     19,
-		 221,    175,    125,     49,
-		  10,    222,    151,    111,
-		  48,      0,     51,     99,
-		 170,    223,      3,     56,
-		 113,    173,    218,     23,
-		  76,    121,    177,    228,
-		  30,     81,    120,     64,
-		   8,    208,    169,    124,
-		  48,     15,    215,    159,
-		 152,    206,      5,     63,
-		 100,    166,    211,      8,
-		  65,    116,    168,    221,
-		  23,     74,    125,    176,
-		 234,     28,    173,    123,
-		  69,      6,    211,    174,
-		 102,     50,      3,    211,
-		 100,    154,    203,      5,
-		  61,    105,    160,    215,
-		  12,     64,    117,    174,
-		 230,     18,     77,    121,
-		 177,    234,     30,    175,
-		 113,     75,      7,    211,
-		 169,    103,     62,      1,
-		 205,    101,    152,    204,
-		   7,     58,    108,    161,
-		 219,      9,     71,    112,
-		 164,    233,     30,     76,
-		 134,    182,    234,    226,
-		 174,    126,     72,      6,
-		 221,    168,    101,     62,
-		   7,    207,    153,    154,
-		 210,      7,     56,    109,
-		 167,    221,     11,     68,
-		 127,    165,    234,     16,
-		  73,    130,    183,     21,
-		 219,    172,    124,     74,
-		   1,    220,    168,    107,
-		  50,      1,    204,    103,
-		 158,    210,      2,     63,
-		 116,    160,    223,      9,
-		  67,    113,    166,    228,
-		  30,     73,    128,     72,
-		  16,    219,    174,    124,
-		  54,      3,    221,    168,
-		 109,     51,      2,    206,
-		 151,    156,    209,      3,
-		  56,    117,    162,    222,
-		  21,     67,    124,    169,
-		 225,     29,     77,    130,
-		  71,     16,    222,    173,
-		 117,     57,     14,    211,
-		 153,    111,     49,      3,
-		 201,    150,    158,    209,
-		  11,     62,    113,    164,
-		 216,     21,     67,    126,
-		 181,    225,     30,     76,
-		 134,    184,    238,    220,
-		 165,    113,     57,     13,
-		 214,    155,    109,     48,
-		 251,    201,    150,     98,
-		  42,    246,    193,    115,
-		 169,    223,     16,     68,
-		 120,    181,    226,     31,
-		  84,    129,    190,    236,
-		  39,     91,    142,     60,
-		   5,    209,    153,    109,
-		  54,    248,    207,    146,
-		  89,     47,    241,    195,
-		 138,     86,    222,     17,
-		  75,    121,    183,    225,
-		  26,     86,    128,    189,
-		 246,     32,     94,    141,
-		 197,      6,    211,    159,
-		  99,     53,    245,    192,
-		 155,     86,     46,    242,
-		 186,    137,     85,    222,
-		  23,     77,    123,    183,
-		 236,     24,     87,    130,
-		 185,    244,     35,     95,
-		 147,    198,    248,     46,
-		 154,     98,     54,    247,
-		 205,    154,     91,     46,
-		 246,    188,    118,    169,
-		 228,     17,     73,    126,
-		 181,    233,     30,     81,
-		 139,    185,    244,     32,
-		  91,    151,    194,    249,
-		 207,    159,    108,     60,
-		 245,    202,    150,     88,
-		  37,     12,     71,    113,
-		 171,    230,     18,     75,
-		 125,     78,     17,    225,
-		  87,    129,    180,    255,
-		  37,     87,    150,     57,
-		   4,    193,    140,    124,
-		  57,    246,    198,    108,
-		 173,    200,     29,     81,
-		 118,    171,     30,    228,
-		 161,    111,     67,     21,
-		  39,     69,    156,    168,
-		 224,     34,     94,     98,
-		  45,     38,    238,    129,
-		 109,     44,     13,     34,
-		 111,    186,    193,      0,
-		  69,    136,     72,      6,
-		 241,    185,    128,    184,
-		 244,     60,     76,    155,
-		 194,     26,    244,    140,
-		  67,     40,     16,    206,
-		 103,    189,    250,     47,
-		  30,    101,    167,     54,
-		 241,    165,    158,     95,
-		 228,      9,     84,    156,
-		 165,    254,     33,    185,
-		  80,     16,     35,    203,
-		 142,    104,    219,    220,
-		  30,     67,    189,    198,
-		   8,    209,    147,     70,
-		  59,    226,     71,    116,
-		 169,    248,      2,     66,
-		 120,     81,     54,    241,
-		 129,    107,     55,    244,
-		  56,     66,    191,    236,
-		  30,     56,    147,    117,
-		  55,    237,    211,    136,
-		 162,    200,      9,     90,
-		 106,    184,     18,    251,
-		 130,     84,    102,      4,
-		 222,     81,    151,    229,
-		 211,      8,    116,    146,
-		  63,    228,    214,    136,
-		  81,    215,      5,     39,
-		 107,    182,    203,     16,
-		 164,    166,     98,     52,
-		 195,    190,    134,    171,
-		 239,     12,    112,    174,
-		 212,      5,    196,    130,
-		  71,     41,    241,     49,
-		 120,    189,    246,     22,
-		  82,    139,     77,      9,
-		 196,    144,    153,     68,
-		 237,      8,    118,    171,
-		 149,    234,     46,    174,
-		 118,     26,     37,    198,
-		 158,    144,    219,     25,
-		  37,    116,    174,     32,
-		 237,    146,    162,     74,
-		  17,    234,     65,    102,
-		 146,    194,     58,     64,
-		 118,     80,     16,    199,
-		 191,    127,     57,    244,
-		  40,    126,    131,    221,
-		   1,    201,    179,    113,
-		   1,    231,    190,    127,
-		 189,    252,     49,     97,
-		 159,    191,     31,    251,
-		 180,    107,     86,      7,
-		  43,     79,    136,    220,
-		 233,     58,    157,    124,
-		   7,    214,    218,    156,
-		 160,    215,     24,     99,
-		  80,    138,    250,     22,
-		 167,     94,    105,     13,
-		 208,    169,    131,    170,
-		 239,     51,     78,    145,
-		  57,     29,    231,    191,
-		 116,     45,     10,     46,
-		 107,    135,    252,     46,
-		  84,    129,     74,     62,
-		 250,    163,    123,    180,
-		 231,     53,     79,    158,
-		 201,     12,    205,    133,
-		  76,     45,     11,     54,
-		 102,    139,    207,     37,
-		  28,    100,    164,     53,
-		 243,    166,    150,     86,
-		 224,     19,     65,    145,
-		 170,    224,    221,    185,
-		  82,     24,     21,    222,
-		 101,    155,    216,    233,
-		  47,    117,    139,    214,
-		 249,    217,    144,     76,
-		  38,     23,     74,    118,
-		 190,    232,     16,     78,
-		 118,     88,     55,    195,
-		 171,    132,    214,    226,
-		  56,    119,    143,    221,
-		   9,    192,    143,    127,
-		  61,    241,     57,    124,
-		 184,    208,     30,     78,
-		 120,     70,      0,    194,
-		 138,    110,    185,    249,
-		  62,     79,    156,    215,
-		 237,     34,    159,    126,
-		  18,    227,    196,    111,
-		 175,    197,      7,     54,
-		 114,    173,     37,    255,
-		 149,    164,     84,     25,
-		   8,     76,    159,    170,
-		 255,     52,     74,    138,
-		  54,     26,    207,    142,
-		 153,    194,     16,     58,
-		 105,    160,     41,    247,
-		 178,    144,    119,     59,
-		 236,     88,     97,    173,
-		 252,     22,     88,    140,
-		 180,     10,    205,    184,
-		 123,     56,    244,     59,
-		 107,    156,     53,    251,
-		 206,    156,     74,     54,
-		 233,    182,    121,    139,
-		 194,     12,     70,    122,
-		 177,    236,    227,    163,
-		 111,     81,     14,     41,
-		  74,    131,    192,      1,
-		 195,    149,    119,     39,
-		 231,    222,    152,    175,
-		 199,     40,     95,    120,
-		 168,    225,     23,    181,
-		 119,     90,      5,    228,
-		  95,    159,    173,    244,
-		 208,    178,    126,     44,
-		  21,    215,    143,    110,
-		 216,     31,     25,    112,
-		 182,    221,    243,    190,
-		 134,     81,     21,    226,
-		 176,    136,    165,    249,
-		  40,    172,    103,     86,
-		  29,    192,    180,    125,
-		  49,    244,     42,     71,
-		 128,    193,      5,    193,
-		 137,     94,     39,    243,
-		 184,    121,    166,    236,
-		   8,     74,    123,     90,
-		  11,    199,    191,    103,
-		  49,     14,     35,     73,
-		 136,    208,    241,     49,
-		 146,    100,     41,    249,
-		 195,    113,    165,    210,
-		  30,     72,    127,     86,
-		  10,    241,    166,    105,
-		  85,     31,    222,     94,
-		 153,    218,    225,     37,
-		  98,    110,     51,      4,
-		 202,    105,    156,    215,
-		   0,     54,    120,    163,
-		  37,    254,    175,    146,
-		  91,     11,    238,    177,
-		 141,    170,    246,     55,
-		  83,    140,     56,     13,
-		 209,     97,    149,    206,
-		   7,     63,     96,    152,
-		 212,    254,    209,    153,
-		  65,     54,    255,    180,
-		 129,    184,    245,     12,
-		  67,    143,    186,     21,
-		 222,    167,    143,    199,
-		 254,     42,    107,    158,
-		 201,    252,    195,    132,
-		  77,     59,    231,    209,
-		 129,    168,    208,      5,
-		  92,    118,    178,     30,
-		 229,    175,    130,    179,
-		 251,     41,     86,    131,
-		 195,      7,    218,    142,
-		 115,     35,    242,    199,
-		 157,     88,    208,     24,
-		  88,    100,    169,     41,
-		 231,    177,    124,    187,
-		 227,     16,     92,    136,
-		 177,    244,    223,    180,
-		 121,     44,     23,    222,
-		 150,    108,     48,      8,
-		  46,    122,    174,     43,
-		 253,    176,    143,    175,
-		 235,     24,     69,    109,
-		 160,    249,     27,    164,
-		  99,     88,     21,    203,
-		 179,     97,     51,    250,
-		  32,    124,    141,    197,
-		 254,    200,    159,     89,
-		 220,      7,     79,    103,
-		 184,    244,      6,     72,
-		 116,     92,     15,    247,
-		 185,    103,     81,      4,
-		  45,     78,    139,    212,
-		 248,    199,    151,    110,
-		  47,      3,     48,     98,
-		 181,    204,     26,     72,
-		 133,     92,     10,    240,
-		 166,    108,     91,     27,
-		 221,     88,    146,    168,
-		 254,    211,    175,     97,
-		  50,    254,     53,    109,
-		 146,    196,     30,     47,
-		 119,     93,     54,    233,
-		 163,    144,     68,      8,
-		 239,     71,    154,    171,
-		 255,     32,    164,    100,
-		  52,      8,     41,     89,
-		 158,    218,    229,     40,
-		 122,    156,     35,    224,
-		 217,    151,     64,     62,
-		 255,     65,    109,    143,
-		 254,     17,    185,    115,
-		  75,     22,    221,    168,
-		 136,    207,    237,     11,
-		 121,    157,     61,     21,
-		 209,    140,    125,     51,
-		 239,    193,     97,    134,
-		 194,     30,    186,    136,
-		  68,     31,    231,    179,
-		 123,    179,    247,      0,
-		  71,    131,     57,     27,
-		 201,    133,    119,     22,
-		 226,    194,    100,    128,
-		 244,     26,     63,    139,
-		  95,     39,    232,    176,
-		 133,    183,    255,     63,
-		 113,    151,     69,     31,
-		 204,    188,    110,     26,
-		  38,    222,    110,    139,
-		 208,     16,     50,    148,
-		  95,     40,    242,    206,
-		 128,    173,    196,     53,
-		 106,    110,    179,     19,
-		 241,    185,    102,     99,
-		  16,    208,     80,    154,
-		 215,    243,     42,    101,
-		 159,    206,    245,    219,
-		 157,    165,    205,     47,
-		  93,    123,    170,     41,
-		 228,    162,    158,    105,
-		   0,    225,     88,    138,
-		 186,    241,     35,     85,
-		 159,    192,     15,    195,
-		 144,    144,    212,     29,
-		  47,     97,    162,     47,
-		 253,    166,    168,     77,
-		  25,     19,     77,    128,
-		  76,     18,     23,     65,
-		 135,    188,      7,    210,
-		  92,    156,    213,    233,
-		  63,    108,    101,     58,
-		 238,    217,    137,     95,
-		 209,     10,    190,    133,
-		  94,     30,     31,     64,
-		 133,    181,    235,     24,
-		  88,    130,    181,    254,
-		  37,     88,    106,     44,
-		  28,    216,    102,    150,
-		 219,      5,    207,    155,
-		  94,     36,    242,    191,
-		 120,    164,    243,      7,
-		  70,    134,    188,    231,
-		  38,    175,     96,     95,
-		  31,     41,     85,    154,
-		 202,      6,    206,    154,
-		 100,     32,    246,    194,
-		 119,    183,    201,      0,
-		  73,    117,    165,    230,
-		 227,    161,    102,     70,
-		 238,     38,     82,    138,
-		 193,    241,     41,    165,
-		 123,     34,     12,    204,
-		  98,    147,    221,     22,
-		  45,    124,    163,     32,
-		 252,    172,    130,    171,
-		 231,    228,    178,    131,
-		 176,    235,    223,    164,
-		  99,     50,     15,     43,
-		 101,    153,    219,    239,
-		  63,    111,    101,     60,
-		 252,     61,    119,    166,
-		  33,    237,     70,    126,
-		 179,     25,    226,    184,
-		 115,     64,     21,    220,
-		  80,    128,    206,    255,
-		  47,    150,     96,    203,
-		   5,     54,    106,     96,
-		 212,     13,     63,    142,
-		  81,     37,    235,    188,
-		 135,     72,     27,     31,
-		  89,    140,    188,     18,
-		 221,    167,    140,    194,
-		   7,     44,    102,    159,
-		 203,      3,    203,    156,
-		  84,     45,    241,    197,
-		 143,     86,    217,     31,
-		  69,    123,     76,     29,
-		 234,    164,    113,     64,
-		 240,     34,     86,    129,
-		 200,    252,    211,    154,
-		  97,     53,    250,    207,
-		 144,    160,    208,     15,
-		 191,    136,     83,     40,
-		 236,    181,    129,    176,
-		 239,     16,     67,    137,
-		 187,    240,    219,    163,
-		 102,     48,     12,    213,
-		 155,    152,     49,    252,
-		 198,    144,     94,     41,
-		  12,     64,    116,    174,
-		 233,     31,     66,    122,
-		 183,     20,    230,    164,
-		 127,     71,     15,    216,
-		 162,    145,     57,      7,
-		 202,    158,    100,     48,
-		 251,     57,    106,    166,
-		 221,     11,     74,    112,
-		 175,    225,    232,    182,
-		 124,     79,     19,    228,
-		 168,    117,     66,     13,
-		  41,     95,    144,    197,
-		 254,     49,    152,    155,
-		 213,      3,     63,    106,
-		 160,    216,    240,    184,
-		 128,     84,     24,    238,
-		 183,    126,    182,     20,
-		  33,     86,    137,    189,
-		  10,    212,    161,    146,
-		 202,    249,     55,    101,
-		  99,     44,    250,    197,
-		 141,     88,     37,     14,
-		  68,    121,    175,     28,
-		 231,    179,    127,     72,
-		 236,     32,     84,    136,
-		 192,     11,    214,    164,
-		 105,     54,    255,     55,
-		 110,    153,    208,      5,
-		  60,    140,     92,     33,
-		 234,    190,    132,    172,
-		 225,     26,    177,    120,
-		  65,     23,    217,    169,
-		 143,    201,    252,     33,
-		 106,    157,    203,      4,
-		 206,    144,    105,     37,
-		 243,     61,    115,     88,
-		  33,    237,    186,    128,
-		  76,    229,     25,     75,
-		 140,    183,    227,     36,
-		  90,    115,     57,     13,
-		 213,    152,    108,     51,
-		 246,    204,    148,     97,
-		  40,      8,     59,    119,
-		 171,    219,     26,     65,
-		 120,    181,    228,    228,
-		 172,    123,     69,     19,
-		 220,    175,    119,     58,
-		   2,     45,    103,    147,
-		 200,      9,     62,    111,
-		  95,     40,    246,    196,
-		 136,    169,    220,    236,
-		 180,    125,    177,     25,
-		 224,    174,    135,     68,
-		 241,     32,     95,    141,
-		  59,      7,    210,    155,
-		 111,     54,    255,    203,
-		 146,    165,    208,     13,
-		  72,    124,    175,    223,
-		 235,     73,    128,     74,
-		  31,    229,    171,    126,
-		  64,     12,    221,    160,
-		 146,    194,    242,     35,
-		 105,    147,    198,      4,
-		  60,    147,     85,     36,
-		 254,    176,    132,     92,
-		  25,    236,    183,    121,
-		 190,    229,     16,     92,
-		 132,    183,    251,     34,
-		 162,    102,     50,      9,
-		 192,    149,    105,     60,
-		 246,    192,    108,    171,
-		 214,     24,     85,     98,
-		 191,    238,     30,    181,
-		 117,     69,      6,    244,
-		 186,    121,     81,      3,
-		 208,    162,    145,    205,
-		 238,     36,    115,    141,
-		 196,      8,     56,    149,
-		  81,     54,    228,    175,
-		 150,     65,     13,    238,
-		  76,    132,    189,    251,
-		  49,     68,    152,    175,
-		 254,     43,    163,    106,
-		  60,     15,    193,    150,
-		 115,     34,    255,    196,
-		 118,    169,    212,     31,
-		  84,    119,    167,    227,
-		 225,    184,    112,     68,
-		  26,    212,    162,    124,
-		  60,    247,     45,     84,
-		 154,    198,    240,     62,
-		  98,    156,     42,    244,
-		 204,    158,     86,     52,
-		 255,    176,    134,    172,
-		 239,      8,     90,    150,
-		 173,    255,     46,     85,
-		 117,     53,      7,    196,
-		 143,    123,     36,     14,
-		 193,    147,    156,    217,
-		  25,     40,    106,    176,
-		 206,     24,     70,    130,
-		  66,     10,    245,    161,
-		 107,     75,     24,    217,
-		  89,    138,    201,    249,
-		  60,    110,    155,    195,
-		   2,    207,    159,    106,
-		  32,    250,    202,    132,
-		  81,     33,     22,     77,
-		 113,    191,    246,     21,
-		  89,    132,     65,     29,
-		 200,    182,    124,     48,
-		   0,    211,    157,    147,
-		 199,     17,     38,    121,
-		 177,    222,     15,    193,
-		 130,     71,     50,    248,
-		 164,    146,     64,     16,
-		 227,     86,    136,    174,
-		 233,     60,     66,    156,
-		 206,      6,    219,    143,
-		 126,     43,    235,    217,
-		 159,     89,     40,     14,
-		  77,     97,    178,    198,
-		   3,     88,    118,     77,
-		  29,    243,    187,    110,
-		  80,      1,    211,    167,
-		 145,    195,    241,     32,
-		 116,    150,    195,      4,
-		  56,    150,     84,     37,
-		 254,    181,    128,     81,
-		  30,     20,     78,    119,
-		 191,    229,     18,     89,
-		 141,     66,     11,    212,
-		 172,    126,     55,     14,
-		 203,    103,    146,    193,
-		  20,     41,     97,    174,
-		 208,     12,    190,    129,
-		  92,     12,    251,    166,
-		 111,     67,     21,     26,
-		  88,    155,    170,    224,
-		  58,     82,    154,    198,
-		   6,    194,    136,    119,
-		  60,    233,    203,    151,
-		  91,    220,      5,     77,
-		 104,    189,    242,     27,
-		  74,    129,     77,     29,
-		 212,    167,    123,     75,
-		  12,    212,     92,    148,
-		 193,    247,     57,    109,
-		 154,    210,    249,    193,
-		 135,     82,     47,    250,
-		 188,    130,     81,    224,
-		  31,     68,    136,    189,
-		 228,     37,     87,    118,
-		  56,      3,    223,    171,
-		  96,     62,      5,    205,
-		 107,    149,    216,     12,
-		  55,    120,    160,    217,
-		 239,    190,    131,     88,
-		  18,    239,    182,    122,
-		  68,    236,     38,     81,
-		 132,    200,    241,     46,
-		  99,    149,     52,      1,
-		 201,    146,    101,     40,
-		 243,    192,    140,     88,
-		 222,     21,     66,    120,
-		 177,    229,    228,    177,
-		 121,     68,     19,    221,
-		 167,    141,    195,    246,
-		  45,     96,    150,    203,
-		   0,    202,    149,     96,
-		  43,    247,    192,    142,
-		  86,     34,     18,     70,
-		 126,    179,    228,     26,
-		  81,    122,     69,     16,
-		 219,    166,    142,     60,
-		   7,    210,    157,    104,
-		  51,    254,    200,    149,
-		  94,     42,    245,     63,
-		 117,    168,    220,     17,
-		  74,    127,    179,    230,
-		  28,    175,    123,     64,
-		  11,    222,    166,    114,
-		  58,    249,     47,     96,
-		 156,    200,      7,     51,
-		 111,    160,    214,    245,
-		 189,    137,     81,     36,
-		 239,    181,    131,     77,
-		 232,     28,     80,    132,
-		 184,    242,     36,     90,
-		 144,     58,      4,    209,
-		 153,    100,     51,    253,
-		 199,    109,    162,    214,
-		  14,     67,    116,    170,
-		 224,    234,    180,    129,
-		  74,     23,    224,    173,
-		 119,    189,    243,     38,
-		  94,    147,    196,    250,
-		  49,    101,    101,     49,
-		 249,    197,    147,     94,
-		  38,    242,     66,    119,
-		 173,    227,     20,     73,
-		 129,    180,     21,    224,
-		 170,    116,     67,     14,
-		 214,    162,    146,    199,
-		 253,     48,    103,    155,
-		 208,      5,    197,    144,
-		 164,    217,     14,     67,
-		 120,     82,     29,    232,
-		 179,    129,    182,    235,
-		  32,    170,    117,     65,
-		  11,    214,    161,    108,
-		  55,      2,    205,    103,
-		 156,    208,      7,     58,
-		 113,    164,    218,    240,
-		 186,    135,     80,     29,
-		 230,    179,    124,     72,
-		  19,    222,     86,    138,
-		 193,    244,     43,     94,
-		 148,     54,      1,    204,
-		 151,     98,     45,      7,
-		 195,    142,     89,     36,
-		 239,     69,    122,    175,
-		 228,     25,     78,    131,
-		  71,     18,    221,    168,
-		 115,     62,      9,    212,
-		 159,    106,     53,      0,
-		 203,    150,     97,     44,
-		   8,     61,    114,    167,
-		 220,     17,     70,    123,
-		  79,     26,    229,    176,
-		 122,     71,     17,    220,
-		 167,    141,    195,    246,
-		  45,     96,    151,    203,
-		   0,     53,    149,     97,
-		  42,    247,    192,    141,
-		  86,     34,     18,     70,
-		 126,    179,    228,     26,
-		  81,    133,    186,     16,
-		 219,    167,    115,     62,
-		   6,    211,    156,    104,
-		 204,      1,     55,    106,
-		 161,    212,     11,     63,
-		 139,     86,     32,    237,
-		 182,    128,     76,     25,
-		 227,     81,    135,    185,
-		 242,     39,     88,    141,
-		 197,    249,    209,    157,
-		 101,     48,    255,    202,
-		 146,     95,     41,     11,
-		  65,    116,    171,    222,
-		  21,     72,    126,    179,
-		  23,    227,    172,    121,
-		  65,     15,    216,    165,
-		 111,    197,    251,     45,
-		 102,    155,    204,      2,
-		  56,    146,     92,     41,
-		 242,    188,    136,     85,
-		  31,     21,     74,    126,
-		 181,    232,     31,     83,
-		 136,    189,    242,    216,
-		 163,    110,     57,      4,
-		 206,    154,    101,     48,
-		 251,     57,    110,    163,
-		 216,     13,     66,    136,
-		  83,     30,    233,    180,
-		 127,     74,     21,    224,
-		  84,    137,    190,    243,
-		  40,     93,    146,     56,
-		   3,    206,    153,    100,
-		  47,    250,    197,    111,
-		 164,    217,     14,     67,
-		 120,    173,    226,     23,
-		  76,    126,     73,     20,
-		 223,    171,    116,     65,
-		  11,    214,     94,    147,
-		 200,    252,     51,    103,
-		 156,    209,    249,    196,
-		 143,     90,     36,    240,
-		 187,    134,     81,     28,
-		  24,     77,    130,    183,
-		 236,     33,     86,    139,
-		 192,     10,    213,    160,
-		 107,     54,      1,    204,
-		 151,     98,     45,    248,
-		  60,    113,    166,    219,
-		  16,     69,    122,    175,
-		 228,    230,    177,    124,
-		  71,     18,    221,    168,
-		 115,     62,      9,    212,
-		  96,    149,    202,    255,
-		 203,    150,     97,     44,
-		 247,    194,    141,     88,
-		  35,    238,    185,    123,
-		 176,    229,     26,     79,
-		 132,    185,    238,     35,
-		 167,    114,     61,      8,
-		 211,    158,    105,     52,
-		 255,    202,    149,    159,
-		 212,      9,     62,    115,
-		 168,    221,    237,    184,
-		 131,     78,     25,    228,
-		 175,    122,     69,    239,
-		  36,     89,    142,    195,
-		 248,     45,     98,    151,
-		 204,    254,    201,    148,
-		  95,     42,    245,    192,
-		 116,    169,    222,     19,
-		  72,    125,    178,    231,
-		 227,    174,    121,     68,
-		  15,    218,    165,    112,
-		  59,    249,     46,     99,
-		 152,    205,      2,     55,
-		 108,     94,     41,    244,
-		 191,    138,     85,     32,
-		 235,     73,    126,    179,
-		 232,     29,     82,    135,
-		  67,     14,    217,    164,
-		 111,     58,      5,    208,
-		 155,    153,    206,      3,
-		  56,    109,    162,    215,
-		  12,     65,    118,     84,
-		  31,    234,    181,    128,
-		  75,     22,     30,     83,
-		 136,    189,    242,     39,
-		 163,    110,     57,      4,
-		 207,    154,    101,     48,
-		 251,     57,    110,    163,
-		 216,     13,     66,    119,
-		 172,    225,     22,     75,
-		 127,     74,     21,    224,
-		 171,    118,     65,    243,
-		 215,     93,    146,    199,
-		 252,     49,    102,    155,
-		 208,      5,    197,    144,
-		  91,     38,    241,    188,
-		 135,    173,    226,     23,
-		  76,    129,    182,     20,
-		  32,     85,    117,    191,
-		 244,     41,    161,    108,
-		  55,      2,    205,    152,
-		  99,     46,    249,     59,
-		 112,    165,    218,     15,
-		  68,    134,     81,     28,
-		  24,     77,    125,    183,
-		 236,     33,     86,    139,
-		 192,    245,     42,     95,
-		 148,    201,    254,     51,
-		 151,     98,     45,    248,
-		 195,    142,     89,     36,
-		 239,    186,    133,     80,
-		  27,    230,     78,    131,
-		 184,    237,     34,    168,
-		 115,     62,      9,    212,
-		 159,    106,     53,    255,
-		  52,    105,    158,    211,
-		   8,     61,    114,    167,
-		 220,     17,     70,    123,
-		 176,     26,    229,    176,
-		 132,    185,    238,     35,
-		  88,    141,    194,    247,
-		  44,    158,    150,    203,
-		 255,    202,    149,     96,
-		  43,    246,    193,    140,
-		  87,     34,    237,    184,
-		 131,     78,     25,    228,
-		  80,    133,    186,    239,
-		  36,     89,    142,    195,
-		 248,     45,     98,    151,
-		 204,      1,     54,    107,
-		 160,    213,     10,     63,
-		 116,     86,     33,    236,
-		 183,    130,     77,     24,
-		 227,     81,    134,     68,
-		  15,    218,    165,    112,
-		  59,      6,    209,    156,
-		 103,     50,    253,    200,
-		 108,    161,    214,     11,
-		  64,    117,    170,    223,
-		  20,     73,    126,    179,
-		 232,    226,     82,    120,
-		  67,    241,    217,    164,
-		 111,     58,      5,    208,
-		 155,    102,     49,      3,
-		  56,    109,    162,     40,
-		  12,    190,    137,     84,
-		  31,    234,    181,    128,
-		  75,    233,    225,    172,
-		 136,     66,    242,    216,
-		  92,    145,    198,    251,
-		  48,    101,    154,    207,
-		   4,    198,    110,     92,
-		 216,     13,    189,    136,
-		  83,     30,    233,     75,
-		 127,     74,     21,     31,
-		  84,    137,     65,     12,
-		 215,    162,    109,     56,
-		 252,     49,    102,    155,
-		 208,      5,     58,    111,
-		 164,    217,     14,     67,
-		 120,     82,     29,    232,
-		 179,    129,     73,     20,
-		  32,     85,    138,    191,
-		 244,     41,     94,    147,
-		  55,      2,    205,    152,
-		 156,    209,      6,     59,
-		 112,     90,     37,    240,
-		 187,    134,     81,     28,
-		  24,     77,    125,     72,
-		 236,    222,    169,    116,
-		  63,    245,     42,    160,
-		 107,     54,    254,     51,
-		 151,     98,    210,    248,
-		  60,    142,    166,     37,
-		  16,     64,    132,     82,
-		  25,     26,     79,    127,
-		  71,     19,    221,    169,
-		 141,    195,      8,    212,
-		  96,    149,    200,    250,
-		  53,    147,    103,     47,
-		 247,    194,    141,    164,
-		 223,     16,    185,    121,
-		 178,    229,     25,    176,
-		 127,     67,     18,    221,
-		 167,    140,    195,    246,
-		  45,     96,    149,    201,
-		   0,    202,    148,     97,
-		  43,    246,    193,    140,
-		 168,     34,    237,     71,
-		 125,    177,     25,    228,
-		  80,    133,     69,     16,
-		  36,     89,    142,     60,
-		   7,     45,    157,    104,
-		  50,    254,    200,    148,
-		 160,    213,     11,     63,
-		 116,    169,    222,     18,
-		 183,    128,     76,     24,
-		 226,    174,    121,    187,
-		 241,     36,     91,    143,
-		  59,    249,     46,     99,
-		 103,     50,    252,    201,
-		 146,     94,     41,     11,
-		  65,    117,    171,    222,
-		 235,    182,    129,     77,
-		  23,    227,    172,    135,
-		 188,    240,     38,     91,
-		 145,    197,    250,    209,
-		 155,    153,    206,    252,
-		 199,    146,    162,    215,
-		  12,     65,    118,     84,
-		  31,    234,    181,    128,
-		 180,    233,    225,     83,
-		 136,     66,     13,    216,
-		  92,    145,    198,    251,
-		  48,    154,    154,     48,
-		 251,    198,    145,    163,
-		  39,    242,    189,    136,
-		 172,    225,     22,     75,
-		 128,     74,    234,    224,
-		 171,    118,     65,     12,
-		 215,    162,    146,    199,
-		 252,     49,    102,    155,
-		 208,      5,     59,    110,
-		 165,    216,     15,     67,
-		 120,     83,     31,    234,
-		 176,    122,     77,     23,
-		 221,    170,    138,    188,
-		 241,     46,     86,    155,
-		 207,    248,     48,    152,
-		 103,     38,    240,    205,
-		 134,     93,     32,    244,
-		  68,    123,    173,    228,
-		  30,     75,    132,    180,
-		 238,     32,    169,    116,
-		  59,     14,    214,    162,
-		 148,    203,    251,     49,
-		 104,     96,     46,    248,
-		 199,    141,     91,     32,
-		 238,    186,    122,    173,
-		 229,     25,    179,    124,
-		  71,    239,     37,     95,
-		 129,    207,    253,     34,
-		  99,    111,     57,     13,
-		 223,    130,    113,     35,
-		 241,     63,    117,    169,
-		 204,     30,     77,    125,
-		 178,    229,    228,    179,
-		 132,    186,    234,     38,
-		  90,    141,     62,      3,
-		 219,    145,    120,     57,
-		 241,    207,    107,    151,
-		 196,      6,     49,    121,
-		 172,    220,    239,     71,
-		 130,     78,    226,     31,
-		  86,    134,    186,     21,
-		 211,    175,     97,     50,
-		   9,    222,    158,    150,
-		 196,     13,     58,     96,
-		 167,    208,      8,     60,
-		 112,    171,    217,     21,
-		  78,    121,     76,     30,
-		 232,    165,    104,     86,
-		   1,    215,    160,    143,
-		 194,    245,     34,    111,
-		 145,    197,      5,     50,
-		 107,    164,    208,     12,
-		  68,    119,     81,     43,
-		 231,    185,    146,     92,
-		  24,    233,    169,    134,
-		 180,    253,     43,     80,
-		 150,    192,    249,     43,
-		  99,    159,    196,     10,
-		  63,    104,     92,     33,
-		 254,    174,    156,     71,
-		  13,    228,    179,    127,
-		 189,    231,     17,     94,
-		 129,    186,    246,     34,
-		  91,    151,    204,    242,
-		  56,     96,    103,     58,
-		 244,    212,    135,     73,
-		  53,    252,    184,    117,
-		 166,    241,      7,     68,
-		 137,    176,    235,     31,
-		  87,    139,    185,    251,
-		  32,     85,    147,     60,
-		   9,    195,    141,    112,
-		  59,    235,    204,    145,
-		 163,    212,      1,     76,
-		 113,    170,    225,     20,
-		  74,    133,    191,    224,
-		  42,     92,    136,     68,
-		   0,    217,    180,    123,
-		  33,     22,    193,    156,
-		 152,    220,     22,     43,
-		 124,    173,    223,     11,
-		  67,    124,    167,    232,
-		  17,     71,    134,     74,
-		  25,    208,    189,     99,
-		  41,     28,    218,    167,
-		 149,    195,    241,     60,
-		 101,    151,    212,      1,
-		  52,    118,    172,    215,
-		  27,     78,    127,     80,
-		  18,    233,    162,    101,
-		  94,     10,    201,    162,
-		 113,    198,    248,     59,
-		 111,    153,    195,    248,
-		  61,     96,    151,    216,
-		   2,     55,    119,     88,
-		  36,    224,    168,    156,
-		  86,     13,    240,    188,
-		 127,    188,    224,     51,
-		  87,    128,    200,    255,
-		  37,    104,    159,    192,
-		  11,     63,    109,    157,
-		  40,    251,    209,    152,
-		  77,     53,    245,    169,
-		 139,     78,    236,     21,
-		  64,    138,    177,    231,
-		  35,     81,    134,    202,
-		 243,     39,    107,    145,
-		 205,    249,    199,    133,
-		  69,     48,    236,    214,
-		 135,     82,    216,     30,
-		  71,    109,    190,    236,
-		  20,     89,    140,    179,
-		 252,     46,     80,    134,
-		 199,      7,    218,    140,
-		 114,     46,    228,    209,
-		 129,     87,     41,      0,
-		  78,    100,    186,    211,
-		  31,     78,    117,    186,
-		 224,     17,     90,    142,
-		 185,    241,    220,    180,
-		 126,     32,     24,    201,
-		 131,    107,     52,      7,
-		  55,    124,    182,    199,
-		   1,     74,    127,    160,
-		 233,     30,     65,    119,
-		 189,    235,    224,    160,
-		  99,     84,     18,    196,
-		 185,    120,     48,      5,
-		  58,    116,    137,    219,
-		  20,     52,    103,    170,
-		 210,     10,     72,    126,
-		 164,    231,     22,    176,
-		 111,     94,     12,    255,
-		 178,    110,     78,      9,
-		  42,     83,    128,    210,
-		 232,     33,    107,    146,
-		 218,     12,     60,    102,
-		 163,    222,     10,    189,
-		 143,     65,      8,    244,
-		 174,    102,     94,     31,
-		 221,     83,    155,    172,
-		 226,     61,     78,    159,
-		 207,    247,     52,     97,
-		 148,    212,      0,     59,
-		 139,     87,     50,    231,
-		 165,    156,     71,     14,
-		 226,     76,    137,    163,
-		 249,     54,     68,    132,
-		 202,    253,     32,     90,
-		 156,    193,    251,     53,
-		 150,    100,     60,    224,
-		 218,    145,     64,     49,
-		 224,    185,    120,    161,
-		 240,     15,     89,    146,
-		 182,    229,     42,     95,
-		 136,    201,    240,     46,
-		  98,    111,     60,     21,
-		 211,    140,    127,     58,
-		 228,    200,    114,    160,
-		 206,      4,     81,    109,
-		 191,    233,     28,     71,
-		 131,    189,    231,     38,
-		  93,    140,     59,      4,
-		 202,    137,    114,     40,
-		 236,    216,    147,    158,
-		 221,     29,     45,    100,
-		 187,    211,     25,     66,
-		 118,    183,    224,     17,
-		  84,    128,     71,     24,
-		 212,    188,    102,     33,
-		  30,    192,    141,    107,
-		 206,     13,     34,    127,
-		 184,    199,      4,     54,
-		 114,    163,    219,     27,
-		  65,    121,    177,     29,
-		 233,    186,     99,     92,
-		  18,    204,    180,    124,
-		  59,    252,     33,    119,
-		 142,    219,     13,     58,
-		 106,    166,    223,     15,
-		  74,    115,    174,    222,
-		 227,    189,    150,     85,
-		  15,    255,    190,    105,
-		  75,    240,     33,     73,
-		 131,    211,    238,     34,
-		 104,    159,    199,     11,
-		  63,    102,    167,    211,
-		 242,    183,    135,     78,
-		   8,    240,    172,    145,
-		  68,     18,     28,     88,
-		 155,    169,    228,     54,
-		  81,    152,    195,    242,
-		  54,    109,    147,    204,
-		   7,    195,    155,     79,
-		  62,    228,    161,    157,
-		  66,     18,    233,     79,
-		 142,    161,    255,      9,
-		  91,    133,    182,    244,
-		  34,     91,    152,    192,
-		 248,     48,    145,    105,
-		  56,    226,    221,    138,
-		  73,     54,    249,     67,
-		 127,    188,    241,      2,
-		  94,    141,    188,    237,
-		  41,     93,    141,    181,
-		 241,     45,    163,    101,
-		  38,     26,    218,    131,
-		 116,     60,    244,    198,
-		 115,    168,    200,     28,
-		  80,    119,    165,    235,
-		  31,     71,    133,    188,
-		 229,     39,     85,    113,
-		  51,     28,    194,    186,
-		 112,     34,     19,    196,
-		 151,    154,    195,     20,
-		  41,     99,    170,    210,
-		  22,     76,    114,    167,
-		 239,     30,     72,    125,
-		  64,      3,    202,    176,
-		 109,     38,     28,    218,
-		 156,    151,    196,    236,
-		  32,    125,    144,    216,
-		  15,     53,    123,    175,
-		 208,     24,     78,    120,
-		  76,     17,    243,    165,
-		 103,     93,      7,    201,
-		 175,    115,    197,    230,
-		  62,    116,    134,    199,
-		   8,     51,     99,    151,
-		 222,      2,     55,    116,
-		 168,     36,    255,    173,
-		 154,     80,     14,    243,
-		 161,    126,    184,    225,
-		  54,     77,    156,    206,
-		 242,     43,    107,    159,
-		 197,     13,     60,     97,
-		 163,     40,    249,    212,
-		 157,     73,     58,    244,
-		 163,    133,     77,    237,
-		  13,     66,    149,    181,
-		 252,     34,     82,    134,
-		 204,    244,     36,    105,
-		 158,     50,    245,    218,
-		 135,     66,     52,    237,
-		 169,    128,     87,    216,
-		  27,     88,    109,    189,
-		 229,     21,     85,    140,
-		 180,    252,     42,     81,
-		 153,    199,      1,    223,
-		 136,    125,     47,    230,
-		 222,    157,     91,    213,
-		   1,     81,    101,    164,
-		 236,     31,     77,    117,
-		 188,    226,     19,     89,
-		 131,    185,     12,    212,
-		 178,    118,     39,     31,
-		 213,    136,    109,    207,
-		  15,     54,    127,    172,
-		 211,      7,     69,    125,
-		 165,    234,     25,     71,
-		 140,    178,    234,    233,
-		 164,     99,     92,     16,
-		 203,    183,    102,     58,
-		 244,     63,    119,    148,
-		 219,     15,     61,    100,
-		 174,    210,      1,     79,
-		 116,    165,    227,    239,
-		 190,    109,     85,      8,
-		 194,    188,    123,     69,
-		 241,     37,     78,    156,
-		 195,    244,     53,    108,
-		 151,    221,     22,     53,
-		 125,    172,    222,    245,
-		 177,    151,     75,      6,
-		 249,    165,    114,     79,
-		 233,     42,     89,    134,
-		 201,    253,     46,     86,
-		 158,    194,    238,     61,
-		 102,    151,    214,    252,
-		 201,    158,     64,     62,
-		 241,    162,    138,     87,
-		 231,     19,     64,    142,
-		 177,    234,     38,     94,
-		 128,    204,    228,     59,
-		 111,    158,    207,      4,
-		 195,    135,    121,     53,
-		 233,    213,    157,     80,
-		 222,     25,     75,    113,
-		 183,    227,     24,     70,
-		 142,    180,    252,     51,
-		  72,    129,    198,     11,
-		 212,    143,    127,     44,
-		 226,    220,    133,    104,
-		 214,     14,     50,    122,
-		 174,    217,     19,     79,
-		 118,    191,    245,     10,
-		  65,    136,    190,     18,
-		 221,    183,    101,     36,
-		  28,    198,    141,    110,
-		 206,      7,     60,    110,
-		 163,    212,     10,     55,
-		 126,    185,    202,      0,
-		  90,    113,    182,     27,
-		 228,    191,    106,     83,
-		  22,    200,    171,    116,
-		 198,    255,     38,     96,
-		 152,     51,      2,     48,
-		 102,    179,    195,     31,
-		  83,    121,    168,     35,
-		 226,    164,    146,     91,
-		   2,    242,    161,    121,
-		 191,    247,     33,     91,
-		 109,     57,      5,     40,
-		 110,    138,    219,     23,
-		  44,    103,    162,     42,
-		 255,    175,    155,     67,
-		  13,    228,    188,    128,
-		 183,    236,     28,    175,
-		 115,     70,    243,     32,
-		  80,    132,    211,    238,
-		  34,     98,    154,     52,
-		 246,    201,    128,     79,
-		  41,    248,    185,    119,
-		 175,    227,    235,    179,
-		 120,     73,    233,     22,
-		  68,    156,    168,    230,
-		  39,     89,    108,     48,
-		  13,    193,    137,    106,
-		  37,    255,    196,    110,
-		 165,     36,    246,    183,
-		 143,     81,    225,     28,
-		  94,    151,    160,    248,
-		  43,     87,    113,     74,
-		   5,    217,    172,    102,
-		  50,      3,     51,    100,
-		  99,     43,    240,    207,
-		 136,     90,    223,      1,
-		  87,    108,    187,    236,
-		  30,    179,    122,     68,
-		  30,    211,    163,    114,
-		  61,    245,     40,     94,
-		 111,     63,     12,    192,
-		 146,    156,    219,     22,
-		  40,    100,    181,    208,
-		  19,    185,    140,     92,
-		  22,    236,    183,    125,
-		 186,    238,     38,    169,
-		 123,     51,      6,    223,
-		 155,    151,    198,    238,
-		  32,    124,    142,    219,
-		   8,    196,    135,     85,
-		  47,    230,    189,    123,
-		 178,    230,     27,    181,
-		 112,     73,     30,    212,
-		 166,    139,    210,    227,
-		  59,    121,    135,    195,
-		 253,    195,    152,    112,
-		  38,    255,    196,    115,
-		 171,    216,     16,    188,
-		 137,     64,     18,    225,
-		  80,    140,    170,    253,
-		  49,     75,    133,    194,
-		   0,    217,    147,    102,
-		  56,    248,    201,    104,
-		 165,    208,     10,    198,
-		 135,     89,     42,    233,
-		  73,    119,    162,    244,
-		   9,     64,    141,    187,
-		   8,    209,    171,    125,
-		  51,      2,     46,     96,
-		 157,    201,    252,    207,
-		 156,     81,     32,    247,
-		  68,    120,    184,    203,
-		   1,     89,    118,     79,
-		  30,    239,    189,    117,
-		  75,     13,     38,     95,
-		 149,    198,      4,    216,
-		 149,    106,     54,    253,
-		  62,     96,    179,    196,
-		  30,     76,    115,     80,
-		  22,    230,    184,    138,
-		  77,     20,     31,     87,
-		 140,    191,     14,    210,
-		 173,    100,     60,    251,
-		  56,    107,    138,    221,
-		  20,     51,    111,     90,
-		  46,    254,    182,    128,
-		  87,     30,     20,     79,
-		 132,    181,     19,    236,
-		 166,    126,     69,    241,
-		  33,     83,    130,    215,
-		 241,     54,    152,     98,
-		  38,    240,    204,    149,
-		  89,    216,     10,     71,
-		 123,     80,     20,    228,
-		 185,    121,     75,    239,
-		  43,     91,    154,    177,
-		 252,     43,    162,    106,
-		  48,      5,    200,    154,
-		 156,    213,      2,     56,
-		 142,     82,     46,    251,
-		 178,    131,    174,    229,
-		  19,     67,    143,    191,
-		 238,    223,    173,    113,
-		  59,      9,    213,     94,
-		 144,    205,    252,    207,
-		 159,    105,     39,    241,
-		 197,    143,    165,    211,
-		  28,     78,    125,    173,
-		  27,    228,    178,    126,
-		  70,    237,     33,     82,
-		 138,    194,     11,    211,
-		 150,     99,     61,      6,
-		 200,    105,    154,    212,
-		  14,     62,    115,    167,
-		  35,     17,     71,    121,
-		 179,    227,     29,     74,
-		 134,     69,     22,    212,
-		 175,    122,     59,     12,
-		 210,     96,    148,    201,
-		   1,     53,    106,    158,
-		 214,     13,     59,    116,
-		 160,    213,     20,     70,
-		 128,     72,     17,    237,
-		 167,    114,     66,     21,
-		 216,    167,    142,    193,
-		 250,     46,    102,    145,
-		 203,      9,     62,    108,
-		 165,    214,    245,    193,
-		 136,     83,     38,    229,
-		 189,    137,     68,     30,
-		 225,    174,    132,    190,
-		 247,     44,     80,    133,
-		 204,    255,     44,     99,
-		 152,    205,    253,    202,
-		 151,     86,     37,    249,
-		 180,    130,     80,     33,
-		  22,     79,    116,    191,
-		 227,     20,     86,    135,
-		  66,     14,     38,     90,
-		 145,     58,      6,    215,
-		 147,    111,     57,    251,
-		 195,    146,    161,    208,
-		   6,     74,    113,    170,
-		  29,    233,    180,    128,
-		 181,    235,     30,    172,
-		 118,     67,     15,    219,
-		 167,    109,     56,    249,
-		  54,     98,    159,    206,
-		 249,    194,    148,     89,
-		  36,    243,    188,    136,
-		 172,    226,     21,     73,
-		 129,    180,    235,     29,
-		  80,    140,    189,     13,
-		 211,    164,    107,     62,
-		   6,    202,    157,     96,
-		  46,      7,     63,    106,
-		 161,    220,     11,     69,
-		 127,    170,    230,    233,
-		 182,    120,     79,     19,
-		 217,    172,    115,     70,
-		   8,     41,     92,    144,
-		 205,    251,     53,    111,
-		 148,    214,      5,    197,
-		 138,     92,     34,    247,
-		 189,    131,     84,     24,
-		 230,     76,    128,    180,
-		 239,     37,     83,    141,
-		 199,    240,     43,    162,
-		 111,     51,      4,    201,
-		 146,    103,     41,    249,
-		  63,    119,    161,    221,
-		  22,     64,    127,    172,
-		 228,    228,    183,    123,
-		  64,     20,    219,    174,
-		 117,     58,      8,     40,
-		 103,    156,    192,    244,
-		  63,     99,    153,    208,
-		 245,    202,    129,     86,
-		  46,    226,    179,    141,
-		  72,     25,     24,     72,
-		 143,    181,    224,     44,
-		  87,    128,    203,    244,
-		 208,    151,    100,     58,
-		 240,    197,    154,    109,
-		  35,    244,     58,    122,
-		 165,    205,      3,     85,
-		 108,    189,    227,    229,
-		 168,    113,     72,     29,
-		 214,    168,    124,     54,
-		   2,    210,     97,    159,
-		 192,     14,     39,    123,
-		 173,    221,     10,    197,
-		 130,     93,     45,    225,
-		 186,    137,     74,     25,
-		  30,     87,    143,    176,
-		 253,     40,     86,    134,
-		 199,      5,    214,    150,
-		 108,     57,    241,    196,
-		 153,     91,    214,     14,
-		  72,    126,    167,    208,
-		  27,     69,    121,    179,
-		  17,    233,    160,    118,
-		  77,      0,    213,    172,
-		 110,    193,    243,     35,
-		 106,    150,    193,     13,
-		  51,    104,     93,     46,
-		 249,    178,    132,     90,
-		  16,    231,    188,    131,
-		 183,    224,     19,     67,
-		 153,    173,    255,     47,
-		  93,    107,     48,     15,
-		 195,    150,    105,     60,
-		 242,    195,    145,    167,
-		 208,      6,     79,    121,
-		 160,    235,     19,    181,
-		 121,     67,     31,    235,
-		 160,    125,     73,     15,
-		  40,     88,    155,    204,
-		 241,     60,    109,    156,
-		 209,    254,    204,    154,
-		  80,     44,    248,    180,
-		 130,     82,    225,     17,
-		  70,    141,    184,    229,
-		  44,     82,    139,     70,
-		   6,    198,    176,    124,
-		  57,      9,    203,    103,
-		 155,    220,     23,     40,
-		  98,    181,    214,      9,
-		 187,    143,     65,      8,
-		 243,    163,    115,     66,
-		  21,    222,     80,    135,
-		 209,    230,     57,     78,
-		 153,    206,      1,    196,
-		 154,    115,     60,    232,
-		 206,    132,     92,     36,
-		  21,     79,    116,    160,
-		 235,     23,     68,    135,
-		  69,     26,    214,    165,
-		 126,     50,      3,    211,
-		 156,    148,    205,    245,
-		  57,    100,    146,    218,
-		  12,    192,    133,     84,
-		  46,    226,    179,    131,
-		  76,    229,     30,     71,
-		 143,    181,    226,     47,
-		  82,    139,    195,     13,
-		 217,    144,    121,     59,
-		 243,    194,    150,    157,
-		 211,      2,     48,    124,
-		 166,    209,     26,     68,
-		 129,     73,     18,    233,
-		 161,    119,     79,     23,
-		 216,     89,    139,    203,
-		 243,     33,    110,    156,
-		 196,      2,    200,    146,
-		  86,     33,    249,    203,
-		 130,     80,     32,     17,
-		  78,    116,    185,    236,
-		  22,     89,    131,    186,
-		  12,    220,    173,    121,
-		  50,     14,    215,    159,
-		 103,    206,      4,     63,
-		 101,    168,    222,     14,
-		  66,    139,     81,     39,
-		 226,    191,    137,     75,
-		  19,    227,     83,    131,
-		 187,    248,     47,     82,
-		 151,    193,    251,    210,
-		 159,     97,     57,    244,
-		 192,    148,     94,     41,
-		  13,     66,    112,    172,
-		 232,     18,     76,    124,
-		 180,     20,    229,    170,
-		 127,     74,     10,    221,
-		 161,    110,    199,    248,
-		  52,     99,    156,    201,
-		   1,     58,    111,     93,
-		  36,    246,    184,    141,
-		  86,     29,    232,     75,
-		 129,    182,    233,     27,
-		  80,    141,    189,    241,
-		  40,    162,    111,     59,
-		   7,    202,    157,    102,
-		  46,      5,     59,    109,
-		 167,    218,     13,     65,
-		 120,     82,     28,    234,
-		 176,    125,     74,     22,
-		 222,    170,    138,    189,
-		 247,     45,     90,    151,
-		 203,    252,    205,    153,
-		  97,     45,    253,    192,
-		 140,     88,     36,     15,
-		  69,    123,    173,    224,
-		  28,     73,    129,    181,
-		 236,    222,    171,    119,
-		  59,     14,    209,    163,
-		 105,     55,    254,     50,
-		 106,    158,    214,      3,
-		  63,    115,    167,    219,
-		 238,    184,    134,     83,
-		  24,    229,    179,    124,
-		 184,    236,     32,     85,
-		 143,    194,    244,     42,
-		  96,    106,     52,      1,
-		 201,    148,     99,     45,
-		 247,    194,    114,    166,
-		 222,     19,     68,    122,
-		 177,    229,    229,    177,
-		 122,     68,     19,    222,
-		 165,    115,     61,    247,
-		  45,     99,    148,    201,
-		   2,     55,    107,    159,
-		 212,    246,    192,    142,
-		  85,     32,    239,    186,
-		 130,     78,    230,     26,
-		  81,    135,    184,    237,
-		  37,     88,    142,     60,
-		   7,    210,    156,    105,
-		  50,    255,    200,    149,
-		  95,     42,     10,     63,
-		 117,    168,    223,     18,
-		  73,    125,    178,     24,
-		 227,    174,    121,     68,
-		  15,    218,    165,    112,
-		  59,      6,     46,     99,
-		 152,    205,      2,    200,
-		 147,     94,     41,    244,
-		 191,    138,     85,     32,
-		 235,    182,    129,     76,
-		 232,     29,     82,    135,
-		 188,    241,    217,    164,
-		 111,     58,      5,    208,
-		 100,    153,    206,      3,
-		  56,    109,    162,    215,
-		  12,    190,    137,     84,
-		  31,    234,    181,    128,
-		  75,     22,    225,    172,
-		 119,     66,     13,     39,
-		  92,    145,    198,    251,
-		 207,    154,    101,     48,
-		   4,     57,    110,    163,
-		 217,     13,     66,    119,
-		 172,    225,    233,    180,
-		 127,     74,     21,    224,
-		 171,    118,     65,    243,
-		  40,     93,    146,    199,
-		 252,     49,    102,    155,
-		  47,    250,    197,    144,
-		  90,     39,    240,    189,
-		 135,     82,    226,     23,
-		  77,    128,    183,    234,
-		  33,     85,    138,     64,
-		  11,    214,    160,    109,
-		  54,      2,    205,    152,
-		 156,    209,      7,     58,
-		 113,    164,    219,     15,
-		  68,    134,     81,     29,
-		 230,    179,    124,     73,
-		  18,    222,     86,    138,
-		 193,    244,     43,     94,
-		 148,     54,      1,    204,
-		 150,     99,     44,    249,
-		 195,    142,     89,    219,
-		  16,     68,    123,    174,
-		 229,     24,     79,    131,
-		 184,     18,    221,    169,
-		 114,     63,      8,    213,
-		 159,    106,    202,    255,
-		  53,    104,    159,    210,
-		   9,     60,    114,    167,
-		  35,    238,    184,    133,
-		  78,     27,    228,    176,
-		 123,    185,    238,     35,
-		  88,    141,    194,    247,
-		  44,     97,    105,     52,
-		 255,    202,    149,     96,
-		  43,    246,    193,    115,
-		 168,    221,     18,     71,
-		 124,    177,    230,     27,
-		 175,    122,     69,     16,
-		 219,     89,    142,    195,
-		 248,     45,     98,    151,
-		 204,      1,     54,    107,
-		  95,     42,    245,    192,
-		 139,     86,     33,    236,
-		 183,    125,    178,    231,
-		  28,     81,    134,    187,
-		 240,    218,    165,    112,
-		  59,      6,    209,    156,
-		 103,     50,    253,     55,
-		 108,    161,    214,     11,
-		  64,    117,    170,    223,
-		 235,    182,    129,     76,
-		  23,     29,     82,    135,
-		 188,    241,     38,     91,
-		 144,    197,      5,    208,
-		 155,    102,     49,    252,
-		 199,    146,     93,     40,
-		 243,    190,    118,    171,
-		 224,     21,     74,    127,
-		 180,     22,    225,    172,
-		 119,     66,     13,    216,
-		 163,    110,     57,    251,
-		  48,    101,    154,    207,
-		   4,     57,    110,     92,
-		  39,    242,    189,    136,
-		  83,     30,    233,     75,
-		 128,    181,    234,     31,
-		  84,    137,    190,    243,
-		  40,     93,    109,     56,
-		   3,    206,    153,    100,
-		  47,    250,    197,    111,
-		 164,    217,     14,     67,
-		 120,    173,    226,    232,
-		 179,    126,     73,     20,
-		 223,    170,    117,    191,
-		 244,     41,     94,    147,
-		 200,    253,     50,    103,
-		 156,     46,    249,    196,
-		 143,     90,     37,    240,
-		 187,    134,     81,    227,
-		  24,     77,    130,    183,
-		 236,     33,     86,    139,
-		  63,     10,    213,    160,
-		 107,     54,    254,     51,
-		 104,    157,    210,      7,
-		  60,    113,    166,    219,
-		  16,     69,    122,    175,
-		 228,    230,    177,    124,
-		  71,     18,    221,    168,
-		 115,    193,    246,     43,
-		  96,    149,    202,      0,
-		 203,    150,    158,     44,
-		 247,    194,    141,     88,
-		  35,     17,     70,    123,
-		  79,     26,    229,    176,
-		 123,     70,     17,    220,
-		 167,    141,    194,    247,
-		  44,     97,    150,    203,
-		   0,     53,    149,     96,
-		 212,      9,    193,    140,
-		 168,    221,     18,    184,
-		 131,     78,     25,     27,
-		  80,    133,    186,    239,
-		  36,    166,    113,     60,
-		 248,    210,    157,    151,
-		 204,      1,     54,    148,
-		 160,    213,     10,    192,
-		 139,     86,     33,    236,
-		  72,    125,    178,    231,
-		 227,    174,    121,    187,
-		 240,     37,     90,    143,
-		 196,    249,     46,    156,
-		 103,     50,    253,    200,
-		 108,    161,    214,     11,
-		  64,    117,    170,    223,
-		  20,     73,    126,     76,
-		 232,    226,    173,    120,
-		  67,     14,    217,     91,
-		 144,    197,    250,    208,
-		 155,    102,     49,    252,
-		 199,    146,     93,    215,
-		  12,     65,    118,    171,
-		  31,    234,    181,    128,
-		 180,    233,     30,     83,
-		 136,    189,    242,    216,
-		 163,    110,    198,      4,
-		  48,    154,    154,    207,
-		   4,     57,    110,    163,
-		 216,     13,     66,    119,
-		 172,     30,    233,    180,
-		 127,    181,     21,    224,
-		  84,    137,     65,     12,
-		 215,    162,    109,    199,
-		 252,     49,    102,    100,
-		 208,      5,    197,    111,
-		 164,    217,     14,    188,
-		 135,     82,     29,    232,
-		 179,    126,     73,    235,
-		  32,     85,    138,    191,
-		 244,     41,     94,    108,
-		 200,      2,     50,    103,
-		  99,     46,    249,    196,
-		 143,     90,     37,    240,
-		 187,    121,    174,     28,
-		  24,    178,    130,     72,
-		  19,    222,     86,    116,
-		  63,     10,     42,     95,
-		 148,    201,      1,     51,
-		 104,    157,    210,    248,
-		  60,    142,    166,     37,
-		  16,     68,    135,    175,
-		 228,    230,     78,    131,
-		  71,     18,     34,    168,
-		 140,    193,      9,     43,
-		 159,    106,    202,      0,
-		  52,    150,     97,    211,
-		   8,    195,    114,    164,
-		  35,    236,    184,    123,
-		 176,    229,     26,    177,
-		 123,     70,     17,     34,
-		  88,    114,     61,      8,
-		 211,     97,    150,    203,
-		 255,    202,    106,    159,
-		 212,    246,     62,    115,
-		  87,    221,     18,     71,
-		 124,     78,     25,    228,
-		  80,    122,     69,     16,
-		 219,     89,    113,    195,
-		 248,    210,     98,    104,
-		  51,      1,     54,    148,
-		  95,    213,     10,     63,
-		 116,    169,    222,    236,
-		  72,    130,    178,    231,
-		  28,    174,    134,    187,
-		 240,    218,    165,    143,
-		  59,    249,     46,    156,
-		 152,     50,      2,    200,
-		 147,    161,     41,     11,
-		 191,    138,     85,     32,
-		 235,    182,    126,     76,
-		  23,     29,    173,    135,
-		  67,    241,    217,     91,
-		 144,     58,    250,    208,
-		 100,    153,    206,      3,
-		  56,    146,    162,    215,
-		 243,    190,    118,    171,
-		 224,     21,    181,    127,
-		 180,     22,     30,    172,
-		 119,    189,     13,     39,
-		  92,    110,     57,    251,
-		 207,    154,    154,     48,
-		 251,     57,    145,     92,
-		 216,    242,    189,    119,
-		  83,     30,     22,    180,
-		 127,    181,     21,     31,
-		 171,    137,     65,    243,
-		 215,     93,    146,     56,
-		   3,    206,    102,    100,
-		 208,    250,     58,    144,
-		 164,    217,    241,     67,
-		 135,     82,    227,     23,
-		 177,    129,    183,     20,
-		  32,    170,    117,    191,
-		  11,    214,     94,    147,
-		 200,    253,     50,    153,
-		 157,     46,    249,     58,
-		 142,    165,    218,    240,
-		 187,    121,     81,    227,
-		  24,    178,    130,    183,
-		  19,     33,     86,    116,
-		 192,     10,    213,     95,
-		 107,     54,    254,     51,
-		 151,    157,    210,    248,
-		  60,    113,     88,    219,
-		  16,    186,    123,     80,
-		  27,     25,    177,    131,
-		 184,     18,    221,     86,
-		 115,     63,    247,    212,
-		 159,    149,     53,      0,
-		  52,    105,     97,    210,
-		 247,    195,    114,    167,
-		  35,     17,    184,    123,
-		 176,    229,    229,    176,
-		 132,     70,     17,     35,
-		  88,    141,    194,      8,
-		  44,     97,    105,    203,
-		   0,    202,    149,    158,
-		  43,    246,    193,    115,
-		 168,     34,     18,     71,
-		 131,     78,     25,     27,
-		 175,    122,    186,     16,
-		  36,    166,    113,    195,
-		   7,    210,     98,    151,
-		  51,    254,    201,    107,
-		  94,    212,     10,    193,
-		 116,     87,    222,     18,
-		 183,    125,    178,     25,
-		 227,    174,    134,    186,
-		 240,    219,    165,    142,
-		  59,    249,     46,    156,
-		 102,    205,      2,    201,
-		 108,    161,     41,    244,
-		  64,    138,     85,    222,
-		 234,    182,    127,     77,
-		 233,     29,    173,    135,
-		 188,     14,     39,    164,
-		 110,    196,      5,    208,
-		 101,    103,     49,      2,
-		 198,    146,    163,     40,
-		 243,     64,    136,     84,
-		 224,    234,    181,    127,
-		  75,     22,     30,    173,
-		 119,    188,     13,    216,
-		  92,    111,    198,    251,
-		 206,    101,    154,     49,
-		 251,     57,    145,    163,
-		 216,    242,    189,    136,
-		 172,    225,     22,    180,
-		 127,     74,     21,     31,
-		  84,    118,    190,     12,
-		 215,     93,    146,    199,
-		 252,    206,    153,    155,
-		  47,      5,     58,    144,
-		 164,     38,    241,     67,
-		 120,    173,     29,    232,
-		 179,    126,    182,     20,
-		  32,    170,    117,    191,
-		  11,     41,     94,    108,
-		 200,    253,    205,    103,
-		 156,     46,    249,     59,
-		 143,     90,    218,    240,
-		  68,    121,     81,     28,
-		  24,    178,    130,    183,
-		  19,    222,     86,    116,
-		  63,    245,    213,    160,
-		 148,     54,      1,     51,
-		 150,     98,    210,    248,
-		  60,    112,    166,    218,
-		  17,    186,    123,    174,
-		 228,     25,     78,    124,
-		  71,     18,    217,    172,
-		 119,     54,     13,     43,
-		  97,    147,    193,    244,
-		  63,     98,    154,    211,
-		 246,    203,    132,     80,
-		  43,    230,    191,    132,
-		  76,     26,    229,     79,
-		 136,    181,    231,     41,
-		  92,    115,     56,      9,
-		 218,    144,    105,     62,
-		 246,     63,    102,    157,
-		 222,     14,    205,    139,
-		  81,     37,     23,     78,
-		 126,    185,    226,    226,
-		 171,    125,     73,     26,
-		 221,     89,    134,    205,
-		 239,     61,    104,    148,
-		  52,    237,    222,    156,
-		  92,    213,      2,     52,
-		 112,    168,    221,    234,
-		 189,    134,     79,    229,
-		  23,     65,    149,    182,
-		 243,    216,    170,    104,
-		  36,     26,    209,    100,
-		 139,    210,     19,     53,
-		 111,     88,     50,    230,
-		 186,    131,    172,    199,
-		   1,     90,    114,     77,
-		  29,    243,    183,     92,
-		  86,    249,     48,     65,
-		 139,    213,      1,    219,
-		 148,    117,     60,    245,
-		  57,    125,    182,    196,
-		  29,     73,    143,     92,
-		  21,    252,    149,    148,
-		 186,    241,     11,     69,
-		 129,     73,     31,    211,
-		 168,    100,     56,      4,
-		  61,    117,    150,    192,
-		  12,    198,    147,     94,
-		  55,    232,    160,    138,
-		 181,    241,     24,     69,
-		 127,     69,     29,    226,
-		 172,    114,     67,      9,
-		  42,     90,    157,    214,
-		 243,     61,    101,    111,
-		  53,    216,    229,    107,
-		 179,    213,      5,     79,
-		 131,     94,    224,     21,
-		 182,    123,     64,     27,
-		 217,     94,    144,    164,
-		 239,     38,    166,    116,
-		  22,     47,    215,    113,
-		 128,    193,     22,     51,
-		 158,     85,    218,    241,
-		 190,    131,     87,     26,
-		  26,     84,    168,    149,
-		 255,     33,    176,     93,
-		  24,     39,    219,    119,
-		 179,    216,    245,    201,
-		 139,    108,    211,      6,
-		  60,    136,     92,    219,
-		  20,     94,     85,    180,
-		 231,    234,    146,     81,
-		  88,     50,    217,     96,
-		 161,    203,    247,    218,
-		 190,    101,    204,    250,
-		  54,    144,    107,     45,
-		  14,     32,     65,    187,
-		  37,    248,    156,    162,
-		  91,     12,    227,    125,
-		 180,    187,     28,    204,
-		 188,     99,    204,    230,
-		  37,    150,    123,    202,
-		  14,     41,     69,    130,
-		  36,    212,    223,    149,
-		  89,     41,    231,     90,
-		  76,    185,     13,    244,
-		 191,    105,    179,    247,
-		  40,    170,    102,     62,
-		 245,     52,     73,    137,
-		  34,    218,    211,    159,
-		  92,     42,    249,    192,
-		  82,    188,     55,    251,
-		 176,    140,     79,    242,
-		  14,    166,     98,     64,
-		 232,     60,     71,    146,
-		  50,     47,    203,    102,
-		 157,     49,    244,    209,
-		 110,    133,    208,    238,
-		 180,    142,     89,    215,
-		  13,     78,    149,     67,
-		 253,     63,     64,    136,
-		 184,     20,    199,     92,
-		 133,     62,      9,    207,
-		 190,    142,    227,    248,
-		 208,    147,     87,     34,
-		  25,     88,    136,     71,
-		  31,     14,     91,    127,
-		 189,     23,    251,    164,
-		 147,    183,     30,    197,
-		 146,    127,    242,    222,
-		 222,    149,    102,     33,
-		 251,     37,    126,     85,
-		  41,      5,     90,    113,
-		  82,    228,    235,    190,
-		 139,    172,     18,    193,
-		 136,     91,     67,    179,
-		  15,    182,    123,     53,
-		  19,     55,    122,    148,
-		  42,    240,     57,    124,
-		 165,     35,      1,     69,
-		 142,    165,    240,    253,
-		 153,     96,    109,    224,
-		 109,    114,    107,     99,
-		   5,    223,     86,    136,
-		 219,      2,    221,    103,
-		 142,     45,      5,     33,
-		 121,     93,    220,     10,
-		 155,    172,     74,      2,
-		   0,      0,    149,    102,
-		  63,    210,    169,    132,
-		 223,    237,    215,    184,
-		 105,    221,    252,     59,
-		 114,    145,     36,    254,
-		 195,    145,    124,     43,
-		 244,     85,     49,    183,
-		  46,    215,    179,    137,
-		 172,    207,     55,    171,
-		 111,     53,    229,     38,
-		 111,    130,    192,     16,
-		 219,    147,    125,     55,
-		 240,    216,    114,    231,
-		 255,    194,    139,    133,
-		 190,    234,      1,     85,
-		 129,     91,      5,     52,
-		  66,    134,    205,    240,
-		 202,    131,    108,     56,
-		 239,    203,    132,    113,
-		 243,     39,    215,    185,
-		  92,    200,      1,     81,
-		  96,    186,      2,    250,
-		  64,    158,    188,    229,
-		  45,    183,    110,     52,
-		 248,    214,     98,    103,
-		  27,    251,      4,    124,
-		 123,     61,     30,     43,
-		 125,    189,    204,    224,
-		 148,    132,    145,    255,
-		  29,     81,    112,     93,
-		   2,     44,     92,    117,
-		  43,     45,    241,     68,
-		 163,     50,    225,     55,
-		 102,     94,    222,     24,
-		  74,    154,     68,    208,
-		   6,     76,    129,     69,
-		   4,    236,     81,    137,
-		 185,      1,    251,    142,
-		 147,    133,    211,    223,
-		 129,    109,     54,      3,
-		  32,     76,    168,     48,
-		 226,     76,    124,     82,
-		  21,    238,    176,    130,
-		 191,    227,    231,    181,
-		  81,     88,    238,     28,
-		  79,    115,     27,     14,
-		  52,    124,    177,    239,
-		 242,    239,    156,    179,
-		 217,    255,     64,    103,
-		 172,     28,     30,     77,
-		 109,    111,     49,    236,
-		 122,    179,    190,     39,
-		 202,     89,    129,    227,
-		 219,     55,    176,     73,
-		 209,     23,     56,    106,
-		 181,    223,    253,    191,
-		 113,     87,      6,    202,
-		 170,    139,    143,    194,
-		 202,    154,    101,    175,
-		 232,     13,     72,    124,
-		   3,     23,     42,    118,
-		  99,    214,     23,    192,
-		 157,     91,    210,    248,
-		 160,    157,     67,    244,
-		  33,     94,     88,    109,
-		 238,     53,     77,    149,
-		 196,     21,    241,    161,
-		 135,    194,    249,     56,
-		 107,    112,     38,     10,
-		  55,    131,     66,     56,
-		 224,     96,     67,    173,
-		  48,    253,     71,    150,
-		 162,    255,    222,    180,
-		 105,    199,    249,     41,
-		  99,    153,     48,     19,
-		  52,    121,    156,     58,
-		 234,    223,    137,    149,
-		 236,    226,    146,    137,
-		 191,    244,     12,     95,
-		 124,     90,      4,     32,
-		  84,    128,    201,    244,
-		 216,    148,    156,    198,
-		 248,    208,    139,    124,
-		 196,     54,     35,    172,
-		 127,     33,     29,     81,
-		 107,    184,     21,    251,
-		 161,    140,    180,    229,
-		  44,    166,    125,     63,
-		 243,     39,    149,    117,
-		  18,    242,     17,     89,
-		  95,      3,    233,     54,
-		  97,    190,    205,     16,
-		 162,    161,     68,    244,
-		  10,     88,    120,     67,
-		   7,     32,     84,    139,
-		  41,     39,    240,     96,
-		 174,    232,    234,    228,
-		 155,    179,    194,     24,
-		  76,    130,     75,     52,
-		  19,     93,    111,    182,
-		  17,    235,    174,    143,
-		 183,     13,    192,    130,
-		 120,    228,    192,     39,
-		 188,    123,    200,     18,
-		  42,    127,    164,     38,
-		 238,    181,    100,    177,
-		 231,    226,    188,    133,
-		 183,    226,     26,    160,
-		  87,    107,     12,     29,
-		 112,    124,     18,     10,
-		  62,    113,    136,    196,
-		 249,    210,    133,    163,
-		 204,     30,     66,    130,
-		  87,     31,     23,     78,
-		 125,     83,     63,    243,
-		 115,    177,    186,     36,
-		 204,     91,    129,    214,
-		 240,     54,    147,    120,
-		  35,     17,     39,    105,
-		  87,     33,    242,     67,
-		 125,    173,     17,    200,
-		 145,    143,    138,    244,
-		 194,    130,    112,    173,
-		 224,     36,     82,    147,
-		  32,     23,     57,    120,
-		 145,     39,    244,    195,
-		 142,    167,    216,    246,
-		 162,    163,    175,    208,
-		  61,    162,     88,     69,
-		 230,     48,     88,    134,
-		 197,     27,    194,     93,
-		 143,    216,      7,    193,
-		 145,     98,     45,    250,
-		 192,    128,    120,     47,
-		  56,    108,    129,    112,
-		   8,     26,     94,    146,
-		 182,    229,    209,    190,
-		 114,    217,    228,    215,
-		 148,    108,     54,      3,
-		 206,    149,    107,     50,
-		 252,     25,     87,     93,
-		  63,    229,     64,    112,
-		 187,    232,     22,    183,
-		 109,     66,    249,     54,
-		 164,    124,     59,      8,
-		 208,    150,    111,     60,
-		 231,    195,     72,    190,
-		  33,    235,    198,    122,
-		 161,    216,     24,     74,
-		 133,     90,     26,      2,
-		  68,    127,     85,     23,
-		  36,    165,    123,     54,
-		  15,    197,    154,    179,
-		 237,    242,    214,    144,
-		 175,    217,      9,     56,
-		 120,     87,     48,    238,
-		  95,    110,     78,      8,
-		 234,     81,    134,     72,
-		  30,    214,    181,    138,
-		 226,    225,    197,    131,
-		 102,    220,     12,     52,
-		 111,    166,     43,    255,
-		  66,     96,    187,     34,
-		 251,    186,    129,    178,
-		  24,    246,    189,    113,
-		 169,    212,     33,    184,
-		 119,    193,    233,     32,
-		  96,    154,    206,    250,
-		 199,     98,    172,    211,
-		 242,    183,    132,     81,
-		 224,    231,    173,    152,
-		 178,    199,      3,    185,
-		  82,     69,    252,     53,
-		  86,    146,    198,     12,
-		 202,    107,    143,    203,
-		 254,    199,    148,     81,
-		  33,    241,    178,    151,
-		  71,    194,     35,     73,
-		  84,     80,    230,     11,
-		  89,    140,    186,      9,
-		 219,     90,    143,    214,
-		   4,    197,    152,    103,
-		  39,    242,    204,    133,
-		 123,    209,     58,     94,
-		 158,    122,     26,      6,
-		  89,    136,    181,     23,
-		 209,    168,    144,    162,
-		 247,    217,    170,    110,
-		  53,      5,    193,    138,
-		 127,     47,     42,     36,
-		 158,    121,     44,      8,
-		  73,    118,    165,     30,
-		 242,    186,    158,    145,
-		 230,    211,    165,    114,
-		  60,      9,    221,    180,
-		  74,     53,    204,     23,
-		 129,     75,     41,     22,
-		  54,    114,    173,    211,
-		 248,    175,     99,    128,
-		 244,    247,    190,    121,
-		  67,     20,    219,    185,
-		  86,     59,    194,     13,
-		 136,     71,     50,    236,
-		  37,    104,    156,    213,
-		 229,    214,    102,    137,
-		 200,    224,    170,    130,
-		  78,     31,    224,    162,
-		  89,    189,    192,     59,
-		 190,     82,     60,    249,
-		  39,     97,    147,     52,
-		 235,    207,     74,    184,
-		 211,    248,    204,    139,
-		  86,     33,    232,    163,
-		 150,    171,    249,    237,
-		 178,    120,    181,    229,
-		  39,    162,    114,     53,
-		  13,     34,     74,    139,
-		  53,    234,    198,    145,
-		 165,    209,    251,    223,
-		 115,    129,    220,    198,
-		 175,    104,    174,    234,
-		 230,    164,    107,     94,
-		 243,      8,    116,    136,
-		  40,     16,    194,    148,
-		 145,    199,    238,    194,
-		 114,    174,      1,    223,
-		  72,    107,    179,    212,
-		 233,    162,    166,     66,
-		 201,     46,     79,    135,
-		  82,     18,    192,    160,
-		 157,    197,    254,     48,
-		 107,     65,      9,    244,
-		  35,     77,    180,    210,
-		 253,    151,    149,    190,
-		 208,     10,     77,    133,
-		  90,     12,    245,    171,
-		 119,    166,    223,     46,
-		 136,     93,     55,    244,
-		  40,    124,    139,     58,
-		 208,    220,    123,    134,
-		 194,      4,    184,    135,
-		  67,     18,    250,    191,
-		 163,    131,    239,    210,
-		 129,    114,    178,    225,
-		  59,     86,    120,     30,
-		   6,     42,    124,    139,
-		 213,    243,    203,    148,
-		  93,     59,    242,    119,
-		  82,     75,     41,    230,
-		  71,    139,    191,    251,
-		  32,    140,     85,    180,
-		 214,     52,     80,    102,
-		  45,      4,     61,    145,
-		 120,    197,     62,     48,
-		 190,    124,    222,     29,
-		  87,    107,    175,     60,
-		 195,    182,    147,    161,
-		 247,     45,    191,    107,
-		 193,    250,    217,     92,
-		 190,    208,     27,    231,
-		 133,    153,    202,     38,
-		  50,    146,    115,     46,
-		  25,     67,    106,    184,
-		  27,    253,    165,    131,
-		 186,    255,      0,     88,
-		 103,     35,      4,    211,
-		 105,    181,    210,     15,
-		 232,    155,    150,    217,
-		  13,    198,    135,     89,
-		 218,    232,    182,    109,
-		 150,    230,    253,    189,
-		 122,     66,    228,     59,
-		  82,    102,     40,    246,
-		  39,    107,    147,     59,
-		 224,    198,    120,    148,
-		 214,     29,     51,    157,
-		  65,    221,     20,     66,
-		 119,    187,    230,    235,
-		 164,    129,    182,    230,
-		 219,    183,    110,     44,
-		 255,     62,    125,    133,
-		  33,    224,    192,    104,
-		 168,    195,      4,    200,
-		 159,     80,    208,      1,
-		  65,    130,     66,      1,
-		 242,    174,    140,    155,
-		 237,    211,    135,    103,
-		  56,    241,     55,    119,
-		  98,     43,    236,     48,
-		 124,    181,    198,    240,
-		 163,    151,     93,    213,
-		  48,    106,    130,     83,
-		  13,    232,     82,    149,
-		 165,    251,    205,    186,
-		 110,    212,    247,     39,
-		  97,    108,     36,    242,
-		  57,    113,    188,    209,
-		 225,    165,    152,    171,
-		 239,     26,     73,    143,
-		  88,     23,     19,     89,
-		 136,     70,      4,    208,
-		 167,    155,    216,    234,
-		 199,    148,    111,     55,
-		   6,     42,     98,     84,
-		  51,    227,    191,    122,
-		 188,    226,    229,    187,
-		 119,    182,    244,      6,
-		 163,    123,     72,     28,
-		 223,     70,    136,     49,
-		  13,    198,    158,    102,
-		 214,      9,     59,    155,
-		  86,     37,      6,     79,
-		 116,    174,     21,    227,
-		 177,    135,    179,    234,
-		  32,    168,    114,     71,
-		   8,     47,     87,    108,
-		  48,    252,     63,     97,
-		 100,     38,    251,    192,
-		 137,    163,    220,    246,
-		 188,    134,     83,     26,
-		  16,     70,    127,     74,
-		 235,     44,     95,    142,
-		  62,     27,    205,    172,
-		 145,    192,    248,     50,
-		 157,    114,     42,     14,
-		  51,    118,    165,    220,
-		  28,     76,    114,    172,
-		  23,    243,    188,    131,
-		  70,     16,     34,    172,
-		 127,     55,    241,     59,
-		 104,    145,    205,    245,
-		  63,     96,     97,     38,
-		 250,    204,    134,     93,
-		 222,     23,     66,    129,
-		  65,     30,     25,     77,
-		 142,    173,    254,     43,
-		  91,    116,     51,      5,
-		 212,    155,    108,     53,
-		 255,    206,    156,    159,
-		 217,     14,    193,    115,
-		 173,    215,      1,     84,
-		 130,     95,     11,    234,
-		 166,    122,    178,    233,
-		 222,    168,    118,    203,
-		 241,     41,    101,    154,
-		 199,      6,     51,    107,
-		  88,     38,    250,    204,
-		 143,    170,    217,     23,
-		 178,    139,     73,     24,
-		  27,     64,    138,    190,
-		 247,     38,    162,    121,
-		  62,      0,    217,    155,
-		  99,    205,      2,    203,
-		 108,    164,    210,     15,
-		  69,    114,    162,    215,
-		  17,    182,    136,     67,
-		  27,    228,     83,    129,
-		 190,      8,    213,    162,
-		 148,    204,    243,     36,
-		  98,    154,    198,      4,
-		 198,    149,     87,     35,
-		 251,    187,    118,    173,
-		 225,    237,    188,    130,
-		 181,    238,     18,     90,
-		 128,    180,    246,    218,
-		 166,    107,     59,      6,
-		 205,    101,    100,     54,
-		 242,    194,    111,    160,
-		 221,      9,     66,    119,
-		 171,    230,     22,    182,
-		 124,     79,     16,    224,
-		  87,    141,    190,      4,
-		 208,    166,    108,    194,
-		 246,     55,    103,    154,
-		  44,    255,    198,    147,
-		  88,    217,     12,     64,
-		 125,     82,     25,     22,
-		  72,    131,    180,    233,
-		  32,     86,    137,     66,
-		  14,    208,    167,    104,
-		  53,    253,     51,    100,
-		 158,    209,      2,     61,
-		 115,    167,    217,     14,
-		 187,    134,     82,     25,
-		 229,    177,    117,     79,
-		  19,     35,     84,    142,
-		 193,     10,     41,     93,
-		 151,    207,    252,    205,
-		 147,    102,     46,    248,
-		 194,    139,     93,     37,
-		 239,     70,    127,    172,
-		  27,    231,    176,    130,
-		 189,    239,     32,     84,
-		 113,     59,     11,    213,
-		 158,    149,    200,      1,
-		 202,    104,     96,    210,
-		  12,    194,    140,     89,
-		  34,    239,     71,    120,
-		 177,    228,     24,    177,
-		 127,     71,    236,    220,
-		 166,    141,    194,      8,
-		 208,    156,    151,    202,
-		 255,     53,    106,    159,
-		 214,     13,     63,    141,
-		  86,     35,    236,    185,
-		 131,    179,    230,    224,
-		 173,    133,     68,     16,
-		  37,     88,    143,    192,
-		 249,     45,     99,    104,
-		  50,      1,     55,    148,
-		  94,     42,    247,    193,
-		 117,    169,     35,    237,
-		 183,    125,    179,    229,
-		  28,    174,    121,     69,
-		  15,     36,     88,    143,
-		  58,    249,     47,    157,
-		 102,    207,      0,    201,
-		 145,     94,    214,     11,
-		  65,    116,     84,     35,
-		 233,     73,    124,    177,
-		 232,    226,    172,    135,
-		 189,    241,     36,     90,
-		 110,     57,      7,    208,
-		 100,    102,    206,      3,
-		 198,    144,     92,    215,
-		  14,     64,    119,    171,
-		  31,     21,     75,    126,
-		 180,     22,    227,    175,
-		 118,    189,     13,    217,
-		 163,    110,     57,      4,
-		  48,    100,    154,    207,
-		   6,     58,    110,    163,
-		 216,    240,    191,    136,
-		 172,     30,     22,     74,
-		 128,     74,    234,    224,
-		 171,    118,    190,    242,
-		 215,     93,    147,     56,
-		   2,    207,    102,    155,
-		 208,      5,     56,    109,
-		  91,     39,    241,    189,
-		 134,     83,     29,     23,
-		  77,    128,    182,     20,
-		 221,    168,    116,    191,
-		 246,     43,     95,    147,
-		  55,      3,    204,    152,
-		 156,    209,    249,    197,
-		 142,    165,    219,    240,
-		 186,    135,     81,    227,
-		  25,     79,    128,    183,
-		  19,    223,    171,    116,
-		 192,     10,     42,     94,
-		 107,     55,      1,     50,
-		 105,    156,    210,    248,
-		 194,    142,    167,    218,
-		  16,    186,    132,     81,
-		  27,     24,     78,    131,
-		  71,     19,    221,     87,
-		 115,    193,    247,    212,
-		 158,    106,     53,      1,
-		  52,    104,    158,     44,
-		 247,     61,    114,    167,
-		 220,    238,    185,    123,
-		 176,    229,     26,     79,
-		 123,     71,     17,    220,
-		 167,    114,     61,    247,
-		  44,     97,    150,    203,
-		   0,    202,    149,     96,
-		 212,      9,     62,    114,
-		 168,     35,    236,    184,
-		 131,     78,    230,     26,
-		  81,    133,     69,     16,
-		 219,     89,    142,    195,
-		 248,     45,    157,    104,
-		  51,    254,    201,    148,
-		  95,     43,     10,     63,
-		 116,    169,     33,    236,
-		  72,    124,    178,    231,
-		  28,    174,    121,    187,
-		  15,    219,    165,    112,
-		  59,    249,     47,     99,
-		 103,     50,      2,     55,
-		 109,    161,     41,    244,
-		 191,    138,     84,    223,
-		  20,    182,    129,     76,
-		  23,     29,     82,    135,
-		 188,     14,    217,    164,
-		 144,     58,    250,     47,
-		 155,    103,     48,    252,
-		  56,    109,    162,    215,
-		  12,    190,    118,    171,
-		 224,     21,     75,    126,
-		  75,     22,    225,    172,
-		 136,    188,    242,    216,
-		 162,    111,     57,    250,
-		  49,    101,    154,     48,
-		 250,    198,    110,    163,
-		 216,     13,    189,    137,
-		  82,    225,     22,    180,
-		 127,     74,     21,    224,
-		  84,    137,     65,     12,
-		  40,     93,    146,     56,
-		   3,     49,    102,    100,
-		  47,      5,    197,    145,
-		  91,     38,    241,     67,
-		 120,     82,     29,     23,
-		  76,    126,    182,    234,
-		  32,    170,    138,    191,
-		  11,    214,    161,    147,
-		 200,    253,     50,    152,
-		  99,    209,      6,    196,
-		 112,    165,     37,    241,
-		 187,    134,     81,     28,
-		  24,    178,    125,    183,
-		 237,     33,    169,    139,
-		 192,     10,    213,     95,
-		 148,    201,    254,    204,
-		 151,     98,     45,    248,
-		 195,    113,    166,     36,
-		 239,     69,    122,    175,
-		  27,    230,     78,    131,
-		  71,     18,    221,    168,
-		 140,    193,      9,    212,
-		 159,    106,     53,    255,
-		  52,    105,    158,     44,
-		 247,     61,    114,     88,
-		 220,     17,     70,    132,
-		  79,     26,     26,     79,
-		 123,     70,    238,     35,
-		  88,    141,    194,    247,
-		  44,     97,    105,     52,
-		 255,    202,    149,    159,
-		 212,    246,    193,    140,
-		 168,    221,    237,    184,
-		 131,     78,    230,     27,
-		 175,    122,    186,     16,
-		 219,     89,    142,     60,
-		   7,     45,    157,    104,
-		 204,      1,    201,    107,
-		 160,     42,    245,     63,
-		 116,    169,    222,    236,
-		 183,    130,     77,     24,
-		  28,     81,    121,     68,
-		  15,    218,    165,    143,
-		 196,      6,     46,     99,
-		 103,     50,      2,     55,
-		 147,    161,     41,    244,
-		 191,    117,    170,    223,
-		 235,    182,    129,    179,
-		 232,     29,    173,    120,
-		  67,     14,     38,     91,
-		 111,     58,    250,    208,
-		 155,    153,    206,      3,
-		  56,    109,     93,     40,
-		 243,     65,    118,    171,
-		 224,    234,    181,    128,
-		 180,    233,     30,    172,
-		 119,     66,    242,     39,
-		  92,    145,     57,      4,
-		 207,    101,    101,     48,
-		 251,     57,    110,     92,
-		  39,    242,    189,    119,
-		 172,     30,    233,    180,
-		 127,    181,    234,     31,
-		  84,    137,     65,     12,
-		  40,     93,    109,    199,
-		 252,    206,    153,    155,
-		 208,    250,     58,    111,
-		 164,     38,     14,     67,
-		 120,    173,    226,     23,
-		 179,    126,     73,    235,
-		 223,    170,    117,     64,
-		  11,    214,     94,    108,
-		  55,    253,     50,    152,
-		  99,    209,    249,    196,
-		 143,     90,     37,    240,
-		  68,    134,     81,    227,
-		  24,    178,    125,    183,
-		  19,    222,    169,    116,
-		  63,     10,     42,     95,
-		 107,     54,    254,     51,
-		 104,    157,    210,      7,
-		  60,    113,    166,    219,
-		  16,     69,    133,     80,
-		 228,     25,    177,    124,
-		 184,     18,    221,     87,
-		 115,     62,    246,     43,
-		  96,    149,    202,    255,
-		  52,    105,    158,    211,
-		   8,     61,    114,    167,
-		  35,    238,     70,    132,
-		  79,     26,    229,    176,
-		 123,     70,     17,    220,
-		 167,    114,     61,      8,
-		 211,    158,    150,    203,
-		 255,    202,    149,     96,
-		  43,    246,     62,    115,
-		  87,     34,     18,     71,
-		 131,    177,    230,    228,
-		 175,    133,    186,    239,
-		  36,     89,    142,    195,
-		 248,     45,     98,    151,
-		 204,      1,    201,    148,
-		  95,     42,    245,     63,
-		 116,    169,     33,    236,
-		  72,    125,    178,    231,
-		  28,     81,    121,     68,
-		  15,    218,    165,    112,
-		  59,      6,    209,    156,
-		 103,     50,    253,    200,
-		 147,    161,    214,    244,
-		  64,    138,     85,     32,
-		 235,    182,    129,    179,
-		 232,     29,     82,    120,
-		 188,    241,     38,     91,
-		 144,    197,    250,     47,
-		 100,    153,    206,      3,
-		  56,    109,     93,     40,
-		  12,     65,    118,    171,
-		 224,     21,     74,    127,
-		 180,     22,    225,     83,
-		 119,     66,     13,    216,
-		 163,    110,     57,      4,
-		 207,    154,    154,    207,
-		   4,     57,    110,     92,
-		 216,     13,     66,    119,
-		 172,    225,     22,     75,
-		 128,    181,    234,     31,
-		  84,    137,    190,    243,
-		  40,     93,    109,    199,
-		 252,     49,    153,    100,
-		  47,    250,    197,    144,
-		  91,     38,    241,    188,
-		 135,     82,     29,    232,
-		 179,    129,     73,     20,
-		 223,    170,    117,     64,
-		  11,    214,    161,    108,
-		 200,    253,     50,    103,
-		 156,    209,      6,     59,
-		 112,    165,    218,     15,
-		  68,    121,    174,     28,
-		 231,    178,    130,    183,
-		  19,     33,     86,    139,
-		  63,     10,     42,     95,
-		 107,     54,      1,    204,
-		 151,     98,     45,    248,
-		 195,    142,     89,     36,
-		 239,     69,    122,    175,
-		  27,    230,    177,    124,
-		  71,    237,     34,    168,
-		 115,    193,    246,    212,
-		 159,    149,    202,    255,
-		  52,    105,    158,     44,
-		   8,    194,    141,     88,
-		  35,     17,     70,    132,
-		  79,    229,     26,     79,
-		 132,    185,    238,     35,
-		  88,    141,    194,    247,
-		  44,    158,    105,     52,
-		 255,    202,    149,     96,
-		  43,    246,    193,    115,
-		 168,    221,     18,     71,
-		 124,    177,    230,     27,
-		  80,    133,     69,     16,
-		 219,    166,    113,     60,
-		 248,     45,    157,    104,
-		 204,    254,    201,    148,
-		  95,     42,    245,    192,
-		 139,     86,     33,    236,
-		 183,    130,     77,     24,
-		 227,    174,    121,     68,
-		  15,    218,     90,    143,
-		 196,    249,     46,     99,
-		 152,    205,      2,     55,
-		 108,    161,    214,     11,
-		  64,    138,    170,    223,
-		  20,     73,    126,    179,
-		 232,     29,     82,    135,
-		 188,    241,     38,     91,
-		 144,    197,    250,    208,
-		 155,    102,     49,    252,
-		 199,    109,     93,     40,
-		 243,    190,    137,     84,
-		  31,    234,    181,    128,
-		  75,     22,    225,    172,
-		 119,     66,     13,    216,
-		 163,    145,    198,    251,
-		  48,    101,    101,     48,
-		   4,     57,    110,    163,
-		 216,     13,     66,    119,
-		 172,    225,     22,     75,
-		 128,    181,     21,    224,
-		  84,    137,    190,     12,
-		 215,    162,    109,     56,
-		   3,    206,    102,    155,
-		 208,    250,     58,    111,
-		  91,     38,    241,    188,
-		 135,     82,     29,    232,
-		 179,    126,     73,     20,
-		 223,    170,    117,     64,
-		 244,     41,     94,    147,
-		 200,    253,    205,    152,
-		  99,     46,    249,     59,
-		 112,    165,    218,    240,
-		 187,    121,     81,     28,
-		 231,     77,    130,    183,
-		 236,     33,    169,    116,
-		 192,    245,    213,    160,
-		 107,     54,      1,    204,
-		 151,    157,    210,      7,
-		  60,    113,    166,    219,
-		  16,    186,    133,     80,
-		  27,     25,     78,    131,
-		 184,    237,     34,     87,
-		 115,     62,      9,     43,
-		  96,    149,    202,    255,
-		  52,    105,     97,     44,
-		 247,    194,    114,    167,
-		 220,     17,     70,    123,
-		 176,    229,     26,     79,
-		 132,    185,    238,     35,
-		  88,    141,     61,      8,
-		 211,    158,    105,     52,
-		 255,     53,    106,    159,
-		 212,      9,     62,    115,
-		  87,     34,    237,    184,
-		 131,     78,     25,    228,
-		 175,    122,     69,    239,
-		  36,     89,    142,    195,
-		 248,    210,    157,    104,
-		  51,    254,    201,    148,
-		  95,    213,     10,    192,
-		 116,    169,     33,    236,
-		  72,    125,    178,    231,
-		  28,     81,    134,     68,
-		  15,    218,    165,    112,
-		  59,      6,    209,     99,
-		 152,    205,      2,     55,
-		 108,    161,    214,     11,
-		  64,    117,    170,    223,
-		  20,    182,    129,     76,
-		  23,    226,     82,    135,
-		 188,    241,    217,    164,
-		 111,     58,      5,    208,
-		 155,    102,     49,    252,
-		 199,    146,     93,     40,
-		 243,    190,    137,     84,
-		 224,     21,     74,    127,
-		 180,    233,     30,     83,
-		 136,    189,    242,     39,
-		  92,    145,    198,    251,
-		  48,    101,    101,    207,
-		   4,     57,    110,    163,
-		  39,     13,    189,    136,
-		 172,    225,     22,    180,
-		 128,    181,     21,     31,
-		  84,    137,    190,     12,
-		 215,    162,    146,     56,
-		   3,    206,    153,    100,
-		  47,      5,     59,    111,
-		 164,     38,    241,    188,
-		 134,     82,     28,    233,
-		 179,    129,    183,    234,
-		  34,     84,    139,    190,
-		 244,     41,    161,    108,
-		  54,      0,    204,    153,
-		  98,     47,    249,     58,
-		 115,    161,    222,     11,
-		  71,    120,    174,     28,
-		 230,    179,    124,     74,
-		  16,    221,    163,    121,
-		  51,      3,    222,     86,
-		 186,    226,    244,    221,
-		 133,    119,     62,    253,
-		  44,    105,    161,     35,
-		 229,    189,    122,    161,
-		 246,     28,    160,    102,
-		  97,     14,     57,    104,
-		 174,     46,     20,    206,
-		 137,    111,    197,    232,
-		  55,    157,    103,    215,
-		   6,     43,    104,    169,
-		  35,    224,    161,    155,
-		  85,     58,    242,     98,
-		 200,    162,     13,    198,
-		 183,     99,    193,    233,
-		  13,    153,     78,     59,
-		  11,     32,    116,    130,
-		 215,    215,    220,    128,
-		  87,     34,    224,    157,
-		 128,    137,    204,    236,
-		 184,    124,     84,     26,
-		  52,     66,    114,     26,
-		  20,     58,     70,    183,
-		 221,    248,    214,    129,
-		 166,    223,    240,    216,
-		 160,    127,    253,     93,
-		 107,    150,     83,      6,
-		 195,     89,    182,    146,
-		   7,    255,    175,    131,
-		 200,    236,     62,    153,
-		 115,    201,      9,    205,
-		 136,    118,      5,    252,
-		  10,     56,     85,     26,
-		 193,    160,    126,    128,
-		 172,     11,    156,     56,
-		  77,    229,      6,    127,
-		 159,     52,     16,     44,
-		 108,    110,     47,    216,
-		 225,    105,    233,    238,
-		 225,    138,    146,     95,
-		 243,     85,    126,    145,
-		  12,     60,     18,     74,
-		 150,    157,    246,    199,
-		 180,    156,    214,     13,
-		 236,    182,     77,    212,
-		  83,     19,    177,    112,
-		  55,    247,     93,     74,
-		 181,     50,    161,    160,
-		 164,    150,    240,     19,
-		 179,     92,    185,    216,
-		  34,    188,     64,      9,
-		  24,    112,     60,    145,
-		  19,    209,    205,     99,
-		 151,    238,    245,    248,
-		 191,    188,    218,      8,
-		  68,    112,    106,      1,
-		   8,     99,    118,    120,
-		  55,    227,    170,    203,
-		 171,      3,    134,    179,
-		  96,    194,     49,      8,
-		 128,     16,     11,     20,
-		  99,    115,    171,     22,
-		 249,    178,    187,    148,
-		  50,    157,    145,     81,
-		 226,    132,     20,    146,
-		  58,     46,    245,     27,
-		  43,    190,      0,    171,
-		 218,     88,    184,    209,
-		  23,    176,    146,    187,
-		 215,     25,    139,     65,
-		 109,     30,    109,     60,
-		 139,    105,     52,     47,
-		  65,    175,    255,      9,
-		 133,    211,    149,    231,
-		  22,     58,    134,     67,
-		  42,     61,    111,    145,
-		  14,     46,    197,     85,
-		 232,    251,     37,    135,
-		 177,    150,    239,    206,
-		  53,    179,     62,     43,
-		  48,      5,    123,     99,
-		  61,    237,     50,     67,
-		 164,     14,    214,    146,
-		 147,    242,    140,     18,
-		 247,     69,    182,    202,
-		  20,    117,    117,    116,
-		  78,     33,     34,    176,
-		 207,    232,    214,    158,
-		 130,    241,    255,    238,
-		 187,    115,    199,    113,
-		 124,    181,      4,     30,
-		  60,    119,    161,    176,
-		  34,    156,    173,    186,
-		 226,    251,    195,    133,
-		 105,    217,     38,     50,
-		 140,    117,     27,    247,
-		  22,     62,    117,    110,
-		 253,     93,     99,    151,
-		 241,    244,    145,     97,
-		 157,    208,     45,    167,
-		 120,     44,    247,     10,
-		 104,    113,     19,    205,
-		 208,     46,    245,     45,
-		 181,    158,    126,    185,
-		 254,     52,    181,    175,
-		  84,    255,      0,     90,
-		 118,     76,     24,     37,
-		  64,    155,     43,     17,
-		 230,    141,    164,    136,
-		 244,    253,    131,    165,
-		 222,     24,     94,    118,
-		 114,      9,     25,     94,
-		 140,    179,     24,    248,
-		 170,    159,    189,     28,
-		 216,    138,    102,    133,
-		 206,    237,    182,    152,
-		 217,      4,     43,    119,
-		  94,     57,    245,     91,
-		 117,    169,    230,    229,
-		 166,    131,    165,     24,
-		 197,    164,    109,    170,
-		 189,     61,    156,     68,
-		 219,    236,     49,    110,
-		 150,     35,    232,     42,
-		 108,    164,     34,    241,
-		 178,    136,    164,    237,
-		 250,    151,    107,    189,
-		 210,     17,    183,     73,
-		  51,    237,     51,     80,
-		 151,     56,     18,     55,
-		  76,    136,     37,    242,
-		 196,    135,     92,    203,
-		 238,    147,    182,     89,
-		 161,     93,    161,     66,
-		  94,    235,     50,    116,
-		 153,     45,     46,    223,
-		  69,    184,    207,     19,
-		 219,    146,     99,    213,
-		   9,    212,    185,    123,
-		 231,     67,    187,    198,
-		  83,    239,     19,     87,
-		 164,     70,     59,    195,
-		  71,    182,    211,     26,
-		 198,    147,    104,    219,
-		   3,    211,    163,    123,
-		 234,     73,    208,    188,
-		  93,    222,     17,     82,
-		 104,     77,     58,    243,
-		 118,    176,    177,      2,
-		 212,    169,    123,    206,
-		 244,    207,    160,    156,
-		 135,     16,    255,    131,
-		 184,    210,     14,     50,
-		 116,     67,     61,     27,
-		 120,     88,     77,      8,
-		 242,    162,    121,     70,
-		  10,    193,    181,    162,
-		 218,     32,    247,    105,
-		 151,    193,     22,    201,
-		 183,    124,    217,     37,
-		  92,    115,    170,     42,
-		 255,    176,    121,     73,
-		  52,    229,    107,    153,
-		 117,     57,     50,    120,
-		 153,    203,    252,    242,
-		 169,    157,    246,     39,
-		  62,    146,     81,     60,
-		 251,    190,    142,     91,
-		 242,     62,    181,    178,
-		  96,     23,      4,    116,
-		 168,     75,     59,    246,
-		  91,    191,    230,    246,
-		  48,    151,    107,     55,
-		 242,    220,    111,    227,
-		 245,    213,    131,    152,
-		 173,    234,     49,    106,
-		 111,    102,     26,     17,
-		  95,    133,    168,    243,
-		 198,     94,    159,     26,
-		  47,     24,     44,    159,
-		  26,    218,    192,    108,
-		 190,    197,    224,    145,
-		 142,    178,    244,     19,
-		 177,    109,     92,    232,
-		   1,     86,    111,    179,
-		 232,    223,    191,    106,
-		 202,    248,     42,    118,
-		 123,      5,    245,     44,
-		 100,    172,    220,    247,
-		 174,    141,    168,     29,
-		   9,    107,    138,     87,
-		   9,    220,    174,    128,
-		 230,    228,    207,    131,
-		  99,    199,    236,     53,
-		 134,    122,     47,     31,
-		  53,    138,    178,    201,
-		 249,    154,    125,    160,
-		 224,     30,    178,    109,
-		  77,    234,     51,     92,
-		 113,     49,     16,    201,
-		 156,    131,    238,    215,
-		 202,    191,    123,    212,
-		   4,     44,    102,     93,
-		  58,    253,     71,    107,
-		 161,    233,    230,    167,
-		 103,     75,     22,     48,
-		  99,    144,     30,     56,
-		 221,    109,    136,    232,
-		   8,    235,    186,    100,
-		 242,     19,    195,    134,
-		  69,     55,    231,     79,
-		  88,    170,     18,    249,
-		 185,    115,    180,    241,
-		  55,    164,    104,     33,
-		 248,     13,    117,    110,
-		  34,    240,    197,    145,
-		 185,    253,     14,    216,
-		 152,     68,     51,      0,
-		 100,    119,     80,      3,
-		 228,     88,    145,    174,
-		  14,    198,    189,    143,
-		 231,    222,    210,    135,
-		 115,     62,    254,     36,
-		 123,     91,     60,    248,
-		 184,    138,    161,    210,
-		  18,    176,    145,     68,
-		 244,     60,     83,    119,
-		  73,      2,    209,     75,
-		 157,     61,     15,    213,
-		 156,     96,    202,      5,
-		 194,    151,    164,    194,
-		  24,     65,    134,     65,
-		  21,     29,     65,    126,
-		 181,     20,    241,    160,
-		 137,    187,    250,     35,
-		 166,    110,    201,    234,
-		  53,    152,    111,     34,
-		 247,     56,    107,    162,
-		 218,    240,    179,    128,
-		 165,    234,     20,     77,
-		 145,    164,    224,    224,
-		 160,    103,     79,     11,
-		 215,     93,    107,     49,
-		   9,    202,    110,    156,
-		  47,      6,     42,    117,
-		 179,    220,    253,    179,
-		 137,     90,    226,     22,
-		 180,    115,     89,     30,
-		  35,     95,    130,    184,
-		 243,     32,     81,    157,
-		 203,      6,    196,    147,
-		 105,     40,      4,     57,
-		 131,     87,     37,     12,
-		  68,    126,    186,    242,
-		  28,    177,    121,     76,
-		  23,    222,     87,    114,
-		  50,      6,    221,    161,
-		 147,    196,    246,     50,
-		 106,    149,    219,      1,
-		  61,    138,     81,     47,
-		 227,    176,    131,    172,
-		 231,    229,    183,    125,
-		 190,    228,     40,     90,
-		 135,    195,     10,    213,
-		  97,    105,     60,     10,
-		 204,    147,    102,     41,
-		  14,     55,    118,     88,
-		 220,     21,     77,    119,
-		 181,     24,    226,    186,
-		 115,     68,     17,    217,
-		 160,    115,    196,    240,
-		  42,    103,    104,     60,
-		 251,     48,     99,    152,
-		 212,    240,    203,    135,
-		  94,     33,     18,     68,
-		 122,    184,    225,     24,
-		  81,    123,    186,    231,
-		  44,    167,    121,     53,
-		  12,    216,    154,    106,
-		 200,      9,     62,     98,
-		 168,    215,     11,     60,
-		 118,    169,    222,    239,
-		 179,    129,     72,     31,
-		 233,    166,    123,    191,
-		 247,     32,     94,    142,
-		 196,    253,     42,    156,
-		 101,    205,      0,    205,
-		 152,     86,     45,    246,
-		  67,    115,    168,     32,
-		  20,     75,    127,    178,
-		 238,     27,    173,    123,
-		 188,    240,    219,    167,
-		 110,     57,      1,     45,
-		 108,    159,    204,    252,
-		 196,    148,     95,    211,
-		   8,    191,    139,     84,
-		  31,    234,    180,    127,
-		 183,    237,     31,    173,
-		 117,     67,    243,     38,
-		 161,    104,     61,      4,
-		  50,    102,    154,     51,
-		 248,    198,    106,    164,
-		 222,     12,    189,    136,
-		 172,     30,    235,    176,
-		 121,     79,     21,     30,
-		 170,    119,    191,    243,
-		 213,     93,    148,    193,
-		 255,     50,     98,    154,
-		  44,    254,    193,    147,
-		  90,    217,    243,    184,
-		 134,     82,     29,     21,
-		  72,    129,     73,    234,
-		  34,     87,    136,    188,
-		  11,    213,    162,    111,
-		  53,    255,     49,    153,
-		 103,     46,      4,     57,
-		 112,    165,    218,    241,
-		 186,    120,    175,     29,
-		 229,    178,    125,    183,
-		 239,     34,    168,    118,
-		 192,    244,     43,     94,
-		 149,     52,      2,    205,
-		 151,     98,     45,    249,
-		 193,    113,    165,    217,
-		  16,     69,    123,    175,
-		 228,     25,     78,    131,
-		 185,    237,    222,    173,
-		 112,    192,    245,     41,
-		  96,    107,     52,    255,
-		  53,    107,    156,    210,
-		   8,     61,    140,     90,
-		 220,     16,    186,    129,
-		  78,    231,     24,     76,
-		 135,     70,     18,    221,
-		  90,    143,    195,    245,
-		 211,    157,    107,    203,
-		   0,     53,    106,     96,
-		  42,    247,     62,    113,
-		 170,     34,    236,    184,
-		 124,    177,    231,    228,
-		 173,    121,     68,    239,
-		  38,     91,    142,     61,
-		   6,    211,    157,    151,
-		 205,      1,    201,    107,
-		 161,     40,    241,    193,
-		 117,    168,    223,     18,
-		  73,    130,     76,     24,
-		  28,     81,    135,    185,
-		 241,    218,    164,    114,
-		  57,      5,    208,     98,
-		 153,    205,      2,     54,
-		 109,    160,    214,    244,
-		 191,    116,    168,    222,
-		  20,    183,    131,     78,
-		  22,    226,     82,    135,
-		 188,     14,    217,     91,
-		 145,    197,    250,     47,
-		 100,    153,    206,      3,
-		 198,    147,     93,    215,
-		  12,    190,    137,     84,
-		  31,     21,    181,    128,
-		 180,    232,     31,     83,
-		 118,     64,     12,     39,
-		  92,    145,    199,    251,
-		 206,    155,    154,    207,
-		   4,     57,    110,     92,
-		  39,     13,     67,    118,
-		 172,     28,    234,    180,
-		 129,    180,    232,     29,
-		  84,    116,     66,     13,
-		  41,     92,    146,     57,
-		   3,    206,    153,    101,
-		  47,      5,     58,    111,
-		 165,    216,    241,    188,
-		 120,    173,     29,     23,
-		  77,    128,     73,     21,
-		 223,    170,    117,     64,
-		 244,     41,     94,    147,
-		  55,      3,    204,    153,
-		  99,    208,      4,     59,
-		 141,     91,     36,    240,
-		  68,    121,     80,     28,
-		  25,     79,    130,     73,
-		  18,    220,    169,    137,
-		 194,    245,     42,    160,
-		 106,     55,    254,     51,
-		 104,    156,    211,      7,
-		 195,    143,     89,     36,
-		  16,    186,    122,    175,
-		  27,    230,     78,    131,
-		  71,    237,     34,     86,
-		 141,    193,      9,    213,
-		 157,    107,    202,    255,
-		  52,    150,     96,     45,
-		 247,     61,    114,    167,
-		 220,     17,     71,    123,
-		  79,     26,    229,    177,
-		 123,    185,    238,     35,
-		  88,    114,     60,      8,
-		 211,     97,    151,    202,
-		   0,    202,    149,     97,
-		  42,    246,     62,    115,
-		 168,    221,    237,    184,
-		 124,    176,    230,    228,
-		 175,    133,    186,    238,
-		  37,    166,    112,     61,
-		   6,    210,     98,    150,
-		 204,    254,    200,    148,
-		  95,    213,     11,     63,
-		 116,    169,     33,    237,
-		 183,    125,     77,     24,
-		  28,     81,    121,     69,
-		 240,     37,    165,    112,
-		 196,    249,     46,     99,
-		 152,     50,    253,     55,
-		 147,     94,     41,     11,
-		 191,    138,    170,     32,
-		 235,    182,    126,    179,
-		 232,     28,     82,    121,
-		  66,     14,     38,     91,
-		 144,     58,      5,    208,
-		 155,    153,    206,    252,
-		 199,    146,    162,    215,
-		  12,    190,    137,     84,
-		  31,     21,     74,    128,
-		  75,     22,    225,     83,
-		 136,    188,    242,    216,
-		 163,    145,    198,    251,
-		  48,    154,    101,     48,
-		 251,     57,    110,    163,
-		  39,    242,     66,    119,
-		  83,     30,     22,     75,
-		 128,     74,     21,    224,
-		 171,    137,    190,    243,
-		 215,     93,    109,     56,
-		   3,    207,    101,    100,
-		  46,      5,    196,    144,
-		  91,    217,    241,     67,
-		 120,     83,    227,     23,
-		 179,    129,     73,    235,
-		  32,    170,    117,     64,
-		 244,     41,     94,    108,
-		  55,    253,     50,    103,
-		  99,    209,      6,     59,
-		 143,     90,     37,     15,
-		  68,    134,    174,    227,
-		  24,    178,    125,    183,
-		 236,     33,    169,    116,
-		 192,    245,    213,     95,
-		 148,     54,      1,     51,
-		 151,    157,    210,    248,
-		 195,    113,     89,     36,
-		 239,     69,    122,    175,
-		 228,    230,    177,    124,
-		 184,    237,    221,    168,
-		 115,     62,      9,     43,
-		  96,    106,    202,      0,
-		 203,    105,    158,    211,
-		   8,     61,    141,     88,
-		 220,     17,    185,    132,
-		 176,     26,    229,     79,
-		 132,    185,     17,    220,
-		 167,    114,    194,    247,
-		  44,     97,    105,     52,
-		   0,     53,    149,     96,
-		 212,      9,    193,    115,
-		 168,     34,    237,    184,
-		 131,    177,    230,    228,
-		 175,    122,     69,    239,
-		  36,    166,    113,     60,
-		   7,     45,     98,    151,
-		  51,    254,    201,    148,
-		 160,    213,     10,    192,
-		 139,     86,    222,     19,
-		  72,    125,     77,     24,
-		  28,     81,    134,     68,
-		  15,    218,    165,    143,
-		 196,    249,    209,    156,
-		 152,    205,      2,     55,
-		 108,    161,     41,    244,
-		 191,    138,    170,    223,
-		  20,     73,    129,     76,
-		 232,     29,    173,    120,
-		  67,    241,    217,     91,
-		 144,    197,      5,    208,
-		 100,    153,     49,    252,
-		 199,    109,    162,    215,
-		  12,    190,    137,    171,
-		 224,     21,     74,    128,
-		  75,    233,     30,     83,
-		 136,     66,     13,     39,
-		  92,    145,     57,      4,
-		 207,    154,    101,    207,
-		   5,    198,    147,     92,
-		 217,     13,     66,    136,
-		  83,     30,    233,     75,
-		 128,    181,     21,    224,
-		  84,    137,    190,     12,
-		 215,    162,    109,    199,
-		 252,    206,    153,    155,
-		 208,      5,    197,    144,
-		 164,     38,    241,     67,
-		 120,     82,    226,    232,
-		 179,    129,    182,     20,
-		  32,    170,    117,    191,
-		 244,     41,    161,    108,
-		  55,    253,     50,    103,
-		  99,     46,      6,     59,
-		 112,    165,     37,     15,
-		 187,    121,    174,    227,
-		 231,    178,    125,    183,
-		 236,    222,    169,    139,
-		  63,     10,    213,     95,
-		 148,     54,    254,    204,
-		 104,    157,     45,      6,
-		 195,    142,    166,    219,
-		  16,    186,    133,    175,
-		 228,    230,     78,    124,
-		 184,    237,     34,    168,
-		 115,    193,    246,     43,
-		 159,    106,    202,    255,
-		 203,    105,     97,     44,
-		   8,    194,    141,    165,
-		  35,    239,     70,    122,
-		  79,    229,     27,    176,
-		 122,    185,    238,     35,
-		  88,    114,     61,    247,
-		  45,    158,    105,    203,
-		 254,     53,    106,     96,
-		  43,      9,    193,    140,
-		 168,     34,    237,     71,
-		 131,     78,    230,     27,
-		 175,    133,    186,     16,
-		 219,     89,    143,    195,
-		   7,    210,    157,    151,
-		  51,    254,     55,    107,
-		  94,     42,     11,    192,
-		 116,    168,     33,    236,
-		 183,    130,    178,    231,
-		  28,    174,    121,     68,
-		  15,     36,     90,    112,
-		  59,    249,    209,     99,
-		 103,     50,      2,     55,
-		 147,     94,    214,     11,
-		 191,    138,     85,    223,
-		  20,    182,    129,     76,
-		 232,     29,    173,    120,
-		 188,    241,    217,     91,
-		 111,    197,      5,    208,
-		 155,    153,    207,      3,
-		 199,    109,     93,    215,
-		 243,     65,    118,     84,
-		  31,     21,    181,    127,
-		 181,     22,    225,     83,
-		 119,     66,    243,    216,
-		 163,    145,     57,    251,
-		  48,    101,    101,     48,
-		   4,    198,    145,    163,
-		 216,    242,     66,    136,
-		 172,    225,     22,     75,
-		 127,     74,    234,     30,
-		 171,    119,    191,    243,
-		 214,     93,    146,     56,
-		   3,     48,    153,    100,
-		 209,      5,    197,    145,
-		  91,    216,     14,    189,
-		 135,    173,     29,     23,
-		 179,    129,    182,     21,
-		 223,     85,    117,    191,
-		 244,    214,    160,    147,
-		 200,      2,     50,    103,
-		  98,    209,      6,    196,
-		 143,     90,    218,    240,
-		  68,    120,     80,     28,
-		  24,     77,    125,     72,
-		 236,    222,     86,    139,
-		  63,    245,    213,     94,
-		 148,    201,    254,    204,
-		 151,     98,    211,      7,
-		 195,    142,    166,     36,
-		  16,     69,    133,    175,
-		  27,    230,    177,    131,
-		 184,     18,    221,    168,
-		 140,    193,      9,    212,
-		  96,    149,     53,      0,
-		 203,    150,    158,     44,
-		   8,    194,    141,    166,
-		 220,    238,    185,    123,
-		  79,     26,     26,    176,
-		 132,     70,    238,     35,
-		  88,    114,    194,    247,
-		 211,     97,    150,     52,
-		 255,    202,    106,     96,
-		 212,      9,    193,    115,
-		  87,    221,    237,     71,
-		 124,    177,    230,     27,
-		  80,    122,    186,     16,
-		 219,     89,    113,    195,
-		 248,    210,    157,    104,
-		 204,      1,     54,    148,
-		 160,     42,    245,    192,
-		 139,    169,     33,    236,
-		  72,    130,     77,    231,
-		  28,    175,    134,     68,
-		  15,     37,    164,    143,
-		 196,      6,     46,    156,
-		 103,    204,      2,    201,
-		 147,    161,    214,    244,
-		  64,    117,     85,     32,
-		  20,     72,    129,     76,
-		 232,     29,     82,    135,
-		 188,     14,    217,     91,
-		 111,     58,    250,     47,
-		 155,    102,     49,    252,
-		  56,    146,     93,    215,
-		 243,    190,    137,    171,
-		  31,     21,     74,    128,
-		  75,    233,    225,     83,
-		 119,     66,    242,    216,
-		 163,    110,    198,      4,
-		 207,    101,    101,    207,
-		 251,    198,    110,    163,
-		  39,    242,    189,    136,
-		  83,    225,     22,    180,
-		 127,    181,    234,    224,
-		  84,    137,     65,     12,
-		 214,     93,    146,     56,
-		 252,    206,    153,    100,
-		 209,      5,     58,    144,
-		  91,    217,    241,     67,
-		 120,     82,     29,    232,
-		 179,    129,    182,     20,
-		  32,    170,    116,    191,
-		 245,    214,     94,    108,
-		  55,    253,     50,    152,
-		  99,     46,    249,     59,
-		 143,     90,     37,     14,
-		  68,    121,     81,     28,
-		  24,    178,    130,    183,
-		  19,    222,     86,    139,
-		  63,    245,    213,     95,
-		 148,    201,      1,    204,
-		 104,    157,    210,      7,
-		 194,    142,    166,     36,
-		  16,     69,    132,     80,
-		  27,    230,     79,    124,
-		 184,    237,    220,    168,
-		 140,    192,      9,     43,
-		 159,    107,    202,    255,
-		  52,    105,     97,     44,
-		   8,     61,    141,    167,
-		  35,    238,    185,    123,
-		 176,    229,     26,    176,
-		 123,    185,    238,    220,
-		 167,    141,    194,      8,
-		 211,    158,    150,     52,
-		 255,     53,    106,    159,
-		  43,    246,    193,    140,
-		 169,    221,    237,    184,
-		 131,    177,    231,     27,
-		 175,    133,    186,     16,
-		  36,     89,    113,     60,
-		   7,     45,     98,    104,
-		  51,      0,     55,    107,
-		  95,     42,     10,     63,
-		 139,     86,     33,     19,
-		 183,    125,    178,     24,
-		  28,     81,    121,     69,
-		 240,     36,    164,    143,
-		 196,    249,     46,     99,
-		 103,     50,      2,     55,
-		 147,    161,    214,    244,
-		  64,    138,    170,    223,
-		 235,    182,    129,    179,
-		 232,    226,     82,    120,
-		  67,     14,    216,     91,
-		 146,    197,      4,    208,
-		 100,    153,     49,      3,
-		 199,    109,    162,     40,
-		 243,    190,    118,    171,
-		 224,    234,    181,    127,
-		 180,    233,     30,     83,
-		 136,     66,    242,     39,
-		 162,    145,    198,      4,
-		  48,    154,    101,     48,
-		   4,    198,    145,    163,
-		  39,     13,    189,    136,
-		 172,    225,    233,     75,
-		 128,     74,    234,    224,
-		 171,    137,    191,     12,
-		 214,    162,    146,    199,
-		 252,     49,    152,    155,
-		 208,    250,    197,    110,
-		 164,    217,    241,    188,
-		 121,     82,    226,    232,
-		 179,    129,    182,    235,
-		  32,     85,    116,     64,
-		 245,     41,    161,    108,
-		  55,    253,     50,    103,
-		  99,     46,      6,    196,
-		 112,    165,    218,    240,
-		 187,    134,     81,     28,
-		  24,    178,    130,    183,
-		  19,    222,    169,    139,
-		 192,     10,     42,    161,
-		 107,     54,      1,     51,
-		 104,    157,     45,    248,
-		 195,    113,     89,     36,
-		  16,     69,    133,    175,
-		 228,    230,     78,    131,
-		  71,    237,     34,     87,
-		 115,     62,    246,    212,
-		  96,    149,    202,    255,
-		 203,    150,     97,     44,
-		   8,     61,    141,     88,
-		  35,    238,     70,    123,
-		  79,     26,    229,    176,
-		 132,    185,     17,    220,
-		  88,    114,    194,    247,
-		 211,     97,    150,     52,
-		   0,     53,    149,    159,
-		 212,      9,     62,    140,
-		  87,    221,    237,    184,
-		 125,     78,     25,     26,
-		 175,    133,    186,     16,
-		  36,     89,    113,     60,
-		 248,    210,     98,    104,
-		  51,      1,     54,    148,
-		  95,    213,    245,    192,
-		 116,     86,     33,    236,
-		  72,    130,    178,     24,
-		 227,     81,    120,     68,
-		 241,    218,    165,    143,
-		  59,      6,     46,    156,
-		 103,    205,    253,     55,
-		 108,     94,    214,     11,
-		 191,    117,    170,    223,
-		 235,     73,    129,    179,
-		 232,     29,     82,    120,
-		  67,    241,     38,    164,
-		 144,     58,      5,    208,
-		 100,    102,    206,      3,
-		 199,    109,    162,     40,
-		  12,     65,    136,    171,
-		  31,    234,     74,    127,
-		  75,    233,     30,    172,
-		 136,     66,     13,     39,
-		 163,    145,    198,      4,
-		 207,    101,    101,    207,
-		   4,     57,    110,    163,
-		 216,    242,     66,    119,
-		  83,     30,    233,    180,
-		 128,    181,     21,     31,
-		 171,    118,    190,     12,
-		 215,     93,    146,     56,
-		 252,     49,    153,    155,
-		 208,    250,     58,    144,
-		  91,    217,    241,    188,
-		 120,    173,     29,     23,
-		 179,    126,    182,     20,
-		 223,     85,    117,     64,
-		 244,    214,    161,    147,
-		  55,      2,     50,    152,
-		  99,    209,    249,     59,
-		 112,     90,    218,     15,
-		 187,    134,    174,     28,
-		 231,     77,    125,     72,
-		 236,    222,    169,    139,
-		  63,     10,     42,    160,
-		 107,    201,      1,     51,
-		 104,     98,    210,      7,
-		 195,    142,    166,    219,
-		 239,     69,    133,     80,
-		 228,    230,    177,    131,
-		  71,     18,    221,    168,
-		 115,    193,      9,    212,
-		  96,    149,     53,      0,
-		 203,    150,    158,    211,
-		 247,     61,    114,    167,
-		 220,     17,     70,    123,
-		  79,     26,     26,    176,
-		 132,    185,    238,     35,
-		  88,    141,    194,      8,
-		 211,    158,    105,     52,
-		 255,     53,    106,     96,
-		 212,      9,     62,    140,
-		  87,     34,    237,    184,
-		 131,     78,     25,    228,
-		  80,    133,    186,    239,
-		 219,     89,    142,     60,
-		 248,     45,    157,    104,
-		  51,    254,    201,    148,
-		  95,    213,     10,     63,
-		 116,     86,     33,     19,
-		  72,    125,    178,    231,
-		 227,     81,    134,     68,
-		 240,     37,    165,    112,
-		  59,      6,     46,     99,
-		 103,     50,    253,    200,
-		 147,    161,    214,     11,
-		  64,    138,    170,     32,
-		 235,    182,    129,     76,
-		 232,     29,     82,    135,
-		 188,     14,     38,     91,
-		 111,     58,      5,    208,
-		 155,    153,     49,    252,
-		  56,    146,    162,    215,
-		 243,     65,    118,    171,
-		 224,     21,     74,    127,
-		  75,     22,     30,    172,
-		 136,    189,     13,    216,
-		 163,    110,     57,    251,
-		  48,    101,    154,    207,
-		   4,     57,    145,     92,
-		  39,    242,    189,    136,
-		  83,     30,     22,    180,
-		 127,    181,    234,     31,
-		  84,    118,    190,    243,
-		  40,     93,    146,    199,
-		 252,     49,    102,    155,
-		 208,      5,    197,    144,
-		 164,    217,     14,    188,
-		 135,     82,     29,    232,
-		  76,    129,    182,    235,
-		 223,    170,    117,     64,
-		 244,    214,    161,    108,
-		 200,      2,    205,    152,
-		  99,     46,    249,    196,
-		 143,     90,    218,     15,
-		  68,    134,     81,     28,
-		  24,     77,    130,    183,
-		 236,     33,     86,    139,
-		 192,    245,     42,     95,
-		 148,    201,    254,     51,
-		 104,    157,    210,      7,
-		  60,    113,    166,    219,
-		 239,     69,    133,    175,
-		 228,    230,    177,    124,
-		  71,     18,    221,    168,
-		 115,     62,    246,    212,
-		 159,    106,     53,      0,
-		 203,    150,     97,    211,
-		 247,     61,    114,    167,
-		 220,    238,    185,    123,
-		  79,     26,     26,     79,
-		 132,    185,     17,    220,
-		 167,    114,    194,    247,
-		  44,     97,    150,     52,
-		 255,    202,    149,     96,
-		  43,      9,     62,    140,
-		  87,    221,    237,    184,
-		 131,     78,    230,     27,
-		  80,    133,    186,    239,
-		  36,    166,    113,    195,
-		 248,     45,     98,    151,
-		 204,      1,    201,    148,
-		  95,     42,     10,    192,
-		 116,    169,     33,     19,
-		  72,    130,     77,     24,
-		 227,    174,    121,     68,
-		  15,    218,    165,    112,
-		  59,      6,     46,     99,
-		 152,    205,      2,     55,
-		 108,    161,    214,     11,
-		  64,    117,    170,    223,
-		  20,     73,    126,     76,
-		  23,    226,    173,    120,
-		  67,    241,    217,     91,
-		 144,    197,    250,    208,
-		 155,    102,     49,    252,
-		 199,    146,     93,     40,
-		  12,    190,    137,     84,
-		  31,    234,    181,    128,
-		  75,    233,    225,     83,
-		 136,    189,    242,     39,
-		  92,    145,    198,    251,
-		  48,    101,    154,    207,
-		   4,     57,    110,    163,
-		 216,     13,     66,    119,
-		 172,     30,     22,     75,
-		 128,    181,    234,    224,
-		  84,    118,     65,     12,
-		 215,    162,    109,     56,
-		   3,     49,    102,    155,
-		 208,      5,    197,    144,
-		  91,     38,    241,    188,
-		 135,     82,    226,     23,
-		  76,    126,     73,     20,
-		 223,    170,    138,    191,
-		 244,     41,     94,    147,
-		 200,      2,    205,    152,
-		 156,    209,      6,     59,
-		 112,    165,    218,     15,
-		  68,    121,    174,    227,
-		 231,    178,    130,     72,
-		  19,    222,    169,    116,
-		 192,    245,    213,    160,
-		 107,     54,      1,    204,
-		 151,     98,     45,      7,
-		  60,    113,    166,    219,
-		  16,    186,    133,     80,
-		  27,     25,     78,    131,
-		 184,    237,     34,     87,
-		 140,     62,    246,     43,
-		 159,    149,    202,    255,
-		  52,    105,     97,     44,
-		 247,    194,    114,     88,
-		  35,     17,    185,    132,
-		 176,     26,    229,     79,
-		 123,    185,    238,    220,
-		  88,    141,    194,      8,
-		  44,    158,    105,    203,
-		 255,     53,    106,     96,
-		 212,      9,    193,    115,
-		 168,    221,     18,     71,
-		 124,    177,    230,    228,
-		  80,    133,     69,    239,
-		 219,    166,    142,     60,
-		   7,     45,    157,    104,
-		 204,    254,    201,    107,
-		  95,    213,     10,    192,
-		 116,    169,     33,    236,
-		 183,    130,     77,     24,
-		 227,     81,    134,    187,
-		 240,     37,    165,    143,
-		 196,    249,     46,     99,
-		 152,    205,    253,    200,
-		 147,    161,     41,    244,
-		  64,    138,    170,     32,
-		 235,    182,    129,     76,
-		  23,     29,    173,    135,
-		 188,    241,    217,     91,
-		 144,     58,    250,    208,
-		 155,    153,     49,    252,
-		 199,    109,     93,     40,
-		 243,    190,    137,     84,
-		 224,     21,     74,    127,
-		 180,    233,     30,     83,
-		 136,     66,    242,     39,
-		 163,    110,    198,      4,
-		  48,    101,    101,     48,
-		   4,     57,    110,    163,
-		 216,     13,    189,    136,
-		 172,    225,    233,     75,
-		 128,     74,     21,    224,
-		 171,    137,     65,     12,
-		  40,    162,    109,    199,
-		   3,    206,    102,    155,
-		  47,      5,     58,    111,
-		 164,     38,     14,     67,
-		 120,    173,    226,    232,
-		  76,    129,     73,     20,
-		  32,     85,    138,    191,
-		  11,    214,     94,    108,
-		  55,    253,     50,    103,
-		 156,     46,    249,     59,
-		 143,     90,    218,    240,
-		 187,    121,     81,     28,
-		  24,    178,    125,    183,
-		  19,    222,     86,    116,
-		 192,    245,    213,     95,
-		 148,     54,      1,     51,
-		 151,     98,    210,    248,
-		  60,    113,     89,    219,
-		  16,    186,    122,    175,
-		  27,    230,     78,    124,
-		 184,    237,    221,    168,
-		 140,     62,    246,     43,
-		 159,    106,    202,      0,
-		 203,    150,    158,     44,
-		 247,     61,    141,     88,
-		 220,    238,    185,    123,
-		  79,     26,     26,    176,
-		 123,     70,    238,     35,
-		  88,    114,    194,    247,
-		 211,    158,    150,     52,
-		   0,     53,    149,    159,
-		 212,    246,     62,    115,
-		  87,    221,    237,    184,
-		 124,     78,     25,     27,
-		 175,    122,    186,    239,
-		 219,    166,    113,     60,
-		 248,     45,    157,    151,
-		 204,    254,     54,    107,
-		  95,    213,     10,    192,
-		 116,    169,     33,     19,
-		  72,    130,    178,    231,
-		 227,     81,    134,     68,
-		  15,     37,    165,    112,
-		  59,    249,     46,     99,
-		 152,     50,      2,    200,
-		 108,    161,    214,     11,
-		  64,    117,    170,     32,
-		 235,     73,    129,     76,
-		 232,    226,     82,    135,
-		  67,     14,     38,    164,
-		 111,    197,      5,    208,
-		 155,    102,     49,      3,
-		  56,    146,    162,     40,
-		 243,    190,    137,     84,
-		 224,    234,     74,    128,
-		  75,    233,     30,    172,
-		 136,    189,     13,    216,
-		  92,    110,    198,    251,
-		 207,    101,    154,    207,
-		   4,     57,    110,     92,
-		  39,    242,     66,    119,
-		  83,    225,     22,    180,
-		 128,    181,     21,    224,
-		  84,    118,     65,    243,
-		 215,    162,    146,    199,
-		   3,     49,    102,    100,
-		 208,    250,     58,    111,
-		  91,    217,     14,     67,
-		 120,    173,    226,    232,
-		  76,    129,     73,     20,
-		  32,     85,    117,     64,
-		  11,    214,    161,    147,
-		 200,      2,    205,    103,
-		  99,    209,    249,    196,
-		 112,     90,    218,     15,
-		 187,    134,    174,     28,
-		 231,     77,    125,    183,
-		  19,     33,     86,    116,
-		  63,    245,    213,     95,
-		 148,    201,      1,    204,
-		 104,    157,     45,    248,
-		  60,    142,     89,    219,
-		  16,    186,    122,    175,
-		  27,     25,    177,    124,
-		 184,     18,    221,     87,
-		 140,    193,    246,     43,
-		 159,    106,     53,    255,
-		  52,    150,     97,     44,
-		 247,     61,    114,     88,
-		 220,     17,     70,    132,
-		 176,     26,     26,     79,
-		 132,    185,     17,    220,
-		  88,    114,     61,    247,
-		 211,     97,    105,     52,
-		   0,     53,    149,    159,
-		 212,    246,    193,    115,
-		  87,     34,     18,    184,
-		 131,    177,     25,    228,
-		  80,    133,     69,    239,
-		  36,    167,    142,    195,
-		   7,    210,     98,    104,
-		 204,      1,     54,    107,
-		  95,    213,     10,    192,
-		 116,     86,     33,     19,
-		 183,    130,    178,    231,
-		 227,    174,    134,    187,
-		  15,     37,    165,    112,
-		 196,      6,    209,     99,
-		 152,     50,      2,     55,
-		 108,    161,    214,    244,
-		 191,    117,     85,     32,
-		 235,    182,    126,    179,
-		  23,     29,     82,    120,
-		  67,    241,    217,     91,
-		 144,     58,      5,     47,
-		 100,    153,     49,      3,
-		  56,    146,    162,    215,
-		 243,    190,    118,     84,
-		  31,     20,    181,    128,
-		 180,    233,    225,     83,
-		 119,     66,    242,     39,
-		 163,    145,    198,    251,
-		  48,    101,    154,     48,
-		   4,     57,    145,    163,
-		 216,     13,    189,    136,
-		 172,     30,     22,     75,
-		 127,    181,     21,    225,
-		  85,    137,     65,    243,
-		  40,    162,    109,    199,
-		 252,     49,    102,    100,
-		  47,      5,    197,    144,
-		 164,    217,    241,    188,
-		 135,    173,    226,    232,
-		  76,    129,    182,     20,
-		 223,     85,    138,     64,
-		 244,    214,    161,    147,
-		  55,    253,     50,    103,
-		 156,     46,    249,    196,
-		 112,     90,     37,     15,
-		 187,    134,    174,    227,
-		 231,     77,    130,     72,
-		 236,     33,     86,    117,
-		  63,    244,    213,     95,
-		 148,    201,      1,    204,
-		 104,     98,     45,      7,
-		  60,    142,     89,    219,
-		  16,    186,    122,     80,
-		  27,     25,    176,    131,
-		 184,     18,     34,     87,
-		 115,     62,      9,    212,
-		 159,    149,    202,    255,
-		 203,    150,    158,     44,
-		   8,     61,    141,     88,
-		  35,     17,    185,    132,
-		 177,     26,    229,     79,
-		 132,     70,    238,     34,
-		 167,    141,     61,      8,
-		  44,    158,    105,     52,
-		   0,    202,    106,    159,
-		  43,      9,    193,    140,
-		  87,    221,    237,    184,
-		 124,     78,     25,     26,
-		 175,    122,    186,     16,
-		 219,    166,    142,    195,
-		 248,    210,     98,    151,
-		  51,      1,     54,    148,
-		 160,     42,    245,     63,
-		 116,     86,    222,     19,
-		 183,    130,    179,     24,
-		 227,     80,    121,     68,
-		 240,    218,    165,    112,
-		  59,      4,    208,    157,
-		 102,     51,    253,    200,
-		 108,    163,    215,     10,
-		  67,    118,    169,    220,
-		  21,     73,    129,     77,
-		  22,    227,    175,    126,
-		  69,     10,    222,    163,
-		 108,     59,    252,     33,
-		 105,    149,    194,      6,
-		 197,    150,     84,     35,
-		 251,    184,    141,    169,
-		 228,     23,     76,    127,
-		  66,     29,    229,     85,
-		 128,    182,    249,     34,
-		 167,    106,     62,     10,
-		 196,    146,     99,    203,
-		  11,     43,    120,    179,
-		 216,    240,    183,    146,
-		  79,     11,    232,     71,
-		 144,    167,    248,     29,
-		 161,    126,     76,     28,
-		 213,     88,    149,    210,
-		 235,     33,    104,    152,
-		  35,    246,    208,    180,
-		 122,     40,      3,     89,
-		  99,    181,    236,    238,
-		 190,    118,     71,     25,
-		 219,     87,    131,    177,
-		 251,     38,     87,    145,
-		  54,      5,    221,    130,
-		 120,     59,      3,     35,
-		 100,    183,    209,    246,
-		 180,    129,     89,     23,
-		 230,     77,    129,    167,
-		 254,     48,     69,    130,
-		  61,     14,    217,    128,
-		  74,     45,     18,     34,
-		  74,    133,    198,     12,
-		 205,    157,     95,     42,
-		 226,     69,    120,    163,
-		 252,      1,     87,    146,
-		 184,     26,    205,    182,
-		  91,     33,     17,     40,
-		  73,    177,    223,    239,
-		 204,    183,    117,     43,
-		 251,     60,    127,    168,
-		 203,      9,     82,    106,
-		 177,     16,    244,    168,
-		 100,     91,      2,    208,
-		  78,    160,    213,    255,
-		 210,    131,     77,     60,
-		   2,     48,    120,    141,
-		 219,      6,     50,    124,
-		 164,     39,    226,    173,
-		 153,     83,     13,    235,
-		  80,    173,    159,    232,
-		  36,    168,     82,     47,
-		 242,     33,    111,    135,
-		 201,      8,     58,     96,
-		 181,    208,    230,    214,
-		 159,     65,     54,    226,
-		 190,    107,    157,    246,
-		 225,    171,    100,     88,
-		 244,     55,     85,    133,
-		 196,      5,     40,    108,
-		 131,    218,    244,    209,
-		 138,     75,     56,    251,
-		 174,    114,    128,    207,
-		 227,    182,    145,     81,
-		 234,     11,     89,    129,
-		  68,      7,     40,     67,
-		 143,    228,      1,    243,
-		 131,    104,     58,    240,
-		 211,    143,    162,    254,
-		  23,     71,    116,     65,
-		  63,    235,     83,    111,
-		  75,     19,     31,     92,
-		 144,    163,    224,    204,
-		 189,    101,     58,     13,
-		 219,    185,     65,    222,
-		  48,     33,    103,     95,
-		   5,    237,     73,     97,
-		 160,    237,    224,    181,
-		 152,    175,    252,     21,
-		 189,    106,    191,    243,
-		 192,    189,     71,     28,
-		 224,     15,     70,    156,
-		  62,    209,    219,    126,
-		 133,    206,     11,    181,
-		 135,    191,    244,     24,
-		  78,    105,     89,    227,
-		 222,    177,     89,    112,
-		  43,     13,     14,    184,
-		  49,     36,    226,    132,
-		 129,    224,     28,     49,
-		 159,     72,    211,     21,
-		  82,    127,     94,      8,
-		 230,    182,     96,    109,
-		  49,    199,    116,    193,
-		 229,      1,    242,    143,
-		 114,    233,    204,     44,
-		  99,    122,     58,     12,
-		  37,    101,    173,     40,
-		 249,    190,    140,    112,
-		  57,    250,    164,    156,
-		 254,    242,    204,    129,
-		  95,     48,    221,     19,
-		 121,    157,     35,     32,
-		  53,     73,    190,    218,
-		 249,    216,    130,     83,
-		  53,    246,    169,    139,
-		 161,    208,      0,    189,
-		  90,    100,     25,      5,
-		 106,    151,     61,     23,
-		 203,    111,    139,    211,
-		  11,    219,    181,    110,
-		  44,    226,    213,    133,
-		  95,    222,     48,     94,
-		 137,    108,     13,     23,
-		  78,    173,    167,     22,
-		 198,    172,    128,    215,
-		 239,     38,    135,     76,
-		  61,    249,    207,    157,
-		  92,     47,    243,     49,
-		 102,     84,     52,    235,
-		  66,    109,    170,    243,
-		  28,    189,    116,    179,
-		 230,     55,     94,     99,
-		  26,     19,    211,    103,
-		 101,     50,    245,    216,
-		 107,    179,    215,    250,
-		  67,    126,    163,    203,
-		  26,    182,    140,     72,
-		 229,      9,     66,    133,
-		  84,     40,    205,     88,
-		 154,    199,      6,    213,
-		 138,    110,    199,      9,
-		  57,    110,    164,    214,
-		   5,     73,    112,    168,
-		 224,     18,     71,    121,
-		  66,      2,    249,    190,
-		 139,    173,    248,    221,
-		 169,    126,     46,    251,
-		  32,    108,    152,    202,
-		   3,    198,    104,    172,
-		 211,     12,     64,    125,
-		  83,     21,    228,    164,
-		 115,    179,    254,     25,
-		 160,    120,     78,     24,
-		 212,     77,    153,    195,
-		 249,     53,    155,    159,
-		 223,     14,     57,    110,
-		 160,     35,    253,    180,
-		 129,     86,    230,     25,
-		  77,    112,     70,     29,
-		 211,    166,    143,    174,
-		 243,     45,     91,    111,
-		  53,    241,     36,     98,
-		  99,    209,    254,    195,
-		 141,    165,     45,    242,
-		  77,    125,     88,     12,
-		 237,    184,    126,    178,
-		 228,     38,     87,    116,
-		  60,    243,     39,     83,
-		 146,    202,    250,    202,
-		 159,    102,     46,    253,
-		 193,    117,     89,     34,
-		 230,    184,    122,     87,
-		  27,     29,    181,    120,
-		 177,    230,     32,     85,
-		 132,    200,    240,     41,
-		 158,     98,     63,      3,
-		  54,    106,    156,     47,
-		 254,    199,    113,    164,
-		  33,    233,    187,    132,
-		  75,    229,     30,     74,
-		 142,    183,    238,    216,
-		  94,    136,     56,     11,
-		  44,    150,    108,    200,
-		 253,    193,    106,    153,
-		  45,    244,     61,    142,
-		  95,     33,     18,    185,
-		 121,    190,    237,    231,
-		 174,    135,    184,    237,
-		  32,    167,    120,     63,
-		 248,     46,    159,    111,
-		 205,      4,     54,    149,
-		 162,     41,    255,    196,
-		 143,     83,    220,     31,
-		  66,    131,     76,     26,
-		  30,     86,    128,     71,
-		   2,    222,     89,    138,
-		 199,      2,    213,    103,
-		 159,    206,    253,    204,
-		 149,     88,     43,    247,
-		 188,    113,    163,    217,
-		  20,    182,    133,     79,
-		 234,     30,     82,    123,
-		  66,    240,     39,     90,
-		 144,     59,    249,     39,
-		 101,     96,     57,    250,
-		 196,    108,     94,     47,
-		   9,     73,    141,     80,
-		 224,     20,     72,    121,
-		 179,     21,    227,     81,
-		 140,     64,     13,     44,
-		  88,    111,    197,    249,
-		 200,    158,    155,     53,
-		 252,    196,    149,     89,
-		 216,    241,    185,    117,
-		 164,    231,     22,    180,
-		 127,    183,    235,     31,
-		  82,    140,    188,    241,
-		 214,    160,    147,    197,
-		   7,    205,    154,    110,
-		  40,    255,    194,    144,
-		 161,    217,     14,     70,
-		 125,    172,    230,     22,
-		 178,    130,    177,    232,
-		 222,     87,    136,    191,
-		 244,     41,     95,    105,
-		  62,      7,    202,    147,
-		 103,    216,    251,    206,
-		 117,    175,    218,    241,
-		  76,    121,     82,    230,
-		  17,     79,    126,    180,
-		 228,     35,    170,    117,
-		 193,     11,    208,    169,
-		 108,     50,      3,    206,
-		 146,    157,    211,      5,
-		  63,    117,    164,    218,
-		  22,     64,    121,    174,
-		 228,     27,     76,    131,
-		  70,     18,    221,    168,
-		 112,     57,     13,    208,
-		 152,    110,    202,      0,
-		 207,    104,    155,    209,
-		 247,    195,    116,    175,
-		 216,    238,     70,    121,
-		 178,    227,     27,    181,
-		 120,    185,     19,    216,
-		 161,    122,     57,     12,
-		 211,    159,    106,     52,
-		   6,     60,    107,    158,
-		 214,     11,     61,    116,
-		 174,     33,    236,     67,
-		 127,     77,     26,    228,
-		 174,    121,     67,     21,
-		 223,    163,    118,     62,
-		 252,     47,    157,    145,
-		 203,    255,    200,    109,
-		 166,    214,      9,     62,
-		 136,     86,    219,    236,
-		 177,    130,    179,     30,
-		 233,    171,    125,     67,
-		  12,     33,     93,    138,
-		 198,      6,    209,     97,
-		 145,    196,      3,    201,
-		 110,    160,     43,     11,
-		  65,    117,     84,     37,
-		 237,    178,    132,     69,
-		  18,     30,     90,    130,
-		 188,    241,     38,     91,
-		 144,    195,    253,     46,
-		 153,    152,    205,      3,
-		 199,    146,     93,     43,
-		 245,    183,    129,     93,
-		  22,     28,     94,    123,
-		  64,     30,     23,     93,
-		 142,     67,     15,    217,
-		  93,    154,    207,      6,
-		 201,    159,    154,     49,
-		 243,    204,    152,     83,
-		  40,      1,     89,    112,
-		  67,     16,     28,     88,
-		 135,     73,     21,    226,
-		 173,    143,    177,    244,
-		 212,    164,    110,     59,
-		   9,    197,    159,    104,
-		  62,     15,     27,    104,
-		  67,     40,     28,     95,
-		 125,     89,     30,     20,
-		 178,    132,    185,    236,
-		 217,    172,    139,     68,
-		  26,    217,    164,    126,
-		  56,    235,     19,    157,
-		 125,     41,     16,     27,
-		 123,     86,     41,    241,
-		  66,    119,    191,    230,
-		 224,    187,    127,     75,
-		   3,    205,    164,     97,
-		  59,    232,     61,    178,
-		 119,    201,    228,     19,
-		 100,    104,     34,    251,
-		  48,    105,    183,    218,
-		 234,    188,    128,     82,
-		  17,    243,    164,    106,
-		  71,    241,     45,    186,
-		 105,     60,    229,     11,
-		 115,     96,     39,      3,
-		  38,    112,    143,    214,
-		 244,    203,    135,     92,
-		  37,    254,    163,    155,
-		 177,    197,     23,    166,
-		  98,     71,    252,      3,
-		  77,    123,     40,     11,
-		  59,     65,    135,    206,
-		 252,    193,    158,     99,
-		  47,    249,    221,    147,
-		 168,    195,     25,    160,
-		 154,     78,    244,      0,
-		  68,    121,     81,     24,
-		  51,    124,    155,    198,
-		   4,    222,    146,    106,
-		 205,    241,    214,    182,
-		  95,    202,      7,    214,
-		 150,     83,    206,      9,
-		  95,    125,     94,     21,
-		   9,    122,    159,    191,
-		  11,    209,    169,    112,
-		 199,      8,    241,    189,
-		 100,    212,     15,    217,
-		 138,     88,    220,     30,
-		  85,    119,     69,     45,
-		   4,     97,     96,    181,
-		  17,    233,    167,    135,
-		 190,      0,    199,    134,
-		 105,    220,    234,    194,
-		 133,    110,    197,     27,
-		  44,    109,     76,     38,
-		  29,    106,    105,    168,
-		  23,    226,    179,    124,
-		 180,     25,    250,    179,
-		 116,    166,    253,    204,
-		 130,    100,    200,    237,
-		  63,     99,     98,     35,
-		   7,     21,     70,    165,
-		  45,    251,    187,    137,
-		 175,     23,    242,    146,
-		 111,    162,    240,    231,
-		 180,    100,    187,    226,
-		  62,     80,    100,     32,
-		 254,     29,     79,    156,
-		  36,    243,    193,    110,
-		 162,     33,    234,    159,
-		 150,    189,    251,    233,
-		 168,    104,    183,    248,
-		  49,     88,    116,     87,
-		   3,     14,    111,    153,
-		  58,      8,    201,    153,
-		 152,     47,    239,    227,
-		 150,    181,    198,    242,
-		 166,    148,    171,    242,
-		  21,     70,    134,     71,
-		  27,      1,    102,    133,
-		  52,      3,    214,    162,
-		 150,     55,     19,    236,
-		 138,    156,    196,      1,
-		 209,    157,     90,    209,
-		   0,     75,    126,     92,
-		  23,     14,     97,    148,
-		  79,     25,    223,    171,
-		 140,    195,      7,    203,
-		 191,    109,    223,    241,
-		 197,    129,    103,    217,
-		   5,     51,    122,     80,
-		  46,     30,    104,    102,
-		  77,     16,    225,    180,
-		 122,    186,     24,    192,
-		 133,    125,    205,    228,
-		 213,    134,    101,    205,
-		  14,     62,    111,    159,
-		  46,     12,     31,     80,
-		 174,     43,    233,    186,
-		 134,    176,     29,    242,
-		 142,     97,    185,    249,
-		  35,    180,     97,    195,
-		 240,     38,    105,    146,
-		  52,    254,     42,     78,
-		 170,     45,    246,    195,
-		 142,    170,     32,    248,
-		 170,    158,     73,    244,
-		  17,    163,    108,     71,
-		 252,     43,     95,    143,
-		  59,    251,     56,     64,
-		 137,     55,    251,    201,
-		 151,     95,    214,    251,
-		 163,    169,     91,    203,
-		   0,    188,    155,     74,
-		 228,     18,     91,    120,
-		  71,    241,     50,    127,
-		 134,     56,     15,    213,
-		 153,    157,    204,    236,
-		 220,    137,     87,    217,
-		   1,    180,    159,     80,
-		 237,     24,     78,    127,
-		 181,    232,     19,    114,
-		 147,    191,      4,    221,
-		 167,    110,    198,     15,
-		 215,    187,    117,    192,
-		  20,    205,    136,     90,
-		 215,     29,     69,    137,
-		  84,     26,      6,    109,
-		 155,    181,     30,    232,
-		 169,    141,    190,      7,
-		 195,    187,    103,    203,
-		 251,    192,    136,    101,
-		 221,     20,     62,    152,
-		  94,    218,     28,     99,
-		  98,    174,     21,    238,
-		 182,    126,     73,     29,
-		 202,    180,    112,    172,
-		 240,    207,    185,    145,
-		 219,    234,     52,    137,
-		 119,    208,     24,     19,
-		 103,     91,     43,    252,
-		 187,    127,     82,     22,
-		 243,    162,    139,    184,
-		  28,    253,    165,    132,
-		 218,    231,    211,    182,
-		 101,    195,    225,     19,
-		 122,     99,     39,    240,
-		 193,    140,     95,     46,
-		 251,    189,    105,    165,
-		   6,    206,    181,    149,
-		 167,    254,    208,    137,
-		 124,    212,    222,     53,
-		 105,    109,     56,      3,
-		  54,    146,    107,     60,
-		 245,     42,     98,     67,
-		  12,    252,     72,    101,
-		 168,     26,    255,    172,
-		 135,    152,    206,     44,
-		  90,    116,     58,      9,
-		 213,    146,    103,     48,
-		  20,     44,    146,     80,
-		   8,      9,     41,    110,
-		 162,     48,    205,    177,
-		 101,    147,    244,     25,
-		 168,    121,    185,     21,
-		 209,    169,    113,    223,
-		 239,    223,    186,    114,
-		  48,     17,     35,    111,
-		  80,     57,    241,     45,
-		 110,    164,    223,    238,
-		  75,    117,     72,     10,
-		 240,     81,    166,    167,
-		   0,    241,    178,    141,
-		 215,    236,    215,    130,
-		 112,    200,     24,     32,
-		 106,     86,     33,      3,
-		  77,    117,     68,     52,
-		   4,     99,    115,    111,
-		  48,    228,     67,    144,
-		 180,     26,    248,    182,
-		 156,    219,    239,     46,
-		 151,    111,    196,      8,
-		 196,    135,     86,    200,
-		  38,    191,    167,    116,
-		 225,      2,    106,    121,
-		 107,     61,    238,     65,
-		 148,    174,     12,    202,
-		 165,    153,    207,      3,
-		 223,    105,    185,    223,
-		 236,    217,    154,    165,
-		 207,     21,    189,    151,
-		 115,     28,      2,     91,
-		 133,     79,     18,     30,
-		  80,    118,     81,     15,
-		   8,    125,    100,     29,
-		  12,     52,    117,    141,
-		 208,    237,    221,    145,
-		 169,    208,    243,    179,
-		 128,    170,    238,     22,
-		 163,    131,    168,    248,
-		 208,    177,    114,    185,
-		 250,     57,     93,    126,
-		  46,      3,     42,    104,
-		 106,     54,    246,     62,
-		 124,    162,     46,    245,
-		  93,     99,     87,      1,
-		 232,     72,    145,    164,
-		 237,    205,    188,    117,
-		 211,    231,    214,    181,
-		 122,     51,    246,     52,
-		 108,    146,    220,    240,
-		 212,    141,    172,    216,
-		  16,     70,    123,     87,
-		  19,     31,     67,    133,
-		  65,     28,    212,    172,
-		 141,    192,    240,     61,
-		 109,    121,     46,    253,
-		  38,    100,    156,     35,
-		 226,    198,    124,    181,
-		 212,    231,    169,    131,
-		  76,     27,     24,     69,
-		 147,    168,     31,    253,
-		 168,    129,    208,    252,
-		  40,    147,    117,     63,
-		  23,     44,    104,    109,
-		  38,    241,    194,    140,
-		 174,    202,      8,     69,
-		 152,     87,     25,     15,
-		  69,    120,     93,      6,
-		 218,     73,    129,     61,
-		   9,    215,    157,    104,
-		  49,      6,     45,    113,
-		  91,     53,    230,     56,
-		  96,    166,     34,    251,
-		 173,    132,    166,    255,
-		 231,    184,    116,     68,
-		 245,     39,     95,    153,
-		 210,      0,    202,    147,
-		 147,    209,     13,    199,
-		 143,     75,     43,     26,
-		  81,    142,     71,     48,
-		 232,     64,    111,    166,
-		 231,    227,    163,    117,
-		  69,    253,     59,     80,
-		 124,     33,      9,     40,
-		 107,    157,     55,    241,
-		 214,    155,    170,    192,
-		  26,     68,    130,     88,
-		  28,     21,     76,    116,
-		 177,     31,    243,    161,
-		 118,    181,    245,    216,
-		 169,     97,    196,    230,
-		  42,    157,    115,     52,
-		   2,     61,    107,    167,
-		  37,    248,    181,    138,
-		 175,    231,    233,    179,
-		 123,    181,    225,     11,
-		  93,    122,     83,      5,
-		 214,     91,    153,    193,
-		   5,    222,    150,    100,
-		 222,      9,    196,    153,
-		  94,    223,     26,     82,
-		 134,     64,     12,    237,
-		  73,    134,    183,     17,
-		 214,    160,    113,    183,
-		 249,     46,     94,    110,
-		 201,    240,     32,    100,
-		 104,     32,    242,    194,
-		 114,    162,    216,    244,
-		 177,    139,     82,    234,
-		  18,     72,    134,    179,
-		 232,     40,     92,    139,
-		  51,      4,    221,     94,
-		 146,    201,     11,    193,
-		 144,    159,    219,      3,
-		 198,    141,    174,    202,
-		   2,     66,    130,     91,
-		  30,     25,     79,    124,
-		  68,     21,    213,    160,
-		 117,    195,    254,     42,
-		 157,    150,    204,    246,
-		  56,     97,     96,     37,
-		 254,    192,    117,    175,
-		 221,    231,    168,    137,
-		 176,    238,     18,    179,
-		 125,    186,    231,     36,
-		  91,    142,    195,     11,
-		 213,    155,    150,    207,
-		   2,    200,    159,    104,
-		 214,     15,     63,    140,
-		 169,    222,     20,     66,
-		 124,     77,     25,     26,
-		  80,    121,     64,     20,
-		 218,    162,    119,     61,
-		 252,     46,    157,    149,
-		 202,      7,     50,    107,
-		  95,     42,    246,    194,
-		 118,    170,     37,    225,
-		 187,    134,    182,    228,
-		 226,    174,    130,    189,
-		 245,     45,     93,    141,
-		  59,      6,    208,    157,
-		 102,     48,    249,    207,
-		 153,     88,     41,     10,
-		 190,    138,    175,    214,
-		  28,     76,    125,    176,
-		 233,     28,     86,    131,
-		  64,      5,    213,    172,
-		 110,    199,      5,    213,
-		 158,    153,    202,      6,
-		  59,    110,    166,    212,
-		  15,     66,    116,     84,
-		  29,    238,    176,    134,
-		  72,    233,    225,    174,
-		 117,     66,    243,     36,
-		  93,    145,    196,    248,
-		  51,    102,    153,    205,
-		 249,    192,    148,     92,
-		 218,    242,    191,    137,
-		 172,    224,     20,    180,
-		 124,     75,    233,     29,
-		  85,    137,     65,     13,
-		 213,    162,    144,    197,
-		   3,    204,    152,    100,
-		 208,      7,     59,    146,
-		  95,     39,     15,     64,
-		 121,     83,     25,    235,
-		  77,    130,    180,    234,
-		  33,     85,    117,    191,
-		 245,     43,    161,    110,
-		  51,      0,     50,    102,
-		 157,     47,    251,    199,
-		 142,    165,    216,     11,
-		  71,    123,    175,    227,
-		  25,     76,    125,     75,
-		  23,    220,     86,    116,
-		  61,      8,    215,    161,
-		 148,    203,    255,    204,
-		 104,    159,    214,      3,
-		  60,    141,     91,    219,
-		  16,    186,    132,     81,
-		  27,    230,    176,    126,
-		 184,    238,     32,     87,
-		 115,     62,    247,     41,
-		  97,    106,     52,      0,
-		  53,    104,     97,     46,
-		 245,    194,    114,     88,
-		  33,    236,    185,    121,
-		 177,     26,    229,     78,
-		 134,    185,     16,    220,
-		  89,    143,    194,     10,
-		 209,     97,    148,    202,
-		 253,    207,    150,    158,
-		 215,     11,    193,    143,
-		  84,    221,     22,     67,
-		 126,     78,     24,    228,
-		  80,    133,    186,    238,
-		 219,    165,    114,     61,
-		 248,     45,    156,    105,
-		  51,      0,     54,    107,
-		 161,    215,     11,    192,
-		 139,    169,    223,     19,
-		 183,    130,     77,     24,
-		 227,     81,    134,    187,
-		  15,    219,    164,    143,
-		 198,    251,    209,    157,
-		 103,    204,      0,     53,
-		 108,     95,     43,    244,
-		 191,    138,     84,     33,
-		 234,    180,    129,    179,
-		  23,    227,    173,    135,
-		 188,    241,     38,     90,
-		 144,    197,    250,     47,
-		 100,    153,    206,      3,
-		 199,    147,     93,     40,
-		 243,    190,    137,     84,
-		 224,     20,     72,    126,
-		 180,     22,    225,     83,
-		 136,    188,    243,    216,
-		 162,    110,     57,      5,
-		 206,    154,    154,     48,
-		 250,    199,    111,    160,
-		 217,    243,    191,    137,
-		 173,    227,     23,    180,
-		 126,     75,     21,     31,
-		  84,    119,     64,     12,
-		  40,     93,    109,     56,
-		 252,     49,    102,    155,
-		  47,    250,     58,    110,
-		 165,    217,    240,    189,
-		 120,    172,    226,    232,
-		 179,    129,    182,     20,
-		 223,     85,    138,     64,
-		  11,    214,    161,    108,
-		 200,    253,     50,    152,
-		  99,    209,      6,     59,
-		 112,     90,     37,    240,
-		 187,    121,    174,     28,
-		 230,    178,    130,    183,
-		  19,    222,     86,    138,
-		 192,     10,    213,     95,
-		 148,    201,      1,    205,
-		 151,    157,    211,      7,
-		 195,    142,     89,     36,
-		  16,     69,    133,     80,
-		  27,     25,     78,    131,
-		  71,     18,     34,     87,
-		 140,     62,      9,    212,
-		 159,    149,    202,      0,
-		 203,    150,     97,     44,
-		   8,     60,    114,     88,
-		  35,    238,     70,    122,
-		 176,     26,    229,     79,
-		 132,    185,     17,    220,
-		 167,    114,     61,      8,
-		 211,     97,    150,     52,
-		 255,     53,    106,    159,
-		 212,      9,     62,    140,
-		  87,     34,    237,    184,
-		 131,     79,     25,     27,
-		  81,    133,     69,     16,
-		 219,     89,    142,    195,
-		 248,     45,    157,    105,
-		  51,      1,     54,    107,
-		  95,     43,    245,     63,
-		 116,    169,     33,     19,
-		  72,    125,    178,     24,
-		 227,     81,    134,     68,
-		  15,    218,     90,    143,
-		  59,      6,    209,     99,
-		 152,    205,      2,     55,
-		 108,    161,    214,    244,
-		 191,    138,     85,     32,
-		  20,     73,    129,     77,
-		  23,     29,     82,    120,
-		  67,     14,     38,     91,
-		 144,    197,      5,     47,
-		 100,    153,     49,      3,
-		  56,    146,     93,    215,
-		  12,    190,    137,    171,
-		 224,     21,    181,    128,
-		 180,    233,     30,    172,
-		 119,     66,    242,     39,
-		 163,    111,     57,    251,
-		  48,    154,    100,     48,
-		   4,     57,    110,     92,
-		  39,    242,    189,    119,
-		 172,    225,     22,    180,
-		 127,     74,    234,     31,
-		  84,    137,     65,     12,
-		 215,    162,    146,    199,
-		 252,    206,    153,    155,
-		 208,      5,     58,    144,
-		  91,     38,     14,     67,
-		 120,     82,     29,     23,
-		  76,    129,     73,     20,
-		 223,     85,    117,     64,
-		  11,     41,     94,    108,
-		  55,      2,     50,    103,
-		 156,     46,    249,    196,
-		 112,    165,    218,    240,
-		 187,    134,    174,    227,
-		  24,    178,    125,     72,
-		 236,     33,     86,    139,
-		  63,    245,     42,     95,
-		 148,    201,    254,     51,
-		 151,     98,     45,      7,
-		  60,    142,     89,     36,
-		 239,     69,    122,    175,
-		 228,    230,     78,    131,
-		 184,    237,    221,    168,
-		 115,     62,    246,    212,
-		 159,    106,     53,      0,
-		  52,    105,    158,     44,
-		 247,    194,    114,    167,
-		 220,     17,    185,    132,
-		 176,    229,     26,     79,
-		 123,     70,     17,    220,
-		  88,    141,    194,    247,
-		 211,    158,    105,    203,
-		   0,     53,    149,     96,
-		  43,      9,     62,    115,
-		  87,     34,    237,    184,
-		 124,    177,    230,    228,
-		 175,    122,    186,    239,
-		  36,    166,    113,     60,
-		   7,    210,     98,    104,
-		  51,    254,     54,    107,
-		 160,    213,     10,     63,
-		 116,    169,    222,     19,
-		  72,    130,     77,     24,
-		  28,     81,    121,    187,
-		 240,    218,    165,    112,
-		 196,    249,     46,    156,
-		 103,     50,      2,     55,
-		 147,     94,     41,    244,
-		  64,    117,    170,     32,
-		 235,     73,    126,    179,
-		 232,     29,    173,    120,
-		  67,     14,     38,     91,
-		 144,     58,      5,    208,
-		 100,    153,     49,    252,
-		 199,    146,    162,    215,
-		  12,     65,    118,    171,
-		  31,    234,     74,    127,
-		 180,     22,    225,    172,
-		 136,    189,    242,    216,
-		 163,    110,     57,    251,
-		  48,    154,    154,    207,
-		   4,    198,    145,    163,
-		 216,     13,     66,    119,
-		  83,     30,     22,     75,
-		 128,    181,    234,     31,
-		  84,    137,    190,    243,
-		 215,    162,    109,     56,
-		 252,     49,    153,    100,
-		  47,    250,    197,    144,
-		  91,     38,    241,    188,
-		 135,    173,     29,    232,
-		 179,    129,    182,     20,
-		 223,    170,    138,    191,
-		 244,     41,     94,    147,
-		 200,    253,     50,    103,
-		  99,     46,    249,    196,
-		 143,     90,     37,     15,
-		 187,    134,     81,     28,
-		 231,    178,    125,     72,
-		  19,    222,    169,    116,
-		  63,     10,     42,    160,
-		 107,    201,      1,    204,
-		 151,    157,    210,      7,
-		  60,    113,    166,    219,
-		  16,     69,    122,    175,
-		 228,     25,     78,    131,
-		 184,    237,     34,     87,
-		 140,    193,    246,     43,
-		  96,    149,    202,      0,
-		 203,    150,     97,     44,
-		 247,    194,    141,     88,
-		  35,    238,    185,    132,
-		 176,    229,    229,     79,
-		 132,    185,    238,     35,
-		  88,    141,    194,      8,
-		  44,     97,    105,    203,
-		   0,    202,    106,    159,
-		  43,      9,     62,    140,
-		 168,    221,    237,     71,
-		 124,     78,    230,     27,
-		 175,    133,    186,     16,
-		  36,     89,    113,    195,
-		 248,    210,     98,    151,
-		  51,      1,    201,    148,
-		 160,    213,    245,     63,
-		 116,     86,    222,     19,
-		 183,    125,    178,     24,
-		  28,     81,    121,    187,
-		 240,    218,     90,    143,
-		  59,    249,     46,    156,
-		 152,    205,    253,     55,
-		 108,     94,    214,    244,
-		 191,    117,     85,     32,
-		 235,    182,    129,    179,
-		  23,    226,     82,    120,
-		 188,    241,    217,    164,
-		 144,     58,    250,     47,
-		 155,    153,    206,    252,
-		  56,    109,     93,     40,
-		  12,    190,    137,    171,
-		  31,    234,     74,    128,
-		  75,    233,     30,    172,
-		 136,    189,     13,     39,
-		  92,    110,    198,    251,
-		 207,    101,    154,     48,
-		   4,     57,    145,    163,
-		 216,    242,     66,    119,
-		 172,     30,     22,    180,
-		 127,    181,     21,    224,
-		  84,    118,     65,    243,
-		  40,    162,    109,    199,
-		   3,     49,    153,    155,
-		 208,    250,     58,    144,
-		  91,    217,    241,     67,
-		 135,    173,    226,     23,
-		  76,    126,    182,     20,
-		 223,     85,    117,     64,
-		 244,    214,    161,    147,
-		  55,      2,     50,    152,
-		  99,     46,    249,    196,
-		 112,    165,     37,     15,
-		  68,    134,     81,    227,
-		 231,    178,    125,     72,
-		  19,     33,     86,    116,
-		  63,    245,    213,    160,
-		 148,     54,    254,     51,
-		 151,    157,    210,    248,
-		  60,    113,     89,     36,
-		  16,    186,    133,    175,
-		  27,     25,     78,    124,
-		 184,    237,    221,     87,
-		 140,     62,      9,     43,
-		 159,    106,    202,      0,
-		 203,    105,     97,     44,
-		   8,    194,    141,    167,
-		  35,    238,     70,    132,
-		  79,    229,    229,     79,
-		 132,     70,     17,     35,
-		 167,    114,    194,      8,
-		  44,     97,    105,    203,
-		   0,    202,    106,    159,
-		  43,      9,     62,    140,
-		  87,    221,    237,     71,
-		 124,     78,     25,     27,
-		 175,    133,     69,     16,
-		  36,    166,    113,     60,
-		   7,    210,     98,    151,
-		 204,      1,    201,    107,
-		  95,     42,     10,     63,
-		 139,    169,    222,    236,
-		  72,    125,     77,    231,
-		  28,    174,    121,    187,
-		  15,    218,     90,    112,
-		  59,    249,    209,    156,
-		 103,     50,    253,    200,
-		 108,     94,     41,     11,
-		 191,    117,    170,     32,
-		 235,     73,    129,     76,
-		 232,    226,    173,    135,
-		  67,    241,     38,     91,
-		 144,    197,      5,    208,
-		 100,    102,    206,      3,
-		  56,    146,    162,    215,
-		  12,     65,    118,    171,
-		  31,    234,     74,    127,
-		 180,     22,    225,     83,
-		 119,    189,    242,    216,
-		 163,    145,     57,    251,
-		  48,    154,    101,     48,
-		 251,    198,    110,    163,
-		  39,     13,    189,    136,
-		  83,     30,    233,    180,
-		 128,     74,     21,     31,
-		  84,    137,    190,    243,
-		 215,    162,    146,     56,
-		   3,     49,    102,    100,
-		 208,      5,    197,    111,
-		 164,     38,     14,     67,
-		 135,    173,    226,    233,
-		  76,    129,     72,    235,
-		  32,    171,    138,    191,
-		  10,     41,     94,    108,
-		 200,    253,    204,    103,
-		 156,     46,      6,    196,
-		 143,    165,     37,    240,
-		  68,    121,     81,    227,
-		  24,    178,    130,    183,
-		  19,    222,     86,    116,
-		  63,    245,    213,    160,
-		 148,     54,    254,     51,
-		 104,     98,     45,    248,
-		 195,    113,     89,    219,
-		 239,    186,    133,     80,
-		 228,    230,    177,    124,
-		  71,    237,     34,    168,
-		 115,    193,      9,    212,
-		  96,    149,     53,    255,
-		 203,    150,    158,     44,
-		   8,     61,    141,     88,
-		 220,     17,    185,    123,
-		 176,     26,     26,    176,
-		 132,    185,     17,    220,
-		  88,    141,     61,    247,
-		 211,    158,    150,    203,
-		 255,    202,    106,    159,
-		  43,    246,     62,    115,
-		  87,     34,     18,     71,
-		 131,     78,    230,     27,
-		 175,    133,     69,     16,
-		  36,     89,    113,     60,
-		   7,     45,     98,    104,
-		  51,      1,    201,    148,
-		 160,     42,    245,     62,
-		 116,     86,    222,     19,
-		 183,    125,     77,    231,
-		  28,     81,    121,     68,
-		 241,    218,    165,    143,
-		  59,    249,    209,    156,
-		 103,    205,    253,    200,
-		 147,     94,    214,    244,
-		  64,    117,     85,     32,
-		 235,     73,    126,    179,
-		  23,    226,     82,    120,
-		  67,    241,     38,    164,
-		 144,     58,      5,     47,
-		 100,    102,    206,    252,
-		 199,    109,     93,    215,
-		  12,    190,    136,    171,
-		 224,    234,     74,    127,
-		  75,    233,     30,    172,
-		 119,    189,     13,     39,
-		  92,    111,    198,    251,
-		 207,    154,    154,     48,
-		   4,     56,    144,     92,
-		 217,    242,    189,    119,
-		  83,     30,     23,    180,
-		 127,    180,     21,    224,
-		  84,    118,    190,    243,
-		 215,    162,    146,    199,
-		   3,     49,    153,    155,
-		 208,    251,     58,    144,
-		 164,     38,     14,     67,
-		 135,    173,    226,    232,
-		  76,    126,     73,    235,
-		 223,     85,    138,     64,
-		  11,     41,    161,    147,
-		 200,      2,     50,    103,
-		  99,     46,      7,     59,
-		 142,    165,     37,     15,
-		  68,    121,    174,     28,
-		 231,    178,    131,     72,
-		  19,     32,    168,    139,
-		 192,     11,     42,     95,
-		 107,     54,    254,    204,
-		 151,    157,     45,    248,
-		  60,    143,    167,    219,
-		 238,     68,    133,     81,
-		 229,     25,    177,    131,
-		  71,     18,     35,    168,
-		 114,    192,    246,    212,
-		  96,    106,     53,    255,
-		 203,    150,    158,     45,
-		   8,     61,    140,    167,
-		 221,    238,    185,    123,
-		  79,     26,     27,    176,
-		 123,    185,     17,    221,
-		  89,    141,     60,    246,
-		 210,    158,    151,     52,
-		   0,     53,    149,     96,
-		 212,    246,    193,    114,
-		  87,     34,     19,    184,
-		 124,    177,     25,    228,
-		  80,    133,     68,    239,
-		  36,    166,    142,    195,
-		   7,    210,     98,    104,
-		 204,      1,    201,    107,
-		  95,     42,     10,     63,
-		 116,     86,    222,    236,
-		 183,    125,     77,     24,
-		 227,    174,    134,     68,
-		  15,     37,     90,    143,
-		  59,      6,    209,     99,
-		 103,     50,      2,    201,
-		 108,    161,     41,    244,
-		  64,    138,     85,    223,
-		 235,    182,    126,    179,
-		  23,     29,     82,    120,
-		 188,    241,     38,     91,
-		 111,    197,    250,    208,
-		 100,    153,     49,      3,
-		 199,    146,    162,     40,
-		  12,     65,    118,     84,
-		  31,     21,    181,    128,
-		 180,     22,    225,     83,
-		 136,     66,     13,    216,
-		  92,    110,     57,      4,
-		  48,    101,    101,    207,
-		   4,     57,    110,     92,
-		 216,     13,    189,    136,
-		 172,    225,    233,     75,
-		 127,     74,    234,    224,
-		  84,    118,     65,    243,
-		 215,    162,    146,    199,
-		   3,     49,    153,    100,
-		 208,      5,    197,    111,
-		 164,     38,    241,     67,
-		 135,     82,    226,     23,
-		 179,    129,     73,    235,
-		  32,     85,    117,    191,
-		 244,    214,     94,    108,
-		  55,    252,    204,    103,
-		 156,     46,    249,     59,
-		 143,     90,    218,    240,
-		  68,    121,     81,    227,
-		  24,    178,    125,    183,
-		 236,     33,    169,    116,
-		 193,     10,    213,     95,
-		 107,    201,      1,    204,
-		 151,    157,     45,    248,
-		  60,    142,     89,    219,
-		 239,    186,    122,     80,
-		  27,     25,     78,    124,
-		 184,    237,    221,     87,
-		 140,     62,    246,     43,
-		 159,    106,    202,    255,
-		 203,    105,     97,     44,
-		   8,     61,    141,     88,
-		 220,     17,    185,    123,
-		 176,    229,    229,     79,
-		 123,    185,    238,    220,
-		 167,    141,     61,    247,
-		  44,    158,    105,    203,
-		   0,    202,    106,    159,
-		  43,    246,     62,    140,
-		 168,     34,    237,     71,
-		 131,     78,    230,    228,
-		 175,    122,    187,     16,
-		  36,     89,    113,    195,
-		   7,     45,    157,    151,
-		 204,    254,    201,    107,
-		 160,     42,     10,     63,
-		 139,     86,     33,    236,
-		  72,    125,     77,     24,
-		  28,    174,    134,     68,
-		  15,    218,     90,    112,
-		  59,    248,    209,    156,
-		 152,     50,    253,     55,
-		 108,     94,     41,     11,
-		 191,    117,    170,    223,
-		 235,    182,    126,    179,
-		 232,    226,     82,    120,
-		 188,    241,     38,     91,
-		 111,     58,      5,    208,
-		 155,    102,     49,    252,
-		  56,    146,    162,    214,
-		  13,     65,    119,    169,
-		 224,     21,     74,    128,
-		  74,     23,    226,    170,
-		 114,     68,     10,    220,
-		  93,    148,    206,    246,
-		  32,    105,    157,    204,
-		 255,    204,    154,     81,
-		  44,    249,    181,    138,
-		  83,     28,     22,     89,
-		 151,    187,    228,     20,
-		 169,    122,     70,      0,
-		 199,    169,    107,     58,
-		 255,     59,    111,    156,
-		 209,    255,    200,    156,
-		 162,    215,      3,     77,
-		 116,     80,     16,    227,
-		 160,    104,     68,     22,
-		  40,     68,    157,    166,
-		 230,     45,    160,    100,
-		  47,     38,    220,    107,
-		 147,    220,     20,     60,
-		 159,     72,     46,    224,
-		 177,    125,    191,    245,
-		  15,     84,    143,     73,
-		  20,    213,    186,    111,
-		  29,     47,    214,    127,
-		 138,    210,    228,     48,
-		 131,    114,     39,    247,
-		 203,    143,    162,    203,
-		   2,     84,    117,    170,
-		  25,    231,    184,    101,
-		  89,     13,    216,     72,
-		 147,    210,    229,    213,
-		 131,    121,     49,      9,
-		 206,    107,    157,    223,
-		   4,     49,     98,    170,
-		 223,     16,    186,    146,
-		 108,     60,    239,     81,
-		 153,    182,    255,    222,
-		 185,     98,    193,     13,
-		 215,    158,    106,    206,
-		  12,     32,     75,    134,
-		 208,    254,    210,    170,
-		 123,      7,    237,    104,
-		  86,    160,    234,    239,
-		 140,    104,    186,     21,
-		 222,    165,    112,    201,
-		 234,     51,     74,    130,
-		  54,    234,    232,    190,
-		 121,     49,     30,    126,
-		  83,    168,     37,    240,
-		 154,    142,    188,    239,
-		  30,    173,    117,     71,
-		 232,     11,    119,    152,
-		  50,     32,    248,    131,
-		 125,     38,     17,     11,
-		 115,     81,     57,    225,
-		 157,    137,    183,    203,
-		 233,    164,    147,     76,
-		 244,     36,    107,    140,
-		  92,     32,    240,    189,
-		 100,     54,      5,      7,
-		  67,     99,     33,    250,
-		 212,    159,    179,    192,
-		 240,    163,    145,    168,
-		 250,     39,    115,    117,
-		  96,     58,    244,    168,
-		 139,     65,     28,     35,
-		 121,    157,     43,      3,
-		 202,    137,    100,    214,
-		  14,    208,    136,    168,
-		 199,     20,    104,    107,
-		 116,     50,     21,     66,
-		 120,     67,      2,    198,
-		  93,    186,    172,      0,
-		 222,    173,    117,    194,
-		 227,     53,    129,    107,
-		 196,     36,     43,    115,
-		 161,      8,    233,     90,
-		 107,     95,      9,    205,
-		 130,    145,    245,    245,
-		 212,    177,     86,     88,
-		 230,      2,     78,     98,
-		  33,      2,     47,    125,
-		 136,    212,    238,    203,
-		 104,    190,     54,    192,
-		 141,    181,    190,    177,
-		  41,    160,     83,    106,
-		  27,     61,    102,    155,
-		  40,     46,    211,    120,
-		 139,    194,    251,    216,
-		 134,    133,    242,    224,
-		 245,    168,    114,     35,
-		  66,     15,    144,     17,
-		  59,     24,     89,    173,
-		 152,     29,    246,    188,
-		 146,    233,    250,    212,
-		 149,    103,    193,    235,
-		 219,    166,     67,     55,
-		 226,      9,     36,    160,
-		  98,    222,    187,    105,
-		 150,    205,     26,    149,
-		  89,    180,    223,     58,
-		 166,    113,     55,      4,
-		  41,    100,    114,     20,
-		 248,    216,    157,    166,
-		 231,    215,    128,    129,
-		 179,    203,     15,     95,
-		 142,     99,     10,     52,
-		 124,    135,     68,     24,
-		 198,    170,    129,     61,
-		  16,    216,    152,     77,
-		  48,     66,     42,    166,
-		 123,    196,     26,     50,
-		  84,    165,     60,    206,
-		  88,     81,    189,     28,
-		 235,    191,    105,    179,
-		 255,    222,    171,    121,
-		  27,     53,     57,     40,
-		 147,     28,    238,     39,
-		 100,    180,    245,     12,
-		 159,    151,    189,    251,
-		 234,    185,    141,     94,
-		  16,     15,     70,    124,
-		  84,     22,    242,    191,
-		 170,    130,     13,    229,
-		 144,    149,    201,     35,
-		  29,    150,    113,     38,
-		  45,     81,    152,     90,
-		  26,    239,     65,    101,
-		 178,     15,    254,    183,
-		  92,    182,    168,     23,
-		 142,     93,    198,    252,
-		  36,     74,    131,     45,
-		 200,     58,     75,    160,
-		  54,    247,    189,    136,
-		 163,    237,    231,    148,
-		 106,     93,      7,     38,
-		  26,    114,      9,     41,
-		  35,     74,    185,    224,
-		   7,    251,    188,    143,
-		 202,    250,    195,    108,
-		  89,     39,      1,     68,
-		 136,     72,     15,    247,
-		 176,    198,    128,     48,
-		 224,    171,    151,    162,
-		 208,     57,    131,     83,
-		  58,    219,     42,    152,
-		 156,     47,    243,     56,
-		 127,    165,     48,    228,
-		 175,    166,    182,    175,
-		   9,    136,     88,    167,
-		 248,     58,     75,    114,
-		   9,     35,     63,    120,
-		 153,     54,    255,    197,
-		 144,    150,    216,    241,
-		 213,    158,    121,     42,
-		  44,    127,    147,    101,
-		  29,     22,     94,    152,
-		 182,      8,    241,    170,
-		 169,    216,    242,    214,
-		 145,    120,    203,    244,
-		  54,    153,    113,     63,
-		 233,     37,     54,    183,
-		  12,    241,     64,    113,
-		 165,    249,     25,    147,
-		  98,    170,    242,     36,
-		 167,    122,     41,     14,
-		  33,    109,    109,     59,
-		 240,    238,    152,    166,
-		 225,    226,    240,    128,
-		 172,    209,     50,     80,
-		 146,    106,     28,     12,
-		  64,    135,     68,     29,
-		 215,     93,    130,    193,
-		  11,    221,    188,    124,
-		 231,     52,    203,    179,
-		  77,     42,      1,     33,
-		 105,     85,     62,    226,
-		  68,    115,    183,    227,
-		 228,    160,    120,    179,
-		 245,    208,    171,    105,
-		  45,    216,      0,     98,
-		 120,     61,    248,     55,
-		 119,    190,    211,    238,
-		 168,    115,    165,    213,
-		  30,    179,    149,     73,
-		 225,    224,    160,    126,
-		  86,     26,      3,    112,
-		 102,     36,      1,     47,
-		 152,    141,    213,      0,
-		 210,    158,    171,    223,
-		   4,     78,    141,     66,
-		  28,     29,    185,    149,
-		  75,     29,    236,    117,
-		 171,     85,     47,     47,
-		  87,    109,    202,    233,
-		 207,    138,     99,    199,
-		   0,     62,    127,     95,
-		  48,    246,     79,    152,
-		  77,     28,    239,     76,
-		 165,    185,     55,    250,
-		  68,    153,    183,    251,
-		  42,    170,    100,    205,
-		 243,    206,     96,    151,
-		  39,    239,     58,     99,
-		  65,      2,    253,     86,
-		  73,    163,     61,    201,
-		  76,    143,    167,    253,
-		  32,    191,    100,    180,
-		 212,     37,    169,    145,
-		 200,     18,    199,    109,
-		 102,     13,    209,     57,
-		  48,    128,      5,    219,
-		 186,    115,    169,    251,
-		  10,    190,     99,     75,
-		 200,     60,    169,    115,
-		  60,     13,    211,     92,
-		 108,     45,     36,    200,
-		  92,    191,     59,    219,
-		 197,    118,    171,    206,
-		  26,    176,    156,     85,
-		 196,     57,     73,    116,
-		  74,     28,     35,     95,
-		 122,     32,     45,     56,
-		  83,    107,     28,      8,
-		  58,    148,    150,    192,
-		  11,    209,    159,    172,
-		 249,      8,     70,    131,
-		  64,     23,     26,     78,
-		 124,    100,     22,     19,
-		  75,     90,     30,    241,
-		  34,    121,    128,     61,
-		 224,    220,     96,    186,
-		 203,      3,    195,    156,
-		  71,    221,     19,    177,
-		 153,    176,    207,     17,
-		 134,     91,    178,    233,
-		  40,     70,    131,     33,
-		  42,    218,     74,    184,
-		 217,    250,    223,    155,
-		  94,     43,    241,    208,
-		 121,    143,     33,    197,
-		 147,    133,    190,    198,
-		   1,    173,     90,    109,
-		  12,      3,    122,    156,
-		 206,     22,    201,    151,
-		 152,     57,      1,      4,
-		 117,    118,      6,    252,
-		 183,    139,    130,    251,
-		 227,    145,    159,     78,
-		 254,     59,     73,    117,
-		  84,    240,     47,    177,
-		 117,    237,    205,    214,
-		 176,    113,     60,    241,
-		  32,     72,     94,      9,
-		 226,     70,    124,    165,
-		 242,    226,    160,    131,
-		 160,    233,    245,     75,
-		 169,     75,     18,    210,
-		 160,    102,    213,    227,
-		 195,    185,    116,    201,
-		   3,     45,    114,     94,
-		   4,    235,     75,    124,
-		 187,    202,     31,    145,
-		  98,     72,     29,     26,
-		 117,    153,     87,     17,
-		 219,     93,    153,    215,
-		 248,    192,    151,    159,
-		 210,      2,     27,    117,
-		  74,      6,    240,     65,
-		 122,    191,    225,    253,
-		 189,    127,     73,    224,
-		  43,    163,    110,     90,
-		   8,     56,    121,    184,
-		 193,     28,    238,    146,
-		 153,    200,     31,    199,
-		 155,     79,     42,     10,
-		  83,    116,     85,      8,
-		 253,    163,    139,    148,
-		 200,     45,    185,    111,
-		  42,    241,     48,     73,
-		 156,     35,     39,    199,
-		 125,    137,    212,    255,
-		 223,    154,    191,    254,
-		  22,    189,    130,     64,
-		   8,     29,     88,    136,
-		  79,     25,    212,    163,
-		 140,    202,    255,    212,
-		 154,    158,    211,    243,
-		 201,    159,    115,     62,
-		 245,     63,    140,    164,
-		  35,    225,    168,    130,
-		 180,    233,     13,    109,
-		 157,    184,     26,    208,
-		 183,    124,     62,    246,
-		 210,    153,    102,     56,
-		 248,    200,     99,    136,
-		 202,     18,     49,    137,
-		  68,     48,    231,    187,
-		 134,     69,     21,    227,
-		 171,    127,    186,    253,
-		  63,     64,    150,    207,
-		  14,    198,    146,     98,
-		  57,    246,    195,    154,
-		  83,     38,    240,     49,
-		 105,    182,    197,      0,
-		  78,    138,     95,      9,
-		 235,    175,    123,     73,
-		  27,    202,    175,    142,
-		 213,    239,     58,    114,
-		 147,     51,    246,    205,
-		 146,     84,     36,    253,
-		 186,    140,     81,    215,
-		  25,     78,    121,    185,
-		 227,     17,     88,    123,
-		  82,     26,    201,    171,
-		 104,     58,      7,    208,
-		  99,    158,    202,     13,
-		  47,     98,    161,    214,
-		 241,    176,    153,     83,
-		  26,    225,    190,    134,
-		  75,    234,     27,     85,
-		 128,    183,    248,     46,
-		  88,    144,     57,      1,
-		 197,    147,     96,     53,
-		 253,    197,    110,    163,
-		 220,      4,     75,    114,
-		 174,    224,    232,    177,
-		 124,    183,    232,    229,
-		 160,    122,     71,    246,
-		  37,     80,    149,    198,
-		   0,    202,    152,    154,
-		 212,      6,    199,    153,
-		  86,     33,     10,     73,
-		 127,    172,     30,    237,
-		 183,    126,    181,    238,
-		  33,    171,    116,    190,
-		 246,     41,    162,    108,
-		 204,    249,    205,    157,
-		 103,     42,    253,    197,
-		 114,    166,    219,     15,
-		  68,    123,    172,     30,
-		 230,     72,    132,    181,
-		  17,    218,    170,    118,
-		 192,    244,    212,    162,
-		 107,     55,      3,     50,
-		 109,    153,    209,      6,
-		 192,    137,     95,     36,
-		  19,     65,    126,     80,
-		  24,    229,    176,    135,
-		 189,    238,     35,    169,
-		 112,     61,     11,    215,
-		 158,    150,    201,      1,
-		 201,    151,     96,    209,
-		  14,     58,    119,    167,
-		  32,    237,     70,    132,
-		  76,     24,    231,    180,
-		 120,     71,    238,     34,
-		  93,    138,    196,    243,
-		  45,    156,    109,     55,
-		 253,    203,    149,     96,
-		  42,    244,    196,    137,
-		  87,    219,     27,     79,
-		 122,    176,     29,    227,
-		 172,    135,    190,    238,
-		 217,    163,    118,     56,
-		   7,     47,    103,    144,
-		 202,      1,    203,    148,
-		  94,     40,    244,    192,
-		 117,    168,     32,    238,
-		 181,    125,    179,    229,
-		  29,     81,    135,    185,
-		 240,    217,    161,    114,
-		 196,      6,    209,    156,
-		 102,     51,      0,     49,
-		 106,    162,    215,    244,
-		 188,    136,     84,     33,
-		 234,    183,    131,     72,
-		  19,    226,     81,    132,
-		 189,    243,     39,     91,
-		 144,    199,    255,     43,
-		 100,     98,     52,    255,
-		 197,    147,     93,    214,
-		  14,     66,    119,     86,
-		  28,    232,    180,    127,
-		 182,    234,     31,    172,
-		 117,     64,     13,     37,
-		  95,    148,    194,      5,
-		 203,    155,    101,     50,
-		 250,     56,    111,     92,
-		  37,    241,    191,    119,
-		 175,    229,     18,     72,
-		 129,     72,     17,    227,
-		 171,    136,    188,    243,
-		 213,    166,    110,     57,
-		 253,     53,    101,    155,
-		  47,      5,    197,    146,
-		  91,    217,    241,    188,
-		 121,    172,    226,     22,
-		  78,    129,     72,     21,
-		 223,     85,    136,    189,
-		  11,    213,    165,    110,
-		  55,    252,     48,    101,
-		  99,    209,      7,     58,
-		 113,    164,     37,    242,
-		 185,    121,     81,     28,
-		 231,    179,    124,     73,
-		 236,     32,     87,    138,
-		 193,    245,    213,     95,
-		 148,     55,      0,    205,
-		 150,     96,     47,    248,
-		  61,    112,    166,    218,
-		  17,     69,    120,    173,
-		 229,     25,    177,    125,
-		  70,     19,    221,    168,
-		 115,    193,      9,    212,
-		  96,    106,     53,    254,
-		  54,    104,     96,     45,
-		 246,    195,    140,    166,
-		 221,     17,     70,    122,
-		 176,     26,     26,     78,
-		 132,     70,     17,    220,
-		 165,    113,     60,    247,
-		 211,    158,    150,    201,
-		   1,     52,    106,     96,
-		 212,     11,     60,    114,
-		 168,     35,    233,    188,
-		 130,    177,    230,     25,
-		  81,    123,     71,    239,
-		  37,     88,    142,    194,
-		 249,     45,    157,    105,
-		  49,    255,     54,    107,
-		 160,     42,     10,     63,
-		 139,     86,    222,    236,
-		 183,    125,    179,     24,
-		 226,    175,    120,     68,
-		 240,     39,     88,    143,
-		  58,      6,     46,     98,
-		 152,     50,    253,    200,
-		 147,     94,     41,    244,
-		 191,    138,     85,     32,
-		  20,     72,    124,    177,
-		 232,    227,    172,    120,
-		 188,    241,     38,    164,
-		 111,     59,      7,    209,
-		 155,    152,    204,      3,
-		 199,    147,     92,     40,
-		  12,     65,    119,    170,
-		 224,    235,    180,    128,
-		 180,    233,     30,    172,
-		 119,    189,     13,    217,
-		 163,    145,    198,      4,
-		  48,    101,    154,    207,
-		   4,    198,    145,    163,
-		 217,     13,    188,    137,
-		  83,    225,     22,     75,
-		 127,     74,    234,     31,
-		  84,    118,     65,     13,
-		 215,     93,    146,     56,
-		   3,     49,    102,    155,
-		 208,      5,     58,    111,
-		 164,    217,     14,     67,
-		 120,     82,     29,     23,
-		  76,    126,     73,    235,
-		  32,     85,    138,    191,
-		  11,    214,     94,    147,
-		 200,      2,    205,    152,
-		  99,     46,    249,    196,
-		 143,     90,     37,    240,
-		  68,    121,    174,    227,
-		  24,     77,    125,     72,
-		  19,    222,    169,    139,
-		 193,    245,     42,     95,
-		 148,     54,      1,     51,
-		 104,    157,    210,      7,
-		 195,    142,     89,     36,
-		 239,     69,    122,     80,
-		  27,     25,     78,    131,
-		 184,    237,     34,    168,
-		 115,     62,    246,    212,
-		 159,    106,     53,    255,
-		  52,    105,    158,     44,
-		   8,     61,    114,     88,
-		  35,    238,    185,    123,
-		 176,     26,    228,    176,
-		 132,    185,    238,     34,
-		  88,    114,     61,    247,
-		  44,     97,    150,    203,
-		 255,    202,    149,     96,
-		  43,      9,    193,    140,
-		  87,    221,     18,     71,
-		 124,    177,     25,    228,
-		 175,    122,    186,    239,
-		 219,    166,    142,    195,
-		 248,    210,     98,    104,
-		  51,      1,     54,    107,
-		  95,     42,    245,    192,
-		 139,    169,     33,    236,
-		 183,    125,    178,    231,
-		  29,    175,    133,    184,
-		  11,    218,    164,    113,
-		  59,      6,    209,    156,
-		 103,    205,      0,     49,
-		 111,     92,     43,    247,
-		 190,    138,     84,     33,
-		 235,     72,    129,    176,
-		 236,     28,     80,    120,
-		  64,     15,    216,    165,
-		 110,     59,      5,     46,
-		 100,    102,    204,      2,
-		 198,    146,    162,     40,
-		  12,    190,    137,    171,
-		 225,    234,     74,    127,
-		  75,     22,    225,    173,
-		 119,    189,     13,    216,
-		 163,    110,    198,    251,
-		 207,    101,    155,    207,
-		 251,    199,    145,     92,
-		  39,     13,     66,    118,
-		 172,     30,    233,     75,
-		 128,     74,     21,     31,
-		 171,    119,     65,     12,
-		 215,     93,    146,    198,
-		 252,     49,    103,    100,
-		 208,      5,    196,    145,
-		  91,     38,    241,     67,
-		 120,     82,    226,     22,
-		  76,    129,     73,     20,
-		 222,    171,    117,     64,
-		 244,     41,     95,    146,
-		 200,    252,    205,    152,
-		  99,     47,    249,    196,
-		 143,     90,     37,     15,
-		  68,    121,    174,     28,
-		  24,    178,    125,    183,
-		 237,     33,     86,    139,
-		  63,    245,     42,    161,
-		 107,    201,      1,     51,
-		 105,     98,    210,      7,
-		 195,    142,    166,     36,
-		 239,     69,    133,     80,
-		 228,    230,     78,    124,
-		 184,    237,    221,    168,
-		 115,    193,    246,     43,
-		  96,    106,     53,      0,
-		 203,    150,    158,    211,
-		 247,    194,    114,    167,
-		 220,     17,     70,    132,
-		 176,     26,    229,     79,
-		 123,    185,    238,    220,
-		 167,    141,    194,      8,
-		  44,     97,    150,    203,
-		 255,    203,    107,    159,
-		  42,      9,     62,    140,
-		 168,    221,    236,    184,
-		 124,     78,    230,     27,
-		 175,    122,     69,     16,
-		 219,     89,    113,     60,
-		 248,    210,    157,    104,
-		 204,      1,    201,    107,
-		 160,     42,     10,     63,
-		 139,    169,    222,    236,
-		  72,    125,     77,     24,
-		  28,    174,    121,    187,
-		 240,     37,     90,    112,
-		  59,    249,    208,    156,
-		 152,     50,    253,     55,
-		 108,     94,    215,    244,
-		 191,    116,     85,     32,
-		  20,    182,    129,    179,
-		 232,    226,     82,    120,
-		  66,    241,    217,    164,
-		 145,     58,      4,     47,
-		 100,    102,    206,      3,
-		 199,    109,    162,     40,
-		  12,     65,    137,    171,
-		 224,    234,     74,    127,
-		  75,    233,     30,    172,
-		 119,    189,     13,    216,
-		  92,    110,     57,      4,
-		  48,    154,    154,    207,
-		 251,    198,    110,     92,
-		  39,     13,    189,    137,
-		 172,     30,    233,     75,
-		 128,     74,    234,     31,
-		 171,    137,     65,     12,
-		  40,     93,    109,     56,
-		   3,    206,    102,    155,
-		  47,    250,     58,    111,
-		  91,    217,     14,    188,
-		 120,     82,     29,     23,
-		  76,    126,     73,    235,
-		 223,    170,    117,     64,
-		 244,     41,    161,    108,
-		 200,      2,    205,    103,
-		  99,     46,      6,    196,
-		 143,    165,     37,    240,
-		  68,    134,     81,    227,
-		 231,    178,    130,     72,
-		  19,    222,     86,    139,
-		  63,    245,     42,    160,
-		 148,    201,    254,     51,
-		 151,     98,    210,    248,
-		  60,    113,    166,     36,
-		  16,    186,    122,    175,
-		  27,    230,    177,    124,
-		  71,    237,     34,    168,
-		 115,     62,      9,     43,
-		  96,    106,     53,    255,
-		 203,    105,    158,     44,
-		   8,     61,    141,     88,
-		 220,     17,    185,    132,
-		  79,     26,    229,     79,
-		 123,     70,    238,    220,
-		 167,    114,     61,      8,
-		  44,    158,    105,    203,
-		 255,    202,    106,    159,
-		  43,      9,    193,    140,
-		  87,     34,    237,     71,
-		 124,    177,    230,     27,
-		 175,    133,    186,     16,
-		  36,     89,    113,    195,
-		 248,    210,    157,    151,
-		  51,    254,     54,    148,
-		 160,    213,    245,    192,
-		 116,    169,     33,    236,
-		 183,    130,     77,    231,
-		 227,     81,    134,     68,
-		  15,     37,    165,    112,
-		  59,      6,    209,     99,
-		 103,    205,      2,    200,
-		 108,    161,     41,    244,
-		 191,    138,     85,    223,
-		  20,    182,    126,    179,
-		  23,     29,     82,    135,
-		 188,    241,    217,    164,
-		 144,    197,    250,     47,
-		 100,    153,    206,      3,
-		  56,    146,     93,     40,
-		 243,    190,    118,     84,
-		  31,     21,    181,    128,
-		 180,     22,    225,     83,
-		 136,     66,    242,     39,
-		  92,    145,    198,      4,
-		  48,    154,    101,     48,
-		 251,    198,    145,    163,
-		  39,     13,     66,    136,
-		 172,    225,    233,     75,
-		 128,     74,    234,     31,
-		  84,    137,    190,     12,
-		 215,     93,    146,    199,
-		 252,     49,    102,    100,
-		  47,    250,    197,    111,
-		  91,     38,    241,    188,
-		 120,    173,    226,    232,
-		 179,    129,     73,    235,
-		 223,     85,    117,     64,
-		  11,     41,    161,    108,
-		 200,      2,    205,    152,
-		 156,    209,      6,     59,
-		 112,    165,    218,     15,
-		  68,    121,    174,     28,
-		 231,    178,    125,     72,
-		  19,    222,    169,    116,
-		  63,     10,     42,     95,
-		 148,    201,    254,     51,
-		 104,    157,    210,      7,
-		 195,    142,    166,     36,
-		 239,    186,    133,     80,
-		  27,    230,    177,    124,
-		  71,     18,    221,    168,
-		 140,    193,    246,     43,
-		  96,    149,     53,      0,
-		  52,    150,     97,    211,
-		   8,    194,    114,    167,
-		 220,     17,     70,    132,
-		  79,     26,    229,    176,
-		 123,    185,    238,     35,
-		  88,    114,     61,      8,
-		 211,    158,    105,     52,
-		 255,    202,    149,     96,
-		  43,    246,    193,    115,
-		 168,    221,     18,     71,
-		 124,    177,    230,     27,
-		  80,    133,    186,    239,
-		  36,     89,    142,     60,
-		   7,     45,    157,    104,
-		  51,    254,    201,    107,
-		  95,     42,    245,    192,
-		 139,     86,     33,    236,
-		 183,    130,     77,     24,
-		 227,    174,    121,    187,
-		  15,    218,    165,    143,
-		 196,    249,     46,     99,
-		 152,    205,      2,     55,
-		 108,    161,    214,     11,
-		  64,    117,    170,    223,
-		  20,    182,    129,    179,
-		 232,     29,     82,    120,
-		  67,     14,    217,    164,
-		 111,     58,      5,    208,
-		 100,    153,    206,    252,
-		 199,    109,    162,     40,
-		  12,     65,    118,    171,
-		 224,    234,    181,    128,
-		  75,     22,     30,    172,
-		 119,    189,    242,     39,
-		  92,    145,    198,    251,
-		  48,    101,    101,    207,
-		   4,    198,    145,     92,
-		 216,     13,    189,    119,
-		 172,    225,     22,    180,
-		 128,     74,     21,    224,
-		 171,    118,     65,     12,
-		 215,    162,    109,     56,
-		   3,    206,    153,    100,
-		  47,      5,     58,    144,
-		 164,    217,     14,     67,
-		 120,     82,     29,     23,
-		  76,    126,     73,    235,
-		  32,     85,    138,    191,
-		 244,    214,    161,    147,
-		  55,    253,     50,    152,
-		 156,    209,      6,    196,
-		 112,     90,     37,    241,
-		  71,    114,     84,     23,
-		  31,     68,    113,     68,
-		 232,     37,    173,    113,
-		 192,    243,    215,    167,
-		 150,    203,    236,     33,
-		 129,     67,    212,     39,
-		  59,    134,     90,    216,
-		  17,    190,    124,    164,
-		  30,    238,    180,    123,
-		  79,     18,    215,    180,
-		 151,    133,    255,    144,
-		 179,    136,    226,    248,
-		 197,    158,    109,     56,
-		   0,     19,    111,     86,
-		  52,     17,     76,    126,
-		 180,     30,    240,    165,
-		 118,     67,     24,    205,
-		 120,    177,    198,     54,
-		 244,    118,    179,    218,
-		 250,    204,    155,    119,
-		 211,     34,     32,    136,
-		  69,     36,     16,     79,
-		 123,     72,     15,    251,
-		 167,    117,    168,    172,
-		  42,    140,     89,     62,
-		 242,     11,    113,    113,
-		  39,    247,     55,     97,
-		 177,    247,     25,    222,
-		 149,    164,    204,    235,
-		 186,    137,     81,     56,
-		 250,    112,    218,    182,
-		  62,    249,    163,    158,
-		 239,    216,    240,    174,
-		 119,    209,     30,     55,
-		 120,    182,     49,    233,
-		  77,    108,     83,     54,
-		 247,    175,    160,     79,
-		 175,     54,    168,    103,
-		 105,     31,     23,     28,
-		 105,      7,     41,     60,
-		  64,    100,    196,     37,
-		 197,    183,     90,    195,
-		   5,    182,    154,    119,
-		   0,    225,     89,     66,
-		 168,      2,    195,    182,
-		 154,    137,    224,    253,
-		 176,    146,     40,      7,
-		  26,     79,     98,     18,
-		   6,     44,    151,     85,
-		 221,    227,    141,    146,
-		 175,    250,     56,     81,
-		 101,    127,     16,     48,
-		 118,    124,     88,      0,
-		 223,    162,    135,    209,
-		 247,     50,    158,     98,
-		  46,      6,     58,    159,
-		  68,     61,    255,     67,
-		  83,    130,     29,    205,
-		 168,    137,    170,    255,
-		 222,    166,    110,     85,
-		 225,      0,     87,    101,
-		 203,    245,     48,    158,
-		 102,     40,    234,    209,
-		 128,     87,     37,     44,
-		 109,    134,    115,     15,
-		  12,    108,    139,     92,
-		   6,    218,     85,    130,
-		 210,    231,     41,    174,
-		 107,    217,    253,    221,
-		 141,    112,     33,    232,
-		 196,    105,    130,    211,
-		 244,    163,    113,    176,
-		 232,    239,    161,    114,
-		  66,    229,     49,     70,
-		 132,    192,    244,     44,
-		  98,    102,     59,     14,
-		 197,    131,    112,    194,
-		  44,     40,    130,     70,
-		  35,     14,     85,    128,
-		  68,      8,    233,     69,
-		 157,    182,    239,    221,
-		  92,    139,    192,     11,
-		 222,    137,    120,     58,
-		 235,     50,     77,    139,
-		  57,    239,    193,     97,
-		 165,    219,     18,    169,
-		 144,    182,    243,     23,
-		  84,    129,    184,    235,
-		  34,    166,     96,     43,
-		   8,    219,    145,    147,
-		 236,     21,    198,    128,
-		  93,    220,     25,     50,
-		 138,     88,     44,     17,
-		  68,    114,    188,    224,
-		 224,    169,    133,    188,
-		   6,    198,    189,    122,
-		  56,    240,     52,    115,
-		 104,     33,    255,     63,
-		  99,    177,     43,    226,
-		 177,    112,    167,    212,
-		  31,     78,    128,     78,
-		 238,     30,    162,    100,
-		  91,      0,    221,     74,
-		 136,    212,    250,    219,
-		 148,    108,    193,     42,
-		  33,    141,    113,     43,
-		  17,     90,    124,     85,
-		  23,    232,     76,    128,
-		  68,      0,    244,    186,
-		 117,    159,    208,    223,
-		 129,    101,    210,    236,
-		  54,    152,     97,     56,
-		 252,     61,    100,    165,
-		 219,     12,     66,    114,
-		 170,     25,    254,    173,
-		 110,     67,    250,     62,
-		  88,    103,     83,    243,
-		  34,     82,    131,    193,
-		  18,    220,    111,    143,
-		 216,    254,    192,    148,
-		 167,    215,      9,    176,
-		 158,     72,     11,     23,
-		 104,    165,     79,     55,
-		 207,     92,    154,    178,
-		 254,    214,    176,     98,
-		 193,    229,     56,    144,
-		 104,     45,     14,     50,
-		 141,     84,     54,    228,
-		 169,    115,    134,    250,
-		 247,    146,    122,    166,
-		 250,     47,     84,    122,
-		  40,      9,     62,     70,
-		 156,     63,     17,    201,
-		  97,    149,     41,    236,
-		 219,    156,    166,    192,
-		  15,     69,    156,     64,
-		 226,      8,     94,    143,
-		  70,     10,    200,     81,
-		 148,    208,    247,    216,
-		 147,    106,    205,    254,
-		 198,    128,    114,     42,
-		  28,     28,    122,     76,
-		  55,    238,     87,     99,
-		 160,     30,    243,    161,
-		 129,    182,    229,     37,
-		 163,    121,     63,    241,
-		  46,    150,    125,     35,
-		 241,     38,     67,    142,
-		  60,    235,    194,    124,
-		 189,    207,     21,    182,
-		 148,     75,    233,      8,
-		  86,    114,     74,     21,
-		  33,     90,    120,     45,
-		  21,    220,    110,    182,
-		 217,    247,    220,    152,
-		 162,    199,     18,     48,
-		 131,     67,     39,     24,
-		  71,    116,     75,     11,
-		 232,     82,    133,     78,
-		  28,    201,    172,    159,
-		 219,    246,    221,    142,
-		  98,    200,      9,     38,
-		  97,     90,     36,    244,
-		  74,    124,    175,     33,
-		 225,    186,    135,     79,
-		  29,    239,    161,    120,
-		 165,    235,    218,    177,
-		 106,    205,    242,     38,
-		 110,    155,     55,      3,
-		  51,    103,    163,     40,
-		 245,    181,    142,     87,
-		  18,    242,    166,    132,
-		 163,    204,     22,    181,
-		  97,    190,    253,     40,
-		  86,    110,     53,      1,
-		  32,    112,    159,     48,
-		 251,    207,    158,     89,
-		 216,    224,    156,    158,
-		 160,    202,     12,    186,
-		 100,     77,    227,     16,
-		  70,    131,     74,     25,
-		  44,    127,    132,     62,
-		  10,    206,    154,    104,
-		  38,    247,    210,    140,
-		  94,    252,     43,    187,
-		 166,     89,    233,     25,
-		  92,    143,     72,      0,
-		 216,     78,    170,    183,
-		  12,    209,    169,    102,
-		  49,     11,    219,    184,
-		 111,    242,     33,    193,
-		 175,     86,    221,      5,
-		  74,    119,    175,     19,
-		 225,     90,    157,    188,
-		  23,    218,    174,    127,
-		  55,      1,    193,    128,
-		  98,    236,    225,    221,
-		 138,    156,    222,      1,
-		  52,    118,     95,     52,
-		  20,    103,    100,    169,
-		  28,    224,    183,    121,
-		  66,     24,    202,    139,
-		 142,    230,    251,    201,
-		 136,    156,    219,    241,
-		  50,    145,    115,     37,
-		  28,     25,    101,    165,
-		  37,    230,    190,    128,
-		  74,     19,    253,    160,
-		 157,    174,      7,    254,
-		 167,    131,    207,    248,
-		  47,    138,    117,    207,
-		  41,     17,     99,     99,
-		  44,    251,    201,    141,
-		 168,     49,    245,     85,
-		  92,     65,     55,    239,
-		  64,    148,    172,    230,
-		 194,    142,    119,    231,
-		 212,     58,    102,     98,
-		  32,    246,    203,    148,
-		  86,     45,     28,     44,
-		 158,    121,     50,     25,
-		  81,     95,    190,      3,
-		 211,    189,    154,    151,
-		 235,     45,    163,    126,
-		  48,     15,    214,    150,
-		 148,    230,     12,    235,
-		 190,     77,     43,     29,
-		 106,    100,     78,      8,
-		 230,     88,     98,    170,
-		 229,    228,    167,    124,
-		  71,     27,    201,    125,
-		 160,     61,     43,    203,
-		 145,    101,    211,     31,
-		 215,    181,     80,    198,
-		  24,     78,    113,     93,
-		  17,     22,     88,    129,
-		  85,    225,     51,     88,
-		 104,     84,      8,    209,
-		  77,    143,     48,     47,
-		 216,    106,    140,    222,
-		  16,    197,    138,     82,
-		 200,      3,    173,    123,
-		 132,    227,    203,    167,
-		 123,     66,    252,     63,
-		 163,     94,     90,    241,
-		  36,     83,    156,     56,
-		  19,    194,    110,    153,
-		 213,     34,     32,    134,
-		  68,     34,    244,    188,
-		 109,    167,     14,    255,
-		 177,    134,    176,    239,
-		 217,    190,    101,    178,
-		 231,     41,     72,    178,
-		  62,     35,    206,     98,
-		  99,    195,     11,    209,
-		 145,     95,    214,     29,
-		  73,    129,     78,     56,
-		 238,     92,    150,    159,
-		 200,    208,    130,    102,
-		 199,    237,      8,     92,
-		  74,     40,      4,     60,
-		 113,    146,     36,    227,
-		 218,    134,     90,    223,
-		  59,     96,    137,    116,
-		   8,    228,     89,    160,
-		 178,      8,    251,    164,
-		 148,    227,    253,    216,
-		 132,    113,     49,    245,
-		  47,     75,    159,     56,
-		 236,    206,    121,    188,
-		 211,    229,    160,    159,
-		 177,    253,     10,    176,
-		 112,     84,     26,     35,
-		  68,    160,    193,     16,
-		 220,    149,    101,    199,
-		  31,     55,    137,    125,
-		  45,     24,     46,    119,
-		  87,     54,    246,    184,
-		  76,    134,    231,    242,
-		 187,    117,     66,    251,
-		  58,    165,    106,     38,
-		  12,     45,    101,    156,
-		  51,    247,    219,    104,
-		 141,    206,    246,    204,
-		 135,     68,    222,     10,
-		  67,    136,     94,     22,
-		 225,     83,    130,    187,
-		   4,    200,     82,    160,
-		 220,      4,    218,    138,
-		 124,    205,     24,     60,
-		 111,     86,     59,    228,
-		 187,    127,    187,    215,
-		 228,     75,     88,    188,
-		  18,    224,    163,     91,
-		  68,    227,    221,    161,
-		 144,     51,     21,     46,
-		  98,    152,    204,     13,
-		  17,    116,     93,     44,
-		 255,    160,    135,    166,
-		  22,    228,    183,    139,
-		  95,     21,     21,     86,
-		 141,    185,    229,     14,
-		  74,    152,     60,     28,
-		 215,    153,    152,     52,
-		 255,    212,    138,     81,
-		  39,     14,     77,    125,
-		 190,    193,      4,     76,
-		 125,     66,      7,    234,
-		 169,    126,     68,      1,
-		 195,    171,    108,    199,
-		 244,     62,    120,    187,
-		 223,    252,    213,    158,
-		  81,    220,      9,    188,
-		 136,    115,     11,    237,
-		  72,    147,    164,    249,
-		  55,     67,    131,     72,
-		   7,    221,    162,    109,
-		  49,     13,    214,    136,
-		  98,    208,      1,     48,
-		  96,    190,    248,     30,
-		 179,    146,     70,     21,
-		  30,     79,    117,     80,
-		   4,    213,    175,    130,
-		 210,    239,     52,     77,
-		 150,     51,      3,    196,
-		 157,    101,     37,    245,
-		 213,    130,     93,     33,
-		  19,     72,     96,    141,
-		 196,     23,    180,    104,
-		  83,     20,    216,    174,
-		 120,     43,     27,    222,
-		  96,    146,    193,    235,
-		  47,    126,    144,    217,
-		 240,    208,    128,     81,
-		  42,    227,    181,    139,
-		  66,     25,     30,     65,
-		 147,    161,    252,     47,
-		  90,    118,     56,      1,
-		 217,    146,    100,     58,
-		 243,    200,    105,    153,
-		 211,      0,     49,     98,
-		 162,    223,     18,    190,
-		 138,     74,     28,    237,
-		 168,    126,     71,     16,
-		 219,     91,    138,    202,
-		 244,     38,    103,    107,
-		  59,    245,    204,    149,
-		  92,     43,    247,    195,
-		 118,    173,    221,     16,
-		  76,    121,    179,    230,
-		  30,     80,    123,     66,
-		   6,    214,    163,    141,
-		 192,    248,     47,     98,
-		 156,    202,      4,     49,
-		 111,    160,    215,    245,
-		 183,    130,     86,     35,
-		 235,    183,    132,     77,
-		 233,     28,     82,    134,
-		 190,    242,     35,     94,
-		 148,     58,      6,    208,
-		 155,    103,    206,    253,
-		 194,    148,     94,     42,
-		 242,     64,    119,    171,
-		 225,     21,     74,    126,
-		 182,    236,     22,     84,
-		 137,     71,      5,    222,
-		 160,    111,    198,      5,
-		 206,    101,    155,    206,
-		   5,     57,    111,    162,
-		 219,     15,    189,    138,
-		  82,     29,    237,    183,
-		 127,    180,    233,     28,
-		  85,    118,    190,    241,
-		  41,    162,    109,     56,
-		   1,    202,    154,    100,
-		  47,    250,    196,    110,
-		 162,    223,     11,     65,
-		 135,     80,     29,     22,
-		  77,    125,     79,     18,
-		 221,    171,    117,     65,
-		   8,     43,     86,    148,
-		 204,    255,     50,    156,
-		  96,    209,      6,     59,
-		 112,     88,     44,    248,
-		 184,    120,    171,    234,
-		  16,     79,    124,     73,
-		  18,    223,     86,    137,
-		  63,      9,    215,    163,
-		 111,     55,    255,    204,
-		 105,    155,    213,      4,
-		  60,    143,     93,     39,
-		 238,     68,    123,     80,
-		  31,    226,    178,    131,
-		 188,    235,     38,     87,
-		 140,     62,     11,    214,
-		  96,    149,     53,      2,
-		 202,    151,     97,     44,
-		 247,     60,    115,    166,
-		 223,     21,     71,    133,
-		  77,     24,    231,    178,
-		 122,    185,    238,     35,
-		  89,    141,     60,     10,
-		  44,     99,    149,    207,
-		   3,    202,    150,     98,
-		  41,    244,    193,    113,
-		 171,    222,     19,    185,
-		 135,     74,     27,     26,
-		  82,    135,    187,    239,
-		 218,    164,    112,     61,
-		 248,     46,    102,    149,
-		 204,    255,    202,    144,
-		  94,    212,      8,     63,
-		 116,     87,     36,    232,
-		 183,    126,    182,    226,
-		  31,    174,    123,     70,
-		  14,    218,     90,    143,
-		 196,      6,    208,    158,
-		 101,     50,      3,     54,
-		 109,    162,    213,    244,
-		 189,    137,     87,     33,
-		  21,     74,    127,     77,
-		  20,    227,     82,    134,
-		 190,    240,     38,    164,
-		 111,     59,      4,    208,
-		 155,    102,     48,    252,
-		  57,    108,    162,    214,
-		  13,     65,    119,    171,
-		  31,    234,    181,    129,
-		  74,     23,    224,    173,
-		 119,    188,    243,     38,
-		  93,    145,     57,    251,
-		  48,    154,    101,     48,
-		 251,    198,    145,     92,
-		  39,    243,    189,    118,
-		 173,    224,     20,     74,
-		 127,     74,     20,    226,
-		 168,    119,    191,    242,
-		  40,    163,    109,    199,
-		 253,     48,    102,    154,
-		 210,      4,     58,    145,
-		  88,     37,    242,    189,
-		 120,    172,    226,     23,
-		 179,    129,    183,    233,
-		  34,     86,    136,     64,
-		  10,    212,    163,    110,
-		  53,      3,    205,    103,
-		  99,     46,    249,     59,
-		 112,    167,    217,     12,
-		  70,    121,     81,     30,
-		 227,    177,    125,    183,
-		 236,     32,    169,    117,
-		  63,    245,     43,     93,
-		 150,    203,    255,    204,
-		 149,     96,     47,    249,
-		 195,    112,    167,    219,
-		 239,    187,    132,     80,
-		 229,     27,     76,    131,
-		  71,     19,    223,    170,
-		 114,     62,    246,     42,
-		  97,    149,     53,      1,
-		 203,    105,    156,    210,
-		   8,    194,    114,     88,
-		  34,    238,    185,    133,
-		  79,    229,     27,     79,
-		 132,     70,     17,     35,
-		  88,    143,     61,    243,
-		  46,    152,    151,     55,
-		   0,    202,    104,    154,
-		  45,    247,    192,    114,
-		 169,     35,     19,    185,
-		 124,     79,    230,    228,
-		 172,    133,     69,     16,
-		  37,     91,    113,    195,
-		   7,    210,     99,    104,
-		 204,    254,    201,    107,
-		 160,    212,    245,     63,
-		 139,     86,    223,     19,
-		  74,    131,     76,    231,
-		 226,     81,    135,    185,
-		 240,    219,     91,    112,
-		  59,      7,    211,     99,
-		 101,     50,      3,    200,
-		 147,     94,    214,    246,
-		  67,    138,     85,    220,
-		 238,    182,    127,    179,
-		  22,     31,    173,    121,
-		 191,     14,     39,     90,
-		 111,     58,      5,     47,
-		 155,    155,     49,    253,
-		  57,    109,    162,     40,
-		  14,    191,    119,    171,
-		  31,     20,    181,    127,
-		  75,    232,    224,     83,
-		 137,     64,     13,    217,
-		 162,    110,    198,      4,
-		 207,    154,    101,     48,
-		   6,     57,    110,    163,
-		  39,    243,    189,    137,
-		  82,    225,    232,    180,
-		 128,     74,    235,     29,
-		  84,    118,    190,     12,
-		  41,     92,    146,     56,
-		   3,    206,    102,    155,
-		 209,      4,    197,    144,
-		  91,     38,     14,     67,
-		 120,    173,     29,    232,
-		  76,    126,     73,    235,
-		 222,    171,    138,     65,
-		 244,     40,    161,    108,
-		 201,      3,    205,    103,
-		  98,    209,    249,    196,
-		 112,     90,     36,     15,
-		  68,    134,    174,    227,
-		  24,     77,    131,     72,
-		  19,    222,    169,    139,
-		 192,    244,     42,    161,
-		 106,    201,    254,     51,
-		 105,    157,     45,    249,
-		 195,    112,     88,    218,
-		  16,    184,    122,    175,
-		  26,     25,    177,    124,
-		 186,     18,    221,     87,
-		 115,     62,    247,     43,
-		 159,    149,     52,      0,
-		  52,    150,    159,    211,
-		 246,     61,    141,     89,
-		 222,     17,    184,    123,
-		  78,     26,     26,    176,
-		 133,    184,     16,    220,
-		  89,    112,    194,    245,
-		 211,     97,    105,     52,
-		   0,    202,    149,    158,
-		 212,    246,     63,    115,
-		  87,     34,     18,    184,
-		 131,    177,    230,     27,
-		 174,    122,    187,     17,
-		  36,     88,    113,    194,
-		   7,    211,     98,    104,
-		 204,      0,     54,    148,
-		 160,     43,    244,     63,
-		 139,    168,    223,    236,
-		  72,    130,     76,    231,
-		  29,    175,    135,    186,
-		  14,     36,     90,    113,
-		 196,    249,    208,     99,
-		 103,     50,      2,     55,
-		 147,     94,     41,    245,
-		  65,    117,     85,    222,
-		 234,    183,    126,     76,
-		 232,     29,    173,    135,
-		  67,     14,    217,     91,
-		 111,    197,    251,    209,
-		 100,    153,     49,      3,
-		 199,    109,    162,    215,
-		  13,     65,    136,     85,
-		  30,    235,     74,    126,
-		 180,    233,    225,    173,
-		 136,     66,     13,     39,
-		 163,    110,    198,    251,
-		 207,    154,    154,     48,
-		 251,     57,    145,    163,
-		  39,    242,     66,    136,
-		  83,    225,    233,    180,
-		 127,     74,     21,    224,
-		  84,    118,    190,    243,
-		 215,    162,    109,    199,
-		 252,     49,    102,    100,
-		 208,    250,    197,    144,
-		  91,     38,     14,     67,
-		 120,    173,     29,    232,
-		 179,    126,     73,    235,
-		  32,     85,    138,     64,
-		  11,    214,    161,    108,
-		 200,    253,     50,    152,
-		  99,     46,    249,     59,
-		 112,    165,     37,     15,
-		  68,    134,    174,     28,
-		  24,     77,    130,    183,
-		 236,    222,    169,    116,
-		  63,    245,     42,    160,
-		 148,    201,      1,     51,
-		 104,     98,     45,      7,
-		 195,    113,    166,     36,
-		 239,     69,    133,    175,
-		 228,    230,     78,    131,
-		  71,    237,     34,    168,
-		 140,     62,      9,     43,
-		  96,    106,    202,      0,
-		 203,    105,     97,    211,
-		   8,    194,    141,    167,
-		  35,     17,     70,    132,
-		  79,     26,    229,    176,
-		 132,     70,     17,    220,
-		 167,    141,    194,      8,
-		  44,    158,    105,     52,
-		   0,     53,    106,    159,
-		  43,      9,    193,    140,
-		 168,    221,     18,     71,
-		 131,     78,    230,     27,
-		 175,    133,    186,     16,
-		  36,     89,    113,    195,
-		   7,    210,     98,    104,
-		  51,      1,     54,    148,
-		 160,    213,    245,    192,
-		 139,     86,    222,    236,
-		 183,    130,     77,     24,
-		 227,     81,    121,    187,
-		 240,    218,     90,    143,
-		 196,    249,     46,    156,
-		 103,    205,      2,     55,
-		 108,    161,     41,     11,
-		  64,    117,    170,    223,
-		 235,    182,    129,     76,
-		 232,     29,    173,    135,
-		 188,     14,     38,    164,
-		 111,     58,    250,     47,
-		 155,    153,     49,    252,
-		 199,    146,    162,     40,
-		 243,     65,    137,     84,
-		 224,    234,    181,    127,
-		  75,    233,     30,    172,
-		 119,    189,     13,    216,
-		  92,    145,    198,    251,
-		 207,    154,    154,    207,
-		   4,     57,    110,     92,
-		 216,     13,    189,    119,
-		 172,    225,     22,     75,
-		 128,     74,    234,    224,
-		  84,    137,    190,     12,
-		 215,    162,    109,     56,
-		   3,     49,    153,    100,
-		  47,    250,     58,    111,
-		 164,     38,    241,    188,
-		 135,     82,     29,     23,
-		  76,    126,     73,    235,
-		  32,     85,    138,     64,
-		  11,    214,    161,    147,
-		 200,      2,     50,    103,
-		  99,    209,    249,    196,
-		 143,     90,     37,     15,
-		  68,    121,    174,     28,
-		 231,     77,    125,    183,
-		 236,    222,    169,    116,
-		  63,     10,     42,    160,
-		 148,    201,      1,    204,
-		 151,     98,    210,    248,
-		 195,    142,     89,    219,
-		  16,    186,    133,    175,
-		 228,     25,     78,    131,
-		 184,     18,    221,     87,
-		 140,    193,    246,     43,
-		  96,    149,     53,    255,
-		  52,    105,    158,    211,
-		   8,    194,    141,     88,
-		  35,    238,    185,    132,
-		  79,    229,     26,     79,
-		 123,     70,     17,    220,
-		  88,    141,    194,    247,
-		  44,     97,    105,     52,
-		 255,     53,    149,     96,
-		  43,    246,    193,    140,
-		 168,    221,     18,     71,
-		 131,     78,     25,     27,
-		 175,    133,    186,    239,
-		  36,     89,    142,    195,
-		 248,     45,    157,    151,
-		 204,    254,    201,    148,
-		  95,     42,    245,    192,
-		 139,     86,     33,     19,
-		  72,    125,    178,    231,
-		  28,     81,    134,    187,
-		 240,     37,     90,    112,
-		  59,    249,     46,     99,
-		 152,    205,      2,     55,
-		 108,    161,     41,    244,
-		 191,    138,     85,     32,
-		 235,    182,    129,     76,
-		  23,     29,     82,    135,
-		  67,    241,     38,     91,
-		 144,    197,      5,    208,
-		 155,    102,     49,      3,
-		  56,    109,    162,    215,
-		  12,     65,    137,     84,
-		  31,    234,    181,    128,
-		  75,     22,    225,    172,
-		 119,     66,     13,    216,
-		 163,    145,    198,    251,
-		  48,    101,    101,     48,
-		 251,    198,    145,     92,
-		 216,     13,     66,    119,
-		  83,     30,    233,    180,
-		 127,     74,    234,     31,
-		  84,    137,    190,    243,
-		  40,     93,    146,     56,
-		 252,     49,    153,    100,
-		  47,    250,    197,    144,
-		  91,     38,    241,    188,
-		 135,     82,     29,     23,
-		  76,    129,    182,    235,
-		  32,     85,    138,    191,
-		 244,    214,    161,    108,
-		  55,      2,    205,    152,
-		  99,     46,      6,     59,
-		 112,    165,    218,     15,
-		  68,    121,    174,    227,
-		  24,     77,    125,     72,
-		  19,    222,    169,    116,
-		  63,     10,    213,    160,
-		 107,    201,    254,     51,
-		 104,    156,    211,      6,
-		  61,    112,    166,    219,
-		  16,    186,    133,     81,
-		  26,    231,    179,    125,
-		  70,     19,    221,     87,
-		 140,    192,    244,     41,
-		  98,    151,    200,    253,
-		  53,    105,     97,     45,
-		 245,    192,    142,     91,
-		  32,    237,    187,    133,
-		  79,    229,     27,     77,
-		 134,    186,    237,     33,
-		  90,    140,    195,    247,
-		 211,    158,    104,     53,
-		 253,    200,    151,     98,
-		  41,    247,    192,    140,
-		 168,    220,     19,     69,
-		 126,    179,    231,     26,
-		  81,    132,    187,    238,
-		  36,     89,    142,     60,
-		   6,    208,    159,    107,
-		  48,    252,    203,    149,
-		  95,    213,     11,     62,
-		 118,    171,    220,     17,
-		  74,    126,    177,    228,
-		  31,     80,    134,     69,
-		  12,    223,    163,    118,
-		  62,      2,    210,    158,
-		 103,    205,      3,     53,
-		 110,    162,    213,     15,
-		  68,    112,    172,    218,
-		  17,     74,    127,     77,
-		  20,    228,    165,    113,
-		  75,      9,    223,    160,
-		 109,     58,    251,     44,
-		 103,    154,    205,      0,
-		  59,    104,    164,    208,
-		  11,     70,    112,    175,
-		 225,    232,    178,    138,
-		  70,     27,    237,    166,
-		 112,     70,     12,     38,
-		  88,    148,    195,    255,
-		  52,     97,    156,    199,
-		  14,     51,    100,    171,
-		 222,     15,    188,    142,
-		  88,     16,    230,    187,
-		 114,     64,     18,    227,
-		  84,    138,    184,    244,
-		  47,     90,    149,    207,
-		 245,     56,    111,    146,
-		 215,      0,     56,    145,
-		  93,     45,    255,    172,
-		 150,     66,     16,    226,
-		 181,    127,    181,    236,
-		  42,     94,    129,    180,
-		 254,     35,     84,    154,
-		 192,    250,     54,    102,
-		  97,     41,    245,    203,
-		 158,     75,     53,    253,
-		 177,    128,     80,    224,
-		  16,     70,    142,    187,
-		 231,     43,     92,    130,
-		 200,    242,     47,     92,
-		 149,     52,      7,    198,
-		 153,    114,     61,    247,
-		 207,    135,     95,     38,
-		  18,     66,    112,    163,
-		 232,     18,     69,    137,
-		 177,    229,     37,     82,
-		 143,    192,      8,    209,
-		 150,    103,     37,     17,
-		 219,    152,    109,     36,
-		 243,     61,    119,    174,
-		 208,     29,     74,    119,
-		 187,    238,     16,     70,
-		 131,    188,    236,    220,
-		 163,    123,     48,     24,
-		 194,    142,    102,     56,
-		 246,    207,    149,    155,
-		 220,      2,     51,    126,
-		 165,    209,     25,     77,
-		 117,    182,    227,     25,
-		 175,    121,     66,     28,
-		 212,    180,     96,     44,
-		   9,    217,    154,    106,
-		 206,      9,     58,    101,
-		 174,    216,      6,     52,
-		 126,    161,    216,     23,
-		  74,    125,     79,     30,
-		 233,    160,    104,     86,
-		  31,    212,    174,    119,
-		  56,    248,     41,    104,
-		 150,    194,     12,     59,
-		 103,    171,    222,     13,
-		  68,    119,    170,     33,
-		 239,    190,    141,     67,
-		   6,    243,    162,    117,
-		  74,     11,    216,     95,
-		 153,    200,    245,     32,
-		 106,    149,    196,     11,
-		  62,    105,    160,    215,
-		 243,    188,    140,     93,
-		  18,    250,    167,    145,
-		  69,     26,    233,    168,
-		 137,    187,    254,     40,
-		  77,    129,    200,    240,
-		  57,     99,    158,    205,
-		   5,    198,    144,     95,
-		  33,    248,    179,    152,
-		  66,     17,    228,    190,
-		 121,     75,    233,     22,
-		  90,    152,    175,    252,
-		  36,     84,    148,    195,
-		 253,     49,    153,    101,
-		  46,    249,    195,    153,
-		  86,     41,    254,    178,
-		 140,     90,     25,     23,
-		  73,    138,    185,    250,
-		  48,     88,    128,    184,
-		 241,     43,     94,    108,
-		  54,      3,    204,    155,
-		 101,     36,    244,    203,
-		 129,     86,     47,    246,
-		 184,    120,    168,    232,
-		  22,     66,    140,    189,
-		 235,     36,     85,    138,
-		 192,     10,    213,     95,
-		 107,     52,      4,    197,
-		 155,    108,     32,    244,
-		 201,    137,     93,    219,
-		  21,     78,    116,    160,
-		 233,     19,     73,    134,
-		 187,    239,     35,     87,
-		 140,    192,    246,    213,
-		 155,     99,     56,     15,
-		 197,    155,    106,     36,
-		 243,     61,    119,    172,
-		 211,     30,     75,    113,
-		 183,    227,     30,     76,
-		 134,    185,     16,     34,
-		  88,    113,     58,      5,
-		 193,    138,    100,     60,
-		 251,     52,    108,    151,
-		 223,      6,     51,    123,
-		 172,     34,    239,    184,
-		 125,    179,    228,     26,
-		 175,    122,     70,     24,
-		 213,    180,    103,     44,
-		 248,     42,    105,    135,
-		 220,      6,     62,     99,
-		 160,     46,    247,    195,
-		 137,    174,    212,     27,
-		  79,    121,     79,     31,
-		 239,    187,     99,     93,
-		  29,     37,     86,    129,
-		 213,    233,     40,    103,
-		 144,    204,    253,     52,
-		 109,    165,    221,      1,
-		  71,    113,     87,     40,
-		 231,    162,    155,     85,
-		  14,    235,     89,    136,
-		 173,    229,     44,    164,
-		 149,    192,      4,     43,
-		  98,    155,    198,      8,
-		  63,    107,    162,     32,
-		 254,    174,    144,     78,
-		   9,    251,     76,    108,
-		 165,    248,     15,    172,
-		 112,    187,     13,    219,
-		  86,    155,    192,    244,
-		  32,    109,    158,     51,
-		 246,    212,    134,     65,
-		  62,    229,    186,    102,
-		 184,    240,      7,     66,
-		 121,     78,    232,    225,
-		  87,    133,    179,    253,
-		  38,     80,    149,     58,
-		  10,    193,    140,    127,
-		  50,    224,    209,    108,
-		 177,    203,      1,     77,
-		 122,     88,     28,     18,
-		  76,    134,    166,    250,
-		  46,     91,    134,    189,
-		  12,    220,    174,    122,
-		  43,     30,    214,    139,
-		 148,    198,     23,     54,
-		 124,     88,     41,     14,
-		  67,    122,    165,    247,
-		  10,     64,    142,    189,
-		  17,    213,    162,    122,
-		  41,     17,    207,    187,
-		 123,    199,    228,     34,
-		 101,    151,     43,    245,
-		  61,    121,    162,    208,
-		   5,     87,    115,    167,
-		 237,    226,    186,    123,
-		  77,      7,    192,    179,
-		 111,     46,    230,     54,
-		 113,    156,    204,      9,
-		 218,    150,    148,    212,
-		   5,     43,     97,    175,
-		 219,     27,    184,    141,
-		  74,     18,    241,    174,
-		  96,     90,     30,     54,
-		  71,    157,    197,    244,
-		 223,    141,    105,    198,
-		  12,     58,    126,    141,
-		 210,     11,     57,    141,
-		  93,     37,    229,    172,
-		 162,     81,      2,    239,
-		  71,    167,    175,    232,
-		 218,    169,     98,     60,
-		 246,     63,    112,    131,
-		 220,      7,     55,    104,
-		  95,     45,    243,    201,
-		 152,    118,     62,    246,
-		 190,    103,    148,    254,
-		  26,    170,    104,     81,
-		  12,     40,     79,    157,
-		 203,    242,     45,    159,
-		 103,    204,    249,    206,
-		 153,     76,     55,    235,
-		 166,    130,    182,    246,
-		  14,     76,    135,     93,
-		   2,    230,     92,    157,
-		 174,    251,     44,     90,
-		 104,     57,    254,    209,
-		 159,     97,     62,    230,
-		 218,    138,     85,    202,
-		  37,     91,    117,     94,
-		  14,    255,    176,    113,
-		 169,    250,     25,     84,
-		 119,     74,      8,     35,
-		  92,    106,     49,     20,
-		 213,    129,    114,     57,
-		  24,     21,    114,    163,
-		  42,    226,    169,    143,
-		 160,    254,      0,     79,
-		 132,    183,     16,    230,
-		  86,    139,     66,      6,
-		 199,    181,    117,     46,
-		  10,     45,     72,    134,
-		 208,    246,    200,    128,
-		  83,    209,     19,     85,
-		 123,     83,     29,    234,
-		 181,    124,     73,     21,
-		 215,    184,     98,     84,
-		  25,    221,     72,    191,
-		 232,    252,    195,    148,
-		 104,     40,      5,     35,
-		 104,    163,     38,    243,
-		 186,    130,     84,     24,
-		 230,    182,    109,     94,
-		   1,    209,    175,    156,
-		 233,    234,     43,    175,
-		 101,     49,      2,     50,
-		 121,    136,    217,    251,
-		 197,    141,     89,     32,
-		 230,    191,    129,     92,
-		  12,    242,    188,    130,
-		 163,    201,     59,     87,
-		 125,     49,     15,    212,
-		 100,    154,    219,    243,
-		  54,    146,    101,    211,
-		 245,    200,    133,     94,
-		  41,    251,    175,    138,
-		 186,    196,      5,     64,
-		 120,     77,     28,    217,
-		  89,    138,    207,    250,
-		  38,     98,    107,     54,
-		   1,    206,    158,    107,
-		  34,    251,    215,    148,
-		  93,    200,     55,     94,
-		 120,     73,     16,    237,
-		 173,    134,    176,    228,
-		  46,     80,    139,    195,
-		   6,    210,    155,     99,
-		  62,    242,    217,    130,
-		  72,    213,     40,     24,
-		 123,     80,     43,    235,
-		 180,    131,    183,    236,
-		  22,     89,    129,    190,
-		 242,     36,    166,    121,
-		  54,      9,    195,    139,
-		 124,     60,     23,     28,
-		 114,    160,     37,    254,
-		 187,    139,    170,    215,
-		  30,     66,    116,    187,
-		 237,     24,     80,    125,
-		  79,      1,    200,    189,
-		 112,     34,    243,      7,
-		  76,    150,     59,    242,
-		 192,    147,     95,    213,
-		   5,     74,    122,    161,
-		 230,     16,     78,    130,
-		  64,     25,    240,    187,
-		  86,     99,      9,      6,
-		 112,    136,     56,     10,
-		 197,    155,    100,     48,
-		   1,     50,    126,    179,
-		 209,      9,     65,    119,
-		  91,     16,    249,    167,
-		  98,    111,      5,      8,
-		 120,    169,    184,      5,
-		 221,    166,    105,     59,
-		 253,     57,    119,    143,
-		 222,      1,     59,    144,
-		  89,     44,    224,    169,
-		 157,    112,      8,     28,
-		 104,    163,    189,     19,
-		 214,    168,    119,     71,
-		  14,     44,     74,    138,
-		 217,    245,     51,    155,
-		 101,     39,    247,    208,
-		 147,     69,     40,      4,
-		  93,     97,    164,     30,
-		 227,    178,    124,     78,
-		  24,    222,     67,    171,
-		 215,    252,     40,    163,
-		  98,     56,     16,    222,
-		 142,    120,     43,      8,
-		  40,    120,     89,     37,
-		  21,     67,    132,     88,
-		  21,    224,     94,    161,
-		 167,    252,     33,    173,
-		 121,     46,     28,    204,
-		 133,    101,    205,    238,
-		  56,    151,    107,     40,
-		   3,     45,    113,     84,
-		  50,    235,     73,    101,
-		 175,    242,     16,    180,
-		 116,     80,      9,    193,
-		 188,    112,    219,    238,
-		  46,    140,    124,     50,
-		  14,     33,     98,    107,
-		  57,    245,     47,    104,
-		 179,    203,     30,    184,
-		 147,     82,     56,    198,
-		 189,    136,    152,    244,
-		 217,    186,    111,     59,
-		 247,     57,    103,     98,
-		  59,      7,     36,    127,
-		 180,    198,      7,     62,
-		 155,    118,     11,    200,
-		 178,     96,    154,    244,
-		 238,    140,    101,     65,
-		 253,     43,    165,    119,
-		 197,    235,     56,    115,
-		 147,    198,      9,     54,
-		 156,    125,      4,    236,
-		  76,     82,    136,    217,
-		 252,    148,    149,     76,
-		 224,     28,    171,    120,
-		 172,    237,     62,     86,
-		 149,    192,    255,    210,
-		 136,     78,     21,    249,
-		  37,     69,    177,     36,
-		 236,    166,    128,    170,
-		  27,    231,    178,    115,
-		 169,    246,     11,     91,
-		 137,    188,     12,    210,
-		 184,    113,     50,    234,
-		  18,    126,    154,     41,
-		 224,    203,    145,     95,
-		  40,    226,     64,    109,
-		 136,    250,     28,    180,
-		 125,     78,     30,    246,
-		 188,    126,    179,    239,
-		  63,     89,     98,     46,
-		  18,    201,    159,    106,
-		  61,    252,     42,     78,
-		 134,    203,     12,    185,
-		 129,     89,     11,    251,
-		 179,    149,    170,    255,
-		  33,    167,    122,     74,
-		  13,    223,    176,    127,
-		  62,    244,     40,    121,
-		 137,    217,    250,    207,
-		 155,     66,     40,      8,
-		  93,    103,    188,     31,
-		 247,    191,    120,     75,
-		  25,    205,    186,    115,
-		 200,    227,     50,     79,
-		 145,     55,      8,    216,
-		 128,    110,    216,     26,
-		  28,     96,     88,     41,
-		 227,    189,    128,     90,
-		  10,    233,    180,    132,
-		 169,    255,     41,     85,
-		 118,     51,      6,    223,
-		 157,    159,    223,    233,
-		  57,    104,    100,     41,
-		 242,    202,    128,     86,
-		  41,    238,     78,    112,
-		 184,    231,    231,    184,
-		 112,     65,    239,     43,
-		  82,    133,    196,    241,
-		  41,     98,    104,     50,
-		 246,    192,    157,     99,
-		 213,     13,     58,    113,
-		  85,     42,    228,    186,
-		 122,    189,    237,     31,
-		 173,    121,     69,    234,
-		  34,     88,    116,     58,
-		   3,     45,     98,    106,
-		  54,    251,    205,    144,
-		  92,    212,      2,     51,
-		 127,    172,     34,    229,
-		 191,    128,    176,    228,
-		  29,     80,    133,    190,
-		 245,    218,    173,    127,
-		  52,      1,     42,    110,
-		 150,    199,      7,     54,
-		 146,     93,     47,    252,
-		 182,    143,    168,    215,
-		  30,     64,    120,    178,
-		  17,    237,    185,    118,
-		 189,    254,     48,     74,
-		 149,     63,     13,    214,
-		 159,     97,     59,    246,
-		 197,    106,    172,    217,
-		   4,    191,    128,     91,
-		  16,    226,     75,    114,
-		 162,    252,     20,    174,
-		 126,     72,      5,    208,
-		 169,    103,     59,    253,
-		  61,    107,    146,     49,
-		 246,    210,    158,     94,
-		 211,     24,     87,    121,
-		 169,     30,    236,    189,
-		 115,     71,     30,    231,
-		 170,    140,    178,    254,
-		  32,    161,    124,     45,
-		  13,    206,    104,    140,
-		 198,      8,     62,    145,
-		  95,     33,    250,    178,
-		 138,     85,    227,     31,
-		  71,    136,    181,     18,
-		 210,    166,    112,    187,
-		 249,     56,     81,    153,
-		 204,      2,    206,    159,
-		 104,     35,    242,    193,
-		 113,    163,    221,     12,
-		 191,    141,     90,     24,
-		  29,     64,    143,    190,
-		 233,     34,     84,    139,
-		  60,     13,    220,    168,
-		 110,     55,    255,     48,
-		 106,     97,     36,    241,
-		 193,    121,    182,    202,
-		  27,     65,    133,     81,
-		  26,    228,    181,    123,
-		  79,     23,    220,     85,
-		 136,    192,     15,    216,
-		 148,    111,    207,    240,
-		  39,    121,    151,    209,
-		 244,    199,    136,     93,
-		  36,    230,    191,    135,
-		 176,    230,     24,    179,
-		 115,     79,     20,     32,
-		  84,    130,    207,    254,
-		  41,     98,    151,     53,
-		 249,    192,    153,    105,
-		  40,     11,     58,    114,
-		  84,     36,    235,    185,
-		 120,    185,    239,     19,
-		  86,    134,    184,    237,
-		  37,    166,    114,     52,
-		  12,    218,    158,    151,
-		 205,    254,    202,    151,
-		 160,    208,     13,     59,
-		 118,    169,    223,     23,
-		  77,    124,     79,     29,
-		 229,    170,    120,     68,
-		  13,    217,    164,    143,
-		 198,    250,     45,     97,
-		 153,    205,      2,    200,
-		 147,     94,    214,    244,
-		 189,    142,     87,    223,
-		  22,     74,    124,    178,
-		 232,     28,     83,    120,
-		  65,     12,     38,     88,
-		 146,     59,      0,    215,
-		 156,    101,    206,      1,
-		  59,    104,    165,    222,
-		   4,     69,    136,     83,
-		  22,    236,    181,    124,
-		 182,    233,    226,    170,
-		 113,     70,     15,    216,
-		  95,    153,    205,    247,
-		  59,     98,    155,     53,
-		 242,    206,    148,     94,
-		  39,    242,    191,    142,
-		  85,     26,    233,     73,
-		 134,    189,    227,     23,
-		  81,    136,     64,      8,
-		 211,    160,    111,     59,
-		   6,    198,    145,     98,
-		  44,    250,     57,    102,
-		 170,    201,      2,     70,
-		 132,     91,     22,    239,
-		 178,    129,     73,     22,
-		 218,    172,    113,     66,
-		  11,     40,     91,    159,
-		 217,    236,     57,    101,
-		 101,     37,    245,    207,
-		 134,     93,     35,    245,
-		 184,    135,    174,    224,
-		  16,     65,    143,    187,
-		 228,     34,    169,    118,
-		  61,      9,    211,    170,
-		 102,     56,     10,    203,
-		 149,    158,    216,      8,
-		  46,     96,    171,    221,
-		 239,    185,    129,     84,
-		  31,    224,    185,    119,
-		  74,     30,    213,    170,
-		 142,    198,    253,     39,
-		 107,    156,    205,    250,
-		  55,    105,     99,     42,
-		 253,    207,    131,     83,
-		  36,    238,     67,    114,
-		 186,    237,     31,     77,
-		 123,     70,    236,     37,
-		  95,    137,     60,     15,
-		 217,    149,     96,     55,
-		   2,     51,    109,    152,
-		 208,      9,    195,    143,
-		  85,     34,    237,    186,
-		 135,     75,     27,     26,
-		  86,    140,    178,    234,
-		  38,    167,    117,     58,
-		   1,    209,     98,    150,
-		  51,    248,    194,    154,
-		  85,     43,      0,     43,
-		  99,    189,    211,     17,
-		 177,    137,     70,     31,
-		 224,    172,    124,     78,
-		   1,    215,    163,    140,
-		 200,    232,     60,    109,
-		 144,    207,    252,    201,
-		 147,    161,     41,    241,
-		 179,    152,     70,     46,
-		 239,     79,    113,    161,
-		 248,     20,     83,    123,
-		  64,     14,     36,     95,
-		 145,     62,      9,    192,
-		 149,     96,    202,     15,
-		  55,     97,    167,     42,
-		 245,    186,    137,    168,
-		 227,     21,    177,    137,
-		  71,     28,    229,     86,
-		 133,    175,    226,     47,
-		 162,    105,     49,      2,
-		 205,    155,    103,     53,
-		 242,    205,    152,     93,
-		 223,     29,     87,    100,
-		 166,    225,    238,    190,
-		 118,     77,     19,    231,
-		 163,    126,     70,     14,
-		  44,     87,    157,    215,
-		 241,     55,    153,     98,
-		  38,    243,    204,    152,
-		  93,     34,    241,     71,
-		 113,    161,    238,     30,
-		  72,    127,     79,     30,
-		 211,    161,    125,     66,
-		 246,     46,     87,    154,
-		 192,    251,     49,    103,
-		  97,     43,    241,    205,
-		 133,     83,     35,    241,
-		  64,    115,    163,    238,
-		  18,     73,    124,     77,
-		  27,    215,    161,    114,
-		  59,     11,     40,     90,
-		 147,    193,    246,     54,
-		 107,     98,     46,    253,
-		 197,    136,     95,     32,
-		 237,     69,    121,    170,
-		 227,     30,     72,    128,
-		  71,     17,    217,    173,
-		 119,     61,     11,    214,
-		 158,    106,    203,    253,
-		  55,    106,    156,    211,
-		 245,    193,    143,     88,
-		 223,     21,     66,    121,
-		  79,     24,    231,    177,
-		 123,     70,     17,    220,
-		 166,    115,     60,    247,
-		  46,     98,    149,    201,
-		   0,    203,    151,     98,
-		  41,    244,    192,    141,
-		 168,    220,     19,     69,
-		 126,    179,    231,     27,
-		 175,    120,     70,     19,
-		 216,    164,    112,     60,
-		 249,     46,    103,    146,
-		 201,      2,     55,    149,
-		  92,     46,    241,    196,
-		 136,     87,     33,     18,
-		  74,    126,    182,    228,
-		  30,     80,    134,     69,
-		  12,    217,    166,    113,
-		 196,    248,     47,     99,
-		 103,     50,    253,     55,
-		 109,    160,    214,    244,
-		 189,    142,     86,     33,
-		  21,     77,    123,    183,
-		 233,    227,    169,    125,
-		  71,     12,     38,     89,
-		 146,    199,    251,     47,
-		 100,    152,    204,      1,
-		  57,    146,     95,     44,
-		 247,    188,    137,    169,
-		 227,     22,     72,    126,
-		  75,     23,    224,    172,
-		 119,     66,     12,    217,
-		 162,    110,    198,    250,
-		  50,    103,    155,    207,
-		 250,    196,    147,     94,
-		  37,    243,    189,    118,
-		 174,    227,     20,     73,
-		 129,     74,     20,    225,
-		 170,    118,     65,     12,
-		 215,    163,    109,    199,
-		 253,     50,    101,    153,
-		 208,    251,    198,    147,
-		  89,     39,    241,     67,
-		 120,    173,     29,    232,
-		  76,    128,    180,    232,
-		  33,    170,    119,     68,
-		  15,    213,    161,    146,
-		 202,    255,     51,    152,
-		  98,     47,    249,     59,
-		 114,    167,    219,    240,
-		 186,    135,     80,    227,
-		  25,     79,    131,    183,
-		  18,    220,    171,    117,
-		 192,    244,     40,     94,
-		 148,     54,      1,    204,
-		 104,    156,    210,    248,
-		 194,    140,     91,     38,
-		 239,     69,    123,    174,
-		 229,     25,     78,    124,
-		  71,     18,    221,    168,
-		 115,     62,      9,     43,
-		  97,    148,    200,    254,
-		  52,    150,     99,     46,
-		 245,    192,    140,     88,
-		 220,     17,     70,    122,
-		 178,    231,     25,     76,
-		 134,    185,     16,    223,
-		 164,    113,     63,      9,
-		 211,     97,    150,    202,
-		   1,     52,    107,    158,
-		 213,      9,    192,    142,
-		  84,     33,    239,    184,
-		 125,    179,    228,     26,
-		  80,    122,     69,    239,
-		  36,     88,    143,    195,
-		   7,    211,    156,    104,
-		 204,      3,     52,    105,
-		 160,     43,    247,    195,
-		 137,     87,     33,     18,
-		  73,    124,    178,    231,
-		 227,    174,    121,     68,
-		  14,    219,    167,    114,
-		  58,      6,     46,     97,
-		 155,    206,      0,     55,
-		 147,     92,     43,    245,
-		 191,    138,    170,    223,
-		 235,     73,    126,    178,
-		 234,     30,     80,    134,
-		  67,     12,    218,    167,
-		 110,    197,    251,     45,
-		 102,    152,    206,    252,
-		 199,    146,     93,     40,
-		 243,    190,    136,     85,
-		  30,    234,     74,    126,
-		 181,    232,     30,    172,
-		 118,     67,     12,    217,
-		 162,    110,     57,    251,
-		  48,    100,    155,    206,
-		   5,     56,    110,     92,
-		  38,    243,    188,    137,
-		  83,    225,     22,     74,
-		 129,    180,    234,     31,
-		  84,    137,    190,     12,
-		 215,    163,    108,     57,
-		   3,    206,    102,    154,
-		 209,      4,     58,    111,
-		  91,     39,    240,    189,
-		 135,    173,    226,     22,
-		  77,    128,    183,    235,
-		  32,    170,    117,     65,
-		  10,    215,    161,    108,
-		  55,    253,     50,    102,
-		 157,    209,      6,     59,
-		 143,     90,     37,    240,
-		 187,    134,    174,    227,
-		  24,     77,    130,    183,
-		 236,    222,    169,    116,
-		  63,     10,    213,    160,
-		 148,    201,    255,     50,
-		 105,    157,    210,    248,
-		 195,    143,     88,     37,
-		 238,    186,    133,    175,
-		 228,     24,     79,    131,
-		 184,    237,     34,    168,
-		 115,     62,      8,    213,
-		 159,    106,    202,    255,
-		  52,    104,    158,    211,
-		   8,     61,    141,     88,
-		  35,    238,    185,    132,
-		  79,    229,     26,     79,
-		 132,    185,    238,     35,
-		 167,    114,     61,      8,
-		 211,    158,    105,     52,
-		 255,     53,    106,    159,
-		 212,      9,     62,    140,
-		  87,     34,    237,    184,
-		 131,    177,    230,     27,
-		  80,    133,    186,    239,
-		 219,    166,    113,     60,
-		   7,    210,    157,    151,
-		 204,      1,     54,    107,
-		 160,    213,     10,     63,
-		 139,     86,     33,    236,
-		 183,    130,    178,    231,
-		  28,     81,    134,    187,
-		 240,    218,    165,    112,
-		  59,      6,    209,    156,
-		 152,    205,      2,     55,
-		 108,    161,    214,    244,
-		 191,    138,     85,     32,
-		 235,    182,    126,    179,
-		 232,     29,     82,    135,
-		 188,    241,    217,    164,
-		 111,     58,      5,    208,
-		 155,    102,     49,      3,
-		  56,    109,    162,    215,
-		  12,    190,    137,     84,
-		  31,    234,    181,    127,
-		 180,    233,     30,     83,
-		 136,    189,     13,    216,
-		 163,    110,     57,    251,
-		  48,    101,    154,    207,
-		   4,     57,    110,    163,
-		 216,     13,     66,    119,
-		  83,     30,    233,    180,
-		 127,    181,    234,     31,
-		  84,    137,    190,     12,
-		 215,    162,    109,     56,
-		   3,    206,    153,    100,
-		 208,      5,     58,    111,
-		 164,    217,    241,    188,
-		 135,     82,     29,     23,
-		  76,    129,    182,    235,
-		  32,     85,    138,    191,
-		 244,     41,    161,    108,
-		  55,      2,    205,    152,
-		 156,    209,      6,     59,
-		 112,     90,     37,    240,
-		 187,    134,     81,     28,
-		 231,    178,    125,    183,
-		 236,     33,     86,    139,
-		 192,     10,    213,    160,
-		 107,     54,      1,    204,
-		 151,    157,    210,      7,
-		  60,    113,    166,    219,
-		 239,    186,    133,     80,
-		  27,    230,    177,    131,
-		 184,    237,     34,     87,
-		 140,    193,    246,     43,
-		 159,    106,     53,      0,
-		 203,    150,     97,    211,
-		   8,     61,    114,    167,
-		  35,    238,    185,    132,
-		  79,     26,    229,    176,
-		 132,    185,    238,     35,
-		  88,    141,    194,    247,
-		 211,    158,    105,     52,
-		 255,    202,    106,    159,
-		 212,      9,     62,    115,
-		 168,    221,     18,    184,
-		 124,    177,     25,     27,
-		  80,    133,    186,    239,
-		  36,     89,    142,     60,
-		   7,    210,    157,    104,
-		 204,      1,     54,    107,
-		  95,     42,     10,     63,
-		 116,    169,     33,    236,
-		 183,    130,     77,     24,
-		 227,     81,    134,    187,
-		 240,     37,    165,    112,
-		  59,      6,    209,     99,
-		 152,    205,    253,     55,
-		 108,    161,    214,     11,
-		  64,    117,     85,     32,
-		 235,    182,    129,     76,
-		  23,     29,     82,    135,
-		 188,    241,     38,     91,
-		 144,    197,      5,    208,
-		 155,    102,     49,    252,
-		 199,    146,    162,    215,
-		  12,     65,    137,     84,
-		  31,    234,    181,    128,
-		  75,     22,     30,     83,
-		 136,    189,    242,     39,
-		  92,    145,    198,    251,
-		  48,    101,    154,    207,
-		   4,     57,    110,    163,
-		 216,     13,     66,    136,
-		  83,     30,    233,    180,
-		 127,     74,     21,    224,
-		 171,    118,     65,     12,
-		 215,    162,    109,     56,
-		 252,     49,    102,    155,
-		 208,      5,     58,    111,
-		 164,    217,     14,     67,
-		 120,    173,     29,    232,
-		 179,    126,     73,     20,
-		 223,     85,    138,    191,
-		 244,     41,     94,    147,
-		  55,      2,    205,    152,
-		  99,     46,    249,    196,
-		 143,     90,     37,     15,
-		  68,    121,    174,    227,
-		  24,     77,    125,     72,
-		  19,    222,     86,    139,
-		  63,     10,    213,    160,
-		 107,     54,    254,     51,
-		 104,     98,    210,      7,
-		  60,    113,    166,    219,
-		  16,     69,    122,    175,
-		 228,     25,     78,    131,
-		 184,     18,    221,    168,
-		 115,     62,      9,    212,
-		 159,    149,    202,    255,
-		  52,    150,     97,     44,
-		   8,     61,    114,    167,
-		 220,     17,     70,    132,
-		  79,     26,    229,    176,
-		 123,     70,    238,     35,
-		  88,    141,    194,    247,
-		  44,     97,    105,     52,
-		 255,    202,    106,    159,
-		 212,      9,     62,    115,
-		 168,    221,     18,     71,
-		 124,    177,    230,    228,
-		 175,    122,     69,    239,
-		  36,     89,    142,    195,
-		   7,    210,    157,    104,
-		  51,    254,    201,    148,
-		  95,     42,    245,    192,
-		 139,     86,     33,    236,
-		  72,    125,    178,    231,
-		  28,     81,    134,     68,
-		  15,     37,     90,    143,
-		 196,    249,     46,     99,
-		 152,    205,    253,    200,
-		 147,     94,     41,    244,
-		 191,    117,    170,    223,
-		  20,     73,    126,    179,
-		 232,     29,    173,    120,
-		 188,     14,    217,    164,
-		 111,     58,      5,    208,
-		 155,    102,     49,    252,
-	};
 
 
 	const uint8_t* waveform_8_table[] = {
 	  wav_digits,
 	};
 
-	const int16_t wav_sine[] = {
-		   0,    201,    402,    603,
-		 804,   1005,   1206,   1406,
-		1607,   1808,   2009,   2209,
-		2410,   2610,   2811,   3011,
-		3211,   3411,   3611,   3811,
-		4011,   4210,   4409,   4608,
-		4807,   5006,   5205,   5403,
-		5601,   5799,   5997,   6195,
-		6392,   6589,   6786,   6982,
-		7179,   7375,   7571,   7766,
-		7961,   8156,   8351,   8545,
-		8739,   8932,   9126,   9319,
-		9511,   9703,   9895,  10087,
-	   10278,  10469,  10659,  10849,
-	   11038,  11227,  11416,  11604,
-	   11792,  11980,  12166,  12353,
-	   12539,  12724,  12909,  13094,
-	   13278,  13462,  13645,  13827,
-	   14009,  14191,  14372,  14552,
-	   14732,  14911,  15090,  15268,
-	   15446,  15623,  15799,  15975,
-	   16150,  16325,  16499,  16672,
-	   16845,  17017,  17189,  17360,
-	   17530,  17699,  17868,  18036,
-	   18204,  18371,  18537,  18702,
-	   18867,  19031,  19194,  19357,
-	   19519,  19680,  19840,  20000,
-	   20159,  20317,  20474,  20631,
-	   20787,  20942,  21096,  21249,
-	   21402,  21554,  21705,  21855,
-	   22004,  22153,  22301,  22448,
-	   22594,  22739,  22883,  23027,
-	   23169,  23311,  23452,  23592,
-	   23731,  23869,  24006,  24143,
-	   24278,  24413,  24546,  24679,
-	   24811,  24942,  25072,  25201,
-	   25329,  25456,  25582,  25707,
-	   25831,  25954,  26077,  26198,
-	   26318,  26437,  26556,  26673,
-	   26789,  26905,  27019,  27132,
-	   27244,  27355,  27466,  27575,
-	   27683,  27790,  27896,  28001,
-	   28105,  28208,  28309,  28410,
-	   28510,  28608,  28706,  28802,
-	   28897,  28992,  29085,  29177,
-	   29268,  29358,  29446,  29534,
-	   29621,  29706,  29790,  29873,
-	   29955,  30036,  30116,  30195,
-	   30272,  30349,  30424,  30498,
-	   30571,  30643,  30713,  30783,
-	   30851,  30918,  30984,  31049,
-	   31113,  31175,  31236,  31297,
-	   31356,  31413,  31470,  31525,
-	   31580,  31633,  31684,  31735,
-	   31785,  31833,  31880,  31926,
-	   31970,  32014,  32056,  32097,
-	   32137,  32176,  32213,  32249,
-	   32284,  32318,  32350,  32382,
-	   32412,  32441,  32468,  32495,
-	   32520,  32544,  32567,  32588,
-	   32609,  32628,  32646,  32662,
-	   32678,  32692,  32705,  32717,
-	   32727,  32736,  32744,  32751,
-	   32757,  32761,  32764,  32766,
-	   32767,  32766,  32764,  32761,
-	   32757,  32751,  32744,  32736,
-	   32727,  32717,  32705,  32692,
-	   32678,  32662,  32646,  32628,
-	   32609,  32588,  32567,  32544,
-	   32520,  32495,  32468,  32441,
-	   32412,  32382,  32350,  32318,
-	   32284,  32249,  32213,  32176,
-	   32137,  32097,  32056,  32014,
-	   31970,  31926,  31880,  31833,
-	   31785,  31735,  31684,  31633,
-	   31580,  31525,  31470,  31413,
-	   31356,  31297,  31236,  31175,
-	   31113,  31049,  30984,  30918,
-	   30851,  30783,  30713,  30643,
-	   30571,  30498,  30424,  30349,
-	   30272,  30195,  30116,  30036,
-	   29955,  29873,  29790,  29706,
-	   29621,  29534,  29446,  29358,
-	   29268,  29177,  29085,  28992,
-	   28897,  28802,  28706,  28608,
-	   28510,  28410,  28309,  28208,
-	   28105,  28001,  27896,  27790,
-	   27683,  27575,  27466,  27355,
-	   27244,  27132,  27019,  26905,
-	   26789,  26673,  26556,  26437,
-	   26318,  26198,  26077,  25954,
-	   25831,  25707,  25582,  25456,
-	   25329,  25201,  25072,  24942,
-	   24811,  24679,  24546,  24413,
-	   24278,  24143,  24006,  23869,
-	   23731,  23592,  23452,  23311,
-	   23169,  23027,  22883,  22739,
-	   22594,  22448,  22301,  22153,
-	   22004,  21855,  21705,  21554,
-	   21402,  21249,  21096,  20942,
-	   20787,  20631,  20474,  20317,
-	   20159,  20000,  19840,  19680,
-	   19519,  19357,  19194,  19031,
-	   18867,  18702,  18537,  18371,
-	   18204,  18036,  17868,  17699,
-	   17530,  17360,  17189,  17017,
-	   16845,  16672,  16499,  16325,
-	   16150,  15975,  15799,  15623,
-	   15446,  15268,  15090,  14911,
-	   14732,  14552,  14372,  14191,
-	   14009,  13827,  13645,  13462,
-	   13278,  13094,  12909,  12724,
-	   12539,  12353,  12166,  11980,
-	   11792,  11604,  11416,  11227,
-	   11038,  10849,  10659,  10469,
-	   10278,  10087,   9895,   9703,
-		9511,   9319,   9126,   8932,
-		8739,   8545,   8351,   8156,
-		7961,   7766,   7571,   7375,
-		7179,   6982,   6786,   6589,
-		6392,   6195,   5997,   5799,
-		5601,   5403,   5205,   5006,
-		4807,   4608,   4409,   4210,
-		4011,   3811,   3611,   3411,
-		3211,   3011,   2811,   2610,
-		2410,   2209,   2009,   1808,
-		1607,   1406,   1206,   1005,
-		 804,    603,    402,    201,
-		   0,   -201,   -402,   -603,
-		-804,  -1005,  -1206,  -1406,
-	   -1607,  -1808,  -2009,  -2209,
-	   -2410,  -2610,  -2811,  -3011,
-	   -3211,  -3411,  -3611,  -3811,
-	   -4011,  -4210,  -4409,  -4608,
-	   -4807,  -5006,  -5205,  -5403,
-	   -5601,  -5799,  -5997,  -6195,
-	   -6392,  -6589,  -6786,  -6982,
-	   -7179,  -7375,  -7571,  -7766,
-	   -7961,  -8156,  -8351,  -8545,
-	   -8739,  -8932,  -9126,  -9319,
-	   -9511,  -9703,  -9895, -10087,
-	  -10278, -10469, -10659, -10849,
-	  -11038, -11227, -11416, -11604,
-	  -11792, -11980, -12166, -12353,
-	  -12539, -12724, -12909, -13094,
-	  -13278, -13462, -13645, -13827,
-	  -14009, -14191, -14372, -14552,
-	  -14732, -14911, -15090, -15268,
-	  -15446, -15623, -15799, -15975,
-	  -16150, -16325, -16499, -16672,
-	  -16845, -17017, -17189, -17360,
-	  -17530, -17699, -17868, -18036,
-	  -18204, -18371, -18537, -18702,
-	  -18867, -19031, -19194, -19357,
-	  -19519, -19680, -19840, -20000,
-	  -20159, -20317, -20474, -20631,
-	  -20787, -20942, -21096, -21249,
-	  -21402, -21554, -21705, -21855,
-	  -22004, -22153, -22301, -22448,
-	  -22594, -22739, -22883, -23027,
-	  -23169, -23311, -23452, -23592,
-	  -23731, -23869, -24006, -24143,
-	  -24278, -24413, -24546, -24679,
-	  -24811, -24942, -25072, -25201,
-	  -25329, -25456, -25582, -25707,
-	  -25831, -25954, -26077, -26198,
-	  -26318, -26437, -26556, -26673,
-	  -26789, -26905, -27019, -27132,
-	  -27244, -27355, -27466, -27575,
-	  -27683, -27790, -27896, -28001,
-	  -28105, -28208, -28309, -28410,
-	  -28510, -28608, -28706, -28802,
-	  -28897, -28992, -29085, -29177,
-	  -29268, -29358, -29446, -29534,
-	  -29621, -29706, -29790, -29873,
-	  -29955, -30036, -30116, -30195,
-	  -30272, -30349, -30424, -30498,
-	  -30571, -30643, -30713, -30783,
-	  -30851, -30918, -30984, -31049,
-	  -31113, -31175, -31236, -31297,
-	  -31356, -31413, -31470, -31525,
-	  -31580, -31633, -31684, -31735,
-	  -31785, -31833, -31880, -31926,
-	  -31970, -32014, -32056, -32097,
-	  -32137, -32176, -32213, -32249,
-	  -32284, -32318, -32350, -32382,
-	  -32412, -32441, -32468, -32495,
-	  -32520, -32544, -32567, -32588,
-	  -32609, -32628, -32646, -32662,
-	  -32678, -32692, -32705, -32717,
-	  -32727, -32736, -32744, -32751,
-	  -32757, -32761, -32764, -32766,
-	  -32767, -32766, -32764, -32761,
-	  -32757, -32751, -32744, -32736,
-	  -32727, -32717, -32705, -32692,
-	  -32678, -32662, -32646, -32628,
-	  -32609, -32588, -32567, -32544,
-	  -32520, -32495, -32468, -32441,
-	  -32412, -32382, -32350, -32318,
-	  -32284, -32249, -32213, -32176,
-	  -32137, -32097, -32056, -32014,
-	  -31970, -31926, -31880, -31833,
-	  -31785, -31735, -31684, -31633,
-	  -31580, -31525, -31470, -31413,
-	  -31356, -31297, -31236, -31175,
-	  -31113, -31049, -30984, -30918,
-	  -30851, -30783, -30713, -30643,
-	  -30571, -30498, -30424, -30349,
-	  -30272, -30195, -30116, -30036,
-	  -29955, -29873, -29790, -29706,
-	  -29621, -29534, -29446, -29358,
-	  -29268, -29177, -29085, -28992,
-	  -28897, -28802, -28706, -28608,
-	  -28510, -28410, -28309, -28208,
-	  -28105, -28001, -27896, -27790,
-	  -27683, -27575, -27466, -27355,
-	  -27244, -27132, -27019, -26905,
-	  -26789, -26673, -26556, -26437,
-	  -26318, -26198, -26077, -25954,
-	  -25831, -25707, -25582, -25456,
-	  -25329, -25201, -25072, -24942,
-	  -24811, -24679, -24546, -24413,
-	  -24278, -24143, -24006, -23869,
-	  -23731, -23592, -23452, -23311,
-	  -23169, -23027, -22883, -22739,
-	  -22594, -22448, -22301, -22153,
-	  -22004, -21855, -21705, -21554,
-	  -21402, -21249, -21096, -20942,
-	  -20787, -20631, -20474, -20317,
-	  -20159, -20000, -19840, -19680,
-	  -19519, -19357, -19194, -19031,
-	  -18867, -18702, -18537, -18371,
-	  -18204, -18036, -17868, -17699,
-	  -17530, -17360, -17189, -17017,
-	  -16845, -16672, -16499, -16325,
-	  -16150, -15975, -15799, -15623,
-	  -15446, -15268, -15090, -14911,
-	  -14732, -14552, -14372, -14191,
-	  -14009, -13827, -13645, -13462,
-	  -13278, -13094, -12909, -12724,
-	  -12539, -12353, -12166, -11980,
-	  -11792, -11604, -11416, -11227,
-	  -11038, -10849, -10659, -10469,
-	  -10278, -10087,  -9895,  -9703,
-	   -9511,  -9319,  -9126,  -8932,
-	   -8739,  -8545,  -8351,  -8156,
-	   -7961,  -7766,  -7571,  -7375,
-	   -7179,  -6982,  -6786,  -6589,
-	   -6392,  -6195,  -5997,  -5799,
-	   -5601,  -5403,  -5205,  -5006,
-	   -4807,  -4608,  -4409,  -4210,
-	   -4011,  -3811,  -3611,  -3411,
-	   -3211,  -3011,  -2811,  -2610,
-	   -2410,  -2209,  -2009,  -1808,
-	   -1607,  -1406,  -1206,  -1005,
-		-804,   -603,   -402,   -201,
-		   0,
-	};
-	const int16_t wav_fold_power[] = {
-	  -32767, -32322, -31881, -31446,
-	  -31017, -30592, -30172, -29757,
-	  -29347, -28942, -28541, -28146,
-	  -27755, -27368, -26987, -26610,
-	  -26237, -25869, -25506, -25146,
-	  -24791, -24441, -24095, -23752,
-	  -23415, -23081, -22751, -22425,
-	  -22104, -21786, -21472, -21162,
-	  -20856, -20554, -20255, -19961,
-	  -19670, -19382, -19098, -18818,
-	  -18541, -18268, -17998, -17732,
-	  -17469, -17209, -16953, -16700,
-	  -16450, -16204, -15960, -15720,
-	  -15483, -15249, -15018, -14790,
-	  -14565, -14343, -14123, -13907,
-	  -13694, -13483, -13275, -13070,
-	  -12867, -12668, -12471, -12276,
-	  -12084, -11895, -11709, -11524,
-	  -11343, -11163, -10987, -10812,
-	  -10640, -10471, -10303, -10138,
-	   -9975,  -9815,  -9657,  -9501,
-	   -9347,  -9195,  -9045,  -8898,
-	   -8752,  -8609,  -8467,  -8328,
-	   -8190,  -8055,  -7921,  -7789,
-	   -7659,  -7532,  -7405,  -7281,
-	   -7159,  -7038,  -6919,  -6802,
-	   -6686,  -6572,  -6460,  -6349,
-	   -6240,  -6133,  -6027,  -5923,
-	   -5821,  -5719,  -5620,  -5522,
-	   -5425,  -5330,  -5236,  -5144,
-	   -5053,  -4963,  -4875,  -4788,
-	   -4703,  -4619,  -4536,  -4454,
-	   -4374,  -4295,  -4217,  -4140,
-	   -4065,  -3990,  -3917,  -3845,
-	   -3775,  -3705,  -3636,  -3569,
-	   -3502,  -3437,  -3373,  -3309,
-	   -3247,  -3186,  -3125,  -3066,
-	   -3008,  -2950,  -2894,  -2839,
-	   -2784,  -2730,  -2677,  -2626,
-	   -2575,  -2524,  -2475,  -2426,
-	   -2379,  -2332,  -2286,  -2240,
-	   -2196,  -2152,  -2109,  -2067,
-	   -2025,  -1984,  -1944,  -1905,
-	   -1866,  -1828,  -1790,  -1754,
-	   -1718,  -1682,  -1647,  -1613,
-	   -1579,  -1546,  -1514,  -1482,
-	   -1451,  -1420,  -1390,  -1361,
-	   -1332,  -1303,  -1275,  -1248,
-	   -1221,  -1194,  -1168,  -1143,
-	   -1118,  -1093,  -1069,  -1046,
-	   -1022,  -1000,   -977,   -956,
-		-934,   -913,   -892,   -872,
-		-852,   -833,   -814,   -795,
-		-777,   -759,   -741,   -724,
-		-707,   -691,   -674,   -659,
-		-643,   -628,   -613,   -598,
-		-584,   -570,   -556,   -543,
-		-529,   -516,   -504,   -491,
-		-479,   -467,   -456,   -445,
-		-433,   -423,   -412,   -401,
-		-391,   -381,   -372,   -362,
-		-353,   -344,   -335,   -326,
-		-318,   -309,   -301,   -293,
-		-285,   -278,   -270,   -263,
-		-256,   -249,   -242,   -236,
-		-229,   -223,   -217,   -211,
-		-205,   -199,   -194,   -188,
-		-183,   -178,   -173,   -168,
-		-163,   -158,   -154,   -149,
-		-145,   -141,   -136,   -132,
-		-129,   -125,   -121,   -117,
-		-114,   -110,   -107,   -104,
-		-101,    -97,    -94,    -91,
-		 -89,    -86,    -83,    -80,
-		 -78,    -75,    -73,    -71,
-		 -68,    -66,    -64,    -62,
-		 -60,    -58,    -56,    -54,
-		 -52,    -50,    -49,    -47,
-		 -45,    -44,    -42,    -41,
-		 -39,    -38,    -37,    -35,
-		 -34,    -33,    -32,    -31,
-		 -29,    -28,    -27,    -26,
-		 -25,    -24,    -23,    -23,
-		 -22,    -21,    -20,    -19,
-		 -19,    -18,    -17,    -16,
-		 -16,    -15,    -15,    -14,
-		 -13,    -13,    -12,    -12,
-		 -11,    -11,    -10,    -10,
-		 -10,     -9,     -9,     -8,
-		  -8,     -8,     -7,     -7,
-		  -7,     -6,     -6,     -6,
-		  -6,     -5,     -5,     -5,
-		  -5,     -4,     -4,     -4,
-		  -4,     -4,     -3,     -3,
-		  -3,     -3,     -3,     -3,
-		  -2,     -2,     -2,     -2,
-		  -2,     -2,     -2,     -2,
-		  -2,     -2,     -1,     -1,
-		  -1,     -1,     -1,     -1,
-		  -1,     -1,     -1,     -1,
-		  -1,     -1,     -1,     -1,
-		  -1,     -1,     -1,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      0,      0,
-		   0,      0,      1,      1,
-		   1,      1,      1,      1,
-		   1,      1,      1,      1,
-		   1,      1,      1,      1,
-		   1,      1,      1,      2,
-		   2,      2,      2,      2,
-		   2,      2,      2,      2,
-		   2,      3,      3,      3,
-		   3,      3,      3,      4,
-		   4,      4,      4,      4,
-		   5,      5,      5,      5,
-		   6,      6,      6,      6,
-		   7,      7,      7,      8,
-		   8,      8,      9,      9,
-		  10,     10,     10,     11,
-		  11,     12,     12,     13,
-		  13,     14,     15,     15,
-		  16,     16,     17,     18,
-		  19,     19,     20,     21,
-		  22,     23,     23,     24,
-		  25,     26,     27,     28,
-		  29,     31,     32,     33,
-		  34,     35,     37,     38,
-		  39,     41,     42,     44,
-		  45,     47,     49,     50,
-		  52,     54,     56,     58,
-		  60,     62,     64,     66,
-		  68,     71,     73,     75,
-		  78,     80,     83,     86,
-		  89,     91,     94,     97,
-		 101,    104,    107,    110,
-		 114,    117,    121,    125,
-		 129,    132,    136,    141,
-		 145,    149,    154,    158,
-		 163,    168,    173,    178,
-		 183,    188,    194,    199,
-		 205,    211,    217,    223,
-		 229,    236,    242,    249,
-		 256,    263,    270,    278,
-		 285,    293,    301,    309,
-		 318,    326,    335,    344,
-		 353,    362,    372,    381,
-		 391,    401,    412,    423,
-		 433,    445,    456,    467,
-		 479,    491,    504,    516,
-		 529,    543,    556,    570,
-		 584,    598,    613,    628,
-		 643,    659,    674,    691,
-		 707,    724,    741,    759,
-		 777,    795,    814,    833,
-		 852,    872,    892,    913,
-		 934,    956,    977,   1000,
-		1022,   1046,   1069,   1093,
-		1118,   1143,   1168,   1194,
-		1221,   1248,   1275,   1303,
-		1332,   1361,   1390,   1420,
-		1451,   1482,   1514,   1546,
-		1579,   1613,   1647,   1682,
-		1718,   1754,   1790,   1828,
-		1866,   1905,   1944,   1984,
-		2025,   2067,   2109,   2152,
-		2196,   2240,   2286,   2332,
-		2379,   2426,   2475,   2524,
-		2575,   2626,   2677,   2730,
-		2784,   2839,   2894,   2950,
-		3008,   3066,   3125,   3186,
-		3247,   3309,   3373,   3437,
-		3502,   3569,   3636,   3705,
-		3775,   3845,   3917,   3990,
-		4065,   4140,   4217,   4295,
-		4374,   4454,   4536,   4619,
-		4703,   4788,   4875,   4963,
-		5053,   5144,   5236,   5330,
-		5425,   5522,   5620,   5719,
-		5821,   5923,   6027,   6133,
-		6240,   6349,   6460,   6572,
-		6686,   6802,   6919,   7038,
-		7159,   7281,   7405,   7532,
-		7659,   7789,   7921,   8055,
-		8190,   8328,   8467,   8609,
-		8752,   8898,   9045,   9195,
-		9347,   9501,   9657,   9815,
-		9975,  10138,  10303,  10471,
-	   10640,  10812,  10987,  11163,
-	   11343,  11524,  11709,  11895,
-	   12084,  12276,  12471,  12668,
-	   12867,  13070,  13275,  13483,
-	   13694,  13907,  14123,  14343,
-	   14565,  14790,  15018,  15249,
-	   15483,  15720,  15960,  16204,
-	   16450,  16700,  16953,  17209,
-	   17469,  17732,  17998,  18268,
-	   18541,  18818,  19098,  19382,
-	   19670,  19961,  20255,  20554,
-	   20856,  21162,  21472,  21786,
-	   22104,  22425,  22751,  23081,
-	   23415,  23752,  24095,  24441,
-	   24791,  25146,  25506,  25869,
-	   26237,  26610,  26987,  27368,
-	   27755,  28146,  28541,  28942,
-	   29347,  29757,  30172,  30592,
-	   31017,  31446,  31881,  32322,
-	   32322,
-	};
-	const int16_t wav_fold_sine[] = {
-	  -32767, -32746, -32726, -32704,
-	  -32683, -32662, -32640, -32618,
-	  -32596, -32573, -32551, -32528,
-	  -32505, -32482, -32458, -32435,
-	  -32411, -32387, -32364, -32340,
-	  -32316, -32291, -32267, -32243,
-	  -32219, -32194, -32170, -32146,
-	  -32122, -32097, -32073, -32049,
-	  -32025, -32002, -31978, -31955,
-	  -31932, -31909, -31886, -31863,
-	  -31841, -31819, -31797, -31776,
-	  -31755, -31734, -31714, -31694,
-	  -31674, -31655, -31636, -31618,
-	  -31600, -31582, -31565, -31548,
-	  -31532, -31516, -31501, -31486,
-	  -31471, -31457, -31443, -31430,
-	  -31417, -31404, -31392, -31380,
-	  -31368, -31356, -31345, -31334,
-	  -31323, -31312, -31302, -31291,
-	  -31280, -31269, -31259, -31248,
-	  -31236, -31225, -31213, -31201,
-	  -31189, -31175, -31162, -31148,
-	  -31133, -31117, -31101, -31083,
-	  -31065, -31046, -31025, -31003,
-	  -30981, -30956, -30931, -30904,
-	  -30875, -30845, -30814, -30780,
-	  -30745, -30708, -30669, -30628,
-	  -30585, -30540, -30494, -30445,
-	  -30393, -30340, -30284, -30227,
-	  -30167, -30104, -30040, -29973,
-	  -29904, -29833, -29759, -29684,
-	  -29606, -29526, -29444, -29360,
-	  -29274, -29186, -29096, -29005,
-	  -28912, -28817, -28721, -28623,
-	  -28525, -28425, -28324, -28222,
-	  -28119, -28016, -27913, -27809,
-	  -27705, -27601, -27497, -27394,
-	  -27291, -27189, -27088, -26988,
-	  -26889, -26792, -26696, -26602,
-	  -26511, -26421, -26334, -26249,
-	  -26168, -26089, -26013, -25941,
-	  -25872, -25807, -25745, -25687,
-	  -25634, -25584, -25539, -25498,
-	  -25461, -25430, -25402, -25380,
-	  -25362, -25349, -25340, -25337,
-	  -25338, -25344, -25354, -25370,
-	  -25389, -25414, -25442, -25475,
-	  -25512, -25553, -25597, -25645,
-	  -25697, -25752, -25809, -25869,
-	  -25931, -25996, -26062, -26130,
-	  -26198, -26267, -26337, -26407,
-	  -26476, -26544, -26611, -26677,
-	  -26740, -26801, -26858, -26913,
-	  -26963, -27009, -27050, -27086,
-	  -27117, -27141, -27158, -27169,
-	  -27172, -27167, -27153, -27131,
-	  -27100, -27059, -27009, -26948,
-	  -26877, -26794, -26701, -26596,
-	  -26479, -26351, -26210, -26057,
-	  -25892, -25715, -25524, -25322,
-	  -25106, -24878, -24638, -24385,
-	  -24120, -23843, -23554, -23253,
-	  -22941, -22617, -22283, -21939,
-	  -21585, -21221, -20849, -20468,
-	  -20079, -19683, -19281, -18872,
-	  -18458, -18040, -17618, -17193,
-	  -16766, -16338, -15909, -15480,
-	  -15053, -14628, -14205, -13787,
-	  -13374, -12967, -12566, -12173,
-	  -11789, -11414, -11050, -10697,
-	  -10357, -10030,  -9716,  -9418,
-	   -9135,  -8869,  -8620,  -8389,
-	   -8177,  -7984,  -7810,  -7658,
-	   -7526,  -7416,  -7327,  -7261,
-	   -7218,  -7197,  -7199,  -7224,
-	   -7273,  -7344,  -7439,  -7557,
-	   -7698,  -7861,  -8047,  -8255,
-	   -8484,  -8734,  -9004,  -9294,
-	   -9603,  -9931, -10275, -10636,
-	  -11013, -11404, -11808, -12225,
-	  -12652, -13089, -13535, -13988,
-	  -14446, -14909, -15374, -15841,
-	  -16308, -16773, -17235, -17692,
-	  -18142, -18585, -19017, -19439,
-	  -19847, -20241, -20619, -20980,
-	  -21321, -21642, -21940, -22215,
-	  -22465, -22689, -22886, -23053,
-	  -23191, -23297, -23372, -23413,
-	  -23420, -23393, -23330, -23231,
-	  -23095, -22922, -22712, -22463,
-	  -22177, -21853, -21491, -21090,
-	  -20653, -20178, -19666, -19118,
-	  -18534, -17915, -17263, -16578,
-	  -15860, -15112, -14335, -13530,
-	  -12698, -11841, -10961, -10059,
-	   -9137,  -8198,  -7242,  -6273,
-	   -5292,  -4301,  -3303,  -2300,
-	   -1294,   -287,    718,   1719,
-		2713,   3698,   4672,   5632,
-		6576,   7502,   8406,   9288,
-	   10143,  10971,  11769,  12535,
-	   13267,  13962,  14620,  15237,
-	   15812,  16345,  16832,  17272,
-	   17665,  18009,  18302,  18545,
-	   18735,  18872,  18956,  18986,
-	   18961,  18882,  18748,  18560,
-	   18317,  18020,  17670,  17267,
-	   16812,  16306,  15749,  15144,
-	   14491,  13793,  13050,  12264,
-	   11437,  10572,   9669,   8733,
-		7763,   6765,   5738,   4687,
-		3614,   2521,   1412,    289,
-		-844,  -1986,  -3132,  -4281,
-	   -5428,  -6571,  -7707,  -8832,
-	   -9945, -11040, -12117, -13171,
-	  -14201, -15202, -16173, -17110,
-	  -18011, -18874, -19695, -20474,
-	  -21206, -21892, -22527, -23111,
-	  -23641, -24116, -24536, -24897,
-	  -25199, -25442, -25624, -25744,
-	  -25803, -25798, -25732, -25603,
-	  -25411, -25157, -24841, -24464,
-	  -24027, -23530, -22975, -22363,
-	  -21695, -20974, -20199, -19375,
-	  -18502, -17582, -16619, -15613,
-	  -14569, -13488, -12372, -11226,
-	  -10051,  -8851,  -7629,  -6387,
-	   -5129,  -3858,  -2578,  -1290,
-		   0,   1290,   2578,   3858,
-		5129,   6387,   7629,   8851,
-	   10051,  11226,  12372,  13488,
-	   14569,  15613,  16619,  17582,
-	   18502,  19375,  20199,  20974,
-	   21695,  22363,  22975,  23530,
-	   24027,  24464,  24841,  25157,
-	   25411,  25603,  25732,  25798,
-	   25803,  25744,  25624,  25442,
-	   25199,  24897,  24536,  24116,
-	   23641,  23111,  22527,  21892,
-	   21206,  20474,  19695,  18874,
-	   18011,  17110,  16173,  15202,
-	   14201,  13171,  12117,  11040,
-		9945,   8832,   7707,   6571,
-		5428,   4281,   3132,   1986,
-		 844,   -289,  -1412,  -2521,
-	   -3614,  -4687,  -5738,  -6765,
-	   -7763,  -8733,  -9669, -10572,
-	  -11437, -12264, -13050, -13793,
-	  -14491, -15144, -15749, -16306,
-	  -16812, -17267, -17670, -18020,
-	  -18317, -18560, -18748, -18882,
-	  -18961, -18986, -18956, -18872,
-	  -18735, -18545, -18302, -18009,
-	  -17665, -17272, -16832, -16345,
-	  -15812, -15237, -14620, -13962,
-	  -13267, -12535, -11769, -10971,
-	  -10143,  -9288,  -8406,  -7502,
-	   -6576,  -5632,  -4672,  -3698,
-	   -2713,  -1719,   -718,    287,
-		1294,   2300,   3303,   4301,
-		5292,   6273,   7242,   8198,
-		9137,  10059,  10961,  11841,
-	   12698,  13530,  14335,  15112,
-	   15860,  16578,  17263,  17915,
-	   18534,  19118,  19666,  20178,
-	   20653,  21090,  21491,  21853,
-	   22177,  22463,  22712,  22922,
-	   23095,  23231,  23330,  23393,
-	   23420,  23413,  23372,  23297,
-	   23191,  23053,  22886,  22689,
-	   22465,  22215,  21940,  21642,
-	   21321,  20980,  20619,  20241,
-	   19847,  19439,  19017,  18585,
-	   18142,  17692,  17235,  16773,
-	   16308,  15841,  15374,  14909,
-	   14446,  13988,  13535,  13089,
-	   12652,  12225,  11808,  11404,
-	   11013,  10636,  10275,   9931,
-		9603,   9294,   9004,   8734,
-		8484,   8255,   8047,   7861,
-		7698,   7557,   7439,   7344,
-		7273,   7224,   7199,   7197,
-		7218,   7261,   7327,   7416,
-		7526,   7658,   7810,   7984,
-		8177,   8389,   8620,   8869,
-		9135,   9418,   9716,  10030,
-	   10357,  10697,  11050,  11414,
-	   11789,  12173,  12566,  12967,
-	   13374,  13787,  14205,  14628,
-	   15053,  15480,  15909,  16338,
-	   16766,  17193,  17618,  18040,
-	   18458,  18872,  19281,  19683,
-	   20079,  20468,  20849,  21221,
-	   21585,  21939,  22283,  22617,
-	   22941,  23253,  23554,  23843,
-	   24120,  24385,  24638,  24878,
-	   25106,  25322,  25524,  25715,
-	   25892,  26057,  26210,  26351,
-	   26479,  26596,  26701,  26794,
-	   26877,  26948,  27009,  27059,
-	   27100,  27131,  27153,  27167,
-	   27172,  27169,  27158,  27141,
-	   27117,  27086,  27050,  27009,
-	   26963,  26913,  26858,  26801,
-	   26740,  26677,  26611,  26544,
-	   26476,  26407,  26337,  26267,
-	   26198,  26130,  26062,  25996,
-	   25931,  25869,  25809,  25752,
-	   25697,  25645,  25597,  25553,
-	   25512,  25475,  25442,  25414,
-	   25389,  25370,  25354,  25344,
-	   25338,  25337,  25340,  25349,
-	   25362,  25380,  25402,  25430,
-	   25461,  25498,  25539,  25584,
-	   25634,  25687,  25745,  25807,
-	   25872,  25941,  26013,  26089,
-	   26168,  26249,  26334,  26421,
-	   26511,  26602,  26696,  26792,
-	   26889,  26988,  27088,  27189,
-	   27291,  27394,  27497,  27601,
-	   27705,  27809,  27913,  28016,
-	   28119,  28222,  28324,  28425,
-	   28525,  28623,  28721,  28817,
-	   28912,  29005,  29096,  29186,
-	   29274,  29360,  29444,  29526,
-	   29606,  29684,  29759,  29833,
-	   29904,  29973,  30040,  30104,
-	   30167,  30227,  30284,  30340,
-	   30393,  30445,  30494,  30540,
-	   30585,  30628,  30669,  30708,
-	   30745,  30780,  30814,  30845,
-	   30875,  30904,  30931,  30956,
-	   30981,  31003,  31025,  31046,
-	   31065,  31083,  31101,  31117,
-	   31133,  31148,  31162,  31175,
-	   31189,  31201,  31213,  31225,
-	   31236,  31248,  31259,  31269,
-	   31280,  31291,  31302,  31312,
-	   31323,  31334,  31345,  31356,
-	   31368,  31380,  31392,  31404,
-	   31417,  31430,  31443,  31457,
-	   31471,  31486,  31501,  31516,
-	   31532,  31548,  31565,  31582,
-	   31600,  31618,  31636,  31655,
-	   31674,  31694,  31714,  31734,
-	   31755,  31776,  31797,  31819,
-	   31841,  31863,  31886,  31909,
-	   31932,  31955,  31978,  32002,
-	   32025,  32049,  32073,  32097,
-	   32122,  32146,  32170,  32194,
-	   32219,  32243,  32267,  32291,
-	   32316,  32340,  32364,  32387,
-	   32411,  32435,  32458,  32482,
-	   32505,  32528,  32551,  32573,
-	   32596,  32618,  32640,  32662,
-	   32683,  32704,  32726,  32746,
-	   32746,
-	};
-	const int16_t wav_overdrive[] = {
-	  -32767, -32767, -32767, -32767,
-	  -32767, -32767, -32767, -32767,
-	  -32766, -32766, -32766, -32766,
-	  -32766, -32766, -32766, -32766,
-	  -32766, -32766, -32766, -32766,
-	  -32766, -32765, -32765, -32765,
-	  -32765, -32765, -32765, -32765,
-	  -32765, -32765, -32765, -32765,
-	  -32764, -32764, -32764, -32764,
-	  -32764, -32764, -32764, -32764,
-	  -32763, -32763, -32763, -32763,
-	  -32763, -32763, -32763, -32763,
-	  -32762, -32762, -32762, -32762,
-	  -32762, -32762, -32761, -32761,
-	  -32761, -32761, -32761, -32761,
-	  -32760, -32760, -32760, -32760,
-	  -32760, -32759, -32759, -32759,
-	  -32759, -32759, -32758, -32758,
-	  -32758, -32758, -32757, -32757,
-	  -32757, -32757, -32756, -32756,
-	  -32756, -32756, -32755, -32755,
-	  -32755, -32754, -32754, -32754,
-	  -32753, -32753, -32753, -32752,
-	  -32752, -32752, -32751, -32751,
-	  -32751, -32750, -32750, -32749,
-	  -32749, -32749, -32748, -32748,
-	  -32747, -32747, -32746, -32746,
-	  -32745, -32745, -32744, -32744,
-	  -32743, -32743, -32742, -32742,
-	  -32741, -32741, -32740, -32740,
-	  -32739, -32738, -32738, -32737,
-	  -32736, -32736, -32735, -32734,
-	  -32734, -32733, -32732, -32732,
-	  -32731, -32730, -32729, -32728,
-	  -32728, -32727, -32726, -32725,
-	  -32724, -32723, -32722, -32721,
-	  -32720, -32719, -32718, -32717,
-	  -32716, -32715, -32714, -32713,
-	  -32712, -32711, -32710, -32709,
-	  -32707, -32706, -32705, -32704,
-	  -32702, -32701, -32700, -32698,
-	  -32697, -32695, -32694, -32692,
-	  -32691, -32689, -32688, -32686,
-	  -32684, -32683, -32681, -32679,
-	  -32678, -32676, -32674, -32672,
-	  -32670, -32668, -32666, -32664,
-	  -32662, -32660, -32658, -32655,
-	  -32653, -32651, -32649, -32646,
-	  -32644, -32641, -32639, -32636,
-	  -32633, -32631, -32628, -32625,
-	  -32622, -32619, -32617, -32614,
-	  -32610, -32607, -32604, -32601,
-	  -32597, -32594, -32591, -32587,
-	  -32584, -32580, -32576, -32572,
-	  -32568, -32564, -32560, -32556,
-	  -32552, -32548, -32543, -32539,
-	  -32534, -32530, -32525, -32520,
-	  -32515, -32510, -32505, -32500,
-	  -32495, -32489, -32484, -32478,
-	  -32473, -32467, -32461, -32455,
-	  -32448, -32442, -32436, -32429,
-	  -32422, -32416, -32409, -32402,
-	  -32394, -32387, -32380, -32372,
-	  -32364, -32356, -32348, -32340,
-	  -32331, -32323, -32314, -32305,
-	  -32296, -32287, -32277, -32268,
-	  -32258, -32248, -32237, -32227,
-	  -32216, -32206, -32195, -32183,
-	  -32172, -32160, -32148, -32136,
-	  -32124, -32111, -32098, -32085,
-	  -32072, -32058, -32044, -32030,
-	  -32016, -32001, -31986, -31971,
-	  -31955, -31939, -31923, -31907,
-	  -31890, -31873, -31855, -31838,
-	  -31819, -31801, -31782, -31763,
-	  -31743, -31723, -31703, -31682,
-	  -31661, -31640, -31618, -31596,
-	  -31573, -31550, -31526, -31502,
-	  -31478, -31453, -31427, -31401,
-	  -31375, -31348, -31320, -31293,
-	  -31264, -31235, -31205, -31175,
-	  -31145, -31113, -31082, -31049,
-	  -31016, -30983, -30948, -30913,
-	  -30878, -30842, -30805, -30767,
-	  -30729, -30690, -30650, -30610,
-	  -30569, -30527, -30484, -30440,
-	  -30396, -30351, -30305, -30258,
-	  -30211, -30162, -30113, -30063,
-	  -30012, -29959, -29906, -29853,
-	  -29798, -29742, -29685, -29627,
-	  -29568, -29508, -29447, -29385,
-	  -29321, -29257, -29191, -29125,
-	  -29057, -28988, -28918, -28846,
-	  -28774, -28700, -28625, -28548,
-	  -28470, -28391, -28311, -28229,
-	  -28146, -28061, -27975, -27887,
-	  -27798, -27708, -27616, -27522,
-	  -27427, -27331, -27232, -27132,
-	  -27031, -26928, -26823, -26717,
-	  -26609, -26499, -26387, -26274,
-	  -26158, -26041, -25923, -25802,
-	  -25679, -25555, -25428, -25300,
-	  -25170, -25038, -24904, -24767,
-	  -24629, -24489, -24346, -24202,
-	  -24056, -23907, -23756, -23603,
-	  -23448, -23291, -23131, -22970,
-	  -22806, -22640, -22471, -22301,
-	  -22128, -21952, -21775, -21595,
-	  -21413, -21228, -21041, -20852,
-	  -20660, -20466, -20270, -20071,
-	  -19870, -19666, -19460, -19252,
-	  -19041, -18828, -18613, -18395,
-	  -18174, -17951, -17726, -17499,
-	  -17269, -17036, -16802, -16565,
-	  -16325, -16083, -15839, -15593,
-	  -15344, -15093, -14840, -14584,
-	  -14327, -14067, -13805, -13540,
-	  -13274, -13005, -12735, -12462,
-	  -12187, -11910, -11632, -11351,
-	  -11068, -10784, -10498, -10210,
-	   -9920,  -9628,  -9335,  -9040,
-	   -8744,  -8446,  -8146,  -7845,
-	   -7543,  -7239,  -6934,  -6628,
-	   -6320,  -6012,  -5702,  -5391,
-	   -5079,  -4766,  -4453,  -4138,
-	   -3823,  -3507,  -3190,  -2873,
-	   -2555,  -2237,  -1918,  -1599,
-	   -1279,   -960,   -640,   -320,
-		   0,    320,    640,    960,
-		1279,   1599,   1918,   2237,
-		2555,   2873,   3190,   3507,
-		3823,   4138,   4453,   4766,
-		5079,   5391,   5702,   6012,
-		6320,   6628,   6934,   7239,
-		7543,   7845,   8146,   8446,
-		8744,   9040,   9335,   9628,
-		9920,  10210,  10498,  10784,
-	   11068,  11351,  11632,  11910,
-	   12187,  12462,  12735,  13005,
-	   13274,  13540,  13805,  14067,
-	   14327,  14584,  14840,  15093,
-	   15344,  15593,  15839,  16083,
-	   16325,  16565,  16802,  17036,
-	   17269,  17499,  17726,  17951,
-	   18174,  18395,  18613,  18828,
-	   19041,  19252,  19460,  19666,
-	   19870,  20071,  20270,  20466,
-	   20660,  20852,  21041,  21228,
-	   21413,  21595,  21775,  21952,
-	   22128,  22301,  22471,  22640,
-	   22806,  22970,  23131,  23291,
-	   23448,  23603,  23756,  23907,
-	   24056,  24202,  24346,  24489,
-	   24629,  24767,  24904,  25038,
-	   25170,  25300,  25428,  25555,
-	   25679,  25802,  25923,  26041,
-	   26158,  26274,  26387,  26499,
-	   26609,  26717,  26823,  26928,
-	   27031,  27132,  27232,  27331,
-	   27427,  27522,  27616,  27708,
-	   27798,  27887,  27975,  28061,
-	   28146,  28229,  28311,  28391,
-	   28470,  28548,  28625,  28700,
-	   28774,  28846,  28918,  28988,
-	   29057,  29125,  29191,  29257,
-	   29321,  29385,  29447,  29508,
-	   29568,  29627,  29685,  29742,
-	   29798,  29853,  29906,  29959,
-	   30012,  30063,  30113,  30162,
-	   30211,  30258,  30305,  30351,
-	   30396,  30440,  30484,  30527,
-	   30569,  30610,  30650,  30690,
-	   30729,  30767,  30805,  30842,
-	   30878,  30913,  30948,  30983,
-	   31016,  31049,  31082,  31113,
-	   31145,  31175,  31205,  31235,
-	   31264,  31293,  31320,  31348,
-	   31375,  31401,  31427,  31453,
-	   31478,  31502,  31526,  31550,
-	   31573,  31596,  31618,  31640,
-	   31661,  31682,  31703,  31723,
-	   31743,  31763,  31782,  31801,
-	   31819,  31838,  31855,  31873,
-	   31890,  31907,  31923,  31939,
-	   31955,  31971,  31986,  32001,
-	   32016,  32030,  32044,  32058,
-	   32072,  32085,  32098,  32111,
-	   32124,  32136,  32148,  32160,
-	   32172,  32183,  32195,  32206,
-	   32216,  32227,  32237,  32248,
-	   32258,  32268,  32277,  32287,
-	   32296,  32305,  32314,  32323,
-	   32331,  32340,  32348,  32356,
-	   32364,  32372,  32380,  32387,
-	   32394,  32402,  32409,  32416,
-	   32422,  32429,  32436,  32442,
-	   32448,  32455,  32461,  32467,
-	   32473,  32478,  32484,  32489,
-	   32495,  32500,  32505,  32510,
-	   32515,  32520,  32525,  32530,
-	   32534,  32539,  32543,  32548,
-	   32552,  32556,  32560,  32564,
-	   32568,  32572,  32576,  32580,
-	   32584,  32587,  32591,  32594,
-	   32597,  32601,  32604,  32607,
-	   32610,  32614,  32617,  32619,
-	   32622,  32625,  32628,  32631,
-	   32633,  32636,  32639,  32641,
-	   32644,  32646,  32649,  32651,
-	   32653,  32655,  32658,  32660,
-	   32662,  32664,  32666,  32668,
-	   32670,  32672,  32674,  32676,
-	   32678,  32679,  32681,  32683,
-	   32684,  32686,  32688,  32689,
-	   32691,  32692,  32694,  32695,
-	   32697,  32698,  32700,  32701,
-	   32702,  32704,  32705,  32706,
-	   32707,  32709,  32710,  32711,
-	   32712,  32713,  32714,  32715,
-	   32716,  32717,  32718,  32719,
-	   32720,  32721,  32722,  32723,
-	   32724,  32725,  32726,  32727,
-	   32728,  32728,  32729,  32730,
-	   32731,  32732,  32732,  32733,
-	   32734,  32734,  32735,  32736,
-	   32736,  32737,  32738,  32738,
-	   32739,  32740,  32740,  32741,
-	   32741,  32742,  32742,  32743,
-	   32743,  32744,  32744,  32745,
-	   32745,  32746,  32746,  32747,
-	   32747,  32748,  32748,  32749,
-	   32749,  32749,  32750,  32750,
-	   32751,  32751,  32751,  32752,
-	   32752,  32752,  32753,  32753,
-	   32753,  32754,  32754,  32754,
-	   32755,  32755,  32755,  32756,
-	   32756,  32756,  32756,  32757,
-	   32757,  32757,  32757,  32758,
-	   32758,  32758,  32758,  32759,
-	   32759,  32759,  32759,  32759,
-	   32760,  32760,  32760,  32760,
-	   32760,  32761,  32761,  32761,
-	   32761,  32761,  32761,  32762,
-	   32762,  32762,  32762,  32762,
-	   32762,  32763,  32763,  32763,
-	   32763,  32763,  32763,  32763,
-	   32763,  32764,  32764,  32764,
-	   32764,  32764,  32764,  32764,
-	   32764,  32765,  32765,  32765,
-	   32765,  32765,  32765,  32765,
-	   32765,  32765,  32765,  32765,
-	   32766,  32766,  32766,  32766,
-	   32766,  32766,  32766,  32766,
-	   32766,  32766,  32766,  32766,
-	   32766,  32767,  32767,  32767,
-	   32767,  32767,  32767,  32767,
-	   32767,
-	};
 
 
 	const int16_t* waveform_table[] = {
@@ -38,19 +38,8 @@
 
 
 
-namespace deadman {
-
-typedef uint8_t ResourceId;
-
-extern const char* string_table[];
-
-extern const uint16_t* lookup_table_table[];
-
-extern const uint32_t* lookup_table_32_table[];
-
-extern const uint8_t* waveform_8_table[];
-
-extern const int16_t* waveform_table[];
+// Tables identical to the peaks ones are shared, not duplicated.
+namespace peaks {
 
 extern const uint16_t lut_delay_times[];
 extern const uint16_t lut_gravity[];
@@ -69,6 +58,40 @@ extern const int16_t wav_sine[];
 extern const int16_t wav_fold_power[];
 extern const int16_t wav_fold_sine[];
 extern const int16_t wav_overdrive[];
+
+}  // namespace peaks
+
+namespace deadman {
+
+typedef uint8_t ResourceId;
+
+extern const char* string_table[];
+
+extern const uint16_t* lookup_table_table[];
+
+extern const uint32_t* lookup_table_32_table[];
+
+extern const uint8_t* waveform_8_table[];
+
+extern const int16_t* waveform_table[];
+
+using peaks::lut_delay_times;
+using peaks::lut_gravity;
+using peaks::lut_env_linear;
+using peaks::lut_env_expo;
+using peaks::lut_env_quartic;
+using peaks::lut_raised_cosine;
+using peaks::lut_svf_cutoff;
+using peaks::lut_svf_damp;
+using peaks::lut_svf_scale;
+using peaks::lut_lfo_increments;
+using peaks::lut_env_increments;
+using peaks::lut_oscillator_increments;
+using peaks::wav_digits;
+using peaks::wav_sine;
+using peaks::wav_fold_power;
+using peaks::wav_fold_sine;
+using peaks::wav_overdrive;
 #define STR_DUMMY 0  // dummy
 #define LUT_DELAY_TIMES 0
 #define LUT_DELAY_TIMES_SIZE 257
@@ -38,6 +38,28 @@
 
 
 
+// Tables identical to the warps ones are shared, not duplicated.
+namespace warps {
+
+extern const float fb_1397_8000[];
+extern const float fb_5588_32000[];
+extern const float lut_sin[];
+extern const float lut_xfade_in[];
+extern const float lut_xfade_out[];
+extern const float lut_bipolar_fold[];
+extern const float lut_midi_to_f_high[];
+extern const float lut_midi_to_f_low[];
+extern const float lut_pot_curve[];
+extern const float lut_ap_poles[];
+extern const float wav_sine_i[];
+extern const float wav_sine_q[];
+extern const float wav_harmonics_i[];
+extern const float wav_harmonics_q[];
+extern const float wav_buzzy_i[];
+extern const float wav_buzzy_q[];
+
+}  // namespace warps
+
 namespace distortiones {
 
 typedef uint8_t ResourceId;
@@ -60,29 +82,29 @@ extern const float fb_554_8000[];
 extern const float fb_698_8000[];
 extern const float fb_880_8000[];
 extern const float fb_1109_8000[];
-extern const float fb_1397_8000[];
+using warps::fb_1397_8000;
 extern const float fb_1760_32000[];
 extern const float fb_2217_32000[];
 extern const float fb_2794_32000[];
 extern const float fb_3520_32000[];
 extern const float fb_4435_32000[];
-extern const float fb_5588_32000[];
+using warps::fb_5588_32000;
 extern const float fb_7040_96000[];
-extern const float lut_sin[];
+using warps::lut_sin;
 extern const float lut_arcsin[];
-extern const float lut_xfade_in[];
-extern const float lut_xfade_out[];
-extern const float lut_bipolar_fold[];
-extern const float lut_midi_to_f_high[];
-extern const float lut_midi_to_f_low[];
-extern const float lut_pot_curve[];
-extern const float lut_ap_poles[];
-extern const float wav_sine_i[];
-extern const float wav_sine_q[];
-extern const float wav_harmonics_i[];
-extern const float wav_harmonics_q[];
-extern const float wav_buzzy_i[];
-extern const float wav_buzzy_q[];
+using warps::lut_xfade_in;
+using warps::lut_xfade_out;
+using warps::lut_bipolar_fold;
+using warps::lut_midi_to_f_high;
+using warps::lut_midi_to_f_low;
+using warps::lut_pot_curve;
+using warps::lut_ap_poles;
+using warps::wav_sine_i;
+using warps::wav_sine_q;
+using warps::wav_harmonics_i;
+using warps::wav_harmonics_q;
+using warps::wav_buzzy_i;
+using warps::wav_buzzy_q;
 #define FB__87_8000 0
 #define FB__87_8000_SIZE 7
 #define FB_110_8000 1
@@ -78,7 +78,7 @@ namespace distortiones {
 		filter_[3].Init();
 	}
 
-	void DistortionesModulator::ProcessFreqShifter(ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::ProcessFreqShifter(FloatFrame* input, FloatFrame* output, size_t size) {
 		float* carrier = buffer_[0];
 		float* carrier_i = &src_buffer_[0][0];
 		float* carrier_q = &src_buffer_[0][size];
@@ -105,7 +105,7 @@ namespace distortiones {
 			quadrature_oscillator_.Render(shape, frequency, carrier_i, carrier_q, size);
 		} else {
 			for (size_t i = 0; i < size; ++i) {
-				carrier[i] = static_cast<float>(input[i].l) / 32768.0f;
+				carrier[i] = input[i].l;
 			}
 			quadrature_transform_[0].Process(carrier, carrier_i, carrier_q, size);
 
@@ -137,10 +137,10 @@ namespace distortiones {
 			float modulator_i, modulator_q;
 
 			// Start from the signal from input 2, with non-linear gain.
-			float in = static_cast<float>(input->r) / 32768.0f;
+			float in = input->r;
 
 			if (parameters_.carrier_shape) {
-				in += static_cast<float>(input->l) / 32768.0f;
+				in += input->l;
 			}
 
 			float modulator = in;
@@ -174,8 +174,8 @@ namespace distortiones {
 			main += wet_dry * (in - main);
 			aux += wet_dry * (in - aux);
 
-			output->l = Clip16(static_cast<int32_t>(main * 32768.0f));
-			output->r = Clip16(static_cast<int32_t>(aux * 32768.0f));
+			output->l = ClipFrame(main);
+			output->r = ClipFrame(aux);
 			++output;
 			++input;
 		}
@@ -183,7 +183,7 @@ namespace distortiones {
 		previous_parameters_ = parameters_;
 	}
 
-	void DistortionesModulator::ProcessVocoder(ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::ProcessVocoder(FloatFrame* input, FloatFrame* output, size_t size) {
 		float* carrier = buffer_[0];
 		const float* modulator = buffer_[1];
 		float* main_output = buffer_[0];
@@ -193,8 +193,8 @@ namespace distortiones {
 			fill(&aux_output[0], &aux_output[size], 0.0f);
 		}
 
-		// Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-		short* input_samples = &input->l;
+		// Apply VCA/saturation (5.8% per channel)
+		const float* input_samples = &input->l;
 		for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
 			amplifier_[i].Process(parameters_.channel_drive[i], 1.0f, input_samples + i,
 				buffer_[i], aux_output, 2, size);
@@ -204,7 +204,7 @@ namespace distortiones {
 		if (parameters_.carrier_shape) {
 			// Scale phase-modulation input.
 			for (size_t i = 0; i < size; ++i) {
-				internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+				internal_modulation_[i] = input[i].l;
 			}
 			OscillatorShape vocoder_shape = static_cast<OscillatorShape>(parameters_.carrier_shape + 1);
 
@@ -222,10 +222,10 @@ namespace distortiones {
 		vocoder_.set_formant_shift(parameters_.modulation_algorithm);
 		vocoder_.Process(modulator, carrier, main_output, size);
 
-		// Convert back to integer and clip.
+		// Clip.
 		while (size--) {
-			output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-			output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
+			output->l = ClipFrame(*main_output);
+			output->r = ClipFrame(*aux_output * 0.5f);
 			++main_output;
 			++aux_output;
 			++output;
@@ -235,7 +235,7 @@ namespace distortiones {
 
 
 
-	void DistortionesModulator::ProcessMeta(ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::ProcessMeta(FloatFrame* input, FloatFrame* output, size_t size) {
 		float* carrier = buffer_[0];
 		const float* modulator = buffer_[1];
 		float* main_output = buffer_[0];
@@ -252,8 +252,8 @@ namespace distortiones {
 			fill(&aux_output[0], &aux_output[size], 0.0f);
 		}
 
-		// Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-		short* input_samples = &input->l;
+		// Apply VCA/saturation (5.8% per channel)
+		const float* input_samples = &input->l;
 		for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
 			amplifier_[i].Process(parameters_.channel_drive[i], 1.0f - vocoder_amount, input_samples + i,
 				buffer_[i], aux_output, 2, size);
@@ -263,7 +263,7 @@ namespace distortiones {
 		if (parameters_.carrier_shape) {
 			// Scale phase-modulation input.
 			for (size_t i = 0; i < size; ++i) {
-				internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+				internal_modulation_[i] = input[i].l;
 			}
 			// Xmod: sine, triangle saw.
 			// Vocoder: saw, pulse, noise.
@@ -337,10 +337,10 @@ namespace distortiones {
 			}
 		}
 
-		// Convert back to integer and clip.
+		// Clip.
 		while (size--) {
-			output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-			output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
+			output->l = ClipFrame(*main_output);
+			output->r = ClipFrame(*aux_output * 0.5f);
 			++main_output;
 			++aux_output;
 			++output;
@@ -350,7 +350,7 @@ namespace distortiones {
 
 
 	template<XmodAlgorithm algorithm>
-	void DistortionesModulator::Process1(ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::Process1(FloatFrame* input, FloatFrame* output, size_t size) {
 		float* carrier = buffer_[0];
 		const float* modulator = buffer_[1];
 		float* main_output = buffer_[0];
@@ -363,8 +363,8 @@ namespace distortiones {
 			fill(&aux_output[0], &aux_output[size], 0.0f);
 		}
 
-		// Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-		short* input_samples = &input->l;
+		// Apply VCA/saturation (5.8% per channel)
+		const float* input_samples = &input->l;
 		for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
 			amplifier_[i].Process(parameters_.channel_drive[i], 1.0f, input_samples + i, buffer_[i],
 				aux_output, 2, size);
@@ -374,7 +374,7 @@ namespace distortiones {
 		if (parameters_.carrier_shape) {
 			// Scale phase-modulation input.
 			for (size_t i = 0; i < size; ++i) {
-				internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+				internal_modulation_[i] = input[i].l;
 			}
 
 			OscillatorShape xmod_shape = static_cast<OscillatorShape>(parameters_.carrier_shape - 1);
@@ -393,10 +393,10 @@ namespace distortiones {
 
 		src_down2_[0].Process(oversampled_output, main_output, size * kLessOversampling);
 
-		// Convert back to integer and clip.
+		// Clip.
 		while (size--) {
-			output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-			output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
+			output->l = ClipFrame(*main_output);
+			output->r = ClipFrame(*aux_output * 0.5f);
 			++main_output;
 			++aux_output;
 			++output;
@@ -404,7 +404,7 @@ namespace distortiones {
 		previous_parameters_ = parameters_;
 	}
 
-	void DistortionesModulator::ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::ProcessBitcrusher(FloatFrame* input, FloatFrame* output, size_t size) {
 		float* carrier = buffer_[0];
 		const float* modulator = buffer_[1];
 		float* main_output = buffer_[0];
@@ -414,8 +414,8 @@ namespace distortiones {
 			fill(&aux_output[0], &aux_output[size], 0.0f);
 		}
 
-		// Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-		short* input_samples = &input->l;
+		// Apply VCA/saturation (5.8% per channel)
+		const float* input_samples = &input->l;
 		for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
 			amplifier_[i].Process(parameters_.channel_drive[i], 1.0f, input_samples + i, buffer_[i],
 				aux_output, 2, size);
@@ -425,7 +425,7 @@ namespace distortiones {
 		if (parameters_.carrier_shape) {
 			// Scale phase-modulation input.
 			for (size_t i = 0; i < size; ++i) {
-				internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+				internal_modulation_[i] = input[i].l;
 			}
 
 			OscillatorShape xmod_shape = static_cast<OscillatorShape>(parameters_.carrier_shape - 1);
@@ -445,10 +445,10 @@ namespace distortiones {
 			parameters_.modulation_algorithm, mod_1, mod_2, carrier, modulator,
 			main_output, aux_output, size);
 
-		// Convert back to integer and clip.
+		// Clip.
 		while (size--) {
-			output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-			output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
+			output->l = ClipFrame(*main_output);
+			output->r = ClipFrame(*aux_output * 0.5f);
 			++main_output;
 			++aux_output;
 			++output;
@@ -457,7 +457,7 @@ namespace distortiones {
 
 	}
 
-	void DistortionesModulator::ProcessDelay(const ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::ProcessDelay(const FloatFrame* input, FloatFrame* output, size_t size) {
 
 		ShortFrame* buffer = delay_buffer_;
 
@@ -493,8 +493,8 @@ namespace distortiones {
 			int direction = delay_lp_rate > 0.0f ? 1 : -1;
 
 			FloatFrame in;
-			in.l = static_cast<float>(input->l) / 32768.0f;
-			in.r = static_cast<float>(input->r) / 32768.0f;
+			in.l = input->l;
+			in.r = input->r;
 
 			FloatFrame fb;
 
@@ -636,16 +636,16 @@ namespace distortiones {
 			if (parameters_.carrier_shape == 0) {
 				/* If open feedback loop, AUX is the wet signal and OUT
 				   crossfades between inputs. */
-				in.r = static_cast<float>(input->r) / 32768.0f;
-				output->l = Clip16((fade_out * in.l + fade_in * in.r) * 32768.0f);
-				output->r = Clip16(wet.r * 32768.0f);
+				in.r = input->r;
+				output->l = ClipFrame(fade_out * in.l + fade_in * in.r);
+				output->r = ClipFrame(wet.r);
 			} else if (parameters_.carrier_shape == 2) {
 				// Analog mode -> soft-clipping.
-				output->l = SoftConvert((fade_out * in.l + fade_in * wet.l) * 2.0f);
-				output->r = SoftConvert((fade_out * in.r + fade_in * wet.r) * 2.0f);
+				output->l = ClipFrame(SoftLimit(fade_out * in.l + fade_in * wet.l));
+				output->r = ClipFrame(SoftLimit(fade_out * in.r + fade_in * wet.r));
 			} else {
-				output->l = Clip16((fade_out * in.l + fade_in * wet.l) * 32768.0f);
-				output->r = Clip16((fade_out * in.r + fade_in * wet.r) * 32768.0f);
+				output->l = ClipFrame(fade_out * in.l + fade_in * wet.l);
+				output->r = ClipFrame(fade_out * in.r + fade_in * wet.r);
 			}
 
 			feedback += feedback_increment;
@@ -659,7 +659,7 @@ namespace distortiones {
 		previous_parameters_ = parameters_;
 	}
 
-	void DistortionesModulator::ProcessDoppler(const ShortFrame* input, ShortFrame* output, size_t size) {
+	void DistortionesModulator::ProcessDoppler(const FloatFrame* input, FloatFrame* output, size_t size) {
 		ShortFrame* buffer = delay_buffer_;
 
 		float x = previous_parameters_.raw_algorithm * 2.0f - 1.0f;
@@ -692,8 +692,8 @@ namespace distortiones {
 		while (size--) {
 
 			// Write input to buffer.
-			buffer[doppler_cursor].l = input->l;
-			buffer[doppler_cursor].r = input->r;
+			buffer[doppler_cursor].l = Clip16(static_cast<int32_t>(input->l * 32768.0f));
+			buffer[doppler_cursor].r = Clip16(static_cast<int32_t>(input->r * 32768.0f));
 
 			// LFOs.
 			float sin = Interpolate(lut_sin, doppler_lfo_phase, 1024.0f);
@@ -746,8 +746,8 @@ namespace distortiones {
 			float fade_in = Interpolate(lut_xfade_in, (doppler_angle + 1.0f) / 2.0f, 256.0f);
 			float fade_out = Interpolate(lut_xfade_out, (doppler_angle + 1.0f) / 2.0f, 256.0f);
 
-			output->l = s2_l * fade_in + s1_l * fade_out;
-			output->r = s1_r * fade_in + s2_r * fade_out;
+			output->l = static_cast<short>(s2_l * fade_in + s1_l * fade_out) / 32768.0f;
+			output->r = static_cast<short>(s1_r * fade_in + s2_r * fade_out) / 32768.0f;
 
 			x += x_increment;
 			y += y_increment;
@@ -762,6 +762,21 @@ namespace distortiones {
 	}
 
 	void DistortionesModulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
+		FloatFrame float_input[kMaxBlockSize];
+		FloatFrame float_output[kMaxBlockSize];
+
+		for (size_t i = 0; i < size; ++i) {
+			float_input[i].l = static_cast<float>(input[i].l) / 32768.0f;
+			float_input[i].r = static_cast<float>(input[i].r) / 32768.0f;
+		}
+		Process(float_input, float_output, size);
+		for (size_t i = 0; i < size; ++i) {
+			output[i].l = Clip16(static_cast<int32_t>(float_output[i].l * 32768.0f));
+			output[i].r = Clip16(static_cast<int32_t>(float_output[i].r * 32768.0f));
+		}
+	}
+
+	void DistortionesModulator::Process(FloatFrame* input, FloatFrame* output, size_t size) {
 		switch (feature_mode_) {
 
 		case FEATURE_MODE_DOPPLER:
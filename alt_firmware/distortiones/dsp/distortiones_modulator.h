@@ -52,6 +52,12 @@ namespace distortiones {
 	typedef struct { short l; short r; } ShortFrame;
 	typedef struct { float l; float r; } FloatFrame;
 
+	/* Float frames span the -1.0 to 1.0 range of 16-bit frames, and are
+	   clipped to it like Clip16() clips them: a NaN ends up at -1.0. */
+	inline float ClipFrame(float x) {
+		return x >= -1.0f ? (x <= 1.0f ? x : 1.0f) : -1.0f;
+	}
+
 	class SaturatingAmplifier {
 	public:
 		SaturatingAmplifier() {}
@@ -60,12 +66,12 @@ namespace distortiones {
 			drive_ = 0.0f;
 		}
 
-		void Process(float drive, float limit, short* in, float* out, float* out_raw, size_t in_stride, size_t size) {
+		void Process(float drive, float limit, const float* in, float* out, float* out_raw, size_t in_stride, size_t size) {
 			// Process noise gate and compute raw output
 			parasites_stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
 			float level = level_;
 			for (size_t i = 0; i < size; ++i) {
-				float s = static_cast<float>(*in) / 32768.0f;
+				float s = *in;
 				float error = s * s - level;
 				level += error * (error > 0.0f ? 0.1f : 0.0001f);
 				s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
@@ -134,15 +140,17 @@ namespace distortiones {
 		~DistortionesModulator() {}
 
 		void Init(float sample_rate);
+		// 16-bit frames are converted to and from float frames.
 		void Process(ShortFrame* input, ShortFrame* output, size_t size);
+		void Process(FloatFrame* input, FloatFrame* output, size_t size);
 		template<XmodAlgorithm algorithm>
-		void Process1(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessFreqShifter(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessVocoder(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessDelay(const ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessDoppler(const ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessMeta(ShortFrame* input, ShortFrame* output, size_t size);
+		void Process1(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessFreqShifter(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessVocoder(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessBitcrusher(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessDelay(const FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessDoppler(const FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessMeta(FloatFrame* input, FloatFrame* output, size_t size);
 		inline Parameters* mutable_parameters() { return &parameters_; }
 
 		inline FeatureMode feature_mode() const { return feature_mode_; }
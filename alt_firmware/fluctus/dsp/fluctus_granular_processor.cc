@@ -28,6 +28,7 @@
 
 #include "fluctus/dsp/fluctus_granular_processor.h"
 
+#include <cmath>
 #include <cstring>
 
 #include "stmlib/dsp/parameter_interpolator.h"
@@ -39,9 +40,28 @@ namespace fluctus {
   using namespace std;
   using namespace stmlib;
 
-#ifdef METAMODULE
-  float* lut_sine_window_2048;
-#endif
+  // A quarter of the output's least significant bit.
+  const float kIdleThreshold = 1.0f / 131072.0f;
+
+  // Silent samples after which the spectral textures have faded out.
+  const int32_t kSpectralIdleHold = 16384;
+
+  static inline bool IsSilent(const ShortFrame* frames, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      if (frames[i].l || frames[i].r) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static inline bool IsSilent(const FloatFrame* frames, size_t size) {
+    float peak = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+      peak = max(peak, max(fabsf(frames[i].l), fabsf(frames[i].r)));
+    }
+    return peak < kIdleThreshold;
+  }
 
   void FluctusGranularProcessor::Init(void* large_buffer, size_t large_buffer_size, void* small_buffer,
     size_t small_buffer_size) {
@@ -49,9 +69,12 @@ namespace fluctus {
     buffer_[1] = small_buffer;
     buffer_size_[0] = large_buffer_size;
     buffer_size_[1] = small_buffer_size;
+    float_buffer_ = NULL;
+    float_buffer_size_ = 0;
 
     num_channels_ = 2;
     low_fidelity_ = false;
+    sample_rate_ = 32000.0f;
 
     src_down_.Init();
     src_up_.Init();
@@ -60,13 +83,10 @@ namespace fluctus {
 
     previous_playback_mode_ = PLAYBACK_MODE_LAST;
     reset_buffers_ = true;
+    idle_ = false;
+    silent_samples_ = 0;
+    idle_hold_ = 0;
     dry_wet_ = 0.0f;
-#ifdef METAMODULE
-    lut_sine_window_2048 = new float[2048];
-    for (int32_t i = 0; i < 2048; ++i) {
-      lut_sine_window_2048[i] = lut_sine_window_4096[i * 2];
-    }
-#endif
   }
 
   void FluctusGranularProcessor::ResetFilters() {
@@ -81,13 +101,21 @@ namespace fluctus {
     FloatFrame* input,
     FloatFrame* output,
     size_t size) {
+    // Count how long the recording buffer has only been fed silence.
+    if (!parameters_.freeze || playback_mode_ == PLAYBACK_MODE_KAMMERL) {
+      silent_samples_ = IsSilent(input, size) ?
+        min(silent_samples_ + static_cast<int32_t>(size), idle_hold_) : 0;
+    }
+
     /* Except for spectral mode, all modes require the incoming
        audio signal to be written to the recording buffer. */
     if (playback_mode_ != PLAYBACK_MODE_SPECTRAL_CLOUD) {
       const float* input_samples = &input[0].l;
       const bool write_data = !parameters_.freeze || playback_mode_ == PLAYBACK_MODE_KAMMERL;
       for (int32_t i = 0; i < num_channels_; ++i) {
-        if (resolution() == 8) {
+        if (float_buffers()) {
+          buffer_float_[i].WriteFade(&input_samples[i], size, 2, write_data);
+        } else if (resolution() == 8) {
           buffer_8_[i].WriteFade(&input_samples[i], size, 2, write_data);
         } else {
           buffer_16_[i].WriteFade(&input_samples[i], size, 2, write_data);
@@ -110,7 +138,9 @@ namespace fluctus {
       parameters_.granular.window_shape = parameters_.texture < 0.75f ? parameters_.texture *
         1.333f : 1.0f;
 
-      if (resolution() == 8) {
+      if (float_buffers()) {
+        player_.Play(buffer_float_, parameters_, &output[0].l, size);
+      } else if (resolution() == 8) {
         player_.Play(buffer_8_, parameters_, &output[0].l, size);
       } else {
         player_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -118,7 +148,9 @@ namespace fluctus {
       break;
 
     case PLAYBACK_MODE_STRETCH:
-      if (resolution() == 8) {
+      if (float_buffers()) {
+        ws_player_.Play(buffer_float_, parameters_, &output[0].l, size);
+      } else if (resolution() == 8) {
         ws_player_.Play(buffer_8_, parameters_, &output[0].l, size);
       } else {
         ws_player_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -126,7 +158,9 @@ namespace fluctus {
       break;
 
     case PLAYBACK_MODE_LOOPING_DELAY:
-      if (resolution() == 8) {
+      if (float_buffers()) {
+        looper_.Play(buffer_float_, parameters_, &output[0].l, size);
+      } else if (resolution() == 8) {
         looper_.Play(buffer_8_, parameters_, &output[0].l, size);
       } else {
         looper_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -146,7 +180,9 @@ namespace fluctus {
     break;
 
     case PLAYBACK_MODE_KAMMERL:
-      if (resolution() == 8) {
+      if (float_buffers()) {
+        kammerl_.Play(buffer_float_, parameters_, &output[0].l, size);
+      } else if (resolution() == 8) {
         kammerl_.Play(buffer_8_, parameters_, &output[0].l, size);
       } else {
         kammerl_.Play(buffer_16_, parameters_, &output[0].l, size);
@@ -186,7 +222,9 @@ namespace fluctus {
 
   void FluctusGranularProcessor::Process(ShortFrame* input, ShortFrame* output, size_t size) {
     // TIC.
-    if (silence_ || reset_buffers_ || previous_playback_mode_ != playback_mode_) {
+    // An idle processor sleeps until its input or a trigger wakes it up.
+    idle_ = idle_ && !parameters_.trigger && IsSilent(input, size);
+    if (silence_ || reset_buffers_ || previous_playback_mode_ != playback_mode_ || idle_) {
       short* output_samples = &output[0].l;
       fill(&output_samples[0], &output_samples[size << 1], 0);
       return;
@@ -210,7 +248,7 @@ namespace fluctus {
       (playback_mode_ == PLAYBACK_MODE_KAMMERL && kammerl_.isSlicePlaybackActive()) ?
       parameters_.reverb : 0.0f; // Map reverb parameter to feedback in PLAYBACK_MODE_KAMMERL.
     if ((playback_mode_ != PLAYBACK_MODE_KAMMERL) && playback_mode_ != PLAYBACK_MODE_SPECTRAL_CLOUD) {
-      ONE_POLE(freeze_lp_, parameters_.freeze ? 1.0f : 0.0f, 0.0005f)
+      ONE_POLE(freeze_lp_, parameters_.freeze ? 1.0f : 0.0f, 0.0005f * rate_ratio())
         feedback = parameters_.feedback;
       float cutoff = (20.0f + 100.0f * feedback * feedback) / sample_rate();
       fb_filter_[0].set_f_q<FREQUENCY_FAST>(cutoff, 1.0f);
@@ -257,6 +295,9 @@ namespace fluctus {
       CONSTRAIN(lp_cutoff, 0.0f, 0.499f);
       CONSTRAIN(hp_cutoff, 0.0f, 0.499f);
       float lpq = 1.0f + 3.0f * (1.0f - feedback) * (0.5f - lp_cutoff);
+      // The cutoffs above are relative to 32 kHz.
+      lp_cutoff = min(lp_cutoff * rate_ratio(), 0.499f);
+      hp_cutoff = min(hp_cutoff * rate_ratio(), 0.499f);
       lp_filter_[0].set_f_q<FREQUENCY_FAST>(lp_cutoff, lpq);
       lp_filter_[0].Process<FILTER_MODE_LOW_PASS>(&out_[0].l, &out_[0].l, size, 2);
 
@@ -310,6 +351,11 @@ namespace fluctus {
       output[i].l = SoftConvert(out_[i].l);
       output[i].r = SoftConvert(out_[i].r);
     }
+
+    /* With a silent input, a silent output and a recording buffer holding
+       nothing but silence, there is nothing left to play: skip the following
+       blocks. */
+    idle_ = silent_samples_ >= idle_hold_ && IsSilent(input, size) && IsSilent(out_, size);
   }
 
   void FluctusGranularProcessor::PreparePersistentData() {
@@ -385,6 +431,8 @@ namespace fluctus {
       buffer_16_[1].Resync(persistent_state_.write_head[1]);
     }
     parameters_.freeze = true;
+    silent_samples_ = 0;
+    idle_ = false;
     silence_ = false;
     return true;
   }
@@ -431,25 +479,43 @@ namespace fluctus {
       float sr = sample_rate();
 
       BufferAllocator allocator(workspace, workspace_size);
-      diffuser_.Init(allocator.Allocate<float>(2048));
-      reverb_.Init(allocator.Allocate<uint16_t>(16384));
+#ifndef METAMODULE
+      diffuser_.Init(diffuser_buffer_);
+      reverb_.Init(reverb_buffer_);
+#else
+      diffuser_.Init(allocator.Allocate<float>(Diffuser::E::capacity));
+      reverb_.Init(allocator.Allocate<Reverb::E::T>(Reverb::E::capacity));
+#endif
+      diffuser_.set_sample_rate(sample_rate_);
+      reverb_.set_sample_rate(sample_rate_);
 
       size_t correlator_block_size = (kMaxWSOLASize / 32) + 2;
       uint32_t* correlator_data = allocator.Allocate<uint32_t>(correlator_block_size * 3);
       correlator_.Init(&correlator_data[0], &correlator_data[correlator_block_size]);
-      pitch_shifter_.Init(reinterpret_cast<uint16_t*>(correlator_data));
+#ifndef METAMODULE
+      pitch_shifter_.Init(pitch_shifter_buffer_);
+#else
+      pitch_shifter_.Init(reinterpret_cast<PitchShifter::E::T*>(correlator_data));
+#endif
+      pitch_shifter_.set_sample_rate(sample_rate_);
 
       if (playback_mode_ == PLAYBACK_MODE_SPECTRAL_CLOUD) {
+        // The MetaModule runs a smaller FFT, which reads every other point of the
+        // same window.
 #ifndef METAMODULE
         phase_vocoder_.Init(buffer, buffer_size, lut_sine_window_4096, 4096, num_channels_,
           resolution(), sr);
 #else
-        phase_vocoder_.Init(buffer, buffer_size, lut_sine_window_2048, 2048, num_channels_,
+        phase_vocoder_.Init(buffer, buffer_size, lut_sine_window_4096, 2048, num_channels_,
           resolution(), sr);
 #endif
       } else {
+        int32_t float_buffer_size = float_buffer_size_ / num_channels_;
         for (int32_t i = 0; i < num_channels_; ++i) {
-          if (resolution() == 8) {
+          if (float_buffers()) {
+            buffer_float_[i].Init(&float_buffer_[i * float_buffer_size], float_buffer_size,
+              tail_buffer_[i]);
+          } else if (resolution() == 8) {
             buffer_8_[i].Init(buffer[i], (buffer_size[i]), tail_buffer_[i]);
           } else {
             buffer_16_[i].Init(buffer[i], ((buffer_size[i]) >> 1), tail_buffer_[i]);
@@ -457,10 +523,23 @@ namespace fluctus {
         }
         int32_t num_grains = (num_channels_ == 1 ? 40 : 32) * (low_fidelity_ ? 23 : 16) >> 4;
         player_.Init(num_channels_, num_grains);
+        player_.set_grain_size_scale(1.0f / rate_ratio());
         ws_player_.Init(&correlator_, num_channels_);
+        ws_player_.set_window_size_scale(1.0f / rate_ratio());
         looper_.Init(num_channels_);
         kammerl_.Init(num_channels_);
       }
+      if (playback_mode_ == PLAYBACK_MODE_SPECTRAL_CLOUD) {
+        idle_hold_ = kSpectralIdleHold;
+      } else if (float_buffers()) {
+        idle_hold_ = buffer_float_[0].size();
+      } else if (resolution() == 8) {
+        idle_hold_ = buffer_8_[0].size();
+      } else {
+        idle_hold_ = buffer_16_[0].size();
+      }
+      silent_samples_ = 0;
+      idle_ = false;
       reset_buffers_ = false;
       previous_playback_mode_ = playback_mode_;
     }
@@ -468,7 +547,9 @@ namespace fluctus {
     if (playback_mode_ == PLAYBACK_MODE_SPECTRAL_CLOUD) {
       phase_vocoder_.Buffer();
     } else if (playback_mode_ == PLAYBACK_MODE_STRETCH) {
-      if (resolution() == 8) {
+      if (float_buffers()) {
+        ws_player_.LoadCorrelator(buffer_float_);
+      } else if (resolution() == 8) {
         ws_player_.LoadCorrelator(buffer_8_);
       } else {
         ws_player_.LoadCorrelator(buffer_16_);
@@ -111,6 +111,22 @@ namespace fluctus {
       low_fidelity_ = low_fidelity;
     }
 
+    /* Runs at sample_rate rather than at the module's 32 kHz: grain sizes,
+       the stretch mode's windows, filter cutoffs and the effects' delays are
+       rescaled to sound the same. Up to kMaxDelayStretch times 32 kHz. */
+    inline void set_sample_rate(float sample_rate) {
+      reset_buffers_ = reset_buffers_ || sample_rate != sample_rate_;
+      sample_rate_ = sample_rate;
+    }
+
+    /* Records hi-fi audio as floats into buffer, size floats long, instead of
+       into the 16-bit sample memory. NULL goes back to the sample memory. */
+    inline void set_float_buffer(float* buffer, size_t size) {
+      reset_buffers_ = reset_buffers_ || buffer != float_buffer_ || size != float_buffer_size_;
+      float_buffer_ = buffer;
+      float_buffer_size_ = size;
+    }
+
     inline int32_t quality() const {
       int32_t quality = 0;
       if (num_channels_ == 1) quality |= 1;
@@ -129,8 +145,17 @@ namespace fluctus {
       return low_fidelity_ ? 8 : 16;
     }
 
+    inline bool float_buffers() const {
+      return float_buffer_ && !low_fidelity_;
+    }
+
     inline float sample_rate() const {
-      return 32000.0f / (low_fidelity_ ? kDownsamplingFactor : 1);
+      return sample_rate_ / (low_fidelity_ ? kDownsamplingFactor : 1);
+    }
+
+    // How much shorter a sample is than at the module's 32 kHz.
+    inline float rate_ratio() const {
+      return 32000.0f / sample_rate_;
     }
 
     void ResetFilters();
@@ -140,15 +165,24 @@ namespace fluctus {
     PlaybackMode previous_playback_mode_;
     int32_t num_channels_;
     bool low_fidelity_;
+    float sample_rate_;
 
     bool silence_;
     bool reset_buffers_;
+    bool idle_;
+    // Consecutive silent samples written to the recording buffer, and how many
+    // it takes to overwrite all of it.
+    int32_t silent_samples_;
+    int32_t idle_hold_;
     float freeze_lp_;
     float dry_wet_;
 
     void* buffer_[2];
     size_t buffer_size_[2];
 
+    float* float_buffer_;
+    size_t float_buffer_size_;
+
     Correlator correlator_;
 
     GranularSamplePlayer player_;
@@ -166,6 +200,7 @@ namespace fluctus {
 
     AudioBuffer<RESOLUTION_8_BIT_MU_LAW> buffer_8_[2];
     AudioBuffer<RESOLUTION_16_BIT> buffer_16_[2];
+    AudioBuffer<RESOLUTION_32_BIT_FLOAT> buffer_float_[2];
 
     FloatFrame in_[kMaxBlockSize];
     FloatFrame in_downsampled_[kMaxBlockSize / kDownsamplingFactor];
@@ -175,6 +210,14 @@ namespace fluctus {
 
     int16_t tail_buffer_[2][256];
 
+#ifndef METAMODULE
+    // The effects' delay memory, sized for the highest rate, does not fit in
+    // the workspace.
+    float diffuser_buffer_[Diffuser::E::capacity];
+    PitchShifter::E::T pitch_shifter_buffer_[PitchShifter::E::capacity];
+    Reverb::E::T reverb_buffer_[Reverb::E::capacity];
+#endif
+
     Parameters parameters_;
 
     SampleRateConverter<-kDownsamplingFactor, 45, src_filter_1x_2_45> src_down_;
@@ -65,6 +65,13 @@ class GranularSamplePlayer {
     num_grains_ = 0.0f;
     num_channels_ = num_channels;
     grain_size_hint_ = 1024.0f;
+    grain_size_scale_ = 1.0f;
+  }
+
+  // Grain sizes are tabulated in samples at the module's rate: running at
+  // another rate, they are scaled so that grains last as long.
+  inline void set_grain_size_scale(float grain_size_scale) {
+    grain_size_scale_ = grain_size_scale;
   }
   
   template<Resolution resolution>
@@ -85,12 +92,15 @@ class GranularSamplePlayer {
     
     // Build a list of available grains.
     int32_t num_available_grains = FillAvailableGrainsList();
+
+    // Draws once per sample: keep the random stream local.
+    Random::Stream stream;
     
     // Try to schedule new grains.
     bool seed_trigger = parameters.trigger;
     for (size_t t = 0; t < size; ++t) {
       grain_rate_phasor_ += 1.0f;
-      bool seed_probabilistic = Random::GetFloat() < p
+      bool seed_probabilistic = stream.GetFloat() < p
           && target_num_grains > num_grains_;
       bool seed_deterministic = grain_rate_phasor_ >= space_between_grains;
       bool seed = seed_probabilistic || seed_deterministic || seed_trigger;
@@ -111,7 +121,8 @@ class GranularSamplePlayer {
             t,
             buffer->size(),
             buffer->head() - size + t,
-            quality);
+            quality,
+            &stream);
         grain_rate_phasor_ = 0.0f;
         seed_trigger = false;
       }
@@ -181,14 +192,16 @@ class GranularSamplePlayer {
       int32_t pre_delay,
       int32_t buffer_size,
       int32_t buffer_head,
-      GrainQuality quality) {
+      GrainQuality quality,
+      Random::Stream* stream) {
     float position = parameters.position;
     float pitch = parameters.pitch;
     float window_shape = parameters.granular.window_shape;
-    float grain_size = Interpolate(lut_grain_size, parameters.size, 256.0f);
+    float grain_size = Interpolate(lut_grain_size, parameters.size, 256.0f) *
+        grain_size_scale_;
     float pitch_ratio = SemitonesToRatio(pitch);
     float inv_pitch_ratio = SemitonesToRatio(-pitch);
-    float pan = 0.5f + parameters.stereo_spread * (Random::GetFloat() - 0.5f);
+    float pan = 0.5f + parameters.stereo_spread * (stream->GetFloat() - 0.5f);
     float gain_l, gain_r;
     if (num_channels_ == 1) {
       gain_l = Interpolate(lut_sin, pan, 256.0f);
@@ -242,6 +255,7 @@ class GranularSamplePlayer {
   float num_grains_;
   float gain_normalization_;
   float grain_size_hint_;
+  float grain_size_scale_;
   float grain_rate_phasor_;
   
   Grain grains_[kMaxNumGrains];
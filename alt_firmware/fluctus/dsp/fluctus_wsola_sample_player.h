@@ -76,11 +76,18 @@ namespace fluctus {
       search_target_ = 0;
 
       window_size_ = kMaxWSOLASize / 2;
+      window_size_scale_ = 1.0f;
       env_phase_ = 0.0f;
       env_phase_increment_ = 0.5f;
       elapsed_ = 0;
     }
 
+    // Window sizes are counted at the module's rate: running at another rate,
+    // they are scaled so that windows last as long.
+    inline void set_window_size_scale(float window_size_scale) {
+      window_size_scale_ = window_size_scale;
+    }
+
     template<Resolution resolution>
     void Play(const AudioBuffer<resolution>* buffer, const Parameters& parameters, float* out, size_t size) {
       elapsed_++;
@@ -166,8 +173,9 @@ namespace fluctus {
       if (correlator_loaded_) {
         return;
       }
+      // Longer windows are read with a longer stride, to fit the correlator.
       float stride = window_size_ / 2048.0f;
-      CONSTRAIN(stride, 1.0f, 2.0f);
+      CONSTRAIN(stride, 1.0f, 2.0f * window_size_scale_);
       stride *= 65536.0f;
       int32_t increment = static_cast<int32_t>(stride * (next_pitch_ratio_ < 1.25f ? 1.25f : next_pitch_ratio_));
       int32_t num_samples = 0;
@@ -203,7 +211,7 @@ namespace fluctus {
       next_pitch_ratio_ = pitch_ratio;
 
       float size_factor = SemitonesToRatio((size_factor_ - 1.0f) * 60.0f);
-      int32_t new_window_size = static_cast<int32_t>(size_factor * kMaxWSOLASize);
+      int32_t new_window_size = static_cast<int32_t>(size_factor * kMaxWSOLASize * window_size_scale_);
       if (std::abs(new_window_size - window_size_) > 64) {
         int32_t error = (new_window_size - window_size_) >> 5;
         new_window_size = window_size_ + error;
@@ -232,6 +240,7 @@ namespace fluctus {
     Window windows_[2];
 
     int32_t window_size_;
+    float window_size_scale_;
     int32_t num_channels_;
 
     float pitch_;
@@ -31,19 +31,24 @@
 
 #include "stmlib/stmlib.h"
 
+#include <cmath>
+
 #include "fluctus/dsp/fx/fluctus_fx_engine.h"
 
 namespace fluctus {
 
 class Reverb {
  public:
+  typedef FxEngine<16384, DelayFormat<FORMAT_12_BIT>::format> E;
+
   Reverb() { }
   ~Reverb() { }
   
-  void Init(uint16_t* buffer) {
+  void Init(E::T* buffer) {
     engine_.Init(buffer);
     engine_.SetLFOFrequency(LFO_1, 0.5f / 32000.0f);
     engine_.SetLFOFrequency(LFO_2, 0.3f / 32000.0f);
+    rate_ratio_ = 1.0f;
     lp_ = 0.7f;
     diffusion_ = 0.625f;
   }
@@ -147,6 +152,16 @@ class Reverb {
     input_gain_ = input_gain;
   }
 
+  // At other rates than 32 kHz, the delay lines are stretched, and the LFOs
+  // and the damping rescaled, so that the tail lasts as long and is as
+  // bright. Clears the tail.
+  inline void set_sample_rate(float sample_rate) {
+    rate_ratio_ = 32000.0f / sample_rate;
+    engine_.set_stretch(sample_rate / 32000.0f);
+    engine_.SetLFOFrequency(LFO_1, 0.5f / sample_rate);
+    engine_.SetLFOFrequency(LFO_2, 0.3f / sample_rate);
+  }
+
   inline void set_time(float reverb_time) {
     reverb_time_ = reverb_time;
   }
@@ -156,13 +171,13 @@ class Reverb {
   }
   
   inline void set_lp(float lp) {
-    lp_ = lp;
+    lp_ = rate_ratio_ == 1.0f ? lp : 1.0f - powf(1.0f - lp, rate_ratio_);
   }
   
  private:
-  typedef FxEngine<16384, FORMAT_12_BIT> E;
   E engine_;
   
+  float rate_ratio_;
   float amount_;
   float input_gain_;
   float reverb_time_;
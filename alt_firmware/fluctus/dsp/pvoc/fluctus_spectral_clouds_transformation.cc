@@ -33,13 +33,14 @@
 #include <cstring>
 #include <numeric>
 
-#include "stmlib/dsp/atan.h"
 #include "stmlib/dsp/units.h"
 #include "stmlib/utils/random.h"
 
 #include "fluctus/dsp/fluctus_frame.h"
 #include "fluctus/dsp/fluctus_parameters.h"
 
+#include "clouds/dsp/pvoc/frame_kernels.h"
+
 namespace fluctus {
 
 	using namespace std;
@@ -130,8 +131,10 @@ namespace fluctus {
 		}
 
 		int32_t amount = static_cast<int32_t>(phase_randomization_parameter * 32768.0f);
-		for (int32_t i = 1; i < size_ - 1; ++i) {
-			phases_[i] += static_cast<int32_t>(stmlib::Random::GetSample()) * amount >> 14;
+		if (amount) {
+			uint32_t rng_state = stmlib::Random::state();
+			clouds::AddRandomPhases(&phases_[1], size_ - 2, amount, &rng_state);
+			stmlib::Random::Seed(rng_state);
 		}
 		size_t band_idx = 0;
 		const float base = Interpolate(lut_freq_log, current_num_freq_bands_parameter_, LUT_FREQ_LOG_SIZE - 1);
@@ -166,7 +169,7 @@ namespace fluctus {
 		const float* imag = &fft_data[size_];
 		float* magnitude = &fft_data[0];
 		for (int32_t i = 1; i < size_; ++i) {
-			phases_[i] = fast_atan2r(imag[i], real[i], &magnitude[i]);
+			phases_[i] = clouds::BinRectangularToPolar(imag[i], real[i], &magnitude[i]);
 		}
 	}
 
@@ -174,7 +177,7 @@ namespace fluctus {
 		float* real = &fft_out[0];
 		float* imag = &fft_out[size_];
 		for (int32_t i = 1; i < size_; ++i) {
-			fast_p2r(mags[i], phases_[i], &real[i], &imag[i]);
+			clouds::BinPolarToRectangular(mags[i], phases_[i], &real[i], &imag[i]);
 		}
 	}
 }  // namespace fluctus
\ No newline at end of file
@@ -55,12 +55,6 @@ namespace fluctus {
 		void PolarToRectangular(const float* mags, float* fft_data);
 
 
-		inline void fast_p2r(float magnitude, uint16_t angle, float* re, float* im) {
-			angle >>= 6;
-			*re = magnitude * lut_sin[angle + 256];
-			*im = magnitude * lut_sin[angle];
-		}
-
 		FFT* fft_;
 
 		int32_t size_;
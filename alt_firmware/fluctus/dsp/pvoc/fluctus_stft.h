@@ -32,11 +32,14 @@
 #include "stmlib/stmlib.h"
 
 // #define USE_ARM_FFT
+// #define USE_SHY_FFT
 
-#ifdef USE_ARM_FFT
+#if defined(USE_ARM_FFT)
   #include <arm_math.h>
-#else
+#elif defined(USE_SHY_FFT)
   #include "stmlib/fft/shy_fft.h"
+#else
+  #include "clouds/dsp/pvoc/real_fft.h"
 #endif  // USE_ARM_FFT
 
 namespace fluctus {
@@ -44,10 +47,12 @@ namespace fluctus {
 struct Parameters;
 
 const size_t kMaxFftSize = 4096;
-#ifdef USE_ARM_FFT
+#if defined(USE_ARM_FFT)
   typedef arm_rfft_fast_instance_f32 FFT;
-#else
+#elif defined(USE_SHY_FFT)
   typedef stmlib::ShyFFT<float, kMaxFftSize, stmlib::RotationPhasor> FFT;
+#else
+  typedef clouds::RealFFT<kMaxFftSize> FFT;
 #endif  // USE_ARM_FFT
 
 typedef class SpectralCloudsTransformation Modifier;
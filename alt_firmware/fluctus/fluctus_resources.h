@@ -38,23 +38,14 @@
 
 
 
-namespace fluctus {
-
-typedef uint8_t ResourceId;
-
-extern const float* src_filter_table[];
-
-extern const int16_t* lookup_table_int16_table[];
-
-extern const float* lookup_table_table[];
+// Tables identical to the clouds ones are shared, not duplicated.
+namespace clouds {
 
 extern const float src_filter_1x_2_31[];
 extern const float src_filter_1x_2_45[];
 extern const float src_filter_1x_2_63[];
 extern const float src_filter_1x_2_91[];
 extern const int16_t lut_db[];
-extern const float lut_freq_log[];
-extern const float lut_inv_tanh[];
 extern const float lut_sin[];
 extern const float lut_window[];
 extern const float lut_xfade_in[];
@@ -63,6 +54,34 @@ extern const float lut_sine_window_4096[];
 extern const float lut_cutoff[];
 extern const float lut_grain_size[];
 extern const float lut_quantized_pitch[];
+
+}  // namespace clouds
+
+namespace fluctus {
+
+typedef uint8_t ResourceId;
+
+extern const float* src_filter_table[];
+
+extern const int16_t* lookup_table_int16_table[];
+
+extern const float* lookup_table_table[];
+
+using clouds::src_filter_1x_2_31;
+using clouds::src_filter_1x_2_45;
+using clouds::src_filter_1x_2_63;
+using clouds::src_filter_1x_2_91;
+using clouds::lut_db;
+extern const float lut_freq_log[];
+extern const float lut_inv_tanh[];
+using clouds::lut_sin;
+using clouds::lut_window;
+using clouds::lut_xfade_in;
+using clouds::lut_xfade_out;
+using clouds::lut_sine_window_4096;
+using clouds::lut_cutoff;
+using clouds::lut_grain_size;
+using clouds::lut_quantized_pitch;
 #define SRC_FILTER_1X_2_31 0
 #define SRC_FILTER_1X_2_31_SIZE 31
 #define SRC_FILTER_1X_2_45 1
@@ -79,7 +79,7 @@ namespace mutuus {
     filter_[3].Init();
   }
 
-  void MutuusModulator::ProcessFreqShifter(ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessFreqShifter(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     float* carrier_i = &src_buffer_[0][0];
     float* carrier_q = &src_buffer_[0][size];
@@ -106,7 +106,7 @@ namespace mutuus {
       quadrature_oscillator_.Render(shape, frequency, carrier_i, carrier_q, size);
     } else {
       for (size_t i = 0; i < size; ++i) {
-        carrier[i] = static_cast<float>(input[i].l) / 32768.0f;
+        carrier[i] = input[i].l;
       }
       quadrature_transform_[0].Process(carrier, carrier_i, carrier_q, size);
 
@@ -137,10 +137,10 @@ namespace mutuus {
       float modulator_i, modulator_q;
 
       // Start from the signal from input 2, with non-linear gain.
-      float in = static_cast<float>(input->r) / 32768.0f;
+      float in = input->r;
 
       if (parameters_.carrier_shape) {
-        in += static_cast<float>(input->l) / 32768.0f;
+        in += input->l;
       }
 
       float modulator = in;
@@ -174,8 +174,8 @@ namespace mutuus {
       main += wet_dry * (in - main);
       aux += wet_dry * (in - aux);
 
-      output->l = Clip16(static_cast<int32_t>(main * 32768.0f));
-      output->r = Clip16(static_cast<int32_t>(aux * 32768.0f));
+      output->l = ClipFrame(main);
+      output->r = ClipFrame(aux);
       ++output;
       ++input;
     }
@@ -183,7 +183,7 @@ namespace mutuus {
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessMeta(ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessMeta(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     const float* modulator = buffer_[1];
     float* main_output = buffer_[0];
@@ -200,8 +200,8 @@ namespace mutuus {
       fill(&aux_output[0], &aux_output[size], 0.0f);
     }
 
-    // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-    short* input_samples = &input->l;
+    // Apply VCA/saturation (5.8% per channel)
+    const float* input_samples = &input->l;
     for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
       amplifier_[i].Process(parameters_.channel_drive[i], 1.0f - vocoder_amount, input_samples + i,
         buffer_[i], aux_output, 2, size);
@@ -211,7 +211,7 @@ namespace mutuus {
     if (parameters_.carrier_shape) {
       // Scale phase-modulation input.
       for (size_t i = 0; i < size; ++i) {
-        internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+        internal_modulation_[i] = input[i].l;
       }
       // Xmod: sine, triangle saw.
       // Vocoder: saw, pulse, noise.
@@ -285,12 +285,12 @@ namespace mutuus {
       }
     }
 
-    // Convert back to integer and clip.
-    Convert(output, main_output, aux_output, 16384.0f, size);
+    // Clip.
+    Convert(output, main_output, aux_output, 0.5f, size);
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessDualFilter(ShortFrame* input, ShortFrame* output, size_t size, FilterConfig config) {
+  void MutuusModulator::ProcessDualFilter(FloatFrame* input, FloatFrame* output, size_t size, FilterConfig config) {
     const float* carrier = buffer_[0];
     const float* modulator = buffer_[1];
     float* main_output = buffer_[0];
@@ -324,11 +324,11 @@ namespace mutuus {
       aux_output[i] = out[1];
     }
 
-    Convert(output, main_output, aux_output, 32768.0f, size);
+    Convert(output, main_output, aux_output, 1.0f, size);
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessReverb(ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessReverb(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     const float* modulator = buffer_[1];
     float* main_output = buffer_[0];
@@ -351,11 +351,11 @@ namespace mutuus {
 
     reverb.Process(main_output, aux_output, size);
 
-    Convert(output, main_output, aux_output, 32768.0f, size);
+    Convert(output, main_output, aux_output, 1.0f, size);
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessEnsemble(ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessEnsemble(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     const float* modulator = buffer_[1];
     float* main_output = buffer_[0];
@@ -383,11 +383,11 @@ namespace mutuus {
     ensemble.set_depth(depth);
     ensemble.Process(main_output, aux_output, size);
 
-    Convert(output, main_output, aux_output, 32768.0f, size);
+    Convert(output, main_output, aux_output, 1.0f, size);
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessChebyschev(ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessChebyschev(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     const float* modulator = buffer_[1];
     float* main_output = buffer_[0];
@@ -418,11 +418,11 @@ namespace mutuus {
 
     src_down2_[0].Process(oversampled_output, main_output, size * kLessOversampling);
 
-    Convert(output, main_output, aux_output, 16384.0f, size);
+    Convert(output, main_output, aux_output, 0.5f, size);
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessBitcrusher(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     const float* modulator = buffer_[1];
     float* main_output = buffer_[0];
@@ -444,13 +444,13 @@ namespace mutuus {
     ProcessXmod<ALGORITHM_BITCRUSHER>(previous_parameters_.modulation_algorithm, parameters_.modulation_algorithm,
       mod_1, mod_2, carrier, modulator, main_output, aux_output, size);
 
-    // Convert back to integer and clip.
-    Convert(output, main_output, aux_output, 16384.0f, size);
+    // Clip.
+    Convert(output, main_output, aux_output, 0.5f, size);
     previous_parameters_ = parameters_;
 
   }
 
-  void MutuusModulator::ProcessDelay(const ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessDelay(const FloatFrame* input, FloatFrame* output, size_t size) {
 
     ShortFrame* buffer = delay_buffer_;
 
@@ -486,8 +486,8 @@ namespace mutuus {
       int direction = delay_lp_rate > 0.0f ? 1 : -1;
 
       FloatFrame in;
-      in.l = static_cast<float>(input->l) / 32768.0f;
-      in.r = static_cast<float>(input->r) / 32768.0f;
+      in.l = input->l;
+      in.r = input->r;
 
       FloatFrame fb;
 
@@ -633,16 +633,16 @@ namespace mutuus {
       if (parameters_.carrier_shape == 0) {
         /* If open feedback loop, AUX is the wet signal and OUT
            crossfades between inputs */
-        in.r = static_cast<float>(input->r) / 32768.0f;
-        output->l = Clip16((fade_out * in.l + fade_in * in.r) * 32768.0f);
-        output->r = Clip16(wet.r * 32768.0f);
+        in.r = input->r;
+        output->l = ClipFrame(fade_out * in.l + fade_in * in.r);
+        output->r = ClipFrame(wet.r);
       } else if (parameters_.carrier_shape == 2) {
         // Analog mode -> soft-clipping.
-        output->l = SoftConvert((fade_out * in.l + fade_in * wet.l) * 2.0f);
-        output->r = SoftConvert((fade_out * in.r + fade_in * wet.r) * 2.0f);
+        output->l = ClipFrame(SoftLimit(fade_out * in.l + fade_in * wet.l));
+        output->r = ClipFrame(SoftLimit(fade_out * in.r + fade_in * wet.r));
       } else {
-        output->l = Clip16((fade_out * in.l + fade_in * wet.l) * 32768.0f);
-        output->r = Clip16((fade_out * in.r + fade_in * wet.r) * 32768.0f);
+        output->l = ClipFrame(fade_out * in.l + fade_in * wet.l);
+        output->r = ClipFrame(fade_out * in.r + fade_in * wet.r);
       }
 
       feedback += feedback_increment;
@@ -656,7 +656,7 @@ namespace mutuus {
     previous_parameters_ = parameters_;
   }
 
-  void MutuusModulator::ProcessDoppler(const ShortFrame* input, ShortFrame* output, size_t size) {
+  void MutuusModulator::ProcessDoppler(const FloatFrame* input, FloatFrame* output, size_t size) {
     ShortFrame* buffer = delay_buffer_;
 
     float x = previous_parameters_.raw_algorithm * 2.0f - 1.0f;
@@ -689,8 +689,8 @@ namespace mutuus {
     while (size--) {
 
       // Write input to buffer.
-      buffer[doppler_cursor].l = input->l;
-      buffer[doppler_cursor].r = input->r;
+      buffer[doppler_cursor].l = Clip16(static_cast<int32_t>(input->l * 32768.0f));
+      buffer[doppler_cursor].r = Clip16(static_cast<int32_t>(input->r * 32768.0f));
 
       // LFOs.
       float sin = Interpolate(lut_sin, doppler_lfo_phase, 1024.0f);
@@ -743,8 +743,8 @@ namespace mutuus {
       float fade_in = Interpolate(lut_xfade_in, (doppler_angle + 1.0f) / 2.0f, 256.0f);
       float fade_out = Interpolate(lut_xfade_out, (doppler_angle + 1.0f) / 2.0f, 256.0f);
 
-      output->l = s2_l * fade_in + s1_l * fade_out;
-      output->r = s1_r * fade_in + s2_r * fade_out;
+      output->l = static_cast<short>(s2_l * fade_in + s1_l * fade_out) / 32768.0f;
+      output->r = static_cast<short>(s1_r * fade_in + s2_r * fade_out) / 32768.0f;
 
       x += x_increment;
       y += y_increment;
@@ -761,6 +761,21 @@ namespace mutuus {
   }
 
   void MutuusModulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
+    FloatFrame float_input[kMaxBlockSize];
+    FloatFrame float_output[kMaxBlockSize];
+
+    for (size_t i = 0; i < size; ++i) {
+      float_input[i].l = static_cast<float>(input[i].l) / 32768.0f;
+      float_input[i].r = static_cast<float>(input[i].r) / 32768.0f;
+    }
+    Process(float_input, float_output, size);
+    for (size_t i = 0; i < size; ++i) {
+      output[i].l = Clip16(static_cast<int32_t>(float_output[i].l * 32768.0f));
+      output[i].r = Clip16(static_cast<int32_t>(float_output[i].r * 32768.0f));
+    }
+  }
+
+  void MutuusModulator::Process(FloatFrame* input, FloatFrame* output, size_t size) {
     if (reset_fx) {
       reverb.Clear();
       ensemble.Reset();
@@ -58,6 +58,12 @@ namespace mutuus {
 	typedef struct { short l; short r; } ShortFrame;
 	typedef struct { float l; float r; } FloatFrame;
 
+	/* Float frames span the -1.0 to 1.0 range of 16-bit frames, and are
+	   clipped to it like Clip16() clips them: a NaN ends up at -1.0. */
+	inline float ClipFrame(float x) {
+		return x >= -1.0f ? (x <= 1.0f ? x : 1.0f) : -1.0f;
+	}
+
 	class SaturatingAmplifier {
 	public:
 		SaturatingAmplifier() {}
@@ -66,13 +72,13 @@ namespace mutuus {
 			drive_ = 0.0f;
 		}
 
-		void Process(float drive, float limit, short* in, float* out, float* out_raw,
+		void Process(float drive, float limit, const float* in, float* out, float* out_raw,
 			size_t in_stride, size_t size) {
 			// Process noise gate and compute raw output.
 			stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
 			float level = level_;
 			for (size_t i = 0; i < size; ++i) {
-				float s = static_cast<float>(*in) / 32768.0f;
+				float s = *in;
 				float error = s * s - level;
 				level += error * (error > 0.0f ? 0.1f : 0.0001f);
 				s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
@@ -139,16 +145,18 @@ namespace mutuus {
 		~MutuusModulator() {}
 
 		void Init(float sample_rate, uint16_t* reverb_buffer);
+		// 16-bit frames are converted to and from float frames.
 		void Process(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessChebyschev(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessFreqShifter(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessDelay(const ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessDualFilter(ShortFrame* input, ShortFrame* output, size_t size, FilterConfig config);
-		void ProcessReverb(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessEnsemble(ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessDoppler(const ShortFrame* input, ShortFrame* output, size_t size);
-		void ProcessMeta(ShortFrame* input, ShortFrame* output, size_t size);
+		void Process(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessChebyschev(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessFreqShifter(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessBitcrusher(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessDelay(const FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessDualFilter(FloatFrame* input, FloatFrame* output, size_t size, FilterConfig config);
+		void ProcessReverb(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessEnsemble(FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessDoppler(const FloatFrame* input, FloatFrame* output, size_t size);
+		void ProcessMeta(FloatFrame* input, FloatFrame* output, size_t size);
 		inline Parameters* mutable_parameters() { return &parameters_; }
 
 		inline FeatureMode feature_mode() const { return feature_mode_; }
@@ -185,24 +193,24 @@ namespace mutuus {
 		float doppler_distance = 1.0f;
 		float doppler_angle = 1.0f;
 
-		void ApplyAmplification(ShortFrame* input, const float* level, float* aux_output, size_t size, bool raw_level) {
+		void ApplyAmplification(FloatFrame* input, const float* level, float* aux_output, size_t size, bool raw_level) {
 			if (!parameters_.carrier_shape || raw_level) {
 				fill(&aux_output[0], &aux_output[size], 0.0f);
 			}
-			// Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-			short* input_samples = &input->l;
+			// Apply VCA/saturation (5.8% per channel)
+			const float* input_samples = &input->l;
 
 			for (int32_t i = (parameters_.carrier_shape && !raw_level) ? 1 : 0; i < 2; ++i) {
 				amplifier_[i].Process(level[i], 1.0f, input_samples + i, buffer_[i], aux_output, 2, size);
 			}
 		}
 
-		void RenderCarrier(ShortFrame* input, float* carrier, float* aux_output, size_t size, bool exclude_sine = false,
+		void RenderCarrier(FloatFrame* input, float* carrier, float* aux_output, size_t size, bool exclude_sine = false,
 			bool amp_control = false, float level = 0.5f
 		) {
 			// Scale phase-modulation input.
 			for (size_t i = 0; i < size; ++i) {
-				internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+				internal_modulation_[i] = input[i].l;
 			}
 
 			OscillatorShape xmod_shape = static_cast<OscillatorShape>(parameters_.carrier_shape - (exclude_sine ? 0 : 1));
@@ -213,10 +221,10 @@ namespace mutuus {
 			}
 		}
 
-		void Convert(ShortFrame* output, const float* main_output, const float* aux_output, float aux_gain, size_t size) {
+		void Convert(FloatFrame* output, const float* main_output, const float* aux_output, float aux_gain, size_t size) {
 			while (size--) {
-				output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-				output->r = Clip16(static_cast<int32_t>(*aux_output * aux_gain));
+				output->l = ClipFrame(*main_output);
+				output->r = ClipFrame(*aux_output * aux_gain);
 				++main_output;
 				++aux_output;
 				++output;
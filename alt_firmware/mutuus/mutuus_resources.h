@@ -38,15 +38,8 @@
 
 
 
-namespace mutuus {
-
-typedef uint8_t ResourceId;
-
-extern const float* filter_bank_table[];
-
-extern const float* lookup_table_table[];
-
-extern const float* wav_table[];
+// Tables identical to the distortiones and warps ones are shared, not duplicated.
+namespace distortiones {
 
 extern const float fb__87_8000[];
 extern const float fb_110_8000[];
@@ -60,16 +53,21 @@ extern const float fb_554_8000[];
 extern const float fb_698_8000[];
 extern const float fb_880_8000[];
 extern const float fb_1109_8000[];
-extern const float fb_1397_8000[];
 extern const float fb_1760_32000[];
 extern const float fb_2217_32000[];
 extern const float fb_2794_32000[];
 extern const float fb_3520_32000[];
 extern const float fb_4435_32000[];
-extern const float fb_5588_32000[];
 extern const float fb_7040_96000[];
-extern const float lut_sin[];
 extern const float lut_arcsin[];
+
+}  // namespace distortiones
+
+namespace warps {
+
+extern const float fb_1397_8000[];
+extern const float fb_5588_32000[];
+extern const float lut_sin[];
 extern const float lut_xfade_in[];
 extern const float lut_xfade_out[];
 extern const float lut_bipolar_fold[];
@@ -83,6 +81,54 @@ extern const float wav_harmonics_i[];
 extern const float wav_harmonics_q[];
 extern const float wav_buzzy_i[];
 extern const float wav_buzzy_q[];
+
+}  // namespace warps
+
+namespace mutuus {
+
+typedef uint8_t ResourceId;
+
+extern const float* filter_bank_table[];
+
+extern const float* lookup_table_table[];
+
+extern const float* wav_table[];
+
+using distortiones::fb__87_8000;
+using distortiones::fb_110_8000;
+using distortiones::fb_139_8000;
+using distortiones::fb_175_8000;
+using distortiones::fb_220_8000;
+using distortiones::fb_277_8000;
+using distortiones::fb_349_8000;
+using distortiones::fb_440_8000;
+using distortiones::fb_554_8000;
+using distortiones::fb_698_8000;
+using distortiones::fb_880_8000;
+using distortiones::fb_1109_8000;
+using warps::fb_1397_8000;
+using distortiones::fb_1760_32000;
+using distortiones::fb_2217_32000;
+using distortiones::fb_2794_32000;
+using distortiones::fb_3520_32000;
+using distortiones::fb_4435_32000;
+using warps::fb_5588_32000;
+using distortiones::fb_7040_96000;
+using warps::lut_sin;
+using distortiones::lut_arcsin;
+using warps::lut_xfade_in;
+using warps::lut_xfade_out;
+using warps::lut_bipolar_fold;
+using warps::lut_midi_to_f_high;
+using warps::lut_midi_to_f_low;
+using warps::lut_pot_curve;
+using warps::lut_ap_poles;
+using warps::wav_sine_i;
+using warps::wav_sine_q;
+using warps::wav_harmonics_i;
+using warps::wav_harmonics_q;
+using warps::wav_buzzy_i;
+using warps::wav_buzzy_q;
 #define FB__87_8000 0
 #define FB__87_8000_SIZE 7
 #define FB_110_8000 1
@@ -31,7 +31,7 @@
 namespace parasites_stmlib {
 
 /* static */
-uint32_t Random::rng_state_ = 0x21;
+thread_local uint32_t Random::rng_state_ = Random::kDefaultSeed;
 
 /* input x is a 0.16 fixed-point number in [0,1)
    function returns -log2(x) as a 4.16 fixed-point number in [0, 16)
@@ -35,9 +35,57 @@ namespace parasites_stmlib {
 
 class Random {
  public:
+  // Same as stmlib::Random::Scope.
+  class Scope {
+   public:
+    explicit Scope(uint32_t* state) : state_(state), saved_state_(rng_state_) {
+      rng_state_ = *state;
+    }
+
+    ~Scope() {
+      *state_ = rng_state_;
+      rng_state_ = saved_state_;
+    }
+
+   private:
+    uint32_t* state_;
+    uint32_t saved_state_;
+
+    DISALLOW_COPY_AND_ASSIGN(Scope);
+  };
+
+  // Same as stmlib::Random::Stream.
+  class Stream {
+   public:
+    Stream() : state_(rng_state_) { }
+    ~Stream() {
+      rng_state_ = state_;
+    }
+
+    inline uint32_t GetWord() {
+      state_ = state_ * 1664525L + 1013904223L;
+      return state_;
+    }
+
+    inline int16_t GetSample() {
+      return static_cast<int16_t>(GetWord() >> 16);
+    }
+
+    inline float GetFloat() {
+      return static_cast<float>(GetWord()) / 4294967296.0f;
+    }
+
+   private:
+    uint32_t state_;
+
+    DISALLOW_COPY_AND_ASSIGN(Stream);
+  };
+
+  static const uint32_t kDefaultSeed = 0x21;
+
   static inline uint32_t state() { return rng_state_; }
 
-  static inline void Seed(uint16_t seed) {
+  static inline void Seed(uint32_t seed) {
     rng_state_ = seed;
   }
 
@@ -63,7 +111,7 @@ class Random {
   }
 
  private:
-  static uint32_t rng_state_;
+  static thread_local uint32_t rng_state_;
   static uint32_t nlog2_16(uint16_t x);
 
   DISALLOW_COPY_AND_ASSIGN(Random);
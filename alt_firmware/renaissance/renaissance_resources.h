@@ -38,25 +38,8 @@
 
 
 
-namespace renaissance {
-
-	typedef uint8_t ResourceId;
-
-	extern const char* string_table[];
-
-	extern const uint16_t* lookup_table_table[];
-
-	extern const int16_t* lookup_table_signed_table[];
-
-	extern const uint32_t* lookup_table_hr_table[];
-
-	extern const int16_t* waveform_table[];
-
-	extern const int16_t* waveshaper_table[];
-
-	extern const uint8_t* wt_table[];
-
-	extern const uint16_t* char_table[];
+// Tables identical to the braids ones are shared, not duplicated.
+namespace braids {
 
 	extern const uint16_t lut_resonator_coefficient[];
 	extern const uint16_t lut_resonator_scale[];
@@ -103,6 +86,74 @@ namespace renaissance {
 	extern const uint8_t wt_map[];
 	extern const uint8_t wt_code[];
 	extern const uint16_t chr_characters[];
+
+}  // namespace braids
+
+namespace renaissance {
+
+	typedef uint8_t ResourceId;
+
+	extern const char* string_table[];
+
+	extern const uint16_t* lookup_table_table[];
+
+	extern const int16_t* lookup_table_signed_table[];
+
+	extern const uint32_t* lookup_table_hr_table[];
+
+	extern const int16_t* waveform_table[];
+
+	extern const int16_t* waveshaper_table[];
+
+	extern const uint8_t* wt_table[];
+
+	extern const uint16_t* char_table[];
+
+	using braids::lut_resonator_coefficient;
+	using braids::lut_resonator_scale;
+	using braids::lut_svf_cutoff;
+	using braids::lut_svf_damp;
+	using braids::lut_svf_scale;
+	using braids::lut_granular_envelope;
+	using braids::lut_granular_envelope_rate;
+	using braids::lut_bowing_envelope;
+	using braids::lut_bowing_friction;
+	using braids::lut_blowing_envelope;
+	using braids::lut_flute_body_filter;
+	using braids::lut_fm_frequency_quantizer;
+	using braids::lut_vco_detune;
+	using braids::lut_bell;
+	using braids::lut_env_expo;
+	using braids::lut_blowing_jet;
+	using braids::lut_oscillator_increments;
+	using braids::lut_oscillator_delays;
+	using braids::lut_env_portamento_increments;
+	using braids::wav_formant_sine;
+	using braids::wav_formant_square;
+	using braids::wav_sine;
+	using braids::wav_bandlimited_comb_0;
+	using braids::wav_bandlimited_comb_1;
+	using braids::wav_bandlimited_comb_2;
+	using braids::wav_bandlimited_comb_3;
+	using braids::wav_bandlimited_comb_4;
+	using braids::wav_bandlimited_comb_5;
+	using braids::wav_bandlimited_comb_6;
+	using braids::wav_bandlimited_comb_7;
+	using braids::wav_bandlimited_comb_8;
+	using braids::wav_bandlimited_comb_9;
+	using braids::wav_bandlimited_comb_10;
+	using braids::wav_bandlimited_comb_11;
+	using braids::wav_bandlimited_comb_12;
+	using braids::wav_bandlimited_comb_13;
+	using braids::wav_bandlimited_comb_14;
+	using braids::ws_moderate_overdrive;
+	using braids::ws_violent_overdrive;
+	using braids::ws_sine_fold;
+	using braids::ws_tri_fold;
+	using braids::wt_waves;
+	using braids::wt_map;
+	using braids::wt_code;
+	using braids::chr_characters;
 #define STR_DUMMY 0  // dummy
 #define LUT_RESONATOR_COEFFICIENT 0
 #define LUT_RESONATOR_COEFFICIENT_SIZE 129
@@ -54,7 +54,7 @@ namespace scalaria {
     previousParameters_.note = 48.f;
   }
 
-  void ScalariaModulator::ProcessLadderFilter(ShortFrame* input, ShortFrame* output, size_t size) {
+  void ScalariaModulator::ProcessLadderFilter(FloatFrame* input, FloatFrame* output, size_t size) {
     float* channel1 = buffer_[0];
     const float* channel2 = buffer_[1];
     float* mainOutput = buffer_[0];
@@ -82,11 +82,26 @@ namespace scalaria {
       }
     }
 
-    Convert(output, mainOutput, auxOutput, 32768.f, size);
+    Convert(output, mainOutput, auxOutput, 1.f, size);
     previousParameters_ = parameters_;
   }
 
   void ScalariaModulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
+    FloatFrame floatInput[kMaxBlockSize];
+    FloatFrame floatOutput[kMaxBlockSize];
+
+    for (size_t i = 0; i < size; ++i) {
+      floatInput[i].l = static_cast<float>(input[i].l) / 32768.0f;
+      floatInput[i].r = static_cast<float>(input[i].r) / 32768.0f;
+    }
+    Process(floatInput, floatOutput, size);
+    for (size_t i = 0; i < size; ++i) {
+      output[i].l = parasites_stmlib::Clip16(static_cast<int32_t>(floatOutput[i].l * 32768.0f));
+      output[i].r = parasites_stmlib::Clip16(static_cast<int32_t>(floatOutput[i].r * 32768.0f));
+    }
+  }
+
+  void ScalariaModulator::Process(FloatFrame* input, FloatFrame* output, size_t size) {
     ProcessLadderFilter(input, output, size);
   }
 }  // namespace scalaria
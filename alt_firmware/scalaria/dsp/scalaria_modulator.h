@@ -47,6 +47,13 @@ namespace scalaria {
   static const size_t kMaxChannels = 2;
 
   typedef struct { short l; short r; } ShortFrame;
+  typedef struct { float l; float r; } FloatFrame;
+
+  /* Float frames span the -1.0 to 1.0 range of 16-bit frames, and are
+     clipped to it like Clip16() clips them: a NaN ends up at -1.0. */
+  inline float ClipFrame(float x) {
+    return x >= -1.0f ? (x <= 1.0f ? x : 1.0f) : -1.0f;
+  }
 
   class SaturatingAmplifier {
   public:
@@ -56,12 +63,12 @@ namespace scalaria {
       drive_ = 0.0f;
     }
 
-    void Process(float drive, float limit, short* in, float* out, float* outRaw, size_t inStride, size_t size) {
+    void Process(float drive, float limit, const float* in, float* out, float* outRaw, size_t inStride, size_t size) {
       // Process noise gate and compute raw output.
       parasites_stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
       float level = level_;
       for (size_t i = 0; i < size; ++i) {
-        float s = static_cast<float>(*in) / 32768.0f;
+        float s = *in;
         float error = s * s - level;
         level += error * (error > 0.0f ? 0.1f : 0.0001f);
         s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
@@ -103,28 +110,30 @@ namespace scalaria {
     ~ScalariaModulator() {}
 
     void Init(float sampleRate);
+    // 16-bit frames are converted to and from float frames.
     void Process(ShortFrame* input, ShortFrame* output, size_t size);
-    void ProcessLadderFilter(ShortFrame* input, ShortFrame* output, size_t size);
+    void Process(FloatFrame* input, FloatFrame* output, size_t size);
+    void ProcessLadderFilter(FloatFrame* input, FloatFrame* output, size_t size);
     inline Parameters* mutableParameters() {
       return &parameters_;
     }
 
   private:
-    void ApplyAmplification(ShortFrame* input, const float* level, float* auxOutput, size_t size, bool rawLevel) {
+    void ApplyAmplification(FloatFrame* input, const float* level, float* auxOutput, size_t size, bool rawLevel) {
       if (!parameters_.oscillatorShape || rawLevel) {
         fill(&auxOutput[0], &auxOutput[size], 0.0f);
       }
-      // Convert audio inputs to float and apply VCA/saturation (5.8% per channel).
-      short* input_samples = &input->l;
+      // Apply VCA/saturation (5.8% per channel).
+      const float* input_samples = &input->l;
       for (int32_t i = (parameters_.oscillatorShape && !rawLevel) ? 1 : 0; i < 2; ++i) {
         amplifier_[i].Process(level[i], 1.0f, input_samples + i, buffer_[i], auxOutput, 2, size);
       }
     }
 
-    void RenderInternalOscillator(ShortFrame* input, float* carrier, float* auxOutput, size_t size, bool excludeSine = false) {
+    void RenderInternalOscillator(FloatFrame* input, float* carrier, float* auxOutput, size_t size, bool excludeSine = false) {
       // Scale phase-modulation input.
       for (size_t i = 0; i < size; ++i) {
-        internalModulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+        internalModulation_[i] = input[i].l;
       }
 
       OscillatorShape oscillatorShape = static_cast<OscillatorShape>(parameters_.oscillatorShape - (excludeSine ? 0 : 1));
@@ -134,11 +143,11 @@ namespace scalaria {
       }
     }
 
-    void Convert(ShortFrame* output, const float* mainOutput, const float* auxOutput, const float auxGain,
+    void Convert(FloatFrame* output, const float* mainOutput, const float* auxOutput, const float auxGain,
       size_t size) {
       while (size--) {
-        output->l = parasites_stmlib::Clip16(static_cast<int32_t>(*mainOutput * 32768.0f));
-        output->r = parasites_stmlib::Clip16(static_cast<int32_t>(*auxOutput * auxGain));
+        output->l = ClipFrame(*mainOutput);
+        output->r = ClipFrame(*auxOutput * auxGain);
         ++mainOutput;
         ++auxOutput;
         ++output;
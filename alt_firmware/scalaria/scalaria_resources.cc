@@ -34,105 +34,25 @@
 
 namespace scalaria {
 
-   const float fb__87_8000[] = {
-      1.200000000e+01,  2.630000000e+02,  1.000000000e+00, -2.572000482e-02,
-      4.487788340e-02, -2.572000482e-02,  4.487788340e-02,
-   };
 
-   const float fb_110_8000[] = {
-      1.200000000e+01,  3.060000000e+02,  2.500000000e-01, -7.931045024e-02,
-      1.290681251e-02, -9.339148150e-02,  1.518494012e-02,
-   };
 
-   const float fb_139_8000[] = {
-      1.200000000e+01,  2.430000000e+02,  2.500000000e-01, -9.982608285e-02,
-      1.623625964e-02, -1.175253889e-01,  1.909187455e-02,
-   };
 
-   const float fb_175_8000[] = {
-      1.200000000e+01,  1.920000000e+02,  2.500000000e-01, -1.256102632e-01,
-      2.041717073e-02, -1.478403116e-01,  2.399019825e-02,
-   };
 
-   const float fb_220_8000[] = {
-      1.200000000e+01,  1.530000000e+02,  2.500000000e-01, -1.579890264e-01,
-      2.566359509e-02, -1.858796047e-01,  3.012281471e-02,
-   };
 
-   const float fb_277_8000[] = {
-      1.200000000e+01,  1.210000000e+02,  2.500000000e-01, -1.986017761e-01,
-      3.224184764e-02, -2.335415850e-01,  3.778648442e-02,
-   };
 
-   const float fb_349_8000[] = {
-      1.200000000e+01,  9.600000000e+01,  2.500000000e-01, -2.494585699e-01,
-      4.048298668e-02, -2.931359041e-01,  4.733980069e-02,
-   };
 
-   const float fb_440_8000[] = {
-      1.200000000e+01,  7.600000000e+01,  2.500000000e-01, -3.129923847e-01,
-      5.079873862e-02, -3.674252077e-01,  5.920914546e-02,
-   };
 
-   const float fb_554_8000[] = {
-      1.200000000e+01,  6.000000000e+01,  2.500000000e-01, -3.920877866e-01,
-      6.370275117e-02, -4.596234805e-01,  7.388912125e-02,
-   };
 
-   const float fb_698_8000[] = {
-      1.200000000e+01,  4.800000000e+01,  2.500000000e-01, -4.900471292e-01,
-      7.984109811e-02, -5.732942351e-01,  9.193058505e-02,
-   };
 
-   const float fb_880_8000[] = {
-      1.200000000e+01,  3.800000000e+01,  2.500000000e-01, -6.104158833e-01,
-      1.000408086e-01, -7.120398134e-01,  1.139025399e-01,
-   };
 
-   const float fb_1109_8000[] = {
-      1.200000000e+01,  3.000000000e+01,  2.500000000e-01, -7.565125704e-01,
-      1.253975556e-01, -8.787817044e-01,  1.402986139e-01,
-   };
 
-   const float fb_1397_8000[] = {
-      1.200000000e+01,  2.400000000e+01,  2.500000000e-01, -9.303628940e-01,
-      1.574589048e-01, -1.074283292e+00,  1.713175349e-01,
-   };
 
-   const float fb_1760_32000[] = {
-      3.000000000e+00,  7.600000000e+01,  2.500000000e-01, -3.129923847e-01,
-      5.079873862e-02, -3.674252077e-01,  5.920914546e-02,
-   };
 
-   const float fb_2217_32000[] = {
-      3.000000000e+00,  6.000000000e+01,  2.500000000e-01, -3.920877866e-01,
-      6.370275117e-02, -4.596234805e-01,  7.388912125e-02,
-   };
 
-   const float fb_2794_32000[] = {
-      3.000000000e+00,  4.800000000e+01,  2.500000000e-01, -4.900471292e-01,
-      7.984109811e-02, -5.732942351e-01,  9.193058505e-02,
-   };
 
-   const float fb_3520_32000[] = {
-      3.000000000e+00,  3.800000000e+01,  2.500000000e-01, -6.104158833e-01,
-      1.000408086e-01, -7.120398134e-01,  1.139025399e-01,
-   };
 
-   const float fb_4435_32000[] = {
-      3.000000000e+00,  3.000000000e+01,  2.500000000e-01, -7.565125704e-01,
-      1.253975556e-01, -8.787817044e-01,  1.402986139e-01,
-   };
 
-   const float fb_5588_32000[] = {
-      3.000000000e+00,  2.400000000e+01,  2.500000000e-01, -9.303628940e-01,
-      1.574589048e-01, -1.074283292e+00,  1.713175349e-01,
-   };
 
-   const float fb_7040_96000[] = {
-      1.000000000e+00,  5.000000000e+00,  3.080000000e+00, -3.104663984e-01,
-      6.551315014e-01, -3.104663984e-01,  6.551315014e-01,
-   };
 
 
 
@@ -159,1835 +79,14 @@ namespace scalaria {
      fb_7040_96000,
    };
 
-   const float lut_sin[] = {
-      0.000000000e+00,  6.135884649e-03,  1.227153829e-02,  1.840672991e-02,
-      2.454122852e-02,  3.067480318e-02,  3.680722294e-02,  4.293825693e-02,
-      4.906767433e-02,  5.519524435e-02,  6.132073630e-02,  6.744391956e-02,
-      7.356456360e-02,  7.968243797e-02,  8.579731234e-02,  9.190895650e-02,
-      9.801714033e-02,  1.041216339e-01,  1.102222073e-01,  1.163186309e-01,
-      1.224106752e-01,  1.284981108e-01,  1.345807085e-01,  1.406582393e-01,
-      1.467304745e-01,  1.527971853e-01,  1.588581433e-01,  1.649131205e-01,
-      1.709618888e-01,  1.770042204e-01,  1.830398880e-01,  1.890686641e-01,
-      1.950903220e-01,  2.011046348e-01,  2.071113762e-01,  2.131103199e-01,
-      2.191012402e-01,  2.250839114e-01,  2.310581083e-01,  2.370236060e-01,
-      2.429801799e-01,  2.489276057e-01,  2.548656596e-01,  2.607941179e-01,
-      2.667127575e-01,  2.726213554e-01,  2.785196894e-01,  2.844075372e-01,
-      2.902846773e-01,  2.961508882e-01,  3.020059493e-01,  3.078496400e-01,
-      3.136817404e-01,  3.195020308e-01,  3.253102922e-01,  3.311063058e-01,
-      3.368898534e-01,  3.426607173e-01,  3.484186802e-01,  3.541635254e-01,
-      3.598950365e-01,  3.656129978e-01,  3.713171940e-01,  3.770074102e-01,
-      3.826834324e-01,  3.883450467e-01,  3.939920401e-01,  3.996241998e-01,
-      4.052413140e-01,  4.108431711e-01,  4.164295601e-01,  4.220002708e-01,
-      4.275550934e-01,  4.330938189e-01,  4.386162385e-01,  4.441221446e-01,
-      4.496113297e-01,  4.550835871e-01,  4.605387110e-01,  4.659764958e-01,
-      4.713967368e-01,  4.767992301e-01,  4.821837721e-01,  4.875501601e-01,
-      4.928981922e-01,  4.982276670e-01,  5.035383837e-01,  5.088301425e-01,
-      5.141027442e-01,  5.193559902e-01,  5.245896827e-01,  5.298036247e-01,
-      5.349976199e-01,  5.401714727e-01,  5.453249884e-01,  5.504579729e-01,
-      5.555702330e-01,  5.606615762e-01,  5.657318108e-01,  5.707807459e-01,
-      5.758081914e-01,  5.808139581e-01,  5.857978575e-01,  5.907597019e-01,
-      5.956993045e-01,  6.006164794e-01,  6.055110414e-01,  6.103828063e-01,
-      6.152315906e-01,  6.200572118e-01,  6.248594881e-01,  6.296382389e-01,
-      6.343932842e-01,  6.391244449e-01,  6.438315429e-01,  6.485144010e-01,
-      6.531728430e-01,  6.578066933e-01,  6.624157776e-01,  6.669999223e-01,
-      6.715589548e-01,  6.760927036e-01,  6.806009978e-01,  6.850836678e-01,
-      6.895405447e-01,  6.939714609e-01,  6.983762494e-01,  7.027547445e-01,
-      7.071067812e-01,  7.114321957e-01,  7.157308253e-01,  7.200025080e-01,
-      7.242470830e-01,  7.284643904e-01,  7.326542717e-01,  7.368165689e-01,
-      7.409511254e-01,  7.450577854e-01,  7.491363945e-01,  7.531867990e-01,
-      7.572088465e-01,  7.612023855e-01,  7.651672656e-01,  7.691033376e-01,
-      7.730104534e-01,  7.768884657e-01,  7.807372286e-01,  7.845565972e-01,
-      7.883464276e-01,  7.921065773e-01,  7.958369046e-01,  7.995372691e-01,
-      8.032075315e-01,  8.068475535e-01,  8.104571983e-01,  8.140363297e-01,
-      8.175848132e-01,  8.211025150e-01,  8.245893028e-01,  8.280450453e-01,
-      8.314696123e-01,  8.348628750e-01,  8.382247056e-01,  8.415549774e-01,
-      8.448535652e-01,  8.481203448e-01,  8.513551931e-01,  8.545579884e-01,
-      8.577286100e-01,  8.608669386e-01,  8.639728561e-01,  8.670462455e-01,
-      8.700869911e-01,  8.730949784e-01,  8.760700942e-01,  8.790122264e-01,
-      8.819212643e-01,  8.847970984e-01,  8.876396204e-01,  8.904487232e-01,
-      8.932243012e-01,  8.959662498e-01,  8.986744657e-01,  9.013488470e-01,
-      9.039892931e-01,  9.065957045e-01,  9.091679831e-01,  9.117060320e-01,
-      9.142097557e-01,  9.166790599e-01,  9.191138517e-01,  9.215140393e-01,
-      9.238795325e-01,  9.262102421e-01,  9.285060805e-01,  9.307669611e-01,
-      9.329927988e-01,  9.351835099e-01,  9.373390119e-01,  9.394592236e-01,
-      9.415440652e-01,  9.435934582e-01,  9.456073254e-01,  9.475855910e-01,
-      9.495281806e-01,  9.514350210e-01,  9.533060404e-01,  9.551411683e-01,
-      9.569403357e-01,  9.587034749e-01,  9.604305194e-01,  9.621214043e-01,
-      9.637760658e-01,  9.653944417e-01,  9.669764710e-01,  9.685220943e-01,
-      9.700312532e-01,  9.715038910e-01,  9.729399522e-01,  9.743393828e-01,
-      9.757021300e-01,  9.770281427e-01,  9.783173707e-01,  9.795697657e-01,
-      9.807852804e-01,  9.819638691e-01,  9.831054874e-01,  9.842100924e-01,
-      9.852776424e-01,  9.863080972e-01,  9.873014182e-01,  9.882575677e-01,
-      9.891765100e-01,  9.900582103e-01,  9.909026354e-01,  9.917097537e-01,
-      9.924795346e-01,  9.932119492e-01,  9.939069700e-01,  9.945645707e-01,
-      9.951847267e-01,  9.957674145e-01,  9.963126122e-01,  9.968202993e-01,
-      9.972904567e-01,  9.977230666e-01,  9.981181129e-01,  9.984755806e-01,
-      9.987954562e-01,  9.990777278e-01,  9.993223846e-01,  9.995294175e-01,
-      9.996988187e-01,  9.998305818e-01,  9.999247018e-01,  9.999811753e-01,
-      1.000000000e+00,  9.999811753e-01,  9.999247018e-01,  9.998305818e-01,
-      9.996988187e-01,  9.995294175e-01,  9.993223846e-01,  9.990777278e-01,
-      9.987954562e-01,  9.984755806e-01,  9.981181129e-01,  9.977230666e-01,
-      9.972904567e-01,  9.968202993e-01,  9.963126122e-01,  9.957674145e-01,
-      9.951847267e-01,  9.945645707e-01,  9.939069700e-01,  9.932119492e-01,
-      9.924795346e-01,  9.917097537e-01,  9.909026354e-01,  9.900582103e-01,
-      9.891765100e-01,  9.882575677e-01,  9.873014182e-01,  9.863080972e-01,
-      9.852776424e-01,  9.842100924e-01,  9.831054874e-01,  9.819638691e-01,
-      9.807852804e-01,  9.795697657e-01,  9.783173707e-01,  9.770281427e-01,
-      9.757021300e-01,  9.743393828e-01,  9.729399522e-01,  9.715038910e-01,
-      9.700312532e-01,  9.685220943e-01,  9.669764710e-01,  9.653944417e-01,
-      9.637760658e-01,  9.621214043e-01,  9.604305194e-01,  9.587034749e-01,
-      9.569403357e-01,  9.551411683e-01,  9.533060404e-01,  9.514350210e-01,
-      9.495281806e-01,  9.475855910e-01,  9.456073254e-01,  9.435934582e-01,
-      9.415440652e-01,  9.394592236e-01,  9.373390119e-01,  9.351835099e-01,
-      9.329927988e-01,  9.307669611e-01,  9.285060805e-01,  9.262102421e-01,
-      9.238795325e-01,  9.215140393e-01,  9.191138517e-01,  9.166790599e-01,
-      9.142097557e-01,  9.117060320e-01,  9.091679831e-01,  9.065957045e-01,
-      9.039892931e-01,  9.013488470e-01,  8.986744657e-01,  8.959662498e-01,
-      8.932243012e-01,  8.904487232e-01,  8.876396204e-01,  8.847970984e-01,
-      8.819212643e-01,  8.790122264e-01,  8.760700942e-01,  8.730949784e-01,
-      8.700869911e-01,  8.670462455e-01,  8.639728561e-01,  8.608669386e-01,
-      8.577286100e-01,  8.545579884e-01,  8.513551931e-01,  8.481203448e-01,
-      8.448535652e-01,  8.415549774e-01,  8.382247056e-01,  8.348628750e-01,
-      8.314696123e-01,  8.280450453e-01,  8.245893028e-01,  8.211025150e-01,
-      8.175848132e-01,  8.140363297e-01,  8.104571983e-01,  8.068475535e-01,
-      8.032075315e-01,  7.995372691e-01,  7.958369046e-01,  7.921065773e-01,
-      7.883464276e-01,  7.845565972e-01,  7.807372286e-01,  7.768884657e-01,
-      7.730104534e-01,  7.691033376e-01,  7.651672656e-01,  7.612023855e-01,
-      7.572088465e-01,  7.531867990e-01,  7.491363945e-01,  7.450577854e-01,
-      7.409511254e-01,  7.368165689e-01,  7.326542717e-01,  7.284643904e-01,
-      7.242470830e-01,  7.200025080e-01,  7.157308253e-01,  7.114321957e-01,
-      7.071067812e-01,  7.027547445e-01,  6.983762494e-01,  6.939714609e-01,
-      6.895405447e-01,  6.850836678e-01,  6.806009978e-01,  6.760927036e-01,
-      6.715589548e-01,  6.669999223e-01,  6.624157776e-01,  6.578066933e-01,
-      6.531728430e-01,  6.485144010e-01,  6.438315429e-01,  6.391244449e-01,
-      6.343932842e-01,  6.296382389e-01,  6.248594881e-01,  6.200572118e-01,
-      6.152315906e-01,  6.103828063e-01,  6.055110414e-01,  6.006164794e-01,
-      5.956993045e-01,  5.907597019e-01,  5.857978575e-01,  5.808139581e-01,
-      5.758081914e-01,  5.707807459e-01,  5.657318108e-01,  5.606615762e-01,
-      5.555702330e-01,  5.504579729e-01,  5.453249884e-01,  5.401714727e-01,
-      5.349976199e-01,  5.298036247e-01,  5.245896827e-01,  5.193559902e-01,
-      5.141027442e-01,  5.088301425e-01,  5.035383837e-01,  4.982276670e-01,
-      4.928981922e-01,  4.875501601e-01,  4.821837721e-01,  4.767992301e-01,
-      4.713967368e-01,  4.659764958e-01,  4.605387110e-01,  4.550835871e-01,
-      4.496113297e-01,  4.441221446e-01,  4.386162385e-01,  4.330938189e-01,
-      4.275550934e-01,  4.220002708e-01,  4.164295601e-01,  4.108431711e-01,
-      4.052413140e-01,  3.996241998e-01,  3.939920401e-01,  3.883450467e-01,
-      3.826834324e-01,  3.770074102e-01,  3.713171940e-01,  3.656129978e-01,
-      3.598950365e-01,  3.541635254e-01,  3.484186802e-01,  3.426607173e-01,
-      3.368898534e-01,  3.311063058e-01,  3.253102922e-01,  3.195020308e-01,
-      3.136817404e-01,  3.078496400e-01,  3.020059493e-01,  2.961508882e-01,
-      2.902846773e-01,  2.844075372e-01,  2.785196894e-01,  2.726213554e-01,
-      2.667127575e-01,  2.607941179e-01,  2.548656596e-01,  2.489276057e-01,
-      2.429801799e-01,  2.370236060e-01,  2.310581083e-01,  2.250839114e-01,
-      2.191012402e-01,  2.131103199e-01,  2.071113762e-01,  2.011046348e-01,
-      1.950903220e-01,  1.890686641e-01,  1.830398880e-01,  1.770042204e-01,
-      1.709618888e-01,  1.649131205e-01,  1.588581433e-01,  1.527971853e-01,
-      1.467304745e-01,  1.406582393e-01,  1.345807085e-01,  1.284981108e-01,
-      1.224106752e-01,  1.163186309e-01,  1.102222073e-01,  1.041216339e-01,
-      9.801714033e-02,  9.190895650e-02,  8.579731234e-02,  7.968243797e-02,
-      7.356456360e-02,  6.744391956e-02,  6.132073630e-02,  5.519524435e-02,
-      4.906767433e-02,  4.293825693e-02,  3.680722294e-02,  3.067480318e-02,
-      2.454122852e-02,  1.840672991e-02,  1.227153829e-02,  6.135884649e-03,
-      1.224646799e-16, -6.135884649e-03, -1.227153829e-02, -1.840672991e-02,
-     -2.454122852e-02, -3.067480318e-02, -3.680722294e-02, -4.293825693e-02,
-     -4.906767433e-02, -5.519524435e-02, -6.132073630e-02, -6.744391956e-02,
-     -7.356456360e-02, -7.968243797e-02, -8.579731234e-02, -9.190895650e-02,
-     -9.801714033e-02, -1.041216339e-01, -1.102222073e-01, -1.163186309e-01,
-     -1.224106752e-01, -1.284981108e-01, -1.345807085e-01, -1.406582393e-01,
-     -1.467304745e-01, -1.527971853e-01, -1.588581433e-01, -1.649131205e-01,
-     -1.709618888e-01, -1.770042204e-01, -1.830398880e-01, -1.890686641e-01,
-     -1.950903220e-01, -2.011046348e-01, -2.071113762e-01, -2.131103199e-01,
-     -2.191012402e-01, -2.250839114e-01, -2.310581083e-01, -2.370236060e-01,
-     -2.429801799e-01, -2.489276057e-01, -2.548656596e-01, -2.607941179e-01,
-     -2.667127575e-01, -2.726213554e-01, -2.785196894e-01, -2.844075372e-01,
-     -2.902846773e-01, -2.961508882e-01, -3.020059493e-01, -3.078496400e-01,
-     -3.136817404e-01, -3.195020308e-01, -3.253102922e-01, -3.311063058e-01,
-     -3.368898534e-01, -3.426607173e-01, -3.484186802e-01, -3.541635254e-01,
-     -3.598950365e-01, -3.656129978e-01, -3.713171940e-01, -3.770074102e-01,
-     -3.826834324e-01, -3.883450467e-01, -3.939920401e-01, -3.996241998e-01,
-     -4.052413140e-01, -4.108431711e-01, -4.164295601e-01, -4.220002708e-01,
-     -4.275550934e-01, -4.330938189e-01, -4.386162385e-01, -4.441221446e-01,
-     -4.496113297e-01, -4.550835871e-01, -4.605387110e-01, -4.659764958e-01,
-     -4.713967368e-01, -4.767992301e-01, -4.821837721e-01, -4.875501601e-01,
-     -4.928981922e-01, -4.982276670e-01, -5.035383837e-01, -5.088301425e-01,
-     -5.141027442e-01, -5.193559902e-01, -5.245896827e-01, -5.298036247e-01,
-     -5.349976199e-01, -5.401714727e-01, -5.453249884e-01, -5.504579729e-01,
-     -5.555702330e-01, -5.606615762e-01, -5.657318108e-01, -5.707807459e-01,
-     -5.758081914e-01, -5.808139581e-01, -5.857978575e-01, -5.907597019e-01,
-     -5.956993045e-01, -6.006164794e-01, -6.055110414e-01, -6.103828063e-01,
-     -6.152315906e-01, -6.200572118e-01, -6.248594881e-01, -6.296382389e-01,
-     -6.343932842e-01, -6.391244449e-01, -6.438315429e-01, -6.485144010e-01,
-     -6.531728430e-01, -6.578066933e-01, -6.624157776e-01, -6.669999223e-01,
-     -6.715589548e-01, -6.760927036e-01, -6.806009978e-01, -6.850836678e-01,
-     -6.895405447e-01, -6.939714609e-01, -6.983762494e-01, -7.027547445e-01,
-     -7.071067812e-01, -7.114321957e-01, -7.157308253e-01, -7.200025080e-01,
-     -7.242470830e-01, -7.284643904e-01, -7.326542717e-01, -7.368165689e-01,
-     -7.409511254e-01, -7.450577854e-01, -7.491363945e-01, -7.531867990e-01,
-     -7.572088465e-01, -7.612023855e-01, -7.651672656e-01, -7.691033376e-01,
-     -7.730104534e-01, -7.768884657e-01, -7.807372286e-01, -7.845565972e-01,
-     -7.883464276e-01, -7.921065773e-01, -7.958369046e-01, -7.995372691e-01,
-     -8.032075315e-01, -8.068475535e-01, -8.104571983e-01, -8.140363297e-01,
-     -8.175848132e-01, -8.211025150e-01, -8.245893028e-01, -8.280450453e-01,
-     -8.314696123e-01, -8.348628750e-01, -8.382247056e-01, -8.415549774e-01,
-     -8.448535652e-01, -8.481203448e-01, -8.513551931e-01, -8.545579884e-01,
-     -8.577286100e-01, -8.608669386e-01, -8.639728561e-01, -8.670462455e-01,
-     -8.700869911e-01, -8.730949784e-01, -8.760700942e-01, -8.790122264e-01,
-     -8.819212643e-01, -8.847970984e-01, -8.876396204e-01, -8.904487232e-01,
-     -8.932243012e-01, -8.959662498e-01, -8.986744657e-01, -9.013488470e-01,
-     -9.039892931e-01, -9.065957045e-01, -9.091679831e-01, -9.117060320e-01,
-     -9.142097557e-01, -9.166790599e-01, -9.191138517e-01, -9.215140393e-01,
-     -9.238795325e-01, -9.262102421e-01, -9.285060805e-01, -9.307669611e-01,
-     -9.329927988e-01, -9.351835099e-01, -9.373390119e-01, -9.394592236e-01,
-     -9.415440652e-01, -9.435934582e-01, -9.456073254e-01, -9.475855910e-01,
-     -9.495281806e-01, -9.514350210e-01, -9.533060404e-01, -9.551411683e-01,
-     -9.569403357e-01, -9.587034749e-01, -9.604305194e-01, -9.621214043e-01,
-     -9.637760658e-01, -9.653944417e-01, -9.669764710e-01, -9.685220943e-01,
-     -9.700312532e-01, -9.715038910e-01, -9.729399522e-01, -9.743393828e-01,
-     -9.757021300e-01, -9.770281427e-01, -9.783173707e-01, -9.795697657e-01,
-     -9.807852804e-01, -9.819638691e-01, -9.831054874e-01, -9.842100924e-01,
-     -9.852776424e-01, -9.863080972e-01, -9.873014182e-01, -9.882575677e-01,
-     -9.891765100e-01, -9.900582103e-01, -9.909026354e-01, -9.917097537e-01,
-     -9.924795346e-01, -9.932119492e-01, -9.939069700e-01, -9.945645707e-01,
-     -9.951847267e-01, -9.957674145e-01, -9.963126122e-01, -9.968202993e-01,
-     -9.972904567e-01, -9.977230666e-01, -9.981181129e-01, -9.984755806e-01,
-     -9.987954562e-01, -9.990777278e-01, -9.993223846e-01, -9.995294175e-01,
-     -9.996988187e-01, -9.998305818e-01, -9.999247018e-01, -9.999811753e-01,
-     -1.000000000e+00, -9.999811753e-01, -9.999247018e-01, -9.998305818e-01,
-     -9.996988187e-01, -9.995294175e-01, -9.993223846e-01, -9.990777278e-01,
-     -9.987954562e-01, -9.984755806e-01, -9.981181129e-01, -9.977230666e-01,
-     -9.972904567e-01, -9.968202993e-01, -9.963126122e-01, -9.957674145e-01,
-     -9.951847267e-01, -9.945645707e-01, -9.939069700e-01, -9.932119492e-01,
-     -9.924795346e-01, -9.917097537e-01, -9.909026354e-01, -9.900582103e-01,
-     -9.891765100e-01, -9.882575677e-01, -9.873014182e-01, -9.863080972e-01,
-     -9.852776424e-01, -9.842100924e-01, -9.831054874e-01, -9.819638691e-01,
-     -9.807852804e-01, -9.795697657e-01, -9.783173707e-01, -9.770281427e-01,
-     -9.757021300e-01, -9.743393828e-01, -9.729399522e-01, -9.715038910e-01,
-     -9.700312532e-01, -9.685220943e-01, -9.669764710e-01, -9.653944417e-01,
-     -9.637760658e-01, -9.621214043e-01, -9.604305194e-01, -9.587034749e-01,
-     -9.569403357e-01, -9.551411683e-01, -9.533060404e-01, -9.514350210e-01,
-     -9.495281806e-01, -9.475855910e-01, -9.456073254e-01, -9.435934582e-01,
-     -9.415440652e-01, -9.394592236e-01, -9.373390119e-01, -9.351835099e-01,
-     -9.329927988e-01, -9.307669611e-01, -9.285060805e-01, -9.262102421e-01,
-     -9.238795325e-01, -9.215140393e-01, -9.191138517e-01, -9.166790599e-01,
-     -9.142097557e-01, -9.117060320e-01, -9.091679831e-01, -9.065957045e-01,
-     -9.039892931e-01, -9.013488470e-01, -8.986744657e-01, -8.959662498e-01,
-     -8.932243012e-01, -8.904487232e-01, -8.876396204e-01, -8.847970984e-01,
-     -8.819212643e-01, -8.790122264e-01, -8.760700942e-01, -8.730949784e-01,
-     -8.700869911e-01, -8.670462455e-01, -8.639728561e-01, -8.608669386e-01,
-     -8.577286100e-01, -8.545579884e-01, -8.513551931e-01, -8.481203448e-01,
-     -8.448535652e-01, -8.415549774e-01, -8.382247056e-01, -8.348628750e-01,
-     -8.314696123e-01, -8.280450453e-01, -8.245893028e-01, -8.211025150e-01,
-     -8.175848132e-01, -8.140363297e-01, -8.104571983e-01, -8.068475535e-01,
-     -8.032075315e-01, -7.995372691e-01, -7.958369046e-01, -7.921065773e-01,
-     -7.883464276e-01, -7.845565972e-01, -7.807372286e-01, -7.768884657e-01,
-     -7.730104534e-01, -7.691033376e-01, -7.651672656e-01, -7.612023855e-01,
-     -7.572088465e-01, -7.531867990e-01, -7.491363945e-01, -7.450577854e-01,
-     -7.409511254e-01, -7.368165689e-01, -7.326542717e-01, -7.284643904e-01,
-     -7.242470830e-01, -7.200025080e-01, -7.157308253e-01, -7.114321957e-01,
-     -7.071067812e-01, -7.027547445e-01, -6.983762494e-01, -6.939714609e-01,
-     -6.895405447e-01, -6.850836678e-01, -6.806009978e-01, -6.760927036e-01,
-     -6.715589548e-01, -6.669999223e-01, -6.624157776e-01, -6.578066933e-01,
-     -6.531728430e-01, -6.485144010e-01, -6.438315429e-01, -6.391244449e-01,
-     -6.343932842e-01, -6.296382389e-01, -6.248594881e-01, -6.200572118e-01,
-     -6.152315906e-01, -6.103828063e-01, -6.055110414e-01, -6.006164794e-01,
-     -5.956993045e-01, -5.907597019e-01, -5.857978575e-01, -5.808139581e-01,
-     -5.758081914e-01, -5.707807459e-01, -5.657318108e-01, -5.606615762e-01,
-     -5.555702330e-01, -5.504579729e-01, -5.453249884e-01, -5.401714727e-01,
-     -5.349976199e-01, -5.298036247e-01, -5.245896827e-01, -5.193559902e-01,
-     -5.141027442e-01, -5.088301425e-01, -5.035383837e-01, -4.982276670e-01,
-     -4.928981922e-01, -4.875501601e-01, -4.821837721e-01, -4.767992301e-01,
-     -4.713967368e-01, -4.659764958e-01, -4.605387110e-01, -4.550835871e-01,
-     -4.496113297e-01, -4.441221446e-01, -4.386162385e-01, -4.330938189e-01,
-     -4.275550934e-01, -4.220002708e-01, -4.164295601e-01, -4.108431711e-01,
-     -4.052413140e-01, -3.996241998e-01, -3.939920401e-01, -3.883450467e-01,
-     -3.826834324e-01, -3.770074102e-01, -3.713171940e-01, -3.656129978e-01,
-     -3.598950365e-01, -3.541635254e-01, -3.484186802e-01, -3.426607173e-01,
-     -3.368898534e-01, -3.311063058e-01, -3.253102922e-01, -3.195020308e-01,
-     -3.136817404e-01, -3.078496400e-01, -3.020059493e-01, -2.961508882e-01,
-     -2.902846773e-01, -2.844075372e-01, -2.785196894e-01, -2.726213554e-01,
-     -2.667127575e-01, -2.607941179e-01, -2.548656596e-01, -2.489276057e-01,
-     -2.429801799e-01, -2.370236060e-01, -2.310581083e-01, -2.250839114e-01,
-     -2.191012402e-01, -2.131103199e-01, -2.071113762e-01, -2.011046348e-01,
-     -1.950903220e-01, -1.890686641e-01, -1.830398880e-01, -1.770042204e-01,
-     -1.709618888e-01, -1.649131205e-01, -1.588581433e-01, -1.527971853e-01,
-     -1.467304745e-01, -1.406582393e-01, -1.345807085e-01, -1.284981108e-01,
-     -1.224106752e-01, -1.163186309e-01, -1.102222073e-01, -1.041216339e-01,
-     -9.801714033e-02, -9.190895650e-02, -8.579731234e-02, -7.968243797e-02,
-     -7.356456360e-02, -6.744391956e-02, -6.132073630e-02, -5.519524435e-02,
-     -4.906767433e-02, -4.293825693e-02, -3.680722294e-02, -3.067480318e-02,
-     -2.454122852e-02, -1.840672991e-02, -1.227153829e-02, -6.135884649e-03,
-     -2.449293598e-16,  6.135884649e-03,  1.227153829e-02,  1.840672991e-02,
-      2.454122852e-02,  3.067480318e-02,  3.680722294e-02,  4.293825693e-02,
-      4.906767433e-02,  5.519524435e-02,  6.132073630e-02,  6.744391956e-02,
-      7.356456360e-02,  7.968243797e-02,  8.579731234e-02,  9.190895650e-02,
-      9.801714033e-02,  1.041216339e-01,  1.102222073e-01,  1.163186309e-01,
-      1.224106752e-01,  1.284981108e-01,  1.345807085e-01,  1.406582393e-01,
-      1.467304745e-01,  1.527971853e-01,  1.588581433e-01,  1.649131205e-01,
-      1.709618888e-01,  1.770042204e-01,  1.830398880e-01,  1.890686641e-01,
-      1.950903220e-01,  2.011046348e-01,  2.071113762e-01,  2.131103199e-01,
-      2.191012402e-01,  2.250839114e-01,  2.310581083e-01,  2.370236060e-01,
-      2.429801799e-01,  2.489276057e-01,  2.548656596e-01,  2.607941179e-01,
-      2.667127575e-01,  2.726213554e-01,  2.785196894e-01,  2.844075372e-01,
-      2.902846773e-01,  2.961508882e-01,  3.020059493e-01,  3.078496400e-01,
-      3.136817404e-01,  3.195020308e-01,  3.253102922e-01,  3.311063058e-01,
-      3.368898534e-01,  3.426607173e-01,  3.484186802e-01,  3.541635254e-01,
-      3.598950365e-01,  3.656129978e-01,  3.713171940e-01,  3.770074102e-01,
-      3.826834324e-01,  3.883450467e-01,  3.939920401e-01,  3.996241998e-01,
-      4.052413140e-01,  4.108431711e-01,  4.164295601e-01,  4.220002708e-01,
-      4.275550934e-01,  4.330938189e-01,  4.386162385e-01,  4.441221446e-01,
-      4.496113297e-01,  4.550835871e-01,  4.605387110e-01,  4.659764958e-01,
-      4.713967368e-01,  4.767992301e-01,  4.821837721e-01,  4.875501601e-01,
-      4.928981922e-01,  4.982276670e-01,  5.035383837e-01,  5.088301425e-01,
-      5.141027442e-01,  5.193559902e-01,  5.245896827e-01,  5.298036247e-01,
-      5.349976199e-01,  5.401714727e-01,  5.453249884e-01,  5.504579729e-01,
-      5.555702330e-01,  5.606615762e-01,  5.657318108e-01,  5.707807459e-01,
-      5.758081914e-01,  5.808139581e-01,  5.857978575e-01,  5.907597019e-01,
-      5.956993045e-01,  6.006164794e-01,  6.055110414e-01,  6.103828063e-01,
-      6.152315906e-01,  6.200572118e-01,  6.248594881e-01,  6.296382389e-01,
-      6.343932842e-01,  6.391244449e-01,  6.438315429e-01,  6.485144010e-01,
-      6.531728430e-01,  6.578066933e-01,  6.624157776e-01,  6.669999223e-01,
-      6.715589548e-01,  6.760927036e-01,  6.806009978e-01,  6.850836678e-01,
-      6.895405447e-01,  6.939714609e-01,  6.983762494e-01,  7.027547445e-01,
-      7.071067812e-01,  7.114321957e-01,  7.157308253e-01,  7.200025080e-01,
-      7.242470830e-01,  7.284643904e-01,  7.326542717e-01,  7.368165689e-01,
-      7.409511254e-01,  7.450577854e-01,  7.491363945e-01,  7.531867990e-01,
-      7.572088465e-01,  7.612023855e-01,  7.651672656e-01,  7.691033376e-01,
-      7.730104534e-01,  7.768884657e-01,  7.807372286e-01,  7.845565972e-01,
-      7.883464276e-01,  7.921065773e-01,  7.958369046e-01,  7.995372691e-01,
-      8.032075315e-01,  8.068475535e-01,  8.104571983e-01,  8.140363297e-01,
-      8.175848132e-01,  8.211025150e-01,  8.245893028e-01,  8.280450453e-01,
-      8.314696123e-01,  8.348628750e-01,  8.382247056e-01,  8.415549774e-01,
-      8.448535652e-01,  8.481203448e-01,  8.513551931e-01,  8.545579884e-01,
-      8.577286100e-01,  8.608669386e-01,  8.639728561e-01,  8.670462455e-01,
-      8.700869911e-01,  8.730949784e-01,  8.760700942e-01,  8.790122264e-01,
-      8.819212643e-01,  8.847970984e-01,  8.876396204e-01,  8.904487232e-01,
-      8.932243012e-01,  8.959662498e-01,  8.986744657e-01,  9.013488470e-01,
-      9.039892931e-01,  9.065957045e-01,  9.091679831e-01,  9.117060320e-01,
-      9.142097557e-01,  9.166790599e-01,  9.191138517e-01,  9.215140393e-01,
-      9.238795325e-01,  9.262102421e-01,  9.285060805e-01,  9.307669611e-01,
-      9.329927988e-01,  9.351835099e-01,  9.373390119e-01,  9.394592236e-01,
-      9.415440652e-01,  9.435934582e-01,  9.456073254e-01,  9.475855910e-01,
-      9.495281806e-01,  9.514350210e-01,  9.533060404e-01,  9.551411683e-01,
-      9.569403357e-01,  9.587034749e-01,  9.604305194e-01,  9.621214043e-01,
-      9.637760658e-01,  9.653944417e-01,  9.669764710e-01,  9.685220943e-01,
-      9.700312532e-01,  9.715038910e-01,  9.729399522e-01,  9.743393828e-01,
-      9.757021300e-01,  9.770281427e-01,  9.783173707e-01,  9.795697657e-01,
-      9.807852804e-01,  9.819638691e-01,  9.831054874e-01,  9.842100924e-01,
-      9.852776424e-01,  9.863080972e-01,  9.873014182e-01,  9.882575677e-01,
-      9.891765100e-01,  9.900582103e-01,  9.909026354e-01,  9.917097537e-01,
-      9.924795346e-01,  9.932119492e-01,  9.939069700e-01,  9.945645707e-01,
-      9.951847267e-01,  9.957674145e-01,  9.963126122e-01,  9.968202993e-01,
-      9.972904567e-01,  9.977230666e-01,  9.981181129e-01,  9.984755806e-01,
-      9.987954562e-01,  9.990777278e-01,  9.993223846e-01,  9.995294175e-01,
-      9.996988187e-01,  9.998305818e-01,  9.999247018e-01,  9.999811753e-01,
-      1.000000000e+00,
-   };
 
-   const float lut_arcsin[] = {
-     -1.000000000e+00, -9.203706289e-01, -8.873134070e-01, -8.618971430e-01,
-     -8.404276493e-01, -8.214749794e-01, -8.043062326e-01, -7.884862959e-01,
-     -7.737318355e-01, -7.598461583e-01, -7.466861322e-01, -7.341437612e-01,
-     -7.221351863e-01, -7.105937516e-01, -6.994654384e-01, -6.887057478e-01,
-     -6.782775070e-01, -6.681492851e-01, -6.582942244e-01, -6.486891596e-01,
-     -6.393139448e-01, -6.301509296e-01, -6.211845465e-01, -6.124009827e-01,
-     -6.037879145e-01, -5.953342919e-01, -5.870301615e-01, -5.788665198e-01,
-     -5.708351903e-01, -5.629287213e-01, -5.551402986e-01, -5.474636710e-01,
-     -5.398930877e-01, -5.324232433e-01, -5.250492308e-01, -5.177665009e-01,
-     -5.105708258e-01, -5.034582687e-01, -4.964251556e-01, -4.894680517e-01,
-     -4.825837395e-01, -4.757692002e-01, -4.690215962e-01, -4.623382565e-01,
-     -4.557166630e-01, -4.491544378e-01, -4.426493331e-01, -4.361992206e-01,
-     -4.298020828e-01, -4.234560051e-01, -4.171591678e-01, -4.109098402e-01,
-     -4.047063738e-01, -3.985471970e-01, -3.924308100e-01, -3.863557800e-01,
-     -3.803207370e-01, -3.743243695e-01, -3.683654214e-01, -3.624426882e-01,
-     -3.565550140e-01, -3.507012885e-01, -3.448804446e-01, -3.390914556e-01,
-     -3.333333333e-01, -3.276051254e-01, -3.219059136e-01, -3.162348121e-01,
-     -3.105909654e-01, -3.049735469e-01, -2.993817576e-01, -2.938148240e-01,
-     -2.882719975e-01, -2.827525527e-01, -2.772557865e-01, -2.717810168e-01,
-     -2.663275813e-01, -2.608948371e-01, -2.554821590e-01, -2.500889395e-01,
-     -2.447145871e-01, -2.393585260e-01, -2.340201956e-01, -2.286990490e-01,
-     -2.233945532e-01, -2.181061879e-01, -2.128334453e-01, -2.075758290e-01,
-     -2.023328540e-01, -1.971040461e-01, -1.918889411e-01, -1.866870844e-01,
-     -1.814980309e-01, -1.763213443e-01, -1.711565967e-01, -1.660033681e-01,
-     -1.608612465e-01, -1.557298269e-01, -1.506087115e-01, -1.454975090e-01,
-     -1.403958344e-01, -1.353033088e-01, -1.302195590e-01, -1.251442172e-01,
-     -1.200769208e-01, -1.150173122e-01, -1.099650383e-01, -1.049197503e-01,
-     -9.988110384e-02, -9.484875828e-02, -8.982237675e-02, -8.480162582e-02,
-     -7.978617535e-02, -7.477569824e-02, -6.976987025e-02, -6.476836978e-02,
-     -5.977087768e-02, -5.477707708e-02, -4.978665318e-02, -4.479929306e-02,
-     -3.981468554e-02, -3.483252094e-02, -2.985249095e-02, -2.487428845e-02,
-     -1.989760733e-02, -1.492214229e-02, -9.947588740e-03, -4.973642567e-03,
-      0.000000000e+00,  4.973642567e-03,  9.947588740e-03,  1.492214229e-02,
-      1.989760733e-02,  2.487428845e-02,  2.985249095e-02,  3.483252094e-02,
-      3.981468554e-02,  4.479929306e-02,  4.978665318e-02,  5.477707708e-02,
-      5.977087768e-02,  6.476836978e-02,  6.976987025e-02,  7.477569824e-02,
-      7.978617535e-02,  8.480162582e-02,  8.982237675e-02,  9.484875828e-02,
-      9.988110384e-02,  1.049197503e-01,  1.099650383e-01,  1.150173122e-01,
-      1.200769208e-01,  1.251442172e-01,  1.302195590e-01,  1.353033088e-01,
-      1.403958344e-01,  1.454975090e-01,  1.506087115e-01,  1.557298269e-01,
-      1.608612465e-01,  1.660033681e-01,  1.711565967e-01,  1.763213443e-01,
-      1.814980309e-01,  1.866870844e-01,  1.918889411e-01,  1.971040461e-01,
-      2.023328540e-01,  2.075758290e-01,  2.128334453e-01,  2.181061879e-01,
-      2.233945532e-01,  2.286990490e-01,  2.340201956e-01,  2.393585260e-01,
-      2.447145871e-01,  2.500889395e-01,  2.554821590e-01,  2.608948371e-01,
-      2.663275813e-01,  2.717810168e-01,  2.772557865e-01,  2.827525527e-01,
-      2.882719975e-01,  2.938148240e-01,  2.993817576e-01,  3.049735469e-01,
-      3.105909654e-01,  3.162348121e-01,  3.219059136e-01,  3.276051254e-01,
-      3.333333333e-01,  3.390914556e-01,  3.448804446e-01,  3.507012885e-01,
-      3.565550140e-01,  3.624426882e-01,  3.683654214e-01,  3.743243695e-01,
-      3.803207370e-01,  3.863557800e-01,  3.924308100e-01,  3.985471970e-01,
-      4.047063738e-01,  4.109098402e-01,  4.171591678e-01,  4.234560051e-01,
-      4.298020828e-01,  4.361992206e-01,  4.426493331e-01,  4.491544378e-01,
-      4.557166630e-01,  4.623382565e-01,  4.690215962e-01,  4.757692002e-01,
-      4.825837395e-01,  4.894680517e-01,  4.964251556e-01,  5.034582687e-01,
-      5.105708258e-01,  5.177665009e-01,  5.250492308e-01,  5.324232433e-01,
-      5.398930877e-01,  5.474636710e-01,  5.551402986e-01,  5.629287213e-01,
-      5.708351903e-01,  5.788665198e-01,  5.870301615e-01,  5.953342919e-01,
-      6.037879145e-01,  6.124009827e-01,  6.211845465e-01,  6.301509296e-01,
-      6.393139448e-01,  6.486891596e-01,  6.582942244e-01,  6.681492851e-01,
-      6.782775070e-01,  6.887057478e-01,  6.994654384e-01,  7.105937516e-01,
-      7.221351863e-01,  7.341437612e-01,  7.466861322e-01,  7.598461583e-01,
-      7.737318355e-01,  7.884862959e-01,  8.043062326e-01,  8.214749794e-01,
-      8.404276493e-01,  8.618971430e-01,  8.873134070e-01,  9.203706289e-01,
-      1.000000000e+00,
-   };
 
-   const float lut_xfade_in[] = {
-      0.000000000e+00,  0.000000000e+00,  0.000000000e+00,  0.000000000e+00,
-      0.000000000e+00,  2.593122279e-04,  4.754021803e-03,  9.248539291e-03,
-      1.374268309e-02,  1.823627161e-02,  2.272912328e-02,  2.722105658e-02,
-      3.171189001e-02,  3.620144210e-02,  4.068953146e-02,  4.517597675e-02,
-      4.966059668e-02,  5.414321007e-02,  5.862363578e-02,  6.310169278e-02,
-      6.757720014e-02,  7.204997701e-02,  7.651984269e-02,  8.098661655e-02,
-      8.545011812e-02,  8.991016705e-02,  9.436658313e-02,  9.881918630e-02,
-      1.032677966e-01,  1.077122344e-01,  1.121523200e-01,  1.165878741e-01,
-      1.210187174e-01,  1.254446709e-01,  1.298655558e-01,  1.342811934e-01,
-      1.386914053e-01,  1.430960134e-01,  1.474948396e-01,  1.518877062e-01,
-      1.562744358e-01,  1.606548510e-01,  1.650287749e-01,  1.693960308e-01,
-      1.737564422e-01,  1.781098329e-01,  1.824560270e-01,  1.867948489e-01,
-      1.911261233e-01,  1.954496752e-01,  1.997653299e-01,  2.040729129e-01,
-      2.083722504e-01,  2.126631685e-01,  2.169454939e-01,  2.212190535e-01,
-      2.254836747e-01,  2.297391851e-01,  2.339854129e-01,  2.382221864e-01,
-      2.424493344e-01,  2.466666862e-01,  2.508740714e-01,  2.550713199e-01,
-      2.592582621e-01,  2.634347290e-01,  2.676005517e-01,  2.717555618e-01,
-      2.758995917e-01,  2.800324736e-01,  2.841540408e-01,  2.882641267e-01,
-      2.923625651e-01,  2.964491905e-01,  3.005238378e-01,  3.045863424e-01,
-      3.086365400e-01,  3.126742671e-01,  3.166993604e-01,  3.207116574e-01,
-      3.247109959e-01,  3.286972144e-01,  3.326701518e-01,  3.366296475e-01,
-      3.405755416e-01,  3.445076746e-01,  3.484258877e-01,  3.523300225e-01,
-      3.562199212e-01,  3.600954268e-01,  3.639563827e-01,  3.678026327e-01,
-      3.716340216e-01,  3.754503944e-01,  3.792515971e-01,  3.830374759e-01,
-      3.868078781e-01,  3.905626511e-01,  3.943016433e-01,  3.980247036e-01,
-      4.017316815e-01,  4.054224274e-01,  4.090967921e-01,  4.127546270e-01,
-      4.163957845e-01,  4.200201173e-01,  4.236274791e-01,  4.272177241e-01,
-      4.307907072e-01,  4.343462841e-01,  4.378843111e-01,  4.414046452e-01,
-      4.449071442e-01,  4.483916665e-01,  4.518580715e-01,  4.553062190e-01,
-      4.587359696e-01,  4.621471849e-01,  4.655397270e-01,  4.689134588e-01,
-      4.722682440e-01,  4.756039471e-01,  4.789204331e-01,  4.822175683e-01,
-      4.854952193e-01,  4.887532537e-01,  4.919915398e-01,  4.952099469e-01,
-      4.984083449e-01,  5.015866045e-01,  5.047445973e-01,  5.078821957e-01,
-      5.109992730e-01,  5.140957032e-01,  5.171713612e-01,  5.202261227e-01,
-      5.232598643e-01,  5.262724634e-01,  5.292637982e-01,  5.322337480e-01,
-      5.351821928e-01,  5.381090133e-01,  5.410140913e-01,  5.438973095e-01,
-      5.467585513e-01,  5.495977011e-01,  5.524146443e-01,  5.552092670e-01,
-      5.579814562e-01,  5.607311000e-01,  5.634580873e-01,  5.661623079e-01,
-      5.688436525e-01,  5.715020128e-01,  5.741372814e-01,  5.767493517e-01,
-      5.793381183e-01,  5.819034766e-01,  5.844453228e-01,  5.869635543e-01,
-      5.894580694e-01,  5.919287672e-01,  5.943755480e-01,  5.967983128e-01,
-      5.991969637e-01,  6.015714039e-01,  6.039215374e-01,  6.062472693e-01,
-      6.085485055e-01,  6.108251531e-01,  6.130771202e-01,  6.153043156e-01,
-      6.175066495e-01,  6.196840328e-01,  6.218363775e-01,  6.239635968e-01,
-      6.260656046e-01,  6.281423160e-01,  6.301936471e-01,  6.322195150e-01,
-      6.342198378e-01,  6.361945349e-01,  6.381435262e-01,  6.400667332e-01,
-      6.419640780e-01,  6.438354840e-01,  6.456808757e-01,  6.475001784e-01,
-      6.492933187e-01,  6.510602240e-01,  6.528008231e-01,  6.545150455e-01,
-      6.562028220e-01,  6.578640844e-01,  6.594987656e-01,  6.611067995e-01,
-      6.626881211e-01,  6.642426667e-01,  6.657703733e-01,  6.672711792e-01,
-      6.687450238e-01,  6.701918475e-01,  6.716115919e-01,  6.730041996e-01,
-      6.743696144e-01,  6.757077810e-01,  6.770186454e-01,  6.783021546e-01,
-      6.795582569e-01,  6.807869013e-01,  6.819880383e-01,  6.831616194e-01,
-      6.843075971e-01,  6.854259251e-01,  6.865165582e-01,  6.875794525e-01,
-      6.886145648e-01,  6.896218534e-01,  6.906012777e-01,  6.915527979e-01,
-      6.924763757e-01,  6.933719738e-01,  6.942395560e-01,  6.950790872e-01,
-      6.958905334e-01,  6.966738620e-01,  6.974290413e-01,  6.981560407e-01,
-      6.988548308e-01,  6.995253835e-01,  7.001676716e-01,  7.007816693e-01,
-      7.013673516e-01,  7.019246949e-01,  7.024536767e-01,  7.029542757e-01,
-      7.034264715e-01,  7.038702452e-01,  7.042855787e-01,  7.046724553e-01,
-      7.050308595e-01,  7.053607766e-01,  7.056621934e-01,  7.059350976e-01,
-      7.061794783e-01,  7.063953256e-01,  7.065826308e-01,  7.067413862e-01,
-      7.068715855e-01,  7.069732234e-01,  7.070462959e-01,  7.070907999e-01,
-      7.071067336e-01,  7.071067812e-01,  7.071067812e-01,  7.071067812e-01,
-      7.071067812e-01,
-   };
 
-   const float lut_xfade_out[] = {
-      7.071067812e-01,  7.071067812e-01,  7.071067812e-01,  7.071067812e-01,
-      7.071067812e-01,  7.071067336e-01,  7.070907999e-01,  7.070462959e-01,
-      7.069732234e-01,  7.068715855e-01,  7.067413862e-01,  7.065826308e-01,
-      7.063953256e-01,  7.061794783e-01,  7.059350976e-01,  7.056621934e-01,
-      7.053607766e-01,  7.050308595e-01,  7.046724553e-01,  7.042855787e-01,
-      7.038702452e-01,  7.034264715e-01,  7.029542757e-01,  7.024536767e-01,
-      7.019246949e-01,  7.013673516e-01,  7.007816693e-01,  7.001676716e-01,
-      6.995253835e-01,  6.988548308e-01,  6.981560407e-01,  6.974290413e-01,
-      6.966738620e-01,  6.958905334e-01,  6.950790872e-01,  6.942395560e-01,
-      6.933719738e-01,  6.924763757e-01,  6.915527979e-01,  6.906012777e-01,
-      6.896218534e-01,  6.886145648e-01,  6.875794525e-01,  6.865165582e-01,
-      6.854259251e-01,  6.843075971e-01,  6.831616194e-01,  6.819880383e-01,
-      6.807869013e-01,  6.795582569e-01,  6.783021546e-01,  6.770186454e-01,
-      6.757077810e-01,  6.743696144e-01,  6.730041996e-01,  6.716115919e-01,
-      6.701918475e-01,  6.687450238e-01,  6.672711792e-01,  6.657703733e-01,
-      6.642426667e-01,  6.626881211e-01,  6.611067995e-01,  6.594987656e-01,
-      6.578640844e-01,  6.562028220e-01,  6.545150455e-01,  6.528008231e-01,
-      6.510602240e-01,  6.492933187e-01,  6.475001784e-01,  6.456808757e-01,
-      6.438354840e-01,  6.419640780e-01,  6.400667332e-01,  6.381435262e-01,
-      6.361945349e-01,  6.342198378e-01,  6.322195150e-01,  6.301936471e-01,
-      6.281423160e-01,  6.260656046e-01,  6.239635968e-01,  6.218363775e-01,
-      6.196840328e-01,  6.175066495e-01,  6.153043156e-01,  6.130771202e-01,
-      6.108251531e-01,  6.085485055e-01,  6.062472693e-01,  6.039215374e-01,
-      6.015714039e-01,  5.991969637e-01,  5.967983128e-01,  5.943755480e-01,
-      5.919287672e-01,  5.894580694e-01,  5.869635543e-01,  5.844453228e-01,
-      5.819034766e-01,  5.793381183e-01,  5.767493517e-01,  5.741372814e-01,
-      5.715020128e-01,  5.688436525e-01,  5.661623079e-01,  5.634580873e-01,
-      5.607311000e-01,  5.579814562e-01,  5.552092670e-01,  5.524146443e-01,
-      5.495977011e-01,  5.467585513e-01,  5.438973095e-01,  5.410140913e-01,
-      5.381090133e-01,  5.351821928e-01,  5.322337480e-01,  5.292637982e-01,
-      5.262724634e-01,  5.232598643e-01,  5.202261227e-01,  5.171713612e-01,
-      5.140957032e-01,  5.109992730e-01,  5.078821957e-01,  5.047445973e-01,
-      5.015866045e-01,  4.984083449e-01,  4.952099469e-01,  4.919915398e-01,
-      4.887532537e-01,  4.854952193e-01,  4.822175683e-01,  4.789204331e-01,
-      4.756039471e-01,  4.722682440e-01,  4.689134588e-01,  4.655397270e-01,
-      4.621471849e-01,  4.587359696e-01,  4.553062190e-01,  4.518580715e-01,
-      4.483916665e-01,  4.449071442e-01,  4.414046452e-01,  4.378843111e-01,
-      4.343462841e-01,  4.307907072e-01,  4.272177241e-01,  4.236274791e-01,
-      4.200201173e-01,  4.163957845e-01,  4.127546270e-01,  4.090967921e-01,
-      4.054224274e-01,  4.017316815e-01,  3.980247036e-01,  3.943016433e-01,
-      3.905626511e-01,  3.868078781e-01,  3.830374759e-01,  3.792515971e-01,
-      3.754503944e-01,  3.716340216e-01,  3.678026327e-01,  3.639563827e-01,
-      3.600954268e-01,  3.562199212e-01,  3.523300225e-01,  3.484258877e-01,
-      3.445076746e-01,  3.405755416e-01,  3.366296475e-01,  3.326701518e-01,
-      3.286972144e-01,  3.247109959e-01,  3.207116574e-01,  3.166993604e-01,
-      3.126742671e-01,  3.086365400e-01,  3.045863424e-01,  3.005238378e-01,
-      2.964491905e-01,  2.923625651e-01,  2.882641267e-01,  2.841540408e-01,
-      2.800324736e-01,  2.758995917e-01,  2.717555618e-01,  2.676005517e-01,
-      2.634347290e-01,  2.592582621e-01,  2.550713199e-01,  2.508740714e-01,
-      2.466666862e-01,  2.424493344e-01,  2.382221864e-01,  2.339854129e-01,
-      2.297391851e-01,  2.254836747e-01,  2.212190535e-01,  2.169454939e-01,
-      2.126631685e-01,  2.083722504e-01,  2.040729129e-01,  1.997653299e-01,
-      1.954496752e-01,  1.911261233e-01,  1.867948489e-01,  1.824560270e-01,
-      1.781098329e-01,  1.737564422e-01,  1.693960308e-01,  1.650287749e-01,
-      1.606548510e-01,  1.562744358e-01,  1.518877062e-01,  1.474948396e-01,
-      1.430960134e-01,  1.386914053e-01,  1.342811934e-01,  1.298655558e-01,
-      1.254446709e-01,  1.210187174e-01,  1.165878741e-01,  1.121523200e-01,
-      1.077122344e-01,  1.032677966e-01,  9.881918630e-02,  9.436658313e-02,
-      8.991016705e-02,  8.545011812e-02,  8.098661655e-02,  7.651984269e-02,
-      7.204997701e-02,  6.757720014e-02,  6.310169278e-02,  5.862363578e-02,
-      5.414321007e-02,  4.966059668e-02,  4.517597675e-02,  4.068953146e-02,
-      3.620144210e-02,  3.171189001e-02,  2.722105658e-02,  2.272912328e-02,
-      1.823627161e-02,  1.374268309e-02,  9.248539291e-03,  4.754021803e-03,
-      2.593122279e-04,  4.329780281e-17,  4.329780281e-17,  4.329780281e-17,
-      4.329780281e-17,
-   };
 
-   const float lut_bipolar_fold[] = {
-     -8.678009033e-01, -8.677901336e-01, -8.677789794e-01, -8.677676173e-01,
-     -8.677560993e-01, -8.677444533e-01, -8.677326970e-01, -8.677208428e-01,
-     -8.677089000e-01, -8.676968760e-01, -8.676847765e-01, -8.676726064e-01,
-     -8.676603697e-01, -8.676480698e-01, -8.676357099e-01, -8.676232924e-01,
-     -8.676108197e-01, -8.675982939e-01, -8.675857167e-01, -8.675730900e-01,
-     -8.675604151e-01, -8.675476935e-01, -8.675349264e-01, -8.675221149e-01,
-     -8.675092603e-01, -8.674971687e-01, -8.674885432e-01, -8.674798907e-01,
-     -8.674712118e-01, -8.674625070e-01, -8.674537767e-01, -8.674450213e-01,
-     -8.674362413e-01, -8.674274372e-01, -8.674186091e-01, -8.674097576e-01,
-     -8.674008829e-01, -8.673919854e-01, -8.673830653e-01, -8.673741230e-01,
-     -8.673651587e-01, -8.673520079e-01, -8.673384967e-01, -8.673249535e-01,
-     -8.673113789e-01, -8.672977731e-01, -8.672841364e-01, -8.672704691e-01,
-     -8.672567715e-01, -8.672430440e-01, -8.672292867e-01, -8.672154999e-01,
-     -8.672016839e-01, -8.671878389e-01, -8.671739651e-01, -8.671600628e-01,
-     -8.671461321e-01, -8.671321734e-01, -8.671181867e-01, -8.671041723e-01,
-     -8.670901303e-01, -8.670760610e-01, -8.670619645e-01, -8.670478409e-01,
-     -8.670336905e-01, -8.670195134e-01, -8.670053098e-01, -8.669910797e-01,
-     -8.669768235e-01, -8.669625411e-01, -8.669527118e-01, -8.669431556e-01,
-     -8.669335823e-01, -8.669239920e-01, -8.669143846e-01, -8.669047604e-01,
-     -8.668951193e-01, -8.668854615e-01, -8.668757870e-01, -8.668660960e-01,
-     -8.668563883e-01, -8.668466642e-01, -8.668369237e-01, -8.668270539e-01,
-     -8.668123942e-01, -8.667977101e-01, -8.667830018e-01, -8.667682693e-01,
-     -8.667535127e-01, -8.667387321e-01, -8.667239276e-01, -8.667090992e-01,
-     -8.666942471e-01, -8.666793712e-01, -8.666644717e-01, -8.666495487e-01,
-     -8.666346021e-01, -8.666217470e-01, -8.666117514e-01, -8.666017403e-01,
-     -8.665917137e-01, -8.665816717e-01, -8.665716142e-01, -8.665615414e-01,
-     -8.665514532e-01, -8.665413497e-01, -8.665312309e-01, -8.665210969e-01,
-     -8.665109477e-01, -8.665007833e-01, -8.664900561e-01, -8.664747641e-01,
-     -8.664594496e-01, -8.664441124e-01, -8.664287528e-01, -8.664133706e-01,
-     -8.663979660e-01, -8.663825389e-01, -8.663670896e-01, -8.663516178e-01,
-     -8.663361238e-01, -8.663206075e-01, -8.663050690e-01, -8.662895083e-01,
-     -8.662739255e-01, -8.662583205e-01, -8.662426934e-01, -8.662270443e-01,
-     -8.662113732e-01, -8.661956800e-01, -8.661799649e-01, -8.661642278e-01,
-     -8.661484688e-01, -8.661326879e-01, -8.661168852e-01, -8.661010606e-01,
-     -8.660864319e-01, -8.660758531e-01, -8.660652598e-01, -8.660546520e-01,
-     -8.660440297e-01, -8.660333930e-01, -8.660227418e-01, -8.660120761e-01,
-     -8.660013961e-01, -8.659907016e-01, -8.659799927e-01, -8.659692695e-01,
-     -8.659585318e-01, -8.659443748e-01, -8.659282252e-01, -8.659120541e-01,
-     -8.658958615e-01, -8.658796475e-01, -8.658634119e-01, -8.658471549e-01,
-     -8.658308765e-01, -8.658145766e-01, -8.657982553e-01, -8.657819126e-01,
-     -8.657655484e-01, -8.657491629e-01, -8.657327560e-01, -8.657163278e-01,
-     -8.656998782e-01, -8.656834072e-01, -8.656669150e-01, -8.656504013e-01,
-     -8.656338664e-01, -8.656173101e-01, -8.656007326e-01, -8.655841337e-01,
-     -8.655675136e-01, -8.655511674e-01, -8.655400589e-01, -8.655289362e-01,
-     -8.655177994e-01, -8.655066483e-01, -8.654954832e-01, -8.654843038e-01,
-     -8.654731103e-01, -8.654619026e-01, -8.654506807e-01, -8.654394447e-01,
-     -8.654281945e-01, -8.654166550e-01, -8.653997373e-01, -8.653827983e-01,
-     -8.653658381e-01, -8.653488567e-01, -8.653318540e-01, -8.653148301e-01,
-     -8.652977850e-01, -8.652807186e-01, -8.652636310e-01, -8.652465222e-01,
-     -8.652293922e-01, -8.652122409e-01, -8.651950683e-01, -8.651778746e-01,
-     -8.651606596e-01, -8.651434234e-01, -8.651261659e-01, -8.651088872e-01,
-     -8.650915872e-01, -8.650742660e-01, -8.650569235e-01, -8.650395598e-01,
-     -8.650221748e-01, -8.650080618e-01, -8.649964435e-01, -8.649848109e-01,
-     -8.649731642e-01, -8.649615033e-01, -8.649498281e-01, -8.649381388e-01,
-     -8.649264353e-01, -8.649147176e-01, -8.649029856e-01, -8.648912395e-01,
-     -8.648790331e-01, -8.648613712e-01, -8.648436880e-01, -8.648259834e-01,
-     -8.648082575e-01, -8.647905101e-01, -8.647727415e-01, -8.647549514e-01,
-     -8.647371399e-01, -8.647193071e-01, -8.647014528e-01, -8.646835771e-01,
-     -8.646656800e-01, -8.646477614e-01, -8.646298214e-01, -8.646118600e-01,
-     -8.645938771e-01, -8.645758727e-01, -8.645578468e-01, -8.645397994e-01,
-     -8.645217305e-01, -8.645036401e-01, -8.644855282e-01, -8.644673947e-01,
-     -8.644492397e-01, -8.644310631e-01, -8.644128649e-01, -8.643946451e-01,
-     -8.643764038e-01, -8.643581408e-01, -8.643398562e-01, -8.643215500e-01,
-     -8.643032221e-01, -8.642848725e-01, -8.642697086e-01, -8.642574466e-01,
-     -8.642451702e-01, -8.642328793e-01, -8.642205739e-01, -8.642082540e-01,
-     -8.641959197e-01, -8.641835708e-01, -8.641712073e-01, -8.641588294e-01,
-     -8.641464369e-01, -8.641301219e-01, -8.641114894e-01, -8.640928351e-01,
-     -8.640741589e-01, -8.640554608e-01, -8.640367408e-01, -8.640179989e-01,
-     -8.639992351e-01, -8.639804492e-01, -8.639616414e-01, -8.639428117e-01,
-     -8.639239599e-01, -8.639050860e-01, -8.638861902e-01, -8.638672722e-01,
-     -8.638483322e-01, -8.638293701e-01, -8.638103859e-01, -8.637913796e-01,
-     -8.637723511e-01, -8.637533004e-01, -8.637358229e-01, -8.637230929e-01,
-     -8.637103480e-01, -8.636975884e-01, -8.636848138e-01, -8.636720245e-01,
-     -8.636592202e-01, -8.636464011e-01, -8.636335671e-01, -8.636207182e-01,
-     -8.636078544e-01, -8.635900953e-01, -8.635707548e-01, -8.635513918e-01,
-     -8.635320064e-01, -8.635125985e-01, -8.634931680e-01, -8.634737151e-01,
-     -8.634542397e-01, -8.634347416e-01, -8.634152210e-01, -8.633956778e-01,
-     -8.633761120e-01, -8.633565236e-01, -8.633369124e-01, -8.633172786e-01,
-     -8.632976221e-01, -8.632779428e-01, -8.632582408e-01, -8.632385160e-01,
-     -8.632187684e-01, -8.631989980e-01, -8.631792047e-01, -8.631593886e-01,
-     -8.631395496e-01, -8.631196877e-01, -8.630998028e-01, -8.630798950e-01,
-     -8.630599642e-01, -8.630400104e-01, -8.630200336e-01, -8.630001852e-01,
-     -8.629868366e-01, -8.629734725e-01, -8.629600931e-01, -8.629466982e-01,
-     -8.629332878e-01, -8.629198620e-01, -8.629064207e-01, -8.628929639e-01,
-     -8.628794916e-01, -8.628659001e-01, -8.628456450e-01, -8.628253666e-01,
-     -8.628050648e-01, -8.627847395e-01, -8.627643909e-01, -8.627440187e-01,
-     -8.627236231e-01, -8.627032040e-01, -8.626827614e-01, -8.626622952e-01,
-     -8.626418054e-01, -8.626212920e-01, -8.626007550e-01, -8.625801943e-01,
-     -8.625596098e-01, -8.625390017e-01, -8.625183698e-01, -8.624977142e-01,
-     -8.624770347e-01, -8.624586806e-01, -8.624448625e-01, -8.624310285e-01,
-     -8.624171785e-01, -8.624033125e-01, -8.623894306e-01, -8.623755327e-01,
-     -8.623616187e-01, -8.623476888e-01, -8.623337427e-01, -8.623151201e-01,
-     -8.622941528e-01, -8.622731612e-01, -8.622521455e-01, -8.622311056e-01,
-     -8.622100413e-01, -8.621889528e-01, -8.621678399e-01, -8.621467027e-01,
-     -8.621255411e-01, -8.621043551e-01, -8.620831446e-01, -8.620619097e-01,
-     -8.620406502e-01, -8.620193662e-01, -8.619980577e-01, -8.619767245e-01,
-     -8.619553667e-01, -8.619339842e-01, -8.619125770e-01, -8.618911451e-01,
-     -8.618696884e-01, -8.618482069e-01, -8.618267006e-01, -8.618051695e-01,
-     -8.617836134e-01, -8.617620324e-01, -8.617404265e-01, -8.617187956e-01,
-     -8.616971396e-01, -8.616754586e-01, -8.616537525e-01, -8.616320213e-01,
-     -8.616102649e-01, -8.615884834e-01, -8.615666766e-01, -8.615448445e-01,
-     -8.615231373e-01, -8.615085488e-01, -8.614939435e-01, -8.614793212e-01,
-     -8.614646820e-01, -8.614500257e-01, -8.614353525e-01, -8.614206623e-01,
-     -8.614059550e-01, -8.613912306e-01, -8.613701537e-01, -8.613480158e-01,
-     -8.613258523e-01, -8.613036629e-01, -8.612814478e-01, -8.612592069e-01,
-     -8.612369401e-01, -8.612146474e-01, -8.611923288e-01, -8.611699842e-01,
-     -8.611476136e-01, -8.611252170e-01, -8.611027943e-01, -8.610803455e-01,
-     -8.610578705e-01, -8.610353693e-01, -8.610128419e-01, -8.609902883e-01,
-     -8.609677083e-01, -8.609451020e-01, -8.609224693e-01, -8.608998102e-01,
-     -8.608771246e-01, -8.608544125e-01, -8.608316739e-01, -8.608089087e-01,
-     -8.607861169e-01, -8.607705030e-01, -8.607552729e-01, -8.607400250e-01,
-     -8.607247592e-01, -8.607094756e-01, -8.606941741e-01, -8.606788546e-01,
-     -8.606635171e-01, -8.606469252e-01, -8.606238651e-01, -8.606007779e-01,
-     -8.605776636e-01, -8.605545222e-01, -8.605313536e-01, -8.605081577e-01,
-     -8.604849347e-01, -8.604616843e-01, -8.604384065e-01, -8.604151014e-01,
-     -8.603917689e-01, -8.603684088e-01, -8.603450213e-01, -8.603216062e-01,
-     -8.602981635e-01, -8.602746931e-01, -8.602511951e-01, -8.602276694e-01,
-     -8.602041158e-01, -8.601805345e-01, -8.601569253e-01, -8.601332882e-01,
-     -8.601096231e-01, -8.600859300e-01, -8.600622089e-01, -8.600384598e-01,
-     -8.600146825e-01, -8.599908770e-01, -8.599670433e-01, -8.599431814e-01,
-     -8.599192911e-01, -8.598953725e-01, -8.598714255e-01, -8.598474501e-01,
-     -8.598234461e-01, -8.597994137e-01, -8.597753526e-01, -8.597512630e-01,
-     -8.597271446e-01, -8.597029975e-01, -8.596788217e-01, -8.596546170e-01,
-     -8.596347739e-01, -8.596185989e-01, -8.596024047e-01, -8.595861911e-01,
-     -8.595699581e-01, -8.595537058e-01, -8.595374340e-01, -8.595211427e-01,
-     -8.595026092e-01, -8.594781138e-01, -8.594535890e-01, -8.594290348e-01,
-     -8.594044512e-01, -8.593798381e-01, -8.593551954e-01, -8.593305232e-01,
-     -8.593058213e-01, -8.592810897e-01, -8.592563284e-01, -8.592315373e-01,
-     -8.592067163e-01, -8.591818654e-01, -8.591569846e-01, -8.591320738e-01,
-     -8.591071330e-01, -8.590821621e-01, -8.590571610e-01, -8.590321297e-01,
-     -8.590070681e-01, -8.589819762e-01, -8.589568540e-01, -8.589317014e-01,
-     -8.589065183e-01, -8.588813046e-01, -8.588560604e-01, -8.588307856e-01,
-     -8.588054801e-01, -8.587801439e-01, -8.587547769e-01, -8.587293790e-01,
-     -8.587039502e-01, -8.586784905e-01, -8.586529998e-01, -8.586274781e-01,
-     -8.586019252e-01, -8.585763411e-01, -8.585507258e-01, -8.585250793e-01,
-     -8.585003334e-01, -8.584831938e-01, -8.584660333e-01, -8.584488518e-01,
-     -8.584316493e-01, -8.584144257e-01, -8.583971810e-01, -8.583799151e-01,
-     -8.583599820e-01, -8.583340196e-01, -8.583080252e-01, -8.582819989e-01,
-     -8.582559405e-01, -8.582298501e-01, -8.582037275e-01, -8.581775727e-01,
-     -8.581513857e-01, -8.581251664e-01, -8.580989147e-01, -8.580726305e-01,
-     -8.580463139e-01, -8.580199647e-01, -8.579935829e-01, -8.579671684e-01,
-     -8.579407212e-01, -8.579142411e-01, -8.578877283e-01, -8.578611825e-01,
-     -8.578346037e-01, -8.578079919e-01, -8.577813470e-01, -8.577546689e-01,
-     -8.577279576e-01, -8.577012130e-01, -8.576744351e-01, -8.576476237e-01,
-     -8.576207789e-01, -8.575939005e-01, -8.575669885e-01, -8.575400429e-01,
-     -8.575130635e-01, -8.574860503e-01, -8.574590032e-01, -8.574319223e-01,
-     -8.574048073e-01, -8.573776583e-01, -8.573504752e-01, -8.573232578e-01,
-     -8.572960063e-01, -8.572687204e-01, -8.572414001e-01, -8.572140454e-01,
-     -8.571866561e-01, -8.571592323e-01, -8.571317738e-01, -8.571042806e-01,
-     -8.570767526e-01, -8.570491898e-01, -8.570215920e-01, -8.569939593e-01,
-     -8.569662914e-01, -8.569450616e-01, -8.569265695e-01, -8.569080539e-01,
-     -8.568895148e-01, -8.568709520e-01, -8.568523656e-01, -8.568337555e-01,
-     -8.568108172e-01, -8.567828308e-01, -8.567548086e-01, -8.567267505e-01,
-     -8.566986566e-01, -8.566705267e-01, -8.566423607e-01, -8.566141587e-01,
-     -8.565859204e-01, -8.565576459e-01, -8.565293351e-01, -8.565009878e-01,
-     -8.564726041e-01, -8.564441838e-01, -8.564157269e-01, -8.563872334e-01,
-     -8.563587030e-01, -8.563301358e-01, -8.563015316e-01, -8.562728905e-01,
-     -8.562442123e-01, -8.562154969e-01, -8.561867444e-01, -8.561579545e-01,
-     -8.561291272e-01, -8.561002625e-01, -8.560713603e-01, -8.560424205e-01,
-     -8.560134430e-01, -8.559844277e-01, -8.559553746e-01, -8.559262835e-01,
-     -8.558971545e-01, -8.558679874e-01, -8.558387821e-01, -8.558095386e-01,
-     -8.557802568e-01, -8.557509366e-01, -8.557215780e-01, -8.556921808e-01,
-     -8.556627449e-01, -8.556332703e-01, -8.556037570e-01, -8.555742048e-01,
-     -8.555446136e-01, -8.555149834e-01, -8.554853140e-01, -8.554556055e-01,
-     -8.554258576e-01, -8.553960704e-01, -8.553662438e-01, -8.553363776e-01,
-     -8.553064718e-01, -8.552765263e-01, -8.552465410e-01, -8.552165158e-01,
-     -8.551864507e-01, -8.551563455e-01, -8.551262002e-01, -8.550960147e-01,
-     -8.550657889e-01, -8.550355227e-01, -8.550052160e-01, -8.549748688e-01,
-     -8.549444809e-01, -8.549140523e-01, -8.548835829e-01, -8.548530725e-01,
-     -8.548225212e-01, -8.547919287e-01, -8.547612951e-01, -8.547306202e-01,
-     -8.546999040e-01, -8.546691463e-01, -8.546383471e-01, -8.546075062e-01,
-     -8.545766237e-01, -8.545456993e-01, -8.545147330e-01, -8.544837247e-01,
-     -8.544526744e-01, -8.544215818e-01, -8.543904470e-01, -8.543592699e-01,
-     -8.543280502e-01, -8.542967881e-01, -8.542654833e-01, -8.542341357e-01,
-     -8.542027453e-01, -8.541713120e-01, -8.541398356e-01, -8.541083162e-01,
-     -8.540767535e-01, -8.540451475e-01, -8.540134981e-01, -8.539818052e-01,
-     -8.539500687e-01, -8.539182885e-01, -8.538864645e-01, -8.538545966e-01,
-     -8.538226847e-01, -8.537907287e-01, -8.537587286e-01, -8.537266841e-01,
-     -8.536945952e-01, -8.536624619e-01, -8.536302839e-01, -8.535980613e-01,
-     -8.535657938e-01, -8.535334815e-01, -8.535011242e-01, -8.534687218e-01,
-     -8.534362741e-01, -8.534037812e-01, -8.533712428e-01, -8.533386590e-01,
-     -8.533060295e-01, -8.532733543e-01, -8.532406332e-01, -8.532078663e-01,
-     -8.531750533e-01, -8.531421941e-01, -8.531092887e-01, -8.530763370e-01,
-     -8.530433388e-01, -8.530102940e-01, -8.529772025e-01, -8.529440643e-01,
-     -8.529108791e-01, -8.528776470e-01, -8.528443677e-01, -8.528110413e-01,
-     -8.527776675e-01, -8.527442462e-01, -8.527107774e-01, -8.526772609e-01,
-     -8.526436967e-01, -8.526100846e-01, -8.525764245e-01, -8.525427163e-01,
-     -8.525089598e-01, -8.524751550e-01, -8.524413018e-01, -8.524074000e-01,
-     -8.523734495e-01, -8.523394502e-01, -8.523054021e-01, -8.522713049e-01,
-     -8.522371585e-01, -8.522029629e-01, -8.521687180e-01, -8.521344235e-01,
-     -8.521000794e-01, -8.520656857e-01, -8.520312420e-01, -8.519967484e-01,
-     -8.519622048e-01, -8.519276109e-01, -8.518929667e-01, -8.518582721e-01,
-     -8.518235269e-01, -8.517887310e-01, -8.517538844e-01, -8.517189868e-01,
-     -8.516840381e-01, -8.516490383e-01, -8.516139872e-01, -8.515788847e-01,
-     -8.515437306e-01, -8.515085249e-01, -8.514732673e-01, -8.514379579e-01,
-     -8.514025964e-01, -8.513671828e-01, -8.513317168e-01, -8.512961985e-01,
-     -8.512606276e-01, -8.512250040e-01, -8.511893276e-01, -8.511535983e-01,
-     -8.511178159e-01, -8.510819803e-01, -8.510460914e-01, -8.510101491e-01,
-     -8.509741531e-01, -8.509381035e-01, -8.509020000e-01, -8.508658426e-01,
-     -8.508296310e-01, -8.507933652e-01, -8.507570450e-01, -8.507206703e-01,
-     -8.506842409e-01, -8.506477568e-01, -8.506112177e-01, -8.505746236e-01,
-     -8.505379743e-01, -8.505012697e-01, -8.504645097e-01, -8.504276940e-01,
-     -8.503908226e-01, -8.503538953e-01, -8.503169120e-01, -8.502798725e-01,
-     -8.502427768e-01, -8.502056246e-01, -8.501684158e-01, -8.501311504e-01,
-     -8.500938280e-01, -8.500564487e-01, -8.500190122e-01, -8.499815184e-01,
-     -8.499334277e-01, -8.498832826e-01, -8.498330606e-01, -8.497827615e-01,
-     -8.497323850e-01, -8.496882060e-01, -8.496503072e-01, -8.496123499e-01,
-     -8.495743340e-01, -8.495362594e-01, -8.494981258e-01, -8.494599333e-01,
-     -8.494216815e-01, -8.493833704e-01, -8.493449998e-01, -8.493065695e-01,
-     -8.492680794e-01, -8.492295294e-01, -8.491909193e-01, -8.491522489e-01,
-     -8.491135181e-01, -8.490747268e-01, -8.490358747e-01, -8.489969618e-01,
-     -8.489579878e-01, -8.489189526e-01, -8.488798561e-01, -8.488406981e-01,
-     -8.488014784e-01, -8.487621969e-01, -8.487228534e-01, -8.486834478e-01,
-     -8.486439798e-01, -8.486044495e-01, -8.485648565e-01, -8.485252007e-01,
-     -8.484854819e-01, -8.484457001e-01, -8.484058550e-01, -8.483659465e-01,
-     -8.483259743e-01, -8.482822115e-01, -8.482287450e-01, -8.481751931e-01,
-     -8.481215555e-01, -8.480678320e-01, -8.480176579e-01, -8.479772359e-01,
-     -8.479367489e-01, -8.478961969e-01, -8.478555796e-01, -8.478148968e-01,
-     -8.477741484e-01, -8.477333343e-01, -8.476924541e-01, -8.476515078e-01,
-     -8.476104953e-01, -8.475694162e-01, -8.475282705e-01, -8.474870579e-01,
-     -8.474457783e-01, -8.474044315e-01, -8.473630174e-01, -8.473215358e-01,
-     -8.472799864e-01, -8.472383691e-01, -8.471879448e-01, -8.471322733e-01,
-     -8.470765105e-01, -8.470206563e-01, -8.469647103e-01, -8.469200907e-01,
-     -8.468779930e-01, -8.468358260e-01, -8.467935895e-01, -8.467512832e-01,
-     -8.467089070e-01, -8.466664607e-01, -8.466239442e-01, -8.465813572e-01,
-     -8.465386995e-01, -8.464959709e-01, -8.464531714e-01, -8.464103006e-01,
-     -8.463673584e-01, -8.463243445e-01, -8.462812589e-01, -8.462381013e-01,
-     -8.461948715e-01, -8.461515693e-01, -8.460946988e-01, -8.460367687e-01,
-     -8.459787414e-01, -8.459206165e-01, -8.458668270e-01, -8.458230864e-01,
-     -8.457792721e-01, -8.457353837e-01, -8.456914213e-01, -8.456473844e-01,
-     -8.456032730e-01, -8.455590868e-01, -8.455148257e-01, -8.454704894e-01,
-     -8.454260777e-01, -8.453815905e-01, -8.453370274e-01, -8.452923884e-01,
-     -8.452382712e-01, -8.451785490e-01, -8.451187247e-01, -8.450587979e-01,
-     -8.450009074e-01, -8.449558080e-01, -8.449106312e-01, -8.448653768e-01,
-     -8.448200444e-01, -8.447746340e-01, -8.447291452e-01, -8.446835780e-01,
-     -8.446379320e-01, -8.445922070e-01, -8.445464029e-01, -8.445005194e-01,
-     -8.444545562e-01, -8.444085133e-01, -8.443488283e-01, -8.442872240e-01,
-     -8.442255123e-01, -8.441636931e-01, -8.441099548e-01, -8.440634282e-01,
-     -8.440168203e-01, -8.439701308e-01, -8.439233594e-01, -8.438765060e-01,
-     -8.438295703e-01, -8.437825521e-01, -8.437354512e-01, -8.436882672e-01,
-     -8.436410001e-01, -8.435936496e-01, -8.435462153e-01, -8.434881718e-01,
-     -8.434247021e-01, -8.433611199e-01, -8.432974250e-01, -8.432406423e-01,
-     -8.431927012e-01, -8.431446747e-01, -8.430965627e-01, -8.430483649e-01,
-     -8.430000811e-01, -8.429517110e-01, -8.429032544e-01, -8.428533191e-01,
-     -8.427884787e-01, -8.427235218e-01, -8.426584484e-01, -8.425932579e-01,
-     -8.425435456e-01, -8.424944766e-01, -8.424453191e-01, -8.423960728e-01,
-     -8.423467376e-01, -8.422973132e-01, -8.422477993e-01, -8.421981956e-01,
-     -8.421355026e-01, -8.420691241e-01, -8.420026250e-01, -8.419360048e-01,
-     -8.418816838e-01, -8.418315364e-01, -8.417812975e-01, -8.417309668e-01,
-     -8.416682157e-01, -8.416008623e-01, -8.415333855e-01, -8.414657849e-01,
-     -8.414107888e-01, -8.413599019e-01, -8.413089214e-01, -8.412578470e-01,
-     -8.412066784e-01, -8.411554155e-01, -8.411040578e-01, -8.410526051e-01,
-     -8.409860288e-01, -8.409171710e-01, -8.408481854e-01, -8.407790718e-01,
-     -8.407267693e-01, -8.406747411e-01, -8.406226161e-01, -8.405703939e-01,
-     -8.405180742e-01, -8.404656569e-01, -8.404131415e-01, -8.403557852e-01,
-     -8.402855023e-01, -8.402150875e-01, -8.401445406e-01, -8.400819462e-01,
-     -8.400288369e-01, -8.399756276e-01, -8.399223180e-01, -8.398569488e-01,
-     -8.397856008e-01, -8.397141179e-01, -8.396424998e-01, -8.395871172e-01,
-     -8.395331999e-01, -8.394791802e-01, -8.394218057e-01, -8.393495055e-01,
-     -8.392770676e-01, -8.392044917e-01, -8.391403980e-01, -8.390857581e-01,
-     -8.390310138e-01, -8.389761649e-01, -8.389212108e-01, -8.388661515e-01,
-     -8.388109865e-01, -8.387531449e-01, -8.386793086e-01, -8.386053303e-01,
-     -8.385312095e-01, -8.384664276e-01, -8.384106223e-01, -8.383547092e-01,
-     -8.382986880e-01, -8.382255920e-01, -8.381506075e-01, -8.380754775e-01,
-     -8.380063768e-01, -8.379498102e-01, -8.378931335e-01, -8.378363465e-01,
-     -8.377647696e-01, -8.376887580e-01, -8.376125979e-01, -8.375409497e-01,
-     -8.374836060e-01, -8.374261500e-01, -8.373685813e-01, -8.372966944e-01,
-     -8.372196344e-01, -8.371424230e-01, -8.370700349e-01, -8.370118980e-01,
-     -8.369536464e-01, -8.368952799e-01, -8.368212157e-01, -8.367430857e-01,
-     -8.366648009e-01, -8.365935183e-01, -8.365345717e-01, -8.364755081e-01,
-     -8.364163270e-01, -8.363381796e-01, -8.362589570e-01, -8.361795766e-01,
-     -8.361000378e-01, -8.360203401e-01, -8.359404831e-01, -8.358644660e-01,
-     -8.358043331e-01, -8.357440798e-01, -8.356837055e-01, -8.356059302e-01,
-     -8.355251073e-01, -8.354441216e-01, -8.353738531e-01, -8.353128688e-01,
-     -8.352517614e-01, -8.351856812e-01, -8.351038749e-01, -8.350219030e-01,
-     -8.349397649e-01, -8.348772261e-01, -8.348153723e-01, -8.347533928e-01,
-     -8.346766805e-01, -8.345937044e-01, -8.345105593e-01, -8.344272445e-01,
-     -8.343437596e-01, -8.342601041e-01, -8.341817076e-01, -8.341187088e-01,
-     -8.340555810e-01, -8.339909041e-01, -8.339063877e-01, -8.338216975e-01,
-     -8.337368331e-01, -8.336517939e-01, -8.335665794e-01, -8.334811891e-01,
-     -8.334115850e-01, -8.333472773e-01, -8.332828365e-01, -8.332049975e-01,
-     -8.331187200e-01, -8.330322634e-01, -8.329565959e-01, -8.328914837e-01,
-     -8.328262360e-01, -8.327517746e-01, -8.326644146e-01, -8.325768724e-01,
-     -8.324891473e-01, -8.324012387e-01, -8.323131461e-01, -8.322248691e-01,
-     -8.321364069e-01, -8.320477590e-01, -8.319647991e-01, -8.318980335e-01,
-     -8.318311273e-01, -8.317584382e-01, -8.316688535e-01, -8.315790798e-01,
-     -8.314891163e-01, -8.313989626e-01, -8.313086181e-01, -8.312245358e-01,
-     -8.311564899e-01, -8.310882995e-01, -8.310124589e-01, -8.309211516e-01,
-     -8.308296499e-01, -8.307379532e-01, -8.306460610e-01, -8.305539727e-01,
-     -8.304616877e-01, -8.303692053e-01, -8.302765250e-01, -8.301969387e-01,
-     -8.301271301e-01, -8.300571718e-01, -8.299709507e-01, -8.298772715e-01,
-     -8.297833907e-01, -8.296893077e-01, -8.295950218e-01, -8.295005324e-01,
-     -8.294058389e-01, -8.293109406e-01, -8.292193118e-01, -8.291478296e-01,
-     -8.290761924e-01, -8.289964262e-01, -8.289004947e-01, -8.288043547e-01,
-     -8.287080054e-01, -8.286114463e-01, -8.285146767e-01, -8.284176959e-01,
-     -8.283205034e-01, -8.282230983e-01, -8.281254802e-01, -8.280276482e-01,
-     -8.279296018e-01, -8.278313403e-01, -8.277328630e-01, -8.276470136e-01,
-     -8.275728305e-01, -8.274984840e-01, -8.274039212e-01, -8.273043549e-01,
-     -8.272045687e-01, -8.271045620e-01, -8.270043341e-01, -8.269038843e-01,
-     -8.268032119e-01, -8.267023162e-01, -8.266011966e-01, -8.264998522e-01,
-     -8.263982824e-01, -8.262964866e-01, -8.261944640e-01, -8.260922138e-01,
-     -8.259897354e-01, -8.258870281e-01, -8.257840911e-01, -8.256809238e-01,
-     -8.255775253e-01, -8.254738951e-01, -8.253700323e-01, -8.252659362e-01,
-     -8.251616061e-01, -8.250570412e-01, -8.249522409e-01, -8.248472043e-01,
-     -8.247560941e-01, -8.246769606e-01, -8.245976483e-01, -8.244918195e-01,
-     -8.243855906e-01, -8.242791209e-01, -8.241724098e-01, -8.240654564e-01,
-     -8.239582600e-01, -8.238508198e-01, -8.237431350e-01, -8.236352050e-01,
-     -8.235270288e-01, -8.234186057e-01, -8.233099350e-01, -8.232010158e-01,
-     -8.230918473e-01, -8.229815761e-01, -8.228444895e-01, -8.227070884e-01,
-     -8.225855267e-01, -8.224751001e-01, -8.223644195e-01, -8.222534841e-01,
-     -8.221422930e-01, -8.220308455e-01, -8.219191407e-01, -8.218071778e-01,
-     -8.216949560e-01, -8.215824744e-01, -8.214697323e-01, -8.213567287e-01,
-     -8.212434629e-01, -8.211299340e-01, -8.210161412e-01, -8.209020837e-01,
-     -8.207877605e-01, -8.206731708e-01, -8.205583139e-01, -8.204431887e-01,
-     -8.203277946e-01, -8.202121305e-01, -8.200961956e-01, -8.199799892e-01,
-     -8.198382378e-01, -8.196922974e-01, -8.195625925e-01, -8.194452908e-01,
-     -8.193277130e-01, -8.192098582e-01, -8.190917257e-01, -8.189733145e-01,
-     -8.188546236e-01, -8.187356523e-01, -8.186163995e-01, -8.184824087e-01,
-     -8.183326357e-01, -8.181898049e-01, -8.180694174e-01, -8.179487439e-01,
-     -8.178277834e-01, -8.177065351e-01, -8.175849980e-01, -8.174631712e-01,
-     -8.173410538e-01, -8.172186447e-01, -8.170837350e-01, -8.169299911e-01,
-     -8.167825197e-01, -8.166589348e-01, -8.165350534e-01, -8.164108748e-01,
-     -8.162863978e-01, -8.161340337e-01, -8.159776881e-01, -8.158440286e-01,
-     -8.157183486e-01, -8.155923655e-01, -8.154660781e-01, -8.153245645e-01,
-     -8.151659411e-01, -8.150182423e-01, -8.148907281e-01, -8.147629048e-01,
-     -8.146347713e-01, -8.145013164e-01, -8.143403701e-01, -8.141813606e-01,
-     -8.140519760e-01, -8.139222760e-01, -8.137597949e-01, -8.135968777e-01,
-     -8.134641351e-01, -8.133331634e-01, -8.132018711e-01, -8.130702572e-01,
-     -8.129105717e-01, -8.127452463e-01, -8.126063365e-01, -8.124734255e-01,
-     -8.123139673e-01, -8.121470098e-01, -8.120055877e-01, -8.118713623e-01,
-     -8.117108020e-01, -8.115421906e-01, -8.113995552e-01, -8.112639980e-01,
-     -8.111009883e-01, -8.109307010e-01, -8.107881688e-01, -8.106512620e-01,
-     -8.104844376e-01, -8.103124520e-01, -8.101713569e-01, -8.100330824e-01,
-     -8.098610598e-01, -8.096873533e-01, -8.095132129e-01, -8.093422477e-01,
-     -8.092022378e-01, -8.090553129e-01, -8.088794227e-01, -8.087129613e-01,
-     -8.085715421e-01, -8.084162378e-01, -8.082385740e-01, -8.080604632e-01,
-     -8.078819038e-01, -8.077248155e-01, -8.075812466e-01, -8.074106577e-01,
-     -8.072302889e-01, -8.070494638e-01, -8.068690566e-01, -8.067236630e-01,
-     -8.065713750e-01, -8.063887098e-01, -8.062055807e-01, -8.060219862e-01,
-     -8.058379246e-01, -8.056533943e-01, -8.054940999e-01, -8.053457221e-01,
-     -8.051641146e-01, -8.049776939e-01, -8.047907966e-01, -8.046034211e-01,
-     -8.044155656e-01, -8.042272287e-01, -8.040384087e-01, -8.038764022e-01,
-     -8.037245692e-01, -8.035361720e-01, -8.033454029e-01, -8.031541425e-01,
-     -8.029623889e-01, -8.027701406e-01, -8.025773958e-01, -8.023841529e-01,
-     -8.021904101e-01, -8.019961657e-01, -8.018014180e-01, -8.016061654e-01,
-     -8.014104060e-01, -8.012141381e-01, -8.010173600e-01, -8.008200699e-01,
-     -8.006222661e-01, -8.004239468e-01, -8.002251102e-01, -8.000257545e-01,
-     -7.998258781e-01, -7.996254789e-01, -7.994245554e-01, -7.992231055e-01,
-     -7.990211277e-01, -7.988186199e-01, -7.986155804e-01, -7.984120073e-01,
-     -7.982078988e-01, -7.980032531e-01, -7.977980682e-01, -7.975923423e-01,
-     -7.973860736e-01, -7.971792601e-01, -7.969656451e-01, -7.967161547e-01,
-     -7.964883933e-01, -7.962793818e-01, -7.960698159e-01, -7.958596938e-01,
-     -7.956490135e-01, -7.954066753e-01, -7.951588319e-01, -7.949464653e-01,
-     -7.947335327e-01, -7.945200321e-01, -7.943059616e-01, -7.940729128e-01,
-     -7.938146530e-01, -7.935931711e-01, -7.933631958e-01, -7.931028549e-01,
-     -7.928751783e-01, -7.926570614e-01, -7.924383582e-01, -7.921887590e-01,
-     -7.919320462e-01, -7.917115720e-01, -7.914621878e-01, -7.912016991e-01,
-     -7.909794349e-01, -7.907291729e-01, -7.904659632e-01, -7.902418900e-01,
-     -7.899896456e-01, -7.897247810e-01, -7.894988796e-01, -7.892435365e-01,
-     -7.889780945e-01, -7.887503452e-01, -7.884907750e-01, -7.882258447e-01,
-     -7.879962277e-01, -7.877312899e-01, -7.874542420e-01, -7.871764363e-01,
-     -7.868978702e-01, -7.866372768e-01, -7.864038640e-01, -7.861247200e-01,
-     -7.858430845e-01, -7.855654956e-01, -7.853295066e-01, -7.850606601e-01,
-     -7.847759109e-01, -7.844903763e-01, -7.842040534e-01, -7.839169394e-01,
-     -7.836290314e-01, -7.833403267e-01, -7.830508222e-01, -7.827605151e-01,
-     -7.824694025e-01, -7.822202483e-01, -7.819518879e-01, -7.816583412e-01,
-     -7.813639773e-01, -7.810314713e-01, -7.807056472e-01, -7.804088137e-01,
-     -7.801111510e-01, -7.798126560e-01, -7.795133258e-01, -7.792131573e-01,
-     -7.789121473e-01, -7.786102930e-01, -7.783075911e-01, -7.780040385e-01,
-     -7.776490826e-01, -7.773272303e-01, -7.770211070e-01, -7.767141206e-01,
-     -7.764062678e-01, -7.760597258e-01, -7.757208116e-01, -7.754103404e-01,
-     -7.750989901e-01, -7.747430788e-01, -7.744065001e-01, -7.740785705e-01,
-     -7.737111875e-01, -7.733946589e-01, -7.730404216e-01, -7.726932294e-01,
-     -7.723654453e-01, -7.719927991e-01, -7.716678543e-01, -7.713114483e-01,
-     -7.709573184e-01, -7.706258081e-01, -7.702478002e-01, -7.698687080e-01,
-     -7.695251481e-01, -7.691743927e-01, -7.687920230e-01, -7.684085525e-01,
-     -7.680239772e-01, -7.676802695e-01, -7.673186342e-01, -7.669307195e-01,
-     -7.665416833e-01, -7.661515213e-01, -7.657602294e-01, -7.653678032e-01,
-     -7.649742384e-01, -7.645795309e-01, -7.641836761e-01, -7.637866699e-01,
-     -7.633885078e-01, -7.629448462e-01, -7.625215598e-01, -7.621199038e-01,
-     -7.617170742e-01, -7.613130666e-01, -7.609078765e-01, -7.604470611e-01,
-     -7.600267923e-01, -7.596180277e-01, -7.591798546e-01, -7.587297533e-01,
-     -7.583057924e-01, -7.578366395e-01, -7.574218256e-01, -7.569507065e-01,
-     -7.565213829e-01, -7.560626842e-01, -7.556160071e-01, -7.551690024e-01,
-     -7.546864562e-01, -7.542024788e-01, -7.537170644e-01, -7.532302077e-01,
-     -7.528027601e-01, -7.523192834e-01, -7.518280659e-01, -7.513353835e-01,
-     -7.508412305e-01, -7.503456012e-01, -7.498484898e-01, -7.493266103e-01,
-     -7.487826590e-01, -7.482810667e-01, -7.477779689e-01, -7.472733600e-01,
-     -7.467652072e-01, -7.461941019e-01, -7.456832677e-01, -7.451138624e-01,
-     -7.445931611e-01, -7.440266878e-01, -7.434968657e-01, -7.429325234e-01,
-     -7.423943327e-01, -7.418313138e-01, -7.412444804e-01, -7.406558646e-01,
-     -7.401032167e-01, -7.395403968e-01, -7.389463918e-01, -7.383505760e-01,
-     -7.377529424e-01, -7.371534835e-01, -7.365521922e-01, -7.359164372e-01,
-     -7.352769442e-01, -7.346701115e-01, -7.340279306e-01, -7.333837140e-01,
-     -7.327712731e-01, -7.321207296e-01, -7.314735915e-01, -7.308163854e-01,
-     -7.301274694e-01, -7.294364257e-01, -7.287882326e-01, -7.281150592e-01,
-     -7.274175804e-01, -7.267179392e-01, -7.260161269e-01, -7.253121346e-01,
-     -7.245433554e-01, -7.238304359e-01, -7.231198503e-01, -7.223998291e-01,
-     -7.216248844e-01, -7.208914534e-01, -7.201000003e-01, -7.193320895e-01,
-     -7.185767906e-01, -7.177778750e-01, -7.169764513e-01, -7.161725094e-01,
-     -7.153660388e-01, -7.145570291e-01, -7.137449470e-01, -7.128642118e-01,
-     -7.120330208e-01, -7.111611116e-01, -7.103098306e-01, -7.094476434e-01,
-     -7.085752828e-01, -7.076701508e-01, -7.067621439e-01, -7.058512500e-01,
-     -7.049247176e-01, -7.039536145e-01, -7.030339872e-01, -7.021114243e-01,
-     -7.011346950e-01, -7.001288515e-01, -6.991197876e-01, -6.981074898e-01,
-     -6.970919444e-01, -6.960731378e-01, -6.950510562e-01, -6.939647296e-01,
-     -6.929240663e-01, -6.918126924e-01, -6.906977314e-01, -6.896224810e-01,
-     -6.885241260e-01, -6.873958444e-01, -6.861857061e-01, -6.850014461e-01,
-     -6.838207742e-01, -6.825988082e-01, -6.813728658e-01, -6.801634307e-01,
-     -6.789404973e-01, -6.776199915e-01, -6.762951709e-01, -6.749660168e-01,
-     -6.736325107e-01, -6.722946336e-01, -6.710172793e-01, -6.695760863e-01,
-     -6.680882024e-01, -6.666479296e-01, -6.652029113e-01, -6.637345691e-01,
-     -6.622314162e-01, -6.607163474e-01, -6.590913286e-01, -6.574762575e-01,
-     -6.558692444e-01, -6.542164425e-01, -6.526252869e-01, -6.509218125e-01,
-     -6.491646005e-01, -6.473343917e-01, -6.455298669e-01, -6.437234352e-01,
-     -6.418635584e-01, -6.399874579e-01, -6.380484328e-01, -6.359903535e-01,
-     -6.339502225e-01, -6.318994524e-01, -6.298253080e-01, -6.277805089e-01,
-     -6.255494421e-01, -6.231880202e-01, -6.208859795e-01, -6.185718779e-01,
-     -6.161913475e-01, -6.138658244e-01, -6.112866531e-01, -6.086230422e-01,
-     -6.059649646e-01, -6.032586056e-01, -6.006093891e-01, -5.978351442e-01,
-     -5.948375985e-01, -5.917787601e-01, -5.886749459e-01, -5.855624502e-01,
-     -5.824720214e-01, -5.792039620e-01, -5.756289648e-01, -5.720186264e-01,
-     -5.683958312e-01, -5.647605217e-01, -5.610963737e-01, -5.570782874e-01,
-     -5.528045083e-01, -5.484586279e-01, -5.441600777e-01, -5.398465758e-01,
-     -5.354296542e-01, -5.302779255e-01, -5.251118372e-01, -5.199875762e-01,
-     -5.147816485e-01, -5.095574851e-01, -5.036797201e-01, -4.973872812e-01,
-     -4.911398612e-01, -4.848548947e-01, -4.785328922e-01, -4.717225911e-01,
-     -4.641573244e-01, -4.565345045e-01, -4.489219944e-01, -4.412153602e-01,
-     -4.331930849e-01, -4.241409016e-01, -4.149620747e-01, -4.057737873e-01,
-     -3.965524909e-01, -3.870236272e-01, -3.764596299e-01, -3.656520357e-01,
-     -3.548057075e-01, -3.439397597e-01, -3.329382194e-01, -3.207980391e-01,
-     -3.085723229e-01, -2.963025178e-01, -2.839884095e-01, -2.715018631e-01,
-     -2.581964373e-01, -2.448427879e-01, -2.314406791e-01, -2.179898734e-01,
-     -2.043030259e-01, -1.902675027e-01, -1.760929666e-01, -1.619234702e-01,
-     -1.476554798e-01, -1.332160513e-01, -1.185990395e-01, -1.039283711e-01,
-     -8.920377957e-02, -7.442499652e-02, -5.951902303e-02, -4.456949653e-02,
-     -2.955937273e-02, -1.446543567e-02,  6.269998803e-04,  1.573666648e-02,
-      3.090245313e-02,  4.612464271e-02,  6.140352002e-02,  7.656642461e-02,
-      9.172145201e-02,  1.069838459e-01,  1.222442242e-01,  1.374276654e-01,
-      1.524277539e-01,  1.674575962e-01,  1.825302395e-01,  1.976019004e-01,
-      2.122380051e-01,  2.267586833e-01,  2.413343176e-01,  2.559651915e-01,
-      2.700191566e-01,  2.836596887e-01,  2.973523860e-01,  3.110654348e-01,
-      3.243506365e-01,  3.366929830e-01,  3.490825607e-01,  3.615196165e-01,
-      3.737281613e-01,  3.844614791e-01,  3.952358436e-01,  4.060514710e-01,
-      4.166803367e-01,  4.257798396e-01,  4.347723328e-01,  4.438231703e-01,
-      4.526908965e-01,  4.600437932e-01,  4.672220769e-01,  4.744283423e-01,
-      4.813203572e-01,  4.864949058e-01,  4.914695247e-01,  4.964633851e-01,
-      5.010599883e-01,  5.022030681e-01,  5.034015471e-01,  5.046126245e-01,
-      5.042566986e-01,  4.996887986e-01,  4.950815660e-01,  4.904329245e-01,
-      4.844355398e-01,  4.769005912e-01,  4.693358805e-01,  4.616930963e-01,
-      4.530931011e-01,  4.440845815e-01,  4.350396722e-01,  4.257972733e-01,
-      4.154583206e-01,  4.050094772e-01,  3.944746196e-01,  3.833792894e-01,
-      3.715038495e-01,  3.595257648e-01,  3.475268050e-01,  3.345121314e-01,
-      3.212037430e-01,  3.078408032e-01,  2.941626331e-01,  2.797600674e-01,
-      2.652830811e-01,  2.507464008e-01,  2.356223330e-01,  2.202579180e-01,
-      2.048301396e-01,  1.891513632e-01,  1.731502936e-01,  1.571092435e-01,
-      1.409566756e-01,  1.245430102e-01,  1.079707205e-01,  9.139616494e-02,
-      7.461752374e-02,  5.776866721e-02,  4.081689878e-02,  2.379152544e-02,
-      6.662410103e-03, -1.053858087e-02, -2.774473210e-02, -4.502360894e-02,
-     -6.237564145e-02, -7.973412446e-02, -9.704415348e-02, -1.144442667e-01,
-     -1.319172955e-01, -1.491810971e-01, -1.665197096e-01, -1.838651823e-01,
-     -2.009746507e-01, -2.180010427e-01, -2.350917902e-01, -2.517892845e-01,
-     -2.682456251e-01, -2.847732085e-01, -3.007676039e-01, -3.163397663e-01,
-     -3.319889307e-01, -3.470009795e-01, -3.613673581e-01, -3.758178355e-01,
-     -3.894313827e-01, -4.024598764e-01, -4.155491115e-01, -4.275805003e-01,
-     -4.391481964e-01, -4.507664584e-01, -4.611942342e-01, -4.714226209e-01,
-     -4.816413244e-01, -4.906136111e-01, -4.995483706e-01, -5.083294115e-01,
-     -5.161975268e-01, -5.240637961e-01, -5.315959253e-01, -5.385344345e-01,
-     -5.454740899e-01, -5.519485586e-01, -5.581012417e-01, -5.642815458e-01,
-     -5.698841656e-01, -5.753690758e-01, -5.807157085e-01, -5.856354255e-01,
-     -5.905649652e-01, -5.952297484e-01, -5.995807193e-01, -6.039642575e-01,
-     -6.078930409e-01, -6.117829790e-01, -6.154006503e-01, -6.186400422e-01,
-     -6.219169818e-01, -6.243672715e-01, -6.266345668e-01, -6.279983539e-01,
-     -6.274904632e-01, -6.270002921e-01, -6.226824919e-01, -6.174747455e-01,
-     -6.117159004e-01, -6.048799875e-01, -5.979831000e-01, -5.901641657e-01,
-     -5.822211418e-01, -5.735496776e-01, -5.641731566e-01, -5.545211163e-01,
-     -5.433928009e-01, -5.322065124e-01, -5.192044499e-01, -5.057139554e-01,
-     -4.908042754e-01, -4.743147968e-01, -4.571229541e-01, -4.370268507e-01,
-     -4.167148453e-01, -3.931093165e-01, -3.688664938e-01, -3.421732156e-01,
-     -3.141158323e-01, -2.847489177e-01, -2.536973370e-01, -2.220665016e-01,
-     -1.889564547e-01, -1.555800210e-01, -1.213242465e-01, -8.685672603e-02,
-     -5.183668501e-02, -1.666517200e-02,  1.868361461e-02,  5.414382810e-02,
-      8.953397305e-02,  1.249570820e-01,  1.599964307e-01,  1.947840481e-01,
-      2.288802660e-01,  2.623422482e-01,  2.946273114e-01,  3.255781921e-01,
-      3.549916337e-01,  3.824820416e-01,  4.082234716e-01,  4.316935233e-01,
-      4.533095582e-01,  4.728606755e-01,  4.906425220e-01,  5.067158849e-01,
-      5.210111073e-01,  5.339753204e-01,  5.448022418e-01,  5.544274597e-01,
-      5.584685118e-01,  5.605622137e-01,  5.519649684e-01,  5.413629500e-01,
-      5.280651968e-01,  5.141502331e-01,  4.982160409e-01,  4.811974220e-01,
-      4.621541072e-01,  4.412120897e-01,  4.185457115e-01,  3.931167232e-01,
-      3.664233780e-01,  3.364691757e-01,  3.055601231e-01,  2.721616612e-01,
-      2.377229337e-01,  2.019713012e-01,  1.651505594e-01,  1.276895855e-01,
-      8.950506743e-02,  5.099269105e-02,  1.206254184e-02, -2.707145084e-02,
-     -6.631734634e-02, -1.055215370e-01, -1.446993334e-01, -1.835209249e-01,
-     -2.216101440e-01, -2.592719612e-01, -2.952091706e-01, -3.297066193e-01,
-     -3.628324654e-01, -3.926787832e-01, -4.208475556e-01, -4.465628739e-01,
-     -4.692594308e-01, -4.904610799e-01, -5.092288937e-01, -5.260465774e-01,
-     -5.417076653e-01, -5.556160008e-01, -5.682175792e-01, -5.799512322e-01,
-     -5.904499713e-01, -5.998332491e-01, -6.082771835e-01, -6.149934423e-01,
-     -6.128644005e-01, -6.062344895e-01, -5.954213994e-01, -5.831088277e-01,
-     -5.696842977e-01, -5.550153416e-01, -5.382626423e-01, -5.192101223e-01,
-     -4.978716957e-01, -4.740481479e-01, -4.455945979e-01, -4.135863407e-01,
-     -3.779761969e-01, -3.383286738e-01, -2.942395483e-01, -2.473309563e-01,
-     -1.982670242e-01, -1.473699292e-01, -9.503612609e-02, -4.191635426e-02,
-      1.169040579e-02,  6.556624748e-02,  1.194911610e-01,  1.728675945e-01,
-      2.252565586e-01,  2.759562532e-01,  3.242534737e-01,  3.692692796e-01,
-      4.093092911e-01,  4.447306036e-01,  4.759107828e-01,  5.031961145e-01,
-      5.269959597e-01,  5.478147411e-01,  5.658544582e-01,  5.816465879e-01,
-      5.947954816e-01,  5.940417154e-01,  5.809315402e-01,  5.647958462e-01,
-      5.461374917e-01,  5.248193699e-01,  5.000336674e-01,  4.711684823e-01,
-      4.374751373e-01,  3.983334630e-01,  3.534903566e-01,  3.032419651e-01,
-      2.485508826e-01,  1.902596944e-01,  1.298385802e-01,  6.763823143e-02,
-      4.766845703e-03, -5.843010954e-02, -1.203677791e-01, -1.811078897e-01,
-     -2.393462251e-01, -2.944894778e-01, -3.451117489e-01, -3.905345840e-01,
-     -4.302707288e-01, -4.645489024e-01, -4.940017162e-01, -5.192033359e-01,
-     -5.409884063e-01, -5.598734888e-01, -5.764982109e-01, -5.909733692e-01,
-     -5.948560496e-01, -5.865611621e-01, -5.718793082e-01, -5.552405607e-01,
-     -5.364485932e-01, -5.149980409e-01, -4.901381290e-01, -4.618992472e-01,
-     -4.299953818e-01, -3.941424865e-01, -3.540433456e-01, -3.094774792e-01,
-     -2.625054822e-01, -2.135437573e-01, -1.631899831e-01, -1.119898251e-01,
-     -6.055278277e-02, -9.225035736e-03,  4.178118740e-02,  9.235149431e-02,
-      1.418668884e-01,  1.904108536e-01,  2.377385028e-01,  2.822324748e-01,
-      3.242810100e-01,  3.637179501e-01,  3.990482164e-01,  4.303219376e-01,
-      4.587339504e-01,  4.837248784e-01,  5.051305646e-01,  5.244711334e-01,
-      5.418954264e-01,  5.568256822e-01,  5.705964720e-01,  5.831873391e-01,
-      5.942663514e-01,  6.045855627e-01,  6.138985578e-01,  6.141910357e-01,
-      6.112865888e-01,  6.040521284e-01,  5.957247300e-01,  5.868289882e-01,
-      5.766599936e-01,  5.657696636e-01,  5.542582241e-01,  5.410362405e-01,
-      5.271954158e-01,  5.118204624e-01,  4.949505701e-01,  4.769183160e-01,
-      4.562966690e-01,  4.347816898e-01,  4.102802256e-01,  3.843900239e-01,
-      3.566782702e-01,  3.267343219e-01,  2.959366865e-01,  2.632140585e-01,
-      2.302177991e-01,  1.957706689e-01,  1.613027485e-01,  1.265065333e-01,
-      9.151827902e-02,  5.641184893e-02,  2.154507742e-02, -1.313832659e-02,
-     -4.774229658e-02, -8.219189298e-02, -1.158772683e-01, -1.493528314e-01,
-     -1.821006001e-01, -2.145700329e-01, -2.454620264e-01, -2.759943386e-01,
-     -3.047094546e-01, -3.328940700e-01, -3.584468087e-01, -3.835084498e-01,
-     -4.057325148e-01, -4.275604213e-01, -4.463697439e-01, -4.648074574e-01,
-     -4.806656995e-01, -4.962736860e-01, -5.096459000e-01, -5.226920231e-01,
-     -5.341958836e-01, -5.451747614e-01, -5.530448163e-01, -5.591295028e-01,
-     -5.600327757e-01, -5.550211130e-01, -5.488445415e-01, -5.394323437e-01,
-     -5.299425822e-01, -5.180005294e-01, -5.060835331e-01, -4.919617783e-01,
-     -4.772806742e-01, -4.610796806e-01, -4.434178938e-01, -4.251444511e-01,
-     -4.039695084e-01, -3.828604018e-01, -3.591421124e-01, -3.349474445e-01,
-     -3.094490699e-01, -2.824521875e-01, -2.554445310e-01, -2.269486061e-01,
-     -1.985284892e-01, -1.694469411e-01, -1.399641858e-01, -1.105981990e-01,
-     -8.096796820e-02, -5.151979237e-02, -2.193903502e-02,  7.596210986e-03,
-      3.696304515e-02,  6.600677284e-02,  9.489151706e-02,  1.234815687e-01,
-      1.517394568e-01,  1.799002016e-01,  2.069534065e-01,  2.337832792e-01,
-      2.600296173e-01,  2.850156596e-01,  3.098350150e-01,  3.330419594e-01,
-      3.550461706e-01,  3.768392133e-01,  3.960994977e-01,  4.148130904e-01,
-      4.330731301e-01,  4.485258600e-01,  4.638169360e-01,  4.783035534e-01,
-      4.909148607e-01,  5.033992846e-01,  5.148643757e-01,  5.251025306e-01,
-      5.352745120e-01,  5.444893236e-01,  5.529662118e-01,  5.614587793e-01,
-      5.690110722e-01,  5.761265291e-01,  5.832071876e-01,  5.896133427e-01,
-      5.956521380e-01,  6.016746176e-01,  6.071525488e-01,  6.123086901e-01,
-      6.174145988e-01,  6.212540922e-01,  6.242713771e-01,  6.272741271e-01,
-      6.284420955e-01,  6.278094678e-01,  6.271130450e-01,  6.259359137e-01,
-      6.237785265e-01,  6.216641886e-01,  6.194812618e-01,  6.167179480e-01,
-      6.139433003e-01,  6.111813477e-01,  6.080512873e-01,  6.048419148e-01,
-      6.016863881e-01,  5.982985926e-01,  5.946894237e-01,  5.910861340e-01,
-      5.874111504e-01,  5.834106226e-01,  5.794392343e-01,  5.754862830e-01,
-      5.710789993e-01,  5.666012343e-01,  5.621597948e-01,  5.575676475e-01,
-      5.525603276e-01,  5.476071290e-01,  5.426890743e-01,  5.371486597e-01,
-      5.315600537e-01,  5.259894644e-01,  5.202041457e-01,  5.138723909e-01,
-      5.076056181e-01,  5.013468581e-01,  4.944268812e-01,  4.872415499e-01,
-      4.800875853e-01,  4.728713209e-01,  4.648472764e-01,  4.567504693e-01,
-      4.486332484e-01,  4.403451927e-01,  4.310920615e-01,  4.219156392e-01,
-      4.127175703e-01,  4.031194333e-01,  3.928414377e-01,  3.826741822e-01,
-      3.724830923e-01,  3.616697075e-01,  3.504026428e-01,  3.391933498e-01,
-      3.280098649e-01,  3.163277496e-01,  3.043201031e-01,  2.923623544e-01,
-      2.804541684e-01,  2.680701589e-01,  2.555127568e-01,  2.429405140e-01,
-      2.304862419e-01,  2.178134120e-01,  2.049269600e-01,  1.921594285e-01,
-      1.794439439e-01,  1.665898904e-01,  1.535885908e-01,  1.406340314e-01,
-      1.277315409e-01,  1.148340501e-01,  1.019053895e-01,  8.902829794e-02,
-      7.620243906e-02,  6.340379520e-02,  5.053550932e-02,  3.768412916e-02,
-      2.493257130e-02,  1.216612313e-02, -4.845009750e-04, -1.308568026e-02,
-     -2.570487127e-02, -3.820811196e-02, -5.066285370e-02, -6.306940665e-02,
-     -7.549521713e-02, -8.780631293e-02, -1.000701354e-01, -1.122049137e-01,
-     -1.242534391e-01, -1.361912088e-01, -1.481493348e-01, -1.600137077e-01,
-     -1.716440791e-01, -1.832305718e-01, -1.948405999e-01, -2.063401592e-01,
-     -2.176356999e-01, -2.286417885e-01, -2.396159830e-01, -2.505709440e-01,
-     -2.614408244e-01, -2.719628702e-01, -2.822519966e-01, -2.925032664e-01,
-     -3.026610904e-01, -3.127914148e-01, -3.223370553e-01, -3.316534920e-01,
-     -3.409360766e-01, -3.501850161e-01, -3.594005162e-01, -3.678483127e-01,
-     -3.761156901e-01, -3.843533995e-01, -3.925885005e-01, -4.007960910e-01,
-     -4.080988658e-01, -4.152623702e-01, -4.224333258e-01, -4.295603169e-01,
-     -4.366469524e-01, -4.430281618e-01, -4.491983047e-01, -4.552922304e-01,
-     -4.614067857e-01, -4.675125191e-01, -4.728791881e-01, -4.778597960e-01,
-     -4.827562775e-01, -4.876358719e-01, -4.924986788e-01, -4.964730069e-01,
-     -4.984253696e-01, -5.003039264e-01, -5.022429938e-01, -5.041526291e-01,
-     -5.059771922e-01, -5.043394045e-01, -5.023257822e-01, -5.003189353e-01,
-     -4.983188244e-01, -4.963254104e-01, -4.933688094e-01, -4.892635562e-01,
-     -4.851692389e-01, -4.810555034e-01, -4.769384397e-01, -4.728167645e-01,
-     -4.675591104e-01, -4.620266529e-01, -4.565123144e-01, -4.510159914e-01,
-     -4.455375811e-01, -4.397712998e-01, -4.331210932e-01, -4.263632865e-01,
-     -4.196272891e-01, -4.129129778e-01, -4.062202298e-01, -3.990698697e-01,
-     -3.911086197e-01, -3.831721066e-01, -3.751949830e-01, -3.673094508e-01,
-     -3.594384712e-01, -3.510851143e-01, -3.420793998e-01, -3.331019802e-01,
-     -3.241526980e-01, -3.152313969e-01, -3.063379218e-01, -2.970179870e-01,
-     -2.872765146e-01, -2.775007078e-01, -2.677741287e-01, -2.580362646e-01,
-     -2.483921622e-01, -2.384860291e-01, -2.282598429e-01, -2.180212506e-01,
-     -2.078138285e-01, -1.976374067e-01, -1.874246779e-01, -1.772390804e-01,
-     -1.668153873e-01, -1.563203976e-01, -1.458047934e-01, -1.353800993e-01,
-     -1.249865354e-01, -1.146079937e-01, -1.041224247e-01, -9.361803352e-02,
-     -8.310763615e-02, -7.261333915e-02, -6.214993171e-02, -5.171724915e-02,
-     -4.131099675e-02, -3.085563149e-02, -2.039385187e-02, -9.969045156e-03,
-      3.969106622e-04,  1.079690176e-02,  2.113384955e-02,  3.144347914e-02,
-      4.175109739e-02,  5.198166036e-02,  6.222583193e-02,  7.242171741e-02,
-      8.257942810e-02,  9.274518634e-02,  1.028059189e-01,  1.127937512e-01,
-      1.227701295e-01,  1.327276545e-01,  1.426225537e-01,  1.525407760e-01,
-      1.623435837e-01,  1.720281529e-01,  1.815952834e-01,  1.911571522e-01,
-      2.006484742e-01,  2.101693198e-01,  2.196185196e-01,  2.290338128e-01,
-      2.381201357e-01,  2.470594192e-01,  2.559989486e-01,  2.649141474e-01,
-      2.738051386e-01,  2.826720445e-01,  2.914490247e-01,  2.998229878e-01,
-      3.078854107e-01,  3.159600267e-01,  3.240293935e-01,  3.320104087e-01,
-      3.400369431e-01,  3.480183370e-01,  3.556149076e-01,  3.626820130e-01,
-      3.697045661e-01,  3.766845967e-01,  3.836840650e-01,  3.906140278e-01,
-      3.975851057e-01,  4.043719545e-01,  4.105146388e-01,  4.164174251e-01,
-      4.223049116e-01,  4.281436002e-01,  4.339671453e-01,  4.398091792e-01,
-      4.456362093e-01,  4.510762929e-01,  4.560270737e-01,  4.608814797e-01,
-      4.657235322e-01,  4.705559341e-01,  4.754379530e-01,  4.802433007e-01,
-      4.849836151e-01,  4.893687291e-01,  4.933664145e-01,  4.973540874e-01,
-      5.013317956e-01,  5.052995865e-01,  5.092575071e-01,  5.131738438e-01,
-      5.170430705e-01,  5.206187454e-01,  5.239188753e-01,  5.272108878e-01,
-      5.304948210e-01,  5.337707129e-01,  5.370386012e-01,  5.402985231e-01,
-      5.435505159e-01,  5.464885748e-01,  5.492528675e-01,  5.520104814e-01,
-      5.547173659e-01,  5.574386579e-01,  5.601764204e-01,  5.629076267e-01,
-      5.656323070e-01,  5.681431619e-01,  5.704837159e-01,  5.728324128e-01,
-      5.751641578e-01,  5.774626299e-01,  5.797905891e-01,  5.821104776e-01,
-      5.843927636e-01,  5.866114706e-01,  5.886726382e-01,  5.906396913e-01,
-      5.926423304e-01,  5.946403188e-01,  5.966336773e-01,  5.986089795e-01,
-      6.005394487e-01,  6.025049759e-01,  6.043489933e-01,  6.061287838e-01,
-      6.078411150e-01,  6.095495377e-01,  6.112540692e-01,  6.130061549e-01,
-      6.147186657e-01,  6.164116261e-01,  6.180626436e-01,  6.196521540e-01,
-      6.211805951e-01,  6.226719440e-01,  6.241783572e-01,  6.257117765e-01,
-      6.271931504e-01,  6.286712281e-01,  6.301460238e-01,  6.316753367e-01,
-      6.330493157e-01,  6.343465350e-01,  6.356651161e-01,  6.370021627e-01,
-      6.383362773e-01,  6.396674726e-01,  6.409957609e-01,  6.423211545e-01,
-      6.436436658e-01,  6.448446832e-01,  6.460417587e-01,  6.472362468e-01,
-      6.484281584e-01,  6.495881062e-01,  6.507371568e-01,  6.519214036e-01,
-      6.531031168e-01,  6.542823069e-01,  6.554027100e-01,  6.564703319e-01,
-      6.575248470e-01,  6.585771286e-01,  6.596271860e-01,  6.606879123e-01,
-      6.617878032e-01,  6.628312424e-01,  6.638724937e-01,  6.649115659e-01,
-      6.658813312e-01,  6.668250158e-01,  6.678002376e-01,  6.687691839e-01,
-      6.696832359e-01,  6.706466479e-01,  6.716138191e-01,  6.725789978e-01,
-      6.735220315e-01,  6.744171428e-01,  6.752635388e-01,  6.761633674e-01,
-      6.770182857e-01,  6.778926750e-01,  6.787661665e-01,  6.796146876e-01,
-      6.805065455e-01,  6.813416622e-01,  6.822177228e-01,  6.830410301e-01,
-      6.838151346e-01,  6.845954669e-01,  6.854215441e-01,  6.861952952e-01,
-      6.870016143e-01,  6.877967656e-01,  6.885616443e-01,  6.893258819e-01,
-      6.901421504e-01,  6.908718751e-01,  6.916060475e-01,  6.923469112e-01,
-      6.930521238e-01,  6.938065045e-01,  6.945155443e-01,  6.952437018e-01,
-      6.959768388e-01,  6.966750354e-01,  6.974220863e-01,  6.980824182e-01,
-      6.987489175e-01,  6.994385847e-01,  7.001265478e-01,  7.007607109e-01,
-      7.014324812e-01,  7.020925217e-01,  7.027327761e-01,  7.034145305e-01,
-      7.040949830e-01,  7.047416512e-01,  7.053673708e-01,  7.059919017e-01,
-      7.066152482e-01,  7.072374146e-01,  7.078347434e-01,  7.084110856e-01,
-      7.090297372e-01,  7.096472256e-01,  7.102635549e-01,  7.108787293e-01,
-      7.114927530e-01,  7.120581311e-01,  7.126188874e-01,  7.131786000e-01,
-      7.137372726e-01,  7.142949087e-01,  7.148843998e-01,  7.154742248e-01,
-      7.160287734e-01,  7.165823000e-01,  7.171348081e-01,  7.176863012e-01,
-      7.182367829e-01,  7.187374617e-01,  7.192675873e-01,  7.198150556e-01,
-      7.203615263e-01,  7.208607251e-01,  7.213843496e-01,  7.219169399e-01,
-      7.224101345e-01,  7.229447564e-01,  7.234609905e-01,  7.239515192e-01,
-      7.244411653e-01,  7.249299316e-01,  7.254178212e-01,  7.259048369e-01,
-      7.263909816e-01,  7.269064135e-01,  7.274278085e-01,  7.279113576e-01,
-      7.283940472e-01,  7.288538927e-01,  7.292897205e-01,  7.297698484e-01,
-      7.302491280e-01,  7.307151085e-01,  7.311449405e-01,  7.316147654e-01,
-      7.320694773e-01,  7.324986192e-01,  7.329728659e-01,  7.334170847e-01,
-      7.338517352e-01,  7.343235017e-01,  7.347579952e-01,  7.351811086e-01,
-      7.356034874e-01,  7.360251337e-01,  7.364460500e-01,  7.368683845e-01,
-      7.373344544e-01,  7.377715797e-01,  7.381895983e-01,  7.386068981e-01,
-      7.390234813e-01,  7.394393502e-01,  7.398545069e-01,  7.402318813e-01,
-      7.406155539e-01,  7.410285871e-01,  7.414409168e-01,  7.418334744e-01,
-      7.421987447e-01,  7.426065675e-01,  7.430161044e-01,  7.434249483e-01,
-      7.438331013e-01,  7.442172539e-01,  7.445788339e-01,  7.449398051e-01,
-      7.453245681e-01,  7.457270675e-01,  7.460862236e-01,  7.464447781e-01,
-      7.468051436e-01,  7.472071700e-01,  7.475839889e-01,  7.479401549e-01,
-      7.482957282e-01,  7.486507103e-01,  7.490051031e-01,  7.493589081e-01,
-      7.497121272e-01,  7.500647620e-01,  7.504168141e-01,  7.507682852e-01,
-      7.511191769e-01,  7.515097447e-01,  7.518863675e-01,  7.522355310e-01,
-      7.525841216e-01,  7.529188643e-01,  7.532228828e-01,  7.535593337e-01,
-      7.539056489e-01,  7.542513991e-01,  7.545682774e-01,  7.548740723e-01,
-      7.552181371e-01,  7.555616432e-01,  7.559045920e-01,  7.562054003e-01,
-      7.565216854e-01,  7.568629717e-01,  7.572037068e-01,  7.575332177e-01,
-      7.578304002e-01,  7.581554810e-01,  7.584904699e-01,  7.587862210e-01,
-      7.590814975e-01,  7.593763006e-01,  7.597085051e-01,  7.600316306e-01,
-      7.603250212e-01,  7.606472785e-01,  7.609775371e-01,  7.612695262e-01,
-      7.615610506e-01,  7.618521115e-01,  7.621427101e-01,  7.624328475e-01,
-      7.627225250e-01,  7.630117438e-01,  7.633005049e-01,  7.635888096e-01,
-      7.638919631e-01,  7.642204149e-01,  7.645181355e-01,  7.648046261e-01,
-      7.650906660e-01,  7.653762564e-01,  7.656613984e-01,  7.659460930e-01,
-      7.662240818e-01,  7.664673418e-01,  7.667303656e-01,  7.670132822e-01,
-      7.672957569e-01,  7.675777910e-01,  7.678593854e-01,  7.681405413e-01,
-      7.684212597e-01,  7.687015417e-01,  7.689753627e-01,  7.692148589e-01,
-      7.694726410e-01,  7.697511878e-01,  7.700293035e-01,  7.703034166e-01,
-      7.705410649e-01,  7.707939349e-01,  7.710703361e-01,  7.713463112e-01,
-      7.716218613e-01,  7.718580970e-01,  7.721045514e-01,  7.723788322e-01,
-      7.726305300e-01,  7.728649068e-01,  7.731320133e-01,  7.733997221e-01,
-      7.736330235e-01,  7.738814307e-01,  7.741527842e-01,  7.743979292e-01,
-      7.746298085e-01,  7.748613342e-01,  7.750997870e-01,  7.753690783e-01,
-      7.756209369e-01,  7.758510565e-01,  7.761073592e-01,  7.763750174e-01,
-      7.766064599e-01,  7.768351860e-01,  7.770635658e-01,  7.772915998e-01,
-      7.775192890e-01,  7.777466340e-01,  7.779736356e-01,  7.782331889e-01,
-      7.784937505e-01,  7.787197266e-01,  7.789453623e-01,  7.791706584e-01,
-      7.793956155e-01,  7.796202345e-01,  7.798445161e-01,  7.800684610e-01,
-      7.802920699e-01,  7.805153436e-01,  7.807382827e-01,  7.809608880e-01,
-      7.811831602e-01,  7.814051000e-01,  7.816267080e-01,  7.818479851e-01,
-      7.820689319e-01,  7.822895491e-01,  7.825098373e-01,  7.827297973e-01,
-      7.829494298e-01,  7.831687354e-01,  7.833877149e-01,  7.836063688e-01,
-      7.838246979e-01,  7.840427028e-01,  7.842603843e-01,  7.844777429e-01,
-      7.846648796e-01,  7.848454753e-01,  7.850607496e-01,  7.852768235e-01,
-      7.854925778e-01,  7.857080132e-01,  7.859231304e-01,  7.861379299e-01,
-      7.863524124e-01,  7.865492159e-01,  7.867274246e-01,  7.869268258e-01,
-      7.871400468e-01,  7.873529539e-01,  7.875655478e-01,  7.877488175e-01,
-      7.879254586e-01,  7.881343177e-01,  7.883451016e-01,  7.885209659e-01,
-      7.887002909e-01,  7.889107096e-01,  7.891208199e-01,  7.893306225e-01,
-      7.895307054e-01,  7.897050295e-01,  7.898910511e-01,  7.900996288e-01,
-      7.902936127e-01,  7.904669199e-01,  7.906563967e-01,  7.908637588e-01,
-      7.910524642e-01,  7.912247624e-01,  7.914168939e-01,  7.916230497e-01,
-      7.918072908e-01,  7.919785875e-01,  7.921725796e-01,  7.923775381e-01,
-      7.925581229e-01,  7.927284257e-01,  7.928984811e-01,  7.930682896e-01,
-      7.932635959e-01,  7.934667753e-01,  7.936433773e-01,  7.938122029e-01,
-      7.939807840e-01,  7.941491209e-01,  7.943439871e-01,  7.945454071e-01,
-      7.947198100e-01,  7.948871749e-01,  7.950542979e-01,  7.952211793e-01,
-      7.953878198e-01,  7.955542197e-01,  7.957458029e-01,  7.959449069e-01,
-      7.961191187e-01,  7.962845605e-01,  7.964497639e-01,  7.966147293e-01,
-      7.967794572e-01,  7.969439478e-01,  7.971082018e-01,  7.972722194e-01,
-      7.974554279e-01,  7.976516835e-01,  7.978299973e-01,  7.979930739e-01,
-      7.981559162e-01,  7.983185248e-01,  7.984809000e-01,  7.986430421e-01,
-      7.988049517e-01,  7.989666291e-01,  7.991280748e-01,  7.992892890e-01,
-      7.994502724e-01,  7.996110251e-01,  7.997715477e-01,  7.999318406e-01,
-      8.000919041e-01,  8.002517386e-01,  8.004113445e-01,  8.005707223e-01,
-      8.007298723e-01,  8.008887949e-01,  8.010474904e-01,  8.012059594e-01,
-      8.013642022e-01,  8.015222191e-01,  8.016800105e-01,  8.018375769e-01,
-      8.019949185e-01,  8.021520359e-01,  8.023089293e-01,  8.024655992e-01,
-      8.026220459e-01,  8.027782698e-01,  8.029342713e-01,  8.030900507e-01,
-      8.032456085e-01,  8.034009449e-01,  8.035345456e-01,  8.036584616e-01,
-      8.037984915e-01,  8.039529464e-01,  8.041071819e-01,  8.042611983e-01,
-      8.044149959e-01,  8.045685752e-01,  8.047219364e-01,  8.048750800e-01,
-      8.050280063e-01,  8.051565355e-01,  8.052785297e-01,  8.054183464e-01,
-      8.055704072e-01,  8.057222524e-01,  8.058738825e-01,  8.060252978e-01,
-      8.061764986e-01,  8.063274853e-01,  8.064496965e-01,  8.065701441e-01,
-      8.067120257e-01,  8.068621596e-01,  8.070120810e-01,  8.071617905e-01,
-      8.073041087e-01,  8.074235379e-01,  8.075427982e-01,  8.076913763e-01,
-      8.078400308e-01,  8.079884753e-01,  8.081367103e-01,  8.082708551e-01,
-      8.083891085e-01,  8.085130219e-01,  8.086604217e-01,  8.088076135e-01,
-      8.089545977e-01,  8.091013746e-01,  8.092294104e-01,  8.093465010e-01,
-      8.094733263e-01,  8.096192774e-01,  8.097639226e-01,  8.098803547e-01,
-      8.099966228e-01,  8.101338900e-01,  8.102788161e-01,  8.104235383e-01,
-      8.105680567e-01,  8.107097901e-01,  8.108250797e-01,  8.109402072e-01,
-      8.110769615e-01,  8.112204664e-01,  8.113517578e-01,  8.114662391e-01,
-      8.115826330e-01,  8.117253327e-01,  8.118678319e-01,  8.119896965e-01,
-      8.121033759e-01,  8.122168955e-01,  8.123302558e-01,  8.124434570e-01,
-      8.125843570e-01,  8.127254615e-01,  8.128492467e-01,  8.129618138e-01,
-      8.130804495e-01,  8.132207639e-01,  8.133608815e-01,  8.134776441e-01,
-      8.135894240e-01,  8.137129181e-01,  8.138522516e-01,  8.139909635e-01,
-      8.141021183e-01,  8.142131173e-01,  8.143239608e-01,  8.144346491e-01,
-      8.145498863e-01,  8.146878595e-01,  8.148256396e-01,  8.149429936e-01,
-      8.150529093e-01,  8.151626713e-01,  8.152722797e-01,  8.153817348e-01,
-      8.155140036e-01,  8.156504400e-01,  8.157763212e-01,  8.158851654e-01,
-      8.159938575e-01,  8.161023976e-01,  8.162107861e-01,  8.163307857e-01,
-      8.164658929e-01,  8.166008115e-01,  8.167099665e-01,  8.168176000e-01,
-      8.169250833e-01,  8.170324166e-01,  8.171396000e-01,  8.172720984e-01,
-      8.174057039e-01,  8.175273922e-01,  8.176339786e-01,  8.177404163e-01,
-      8.178467056e-01,  8.179528467e-01,  8.180588397e-01,  8.181646850e-01,
-      8.182703827e-01,  8.183759331e-01,  8.184813364e-01,  8.185945692e-01,
-      8.187259564e-01,  8.188571606e-01,  8.189686218e-01,  8.190732930e-01,
-      8.191778184e-01,  8.192821982e-01,  8.193864328e-01,  8.194905223e-01,
-      8.195944668e-01,  8.196982668e-01,  8.198019223e-01,  8.199054336e-01,
-      8.200088009e-01,  8.201120244e-01,  8.202151043e-01,  8.203392626e-01,
-      8.204677545e-01,  8.205906237e-01,  8.206931316e-01,  8.207954971e-01,
-      8.208977203e-01,  8.209998014e-01,  8.211017407e-01,  8.212035384e-01,
-      8.213051948e-01,  8.214067099e-01,  8.215080841e-01,  8.216093175e-01,
-      8.217104104e-01,  8.218113630e-01,  8.219121754e-01,  8.220128480e-01,
-      8.221133809e-01,  8.222137743e-01,  8.223140284e-01,  8.224141435e-01,
-      8.225141197e-01,  8.226139573e-01,  8.227136565e-01,  8.228132175e-01,
-      8.229126404e-01,  8.230119256e-01,  8.231110732e-01,  8.232100834e-01,
-      8.233089564e-01,  8.234076925e-01,  8.235062918e-01,  8.236047546e-01,
-      8.237030810e-01,  8.238012713e-01,  8.238993257e-01,  8.239972444e-01,
-      8.240950275e-01,  8.241926753e-01,  8.242901881e-01,  8.243875659e-01,
-      8.244848090e-01,  8.245819176e-01,  8.246788920e-01,  8.247757322e-01,
-      8.248724386e-01,  8.249690113e-01,  8.250654505e-01,  8.251617564e-01,
-      8.252579293e-01,  8.253539692e-01,  8.254498766e-01,  8.255456514e-01,
-      8.256412940e-01,  8.257368045e-01,  8.258321831e-01,  8.259274301e-01,
-      8.260225456e-01,  8.261175298e-01,  8.262123830e-01,  8.263071053e-01,
-      8.264016969e-01,  8.264961580e-01,  8.265904889e-01,  8.266846897e-01,
-      8.267787606e-01,  8.268727018e-01,  8.269665135e-01,  8.270601959e-01,
-      8.271537493e-01,  8.272471737e-01,  8.273260308e-01,  8.273959062e-01,
-      8.274656854e-01,  8.275524477e-01,  8.276452305e-01,  8.277378857e-01,
-      8.278304133e-01,  8.279228135e-01,  8.280150866e-01,  8.281072328e-01,
-      8.281992522e-01,  8.282911450e-01,  8.283829114e-01,  8.284745517e-01,
-      8.285641369e-01,  8.286326782e-01,  8.287011253e-01,  8.287727160e-01,
-      8.288637282e-01,  8.289546154e-01,  8.290453777e-01,  8.291360154e-01,
-      8.292265286e-01,  8.293169176e-01,  8.294071824e-01,  8.294973233e-01,
-      8.295873406e-01,  8.296772343e-01,  8.297670047e-01,  8.298509851e-01,
-      8.299181283e-01,  8.299851794e-01,  8.300577180e-01,  8.301468746e-01,
-      8.302359089e-01,  8.303248213e-01,  8.304136118e-01,  8.305022806e-01,
-      8.305908280e-01,  8.306792542e-01,  8.307675592e-01,  8.308520736e-01,
-      8.309181212e-01,  8.309840783e-01,  8.310524335e-01,  8.311401358e-01,
-      8.312277182e-01,  8.313151808e-01,  8.314025238e-01,  8.314897474e-01,
-      8.315768517e-01,  8.316638369e-01,  8.317507033e-01,  8.318374510e-01,
-      8.319050962e-01,  8.319699793e-01,  8.320347738e-01,  8.321161196e-01,
-      8.322022766e-01,  8.322883159e-01,  8.323742377e-01,  8.324600424e-01,
-      8.325457300e-01,  8.326201430e-01,  8.326842334e-01,  8.327482365e-01,
-      8.328201745e-01,  8.329052795e-01,  8.329902684e-01,  8.330751416e-01,
-      8.331598991e-01,  8.332445412e-01,  8.333280998e-01,  8.333914086e-01,
-      8.334546312e-01,  8.335177677e-01,  8.335988873e-01,  8.336828405e-01,
-      8.337666793e-01,  8.338504042e-01,  8.339340152e-01,  8.340175125e-01,
-      8.340916025e-01,  8.341540553e-01,  8.342164233e-01,  8.342832299e-01,
-      8.343661615e-01,  8.344489804e-01,  8.345316869e-01,  8.345941337e-01,
-      8.346559953e-01,  8.347177729e-01,  8.347942532e-01,  8.348764000e-01,
-      8.349584354e-01,  8.350403596e-01,  8.351221728e-01,  8.352038750e-01,
-      8.352821541e-01,  8.353432649e-01,  8.354042928e-01,  8.354652381e-01,
-      8.355435903e-01,  8.356246308e-01,  8.357055616e-01,  8.357753341e-01,
-      8.358358681e-01,  8.358963202e-01,  8.359610528e-01,  8.360414378e-01,
-      8.361217141e-01,  8.362018819e-01,  8.362644956e-01,  8.363244591e-01,
-      8.363843416e-01,  8.364543329e-01,  8.365339608e-01,  8.366134811e-01,
-      8.366902029e-01,  8.367496823e-01,  8.368090815e-01,  8.368684007e-01,
-      8.369423381e-01,  8.370212171e-01,  8.370999898e-01,  8.371720172e-01,
-      8.372309376e-01,  8.372897787e-01,  8.373485406e-01,  8.374251259e-01,
-      8.375032643e-01,  8.375812975e-01,  8.376499369e-01,  8.377083045e-01,
-      8.377665936e-01,  8.378252436e-01,  8.379027536e-01,  8.379801594e-01,
-      8.380574612e-01,  8.381240046e-01,  8.381818254e-01,  8.382395685e-01,
-      8.382984931e-01,  8.383752774e-01,  8.384519587e-01,  8.385285372e-01,
-      8.385942626e-01,  8.386515426e-01,  8.387087457e-01,  8.387666870e-01,
-      8.388427537e-01,  8.389187184e-01,  8.389945814e-01,  8.390607528e-01,
-      8.391174978e-01,  8.391741670e-01,  8.392307603e-01,  8.393052378e-01,
-      8.393804938e-01,  8.394556493e-01,  8.395235166e-01,  8.395797327e-01,
-      8.396358737e-01,  8.396919397e-01,  8.397479309e-01,  8.398038473e-01,
-      8.398596891e-01,  8.399190136e-01,  8.399932709e-01,  8.400674291e-01,
-      8.401414885e-01,  8.402049219e-01,  8.402603185e-01,  8.403156414e-01,
-      8.403708906e-01,  8.404431696e-01,  8.405166392e-01,  8.405900111e-01,
-      8.406582916e-01,  8.407131742e-01,  8.407679838e-01,  8.408227206e-01,
-      8.408882706e-01,  8.409610592e-01,  8.410337511e-01,  8.411063464e-01,
-      8.411624544e-01,  8.412167565e-01,  8.412709865e-01,  8.413251447e-01,
-      8.413792310e-01,  8.414332456e-01,  8.414871886e-01,  8.415493758e-01,
-      8.416211095e-01,  8.416927481e-01,  8.417642919e-01,  8.418229728e-01,
-      8.418764887e-01,  8.419299339e-01,  8.419833084e-01,  8.420366123e-01,
-      8.420898458e-01,  8.421430090e-01,  8.421989693e-01,  8.422696664e-01,
-      8.423402702e-01,  8.424107808e-01,  8.424749125e-01,  8.425276561e-01,
-      8.425803301e-01,  8.426329347e-01,  8.426854699e-01,  8.427379360e-01,
-      8.427903329e-01,  8.428426609e-01,  8.429069311e-01,  8.429765182e-01,
-      8.430460138e-01,  8.431154179e-01,  8.431704085e-01,  8.432223249e-01,
-      8.432741731e-01,  8.433259531e-01,  8.433776652e-01,  8.434293094e-01,
-      8.434808858e-01,  8.435331017e-01,  8.436016899e-01,  8.436701883e-01,
-      8.437385969e-01,  8.438048939e-01,  8.438560660e-01,  8.439071710e-01,
-      8.439582092e-01,  8.440091806e-01,  8.440600853e-01,  8.441109234e-01,
-      8.441616950e-01,  8.442124003e-01,  8.442630393e-01,  8.443136122e-01,
-      8.443641191e-01,  8.444183879e-01,  8.444855547e-01,  8.445526338e-01,
-      8.446196255e-01,  8.446828051e-01,  8.447329179e-01,  8.447829655e-01,
-      8.448329478e-01,  8.448828651e-01,  8.449327174e-01,  8.449825048e-01,
-      8.450322275e-01,  8.450818855e-01,  8.451314789e-01,  8.451810079e-01,
-      8.452304725e-01,  8.452812043e-01,  8.453469860e-01,  8.454126823e-01,
-      8.454782934e-01,  8.455438193e-01,  8.455930536e-01,  8.456420708e-01,
-      8.456910244e-01,  8.457399146e-01,  8.457887415e-01,  8.458375052e-01,
-      8.458862058e-01,  8.459348434e-01,  8.459834181e-01,  8.460319300e-01,
-      8.460803792e-01,  8.461287659e-01,  8.461865595e-01,  8.462509085e-01,
-      8.463151744e-01,  8.463793575e-01,  8.464369024e-01,  8.464849156e-01,
-      8.465328670e-01,  8.465807565e-01,  8.466285844e-01,  8.466763508e-01,
-      8.467240556e-01,  8.467716991e-01,  8.468192813e-01,  8.468668023e-01,
-      8.469142622e-01,  8.469616612e-01,  8.470089993e-01,  8.470562766e-01,
-      8.471034933e-01,  8.471506494e-01,  8.471977450e-01,  8.472520734e-01,
-      8.473147067e-01,  8.473772597e-01,  8.474397326e-01,  8.474994579e-01,
-      8.475461927e-01,  8.475928677e-01,  8.476394830e-01,  8.476860387e-01,
-      8.477325350e-01,  8.477789718e-01,  8.478253493e-01,  8.478716677e-01,
-      8.479179269e-01,  8.479641271e-01,  8.480102684e-01,  8.480563509e-01,
-      8.481023747e-01,  8.481483398e-01,  8.481942464e-01,  8.482400946e-01,
-      8.482858844e-01,  8.483316160e-01,  8.483772895e-01,  8.484229049e-01,
-      8.484684624e-01,  8.485191043e-01,  8.485796934e-01,  8.486402056e-01,
-      8.487006411e-01,  8.487609999e-01,  8.488077341e-01,  8.488528885e-01,
-      8.488979858e-01,  8.489430259e-01,  8.489880090e-01,  8.490329353e-01,
-      8.490778047e-01,  8.491226173e-01,  8.491673733e-01,  8.492120728e-01,
-      8.492567159e-01,  8.493013025e-01,  8.493458329e-01,  8.493903072e-01,
-      8.494347253e-01,  8.494790875e-01,  8.495233938e-01,  8.495676443e-01,
-      8.496118390e-01,  8.496559782e-01,  8.497000618e-01,  8.497440900e-01,
-      8.497880628e-01,  8.498319804e-01,  8.498758428e-01,  8.499196501e-01,
-      8.499634025e-01,  8.500070999e-01,  8.500507426e-01,  8.500943306e-01,
-      8.501378639e-01,  8.501813427e-01,  8.502247670e-01,  8.502681370e-01,
-      8.503114528e-01,  8.503547143e-01,  8.504044231e-01,  8.504619611e-01,
-      8.505194272e-01,  8.505768215e-01,  8.506341442e-01,  8.506802897e-01,
-      8.507231745e-01,  8.507660059e-01,  8.508087839e-01,  8.508515086e-01,
-      8.508941801e-01,  8.509367985e-01,  8.509793639e-01,  8.510218763e-01,
-      8.510643359e-01,  8.511067427e-01,  8.511490968e-01,  8.511913984e-01,
-      8.512336474e-01,  8.512758440e-01,  8.513179883e-01,  8.513600803e-01,
-      8.514021202e-01,  8.514441080e-01,  8.514860439e-01,  8.515279278e-01,
-      8.515697599e-01,  8.516115403e-01,  8.516532690e-01,  8.516949462e-01,
-      8.517365719e-01,  8.517781462e-01,  8.518196692e-01,  8.518611409e-01,
-      8.519025616e-01,  8.519439312e-01,  8.519852498e-01,  8.520265175e-01,
-      8.520677344e-01,  8.521089006e-01,  8.521500162e-01,  8.521910812e-01,
-      8.522320958e-01,  8.522730600e-01,  8.523139738e-01,  8.523548375e-01,
-      8.523956510e-01,  8.524364145e-01,  8.524771280e-01,  8.525177916e-01,
-      8.525584054e-01,  8.525989694e-01,  8.526394839e-01,  8.526799487e-01,
-      8.527203641e-01,  8.527607301e-01,  8.528010468e-01,  8.528413142e-01,
-      8.528815325e-01,  8.529217017e-01,  8.529618220e-01,  8.530018933e-01,
-      8.530419158e-01,  8.530818895e-01,  8.531218145e-01,  8.531616910e-01,
-      8.532015190e-01,  8.532412985e-01,  8.532810297e-01,  8.533207126e-01,
-      8.533603473e-01,  8.533999339e-01,  8.534394724e-01,  8.534789630e-01,
-      8.535184058e-01,  8.535578007e-01,  8.535971479e-01,  8.536364475e-01,
-      8.536756995e-01,  8.537149040e-01,  8.537540611e-01,  8.537931709e-01,
-      8.538322335e-01,  8.538712489e-01,  8.539102171e-01,  8.539491384e-01,
-      8.539880127e-01,  8.540268402e-01,  8.540656209e-01,  8.541043548e-01,
-      8.541430422e-01,  8.541816829e-01,  8.542202772e-01,  8.542588251e-01,
-      8.542973267e-01,  8.543357820e-01,  8.543741912e-01,  8.544125542e-01,
-      8.544508713e-01,  8.544891423e-01,  8.545273675e-01,  8.545655469e-01,
-      8.546036806e-01,  8.546417687e-01,  8.546798111e-01,  8.547178081e-01,
-      8.547557597e-01,  8.547936659e-01,  8.548315268e-01,  8.548693425e-01,
-      8.549071131e-01,  8.549448387e-01,  8.549825193e-01,  8.550201550e-01,
-      8.550577458e-01,  8.550952919e-01,  8.551327933e-01,  8.551702501e-01,
-      8.552076623e-01,  8.552450301e-01,  8.552823536e-01,  8.553196326e-01,
-      8.553568675e-01,  8.553940582e-01,  8.554312047e-01,  8.554683073e-01,
-      8.555053658e-01,  8.555423805e-01,  8.555793514e-01,  8.556162786e-01,
-      8.556531621e-01,  8.556900019e-01,  8.557267983e-01,  8.557635512e-01,
-      8.558002607e-01,  8.558369269e-01,  8.558735498e-01,  8.559101296e-01,
-      8.559466663e-01,  8.559831600e-01,  8.560196107e-01,  8.560560184e-01,
-      8.560923834e-01,  8.561287057e-01,  8.561649852e-01,  8.562012221e-01,
-      8.562374165e-01,  8.562735685e-01,  8.563096780e-01,  8.563457452e-01,
-      8.563817701e-01,  8.564177528e-01,  8.564536934e-01,  8.564890737e-01,
-      8.565129780e-01,  8.565368544e-01,  8.565607030e-01,  8.565845236e-01,
-      8.566083165e-01,  8.566369651e-01,  8.566725711e-01,  8.567081357e-01,
-      8.567436588e-01,  8.567791405e-01,  8.568145809e-01,  8.568499800e-01,
-      8.568853380e-01,  8.569206548e-01,  8.569559307e-01,  8.569911655e-01,
-      8.570263595e-01,  8.570615125e-01,  8.570966249e-01,  8.571316965e-01,
-      8.571667274e-01,  8.572017178e-01,  8.572366677e-01,  8.572715771e-01,
-      8.573064462e-01,  8.573412749e-01,  8.573760634e-01,  8.574108117e-01,
-      8.574455198e-01,  8.574801879e-01,  8.575148161e-01,  8.575494043e-01,
-      8.575839526e-01,  8.576184612e-01,  8.576529300e-01,  8.576873592e-01,
-      8.577217487e-01,  8.577560987e-01,  8.577904092e-01,  8.578246804e-01,
-      8.578589122e-01,  8.578931047e-01,  8.579272579e-01,  8.579613721e-01,
-      8.579954471e-01,  8.580294831e-01,  8.580634801e-01,  8.580974382e-01,
-      8.581313575e-01,  8.581652380e-01,  8.581990798e-01,  8.582328830e-01,
-      8.582556459e-01,  8.582781299e-01,  8.583005883e-01,  8.583230210e-01,
-      8.583454282e-01,  8.583678099e-01,  8.584012892e-01,  8.584347854e-01,
-      8.584682435e-01,  8.585016635e-01,  8.585350455e-01,  8.585683897e-01,
-      8.586016960e-01,  8.586349645e-01,  8.586681952e-01,  8.587013883e-01,
-      8.587345438e-01,  8.587676618e-01,  8.588007422e-01,  8.588337853e-01,
-      8.588667909e-01,  8.588997593e-01,  8.589326904e-01,  8.589655843e-01,
-      8.589984411e-01,  8.590312609e-01,  8.590640436e-01,  8.590967894e-01,
-      8.591294982e-01,  8.591621703e-01,  8.591948056e-01,  8.592274041e-01,
-      8.592599660e-01,  8.592924914e-01,  8.593249801e-01,  8.593574324e-01,
-      8.593848989e-01,  8.594064852e-01,  8.594280474e-01,  8.594495854e-01,
-      8.594710992e-01,  8.594925890e-01,  8.595164434e-01,  8.595486059e-01,
-      8.595807326e-01,  8.596128233e-01,  8.596448781e-01,  8.596768972e-01,
-      8.597088806e-01,  8.597408283e-01,  8.597727403e-01,  8.598046168e-01,
-      8.598364579e-01,  8.598682634e-01,  8.599000336e-01,  8.599317685e-01,
-      8.599634680e-01,  8.599951324e-01,  8.600267616e-01,  8.600583557e-01,
-      8.600899147e-01,  8.601214387e-01,  8.601529278e-01,  8.601843820e-01,
-      8.602158014e-01,  8.602471860e-01,  8.602785359e-01,  8.603098512e-01,
-      8.603324016e-01,  8.603532324e-01,  8.603740401e-01,  8.603948248e-01,
-      8.604155866e-01,  8.604363256e-01,  8.604609531e-01,  8.604919930e-01,
-      8.605229987e-01,  8.605539703e-01,  8.605849078e-01,  8.606158113e-01,
-      8.606466809e-01,  8.606775166e-01,  8.607083184e-01,  8.607390864e-01,
-      8.607698207e-01,  8.608005213e-01,  8.608311882e-01,  8.608618216e-01,
-      8.608924214e-01,  8.609229878e-01,  8.609535207e-01,  8.609840203e-01,
-      8.610144865e-01,  8.610449195e-01,  8.610753192e-01,  8.611056858e-01,
-      8.611360193e-01,  8.611663197e-01,  8.611965871e-01,  8.612268216e-01,
-      8.612563097e-01,  8.612764222e-01,  8.612965128e-01,  8.613165816e-01,
-      8.613366285e-01,  8.613566538e-01,  8.613766572e-01,  8.614003785e-01,
-      8.614303187e-01,  8.614602264e-01,  8.614901018e-01,  8.615199448e-01,
-      8.615497555e-01,  8.615795340e-01,  8.616092803e-01,  8.616389945e-01,
-      8.616686766e-01,  8.616983266e-01,  8.617279447e-01,  8.617575308e-01,
-      8.617870850e-01,  8.618166074e-01,  8.618460980e-01,  8.618755569e-01,
-      8.619049840e-01,  8.619343796e-01,  8.619637435e-01,  8.619930759e-01,
-      8.620127206e-01,  8.620322336e-01,  8.620517256e-01,  8.620711968e-01,
-      8.620906471e-01,  8.621100765e-01,  8.621303850e-01,  8.621594669e-01,
-      8.621885176e-01,  8.622175373e-01,  8.622465259e-01,  8.622754836e-01,
-      8.623044104e-01,  8.623333064e-01,  8.623621715e-01,  8.623910059e-01,
-      8.624198095e-01,  8.624485825e-01,  8.624773248e-01,  8.625060366e-01,
-      8.625347178e-01,  8.625633686e-01,  8.625919889e-01,  8.626205788e-01,
-      8.626491384e-01,  8.626776677e-01,  8.627061668e-01,  8.627346356e-01,
-      8.627630743e-01,  8.627914829e-01,  8.628198614e-01,  8.628482099e-01,
-      8.628765285e-01,  8.629048171e-01,  8.629330758e-01,  8.629519864e-01,
-      8.629707858e-01,  8.629895654e-01,  8.630083252e-01,  8.630270652e-01,
-      8.630457855e-01,  8.630644861e-01,  8.630909370e-01,  8.631189290e-01,
-      8.631468914e-01,  8.631748246e-01,  8.632027283e-01,  8.632306028e-01,
-      8.632584481e-01,  8.632862641e-01,  8.633140511e-01,  8.633418089e-01,
-      8.633695376e-01,  8.633972373e-01,  8.634249081e-01,  8.634525499e-01,
-      8.634769282e-01,  8.634953176e-01,  8.635136878e-01,  8.635320388e-01,
-      8.635503707e-01,  8.635686835e-01,  8.635869772e-01,  8.636055095e-01,
-      8.636328930e-01,  8.636602479e-01,  8.636875744e-01,  8.637148725e-01,
-      8.637421422e-01,  8.637693836e-01,  8.637965967e-01,  8.638237816e-01,
-      8.638509383e-01,  8.638780669e-01,  8.639051673e-01,  8.639322397e-01,
-      8.639592841e-01,  8.639863005e-01,  8.640132889e-01,  8.640402495e-01,
-      8.640671822e-01,  8.640940871e-01,  8.641209643e-01,  8.641478137e-01,
-      8.641746354e-01,  8.642014295e-01,  8.642217921e-01,  8.642396181e-01,
-      8.642574257e-01,  8.642752150e-01,  8.642929860e-01,  8.643107388e-01,
-      8.643284733e-01,  8.643476536e-01,  8.643742008e-01,  8.644007208e-01,
-      8.644272135e-01,  8.644536792e-01,  8.644801177e-01,  8.645065292e-01,
-      8.645329137e-01,  8.645592711e-01,  8.645856017e-01,  8.646119053e-01,
-      8.646381821e-01,  8.646644320e-01,  8.646906552e-01,  8.647168516e-01,
-      8.647430214e-01,  8.647614742e-01,  8.647788852e-01,  8.647962784e-01,
-      8.648136540e-01,  8.648310119e-01,  8.648483521e-01,  8.648656747e-01,
-      8.648842841e-01,  8.649102154e-01,  8.649361203e-01,  8.649619989e-01,
-      8.649878514e-01,  8.650136776e-01,  8.650394777e-01,  8.650652517e-01,
-      8.650909996e-01,  8.651167215e-01,  8.651424174e-01,  8.651680873e-01,
-      8.651937313e-01,  8.652193495e-01,  8.652449418e-01,  8.652705083e-01,
-      8.652917671e-01,  8.653087771e-01,  8.653257700e-01,  8.653427458e-01,
-      8.653597045e-01,  8.653766462e-01,  8.653935708e-01,  8.654104785e-01,
-      8.654323135e-01,  8.654576241e-01,  8.654829093e-01,  8.655081692e-01,
-      8.655334038e-01,  8.655586131e-01,  8.655837971e-01,  8.656089560e-01,
-      8.656340897e-01,  8.656591983e-01,  8.656842818e-01,  8.657093402e-01,
-      8.657343737e-01,  8.657593821e-01,  8.657843657e-01,  8.658093243e-01,
-      8.658296095e-01,  8.658462155e-01,  8.658628049e-01,  8.658793779e-01,
-      8.658959343e-01,  8.659124743e-01,  8.659289979e-01,  8.659455050e-01,
-      8.659656988e-01,  8.659904104e-01,  8.660150975e-01,  8.660397602e-01,
-      8.660643984e-01,  8.660890122e-01,  8.661136017e-01,  8.661381668e-01,
-      8.661627077e-01,  8.661872243e-01,  8.662117166e-01,  8.662361848e-01,
-      8.662606289e-01,  8.662850488e-01,  8.663094447e-01,  8.663338165e-01,
-      8.663579168e-01,  8.663741327e-01,  8.663903327e-01,  8.664065167e-01,
-      8.664226848e-01,  8.664388370e-01,  8.664549733e-01,  8.664710938e-01,
-      8.664871985e-01,  8.665090814e-01,  8.665331911e-01,  8.665572771e-01,
-      8.665813396e-01,  8.666053784e-01,  8.666293938e-01,  8.666533857e-01,
-      8.666773541e-01,  8.667012991e-01,  8.667252207e-01,  8.667491189e-01,
-      8.667729938e-01,  8.667968455e-01,  8.668206738e-01,  8.668444790e-01,
-      8.668682610e-01,  8.668920198e-01,  8.669086808e-01,  8.669244892e-01,
-      8.669402822e-01,  8.669560599e-01,  8.669718223e-01,  8.669875693e-01,
-      8.670033011e-01,  8.670190176e-01,  8.670376741e-01,  8.670612032e-01,
-      8.670847095e-01,  8.671081931e-01,  8.671316539e-01,  8.671550921e-01,
-      8.671785076e-01,  8.672019004e-01,  8.672252707e-01,  8.672424871e-01,
-      8.672580373e-01,  8.672735724e-01,  8.672890925e-01,  8.673045977e-01,
-      8.673200879e-01,  8.673355633e-01,  8.673510237e-01,  8.673674529e-01,
-      8.673905990e-01,  8.674137228e-01,  8.674368245e-01,  8.674599039e-01,
-      8.674829612e-01,  8.675059964e-01,  8.675290095e-01,  8.675520005e-01,
-      8.675749695e-01,  8.675979165e-01,  8.676208416e-01,  8.676437447e-01,
-      8.676666260e-01,
-   };
 
-   const float lut_midi_to_f_high[] = {
-      5.322785752e-06,  5.639295064e-06,  5.974624998e-06,  6.329894688e-06,
-      6.706289813e-06,  7.105066557e-06,  7.527555801e-06,  7.975167561e-06,
-      8.449395703e-06,  8.951822917e-06,  9.484126007e-06,  1.004808149e-05,
-      1.064557150e-05,  1.127859013e-05,  1.194925000e-05,  1.265978938e-05,
-      1.341257963e-05,  1.421013311e-05,  1.505511160e-05,  1.595033512e-05,
-      1.689879141e-05,  1.790364583e-05,  1.896825201e-05,  2.009616297e-05,
-      2.129114301e-05,  2.255718026e-05,  2.389849999e-05,  2.531957875e-05,
-      2.682515925e-05,  2.842026623e-05,  3.011022320e-05,  3.190067025e-05,
-      3.379758281e-05,  3.580729167e-05,  3.793650403e-05,  4.019232595e-05,
-      4.258228602e-05,  4.511436051e-05,  4.779699999e-05,  5.063915751e-05,
-      5.365031851e-05,  5.684053246e-05,  6.022044640e-05,  6.380134049e-05,
-      6.759516562e-05,  7.161458333e-05,  7.587300806e-05,  8.038465190e-05,
-      8.516457204e-05,  9.022872102e-05,  9.559399997e-05,  1.012783150e-04,
-      1.073006370e-04,  1.136810649e-04,  1.204408928e-04,  1.276026810e-04,
-      1.351903312e-04,  1.432291667e-04,  1.517460161e-04,  1.607693038e-04,
-      1.703291441e-04,  1.804574420e-04,  1.911879999e-04,  2.025566300e-04,
-      2.146012740e-04,  2.273621298e-04,  2.408817856e-04,  2.552053620e-04,
-      2.703806625e-04,  2.864583333e-04,  3.034920322e-04,  3.215386076e-04,
-      3.406582882e-04,  3.609148841e-04,  3.823759999e-04,  4.051132601e-04,
-      4.292025481e-04,  4.547242597e-04,  4.817635712e-04,  5.104107239e-04,
-      5.407613250e-04,  5.729166667e-04,  6.069840645e-04,  6.430772152e-04,
-      6.813165763e-04,  7.218297682e-04,  7.647519998e-04,  8.102265201e-04,
-      8.584050961e-04,  9.094485194e-04,  9.635271425e-04,  1.020821448e-03,
-      1.081522650e-03,  1.145833333e-03,  1.213968129e-03,  1.286154430e-03,
-      1.362633153e-03,  1.443659536e-03,  1.529504000e-03,  1.620453040e-03,
-      1.716810192e-03,  1.818897039e-03,  1.927054285e-03,  2.041642896e-03,
-      2.163045300e-03,  2.291666667e-03,  2.427936258e-03,  2.572308861e-03,
-      2.725266305e-03,  2.887319073e-03,  3.059007999e-03,  3.240906080e-03,
-      3.433620385e-03,  3.637794077e-03,  3.854108570e-03,  4.083285791e-03,
-      4.326090600e-03,  4.583333333e-03,  4.855872516e-03,  5.144617721e-03,
-      5.450532610e-03,  5.774638145e-03,  6.118015998e-03,  6.481812161e-03,
-      6.867240769e-03,  7.275588155e-03,  7.708217140e-03,  8.166571583e-03,
-      8.652181200e-03,  9.166666667e-03,  9.711745032e-03,  1.028923544e-02,
-      1.090106522e-02,  1.154927629e-02,  1.223603200e-02,  1.296362432e-02,
-      1.373448154e-02,  1.455117631e-02,  1.541643428e-02,  1.633314317e-02,
-      1.730436240e-02,  1.833333333e-02,  1.942349006e-02,  2.057847089e-02,
-      2.180213044e-02,  2.309855258e-02,  2.447206399e-02,  2.592724864e-02,
-      2.746896308e-02,  2.910235262e-02,  3.083286856e-02,  3.266628633e-02,
-      3.460872480e-02,  3.666666667e-02,  3.884698013e-02,  4.115694177e-02,
-      4.360426088e-02,  4.619710516e-02,  4.894412799e-02,  5.185449729e-02,
-      5.493792615e-02,  5.820470524e-02,  6.166573712e-02,  6.533257266e-02,
-      6.921744960e-02,  7.333333333e-02,  7.769396025e-02,  8.231388354e-02,
-      8.720852177e-02,  9.239421033e-02,  9.788825597e-02,  1.037089946e-01,
-      1.098758523e-01,  1.164094105e-01,  1.233314742e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-      1.250000000e-01,  1.250000000e-01,  1.250000000e-01,  1.250000000e-01,
-   };
 
-   const float lut_midi_to_f_low[] = {
-      1.000000000e+00,  1.000225659e+00,  1.000451370e+00,  1.000677131e+00,
-      1.000902943e+00,  1.001128806e+00,  1.001354720e+00,  1.001580685e+00,
-      1.001806701e+00,  1.002032768e+00,  1.002258886e+00,  1.002485055e+00,
-      1.002711275e+00,  1.002937546e+00,  1.003163868e+00,  1.003390242e+00,
-      1.003616666e+00,  1.003843141e+00,  1.004069668e+00,  1.004296246e+00,
-      1.004522874e+00,  1.004749554e+00,  1.004976285e+00,  1.005203068e+00,
-      1.005429901e+00,  1.005656786e+00,  1.005883722e+00,  1.006110709e+00,
-      1.006337747e+00,  1.006564836e+00,  1.006791977e+00,  1.007019169e+00,
-      1.007246412e+00,  1.007473707e+00,  1.007701053e+00,  1.007928450e+00,
-      1.008155898e+00,  1.008383398e+00,  1.008610949e+00,  1.008838551e+00,
-      1.009066205e+00,  1.009293910e+00,  1.009521667e+00,  1.009749475e+00,
-      1.009977334e+00,  1.010205245e+00,  1.010433207e+00,  1.010661221e+00,
-      1.010889286e+00,  1.011117403e+00,  1.011345571e+00,  1.011573790e+00,
-      1.011802061e+00,  1.012030384e+00,  1.012258758e+00,  1.012487183e+00,
-      1.012715661e+00,  1.012944189e+00,  1.013172770e+00,  1.013401401e+00,
-      1.013630085e+00,  1.013858820e+00,  1.014087607e+00,  1.014316445e+00,
-      1.014545335e+00,  1.014774277e+00,  1.015003270e+00,  1.015232315e+00,
-      1.015461411e+00,  1.015690560e+00,  1.015919760e+00,  1.016149011e+00,
-      1.016378315e+00,  1.016607670e+00,  1.016837077e+00,  1.017066536e+00,
-      1.017296046e+00,  1.017525609e+00,  1.017755223e+00,  1.017984889e+00,
-      1.018214607e+00,  1.018444376e+00,  1.018674198e+00,  1.018904071e+00,
-      1.019133996e+00,  1.019363973e+00,  1.019594002e+00,  1.019824083e+00,
-      1.020054216e+00,  1.020284401e+00,  1.020514637e+00,  1.020744926e+00,
-      1.020975266e+00,  1.021205659e+00,  1.021436104e+00,  1.021666600e+00,
-      1.021897149e+00,  1.022127749e+00,  1.022358402e+00,  1.022589107e+00,
-      1.022819863e+00,  1.023050672e+00,  1.023281533e+00,  1.023512446e+00,
-      1.023743411e+00,  1.023974428e+00,  1.024205498e+00,  1.024436619e+00,
-      1.024667793e+00,  1.024899019e+00,  1.025130297e+00,  1.025361627e+00,
-      1.025593009e+00,  1.025824444e+00,  1.026055931e+00,  1.026287470e+00,
-      1.026519061e+00,  1.026750705e+00,  1.026982401e+00,  1.027214149e+00,
-      1.027445949e+00,  1.027677802e+00,  1.027909707e+00,  1.028141664e+00,
-      1.028373674e+00,  1.028605736e+00,  1.028837851e+00,  1.029070017e+00,
-      1.029302237e+00,  1.029534508e+00,  1.029766832e+00,  1.029999209e+00,
-      1.030231638e+00,  1.030464119e+00,  1.030696653e+00,  1.030929239e+00,
-      1.031161878e+00,  1.031394569e+00,  1.031627313e+00,  1.031860109e+00,
-      1.032092958e+00,  1.032325859e+00,  1.032558813e+00,  1.032791820e+00,
-      1.033024879e+00,  1.033257991e+00,  1.033491155e+00,  1.033724372e+00,
-      1.033957641e+00,  1.034190964e+00,  1.034424338e+00,  1.034657766e+00,
-      1.034891246e+00,  1.035124779e+00,  1.035358364e+00,  1.035592003e+00,
-      1.035825694e+00,  1.036059437e+00,  1.036293234e+00,  1.036527083e+00,
-      1.036760985e+00,  1.036994940e+00,  1.037228947e+00,  1.037463008e+00,
-      1.037697121e+00,  1.037931287e+00,  1.038165506e+00,  1.038399777e+00,
-      1.038634102e+00,  1.038868479e+00,  1.039102910e+00,  1.039337393e+00,
-      1.039571929e+00,  1.039806518e+00,  1.040041160e+00,  1.040275855e+00,
-      1.040510603e+00,  1.040745404e+00,  1.040980258e+00,  1.041215165e+00,
-      1.041450125e+00,  1.041685138e+00,  1.041920204e+00,  1.042155323e+00,
-      1.042390495e+00,  1.042625720e+00,  1.042860998e+00,  1.043096329e+00,
-      1.043331714e+00,  1.043567151e+00,  1.043802642e+00,  1.044038185e+00,
-      1.044273782e+00,  1.044509433e+00,  1.044745136e+00,  1.044980892e+00,
-      1.045216702e+00,  1.045452565e+00,  1.045688481e+00,  1.045924450e+00,
-      1.046160473e+00,  1.046396549e+00,  1.046632678e+00,  1.046868860e+00,
-      1.047105096e+00,  1.047341385e+00,  1.047577727e+00,  1.047814123e+00,
-      1.048050572e+00,  1.048287074e+00,  1.048523630e+00,  1.048760239e+00,
-      1.048996902e+00,  1.049233618e+00,  1.049470387e+00,  1.049707210e+00,
-      1.049944086e+00,  1.050181015e+00,  1.050417999e+00,  1.050655035e+00,
-      1.050892125e+00,  1.051129269e+00,  1.051366466e+00,  1.051603717e+00,
-      1.051841021e+00,  1.052078378e+00,  1.052315790e+00,  1.052553255e+00,
-      1.052790773e+00,  1.053028345e+00,  1.053265971e+00,  1.053503650e+00,
-      1.053741383e+00,  1.053979169e+00,  1.054217010e+00,  1.054454903e+00,
-      1.054692851e+00,  1.054930852e+00,  1.055168907e+00,  1.055407016e+00,
-      1.055645178e+00,  1.055883395e+00,  1.056121664e+00,  1.056359988e+00,
-      1.056598366e+00,  1.056836797e+00,  1.057075282e+00,  1.057313821e+00,
-      1.057552413e+00,  1.057791060e+00,  1.058029760e+00,  1.058268515e+00,
-      1.058507323e+00,  1.058746185e+00,  1.058985101e+00,  1.059224071e+00,
-   };
 
-   const float lut_pot_curve[] = {
-      0.000000000e+00,  3.255208333e-02,  6.510416667e-02,  9.765625000e-02,
-      1.056640625e-01,  1.117675781e-01,  1.178710938e-01,  1.239746094e-01,
-      1.263912671e-01,  1.280634632e-01,  1.297356592e-01,  1.314078553e-01,
-      1.330800514e-01,  1.347522474e-01,  1.364244435e-01,  1.380966396e-01,
-      1.397688356e-01,  1.414410317e-01,  1.431132277e-01,  1.447854238e-01,
-      1.464576199e-01,  1.481298159e-01,  1.498020120e-01,  1.514742080e-01,
-      1.531464041e-01,  1.548186002e-01,  1.564907962e-01,  1.581629923e-01,
-      1.598351884e-01,  1.615073844e-01,  1.631795805e-01,  1.648517765e-01,
-      1.665239726e-01,  1.681961687e-01,  1.698683647e-01,  1.715405608e-01,
-      1.732127568e-01,  1.748849529e-01,  1.765571490e-01,  1.782293450e-01,
-      1.799015411e-01,  1.815737372e-01,  1.832459332e-01,  1.849181293e-01,
-      1.865903253e-01,  1.882625214e-01,  1.899347175e-01,  1.916069135e-01,
-      1.932791096e-01,  1.949513057e-01,  1.966235017e-01,  1.982956978e-01,
-      1.999678938e-01,  2.016400899e-01,  2.033122860e-01,  2.049844820e-01,
-      2.066566781e-01,  2.083288741e-01,  2.100010702e-01,  2.116732663e-01,
-      2.133454623e-01,  2.150176584e-01,  2.166898545e-01,  2.183620505e-01,
-      2.200342466e-01,  2.217064426e-01,  2.233786387e-01,  2.250508348e-01,
-      2.267230308e-01,  2.283952269e-01,  2.300674229e-01,  2.317396190e-01,
-      2.334118151e-01,  2.350840111e-01,  2.367562072e-01,  2.384284033e-01,
-      2.401005993e-01,  2.417727954e-01,  2.434449914e-01,  2.451171875e-01,
-      2.467893836e-01,  2.484615796e-01,  2.501148897e-01,  2.515510110e-01,
-      2.529871324e-01,  2.544232537e-01,  2.558593750e-01,  2.572954963e-01,
-      2.587316176e-01,  2.601677390e-01,  2.616038603e-01,  2.630399816e-01,
-      2.644761029e-01,  2.659122243e-01,  2.673483456e-01,  2.687844669e-01,
-      2.702205882e-01,  2.716567096e-01,  2.730928309e-01,  2.745289522e-01,
-      2.759650735e-01,  2.774011949e-01,  2.788373162e-01,  2.802734375e-01,
-      2.817095588e-01,  2.831456801e-01,  2.845818015e-01,  2.860179228e-01,
-      2.874540441e-01,  2.888901654e-01,  2.903262868e-01,  2.917624081e-01,
-      2.931985294e-01,  2.946346507e-01,  2.960707721e-01,  2.975068934e-01,
-      2.989430147e-01,  3.003791360e-01,  3.018152574e-01,  3.032513787e-01,
-      3.046875000e-01,  3.061236213e-01,  3.075597426e-01,  3.089958640e-01,
-      3.104319853e-01,  3.118681066e-01,  3.133042279e-01,  3.147403493e-01,
-      3.161764706e-01,  3.176125919e-01,  3.190487132e-01,  3.204848346e-01,
-      3.219209559e-01,  3.233570772e-01,  3.247931985e-01,  3.262293199e-01,
-      3.276654412e-01,  3.291015625e-01,  3.305376838e-01,  3.319738051e-01,
-      3.334099265e-01,  3.348460478e-01,  3.362821691e-01,  3.377182904e-01,
-      3.391544118e-01,  3.405905331e-01,  3.420266544e-01,  3.434627757e-01,
-      3.448988971e-01,  3.463350184e-01,  3.477711397e-01,  3.492072610e-01,
-      3.506433824e-01,  3.520795037e-01,  3.535156250e-01,  3.549517463e-01,
-      3.563878676e-01,  3.578239890e-01,  3.592601103e-01,  3.606962316e-01,
-      3.621323529e-01,  3.635684743e-01,  3.650045956e-01,  3.664407169e-01,
-      3.678768382e-01,  3.693129596e-01,  3.707490809e-01,  3.721852022e-01,
-      3.736213235e-01,  3.750574449e-01,  3.764935662e-01,  3.779296875e-01,
-      3.793658088e-01,  3.808019301e-01,  3.822380515e-01,  3.836741728e-01,
-      3.851102941e-01,  3.865464154e-01,  3.879825368e-01,  3.894186581e-01,
-      3.908547794e-01,  3.922909007e-01,  3.937270221e-01,  3.951631434e-01,
-      3.965992647e-01,  3.980353860e-01,  3.994715074e-01,  4.009076287e-01,
-      4.023437500e-01,  4.037798713e-01,  4.052159926e-01,  4.066521140e-01,
-      4.080882353e-01,  4.095243566e-01,  4.109604779e-01,  4.123965993e-01,
-      4.138327206e-01,  4.152688419e-01,  4.167049632e-01,  4.181410846e-01,
-      4.195772059e-01,  4.210133272e-01,  4.224494485e-01,  4.238855699e-01,
-      4.253216912e-01,  4.267578125e-01,  4.281939338e-01,  4.296300551e-01,
-      4.310661765e-01,  4.325022978e-01,  4.339384191e-01,  4.353745404e-01,
-      4.368106618e-01,  4.382467831e-01,  4.396829044e-01,  4.411190257e-01,
-      4.425551471e-01,  4.439912684e-01,  4.454273897e-01,  4.468635110e-01,
-      4.482996324e-01,  4.497357537e-01,  4.511718750e-01,  4.526079963e-01,
-      4.540441176e-01,  4.554802390e-01,  4.569163603e-01,  4.583524816e-01,
-      4.597886029e-01,  4.612247243e-01,  4.626608456e-01,  4.640969669e-01,
-      4.655330882e-01,  4.669692096e-01,  4.684053309e-01,  4.698414522e-01,
-      4.712775735e-01,  4.727136949e-01,  4.741498162e-01,  4.755859375e-01,
-      4.770220588e-01,  4.784581801e-01,  4.798943015e-01,  4.813304228e-01,
-      4.827665441e-01,  4.842026654e-01,  4.856387868e-01,  4.870749081e-01,
-      4.885110294e-01,  4.899471507e-01,  4.913832721e-01,  4.928193934e-01,
-      4.942555147e-01,  4.956916360e-01,  4.971277574e-01,  4.985638787e-01,
-      5.000000000e-01,  5.014361213e-01,  5.028722426e-01,  5.043083640e-01,
-      5.057444853e-01,  5.071806066e-01,  5.086167279e-01,  5.100528493e-01,
-      5.114889706e-01,  5.129250919e-01,  5.143612132e-01,  5.157973346e-01,
-      5.172334559e-01,  5.186695772e-01,  5.201056985e-01,  5.215418199e-01,
-      5.229779412e-01,  5.244140625e-01,  5.258501838e-01,  5.272863051e-01,
-      5.287224265e-01,  5.301585478e-01,  5.315946691e-01,  5.330307904e-01,
-      5.344669118e-01,  5.359030331e-01,  5.373391544e-01,  5.387752757e-01,
-      5.402113971e-01,  5.416475184e-01,  5.430836397e-01,  5.445197610e-01,
-      5.459558824e-01,  5.473920037e-01,  5.488281250e-01,  5.502642463e-01,
-      5.517003676e-01,  5.531364890e-01,  5.545726103e-01,  5.560087316e-01,
-      5.574448529e-01,  5.588809743e-01,  5.603170956e-01,  5.617532169e-01,
-      5.631893382e-01,  5.646254596e-01,  5.660615809e-01,  5.674977022e-01,
-      5.689338235e-01,  5.703699449e-01,  5.718060662e-01,  5.732421875e-01,
-      5.746783088e-01,  5.761144301e-01,  5.775505515e-01,  5.789866728e-01,
-      5.804227941e-01,  5.818589154e-01,  5.832950368e-01,  5.847311581e-01,
-      5.861672794e-01,  5.876034007e-01,  5.890395221e-01,  5.904756434e-01,
-      5.919117647e-01,  5.933478860e-01,  5.947840074e-01,  5.962201287e-01,
-      5.976562500e-01,  5.990923713e-01,  6.005284926e-01,  6.019646140e-01,
-      6.034007353e-01,  6.048368566e-01,  6.062729779e-01,  6.077090993e-01,
-      6.091452206e-01,  6.105813419e-01,  6.120174632e-01,  6.134535846e-01,
-      6.148897059e-01,  6.163258272e-01,  6.177619485e-01,  6.191980699e-01,
-      6.206341912e-01,  6.220703125e-01,  6.235064338e-01,  6.249425551e-01,
-      6.263786765e-01,  6.278147978e-01,  6.292509191e-01,  6.306870404e-01,
-      6.321231618e-01,  6.335592831e-01,  6.349954044e-01,  6.364315257e-01,
-      6.378676471e-01,  6.393037684e-01,  6.407398897e-01,  6.421760110e-01,
-      6.436121324e-01,  6.450482537e-01,  6.464843750e-01,  6.479204963e-01,
-      6.493566176e-01,  6.507927390e-01,  6.522288603e-01,  6.536649816e-01,
-      6.551011029e-01,  6.565372243e-01,  6.579733456e-01,  6.594094669e-01,
-      6.608455882e-01,  6.622817096e-01,  6.637178309e-01,  6.651539522e-01,
-      6.665900735e-01,  6.680261949e-01,  6.694623162e-01,  6.708984375e-01,
-      6.723345588e-01,  6.737706801e-01,  6.752068015e-01,  6.766429228e-01,
-      6.780790441e-01,  6.795151654e-01,  6.809512868e-01,  6.823874081e-01,
-      6.838235294e-01,  6.852596507e-01,  6.866957721e-01,  6.881318934e-01,
-      6.895680147e-01,  6.910041360e-01,  6.924402574e-01,  6.938763787e-01,
-      6.953125000e-01,  6.967486213e-01,  6.981847426e-01,  6.996208640e-01,
-      7.010569853e-01,  7.024931066e-01,  7.039292279e-01,  7.053653493e-01,
-      7.068014706e-01,  7.082375919e-01,  7.096737132e-01,  7.111098346e-01,
-      7.125459559e-01,  7.139820772e-01,  7.154181985e-01,  7.168543199e-01,
-      7.182904412e-01,  7.197265625e-01,  7.211626838e-01,  7.225988051e-01,
-      7.240349265e-01,  7.254710478e-01,  7.269071691e-01,  7.283432904e-01,
-      7.297794118e-01,  7.312155331e-01,  7.326516544e-01,  7.340877757e-01,
-      7.355238971e-01,  7.369600184e-01,  7.383961397e-01,  7.398322610e-01,
-      7.412683824e-01,  7.427045037e-01,  7.441406250e-01,  7.455767463e-01,
-      7.470128676e-01,  7.484489890e-01,  7.498851103e-01,  7.518717448e-01,
-      7.539062500e-01,  7.559407552e-01,  7.579752604e-01,  7.600097656e-01,
-      7.620442708e-01,  7.640787760e-01,  7.661132812e-01,  7.681477865e-01,
-      7.701822917e-01,  7.722167969e-01,  7.742513021e-01,  7.762858073e-01,
-      7.783203125e-01,  7.803548177e-01,  7.823893229e-01,  7.844238281e-01,
-      7.864583333e-01,  7.884928385e-01,  7.905273438e-01,  7.925618490e-01,
-      7.945963542e-01,  7.966308594e-01,  7.986653646e-01,  8.006998698e-01,
-      8.027343750e-01,  8.047688802e-01,  8.068033854e-01,  8.088378906e-01,
-      8.108723958e-01,  8.129069010e-01,  8.149414062e-01,  8.169759115e-01,
-      8.190104167e-01,  8.210449219e-01,  8.230794271e-01,  8.251139323e-01,
-      8.271484375e-01,  8.291829427e-01,  8.312174479e-01,  8.332519531e-01,
-      8.352864583e-01,  8.373209635e-01,  8.393554688e-01,  8.413899740e-01,
-      8.434244792e-01,  8.454589844e-01,  8.474934896e-01,  8.495279948e-01,
-      8.515625000e-01,  8.535970052e-01,  8.556315104e-01,  8.576660156e-01,
-      8.597005208e-01,  8.617350260e-01,  8.637695312e-01,  8.658040365e-01,
-      8.678385417e-01,  8.698730469e-01,  8.719075521e-01,  8.739420573e-01,
-      8.756893382e-01,  8.771254596e-01,  8.785615809e-01,  8.799977022e-01,
-      8.814338235e-01,  8.828699449e-01,  8.843060662e-01,  8.857421875e-01,
-      8.871783088e-01,  8.886144301e-01,  8.900505515e-01,  8.914866728e-01,
-      8.929227941e-01,  8.943589154e-01,  8.957950368e-01,  8.972311581e-01,
-      8.986672794e-01,  9.023437500e-01,  9.348958333e-01,  9.674479167e-01,
-      1.000000000e+00,
-   };
 
-   const float lut_ap_poles[] = {
-      9.999174437e-01,  9.997160329e-01,  9.993897602e-01,  9.987952776e-01,
-      9.976718129e-01,  9.955280098e-01,  9.914315323e-01,  9.836199785e-01,
-      9.688016569e-01,  9.409767040e-01,  8.897147107e-01,  7.984785110e-01,
-      6.454684139e-01,  4.118108699e-01,  9.725667152e-02, -2.775386379e-01,
-     -7.176356738e-01,
-   };
 
 
 
@@ -2003,1565 +102,11 @@ namespace scalaria {
      lut_ap_poles,
    };
 
-   const float wav_sine_i[] = {
-     -8.704110566e-18, -6.135884649e-03, -1.227153829e-02, -1.840672991e-02,
-     -2.454122852e-02, -3.067480318e-02, -3.680722294e-02, -4.293825693e-02,
-     -4.906767433e-02, -5.519524435e-02, -6.132073630e-02, -6.744391956e-02,
-     -7.356456360e-02, -7.968243797e-02, -8.579731234e-02, -9.190895650e-02,
-     -9.801714033e-02, -1.041216339e-01, -1.102222073e-01, -1.163186309e-01,
-     -1.224106752e-01, -1.284981108e-01, -1.345807085e-01, -1.406582393e-01,
-     -1.467304745e-01, -1.527971853e-01, -1.588581433e-01, -1.649131205e-01,
-     -1.709618888e-01, -1.770042204e-01, -1.830398880e-01, -1.890686641e-01,
-     -1.950903220e-01, -2.011046348e-01, -2.071113762e-01, -2.131103199e-01,
-     -2.191012402e-01, -2.250839114e-01, -2.310581083e-01, -2.370236060e-01,
-     -2.429801799e-01, -2.489276057e-01, -2.548656596e-01, -2.607941179e-01,
-     -2.667127575e-01, -2.726213554e-01, -2.785196894e-01, -2.844075372e-01,
-     -2.902846773e-01, -2.961508882e-01, -3.020059493e-01, -3.078496400e-01,
-     -3.136817404e-01, -3.195020308e-01, -3.253102922e-01, -3.311063058e-01,
-     -3.368898534e-01, -3.426607173e-01, -3.484186802e-01, -3.541635254e-01,
-     -3.598950365e-01, -3.656129978e-01, -3.713171940e-01, -3.770074102e-01,
-     -3.826834324e-01, -3.883450467e-01, -3.939920401e-01, -3.996241998e-01,
-     -4.052413140e-01, -4.108431711e-01, -4.164295601e-01, -4.220002708e-01,
-     -4.275550934e-01, -4.330938189e-01, -4.386162385e-01, -4.441221446e-01,
-     -4.496113297e-01, -4.550835871e-01, -4.605387110e-01, -4.659764958e-01,
-     -4.713967368e-01, -4.767992301e-01, -4.821837721e-01, -4.875501601e-01,
-     -4.928981922e-01, -4.982276670e-01, -5.035383837e-01, -5.088301425e-01,
-     -5.141027442e-01, -5.193559902e-01, -5.245896827e-01, -5.298036247e-01,
-     -5.349976199e-01, -5.401714727e-01, -5.453249884e-01, -5.504579729e-01,
-     -5.555702330e-01, -5.606615762e-01, -5.657318108e-01, -5.707807459e-01,
-     -5.758081914e-01, -5.808139581e-01, -5.857978575e-01, -5.907597019e-01,
-     -5.956993045e-01, -6.006164794e-01, -6.055110414e-01, -6.103828063e-01,
-     -6.152315906e-01, -6.200572118e-01, -6.248594881e-01, -6.296382389e-01,
-     -6.343932842e-01, -6.391244449e-01, -6.438315429e-01, -6.485144010e-01,
-     -6.531728430e-01, -6.578066933e-01, -6.624157776e-01, -6.669999223e-01,
-     -6.715589548e-01, -6.760927036e-01, -6.806009978e-01, -6.850836678e-01,
-     -6.895405447e-01, -6.939714609e-01, -6.983762494e-01, -7.027547445e-01,
-     -7.071067812e-01, -7.114321957e-01, -7.157308253e-01, -7.200025080e-01,
-     -7.242470830e-01, -7.284643904e-01, -7.326542717e-01, -7.368165689e-01,
-     -7.409511254e-01, -7.450577854e-01, -7.491363945e-01, -7.531867990e-01,
-     -7.572088465e-01, -7.612023855e-01, -7.651672656e-01, -7.691033376e-01,
-     -7.730104534e-01, -7.768884657e-01, -7.807372286e-01, -7.845565972e-01,
-     -7.883464276e-01, -7.921065773e-01, -7.958369046e-01, -7.995372691e-01,
-     -8.032075315e-01, -8.068475535e-01, -8.104571983e-01, -8.140363297e-01,
-     -8.175848132e-01, -8.211025150e-01, -8.245893028e-01, -8.280450453e-01,
-     -8.314696123e-01, -8.348628750e-01, -8.382247056e-01, -8.415549774e-01,
-     -8.448535652e-01, -8.481203448e-01, -8.513551931e-01, -8.545579884e-01,
-     -8.577286100e-01, -8.608669386e-01, -8.639728561e-01, -8.670462455e-01,
-     -8.700869911e-01, -8.730949784e-01, -8.760700942e-01, -8.790122264e-01,
-     -8.819212643e-01, -8.847970984e-01, -8.876396204e-01, -8.904487232e-01,
-     -8.932243012e-01, -8.959662498e-01, -8.986744657e-01, -9.013488470e-01,
-     -9.039892931e-01, -9.065957045e-01, -9.091679831e-01, -9.117060320e-01,
-     -9.142097557e-01, -9.166790599e-01, -9.191138517e-01, -9.215140393e-01,
-     -9.238795325e-01, -9.262102421e-01, -9.285060805e-01, -9.307669611e-01,
-     -9.329927988e-01, -9.351835099e-01, -9.373390119e-01, -9.394592236e-01,
-     -9.415440652e-01, -9.435934582e-01, -9.456073254e-01, -9.475855910e-01,
-     -9.495281806e-01, -9.514350210e-01, -9.533060404e-01, -9.551411683e-01,
-     -9.569403357e-01, -9.587034749e-01, -9.604305194e-01, -9.621214043e-01,
-     -9.637760658e-01, -9.653944417e-01, -9.669764710e-01, -9.685220943e-01,
-     -9.700312532e-01, -9.715038910e-01, -9.729399522e-01, -9.743393828e-01,
-     -9.757021300e-01, -9.770281427e-01, -9.783173707e-01, -9.795697657e-01,
-     -9.807852804e-01, -9.819638691e-01, -9.831054874e-01, -9.842100924e-01,
-     -9.852776424e-01, -9.863080972e-01, -9.873014182e-01, -9.882575677e-01,
-     -9.891765100e-01, -9.900582103e-01, -9.909026354e-01, -9.917097537e-01,
-     -9.924795346e-01, -9.932119492e-01, -9.939069700e-01, -9.945645707e-01,
-     -9.951847267e-01, -9.957674145e-01, -9.963126122e-01, -9.968202993e-01,
-     -9.972904567e-01, -9.977230666e-01, -9.981181129e-01, -9.984755806e-01,
-     -9.987954562e-01, -9.990777278e-01, -9.993223846e-01, -9.995294175e-01,
-     -9.996988187e-01, -9.998305818e-01, -9.999247018e-01, -9.999811753e-01,
-     -1.000000000e+00, -9.999811753e-01, -9.999247018e-01, -9.998305818e-01,
-     -9.996988187e-01, -9.995294175e-01, -9.993223846e-01, -9.990777278e-01,
-     -9.987954562e-01, -9.984755806e-01, -9.981181129e-01, -9.977230666e-01,
-     -9.972904567e-01, -9.968202993e-01, -9.963126122e-01, -9.957674145e-01,
-     -9.951847267e-01, -9.945645707e-01, -9.939069700e-01, -9.932119492e-01,
-     -9.924795346e-01, -9.917097537e-01, -9.909026354e-01, -9.900582103e-01,
-     -9.891765100e-01, -9.882575677e-01, -9.873014182e-01, -9.863080972e-01,
-     -9.852776424e-01, -9.842100924e-01, -9.831054874e-01, -9.819638691e-01,
-     -9.807852804e-01, -9.795697657e-01, -9.783173707e-01, -9.770281427e-01,
-     -9.757021300e-01, -9.743393828e-01, -9.729399522e-01, -9.715038910e-01,
-     -9.700312532e-01, -9.685220943e-01, -9.669764710e-01, -9.653944417e-01,
-     -9.637760658e-01, -9.621214043e-01, -9.604305194e-01, -9.587034749e-01,
-     -9.569403357e-01, -9.551411683e-01, -9.533060404e-01, -9.514350210e-01,
-     -9.495281806e-01, -9.475855910e-01, -9.456073254e-01, -9.435934582e-01,
-     -9.415440652e-01, -9.394592236e-01, -9.373390119e-01, -9.351835099e-01,
-     -9.329927988e-01, -9.307669611e-01, -9.285060805e-01, -9.262102421e-01,
-     -9.238795325e-01, -9.215140393e-01, -9.191138517e-01, -9.166790599e-01,
-     -9.142097557e-01, -9.117060320e-01, -9.091679831e-01, -9.065957045e-01,
-     -9.039892931e-01, -9.013488470e-01, -8.986744657e-01, -8.959662498e-01,
-     -8.932243012e-01, -8.904487232e-01, -8.876396204e-01, -8.847970984e-01,
-     -8.819212643e-01, -8.790122264e-01, -8.760700942e-01, -8.730949784e-01,
-     -8.700869911e-01, -8.670462455e-01, -8.639728561e-01, -8.608669386e-01,
-     -8.577286100e-01, -8.545579884e-01, -8.513551931e-01, -8.481203448e-01,
-     -8.448535652e-01, -8.415549774e-01, -8.382247056e-01, -8.348628750e-01,
-     -8.314696123e-01, -8.280450453e-01, -8.245893028e-01, -8.211025150e-01,
-     -8.175848132e-01, -8.140363297e-01, -8.104571983e-01, -8.068475535e-01,
-     -8.032075315e-01, -7.995372691e-01, -7.958369046e-01, -7.921065773e-01,
-     -7.883464276e-01, -7.845565972e-01, -7.807372286e-01, -7.768884657e-01,
-     -7.730104534e-01, -7.691033376e-01, -7.651672656e-01, -7.612023855e-01,
-     -7.572088465e-01, -7.531867990e-01, -7.491363945e-01, -7.450577854e-01,
-     -7.409511254e-01, -7.368165689e-01, -7.326542717e-01, -7.284643904e-01,
-     -7.242470830e-01, -7.200025080e-01, -7.157308253e-01, -7.114321957e-01,
-     -7.071067812e-01, -7.027547445e-01, -6.983762494e-01, -6.939714609e-01,
-     -6.895405447e-01, -6.850836678e-01, -6.806009978e-01, -6.760927036e-01,
-     -6.715589548e-01, -6.669999223e-01, -6.624157776e-01, -6.578066933e-01,
-     -6.531728430e-01, -6.485144010e-01, -6.438315429e-01, -6.391244449e-01,
-     -6.343932842e-01, -6.296382389e-01, -6.248594881e-01, -6.200572118e-01,
-     -6.152315906e-01, -6.103828063e-01, -6.055110414e-01, -6.006164794e-01,
-     -5.956993045e-01, -5.907597019e-01, -5.857978575e-01, -5.808139581e-01,
-     -5.758081914e-01, -5.707807459e-01, -5.657318108e-01, -5.606615762e-01,
-     -5.555702330e-01, -5.504579729e-01, -5.453249884e-01, -5.401714727e-01,
-     -5.349976199e-01, -5.298036247e-01, -5.245896827e-01, -5.193559902e-01,
-     -5.141027442e-01, -5.088301425e-01, -5.035383837e-01, -4.982276670e-01,
-     -4.928981922e-01, -4.875501601e-01, -4.821837721e-01, -4.767992301e-01,
-     -4.713967368e-01, -4.659764958e-01, -4.605387110e-01, -4.550835871e-01,
-     -4.496113297e-01, -4.441221446e-01, -4.386162385e-01, -4.330938189e-01,
-     -4.275550934e-01, -4.220002708e-01, -4.164295601e-01, -4.108431711e-01,
-     -4.052413140e-01, -3.996241998e-01, -3.939920401e-01, -3.883450467e-01,
-     -3.826834324e-01, -3.770074102e-01, -3.713171940e-01, -3.656129978e-01,
-     -3.598950365e-01, -3.541635254e-01, -3.484186802e-01, -3.426607173e-01,
-     -3.368898534e-01, -3.311063058e-01, -3.253102922e-01, -3.195020308e-01,
-     -3.136817404e-01, -3.078496400e-01, -3.020059493e-01, -2.961508882e-01,
-     -2.902846773e-01, -2.844075372e-01, -2.785196894e-01, -2.726213554e-01,
-     -2.667127575e-01, -2.607941179e-01, -2.548656596e-01, -2.489276057e-01,
-     -2.429801799e-01, -2.370236060e-01, -2.310581083e-01, -2.250839114e-01,
-     -2.191012402e-01, -2.131103199e-01, -2.071113762e-01, -2.011046348e-01,
-     -1.950903220e-01, -1.890686641e-01, -1.830398880e-01, -1.770042204e-01,
-     -1.709618888e-01, -1.649131205e-01, -1.588581433e-01, -1.527971853e-01,
-     -1.467304745e-01, -1.406582393e-01, -1.345807085e-01, -1.284981108e-01,
-     -1.224106752e-01, -1.163186309e-01, -1.102222073e-01, -1.041216339e-01,
-     -9.801714033e-02, -9.190895650e-02, -8.579731234e-02, -7.968243797e-02,
-     -7.356456360e-02, -6.744391956e-02, -6.132073630e-02, -5.519524435e-02,
-     -4.906767433e-02, -4.293825693e-02, -3.680722294e-02, -3.067480318e-02,
-     -2.454122852e-02, -1.840672991e-02, -1.227153829e-02, -6.135884649e-03,
-     -1.311687905e-16,  6.135884649e-03,  1.227153829e-02,  1.840672991e-02,
-      2.454122852e-02,  3.067480318e-02,  3.680722294e-02,  4.293825693e-02,
-      4.906767433e-02,  5.519524435e-02,  6.132073630e-02,  6.744391956e-02,
-      7.356456360e-02,  7.968243797e-02,  8.579731234e-02,  9.190895650e-02,
-      9.801714033e-02,  1.041216339e-01,  1.102222073e-01,  1.163186309e-01,
-      1.224106752e-01,  1.284981108e-01,  1.345807085e-01,  1.406582393e-01,
-      1.467304745e-01,  1.527971853e-01,  1.588581433e-01,  1.649131205e-01,
-      1.709618888e-01,  1.770042204e-01,  1.830398880e-01,  1.890686641e-01,
-      1.950903220e-01,  2.011046348e-01,  2.071113762e-01,  2.131103199e-01,
-      2.191012402e-01,  2.250839114e-01,  2.310581083e-01,  2.370236060e-01,
-      2.429801799e-01,  2.489276057e-01,  2.548656596e-01,  2.607941179e-01,
-      2.667127575e-01,  2.726213554e-01,  2.785196894e-01,  2.844075372e-01,
-      2.902846773e-01,  2.961508882e-01,  3.020059493e-01,  3.078496400e-01,
-      3.136817404e-01,  3.195020308e-01,  3.253102922e-01,  3.311063058e-01,
-      3.368898534e-01,  3.426607173e-01,  3.484186802e-01,  3.541635254e-01,
-      3.598950365e-01,  3.656129978e-01,  3.713171940e-01,  3.770074102e-01,
-      3.826834324e-01,  3.883450467e-01,  3.939920401e-01,  3.996241998e-01,
-      4.052413140e-01,  4.108431711e-01,  4.164295601e-01,  4.220002708e-01,
-      4.275550934e-01,  4.330938189e-01,  4.386162385e-01,  4.441221446e-01,
-      4.496113297e-01,  4.550835871e-01,  4.605387110e-01,  4.659764958e-01,
-      4.713967368e-01,  4.767992301e-01,  4.821837721e-01,  4.875501601e-01,
-      4.928981922e-01,  4.982276670e-01,  5.035383837e-01,  5.088301425e-01,
-      5.141027442e-01,  5.193559902e-01,  5.245896827e-01,  5.298036247e-01,
-      5.349976199e-01,  5.401714727e-01,  5.453249884e-01,  5.504579729e-01,
-      5.555702330e-01,  5.606615762e-01,  5.657318108e-01,  5.707807459e-01,
-      5.758081914e-01,  5.808139581e-01,  5.857978575e-01,  5.907597019e-01,
-      5.956993045e-01,  6.006164794e-01,  6.055110414e-01,  6.103828063e-01,
-      6.152315906e-01,  6.200572118e-01,  6.248594881e-01,  6.296382389e-01,
-      6.343932842e-01,  6.391244449e-01,  6.438315429e-01,  6.485144010e-01,
-      6.531728430e-01,  6.578066933e-01,  6.624157776e-01,  6.669999223e-01,
-      6.715589548e-01,  6.760927036e-01,  6.806009978e-01,  6.850836678e-01,
-      6.895405447e-01,  6.939714609e-01,  6.983762494e-01,  7.027547445e-01,
-      7.071067812e-01,  7.114321957e-01,  7.157308253e-01,  7.200025080e-01,
-      7.242470830e-01,  7.284643904e-01,  7.326542717e-01,  7.368165689e-01,
-      7.409511254e-01,  7.450577854e-01,  7.491363945e-01,  7.531867990e-01,
-      7.572088465e-01,  7.612023855e-01,  7.651672656e-01,  7.691033376e-01,
-      7.730104534e-01,  7.768884657e-01,  7.807372286e-01,  7.845565972e-01,
-      7.883464276e-01,  7.921065773e-01,  7.958369046e-01,  7.995372691e-01,
-      8.032075315e-01,  8.068475535e-01,  8.104571983e-01,  8.140363297e-01,
-      8.175848132e-01,  8.211025150e-01,  8.245893028e-01,  8.280450453e-01,
-      8.314696123e-01,  8.348628750e-01,  8.382247056e-01,  8.415549774e-01,
-      8.448535652e-01,  8.481203448e-01,  8.513551931e-01,  8.545579884e-01,
-      8.577286100e-01,  8.608669386e-01,  8.639728561e-01,  8.670462455e-01,
-      8.700869911e-01,  8.730949784e-01,  8.760700942e-01,  8.790122264e-01,
-      8.819212643e-01,  8.847970984e-01,  8.876396204e-01,  8.904487232e-01,
-      8.932243012e-01,  8.959662498e-01,  8.986744657e-01,  9.013488470e-01,
-      9.039892931e-01,  9.065957045e-01,  9.091679831e-01,  9.117060320e-01,
-      9.142097557e-01,  9.166790599e-01,  9.191138517e-01,  9.215140393e-01,
-      9.238795325e-01,  9.262102421e-01,  9.285060805e-01,  9.307669611e-01,
-      9.329927988e-01,  9.351835099e-01,  9.373390119e-01,  9.394592236e-01,
-      9.415440652e-01,  9.435934582e-01,  9.456073254e-01,  9.475855910e-01,
-      9.495281806e-01,  9.514350210e-01,  9.533060404e-01,  9.551411683e-01,
-      9.569403357e-01,  9.587034749e-01,  9.604305194e-01,  9.621214043e-01,
-      9.637760658e-01,  9.653944417e-01,  9.669764710e-01,  9.685220943e-01,
-      9.700312532e-01,  9.715038910e-01,  9.729399522e-01,  9.743393828e-01,
-      9.757021300e-01,  9.770281427e-01,  9.783173707e-01,  9.795697657e-01,
-      9.807852804e-01,  9.819638691e-01,  9.831054874e-01,  9.842100924e-01,
-      9.852776424e-01,  9.863080972e-01,  9.873014182e-01,  9.882575677e-01,
-      9.891765100e-01,  9.900582103e-01,  9.909026354e-01,  9.917097537e-01,
-      9.924795346e-01,  9.932119492e-01,  9.939069700e-01,  9.945645707e-01,
-      9.951847267e-01,  9.957674145e-01,  9.963126122e-01,  9.968202993e-01,
-      9.972904567e-01,  9.977230666e-01,  9.981181129e-01,  9.984755806e-01,
-      9.987954562e-01,  9.990777278e-01,  9.993223846e-01,  9.995294175e-01,
-      9.996988187e-01,  9.998305818e-01,  9.999247018e-01,  9.999811753e-01,
-      1.000000000e+00,  9.999811753e-01,  9.999247018e-01,  9.998305818e-01,
-      9.996988187e-01,  9.995294175e-01,  9.993223846e-01,  9.990777278e-01,
-      9.987954562e-01,  9.984755806e-01,  9.981181129e-01,  9.977230666e-01,
-      9.972904567e-01,  9.968202993e-01,  9.963126122e-01,  9.957674145e-01,
-      9.951847267e-01,  9.945645707e-01,  9.939069700e-01,  9.932119492e-01,
-      9.924795346e-01,  9.917097537e-01,  9.909026354e-01,  9.900582103e-01,
-      9.891765100e-01,  9.882575677e-01,  9.873014182e-01,  9.863080972e-01,
-      9.852776424e-01,  9.842100924e-01,  9.831054874e-01,  9.819638691e-01,
-      9.807852804e-01,  9.795697657e-01,  9.783173707e-01,  9.770281427e-01,
-      9.757021300e-01,  9.743393828e-01,  9.729399522e-01,  9.715038910e-01,
-      9.700312532e-01,  9.685220943e-01,  9.669764710e-01,  9.653944417e-01,
-      9.637760658e-01,  9.621214043e-01,  9.604305194e-01,  9.587034749e-01,
-      9.569403357e-01,  9.551411683e-01,  9.533060404e-01,  9.514350210e-01,
-      9.495281806e-01,  9.475855910e-01,  9.456073254e-01,  9.435934582e-01,
-      9.415440652e-01,  9.394592236e-01,  9.373390119e-01,  9.351835099e-01,
-      9.329927988e-01,  9.307669611e-01,  9.285060805e-01,  9.262102421e-01,
-      9.238795325e-01,  9.215140393e-01,  9.191138517e-01,  9.166790599e-01,
-      9.142097557e-01,  9.117060320e-01,  9.091679831e-01,  9.065957045e-01,
-      9.039892931e-01,  9.013488470e-01,  8.986744657e-01,  8.959662498e-01,
-      8.932243012e-01,  8.904487232e-01,  8.876396204e-01,  8.847970984e-01,
-      8.819212643e-01,  8.790122264e-01,  8.760700942e-01,  8.730949784e-01,
-      8.700869911e-01,  8.670462455e-01,  8.639728561e-01,  8.608669386e-01,
-      8.577286100e-01,  8.545579884e-01,  8.513551931e-01,  8.481203448e-01,
-      8.448535652e-01,  8.415549774e-01,  8.382247056e-01,  8.348628750e-01,
-      8.314696123e-01,  8.280450453e-01,  8.245893028e-01,  8.211025150e-01,
-      8.175848132e-01,  8.140363297e-01,  8.104571983e-01,  8.068475535e-01,
-      8.032075315e-01,  7.995372691e-01,  7.958369046e-01,  7.921065773e-01,
-      7.883464276e-01,  7.845565972e-01,  7.807372286e-01,  7.768884657e-01,
-      7.730104534e-01,  7.691033376e-01,  7.651672656e-01,  7.612023855e-01,
-      7.572088465e-01,  7.531867990e-01,  7.491363945e-01,  7.450577854e-01,
-      7.409511254e-01,  7.368165689e-01,  7.326542717e-01,  7.284643904e-01,
-      7.242470830e-01,  7.200025080e-01,  7.157308253e-01,  7.114321957e-01,
-      7.071067812e-01,  7.027547445e-01,  6.983762494e-01,  6.939714609e-01,
-      6.895405447e-01,  6.850836678e-01,  6.806009978e-01,  6.760927036e-01,
-      6.715589548e-01,  6.669999223e-01,  6.624157776e-01,  6.578066933e-01,
-      6.531728430e-01,  6.485144010e-01,  6.438315429e-01,  6.391244449e-01,
-      6.343932842e-01,  6.296382389e-01,  6.248594881e-01,  6.200572118e-01,
-      6.152315906e-01,  6.103828063e-01,  6.055110414e-01,  6.006164794e-01,
-      5.956993045e-01,  5.907597019e-01,  5.857978575e-01,  5.808139581e-01,
-      5.758081914e-01,  5.707807459e-01,  5.657318108e-01,  5.606615762e-01,
-      5.555702330e-01,  5.504579729e-01,  5.453249884e-01,  5.401714727e-01,
-      5.349976199e-01,  5.298036247e-01,  5.245896827e-01,  5.193559902e-01,
-      5.141027442e-01,  5.088301425e-01,  5.035383837e-01,  4.982276670e-01,
-      4.928981922e-01,  4.875501601e-01,  4.821837721e-01,  4.767992301e-01,
-      4.713967368e-01,  4.659764958e-01,  4.605387110e-01,  4.550835871e-01,
-      4.496113297e-01,  4.441221446e-01,  4.386162385e-01,  4.330938189e-01,
-      4.275550934e-01,  4.220002708e-01,  4.164295601e-01,  4.108431711e-01,
-      4.052413140e-01,  3.996241998e-01,  3.939920401e-01,  3.883450467e-01,
-      3.826834324e-01,  3.770074102e-01,  3.713171940e-01,  3.656129978e-01,
-      3.598950365e-01,  3.541635254e-01,  3.484186802e-01,  3.426607173e-01,
-      3.368898534e-01,  3.311063058e-01,  3.253102922e-01,  3.195020308e-01,
-      3.136817404e-01,  3.078496400e-01,  3.020059493e-01,  2.961508882e-01,
-      2.902846773e-01,  2.844075372e-01,  2.785196894e-01,  2.726213554e-01,
-      2.667127575e-01,  2.607941179e-01,  2.548656596e-01,  2.489276057e-01,
-      2.429801799e-01,  2.370236060e-01,  2.310581083e-01,  2.250839114e-01,
-      2.191012402e-01,  2.131103199e-01,  2.071113762e-01,  2.011046348e-01,
-      1.950903220e-01,  1.890686641e-01,  1.830398880e-01,  1.770042204e-01,
-      1.709618888e-01,  1.649131205e-01,  1.588581433e-01,  1.527971853e-01,
-      1.467304745e-01,  1.406582393e-01,  1.345807085e-01,  1.284981108e-01,
-      1.224106752e-01,  1.163186309e-01,  1.102222073e-01,  1.041216339e-01,
-      9.801714033e-02,  9.190895650e-02,  8.579731234e-02,  7.968243797e-02,
-      7.356456360e-02,  6.744391956e-02,  6.132073630e-02,  5.519524435e-02,
-      4.906767433e-02,  4.293825693e-02,  3.680722294e-02,  3.067480318e-02,
-      2.454122852e-02,  1.840672991e-02,  1.227153829e-02,  6.135884649e-03,
-     -8.704110566e-18,
-   };
 
-   const float wav_sine_q[] = {
-     -1.000000000e+00, -9.999811753e-01, -9.999247018e-01, -9.998305818e-01,
-     -9.996988187e-01, -9.995294175e-01, -9.993223846e-01, -9.990777278e-01,
-     -9.987954562e-01, -9.984755806e-01, -9.981181129e-01, -9.977230666e-01,
-     -9.972904567e-01, -9.968202993e-01, -9.963126122e-01, -9.957674145e-01,
-     -9.951847267e-01, -9.945645707e-01, -9.939069700e-01, -9.932119492e-01,
-     -9.924795346e-01, -9.917097537e-01, -9.909026354e-01, -9.900582103e-01,
-     -9.891765100e-01, -9.882575677e-01, -9.873014182e-01, -9.863080972e-01,
-     -9.852776424e-01, -9.842100924e-01, -9.831054874e-01, -9.819638691e-01,
-     -9.807852804e-01, -9.795697657e-01, -9.783173707e-01, -9.770281427e-01,
-     -9.757021300e-01, -9.743393828e-01, -9.729399522e-01, -9.715038910e-01,
-     -9.700312532e-01, -9.685220943e-01, -9.669764710e-01, -9.653944417e-01,
-     -9.637760658e-01, -9.621214043e-01, -9.604305194e-01, -9.587034749e-01,
-     -9.569403357e-01, -9.551411683e-01, -9.533060404e-01, -9.514350210e-01,
-     -9.495281806e-01, -9.475855910e-01, -9.456073254e-01, -9.435934582e-01,
-     -9.415440652e-01, -9.394592236e-01, -9.373390119e-01, -9.351835099e-01,
-     -9.329927988e-01, -9.307669611e-01, -9.285060805e-01, -9.262102421e-01,
-     -9.238795325e-01, -9.215140393e-01, -9.191138517e-01, -9.166790599e-01,
-     -9.142097557e-01, -9.117060320e-01, -9.091679831e-01, -9.065957045e-01,
-     -9.039892931e-01, -9.013488470e-01, -8.986744657e-01, -8.959662498e-01,
-     -8.932243012e-01, -8.904487232e-01, -8.876396204e-01, -8.847970984e-01,
-     -8.819212643e-01, -8.790122264e-01, -8.760700942e-01, -8.730949784e-01,
-     -8.700869911e-01, -8.670462455e-01, -8.639728561e-01, -8.608669386e-01,
-     -8.577286100e-01, -8.545579884e-01, -8.513551931e-01, -8.481203448e-01,
-     -8.448535652e-01, -8.415549774e-01, -8.382247056e-01, -8.348628750e-01,
-     -8.314696123e-01, -8.280450453e-01, -8.245893028e-01, -8.211025150e-01,
-     -8.175848132e-01, -8.140363297e-01, -8.104571983e-01, -8.068475535e-01,
-     -8.032075315e-01, -7.995372691e-01, -7.958369046e-01, -7.921065773e-01,
-     -7.883464276e-01, -7.845565972e-01, -7.807372286e-01, -7.768884657e-01,
-     -7.730104534e-01, -7.691033376e-01, -7.651672656e-01, -7.612023855e-01,
-     -7.572088465e-01, -7.531867990e-01, -7.491363945e-01, -7.450577854e-01,
-     -7.409511254e-01, -7.368165689e-01, -7.326542717e-01, -7.284643904e-01,
-     -7.242470830e-01, -7.200025080e-01, -7.157308253e-01, -7.114321957e-01,
-     -7.071067812e-01, -7.027547445e-01, -6.983762494e-01, -6.939714609e-01,
-     -6.895405447e-01, -6.850836678e-01, -6.806009978e-01, -6.760927036e-01,
-     -6.715589548e-01, -6.669999223e-01, -6.624157776e-01, -6.578066933e-01,
-     -6.531728430e-01, -6.485144010e-01, -6.438315429e-01, -6.391244449e-01,
-     -6.343932842e-01, -6.296382389e-01, -6.248594881e-01, -6.200572118e-01,
-     -6.152315906e-01, -6.103828063e-01, -6.055110414e-01, -6.006164794e-01,
-     -5.956993045e-01, -5.907597019e-01, -5.857978575e-01, -5.808139581e-01,
-     -5.758081914e-01, -5.707807459e-01, -5.657318108e-01, -5.606615762e-01,
-     -5.555702330e-01, -5.504579729e-01, -5.453249884e-01, -5.401714727e-01,
-     -5.349976199e-01, -5.298036247e-01, -5.245896827e-01, -5.193559902e-01,
-     -5.141027442e-01, -5.088301425e-01, -5.035383837e-01, -4.982276670e-01,
-     -4.928981922e-01, -4.875501601e-01, -4.821837721e-01, -4.767992301e-01,
-     -4.713967368e-01, -4.659764958e-01, -4.605387110e-01, -4.550835871e-01,
-     -4.496113297e-01, -4.441221446e-01, -4.386162385e-01, -4.330938189e-01,
-     -4.275550934e-01, -4.220002708e-01, -4.164295601e-01, -4.108431711e-01,
-     -4.052413140e-01, -3.996241998e-01, -3.939920401e-01, -3.883450467e-01,
-     -3.826834324e-01, -3.770074102e-01, -3.713171940e-01, -3.656129978e-01,
-     -3.598950365e-01, -3.541635254e-01, -3.484186802e-01, -3.426607173e-01,
-     -3.368898534e-01, -3.311063058e-01, -3.253102922e-01, -3.195020308e-01,
-     -3.136817404e-01, -3.078496400e-01, -3.020059493e-01, -2.961508882e-01,
-     -2.902846773e-01, -2.844075372e-01, -2.785196894e-01, -2.726213554e-01,
-     -2.667127575e-01, -2.607941179e-01, -2.548656596e-01, -2.489276057e-01,
-     -2.429801799e-01, -2.370236060e-01, -2.310581083e-01, -2.250839114e-01,
-     -2.191012402e-01, -2.131103199e-01, -2.071113762e-01, -2.011046348e-01,
-     -1.950903220e-01, -1.890686641e-01, -1.830398880e-01, -1.770042204e-01,
-     -1.709618888e-01, -1.649131205e-01, -1.588581433e-01, -1.527971853e-01,
-     -1.467304745e-01, -1.406582393e-01, -1.345807085e-01, -1.284981108e-01,
-     -1.224106752e-01, -1.163186309e-01, -1.102222073e-01, -1.041216339e-01,
-     -9.801714033e-02, -9.190895650e-02, -8.579731234e-02, -7.968243797e-02,
-     -7.356456360e-02, -6.744391956e-02, -6.132073630e-02, -5.519524435e-02,
-     -4.906767433e-02, -4.293825693e-02, -3.680722294e-02, -3.067480318e-02,
-     -2.454122852e-02, -1.840672991e-02, -1.227153829e-02, -6.135884649e-03,
-     -3.627591754e-16,  6.135884649e-03,  1.227153829e-02,  1.840672991e-02,
-      2.454122852e-02,  3.067480318e-02,  3.680722294e-02,  4.293825693e-02,
-      4.906767433e-02,  5.519524435e-02,  6.132073630e-02,  6.744391956e-02,
-      7.356456360e-02,  7.968243797e-02,  8.579731234e-02,  9.190895650e-02,
-      9.801714033e-02,  1.041216339e-01,  1.102222073e-01,  1.163186309e-01,
-      1.224106752e-01,  1.284981108e-01,  1.345807085e-01,  1.406582393e-01,
-      1.467304745e-01,  1.527971853e-01,  1.588581433e-01,  1.649131205e-01,
-      1.709618888e-01,  1.770042204e-01,  1.830398880e-01,  1.890686641e-01,
-      1.950903220e-01,  2.011046348e-01,  2.071113762e-01,  2.131103199e-01,
-      2.191012402e-01,  2.250839114e-01,  2.310581083e-01,  2.370236060e-01,
-      2.429801799e-01,  2.489276057e-01,  2.548656596e-01,  2.607941179e-01,
-      2.667127575e-01,  2.726213554e-01,  2.785196894e-01,  2.844075372e-01,
-      2.902846773e-01,  2.961508882e-01,  3.020059493e-01,  3.078496400e-01,
-      3.136817404e-01,  3.195020308e-01,  3.253102922e-01,  3.311063058e-01,
-      3.368898534e-01,  3.426607173e-01,  3.484186802e-01,  3.541635254e-01,
-      3.598950365e-01,  3.656129978e-01,  3.713171940e-01,  3.770074102e-01,
-      3.826834324e-01,  3.883450467e-01,  3.939920401e-01,  3.996241998e-01,
-      4.052413140e-01,  4.108431711e-01,  4.164295601e-01,  4.220002708e-01,
-      4.275550934e-01,  4.330938189e-01,  4.386162385e-01,  4.441221446e-01,
-      4.496113297e-01,  4.550835871e-01,  4.605387110e-01,  4.659764958e-01,
-      4.713967368e-01,  4.767992301e-01,  4.821837721e-01,  4.875501601e-01,
-      4.928981922e-01,  4.982276670e-01,  5.035383837e-01,  5.088301425e-01,
-      5.141027442e-01,  5.193559902e-01,  5.245896827e-01,  5.298036247e-01,
-      5.349976199e-01,  5.401714727e-01,  5.453249884e-01,  5.504579729e-01,
-      5.555702330e-01,  5.606615762e-01,  5.657318108e-01,  5.707807459e-01,
-      5.758081914e-01,  5.808139581e-01,  5.857978575e-01,  5.907597019e-01,
-      5.956993045e-01,  6.006164794e-01,  6.055110414e-01,  6.103828063e-01,
-      6.152315906e-01,  6.200572118e-01,  6.248594881e-01,  6.296382389e-01,
-      6.343932842e-01,  6.391244449e-01,  6.438315429e-01,  6.485144010e-01,
-      6.531728430e-01,  6.578066933e-01,  6.624157776e-01,  6.669999223e-01,
-      6.715589548e-01,  6.760927036e-01,  6.806009978e-01,  6.850836678e-01,
-      6.895405447e-01,  6.939714609e-01,  6.983762494e-01,  7.027547445e-01,
-      7.071067812e-01,  7.114321957e-01,  7.157308253e-01,  7.200025080e-01,
-      7.242470830e-01,  7.284643904e-01,  7.326542717e-01,  7.368165689e-01,
-      7.409511254e-01,  7.450577854e-01,  7.491363945e-01,  7.531867990e-01,
-      7.572088465e-01,  7.612023855e-01,  7.651672656e-01,  7.691033376e-01,
-      7.730104534e-01,  7.768884657e-01,  7.807372286e-01,  7.845565972e-01,
-      7.883464276e-01,  7.921065773e-01,  7.958369046e-01,  7.995372691e-01,
-      8.032075315e-01,  8.068475535e-01,  8.104571983e-01,  8.140363297e-01,
-      8.175848132e-01,  8.211025150e-01,  8.245893028e-01,  8.280450453e-01,
-      8.314696123e-01,  8.348628750e-01,  8.382247056e-01,  8.415549774e-01,
-      8.448535652e-01,  8.481203448e-01,  8.513551931e-01,  8.545579884e-01,
-      8.577286100e-01,  8.608669386e-01,  8.639728561e-01,  8.670462455e-01,
-      8.700869911e-01,  8.730949784e-01,  8.760700942e-01,  8.790122264e-01,
-      8.819212643e-01,  8.847970984e-01,  8.876396204e-01,  8.904487232e-01,
-      8.932243012e-01,  8.959662498e-01,  8.986744657e-01,  9.013488470e-01,
-      9.039892931e-01,  9.065957045e-01,  9.091679831e-01,  9.117060320e-01,
-      9.142097557e-01,  9.166790599e-01,  9.191138517e-01,  9.215140393e-01,
-      9.238795325e-01,  9.262102421e-01,  9.285060805e-01,  9.307669611e-01,
-      9.329927988e-01,  9.351835099e-01,  9.373390119e-01,  9.394592236e-01,
-      9.415440652e-01,  9.435934582e-01,  9.456073254e-01,  9.475855910e-01,
-      9.495281806e-01,  9.514350210e-01,  9.533060404e-01,  9.551411683e-01,
-      9.569403357e-01,  9.587034749e-01,  9.604305194e-01,  9.621214043e-01,
-      9.637760658e-01,  9.653944417e-01,  9.669764710e-01,  9.685220943e-01,
-      9.700312532e-01,  9.715038910e-01,  9.729399522e-01,  9.743393828e-01,
-      9.757021300e-01,  9.770281427e-01,  9.783173707e-01,  9.795697657e-01,
-      9.807852804e-01,  9.819638691e-01,  9.831054874e-01,  9.842100924e-01,
-      9.852776424e-01,  9.863080972e-01,  9.873014182e-01,  9.882575677e-01,
-      9.891765100e-01,  9.900582103e-01,  9.909026354e-01,  9.917097537e-01,
-      9.924795346e-01,  9.932119492e-01,  9.939069700e-01,  9.945645707e-01,
-      9.951847267e-01,  9.957674145e-01,  9.963126122e-01,  9.968202993e-01,
-      9.972904567e-01,  9.977230666e-01,  9.981181129e-01,  9.984755806e-01,
-      9.987954562e-01,  9.990777278e-01,  9.993223846e-01,  9.995294175e-01,
-      9.996988187e-01,  9.998305818e-01,  9.999247018e-01,  9.999811753e-01,
-      1.000000000e+00,  9.999811753e-01,  9.999247018e-01,  9.998305818e-01,
-      9.996988187e-01,  9.995294175e-01,  9.993223846e-01,  9.990777278e-01,
-      9.987954562e-01,  9.984755806e-01,  9.981181129e-01,  9.977230666e-01,
-      9.972904567e-01,  9.968202993e-01,  9.963126122e-01,  9.957674145e-01,
-      9.951847267e-01,  9.945645707e-01,  9.939069700e-01,  9.932119492e-01,
-      9.924795346e-01,  9.917097537e-01,  9.909026354e-01,  9.900582103e-01,
-      9.891765100e-01,  9.882575677e-01,  9.873014182e-01,  9.863080972e-01,
-      9.852776424e-01,  9.842100924e-01,  9.831054874e-01,  9.819638691e-01,
-      9.807852804e-01,  9.795697657e-01,  9.783173707e-01,  9.770281427e-01,
-      9.757021300e-01,  9.743393828e-01,  9.729399522e-01,  9.715038910e-01,
-      9.700312532e-01,  9.685220943e-01,  9.669764710e-01,  9.653944417e-01,
-      9.637760658e-01,  9.621214043e-01,  9.604305194e-01,  9.587034749e-01,
-      9.569403357e-01,  9.551411683e-01,  9.533060404e-01,  9.514350210e-01,
-      9.495281806e-01,  9.475855910e-01,  9.456073254e-01,  9.435934582e-01,
-      9.415440652e-01,  9.394592236e-01,  9.373390119e-01,  9.351835099e-01,
-      9.329927988e-01,  9.307669611e-01,  9.285060805e-01,  9.262102421e-01,
-      9.238795325e-01,  9.215140393e-01,  9.191138517e-01,  9.166790599e-01,
-      9.142097557e-01,  9.117060320e-01,  9.091679831e-01,  9.065957045e-01,
-      9.039892931e-01,  9.013488470e-01,  8.986744657e-01,  8.959662498e-01,
-      8.932243012e-01,  8.904487232e-01,  8.876396204e-01,  8.847970984e-01,
-      8.819212643e-01,  8.790122264e-01,  8.760700942e-01,  8.730949784e-01,
-      8.700869911e-01,  8.670462455e-01,  8.639728561e-01,  8.608669386e-01,
-      8.577286100e-01,  8.545579884e-01,  8.513551931e-01,  8.481203448e-01,
-      8.448535652e-01,  8.415549774e-01,  8.382247056e-01,  8.348628750e-01,
-      8.314696123e-01,  8.280450453e-01,  8.245893028e-01,  8.211025150e-01,
-      8.175848132e-01,  8.140363297e-01,  8.104571983e-01,  8.068475535e-01,
-      8.032075315e-01,  7.995372691e-01,  7.958369046e-01,  7.921065773e-01,
-      7.883464276e-01,  7.845565972e-01,  7.807372286e-01,  7.768884657e-01,
-      7.730104534e-01,  7.691033376e-01,  7.651672656e-01,  7.612023855e-01,
-      7.572088465e-01,  7.531867990e-01,  7.491363945e-01,  7.450577854e-01,
-      7.409511254e-01,  7.368165689e-01,  7.326542717e-01,  7.284643904e-01,
-      7.242470830e-01,  7.200025080e-01,  7.157308253e-01,  7.114321957e-01,
-      7.071067812e-01,  7.027547445e-01,  6.983762494e-01,  6.939714609e-01,
-      6.895405447e-01,  6.850836678e-01,  6.806009978e-01,  6.760927036e-01,
-      6.715589548e-01,  6.669999223e-01,  6.624157776e-01,  6.578066933e-01,
-      6.531728430e-01,  6.485144010e-01,  6.438315429e-01,  6.391244449e-01,
-      6.343932842e-01,  6.296382389e-01,  6.248594881e-01,  6.200572118e-01,
-      6.152315906e-01,  6.103828063e-01,  6.055110414e-01,  6.006164794e-01,
-      5.956993045e-01,  5.907597019e-01,  5.857978575e-01,  5.808139581e-01,
-      5.758081914e-01,  5.707807459e-01,  5.657318108e-01,  5.606615762e-01,
-      5.555702330e-01,  5.504579729e-01,  5.453249884e-01,  5.401714727e-01,
-      5.349976199e-01,  5.298036247e-01,  5.245896827e-01,  5.193559902e-01,
-      5.141027442e-01,  5.088301425e-01,  5.035383837e-01,  4.982276670e-01,
-      4.928981922e-01,  4.875501601e-01,  4.821837721e-01,  4.767992301e-01,
-      4.713967368e-01,  4.659764958e-01,  4.605387110e-01,  4.550835871e-01,
-      4.496113297e-01,  4.441221446e-01,  4.386162385e-01,  4.330938189e-01,
-      4.275550934e-01,  4.220002708e-01,  4.164295601e-01,  4.108431711e-01,
-      4.052413140e-01,  3.996241998e-01,  3.939920401e-01,  3.883450467e-01,
-      3.826834324e-01,  3.770074102e-01,  3.713171940e-01,  3.656129978e-01,
-      3.598950365e-01,  3.541635254e-01,  3.484186802e-01,  3.426607173e-01,
-      3.368898534e-01,  3.311063058e-01,  3.253102922e-01,  3.195020308e-01,
-      3.136817404e-01,  3.078496400e-01,  3.020059493e-01,  2.961508882e-01,
-      2.902846773e-01,  2.844075372e-01,  2.785196894e-01,  2.726213554e-01,
-      2.667127575e-01,  2.607941179e-01,  2.548656596e-01,  2.489276057e-01,
-      2.429801799e-01,  2.370236060e-01,  2.310581083e-01,  2.250839114e-01,
-      2.191012402e-01,  2.131103199e-01,  2.071113762e-01,  2.011046348e-01,
-      1.950903220e-01,  1.890686641e-01,  1.830398880e-01,  1.770042204e-01,
-      1.709618888e-01,  1.649131205e-01,  1.588581433e-01,  1.527971853e-01,
-      1.467304745e-01,  1.406582393e-01,  1.345807085e-01,  1.284981108e-01,
-      1.224106752e-01,  1.163186309e-01,  1.102222073e-01,  1.041216339e-01,
-      9.801714033e-02,  9.190895650e-02,  8.579731234e-02,  7.968243797e-02,
-      7.356456360e-02,  6.744391956e-02,  6.132073630e-02,  5.519524435e-02,
-      4.906767433e-02,  4.293825693e-02,  3.680722294e-02,  3.067480318e-02,
-      2.454122852e-02,  1.840672991e-02,  1.227153829e-02,  6.135884649e-03,
-      4.261138617e-16, -6.135884649e-03, -1.227153829e-02, -1.840672991e-02,
-     -2.454122852e-02, -3.067480318e-02, -3.680722294e-02, -4.293825693e-02,
-     -4.906767433e-02, -5.519524435e-02, -6.132073630e-02, -6.744391956e-02,
-     -7.356456360e-02, -7.968243797e-02, -8.579731234e-02, -9.190895650e-02,
-     -9.801714033e-02, -1.041216339e-01, -1.102222073e-01, -1.163186309e-01,
-     -1.224106752e-01, -1.284981108e-01, -1.345807085e-01, -1.406582393e-01,
-     -1.467304745e-01, -1.527971853e-01, -1.588581433e-01, -1.649131205e-01,
-     -1.709618888e-01, -1.770042204e-01, -1.830398880e-01, -1.890686641e-01,
-     -1.950903220e-01, -2.011046348e-01, -2.071113762e-01, -2.131103199e-01,
-     -2.191012402e-01, -2.250839114e-01, -2.310581083e-01, -2.370236060e-01,
-     -2.429801799e-01, -2.489276057e-01, -2.548656596e-01, -2.607941179e-01,
-     -2.667127575e-01, -2.726213554e-01, -2.785196894e-01, -2.844075372e-01,
-     -2.902846773e-01, -2.961508882e-01, -3.020059493e-01, -3.078496400e-01,
-     -3.136817404e-01, -3.195020308e-01, -3.253102922e-01, -3.311063058e-01,
-     -3.368898534e-01, -3.426607173e-01, -3.484186802e-01, -3.541635254e-01,
-     -3.598950365e-01, -3.656129978e-01, -3.713171940e-01, -3.770074102e-01,
-     -3.826834324e-01, -3.883450467e-01, -3.939920401e-01, -3.996241998e-01,
-     -4.052413140e-01, -4.108431711e-01, -4.164295601e-01, -4.220002708e-01,
-     -4.275550934e-01, -4.330938189e-01, -4.386162385e-01, -4.441221446e-01,
-     -4.496113297e-01, -4.550835871e-01, -4.605387110e-01, -4.659764958e-01,
-     -4.713967368e-01, -4.767992301e-01, -4.821837721e-01, -4.875501601e-01,
-     -4.928981922e-01, -4.982276670e-01, -5.035383837e-01, -5.088301425e-01,
-     -5.141027442e-01, -5.193559902e-01, -5.245896827e-01, -5.298036247e-01,
-     -5.349976199e-01, -5.401714727e-01, -5.453249884e-01, -5.504579729e-01,
-     -5.555702330e-01, -5.606615762e-01, -5.657318108e-01, -5.707807459e-01,
-     -5.758081914e-01, -5.808139581e-01, -5.857978575e-01, -5.907597019e-01,
-     -5.956993045e-01, -6.006164794e-01, -6.055110414e-01, -6.103828063e-01,
-     -6.152315906e-01, -6.200572118e-01, -6.248594881e-01, -6.296382389e-01,
-     -6.343932842e-01, -6.391244449e-01, -6.438315429e-01, -6.485144010e-01,
-     -6.531728430e-01, -6.578066933e-01, -6.624157776e-01, -6.669999223e-01,
-     -6.715589548e-01, -6.760927036e-01, -6.806009978e-01, -6.850836678e-01,
-     -6.895405447e-01, -6.939714609e-01, -6.983762494e-01, -7.027547445e-01,
-     -7.071067812e-01, -7.114321957e-01, -7.157308253e-01, -7.200025080e-01,
-     -7.242470830e-01, -7.284643904e-01, -7.326542717e-01, -7.368165689e-01,
-     -7.409511254e-01, -7.450577854e-01, -7.491363945e-01, -7.531867990e-01,
-     -7.572088465e-01, -7.612023855e-01, -7.651672656e-01, -7.691033376e-01,
-     -7.730104534e-01, -7.768884657e-01, -7.807372286e-01, -7.845565972e-01,
-     -7.883464276e-01, -7.921065773e-01, -7.958369046e-01, -7.995372691e-01,
-     -8.032075315e-01, -8.068475535e-01, -8.104571983e-01, -8.140363297e-01,
-     -8.175848132e-01, -8.211025150e-01, -8.245893028e-01, -8.280450453e-01,
-     -8.314696123e-01, -8.348628750e-01, -8.382247056e-01, -8.415549774e-01,
-     -8.448535652e-01, -8.481203448e-01, -8.513551931e-01, -8.545579884e-01,
-     -8.577286100e-01, -8.608669386e-01, -8.639728561e-01, -8.670462455e-01,
-     -8.700869911e-01, -8.730949784e-01, -8.760700942e-01, -8.790122264e-01,
-     -8.819212643e-01, -8.847970984e-01, -8.876396204e-01, -8.904487232e-01,
-     -8.932243012e-01, -8.959662498e-01, -8.986744657e-01, -9.013488470e-01,
-     -9.039892931e-01, -9.065957045e-01, -9.091679831e-01, -9.117060320e-01,
-     -9.142097557e-01, -9.166790599e-01, -9.191138517e-01, -9.215140393e-01,
-     -9.238795325e-01, -9.262102421e-01, -9.285060805e-01, -9.307669611e-01,
-     -9.329927988e-01, -9.351835099e-01, -9.373390119e-01, -9.394592236e-01,
-     -9.415440652e-01, -9.435934582e-01, -9.456073254e-01, -9.475855910e-01,
-     -9.495281806e-01, -9.514350210e-01, -9.533060404e-01, -9.551411683e-01,
-     -9.569403357e-01, -9.587034749e-01, -9.604305194e-01, -9.621214043e-01,
-     -9.637760658e-01, -9.653944417e-01, -9.669764710e-01, -9.685220943e-01,
-     -9.700312532e-01, -9.715038910e-01, -9.729399522e-01, -9.743393828e-01,
-     -9.757021300e-01, -9.770281427e-01, -9.783173707e-01, -9.795697657e-01,
-     -9.807852804e-01, -9.819638691e-01, -9.831054874e-01, -9.842100924e-01,
-     -9.852776424e-01, -9.863080972e-01, -9.873014182e-01, -9.882575677e-01,
-     -9.891765100e-01, -9.900582103e-01, -9.909026354e-01, -9.917097537e-01,
-     -9.924795346e-01, -9.932119492e-01, -9.939069700e-01, -9.945645707e-01,
-     -9.951847267e-01, -9.957674145e-01, -9.963126122e-01, -9.968202993e-01,
-     -9.972904567e-01, -9.977230666e-01, -9.981181129e-01, -9.984755806e-01,
-     -9.987954562e-01, -9.990777278e-01, -9.993223846e-01, -9.995294175e-01,
-     -9.996988187e-01, -9.998305818e-01, -9.999247018e-01, -9.999811753e-01,
-     -1.000000000e+00,
-   };
 
-   const float wav_harmonics_i[] = {
-     -2.478929878e-19,  1.715531411e-03,  3.423631606e-03,  5.116876885e-03,
-      6.787858584e-03,  8.429190567e-03,  1.003351671e-02,  1.159351833e-02,
-      1.310192162e-02,  1.455150503e-02,  1.593510654e-02,  1.724563095e-02,
-      1.847605712e-02,  1.961944502e-02,  2.066894285e-02,  2.161779397e-02,
-      2.245934381e-02,  2.318704662e-02,  2.379447218e-02,  2.427531232e-02,
-      2.462338744e-02,  2.483265278e-02,  2.489720467e-02,  2.481128656e-02,
-      2.456929495e-02,  2.416578521e-02,  2.359547718e-02,  2.285326066e-02,
-      2.193420069e-02,  2.083354276e-02,  1.954671772e-02,  1.806934664e-02,
-      1.639724537e-02,  1.452642902e-02,  1.245311616e-02,  1.017373293e-02,
-      7.684916836e-03,  4.983520421e-03,  2.066614721e-03, -1.068507503e-03,
-     -4.424328739e-03, -8.003103907e-03, -1.180685776e-02, -1.583738252e-02,
-     -2.009623570e-02, -2.458473818e-02, -2.930397250e-02, -3.425478139e-02,
-     -3.943776648e-02, -4.485328735e-02, -5.050146065e-02, -5.638215961e-02,
-     -6.249501367e-02, -6.883940840e-02, -7.541448566e-02, -8.221914393e-02,
-     -8.925203892e-02, -9.651158443e-02, -1.039959534e-01, -1.117030792e-01,
-     -1.196306572e-01, -1.277761463e-01, -1.361367714e-01, -1.447095251e-01,
-     -1.534911702e-01, -1.624782427e-01, -1.716670543e-01, -1.810536956e-01,
-     -1.906340394e-01, -2.004037442e-01, -2.103582579e-01, -2.204928215e-01,
-     -2.308024736e-01, -2.412820545e-01, -2.519262106e-01, -2.627293992e-01,
-     -2.736858931e-01, -2.847897863e-01, -2.960349984e-01, -3.074152803e-01,
-     -3.189242201e-01, -3.305552482e-01, -3.423016434e-01, -3.541565393e-01,
-     -3.661129295e-01, -3.781636749e-01, -3.903015095e-01, -4.025190469e-01,
-     -4.148087873e-01, -4.271631241e-01, -4.395743507e-01, -4.520346673e-01,
-     -4.645361886e-01, -4.770709500e-01, -4.896309157e-01, -5.022079855e-01,
-     -5.147940021e-01, -5.273807589e-01, -5.399600071e-01, -5.525234636e-01,
-     -5.650628180e-01, -5.775697407e-01, -5.900358903e-01, -6.024529211e-01,
-     -6.148124909e-01, -6.271062687e-01, -6.393259421e-01, -6.514632249e-01,
-     -6.635098650e-01, -6.754576517e-01, -6.872984234e-01, -6.990240749e-01,
-     -7.106265649e-01, -7.220979236e-01, -7.334302598e-01, -7.446157683e-01,
-     -7.556467367e-01, -7.665155533e-01, -7.772147133e-01, -7.877368261e-01,
-     -7.980746222e-01, -8.082209594e-01, -8.181688303e-01, -8.279113678e-01,
-     -8.374418521e-01, -8.467537166e-01, -8.558405540e-01, -8.646961224e-01,
-     -8.733143510e-01, -8.816893456e-01, -8.898153941e-01, -8.976869720e-01,
-     -9.052987473e-01, -9.126455855e-01, -9.197225544e-01, -9.265249287e-01,
-     -9.330481943e-01, -9.392880528e-01, -9.452404250e-01, -9.509014551e-01,
-     -9.562675143e-01, -9.613352037e-01, -9.661013583e-01, -9.705630493e-01,
-     -9.747175871e-01, -9.785625236e-01, -9.820956551e-01, -9.853150237e-01,
-     -9.882189194e-01, -9.908058819e-01, -9.930747019e-01, -9.950244221e-01,
-     -9.966543385e-01, -9.979640005e-01, -9.989532121e-01, -9.996220316e-01,
-     -9.999707719e-01, -1.000000000e+00, -9.997105368e-01, -9.991034563e-01,
-     -9.981800847e-01, -9.969419989e-01, -9.953910257e-01, -9.935292398e-01,
-     -9.913589620e-01, -9.888827571e-01, -9.861034316e-01, -9.830240314e-01,
-     -9.796478387e-01, -9.759783691e-01, -9.720193688e-01, -9.677748106e-01,
-     -9.632488910e-01, -9.584460257e-01, -9.533708460e-01, -9.480281947e-01,
-     -9.424231212e-01, -9.365608775e-01, -9.304469131e-01, -9.240868699e-01,
-     -9.174865775e-01, -9.106520476e-01, -9.035894686e-01, -8.963051999e-01,
-     -8.888057662e-01, -8.810978518e-01, -8.731882937e-01, -8.650840766e-01,
-     -8.567923253e-01, -8.483202991e-01, -8.396753849e-01, -8.308650903e-01,
-     -8.218970370e-01, -8.127789538e-01, -8.035186697e-01, -7.941241064e-01,
-     -7.846032715e-01, -7.749642509e-01, -7.652152017e-01, -7.553643448e-01,
-     -7.454199572e-01, -7.353903645e-01, -7.252839336e-01, -7.151090649e-01,
-     -7.048741847e-01, -6.945877375e-01, -6.842581785e-01, -6.738939660e-01,
-     -6.635035532e-01, -6.530953814e-01, -6.426778714e-01, -6.322594168e-01,
-     -6.218483758e-01, -6.114530638e-01, -6.010817459e-01, -5.907426297e-01,
-     -5.804438574e-01, -5.701934989e-01, -5.599995442e-01, -5.498698966e-01,
-     -5.398123653e-01, -5.298346583e-01, -5.199443758e-01, -5.101490034e-01,
-     -5.004559050e-01, -4.908723165e-01, -4.814053395e-01, -4.720619346e-01,
-     -4.628489155e-01, -4.537729428e-01, -4.448405182e-01, -4.360579786e-01,
-     -4.274314906e-01, -4.189670451e-01, -4.106704521e-01, -4.025473352e-01,
-     -3.946031273e-01, -3.868430654e-01, -3.792721862e-01, -3.718953217e-01,
-     -3.647170952e-01, -3.577419171e-01, -3.509739815e-01, -3.444172620e-01,
-     -3.380755092e-01, -3.319522466e-01, -3.260507687e-01, -3.203741375e-01,
-     -3.149251804e-01, -3.097064877e-01, -3.047204110e-01, -2.999690608e-01,
-     -2.954543053e-01, -2.911777690e-01, -2.871408316e-01, -2.833446269e-01,
-     -2.797900423e-01, -2.764777185e-01, -2.734080489e-01, -2.705811801e-01,
-     -2.679970119e-01, -2.656551979e-01, -2.635551463e-01, -2.616960204e-01,
-     -2.600767407e-01, -2.586959854e-01, -2.575521927e-01, -2.566435624e-01,
-     -2.559680578e-01, -2.555234087e-01, -2.553071133e-01, -2.553164411e-01,
-     -2.555484363e-01, -2.559999202e-01, -2.566674956e-01, -2.575475496e-01,
-     -2.586362577e-01, -2.599295879e-01, -2.614233047e-01, -2.631129738e-01,
-     -2.649939663e-01, -2.670614639e-01, -2.693104633e-01, -2.717357820e-01,
-     -2.743320628e-01, -2.770937800e-01, -2.800152445e-01, -2.830906097e-01,
-     -2.863138775e-01, -2.896789043e-01, -2.931794070e-01, -2.968089698e-01,
-     -3.005610499e-01, -3.044289847e-01, -3.084059983e-01, -3.124852080e-01,
-     -3.166596315e-01, -3.209221937e-01, -3.252657338e-01, -3.296830124e-01,
-     -3.341667187e-01, -3.387094778e-01, -3.433038580e-01, -3.479423782e-01,
-     -3.526175152e-01, -3.573217114e-01, -3.620473820e-01, -3.667869228e-01,
-     -3.715327174e-01, -3.762771451e-01, -3.810125881e-01, -3.857314392e-01,
-     -3.904261095e-01, -3.950890356e-01, -3.997126870e-01, -4.042895740e-01,
-     -4.088122547e-01, -4.132733424e-01, -4.176655133e-01, -4.219815131e-01,
-     -4.262141645e-01, -4.303563745e-01, -4.344011409e-01, -4.383415597e-01,
-     -4.421708318e-01, -4.458822695e-01, -4.494693033e-01, -4.529254885e-01,
-     -4.562445113e-01, -4.594201954e-01, -4.624465079e-01, -4.653175651e-01,
-     -4.680276390e-01, -4.705711623e-01, -4.729427341e-01, -4.751371257e-01,
-     -4.771492852e-01, -4.789743430e-01, -4.806076165e-01, -4.820446147e-01,
-     -4.832810428e-01, -4.843128067e-01, -4.851360166e-01, -4.857469916e-01,
-     -4.861422629e-01, -4.863185775e-01, -4.862729015e-01, -4.860024235e-01,
-     -4.855045568e-01, -4.847769429e-01, -4.838174532e-01, -4.826241919e-01,
-     -4.811954976e-01, -4.795299452e-01, -4.776263475e-01, -4.754837564e-01,
-     -4.731014642e-01, -4.704790044e-01, -4.676161524e-01, -4.645129257e-01,
-     -4.611695844e-01, -4.575866308e-01, -4.537648094e-01, -4.497051064e-01,
-     -4.454087486e-01, -4.408772028e-01, -4.361121746e-01, -4.311156065e-01,
-     -4.258896768e-01, -4.204367975e-01, -4.147596118e-01, -4.088609926e-01,
-     -4.027440391e-01, -3.964120745e-01, -3.898686430e-01, -3.831175064e-01,
-     -3.761626407e-01, -3.690082328e-01, -3.616586762e-01, -3.541185674e-01,
-     -3.463927014e-01, -3.384860675e-01, -3.304038445e-01, -3.221513963e-01,
-     -3.137342664e-01, -3.051581731e-01, -2.964290044e-01, -2.875528120e-01,
-     -2.785358062e-01, -2.693843497e-01, -2.601049522e-01, -2.507042636e-01,
-     -2.411890686e-01, -2.315662797e-01, -2.218429313e-01, -2.120261727e-01,
-     -2.021232616e-01, -1.921415571e-01, -1.820885133e-01, -1.719716717e-01,
-     -1.617986547e-01, -1.515771578e-01, -1.413149429e-01, -1.310198309e-01,
-     -1.206996942e-01, -1.103624494e-01, -1.000160496e-01, -8.966847739e-02,
-     -7.932773687e-02, -6.900184633e-02, -5.869883061e-02, -4.842671352e-02,
-     -3.819351028e-02, -2.800721994e-02, -1.787581776e-02, -7.807247752e-03,
-      2.190584936e-03,  1.210982146e-02,  2.194265675e-02,  3.168134691e-02,
-      4.131821658e-02,  5.084566624e-02,  6.025617941e-02,  6.954232981e-02,
-      7.869678845e-02,  8.771233060e-02,  9.658184268e-02,  1.052983290e-01,
-      1.138549187e-01,  1.222448718e-01,  1.304615861e-01,  1.384986035e-01,
-      1.463496159e-01,  1.540084715e-01,  1.614691806e-01,  1.687259213e-01,
-      1.757730453e-01,  1.826050833e-01,  1.892167501e-01,  1.956029499e-01,
-      2.017587813e-01,  2.076795418e-01,  2.133607326e-01,  2.187980628e-01,
-      2.239874540e-01,  2.289250437e-01,  2.336071897e-01,  2.380304731e-01,
-      2.421917023e-01,  2.460879157e-01,  2.497163850e-01,  2.530746176e-01,
-      2.561603596e-01,  2.589715977e-01,  2.615065613e-01,  2.637637248e-01,
-      2.657418087e-01,  2.674397813e-01,  2.688568599e-01,  2.699925114e-01,
-      2.708464536e-01,  2.714186551e-01,  2.717093358e-01,  2.717189672e-01,
-      2.714482715e-01,  2.708982218e-01,  2.700700409e-01,  2.689652009e-01,
-      2.675854214e-01,  2.659326689e-01,  2.640091544e-01,  2.618173321e-01,
-      2.593598972e-01,  2.566397834e-01,  2.536601606e-01,  2.504244323e-01,
-      2.469362322e-01,  2.431994214e-01,  2.392180850e-01,  2.349965281e-01,
-      2.305392728e-01,  2.258510535e-01,  2.209368127e-01,  2.158016973e-01,
-      2.104510534e-01,  2.048904215e-01,  1.991255320e-01,  1.931622999e-01,
-      1.870068192e-01,  1.806653579e-01,  1.741443521e-01,  1.674504002e-01,
-      1.605902571e-01,  1.535708281e-01,  1.463991627e-01,  1.390824480e-01,
-      1.316280027e-01,  1.240432700e-01,  1.163358110e-01,  1.085132983e-01,
-      1.005835084e-01,  9.255431521e-02,  8.443368253e-02,  7.622965712e-02,
-      6.795036131e-02,  5.960398563e-02,  5.119878143e-02,  4.274305338e-02,
-      3.424515194e-02,  2.571346581e-02,  1.715641434e-02,  8.582439844e-03,
-      1.710740969e-16, -8.582439844e-03, -1.715641434e-02, -2.571346581e-02,
-     -3.424515194e-02, -4.274305338e-02, -5.119878143e-02, -5.960398563e-02,
-     -6.795036131e-02, -7.622965712e-02, -8.443368253e-02, -9.255431521e-02,
-     -1.005835084e-01, -1.085132983e-01, -1.163358110e-01, -1.240432700e-01,
-     -1.316280027e-01, -1.390824480e-01, -1.463991627e-01, -1.535708281e-01,
-     -1.605902571e-01, -1.674504002e-01, -1.741443521e-01, -1.806653579e-01,
-     -1.870068192e-01, -1.931622999e-01, -1.991255320e-01, -2.048904215e-01,
-     -2.104510534e-01, -2.158016973e-01, -2.209368127e-01, -2.258510535e-01,
-     -2.305392728e-01, -2.349965281e-01, -2.392180850e-01, -2.431994214e-01,
-     -2.469362322e-01, -2.504244323e-01, -2.536601606e-01, -2.566397834e-01,
-     -2.593598972e-01, -2.618173321e-01, -2.640091544e-01, -2.659326689e-01,
-     -2.675854214e-01, -2.689652009e-01, -2.700700409e-01, -2.708982218e-01,
-     -2.714482715e-01, -2.717189672e-01, -2.717093358e-01, -2.714186551e-01,
-     -2.708464536e-01, -2.699925114e-01, -2.688568599e-01, -2.674397813e-01,
-     -2.657418087e-01, -2.637637248e-01, -2.615065613e-01, -2.589715977e-01,
-     -2.561603596e-01, -2.530746176e-01, -2.497163850e-01, -2.460879157e-01,
-     -2.421917023e-01, -2.380304731e-01, -2.336071897e-01, -2.289250437e-01,
-     -2.239874540e-01, -2.187980628e-01, -2.133607326e-01, -2.076795418e-01,
-     -2.017587813e-01, -1.956029499e-01, -1.892167501e-01, -1.826050833e-01,
-     -1.757730453e-01, -1.687259213e-01, -1.614691806e-01, -1.540084715e-01,
-     -1.463496159e-01, -1.384986035e-01, -1.304615861e-01, -1.222448718e-01,
-     -1.138549187e-01, -1.052983290e-01, -9.658184268e-02, -8.771233060e-02,
-     -7.869678845e-02, -6.954232981e-02, -6.025617941e-02, -5.084566624e-02,
-     -4.131821658e-02, -3.168134691e-02, -2.194265675e-02, -1.210982146e-02,
-     -2.190584936e-03,  7.807247752e-03,  1.787581776e-02,  2.800721994e-02,
-      3.819351028e-02,  4.842671352e-02,  5.869883061e-02,  6.900184633e-02,
-      7.932773687e-02,  8.966847739e-02,  1.000160496e-01,  1.103624494e-01,
-      1.206996942e-01,  1.310198309e-01,  1.413149429e-01,  1.515771578e-01,
-      1.617986547e-01,  1.719716717e-01,  1.820885133e-01,  1.921415571e-01,
-      2.021232616e-01,  2.120261727e-01,  2.218429313e-01,  2.315662797e-01,
-      2.411890686e-01,  2.507042636e-01,  2.601049522e-01,  2.693843497e-01,
-      2.785358062e-01,  2.875528120e-01,  2.964290044e-01,  3.051581731e-01,
-      3.137342664e-01,  3.221513963e-01,  3.304038445e-01,  3.384860675e-01,
-      3.463927014e-01,  3.541185674e-01,  3.616586762e-01,  3.690082328e-01,
-      3.761626407e-01,  3.831175064e-01,  3.898686430e-01,  3.964120745e-01,
-      4.027440391e-01,  4.088609926e-01,  4.147596118e-01,  4.204367975e-01,
-      4.258896768e-01,  4.311156065e-01,  4.361121746e-01,  4.408772028e-01,
-      4.454087486e-01,  4.497051064e-01,  4.537648094e-01,  4.575866308e-01,
-      4.611695844e-01,  4.645129257e-01,  4.676161524e-01,  4.704790044e-01,
-      4.731014642e-01,  4.754837564e-01,  4.776263475e-01,  4.795299452e-01,
-      4.811954976e-01,  4.826241919e-01,  4.838174532e-01,  4.847769429e-01,
-      4.855045568e-01,  4.860024235e-01,  4.862729015e-01,  4.863185775e-01,
-      4.861422629e-01,  4.857469916e-01,  4.851360166e-01,  4.843128067e-01,
-      4.832810428e-01,  4.820446147e-01,  4.806076165e-01,  4.789743430e-01,
-      4.771492852e-01,  4.751371257e-01,  4.729427341e-01,  4.705711623e-01,
-      4.680276390e-01,  4.653175651e-01,  4.624465079e-01,  4.594201954e-01,
-      4.562445113e-01,  4.529254885e-01,  4.494693033e-01,  4.458822695e-01,
-      4.421708318e-01,  4.383415597e-01,  4.344011409e-01,  4.303563745e-01,
-      4.262141645e-01,  4.219815131e-01,  4.176655133e-01,  4.132733424e-01,
-      4.088122547e-01,  4.042895740e-01,  3.997126870e-01,  3.950890356e-01,
-      3.904261095e-01,  3.857314392e-01,  3.810125881e-01,  3.762771451e-01,
-      3.715327174e-01,  3.667869228e-01,  3.620473820e-01,  3.573217114e-01,
-      3.526175152e-01,  3.479423782e-01,  3.433038580e-01,  3.387094778e-01,
-      3.341667187e-01,  3.296830124e-01,  3.252657338e-01,  3.209221937e-01,
-      3.166596315e-01,  3.124852080e-01,  3.084059983e-01,  3.044289847e-01,
-      3.005610499e-01,  2.968089698e-01,  2.931794070e-01,  2.896789043e-01,
-      2.863138775e-01,  2.830906097e-01,  2.800152445e-01,  2.770937800e-01,
-      2.743320628e-01,  2.717357820e-01,  2.693104633e-01,  2.670614639e-01,
-      2.649939663e-01,  2.631129738e-01,  2.614233047e-01,  2.599295879e-01,
-      2.586362577e-01,  2.575475496e-01,  2.566674956e-01,  2.559999202e-01,
-      2.555484363e-01,  2.553164411e-01,  2.553071133e-01,  2.555234087e-01,
-      2.559680578e-01,  2.566435624e-01,  2.575521927e-01,  2.586959854e-01,
-      2.600767407e-01,  2.616960204e-01,  2.635551463e-01,  2.656551979e-01,
-      2.679970119e-01,  2.705811801e-01,  2.734080489e-01,  2.764777185e-01,
-      2.797900423e-01,  2.833446269e-01,  2.871408316e-01,  2.911777690e-01,
-      2.954543053e-01,  2.999690608e-01,  3.047204110e-01,  3.097064877e-01,
-      3.149251804e-01,  3.203741375e-01,  3.260507687e-01,  3.319522466e-01,
-      3.380755092e-01,  3.444172620e-01,  3.509739815e-01,  3.577419171e-01,
-      3.647170952e-01,  3.718953217e-01,  3.792721862e-01,  3.868430654e-01,
-      3.946031273e-01,  4.025473352e-01,  4.106704521e-01,  4.189670451e-01,
-      4.274314906e-01,  4.360579786e-01,  4.448405182e-01,  4.537729428e-01,
-      4.628489155e-01,  4.720619346e-01,  4.814053395e-01,  4.908723165e-01,
-      5.004559050e-01,  5.101490034e-01,  5.199443758e-01,  5.298346583e-01,
-      5.398123653e-01,  5.498698966e-01,  5.599995442e-01,  5.701934989e-01,
-      5.804438574e-01,  5.907426297e-01,  6.010817459e-01,  6.114530638e-01,
-      6.218483758e-01,  6.322594168e-01,  6.426778714e-01,  6.530953814e-01,
-      6.635035532e-01,  6.738939660e-01,  6.842581785e-01,  6.945877375e-01,
-      7.048741847e-01,  7.151090649e-01,  7.252839336e-01,  7.353903645e-01,
-      7.454199572e-01,  7.553643448e-01,  7.652152017e-01,  7.749642509e-01,
-      7.846032715e-01,  7.941241064e-01,  8.035186697e-01,  8.127789538e-01,
-      8.218970370e-01,  8.308650903e-01,  8.396753849e-01,  8.483202991e-01,
-      8.567923253e-01,  8.650840766e-01,  8.731882937e-01,  8.810978518e-01,
-      8.888057662e-01,  8.963051999e-01,  9.035894686e-01,  9.106520476e-01,
-      9.174865775e-01,  9.240868699e-01,  9.304469131e-01,  9.365608775e-01,
-      9.424231212e-01,  9.480281947e-01,  9.533708460e-01,  9.584460257e-01,
-      9.632488910e-01,  9.677748106e-01,  9.720193688e-01,  9.759783691e-01,
-      9.796478387e-01,  9.830240314e-01,  9.861034316e-01,  9.888827571e-01,
-      9.913589620e-01,  9.935292398e-01,  9.953910257e-01,  9.969419989e-01,
-      9.981800847e-01,  9.991034563e-01,  9.997105368e-01,  1.000000000e+00,
-      9.999707719e-01,  9.996220316e-01,  9.989532121e-01,  9.979640005e-01,
-      9.966543385e-01,  9.950244221e-01,  9.930747019e-01,  9.908058819e-01,
-      9.882189194e-01,  9.853150237e-01,  9.820956551e-01,  9.785625236e-01,
-      9.747175871e-01,  9.705630493e-01,  9.661013583e-01,  9.613352037e-01,
-      9.562675143e-01,  9.509014551e-01,  9.452404250e-01,  9.392880528e-01,
-      9.330481943e-01,  9.265249287e-01,  9.197225544e-01,  9.126455855e-01,
-      9.052987473e-01,  8.976869720e-01,  8.898153941e-01,  8.816893456e-01,
-      8.733143510e-01,  8.646961224e-01,  8.558405540e-01,  8.467537166e-01,
-      8.374418521e-01,  8.279113678e-01,  8.181688303e-01,  8.082209594e-01,
-      7.980746222e-01,  7.877368261e-01,  7.772147133e-01,  7.665155533e-01,
-      7.556467367e-01,  7.446157683e-01,  7.334302598e-01,  7.220979236e-01,
-      7.106265649e-01,  6.990240749e-01,  6.872984234e-01,  6.754576517e-01,
-      6.635098650e-01,  6.514632249e-01,  6.393259421e-01,  6.271062687e-01,
-      6.148124909e-01,  6.024529211e-01,  5.900358903e-01,  5.775697407e-01,
-      5.650628180e-01,  5.525234636e-01,  5.399600071e-01,  5.273807589e-01,
-      5.147940021e-01,  5.022079855e-01,  4.896309157e-01,  4.770709500e-01,
-      4.645361886e-01,  4.520346673e-01,  4.395743507e-01,  4.271631241e-01,
-      4.148087873e-01,  4.025190469e-01,  3.903015095e-01,  3.781636749e-01,
-      3.661129295e-01,  3.541565393e-01,  3.423016434e-01,  3.305552482e-01,
-      3.189242201e-01,  3.074152803e-01,  2.960349984e-01,  2.847897863e-01,
-      2.736858931e-01,  2.627293992e-01,  2.519262106e-01,  2.412820545e-01,
-      2.308024736e-01,  2.204928215e-01,  2.103582579e-01,  2.004037442e-01,
-      1.906340394e-01,  1.810536956e-01,  1.716670543e-01,  1.624782427e-01,
-      1.534911702e-01,  1.447095251e-01,  1.361367714e-01,  1.277761463e-01,
-      1.196306572e-01,  1.117030792e-01,  1.039959534e-01,  9.651158443e-02,
-      8.925203892e-02,  8.221914393e-02,  7.541448566e-02,  6.883940840e-02,
-      6.249501367e-02,  5.638215961e-02,  5.050146065e-02,  4.485328735e-02,
-      3.943776648e-02,  3.425478139e-02,  2.930397250e-02,  2.458473818e-02,
-      2.009623570e-02,  1.583738252e-02,  1.180685776e-02,  8.003103907e-03,
-      4.424328739e-03,  1.068507503e-03, -2.066614721e-03, -4.983520421e-03,
-     -7.684916836e-03, -1.017373293e-02, -1.245311616e-02, -1.452642902e-02,
-     -1.639724537e-02, -1.806934664e-02, -1.954671772e-02, -2.083354276e-02,
-     -2.193420069e-02, -2.285326066e-02, -2.359547718e-02, -2.416578521e-02,
-     -2.456929495e-02, -2.481128656e-02, -2.489720467e-02, -2.483265278e-02,
-     -2.462338744e-02, -2.427531232e-02, -2.379447218e-02, -2.318704662e-02,
-     -2.245934381e-02, -2.161779397e-02, -2.066894285e-02, -1.961944502e-02,
-     -1.847605712e-02, -1.724563095e-02, -1.593510654e-02, -1.455150503e-02,
-     -1.310192162e-02, -1.159351833e-02, -1.003351671e-02, -8.429190567e-03,
-     -6.787858584e-03, -5.116876885e-03, -3.423631606e-03, -1.715531411e-03,
-     -2.478929878e-19,
-   };
 
-   const float wav_harmonics_q[] = {
-     -5.595800846e-01, -5.596801473e-01, -5.599802150e-01, -5.604799268e-01,
-     -5.611786816e-01, -5.620756384e-01, -5.631697177e-01, -5.644596020e-01,
-     -5.659437373e-01, -5.676203347e-01, -5.694873717e-01, -5.715425948e-01,
-     -5.737835211e-01, -5.762074410e-01, -5.788114207e-01, -5.815923051e-01,
-     -5.845467208e-01, -5.876710795e-01, -5.909615812e-01, -5.944142179e-01,
-     -5.980247779e-01, -6.017888493e-01, -6.057018246e-01, -6.097589051e-01,
-     -6.139551055e-01, -6.182852586e-01, -6.227440206e-01, -6.273258760e-01,
-     -6.320251430e-01, -6.368359791e-01, -6.417523866e-01, -6.467682186e-01,
-     -6.518771847e-01, -6.570728573e-01, -6.623486777e-01, -6.676979625e-01,
-     -6.731139101e-01, -6.785896075e-01, -6.841180363e-01, -6.896920804e-01,
-     -6.953045323e-01, -7.009481004e-01, -7.066154159e-01, -7.122990400e-01,
-     -7.179914713e-01, -7.236851528e-01, -7.293724795e-01, -7.350458056e-01,
-     -7.406974522e-01, -7.463197146e-01, -7.519048698e-01, -7.574451839e-01,
-     -7.629329203e-01, -7.683603462e-01, -7.737197412e-01, -7.790034041e-01,
-     -7.842036608e-01, -7.893128718e-01, -7.943234396e-01, -7.992278159e-01,
-     -8.040185098e-01, -8.086880941e-01, -8.132292135e-01, -8.176345914e-01,
-     -8.218970370e-01, -8.260094527e-01, -8.299648411e-01, -8.337563114e-01,
-     -8.373770869e-01, -8.408205115e-01, -8.440800559e-01, -8.471493248e-01,
-     -8.500220626e-01, -8.526921603e-01, -8.551536610e-01, -8.574007663e-01,
-     -8.594278419e-01, -8.612294234e-01, -8.628002219e-01, -8.641351289e-01,
-     -8.652292222e-01, -8.660777705e-01, -8.666762380e-01, -8.670202897e-01,
-     -8.671057955e-01, -8.669288344e-01, -8.664856988e-01, -8.657728984e-01,
-     -8.647871637e-01, -8.635254499e-01, -8.619849395e-01, -8.601630462e-01,
-     -8.580574171e-01, -8.556659356e-01, -8.529867238e-01, -8.500181450e-01,
-     -8.467588049e-01, -8.432075542e-01, -8.393634897e-01, -8.352259555e-01,
-     -8.307945444e-01, -8.260690984e-01, -8.210497097e-01, -8.157367205e-01,
-     -8.101307236e-01, -8.042325621e-01, -7.980433294e-01, -7.915643678e-01,
-     -7.847972688e-01, -7.777438711e-01, -7.704062601e-01, -7.627867658e-01,
-     -7.548879614e-01, -7.467126614e-01, -7.382639192e-01, -7.295450248e-01,
-     -7.205595023e-01, -7.113111070e-01, -7.018038220e-01, -6.920418557e-01,
-     -6.820296374e-01, -6.717718144e-01, -6.612732477e-01, -6.505390078e-01,
-     -6.395743710e-01, -6.283848142e-01, -6.169760107e-01, -6.053538252e-01,
-     -5.935243087e-01, -5.814936936e-01, -5.692683878e-01, -5.568549698e-01,
-     -5.442601825e-01, -5.314909274e-01, -5.185542589e-01, -5.054573779e-01,
-     -4.922076255e-01, -4.788124769e-01, -4.652795343e-01, -4.516165209e-01,
-     -4.378312735e-01, -4.239317360e-01, -4.099259525e-01, -3.958220597e-01,
-     -3.816282803e-01, -3.673529156e-01, -3.530043379e-01, -3.385909834e-01,
-     -3.241213448e-01, -3.096039635e-01, -2.950474221e-01, -2.804603374e-01,
-     -2.658513518e-01, -2.512291264e-01, -2.366023330e-01, -2.219796467e-01,
-     -2.073697378e-01, -1.927812645e-01, -1.782228649e-01, -1.637031499e-01,
-     -1.492306948e-01, -1.348140324e-01, -1.204616451e-01, -1.061819573e-01,
-     -9.198332831e-02, -7.787404460e-02, -6.386231267e-02, -4.995625172e-02,
-     -3.616388648e-02, -2.249314013e-02, -8.951827325e-03,  4.452352754e-03,
-      1.771182314e-02,  3.081913577e-02,  4.376697805e-02,  5.654817927e-02,
-      6.915571694e-02,  8.158272290e-02,  9.382248936e-02,  1.058684748e-01,
-      1.177143097e-01,  1.293538020e-01,  1.407809425e-01,  1.519899103e-01,
-      1.629750777e-01,  1.737310148e-01,  1.842524947e-01,  1.945344977e-01,
-      2.045722157e-01,  2.143610560e-01,  2.238966459e-01,  2.331748356e-01,
-      2.421917023e-01,  2.509435532e-01,  2.594269288e-01,  2.676386053e-01,
-      2.755755980e-01,  2.832351628e-01,  2.906147992e-01,  2.977122518e-01,
-      3.045255124e-01,  3.110528209e-01,  3.172926675e-01,  3.232437927e-01,
-      3.289051892e-01,  3.342761015e-01,  3.393560271e-01,  3.441447159e-01,
-      3.486421705e-01,  3.528486460e-01,  3.567646490e-01,  3.603909369e-01,
-      3.637285169e-01,  3.667786452e-01,  3.695428244e-01,  3.720228028e-01,
-      3.742205721e-01,  3.761383649e-01,  3.777786527e-01,  3.791441432e-01,
-      3.802377771e-01,  3.810627256e-01,  3.816223868e-01,  3.819203820e-01,
-      3.819605526e-01,  3.817469556e-01,  3.812838599e-01,  3.805757419e-01,
-      3.796272809e-01,  3.784433547e-01,  3.770290344e-01,  3.753895799e-01,
-      3.735304341e-01,  3.714572179e-01,  3.691757246e-01,  3.666919142e-01,
-      3.640119076e-01,  3.611419806e-01,  3.580885577e-01,  3.548582059e-01,
-      3.514576284e-01,  3.478936579e-01,  3.441732502e-01,  3.403034772e-01,
-      3.362915204e-01,  3.321446634e-01,  3.278702855e-01,  3.234758543e-01,
-      3.189689183e-01,  3.143570999e-01,  3.096480882e-01,  3.048496310e-01,
-      2.999695282e-01,  2.950156236e-01,  2.899957978e-01,  2.849179603e-01,
-      2.797900423e-01,  2.746199890e-01,  2.694157518e-01,  2.641852809e-01,
-      2.589365177e-01,  2.536773871e-01,  2.484157900e-01,  2.431595960e-01,
-      2.379166353e-01,  2.326946921e-01,  2.275014965e-01,  2.223447172e-01,
-      2.172319548e-01,  2.121707339e-01,  2.071684963e-01,  2.022325940e-01,
-      1.973702818e-01,  1.925887112e-01,  1.878949228e-01,  1.832958402e-01,
-      1.787982631e-01,  1.744088613e-01,  1.701341679e-01,  1.659805734e-01,
-      1.619543200e-01,  1.580614948e-01,  1.543080252e-01,  1.506996725e-01,
-      1.472420268e-01,  1.439405018e-01,  1.408003294e-01,  1.378265555e-01,
-      1.350240344e-01,  1.323974249e-01,  1.299511857e-01,  1.276895713e-01,
-      1.256166281e-01,  1.237361904e-01,  1.220518774e-01,  1.205670890e-01,
-      1.192850037e-01,  1.182085746e-01,  1.173405278e-01,  1.166833588e-01,
-      1.162393312e-01,  1.160104742e-01,  1.159985806e-01,  1.162052056e-01,
-      1.166316655e-01,  1.172790360e-01,  1.181481519e-01,  1.192396061e-01,
-      1.205537493e-01,  1.220906897e-01,  1.238502932e-01,  1.258321835e-01,
-      1.280357426e-01,  1.304601114e-01,  1.331041912e-01,  1.359666443e-01,
-      1.390458955e-01,  1.423401340e-01,  1.458473152e-01,  1.495651626e-01,
-      1.534911702e-01,  1.576226052e-01,  1.619565105e-01,  1.664897079e-01,
-      1.712188011e-01,  1.761401792e-01,  1.812500200e-01,  1.865442945e-01,
-      1.920187700e-01,  1.976690149e-01,  2.034904030e-01,  2.094781178e-01,
-      2.156271575e-01,  2.219323398e-01,  2.283883071e-01,  2.349895317e-01,
-      2.417303211e-01,  2.486048239e-01,  2.556070354e-01,  2.627308033e-01,
-      2.699698340e-01,  2.773176986e-01,  2.847678395e-01,  2.923135761e-01,
-      2.999481124e-01,  3.076645426e-01,  3.154558586e-01,  3.233149565e-01,
-      3.312346437e-01,  3.392076458e-01,  3.472266139e-01,  3.552841316e-01,
-      3.633727223e-01,  3.714848567e-01,  3.796129599e-01,  3.877494190e-01,
-      3.958865905e-01,  4.040168075e-01,  4.121323879e-01,  4.202256411e-01,
-      4.282888760e-01,  4.363144087e-01,  4.442945696e-01,  4.522217108e-01,
-      4.600882144e-01,  4.678864992e-01,  4.756090284e-01,  4.832483170e-01,
-      4.907969392e-01,  4.982475357e-01,  5.055928207e-01,  5.128255893e-01,
-      5.199387248e-01,  5.269252052e-01,  5.337781103e-01,  5.404906290e-01,
-      5.470560652e-01,  5.534678452e-01,  5.597195236e-01,  5.658047902e-01,
-      5.717174758e-01,  5.774515588e-01,  5.830011706e-01,  5.883606020e-01,
-      5.935243087e-01,  5.984869167e-01,  6.032432280e-01,  6.077882253e-01,
-      6.121170777e-01,  6.162251450e-01,  6.201079829e-01,  6.237613471e-01,
-      6.271811977e-01,  6.303637036e-01,  6.333052460e-01,  6.360024227e-01,
-      6.384520510e-01,  6.406511715e-01,  6.425970510e-01,  6.442871854e-01,
-      6.457193025e-01,  6.468913644e-01,  6.478015696e-01,  6.484483554e-01,
-      6.488303992e-01,  6.489466204e-01,  6.487961819e-01,  6.483784908e-01,
-      6.476931993e-01,  6.467402058e-01,  6.455196548e-01,  6.440319376e-01,
-      6.422776917e-01,  6.402578009e-01,  6.379733947e-01,  6.354258474e-01,
-      6.326167774e-01,  6.295480458e-01,  6.262217551e-01,  6.226402471e-01,
-      6.188061017e-01,  6.147221343e-01,  6.103913936e-01,  6.058171590e-01,
-      6.010029378e-01,  5.959524624e-01,  5.906696866e-01,  5.851587830e-01,
-      5.794241384e-01,  5.734703507e-01,  5.673022246e-01,  5.609247673e-01,
-      5.543431842e-01,  5.475628743e-01,  5.405894254e-01,  5.334286088e-01,
-      5.260863747e-01,  5.185688465e-01,  5.108823155e-01,  5.030332350e-01,
-      4.950282150e-01,  4.868740155e-01,  4.785775412e-01,  4.701458346e-01,
-      4.615860701e-01,  4.529055474e-01,  4.441116847e-01,  4.352120120e-01,
-      4.262141645e-01,  4.171258756e-01,  4.079549695e-01,  3.987093547e-01,
-      3.893970163e-01,  3.800260089e-01,  3.706044491e-01,  3.611405086e-01,
-      3.516424059e-01,  3.421183996e-01,  3.325767805e-01,  3.230258638e-01,
-      3.134739818e-01,  3.039294763e-01,  2.944006908e-01,  2.848959628e-01,
-      2.754236162e-01,  2.659919539e-01,  2.566092499e-01,  2.472837418e-01,
-      2.380236231e-01,  2.288370361e-01,  2.197320638e-01,  2.107167229e-01,
-      2.017989566e-01,  1.929866265e-01,  1.842875062e-01,  1.757092739e-01,
-      1.672595050e-01,  1.589456655e-01,  1.507751052e-01,  1.427550504e-01,
-      1.348925977e-01,  1.271947075e-01,  1.196681973e-01,  1.123197355e-01,
-      1.051558353e-01,  9.818284881e-02,  9.140696093e-02,  8.483418385e-02,
-      7.847035142e-02,  7.232111378e-02,  6.639193214e-02,  6.068807378e-02,
-      5.521460712e-02,  4.997639709e-02,  4.497810064e-02,  4.022416239e-02,
-      3.571881060e-02,  3.146605320e-02,  2.746967413e-02,  2.373322981e-02,
-      2.026004590e-02,  1.705321419e-02,  1.411558974e-02,  1.144978827e-02,
-      9.058183747e-03,  6.942906149e-03,  5.105839538e-03,  3.548620298e-03,
-      2.272635633e-03,  1.279022277e-03,  5.686654498e-04,  1.421980359e-04,
-     -8.377285203e-16,  1.421980359e-04,  5.686654498e-04,  1.279022277e-03,
-      2.272635633e-03,  3.548620298e-03,  5.105839538e-03,  6.942906149e-03,
-      9.058183747e-03,  1.144978827e-02,  1.411558974e-02,  1.705321419e-02,
-      2.026004590e-02,  2.373322981e-02,  2.746967413e-02,  3.146605320e-02,
-      3.571881060e-02,  4.022416239e-02,  4.497810064e-02,  4.997639709e-02,
-      5.521460712e-02,  6.068807378e-02,  6.639193214e-02,  7.232111378e-02,
-      7.847035142e-02,  8.483418385e-02,  9.140696093e-02,  9.818284881e-02,
-      1.051558353e-01,  1.123197355e-01,  1.196681973e-01,  1.271947075e-01,
-      1.348925977e-01,  1.427550504e-01,  1.507751052e-01,  1.589456655e-01,
-      1.672595050e-01,  1.757092739e-01,  1.842875062e-01,  1.929866265e-01,
-      2.017989566e-01,  2.107167229e-01,  2.197320638e-01,  2.288370361e-01,
-      2.380236231e-01,  2.472837418e-01,  2.566092499e-01,  2.659919539e-01,
-      2.754236162e-01,  2.848959628e-01,  2.944006908e-01,  3.039294763e-01,
-      3.134739818e-01,  3.230258638e-01,  3.325767805e-01,  3.421183996e-01,
-      3.516424059e-01,  3.611405086e-01,  3.706044491e-01,  3.800260089e-01,
-      3.893970163e-01,  3.987093547e-01,  4.079549695e-01,  4.171258756e-01,
-      4.262141645e-01,  4.352120120e-01,  4.441116847e-01,  4.529055474e-01,
-      4.615860701e-01,  4.701458346e-01,  4.785775412e-01,  4.868740155e-01,
-      4.950282150e-01,  5.030332350e-01,  5.108823155e-01,  5.185688465e-01,
-      5.260863747e-01,  5.334286088e-01,  5.405894254e-01,  5.475628743e-01,
-      5.543431842e-01,  5.609247673e-01,  5.673022246e-01,  5.734703507e-01,
-      5.794241384e-01,  5.851587830e-01,  5.906696866e-01,  5.959524624e-01,
-      6.010029378e-01,  6.058171590e-01,  6.103913936e-01,  6.147221343e-01,
-      6.188061017e-01,  6.226402471e-01,  6.262217551e-01,  6.295480458e-01,
-      6.326167774e-01,  6.354258474e-01,  6.379733947e-01,  6.402578009e-01,
-      6.422776917e-01,  6.440319376e-01,  6.455196548e-01,  6.467402058e-01,
-      6.476931993e-01,  6.483784908e-01,  6.487961819e-01,  6.489466204e-01,
-      6.488303992e-01,  6.484483554e-01,  6.478015696e-01,  6.468913644e-01,
-      6.457193025e-01,  6.442871854e-01,  6.425970510e-01,  6.406511715e-01,
-      6.384520510e-01,  6.360024227e-01,  6.333052460e-01,  6.303637036e-01,
-      6.271811977e-01,  6.237613471e-01,  6.201079829e-01,  6.162251450e-01,
-      6.121170777e-01,  6.077882253e-01,  6.032432280e-01,  5.984869167e-01,
-      5.935243087e-01,  5.883606020e-01,  5.830011706e-01,  5.774515588e-01,
-      5.717174758e-01,  5.658047902e-01,  5.597195236e-01,  5.534678452e-01,
-      5.470560652e-01,  5.404906290e-01,  5.337781103e-01,  5.269252052e-01,
-      5.199387248e-01,  5.128255893e-01,  5.055928207e-01,  4.982475357e-01,
-      4.907969392e-01,  4.832483170e-01,  4.756090284e-01,  4.678864992e-01,
-      4.600882144e-01,  4.522217108e-01,  4.442945696e-01,  4.363144087e-01,
-      4.282888760e-01,  4.202256411e-01,  4.121323879e-01,  4.040168075e-01,
-      3.958865905e-01,  3.877494190e-01,  3.796129599e-01,  3.714848567e-01,
-      3.633727223e-01,  3.552841316e-01,  3.472266139e-01,  3.392076458e-01,
-      3.312346437e-01,  3.233149565e-01,  3.154558586e-01,  3.076645426e-01,
-      2.999481124e-01,  2.923135761e-01,  2.847678395e-01,  2.773176986e-01,
-      2.699698340e-01,  2.627308033e-01,  2.556070354e-01,  2.486048239e-01,
-      2.417303211e-01,  2.349895317e-01,  2.283883071e-01,  2.219323398e-01,
-      2.156271575e-01,  2.094781178e-01,  2.034904030e-01,  1.976690149e-01,
-      1.920187700e-01,  1.865442945e-01,  1.812500200e-01,  1.761401792e-01,
-      1.712188011e-01,  1.664897079e-01,  1.619565105e-01,  1.576226052e-01,
-      1.534911702e-01,  1.495651626e-01,  1.458473152e-01,  1.423401340e-01,
-      1.390458955e-01,  1.359666443e-01,  1.331041912e-01,  1.304601114e-01,
-      1.280357426e-01,  1.258321835e-01,  1.238502932e-01,  1.220906897e-01,
-      1.205537493e-01,  1.192396061e-01,  1.181481519e-01,  1.172790360e-01,
-      1.166316655e-01,  1.162052056e-01,  1.159985806e-01,  1.160104742e-01,
-      1.162393312e-01,  1.166833588e-01,  1.173405278e-01,  1.182085746e-01,
-      1.192850037e-01,  1.205670890e-01,  1.220518774e-01,  1.237361904e-01,
-      1.256166281e-01,  1.276895713e-01,  1.299511857e-01,  1.323974249e-01,
-      1.350240344e-01,  1.378265555e-01,  1.408003294e-01,  1.439405018e-01,
-      1.472420268e-01,  1.506996725e-01,  1.543080252e-01,  1.580614948e-01,
-      1.619543200e-01,  1.659805734e-01,  1.701341679e-01,  1.744088613e-01,
-      1.787982631e-01,  1.832958402e-01,  1.878949228e-01,  1.925887112e-01,
-      1.973702818e-01,  2.022325940e-01,  2.071684963e-01,  2.121707339e-01,
-      2.172319548e-01,  2.223447172e-01,  2.275014965e-01,  2.326946921e-01,
-      2.379166353e-01,  2.431595960e-01,  2.484157900e-01,  2.536773871e-01,
-      2.589365177e-01,  2.641852809e-01,  2.694157518e-01,  2.746199890e-01,
-      2.797900423e-01,  2.849179603e-01,  2.899957978e-01,  2.950156236e-01,
-      2.999695282e-01,  3.048496310e-01,  3.096480882e-01,  3.143570999e-01,
-      3.189689183e-01,  3.234758543e-01,  3.278702855e-01,  3.321446634e-01,
-      3.362915204e-01,  3.403034772e-01,  3.441732502e-01,  3.478936579e-01,
-      3.514576284e-01,  3.548582059e-01,  3.580885577e-01,  3.611419806e-01,
-      3.640119076e-01,  3.666919142e-01,  3.691757246e-01,  3.714572179e-01,
-      3.735304341e-01,  3.753895799e-01,  3.770290344e-01,  3.784433547e-01,
-      3.796272809e-01,  3.805757419e-01,  3.812838599e-01,  3.817469556e-01,
-      3.819605526e-01,  3.819203820e-01,  3.816223868e-01,  3.810627256e-01,
-      3.802377771e-01,  3.791441432e-01,  3.777786527e-01,  3.761383649e-01,
-      3.742205721e-01,  3.720228028e-01,  3.695428244e-01,  3.667786452e-01,
-      3.637285169e-01,  3.603909369e-01,  3.567646490e-01,  3.528486460e-01,
-      3.486421705e-01,  3.441447159e-01,  3.393560271e-01,  3.342761015e-01,
-      3.289051892e-01,  3.232437927e-01,  3.172926675e-01,  3.110528209e-01,
-      3.045255124e-01,  2.977122518e-01,  2.906147992e-01,  2.832351628e-01,
-      2.755755980e-01,  2.676386053e-01,  2.594269288e-01,  2.509435532e-01,
-      2.421917023e-01,  2.331748356e-01,  2.238966459e-01,  2.143610560e-01,
-      2.045722157e-01,  1.945344977e-01,  1.842524947e-01,  1.737310148e-01,
-      1.629750777e-01,  1.519899103e-01,  1.407809425e-01,  1.293538020e-01,
-      1.177143097e-01,  1.058684748e-01,  9.382248936e-02,  8.158272290e-02,
-      6.915571694e-02,  5.654817927e-02,  4.376697805e-02,  3.081913577e-02,
-      1.771182314e-02,  4.452352754e-03, -8.951827325e-03, -2.249314013e-02,
-     -3.616388648e-02, -4.995625172e-02, -6.386231267e-02, -7.787404460e-02,
-     -9.198332831e-02, -1.061819573e-01, -1.204616451e-01, -1.348140324e-01,
-     -1.492306948e-01, -1.637031499e-01, -1.782228649e-01, -1.927812645e-01,
-     -2.073697378e-01, -2.219796467e-01, -2.366023330e-01, -2.512291264e-01,
-     -2.658513518e-01, -2.804603374e-01, -2.950474221e-01, -3.096039635e-01,
-     -3.241213448e-01, -3.385909834e-01, -3.530043379e-01, -3.673529156e-01,
-     -3.816282803e-01, -3.958220597e-01, -4.099259525e-01, -4.239317360e-01,
-     -4.378312735e-01, -4.516165209e-01, -4.652795343e-01, -4.788124769e-01,
-     -4.922076255e-01, -5.054573779e-01, -5.185542589e-01, -5.314909274e-01,
-     -5.442601825e-01, -5.568549698e-01, -5.692683878e-01, -5.814936936e-01,
-     -5.935243087e-01, -6.053538252e-01, -6.169760107e-01, -6.283848142e-01,
-     -6.395743710e-01, -6.505390078e-01, -6.612732477e-01, -6.717718144e-01,
-     -6.820296374e-01, -6.920418557e-01, -7.018038220e-01, -7.113111070e-01,
-     -7.205595023e-01, -7.295450248e-01, -7.382639192e-01, -7.467126614e-01,
-     -7.548879614e-01, -7.627867658e-01, -7.704062601e-01, -7.777438711e-01,
-     -7.847972688e-01, -7.915643678e-01, -7.980433294e-01, -8.042325621e-01,
-     -8.101307236e-01, -8.157367205e-01, -8.210497097e-01, -8.260690984e-01,
-     -8.307945444e-01, -8.352259555e-01, -8.393634897e-01, -8.432075542e-01,
-     -8.467588049e-01, -8.500181450e-01, -8.529867238e-01, -8.556659356e-01,
-     -8.580574171e-01, -8.601630462e-01, -8.619849395e-01, -8.635254499e-01,
-     -8.647871637e-01, -8.657728984e-01, -8.664856988e-01, -8.669288344e-01,
-     -8.671057955e-01, -8.670202897e-01, -8.666762380e-01, -8.660777705e-01,
-     -8.652292222e-01, -8.641351289e-01, -8.628002219e-01, -8.612294234e-01,
-     -8.594278419e-01, -8.574007663e-01, -8.551536610e-01, -8.526921603e-01,
-     -8.500220626e-01, -8.471493248e-01, -8.440800559e-01, -8.408205115e-01,
-     -8.373770869e-01, -8.337563114e-01, -8.299648411e-01, -8.260094527e-01,
-     -8.218970370e-01, -8.176345914e-01, -8.132292135e-01, -8.086880941e-01,
-     -8.040185098e-01, -7.992278159e-01, -7.943234396e-01, -7.893128718e-01,
-     -7.842036608e-01, -7.790034041e-01, -7.737197412e-01, -7.683603462e-01,
-     -7.629329203e-01, -7.574451839e-01, -7.519048698e-01, -7.463197146e-01,
-     -7.406974522e-01, -7.350458056e-01, -7.293724795e-01, -7.236851528e-01,
-     -7.179914713e-01, -7.122990400e-01, -7.066154159e-01, -7.009481004e-01,
-     -6.953045323e-01, -6.896920804e-01, -6.841180363e-01, -6.785896075e-01,
-     -6.731139101e-01, -6.676979625e-01, -6.623486777e-01, -6.570728573e-01,
-     -6.518771847e-01, -6.467682186e-01, -6.417523866e-01, -6.368359791e-01,
-     -6.320251430e-01, -6.273258760e-01, -6.227440206e-01, -6.182852586e-01,
-     -6.139551055e-01, -6.097589051e-01, -6.057018246e-01, -6.017888493e-01,
-     -5.980247779e-01, -5.944142179e-01, -5.909615812e-01, -5.876710795e-01,
-     -5.845467208e-01, -5.815923051e-01, -5.788114207e-01, -5.762074410e-01,
-     -5.737835211e-01, -5.715425948e-01, -5.694873717e-01, -5.676203347e-01,
-     -5.659437373e-01, -5.644596020e-01, -5.631697177e-01, -5.620756384e-01,
-     -5.611786816e-01, -5.604799268e-01, -5.599802150e-01, -5.596801473e-01,
-     -5.595800846e-01,
-   };
 
-   const float wav_buzzy_i[] = {
-      8.971760921e-01,  9.082591841e-01,  9.187698318e-01,  9.286945583e-01,
-      9.380204364e-01,  9.467351098e-01,  9.548268127e-01,  9.622843889e-01,
-      9.690973112e-01,  9.752556985e-01,  9.807503335e-01,  9.855726789e-01,
-      9.897148929e-01,  9.931698441e-01,  9.959311250e-01,  9.979930655e-01,
-      9.993507443e-01,  1.000000000e+00,  9.999374417e-01,  9.991604575e-01,
-      9.976672227e-01,  9.954567068e-01,  9.925286795e-01,  9.888837156e-01,
-      9.845231984e-01,  9.794493228e-01,  9.736650966e-01,  9.671743410e-01,
-      9.599816899e-01,  9.520925880e-01,  9.435132877e-01,  9.342508454e-01,
-      9.243131155e-01,  9.137087448e-01,  9.024471641e-01,  8.905385803e-01,
-      8.779939659e-01,  8.648250483e-01,  8.510442980e-01,  8.366649148e-01,
-      8.217008142e-01,  8.061666117e-01,  7.900776064e-01,  7.734497638e-01,
-      7.562996973e-01,  7.386446487e-01,  7.205024678e-01,  7.018915914e-01,
-      6.828310205e-01,  6.633402978e-01,  6.434394832e-01,  6.231491296e-01,
-      6.024902566e-01,  5.814843249e-01,  5.601532087e-01,  5.385191685e-01,
-      5.166048223e-01,  4.944331168e-01,  4.720272980e-01,  4.494108812e-01,
-      4.266076203e-01,  4.036414771e-01,  3.805365898e-01,  3.573172418e-01,
-      3.340078292e-01,  3.106328290e-01,  2.872167666e-01,  2.637841836e-01,
-      2.403596047e-01,  2.169675056e-01,  1.936322799e-01,  1.703782068e-01,
-      1.472294186e-01,  1.242098680e-01,  1.013432966e-01,  7.865320248e-02,
-      5.616280879e-02,  3.389503254e-02,  1.187245372e-02, -9.882715135e-03,
-     -3.134865880e-02, -5.250398879e-02, -7.332777212e-02, -9.379955950e-02,
-     -1.138994128e-01, -1.336079319e-01, -1.529062805e-01, -1.717762116e-01,
-     -1.902000919e-01, -2.081609249e-01, -2.256423739e-01, -2.426287835e-01,
-     -2.591052003e-01, -2.750573924e-01, -2.904718680e-01, -3.053358930e-01,
-     -3.196375073e-01, -3.333655402e-01, -3.465096241e-01, -3.590602080e-01,
-     -3.710085686e-01, -3.823468210e-01, -3.930679283e-01, -4.031657089e-01,
-     -4.126348435e-01, -4.214708808e-01, -4.296702412e-01, -4.372302197e-01,
-     -4.441489878e-01, -4.504255930e-01, -4.560599584e-01, -4.610528799e-01,
-     -4.654060225e-01, -4.691219156e-01, -4.722039460e-01, -4.746563512e-01,
-     -4.764842099e-01, -4.776934319e-01, -4.782907472e-01, -4.782836928e-01,
-     -4.776805993e-01, -4.764905759e-01, -4.747234939e-01, -4.723899699e-01,
-     -4.695013471e-01, -4.660696758e-01, -4.621076931e-01, -4.576288011e-01,
-     -4.526470447e-01, -4.471770878e-01, -4.412341892e-01, -4.348341770e-01,
-     -4.279934231e-01, -4.207288156e-01, -4.130577320e-01, -4.049980102e-01,
-     -3.965679198e-01, -3.877861327e-01, -3.786716928e-01, -3.692439852e-01,
-     -3.595227055e-01, -3.495278277e-01, -3.392795730e-01, -3.287983770e-01,
-     -3.181048577e-01, -3.072197824e-01, -2.961640352e-01, -2.849585842e-01,
-     -2.736244480e-01, -2.621826632e-01, -2.506542514e-01, -2.390601863e-01,
-     -2.274213611e-01, -2.157585562e-01, -2.040924068e-01, -1.924433715e-01,
-     -1.808317003e-01, -1.692774040e-01, -1.578002235e-01, -1.464195995e-01,
-     -1.351546437e-01, -1.240241090e-01, -1.130463623e-01, -1.022393562e-01,
-     -9.162060267e-02, -8.120714720e-02, -7.101554337e-02, -6.106182886e-02,
-     -5.136150203e-02, -4.192949963e-02, -3.278017537e-02, -2.392727958e-02,
-     -1.538393990e-02, -7.162643068e-03,  7.247821940e-04,  8.267181171e-03,
-      1.545408796e-02,  2.227573910e-02,  2.872308602e-02,  3.478780620e-02,
-      4.046231319e-02,  4.573976529e-02,  5.061407300e-02,  5.507990521e-02,
-      5.913269407e-02,  6.276863859e-02,  6.598470695e-02,  6.877863751e-02,
-      7.114893854e-02,  7.309488661e-02,  7.461652378e-02,  7.571465344e-02,
-      7.639083489e-02,  7.664737669e-02,  7.648732877e-02,  7.591447328e-02,
-      7.493331424e-02,  7.354906604e-02,  7.176764070e-02,  6.959563404e-02,
-      6.704031073e-02,  6.410958825e-02,  6.081201973e-02,  5.715677584e-02,
-      5.315362566e-02,  4.881291657e-02,  4.414555320e-02,  3.916297557e-02,
-      3.387713628e-02,  2.830047695e-02,  2.244590394e-02,  1.632676320e-02,
-      9.956814633e-03,  3.350205664e-03, -3.478555680e-03, -1.051462826e-02,
-     -1.774286581e-02, -2.514784534e-02, -3.271389595e-02, -4.042512798e-02,
-     -4.826546241e-02, -5.621866057e-02, -6.426835397e-02, -7.239807429e-02,
-     -8.059128345e-02, -8.883140368e-02, -9.710184761e-02, -1.053860483e-01,
-     -1.136674889e-01, -1.219297327e-01, -1.301564522e-01, -1.383314586e-01,
-     -1.464387302e-01, -1.544624414e-01, -1.623869903e-01, -1.701970263e-01,
-     -1.778774772e-01, -1.854135758e-01, -1.927908851e-01, -1.999953243e-01,
-     -2.070131925e-01, -2.138311928e-01, -2.204364550e-01, -2.268165578e-01,
-     -2.329595502e-01, -2.388539712e-01, -2.444888698e-01, -2.498538231e-01,
-     -2.549389539e-01, -2.597349468e-01, -2.642330638e-01, -2.684251583e-01,
-     -2.723036886e-01, -2.758617295e-01, -2.790929837e-01, -2.819917908e-01,
-     -2.845531365e-01, -2.867726598e-01, -2.886466588e-01, -2.901720963e-01,
-     -2.913466026e-01, -2.921684791e-01, -2.926366988e-01, -2.927509066e-01,
-     -2.925114182e-01, -2.919192177e-01, -2.909759541e-01, -2.896839362e-01,
-     -2.880461271e-01, -2.860661368e-01, -2.837482137e-01, -2.810972354e-01,
-     -2.781186982e-01, -2.748187051e-01, -2.712039532e-01, -2.672817198e-01,
-     -2.630598475e-01, -2.585467284e-01, -2.537512872e-01, -2.486829634e-01,
-     -2.433516926e-01, -2.377678869e-01, -2.319424144e-01, -2.258865780e-01,
-     -2.196120937e-01, -2.131310673e-01, -2.064559718e-01, -1.995996226e-01,
-     -1.925751533e-01, -1.853959905e-01, -1.780758282e-01, -1.706286014e-01,
-     -1.630684601e-01, -1.554097419e-01, -1.476669449e-01, -1.398547008e-01,
-     -1.319877466e-01, -1.240808971e-01, -1.161490171e-01, -1.082069931e-01,
-     -1.002697057e-01, -9.235200147e-02, -8.446866516e-02, -7.663439211e-02,
-     -6.886376066e-02, -6.117120500e-02, -5.357098824e-02, -4.607717575e-02,
-     -3.870360907e-02, -3.146388008e-02, -2.437130577e-02, -1.743890353e-02,
-     -1.067936696e-02, -4.105042359e-03,  2.272094136e-03,  8.440458717e-03,
-      1.438888132e-02,  2.010662625e-02,  2.558341200e-02,  3.080943021e-02,
-      3.577536370e-02,  4.047240364e-02,  4.489226575e-02,  4.902720546e-02,
-      5.287003213e-02,  5.641412221e-02,  5.965343133e-02,  6.258250532e-02,
-      6.519649016e-02,  6.749114071e-02,  6.946282847e-02,  7.110854800e-02,
-      7.242592238e-02,  7.341320734e-02,  7.406929429e-02,  7.439371218e-02,
-      7.438662813e-02,  7.404884694e-02,  7.338180932e-02,  7.238758906e-02,
-      7.106888891e-02,  6.942903540e-02,  6.747197242e-02,  6.520225370e-02,
-      6.262503414e-02,  5.974606004e-02,  5.657165823e-02,  5.310872411e-02,
-      4.936470864e-02,  4.534760432e-02,  4.106593016e-02,  3.652871561e-02,
-      3.174548365e-02,  2.672623288e-02,  2.148141875e-02,  1.602193395e-02,
-      1.035908798e-02,  4.504585901e-03, -1.529493542e-03, -7.730720628e-03,
-     -1.408633794e-02, -2.058328429e-02, -2.720821920e-02, -3.394754791e-02,
-     -4.078744693e-02, -4.771388987e-02, -5.471267385e-02, -6.176944612e-02,
-     -6.886973097e-02, -7.599895699e-02, -8.314248438e-02, -9.028563250e-02,
-     -9.741370749e-02, -1.045120299e-01, -1.115659622e-01, -1.185609368e-01,
-     -1.254824830e-01, -1.323162543e-01, -1.390480562e-01, -1.456638721e-01,
-     -1.521498904e-01, -1.584925306e-01, -1.646784688e-01, -1.706946634e-01,
-     -1.765283795e-01, -1.821672133e-01, -1.875991160e-01, -1.928124164e-01,
-     -1.977958438e-01, -2.025385488e-01, -2.070301253e-01, -2.112606294e-01,
-     -2.152205995e-01, -2.189010745e-01, -2.222936108e-01, -2.253902994e-01,
-     -2.281837812e-01, -2.306672615e-01, -2.328345239e-01, -2.346799422e-01,
-     -2.361984923e-01, -2.373857623e-01, -2.382379619e-01, -2.387519301e-01,
-     -2.389251425e-01, -2.387557169e-01, -2.382424176e-01, -2.373846593e-01,
-     -2.361825091e-01, -2.346366872e-01, -2.327485672e-01, -2.305201742e-01,
-     -2.279541826e-01, -2.250539120e-01, -2.218233225e-01, -2.182670081e-01,
-     -2.143901898e-01, -2.101987067e-01, -2.056990065e-01, -2.008981347e-01,
-     -1.958037225e-01, -1.904239742e-01, -1.847676524e-01, -1.788440636e-01,
-     -1.726630414e-01, -1.662349299e-01, -1.595705649e-01, -1.526812556e-01,
-     -1.455787637e-01, -1.382752835e-01, -1.307834195e-01, -1.231161643e-01,
-     -1.152868750e-01, -1.073092497e-01, -9.919730260e-02, -9.096533878e-02,
-     -8.262792831e-02, -7.419987994e-02, -6.569621416e-02, -5.713213590e-02,
-     -4.852300677e-02, -3.988431697e-02, -3.123165692e-02, -2.258068864e-02,
-     -1.394711683e-02, -5.346659989e-03,  3.204978775e-03,  1.169214082e-02,
-      2.009924112e-02,  2.841079735e-02,  3.661145884e-02,  4.468603537e-02,
-      5.261952581e-02,  6.039714641e-02,  6.800435883e-02,  7.542689783e-02,
-      8.265079845e-02,  8.966242287e-02,  9.644848660e-02,  1.029960843e-01,
-      1.092927147e-01,  1.153263053e-01,  1.210852361e-01,  1.265583623e-01,
-      1.317350371e-01,  1.366051326e-01,  1.411590607e-01,  1.453877927e-01,
-      1.492828780e-01,  1.528364619e-01,  1.560413025e-01,  1.588907861e-01,
-      1.613789421e-01,  1.635004568e-01,  1.652506856e-01,  1.666256641e-01,
-      1.676221189e-01,  1.682374760e-01,  1.684698691e-01,  1.683181456e-01,
-      1.677818725e-01,  1.668613401e-01,  1.655575650e-01,  1.638722917e-01,
-      1.618079929e-01,  1.593678687e-01,  1.565558440e-01,  1.533765655e-01,
-      1.498353964e-01,  1.459384112e-01,  1.416923874e-01,  1.371047980e-01,
-      1.321838011e-01,  1.269382294e-01,  1.213775774e-01,  1.155119891e-01,
-      1.093522426e-01,  1.029097348e-01,  9.619646482e-02,  8.922501600e-02,
-      8.200853705e-02,  7.456072211e-02,  6.689578992e-02,  5.902846189e-02,
-      5.097393927e-02,  4.274787955e-02,  3.436637178e-02,  2.584591133e-02,
-      1.720337365e-02,  8.455987483e-03, -3.786927566e-04, -9.282815139e-03,
-     -1.823825903e-02, -2.722666441e-02, -3.622946176e-02, -4.522790230e-02,
-     -5.420308871e-02, -6.313600617e-02, -7.200755371e-02, -8.079857577e-02,
-     -8.948989403e-02, -9.806233930e-02, -1.064967835e-01, -1.147741720e-01,
-     -1.228755549e-01, -1.307821202e-01, -1.384752243e-01, -1.459364249e-01,
-     -1.531475114e-01, -1.600905369e-01, -1.667478483e-01, -1.731021173e-01,
-     -1.791363704e-01, -1.848340177e-01, -1.901788829e-01, -1.951552309e-01,
-     -1.997477960e-01, -2.039418091e-01, -2.077230234e-01, -2.110777409e-01,
-     -2.139928366e-01, -2.164557826e-01, -2.184546712e-01, -2.199782371e-01,
-     -2.210158786e-01, -2.215576772e-01, -2.215944178e-01, -2.211176056e-01,
-     -2.201194838e-01, -2.185930494e-01, -2.165320675e-01, -2.139310851e-01,
-     -2.107854432e-01, -2.070912881e-01, -2.028455811e-01, -1.980461071e-01,
-     -1.926914819e-01, -1.867811581e-01, -1.803154301e-01, -1.732954371e-01,
-     -1.657231656e-01, -1.576014500e-01, -1.489339720e-01, -1.397252588e-01,
-     -1.299806801e-01, -1.197064432e-01, -1.089095877e-01, -9.759797797e-02,
-     -8.578029515e-02, -7.346602720e-02, -6.066545816e-02, -4.738965594e-02,
-     -3.365045896e-02, -1.946046156e-02, -4.832998268e-03,  1.021787315e-02,
-      2.567738971e-02,  4.153010233e-02,  5.775989612e-02,  7.435001152e-02,
-      9.128306666e-02,  1.085410805e-01,  1.261054971e-01,  1.439572106e-01,
-      1.620765911e-01,  1.804435113e-01,  1.990373745e-01,  2.178371421e-01,
-      2.368213630e-01,  2.559682031e-01,  2.752554754e-01,  2.946606705e-01,
-      3.141609882e-01,  3.337333689e-01,  3.533545256e-01,  3.730009765e-01,
-      3.926490775e-01,  4.122750553e-01,  4.318550406e-01,  4.513651012e-01,
-      4.707812754e-01,  4.900796058e-01,  5.092361722e-01,  5.282271255e-01,
-      5.470287206e-01,  5.656173495e-01,  5.839695746e-01,  6.020621608e-01,
-      6.198721081e-01,  6.373766838e-01,  6.545534535e-01,  6.713803126e-01,
-      6.878355167e-01,  7.038977119e-01,  7.195459640e-01,  7.347597874e-01,
-      7.495191732e-01,  7.638046169e-01,  7.775971446e-01,  7.908783392e-01,
-      8.036303653e-01,  8.158359935e-01,  8.274786231e-01,  8.385423054e-01,
-      8.490117640e-01,  8.588724158e-01,  8.681103900e-01,  8.767125463e-01,
-      8.846664925e-01,  8.919605999e-01,  8.985840188e-01,  9.045266920e-01,
-      9.097793674e-01,  9.143336098e-01,  9.181818106e-01,  9.213171973e-01,
-      9.237338414e-01,  9.254266647e-01,  9.263914448e-01,  9.266248196e-01,
-      9.261242898e-01,  9.248882208e-01,  9.229158433e-01,  9.202072527e-01,
-      9.167634065e-01,  9.125861220e-01,  9.076780714e-01,  9.020427762e-01,
-      8.956846010e-01,  8.886087450e-01,  8.808212335e-01,  8.723289075e-01,
-      8.631394121e-01,  8.532611852e-01,  8.427034428e-01,  8.314761657e-01,
-      8.195900832e-01,  8.070566575e-01,  7.938880657e-01,  7.800971816e-01,
-      7.656975570e-01,  7.507034011e-01,  7.351295601e-01,  7.189914954e-01,
-      7.023052610e-01,  6.850874811e-01,  6.673553256e-01,  6.491264862e-01,
-      6.304191511e-01,  6.112519799e-01,  5.916440772e-01,  5.716149663e-01,
-      5.511845623e-01,  5.303731445e-01,  5.092013293e-01,  4.876900416e-01,
-      4.658604873e-01,  4.437341244e-01,  4.213326346e-01,  3.986778948e-01,
-      3.757919480e-01,  3.526969748e-01,  3.294152644e-01,  3.059691862e-01,
-      2.823811607e-01,  2.586736313e-01,  2.348690360e-01,  2.109897792e-01,
-      1.870582039e-01,  1.630965640e-01,  1.391269974e-01,  1.151714989e-01,
-      9.125189397e-02,  6.738981246e-02,  4.360666353e-02,  1.992361040e-02,
-     -3.638454014e-03, -2.705893091e-02, -5.031753886e-02, -7.339433640e-02,
-     -9.626974396e-02, -1.189245651e-01, -1.413400068e-01, -1.634976998e-01,
-     -1.853797169e-01, -2.069685914e-01, -2.282473350e-01, -2.491994536e-01,
-     -2.698089633e-01, -2.900604056e-01, -3.099388610e-01, -3.294299623e-01,
-     -3.485199068e-01, -3.671954675e-01, -3.854440037e-01, -4.032534703e-01,
-     -4.206124265e-01, -4.375100435e-01, -4.539361110e-01, -4.698810432e-01,
-     -4.853358836e-01, -5.002923089e-01, -5.147426323e-01, -5.286798053e-01,
-     -5.420974189e-01, -5.549897044e-01, -5.673515325e-01, -5.791784117e-01,
-     -5.904664867e-01, -6.012125345e-01, -6.114139611e-01, -6.210687963e-01,
-     -6.301756885e-01, -6.387338980e-01, -6.467432905e-01, -6.542043286e-01,
-     -6.611180638e-01, -6.674861271e-01, -6.733107193e-01, -6.785946000e-01,
-     -6.833410772e-01, -6.875539950e-01, -6.912377216e-01, -6.943971364e-01,
-     -6.970376166e-01, -6.991650237e-01, -7.007856890e-01, -7.019063987e-01,
-     -7.025343795e-01, -7.026772825e-01, -7.023431678e-01, -7.015404882e-01,
-     -7.002780733e-01, -6.985651123e-01, -6.964111376e-01, -6.938260078e-01,
-     -6.908198904e-01, -6.874032445e-01, -6.835868039e-01, -6.793815589e-01,
-     -6.747987395e-01, -6.698497976e-01, -6.645463897e-01, -6.589003592e-01,
-     -6.529237195e-01, -6.466286363e-01, -6.400274109e-01, -6.331324628e-01,
-     -6.259563132e-01, -6.185115684e-01, -6.108109033e-01, -6.028670450e-01,
-     -5.946927574e-01, -5.863008256e-01, -5.777040398e-01, -5.689151815e-01,
-     -5.599470078e-01, -5.508122378e-01, -5.415235382e-01, -5.320935102e-01,
-     -5.225346758e-01, -5.128594657e-01, -5.030802064e-01, -4.932091088e-01,
-     -4.832582562e-01, -4.732395938e-01, -4.631649179e-01, -4.530458658e-01,
-     -4.428939064e-01, -4.327203306e-01, -4.225362430e-01, -4.123525537e-01,
-     -4.021799703e-01, -3.920289908e-01, -3.819098968e-01, -3.718327473e-01,
-     -3.618073726e-01, -3.518433692e-01, -3.419500946e-01, -3.321366633e-01,
-     -3.224119421e-01, -3.127845472e-01, -3.032628407e-01, -2.938549279e-01,
-     -2.845686554e-01, -2.754116085e-01, -2.663911102e-01, -2.575142202e-01,
-     -2.487877338e-01, -2.402181815e-01, -2.318118293e-01, -2.235746788e-01,
-     -2.155124678e-01, -2.076306713e-01, -1.999345024e-01, -1.924289143e-01,
-     -1.851186015e-01, -1.780080021e-01, -1.711013000e-01, -1.644024271e-01,
-     -1.579150661e-01, -1.516426532e-01, -1.455883809e-01, -1.397552017e-01,
-     -1.341458304e-01, -1.287627484e-01, -1.236082063e-01, -1.186842281e-01,
-     -1.139926144e-01, -1.095349463e-01, -1.053125889e-01, -1.013266952e-01,
-     -9.757820970e-02, -9.406787238e-02, -9.079622213e-02, -8.776360065e-02,
-     -8.497015608e-02, -8.241584661e-02, -8.010044409e-02, -7.802353748e-02,
-     -7.618453631e-02, -7.458267397e-02, -7.321701101e-02, -7.208643822e-02,
-     -7.118967971e-02, -7.052529579e-02, -7.009168577e-02, -6.988709061e-02,
-     -6.990959552e-02, -7.015713229e-02, -7.062748159e-02, -7.131827513e-02,
-     -7.222699760e-02, -7.335098856e-02, -7.468744416e-02, -7.623341872e-02,
-     -7.798582615e-02, -7.994144128e-02, -8.209690107e-02, -8.444870562e-02,
-     -8.699321916e-02, -8.972667083e-02, -9.264515543e-02, -9.574463400e-02,
-     -9.902093438e-02, -1.024697516e-01, -1.060866482e-01, -1.098670547e-01,
-     -1.138062696e-01, -1.178994595e-01, -1.221416595e-01, -1.265277732e-01,
-     -1.310525726e-01, -1.357106984e-01, -1.404966600e-01, -1.454048355e-01,
-     -1.504294720e-01, -1.555646856e-01, -1.608044617e-01, -1.661426552e-01,
-     -1.715729912e-01, -1.770890648e-01, -1.826843423e-01, -1.883521617e-01,
-     -1.940857332e-01, -1.998781406e-01, -2.057223420e-01, -2.116111714e-01,
-     -2.175373402e-01, -2.234934384e-01, -2.294719369e-01, -2.354651895e-01,
-     -2.414654349e-01, -2.474647995e-01, -2.534553004e-01, -2.594288478e-01,
-     -2.653772489e-01, -2.712922111e-01, -2.771653461e-01, -2.829881739e-01,
-     -2.887521273e-01, -2.944485565e-01, -3.000687344e-01, -3.056038617e-01,
-     -3.110450728e-01, -3.163834415e-01, -3.216099876e-01, -3.267156834e-01,
-     -3.316914605e-01, -3.365282173e-01, -3.412168265e-01, -3.457481429e-01,
-     -3.501130117e-01, -3.543022771e-01, -3.583067908e-01, -3.621174218e-01,
-     -3.657250649e-01, -3.691206512e-01, -3.722951576e-01, -3.752396174e-01,
-     -3.779451303e-01, -3.804028738e-01, -3.826041137e-01, -3.845402153e-01,
-     -3.862026553e-01, -3.875830328e-01, -3.886730813e-01, -3.894646811e-01,
-     -3.899498704e-01, -3.901208587e-01, -3.899700380e-01, -3.894899961e-01,
-     -3.886735286e-01, -3.875136516e-01, -3.860036141e-01, -3.841369111e-01,
-     -3.819072952e-01, -3.793087903e-01, -3.763357030e-01, -3.729826358e-01,
-     -3.692444989e-01, -3.651165225e-01, -3.605942688e-01, -3.556736440e-01,
-     -3.503509096e-01, -3.446226941e-01, -3.384860038e-01, -3.319382343e-01,
-     -3.249771802e-01, -3.176010463e-01, -3.098084567e-01, -3.015984651e-01,
-     -2.929705630e-01, -2.839246896e-01, -2.744612389e-01, -2.645810684e-01,
-     -2.542855060e-01, -2.435763571e-01, -2.324559105e-01, -2.209269445e-01,
-     -2.089927320e-01, -1.966570451e-01, -1.839241589e-01, -1.707988550e-01,
-     -1.572864242e-01, -1.433926686e-01, -1.291239028e-01, -1.144869548e-01,
-     -9.948916584e-02, -8.413838969e-02, -6.844299122e-02, -5.241184420e-02,
-     -3.605432835e-02, -1.938032568e-02, -2.400215989e-03,  1.487512830e-02,
-      3.243434814e-02,  5.026560463e-02,  6.835658650e-02,  8.669451848e-02,
-      1.052661703e-01,  1.240578665e-01,  1.430554972e-01,  1.622445294e-01,
-      1.816100188e-01,  2.011366233e-01,  2.208086160e-01,  2.406098997e-01,
-      2.605240223e-01,  2.805341920e-01,  3.006232941e-01,  3.207739079e-01,
-      3.409683246e-01,  3.611885658e-01,  3.814164020e-01,  4.016333728e-01,
-      4.218208066e-01,  4.419598417e-01,  4.620314471e-01,  4.820164447e-01,
-      5.018955312e-01,  5.216493005e-01,  5.412582676e-01,  5.607028909e-01,
-      5.799635969e-01,  5.990208039e-01,  6.178549462e-01,  6.364464992e-01,
-      6.547760038e-01,  6.728240918e-01,  6.905715105e-01,  7.079991487e-01,
-      7.250880615e-01,  7.418194960e-01,  7.581749163e-01,  7.741360291e-01,
-      7.896848091e-01,  8.048035237e-01,  8.194747581e-01,  8.336814403e-01,
-      8.474068653e-01,  8.606347196e-01,  8.733491047e-01,  8.855345614e-01,
-      8.971760921e-01,
-   };
 
-   const float wav_buzzy_q[] = {
-      3.921090973e-01,  3.710671298e-01,  3.496552835e-01,  3.278907715e-01,
-      3.057913244e-01,  2.833751720e-01,  2.606610243e-01,  2.376680512e-01,
-      2.144158626e-01,  1.909244859e-01,  1.672143448e-01,  1.433062356e-01,
-      1.192213037e-01,  9.498101970e-02,  7.060715393e-02,  4.612175125e-02,
-      2.154710486e-02, -3.094270391e-03, -2.777966504e-02, -5.248620266e-02,
-     -7.719086784e-02, -1.018705345e-01, -1.265019949e-01, -1.510619881e-01,
-     -1.755272299e-01, -1.998744418e-01, -2.240803811e-01, -2.481218702e-01,
-     -2.719758271e-01, -2.956192947e-01, -3.190294711e-01, -3.421837396e-01,
-     -3.650596979e-01, -3.876351885e-01, -4.098883274e-01, -4.317975340e-01,
-     -4.533415596e-01, -4.744995162e-01, -4.952509048e-01, -5.155756431e-01,
-     -5.354540932e-01, -5.548670884e-01, -5.737959594e-01, -5.922225601e-01,
-     -6.101292932e-01, -6.274991343e-01, -6.443156558e-01, -6.605630499e-01,
-     -6.762261512e-01, -6.912904577e-01, -7.057421519e-01, -7.195681200e-01,
-     -7.327559713e-01, -7.452940554e-01, -7.571714796e-01, -7.683781246e-01,
-     -7.789046590e-01, -7.887425535e-01, -7.978840933e-01, -8.063223895e-01,
-     -8.140513898e-01, -8.210658875e-01, -8.273615297e-01, -8.329348239e-01,
-     -8.377831441e-01, -8.419047346e-01, -8.452987138e-01, -8.479650760e-01,
-     -8.499046918e-01, -8.511193078e-01, -8.516115450e-01, -8.513848955e-01,
-     -8.504437180e-01, -8.487932327e-01, -8.464395143e-01, -8.433894838e-01,
-     -8.396508996e-01, -8.352323464e-01, -8.301432243e-01, -8.243937353e-01,
-     -8.179948692e-01, -8.109583889e-01, -8.032968136e-01, -7.950234015e-01,
-     -7.861521310e-01, -7.766976816e-01, -7.666754126e-01, -7.561013418e-01,
-     -7.449921229e-01, -7.333650217e-01, -7.212378917e-01, -7.086291489e-01,
-     -6.955577451e-01, -6.820431417e-01, -6.681052811e-01, -6.537645590e-01,
-     -6.390417947e-01, -6.239582017e-01, -6.085353570e-01, -5.927951707e-01,
-     -5.767598544e-01, -5.604518891e-01, -5.438939936e-01, -5.271090915e-01,
-     -5.101202786e-01, -4.929507898e-01, -4.756239655e-01, -4.581632190e-01,
-     -4.405920020e-01, -4.229337719e-01, -4.052119579e-01, -3.874499276e-01,
-     -3.696709537e-01, -3.518981807e-01, -3.341545925e-01, -3.164629791e-01,
-     -2.988459046e-01, -2.813256753e-01, -2.639243080e-01, -2.466634991e-01,
-     -2.295645940e-01, -2.126485573e-01, -1.959359431e-01, -1.794468669e-01,
-     -1.632009772e-01, -1.472174285e-01, -1.315148550e-01, -1.161113446e-01,
-     -1.010244149e-01, -8.627098888e-02, -7.186737238e-02, -5.782923220e-02,
-     -4.417157535e-02, -3.090872928e-02, -1.805432328e-02, -5.621270972e-03,
-      6.378246124e-03,  1.793279374e-02,  2.903169890e-02,  3.966506271e-02,
-      4.982377189e-02,  5.949950915e-02,  6.868476216e-02,  7.737283135e-02,
-      8.555783637e-02,  9.323472123e-02,  1.003992582e-01,  1.070480503e-01,
-      1.131785326e-01,  1.187889720e-01,  1.238784660e-01,  1.284469398e-01,
-      1.324951424e-01,  1.360246412e-01,  1.390378154e-01,  1.415378483e-01,
-      1.435287176e-01,  1.450151858e-01,  1.460027880e-01,  1.464978190e-01,
-      1.465073200e-01,  1.460390624e-01,  1.451015326e-01,  1.437039137e-01,
-      1.418560673e-01,  1.395685144e-01,  1.368524141e-01,  1.337195428e-01,
-      1.301822713e-01,  1.262535417e-01,  1.219468432e-01,  1.172761868e-01,
-      1.122560798e-01,  1.069014993e-01,  1.012278647e-01,  9.525101032e-02,
-      8.898715643e-02,  8.245288062e-02,  7.566508824e-02,  6.864098245e-02,
-      6.139803392e-02,  5.395395016e-02,  4.632664460e-02,  3.853420535e-02,
-      3.059486387e-02,  2.252696341e-02,  1.434892747e-02,  6.079228126e-03,
-     -2.263645514e-03, -1.066121888e-02, -1.909506328e-02, -2.754682714e-02,
-     -3.599826696e-02, -4.443127800e-02, -5.282792458e-02, -6.117047012e-02,
-     -6.944140656e-02, -7.762348346e-02, -8.569973644e-02, -9.365351513e-02,
-     -1.014685104e-01, -1.091287810e-01, -1.166187795e-01, -1.239233771e-01,
-     -1.310278885e-01, -1.379180950e-01, -1.445802670e-01, -1.510011860e-01,
-     -1.571681652e-01, -1.630690691e-01, -1.686923325e-01, -1.740269779e-01,
-     -1.790626322e-01, -1.837895424e-01, -1.881985896e-01, -1.922813026e-01,
-     -1.960298696e-01, -1.994371494e-01, -2.024966807e-01, -2.052026910e-01,
-     -2.075501033e-01, -2.095345425e-01, -2.111523399e-01, -2.124005367e-01,
-     -2.132768864e-01, -2.137798553e-01, -2.139086229e-01, -2.136630795e-01,
-     -2.130438243e-01, -2.120521606e-01, -2.106900908e-01, -2.089603102e-01,
-     -2.068661988e-01, -2.044118128e-01, -2.016018741e-01, -1.984417597e-01,
-     -1.949374888e-01, -1.910957095e-01, -1.869236846e-01, -1.824292755e-01,
-     -1.776209260e-01, -1.725076443e-01, -1.670989849e-01, -1.614050288e-01,
-     -1.554363632e-01, -1.492040603e-01, -1.427196553e-01, -1.359951235e-01,
-     -1.290428569e-01, -1.218756398e-01, -1.145066241e-01, -1.069493038e-01,
-     -9.921748903e-02, -9.132527928e-02, -8.328703680e-02, -7.511735904e-02,
-     -6.683105094e-02, -5.844309687e-02, -4.996863242e-02, -4.142291581e-02,
-     -3.282129930e-02, -2.417920039e-02, -1.551207308e-02, -6.835378984e-03,
-      1.835441365e-03,  1.048499719e-02,  1.909797596e-02,  2.765917170e-02,
-      3.615351297e-02,  4.456609068e-02,  5.288218539e-02,  6.108729434e-02,
-      6.916715794e-02,  7.710778579e-02,  8.489548218e-02,  9.251687098e-02,
-      9.995891989e-02,  1.072089640e-01,  1.142547288e-01,  1.210843520e-01,
-      1.276864051e-01,  1.340499138e-01,  1.401643775e-01,  1.460197883e-01,
-      1.516066485e-01,  1.569159872e-01,  1.619393769e-01,  1.666689473e-01,
-      1.710973997e-01,  1.752180196e-01,  1.790246880e-01,  1.825118921e-01,
-      1.856747343e-01,  1.885089408e-01,  1.910108685e-01,  1.931775107e-01,
-      1.950065017e-01,  1.964961207e-01,  1.976452936e-01,  1.984535943e-01,
-      1.989212448e-01,  1.990491136e-01,  1.988387131e-01,  1.982921965e-01,
-      1.974123522e-01,  1.962025984e-01,  1.946669755e-01,  1.928101382e-01,
-      1.906373454e-01,  1.881544503e-01,  1.853678884e-01,  1.822846649e-01,
-      1.789123411e-01,  1.752590191e-01,  1.713333267e-01,  1.671444003e-01,
-      1.627018672e-01,  1.580158276e-01,  1.530968346e-01,  1.479558740e-01,
-      1.426043439e-01,  1.370540323e-01,  1.313170951e-01,  1.254060324e-01,
-      1.193336656e-01,  1.131131122e-01,  1.067577616e-01,  1.002812492e-01,
-      9.369743126e-02,  8.702035797e-02,  8.026424745e-02,  7.344345872e-02,
-      6.657246463e-02,  5.966582457e-02,  5.273815706e-02,  4.580411219e-02,
-      3.887834406e-02,  3.197548317e-02,  2.511010894e-02,  1.829672222e-02,
-      1.154971806e-02,  4.883358653e-03, -1.688253549e-03, -8.151202293e-03,
-     -1.449178372e-02, -2.069653214e-02, -2.675224534e-02, -3.264600944e-02,
-     -3.836522318e-02, -4.389762164e-02, -4.923129934e-02, -5.435473268e-02,
-     -5.925680161e-02, -6.392681067e-02, -6.835450913e-02, -7.253011037e-02,
-     -7.644431039e-02, -8.008830539e-02, -8.345380850e-02, -8.653306551e-02,
-     -8.931886957e-02, -9.180457497e-02, -9.398410983e-02, -9.585198772e-02,
-     -9.740331824e-02, -9.863381642e-02, -9.953981114e-02, -1.001182523e-01,
-     -1.003667167e-01, -1.002834132e-01, -9.986718637e-02, -9.911751884e-02,
-     -9.803453286e-02, -9.661899038e-02, -9.487229209e-02, -9.279647519e-02,
-     -9.039420998e-02, -8.766879540e-02, -8.462415320e-02, -8.126482111e-02,
-     -7.759594483e-02, -7.362326881e-02, -6.935312601e-02, -6.479242654e-02,
-     -5.994864513e-02, -5.482980771e-02, -4.944447678e-02, -4.380173591e-02,
-     -3.791117318e-02, -3.178286371e-02, -2.542735126e-02, -1.885562891e-02,
-     -1.207911897e-02, -5.109651958e-03,  2.040555067e-03,  9.358921028e-03,
-      1.683252399e-02,  2.444812498e-02,  3.219219246e-02,  4.005092732e-02,
-      4.801028846e-02,  5.605601875e-02,  6.417367156e-02,  7.234863756e-02,
-      8.056617193e-02,  8.881142179e-02,  9.706945398e-02,  1.053252829e-01,
-      1.135638985e-01,  1.217702946e-01,  1.299294967e-01,  1.380265907e-01,
-      1.460467504e-01,  1.539752655e-01,  1.617975701e-01,  1.694992694e-01,
-      1.770661675e-01,  1.844842944e-01,  1.917399323e-01,  1.988196423e-01,
-      2.057102897e-01,  2.123990697e-01,  2.188735314e-01,  2.251216028e-01,
-      2.311316134e-01,  2.368923174e-01,  2.423929157e-01,  2.476230770e-01,
-      2.525729583e-01,  2.572332244e-01,  2.615950668e-01,  2.656502213e-01,
-      2.693909850e-01,  2.728102317e-01,  2.759014272e-01,  2.786586432e-01,
-      2.810765691e-01,  2.831505248e-01,  2.848764702e-01,  2.862510152e-01,
-      2.872714274e-01,  2.879356396e-01,  2.882422553e-01,  2.881905535e-01,
-      2.877804918e-01,  2.870127091e-01,  2.858885261e-01,  2.844099454e-01,
-      2.825796498e-01,  2.804009995e-01,  2.778780285e-01,  2.750154389e-01,
-      2.718185951e-01,  2.682935157e-01,  2.644468648e-01,  2.602859424e-01,
-      2.558186727e-01,  2.510535922e-01,  2.459998359e-01,  2.406671232e-01,
-      2.350657418e-01,  2.292065313e-01,  2.231008656e-01,  2.167606336e-01,
-      2.101982201e-01,  2.034264848e-01,  1.964587409e-01,  1.893087324e-01,
-      1.819906115e-01,  1.745189136e-01,  1.669085332e-01,  1.591746981e-01,
-      1.513329435e-01,  1.433990845e-01,  1.353891896e-01,  1.273195519e-01,
-      1.192066615e-01,  1.110671760e-01,  1.029178915e-01,  9.477571312e-02,
-      8.665762515e-02,  7.858066069e-02,  7.056187160e-02,  6.261829802e-02,
-      5.476693786e-02,  4.702471630e-02,  3.940845528e-02,  3.193484307e-02,
-      2.462040402e-02,  1.748146843e-02,  1.053414267e-02,  3.794279613e-03,
-     -2.722550611e-03, -9.001089472e-03, -1.502641846e-02, -2.078398700e-02,
-     -2.625963986e-02, -3.143964394e-02, -3.631071444e-02, -4.086004039e-02,
-     -4.507530934e-02, -4.894473147e-02, -5.245706268e-02, -5.560162699e-02,
-     -5.836833801e-02, -6.074771939e-02, -6.273092447e-02, -6.430975478e-02,
-     -6.547667757e-02, -6.622484234e-02, -6.654809610e-02, -6.644099772e-02,
-     -6.589883096e-02, -6.491761644e-02, -6.349412233e-02, -6.162587390e-02,
-     -5.931116177e-02, -5.654904898e-02, -5.333937673e-02, -4.968276886e-02,
-     -4.558063510e-02, -4.103517295e-02, -3.604936831e-02, -3.062699478e-02,
-     -2.477261169e-02, -1.849156077e-02, -1.178996162e-02, -4.674705766e-03,
-      2.846550483e-03,  1.076539448e-02,  1.907266696e-02,  2.775847299e-02,
-      3.681219417e-02,  4.622250207e-02,  5.597737279e-02,  6.606410277e-02,
-      7.646932571e-02,  8.717903065e-02,  9.817858109e-02,  1.094527352e-01,
-      1.209856671e-01,  1.327609892e-01,  1.447617751e-01,  1.569705841e-01,
-      1.693694861e-01,  1.819400874e-01,  1.946635577e-01,  2.075206571e-01,
-      2.204917646e-01,  2.335569072e-01,  2.466957887e-01,  2.598878206e-01,
-      2.731121523e-01,  2.863477022e-01,  2.995731894e-01,  3.127671659e-01,
-      3.259080482e-01,  3.389741507e-01,  3.519437180e-01,  3.647949581e-01,
-      3.775060754e-01,  3.900553043e-01,  4.024209418e-01,  4.145813813e-01,
-      4.265151456e-01,  4.382009196e-01,  4.496175836e-01,  4.607442453e-01,
-      4.715602729e-01,  4.820453260e-01,  4.921793882e-01,  5.019427974e-01,
-      5.113162770e-01,  5.202809655e-01,  5.288184466e-01,  5.369107773e-01,
-      5.445405169e-01,  5.516907537e-01,  5.583451323e-01,  5.644878792e-01,
-      5.701038278e-01,  5.751784427e-01,  5.796978427e-01,  5.836488235e-01,
-      5.870188785e-01,  5.897962193e-01,  5.919697945e-01,  5.935293086e-01,
-      5.944652380e-01,  5.947688475e-01,  5.944322047e-01,  5.934481934e-01,
-      5.918105261e-01,  5.895137548e-01,  5.865532809e-01,  5.829253636e-01,
-      5.786271275e-01,  5.736565681e-01,  5.680125568e-01,  5.616948444e-01,
-      5.547040628e-01,  5.470417261e-01,  5.387102302e-01,  5.297128505e-01,
-      5.200537394e-01,  5.097379216e-01,  4.987712886e-01,  4.871605915e-01,
-      4.749134332e-01,  4.620382588e-01,  4.485443450e-01,  4.344417882e-01,
-      4.197414914e-01,  4.044551504e-01,  3.885952381e-01,  3.721749881e-01,
-      3.552083774e-01,  3.377101075e-01,  3.196955851e-01,  3.011809013e-01,
-      2.821828102e-01,  2.627187062e-01,  2.428066009e-01,  2.224650986e-01,
-      2.017133715e-01,  1.805711337e-01,  1.590586147e-01,  1.371965322e-01,
-      1.150060645e-01,  9.250882135e-02,  6.972681558e-02,  4.668243319e-02,
-      2.339840346e-02, -1.022315231e-04, -2.379614765e-02, -4.765976992e-02,
-     -7.166930386e-02, -9.580076712e-02, -1.200300213e-01, -1.443328040e-01,
-     -1.686847606e-01, -1.930614765e-01, -2.174385092e-01, -2.417914201e-01,
-     -2.660958066e-01, -2.903273336e-01, -3.144617652e-01, -3.384749958e-01,
-     -3.623430810e-01, -3.860422686e-01, -4.095490284e-01, -4.328400823e-01,
-     -4.558924334e-01, -4.786833952e-01, -5.011906193e-01, -5.233921235e-01,
-     -5.452663189e-01, -5.667920359e-01, -5.879485500e-01, -6.087156070e-01,
-     -6.290734469e-01, -6.490028272e-01, -6.684850454e-01, -6.875019610e-01,
-     -7.060360159e-01, -7.240702541e-01, -7.415883411e-01, -7.585745815e-01,
-     -7.750139358e-01, -7.908920368e-01, -8.061952039e-01, -8.209104575e-01,
-     -8.350255315e-01, -8.485288854e-01, -8.614097144e-01, -8.736579596e-01,
-     -8.852643159e-01, -8.962202402e-01, -9.065179567e-01, -9.161504629e-01,
-     -9.251115334e-01, -9.333957227e-01, -9.409983675e-01, -9.479155870e-01,
-     -9.541442833e-01, -9.596821391e-01, -9.645276162e-01, -9.686799513e-01,
-     -9.721391520e-01, -9.749059907e-01, -9.769819987e-01, -9.783694579e-01,
-     -9.790713928e-01, -9.790915609e-01, -9.784344421e-01, -9.771052275e-01,
-     -9.751098071e-01, -9.724547570e-01, -9.691473251e-01, -9.651954167e-01,
-     -9.606075790e-01, -9.553929848e-01, -9.495614154e-01, -9.431232433e-01,
-     -9.360894141e-01, -9.284714269e-01, -9.202813158e-01, -9.115316291e-01,
-     -9.022354092e-01, -8.924061718e-01, -8.820578841e-01, -8.712049430e-01,
-     -8.598621534e-01, -8.480447052e-01, -8.357681508e-01, -8.230483819e-01,
-     -8.099016064e-01, -7.963443248e-01, -7.823933068e-01, -7.680655674e-01,
-     -7.533783434e-01, -7.383490696e-01, -7.229953550e-01, -7.073349587e-01,
-     -6.913857671e-01, -6.751657695e-01, -6.586930354e-01, -6.419856907e-01,
-     -6.250618953e-01, -6.079398198e-01, -5.906376235e-01, -5.731734320e-01,
-     -5.555653152e-01, -5.378312664e-01, -5.199891805e-01, -5.020568342e-01,
-     -4.840518649e-01, -4.659917517e-01, -4.478937959e-01, -4.297751020e-01,
-     -4.116525601e-01, -3.935428277e-01, -3.754623132e-01, -3.574271590e-01,
-     -3.394532258e-01, -3.215560775e-01, -3.037509667e-01, -2.860528202e-01,
-     -2.684762267e-01, -2.510354233e-01, -2.337442842e-01, -2.166163092e-01,
-     -1.996646133e-01, -1.829019167e-01, -1.663405362e-01, -1.499923761e-01,
-     -1.338689210e-01, -1.179812286e-01, -1.023399237e-01, -8.695519218e-02,
-     -7.183677638e-02, -5.699397096e-02, -4.243561932e-02, -2.817011077e-02,
-     -1.420537846e-02, -5.488978346e-04,  1.279231417e-02,  2.581169929e-02,
-      3.850315752e-02,  5.086104604e-02,  6.288017757e-02,  7.455581809e-02,
-      8.588368407e-02,  9.685993907e-02,  1.074811898e-01,  1.177444819e-01,
-      1.276472947e-01,  1.371875359e-01,  1.463635361e-01,  1.551740419e-01,
-      1.636182095e-01,  1.716955976e-01,  1.794061599e-01,  1.867502371e-01,
-      1.937285488e-01,  2.003421849e-01,  2.065925971e-01,  2.124815896e-01,
-      2.180113098e-01,  2.231842388e-01,  2.280031817e-01,  2.324712579e-01,
-      2.365918907e-01,  2.403687971e-01,  2.438059780e-01,  2.469077072e-01,
-      2.496785212e-01,  2.521232089e-01,  2.542468005e-01,  2.560545576e-01,
-      2.575519622e-01,  2.587447064e-01,  2.596386816e-01,  2.602399687e-01,
-      2.605548273e-01,  2.605896855e-01,  2.603511302e-01,  2.598458965e-01,
-      2.590808585e-01,  2.580630190e-01,  2.567995006e-01,  2.552975360e-01,
-      2.535644588e-01,  2.516076950e-01,  2.494347538e-01,  2.470532195e-01,
-      2.444707429e-01,  2.416950336e-01,  2.387338518e-01,  2.355950015e-01,
-      2.322863223e-01,  2.288156832e-01,  2.251909752e-01,  2.214201053e-01,
-      2.175109900e-01,  2.134715496e-01,  2.093097019e-01,  2.050333577e-01,
-      2.006504147e-01,  1.961687532e-01,  1.915962311e-01,  1.869406799e-01,
-      1.822099000e-01,  1.774116571e-01,  1.725536785e-01,  1.676436496e-01,
-      1.626892108e-01,  1.576979540e-01,  1.526774204e-01,  1.476350976e-01,
-      1.425784170e-01,  1.375147518e-01,  1.324514146e-01,  1.273956559e-01,
-      1.223546619e-01,  1.173355529e-01,  1.123453819e-01,  1.073911332e-01,
-      1.024797206e-01,  9.761798668e-02,  9.281270148e-02,  8.807056114e-02,
-      8.339818706e-02,  7.880212475e-02,  7.428884286e-02,  6.986473212e-02,
-      6.553610440e-02,  6.130919165e-02,  5.719014485e-02,  5.318503296e-02,
-      4.929984178e-02,  4.554047276e-02,  4.191274179e-02,  3.842237782e-02,
-      3.507502150e-02,  3.187622364e-02,  2.883144361e-02,  2.594604761e-02,
-      2.322530683e-02,  2.067439549e-02,  1.829838869e-02,  1.610226022e-02,
-      1.409088015e-02,  1.226901228e-02,  1.064131144e-02,  9.212320681e-03,
-      7.986468233e-03,  6.968064353e-03,  6.161297994e-03,  5.570233314e-03,
-      5.198806025e-03,  5.050819585e-03,  5.129941223e-03,  5.439697824e-03,
-      5.983471644e-03,  6.764495895e-03,  7.785850175e-03,  9.050455769e-03,
-      1.056107081e-02,  1.232028535e-02,  1.433051625e-02,  1.659400204e-02,
-      1.911279764e-02,  2.188876897e-02,  2.492358759e-02,  2.821872511e-02,
-      3.177544770e-02,  3.559481051e-02,  3.967765199e-02,  4.402458830e-02,
-      4.863600771e-02,  5.351206490e-02,  5.865267547e-02,  6.405751035e-02,
-      6.972599033e-02,  7.565728068e-02,  8.185028583e-02,  8.830364418e-02,
-      9.501572307e-02,  1.019846138e-01,  1.092081270e-01,  1.166837879e-01,
-      1.244088320e-01,  1.323802011e-01,  1.405945390e-01,  1.490481883e-01,
-      1.577371864e-01,  1.666572631e-01,  1.758038370e-01,  1.851720138e-01,
-      1.947565835e-01,  2.045520187e-01,  2.145524735e-01,  2.247517821e-01,
-      2.351434582e-01,  2.457206948e-01,  2.564763645e-01,  2.674030196e-01,
-      2.784928939e-01,  2.897379036e-01,  3.011296496e-01,  3.126594198e-01,
-      3.243181923e-01,  3.360966388e-01,  3.479851285e-01,  3.599737326e-01,
-      3.720522295e-01,  3.842101101e-01,  3.964365843e-01,  4.087205872e-01,
-      4.210507866e-01,  4.334155905e-01,  4.458031554e-01,  4.582013955e-01,
-      4.705979912e-01,  4.829804000e-01,  4.953358659e-01,  5.076514314e-01,
-      5.199139478e-01,  5.321100884e-01,  5.442263599e-01,  5.562491160e-01,
-      5.681645709e-01,  5.799588128e-01,  5.916178188e-01,  6.031274693e-01,
-      6.144735637e-01,  6.256418358e-01,  6.366179700e-01,  6.473876178e-01,
-      6.579364146e-01,  6.682499969e-01,  6.783140199e-01,  6.881141750e-01,
-      6.976362083e-01,  7.068659386e-01,  7.157892760e-01,  7.243922407e-01,
-      7.326609822e-01,  7.405817977e-01,  7.481411520e-01,  7.553256964e-01,
-      7.621222882e-01,  7.685180099e-01,  7.745001888e-01,  7.800564163e-01,
-      7.851745670e-01,  7.898428182e-01,  7.940496689e-01,  7.977839586e-01,
-      8.010348862e-01,  8.037920285e-01,  8.060453583e-01,  8.077852628e-01,
-      8.090025609e-01,  8.096885208e-01,  8.098348767e-01,  8.094338459e-01,
-      8.084781441e-01,  8.069610018e-01,  8.048761791e-01,  8.022179802e-01,
-      7.989812677e-01,  7.951614762e-01,  7.907546246e-01,  7.857573288e-01,
-      7.801668130e-01,  7.739809205e-01,  7.671981240e-01,  7.598175348e-01,
-      7.518389113e-01,  7.432626669e-01,  7.340898770e-01,  7.243222851e-01,
-      7.139623079e-01,  7.030130401e-01,  6.914782575e-01,  6.793624197e-01,
-      6.666706719e-01,  6.534088456e-01,  6.395834585e-01,  6.252017131e-01,
-      6.102714948e-01,  5.948013688e-01,  5.788005760e-01,  5.622790280e-01,
-      5.452473010e-01,  5.277166290e-01,  5.096988956e-01,  4.912066253e-01,
-      4.722529733e-01,  4.528517149e-01,  4.330172335e-01,  4.127645075e-01,
-      3.921090973e-01,
-   };
 
 
 
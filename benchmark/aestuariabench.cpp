@@ -0,0 +1,101 @@
+#include <cmath>
+
+#include "benchmark.hpp"
+
+#include "stmlib/utils/gate_flags.h"
+
+#include "tides2/poly_slope_generator.h"
+
+namespace sanguineBenchmark {
+	// Aestuaria: one tides2::PolySlopeGenerator per channel, filling 8 sample blocks at the host rate.
+	struct AestuariaBench : ModuleBench {
+		enum InputIds {
+			INPUT_PITCH,
+			INPUT_SHAPE,
+			INPUT_TRIGGER,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_1,
+			OUTPUT_2,
+			OUTPUT_3,
+			OUTPUT_4,
+			OUTPUTS_COUNT
+		};
+
+		static const int kBlockSize = 8;
+
+		tides2::PolySlopeGenerator polySlopeGenerators[PORT_MAX_CHANNELS];
+
+		stmlib::GateFlags previousTriggerFlags[PORT_MAX_CHANNELS] = {};
+		stmlib::GateFlags triggerFlags[PORT_MAX_CHANNELS][kBlockSize] = {};
+
+		tides2::PolySlopeGenerator::OutputSample outputSamples[PORT_MAX_CHANNELS][kBlockSize] = {};
+
+		int frame = 0;
+
+		tides2::RampMode rampMode;
+		tides2::OutputMode outputMode;
+		tides2::Range range;
+
+		AestuariaBench(tides2::RampMode newRampMode, tides2::OutputMode newOutputMode, tides2::Range newRange) :
+			rampMode(newRampMode), outputMode(newOutputMode), range(newRange) {
+			patchInput(INPUT_PITCH, SIGNAL_PITCH);
+			patchInput(INPUT_SHAPE, SIGNAL_CV);
+			patchInput(INPUT_TRIGGER, SIGNAL_GATE);
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				polySlopeGenerators[channel].Init();
+			}
+		}
+
+		void init(float sampleRate) override {}
+
+		void process(const rack::ProcessArgs& args) override {
+			for (int channel = 0; channel < channelCount; ++channel) {
+				previousTriggerFlags[channel] = stmlib::ExtractGateFlags(previousTriggerFlags[channel],
+					inputs[INPUT_TRIGGER].getVoltage(channel) >= 0.7f);
+				triggerFlags[channel][frame] = previousTriggerFlags[channel];
+
+				const tides2::PolySlopeGenerator::OutputSample& outputSample = outputSamples[channel][frame];
+				outputs[OUTPUT_1].setVoltage(outputSample.channel[0], channel);
+				outputs[OUTPUT_2].setVoltage(outputSample.channel[1], channel);
+				outputs[OUTPUT_3].setVoltage(outputSample.channel[2], channel);
+				outputs[OUTPUT_4].setVoltage(outputSample.channel[3], channel);
+			}
+
+			if (++frame >= kBlockSize) {
+				frame = 0;
+
+				const float rootFrequency = range == tides2::RANGE_AUDIO ? 130.81f : 2.f;
+
+				for (int channel = 0; channel < channelCount; ++channel) {
+					float frequency = rootFrequency * args.sampleTime * std::exp2(inputs[INPUT_PITCH].getVoltage(channel));
+
+					float shape = 0.5f + inputs[INPUT_SHAPE].getVoltage(channel) / 10.f;
+					shape = shape < 0.f ? 0.f : (shape > 1.f ? 1.f : shape);
+
+					polySlopeGenerators[channel].Render(rampMode, outputMode, range, frequency, 0.5f, shape, 0.5f, 0.5f,
+						triggerFlags[channel], NULL, outputSamples[channel], kBlockSize);
+				}
+			}
+
+			for (int output = 0; output < OUTPUTS_COUNT; ++output) {
+				outputs[output].setChannels(channelCount);
+			}
+		}
+	};
+
+	static BenchRegistrar aestuariaRegistrar("Aestuaria", true, []() -> ModuleBench* {
+		return new AestuariaBench(tides2::RAMP_MODE_LOOPING, tides2::OUTPUT_MODE_GATES, tides2::RANGE_CONTROL);
+	});
+
+	static BenchRegistrar aestuariaAudioRegistrar("Aestuaria:audio", true, []() -> ModuleBench* {
+		return new AestuariaBench(tides2::RAMP_MODE_LOOPING, tides2::OUTPUT_MODE_FREQUENCY, tides2::RANGE_AUDIO);
+	});
+
+	static BenchRegistrar aestuariaEnvelopeRegistrar("Aestuaria:ad", true, []() -> ModuleBench* {
+		return new AestuariaBench(tides2::RAMP_MODE_AD, tides2::OUTPUT_MODE_AMPLITUDE, tides2::RANGE_CONTROL);
+	});
+}
@@ -0,0 +1,64 @@
+#include "aestusbench.hpp"
+
+#include "tides/generator.h"
+
+namespace sanguineBenchmark {
+	struct TidesControl {
+		static const uint8_t CONTROL_GATE = tides::CONTROL_GATE;
+		static const uint8_t CONTROL_GATE_RISING = tides::CONTROL_GATE_RISING;
+		static const uint8_t CONTROL_GATE_FALLING = tides::CONTROL_GATE_FALLING;
+	};
+
+	// Aestus: a single tides::Generator, filling 16 sample blocks at the host rate.
+	struct AestusBench : ModuleBench {
+		tides::Generator generator;
+
+		size_t frame = 0;
+		uint8_t lastGate = 0;
+
+		bool bUseSheepFirmware;
+
+		explicit AestusBench(bool bSheep) : bUseSheepFirmware(bSheep) {
+			patchInput(INPUT_AESTUS_PITCH, SIGNAL_PITCH);
+			patchInput(INPUT_AESTUS_SHAPE, SIGNAL_CV);
+			patchInput(INPUT_AESTUS_TRIGGER, SIGNAL_GATE);
+
+			generator.Init();
+			generator.set_mode(tides::GENERATOR_MODE_LOOPING);
+			generator.set_range(tides::GENERATOR_RANGE_HIGH);
+		}
+
+		void init(float sampleRate) override {}
+
+		void process(const rack::ProcessArgs& args) override {
+			if (++frame >= tides::kBlockSize) {
+				frame = 0;
+
+				float pitch = 12.f * inputs[INPUT_AESTUS_PITCH].getVoltage() + 60.f;
+				// Scale to the global sample rate.
+				pitch += log2f(48000.f / args.sampleRate) * 12.f;
+				pitch *= 128.f;
+				generator.set_pitch(static_cast<int>(pitch < -32768.f ? -32768.f : (pitch > 32767.f ? 32767.f : pitch)));
+
+				generator.set_shape(getAestusShape(inputs[INPUT_AESTUS_SHAPE].getVoltage()));
+				generator.set_slope(0);
+				generator.set_smoothness(0);
+
+				generator.Process(bUseSheepFirmware);
+			}
+
+			uint8_t gate = getAestusGate<TidesControl>(inputs[INPUT_AESTUS_TRIGGER].getVoltage(), lastGate);
+			const tides::GeneratorSample& sample = generator.Process(gate);
+			outputs[OUTPUT_AESTUS_UNI].setVoltage(static_cast<float>(sample.unipolar) / 65535 * 8.f);
+			outputs[OUTPUT_AESTUS_BI].setVoltage(static_cast<float>(-sample.bipolar) / 32768 * 5.f);
+		}
+	};
+
+	static BenchRegistrar aestusRegistrar("Aestus", false, []() -> ModuleBench* {
+		return new AestusBench(false);
+	});
+
+	static BenchRegistrar aestusSheepRegistrar("Aestus:sheep", false, []() -> ModuleBench* {
+		return new AestusBench(true);
+	});
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cmath>
+
+#include "benchmark.hpp"
+
+namespace sanguineBenchmark {
+	enum AestusInputIds {
+		INPUT_AESTUS_PITCH,
+		INPUT_AESTUS_SHAPE,
+		INPUT_AESTUS_TRIGGER,
+		INPUTS_AESTUS_COUNT
+	};
+
+	enum AestusOutputIds {
+		OUTPUT_AESTUS_UNI,
+		OUTPUT_AESTUS_BI,
+		OUTPUTS_AESTUS_COUNT
+	};
+
+	template <typename Control>
+	static uint8_t getAestusGate(float voltage, uint8_t& lastGate) {
+		uint8_t gate = voltage >= 0.7f ? Control::CONTROL_GATE : 0;
+		if (!(lastGate & Control::CONTROL_GATE) && (gate & Control::CONTROL_GATE)) {
+			gate |= Control::CONTROL_GATE_RISING;
+		}
+		if ((lastGate & Control::CONTROL_GATE) && !(gate & Control::CONTROL_GATE)) {
+			gate |= Control::CONTROL_GATE_FALLING;
+		}
+		lastGate = gate;
+		return gate;
+	}
+
+	static int16_t getAestusShape(float voltage) {
+		float shape = voltage / 5.f;
+		shape = shape < -1.f ? -1.f : (shape > 1.f ? 1.f : shape);
+		return static_cast<int16_t>(shape * 32767.f);
+	}
+}
@@ -0,0 +1,173 @@
+#include <cstring>
+
+#include "benchmark.hpp"
+
+#include "rings/dsp/part.h"
+#include "rings/dsp/strummer.h"
+#include "rings/dsp/string_synth_part.h"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+namespace sanguineBenchmark {
+	// Anuli: one rings::Part (or StringSynthPart, for Disastrous Peace) per channel, in 24 frame blocks at 48 kHz.
+	struct AnuliBench : ModuleBench {
+		enum InputIds {
+			INPUT_STRUM,
+			INPUT_PITCH,
+			INPUT_IN,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_ODD,
+			OUTPUT_EVEN,
+			OUTPUTS_COUNT
+		};
+
+		static const int kBlockSize = 24;
+
+		uint16_t reverbBuffers[PORT_MAX_CHANNELS][32768] = {};
+		rings::Part parts[PORT_MAX_CHANNELS];
+		rings::StringSynthPart stringSynths[PORT_MAX_CHANNELS];
+		rings::Strummer strummers[PORT_MAX_CHANNELS];
+		rings::PerformanceState performanceStates[PORT_MAX_CHANNELS] = {};
+		rings::ReverbBus reverbBus;
+
+		float inputFrames[PORT_MAX_CHANNELS][kBlockSize] = {};
+		float outputFrames[PORT_MAX_CHANNELS][kBlockSize] = {};
+		float auxFrames[PORT_MAX_CHANNELS][kBlockSize] = {};
+		int inputFrame = 0;
+
+		bool lastStrums[PORT_MAX_CHANNELS] = {};
+
+		int mode;
+		int polyphony;
+		bool bSharedReverb;
+
+		BlockClock blockClock;
+
+		AnuliBench(int newMode, int newPolyphony, bool sharedReverb = false) : mode(newMode), polyphony(newPolyphony),
+			bSharedReverb(sharedReverb) {
+			patchInput(INPUT_STRUM, SIGNAL_GATE);
+			patchInput(INPUT_PITCH, SIGNAL_PITCH);
+			patchInput(INPUT_IN, SIGNAL_AUDIO);
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				memset(&strummers[channel], 0, sizeof(rings::Strummer));
+				memset(&parts[channel], 0, sizeof(rings::Part));
+				memset(&stringSynths[channel], 0, sizeof(rings::StringSynthPart));
+				strummers[channel].Init(0.01f, 44100.f / kBlockSize);
+				parts[channel].Init(reverbBuffers[channel]);
+				stringSynths[channel].Init(reverbBuffers[channel]);
+			}
+			memset(&reverbBus, 0, sizeof(rings::ReverbBus));
+			reverbBus.Init();
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(48000.f, kBlockSize, sampleRate);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			// The input resampler is not part of the measurement: keep the latest input samples of each channel.
+			for (int channel = 0; channel < channelCount; ++channel) {
+				inputFrames[channel][inputFrame] = inputs[INPUT_IN].getVoltage(channel) / 5.f;
+			}
+			inputFrame = (inputFrame + 1) % kBlockSize;
+
+			if (blockClock.tick()) {
+				rings::ReverbBus* sharedReverb = bSharedReverb ? &reverbBus : NULL;
+				if (sharedReverb) {
+					sharedReverb->Clear();
+				}
+
+				for (int channel = 0; channel < channelCount; ++channel) {
+					rings::Patch patch;
+					patch.structure = 0.5f;
+					patch.brightness = 0.5f;
+					patch.damping = 0.5f;
+					patch.position = 0.5f;
+
+					bool bStrum = inputs[INPUT_STRUM].getVoltage(channel) >= 1.f;
+
+					rings::PerformanceState& performanceState = performanceStates[channel];
+					performanceState.note = 12.f * inputs[INPUT_PITCH].getVoltage(channel);
+					performanceState.tonic = 12.f + 30.f;
+					performanceState.fm = 0.f;
+					performanceState.internal_exciter = false;
+					performanceState.internal_strum = false;
+					performanceState.internal_note = false;
+					performanceState.strum = bStrum && !lastStrums[channel];
+					performanceState.chord = 4;
+					lastStrums[channel] = bStrum;
+
+					if (mode == 6) {
+						stringSynths[channel].set_polyphony(polyphony);
+						stringSynths[channel].set_fx(rings::FX_REVERB);
+						strummers[channel].Process(NULL, kBlockSize, &performanceState);
+						stringSynths[channel].Process(performanceState, patch, inputFrames[channel],
+							outputFrames[channel], auxFrames[channel], kBlockSize, sharedReverb);
+					} else {
+						if (parts[channel].polyphony() != polyphony) {
+							parts[channel].set_polyphony(polyphony);
+						}
+						parts[channel].set_model(static_cast<rings::ResonatorModel>(mode));
+						strummers[channel].Process(inputFrames[channel], kBlockSize, &performanceState);
+						parts[channel].Process(performanceState, patch, inputFrames[channel], outputFrames[channel],
+							auxFrames[channel], kBlockSize, sharedReverb);
+					}
+				}
+
+				if (sharedReverb) {
+					// Stereo return, mixed into every channel.
+					sharedReverb->Process(kBlockSize);
+					for (int channel = 0; channel < channelCount; ++channel) {
+						if (mode == 6) {
+							stringSynths[channel].Mix(sharedReverb, false, outputFrames[channel], auxFrames[channel],
+								kBlockSize);
+						} else {
+							parts[channel].Mix(sharedReverb, false, outputFrames[channel], auxFrames[channel],
+								kBlockSize);
+						}
+					}
+				}
+			}
+
+			const int frame = blockClock.frameIndex();
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputs[OUTPUT_ODD].setVoltage(outputFrames[channel][frame] * 5.f, channel);
+				outputs[OUTPUT_EVEN].setVoltage(auxFrames[channel][frame] * 5.f, channel);
+			}
+			outputs[OUTPUT_ODD].setChannels(channelCount);
+			outputs[OUTPUT_EVEN].setChannels(channelCount);
+		}
+	};
+
+	static BenchRegistrar anuliRegistrar("Anuli", true, []() -> ModuleBench* {
+		return new AnuliBench(rings::RESONATOR_MODEL_MODAL, 1);
+	});
+
+	static BenchRegistrar anuliPoly4Registrar("Anuli:poly4", true, []() -> ModuleBench* {
+		return new AnuliBench(rings::RESONATOR_MODEL_MODAL, 4);
+	});
+
+	static BenchRegistrar anuliStringsRegistrar("Anuli:strings", true, []() -> ModuleBench* {
+		return new AnuliBench(rings::RESONATOR_MODEL_SYMPATHETIC_STRING, 1);
+	});
+
+	static BenchRegistrar anuliPeaceRegistrar("Anuli:peace", true, []() -> ModuleBench* {
+		return new AnuliBench(6, 4);
+	});
+
+	static BenchRegistrar anuliPeaceSharedRegistrar("Anuli:peace-shared", true, []() -> ModuleBench* {
+		return new AnuliBench(6, 4, true);
+	});
+
+	static BenchRegistrar anuliReverbRegistrar("Anuli:reverb", true, []() -> ModuleBench* {
+		return new AnuliBench(rings::RESONATOR_MODEL_STRING_AND_REVERB, 1);
+	});
+
+	static BenchRegistrar anuliReverbSharedRegistrar("Anuli:reverb-shared", true, []() -> ModuleBench* {
+		return new AnuliBench(rings::RESONATOR_MODEL_STRING_AND_REVERB, 1, true);
+	});
+}
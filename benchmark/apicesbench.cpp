@@ -0,0 +1,99 @@
+#include <cstring>
+
+#include "benchmark.hpp"
+
+#include "peaks/processors.h"
+#include "deadman/deadman_processors.h"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+namespace sanguineBenchmark {
+	/*
+	   Apices and Mortuus: two processors, one per output, rendered in 4 frame blocks at 48 kHz, with the gate
+	   inputs turned into gate flags on every frame.
+	*/
+	template <typename Processors, typename ProcessorFunction, typename GateFlags>
+	struct PeakiesBench : ModuleBench {
+		enum InputIds {
+			INPUT_GATE_1,
+			INPUT_GATE_2,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_OUT_1,
+			OUTPUT_OUT_2,
+			OUTPUTS_COUNT
+		};
+
+		static const int kChannelCount = 2;
+		static const int kBlockSize = 4;
+
+		Processors processors[kChannelCount];
+
+		GateFlags gateFlags[kChannelCount] = {};
+		GateFlags inputFrames[kChannelCount][kBlockSize] = {};
+		int16_t outputFrames[kChannelCount][kBlockSize] = {};
+
+		int inputFrame = 0;
+
+		BlockClock blockClock;
+
+		PeakiesBench(ProcessorFunction function1, ProcessorFunction function2) {
+			patchInput(INPUT_GATE_1, SIGNAL_GATE);
+			patchInput(INPUT_GATE_2, SIGNAL_GATE);
+
+			memset(&processors, 0, sizeof(processors));
+			for (int channel = 0; channel < kChannelCount; ++channel) {
+				processors[channel].Init(channel);
+				for (int knob = 0; knob < 4; ++knob) {
+					processors[channel].set_parameter(knob, 32768);
+				}
+			}
+			processors[0].set_function(function1);
+			processors[1].set_function(function2);
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(48000.f, kBlockSize, sampleRate);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			uint32_t gateInputs = 0;
+			gateInputs |= inputs[INPUT_GATE_1].getVoltage() >= 0.7f ? 1 : 0;
+			gateInputs |= inputs[INPUT_GATE_2].getVoltage() >= 0.7f ? 2 : 0;
+
+			for (int channel = 0; channel < kChannelCount; ++channel) {
+				gateFlags[channel] = peaks::ExtractGateFlags(gateFlags[channel], gateInputs & (1 << channel));
+			}
+			inputFrames[0][inputFrame] = gateFlags[0] | (gateFlags[1] << 4);
+			inputFrames[1][inputFrame] = gateFlags[1];
+			inputFrame = (inputFrame + 1) % kBlockSize;
+
+			if (blockClock.tick()) {
+				for (int channel = 0; channel < kChannelCount; ++channel) {
+					processors[channel].Process(inputFrames[channel], outputFrames[channel], kBlockSize);
+				}
+			}
+
+			const int frame = blockClock.frameIndex();
+			outputs[OUTPUT_OUT_1].setVoltage(outputFrames[0][frame] / 32768.f * 8.f);
+			outputs[OUTPUT_OUT_2].setVoltage(outputFrames[1][frame] / 32768.f * 8.f);
+		}
+	};
+
+	typedef PeakiesBench<peaks::Processors, peaks::ProcessorFunction, peaks::GateFlags> ApicesBench;
+	typedef PeakiesBench<deadman::Processors, deadman::ProcessorFunction, peaks::GateFlags> MortuusBench;
+
+	static BenchRegistrar apicesRegistrar("Apices", false, []() -> ModuleBench* {
+		return new ApicesBench(peaks::PROCESSOR_FUNCTION_ENVELOPE, peaks::PROCESSOR_FUNCTION_ENVELOPE);
+	});
+
+	static BenchRegistrar apicesDrumsRegistrar("Apices:drums", false, []() -> ModuleBench* {
+		return new ApicesBench(peaks::PROCESSOR_FUNCTION_BASS_DRUM, peaks::PROCESSOR_FUNCTION_SNARE_DRUM);
+	});
+
+	static BenchRegistrar mortuusRegistrar("Mortuus", false, []() -> ModuleBench* {
+		return new MortuusBench(deadman::PROCESSOR_FUNCTION_ENVELOPE, deadman::PROCESSOR_FUNCTION_ENVELOPE);
+	});
+}
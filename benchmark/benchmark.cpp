@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "benchmark.hpp"
+
+/*
+   Headless benchmark for the DSP side of the modules' process() loops.
+
+   Usage: sanguine_benchmark [--seconds S] [--block N] [--csv] [name filter...]
+
+   Every selected driver is run at 44.1, 48 and 96 kHz with 1, 4 and 16 polyphonic channels (monophonic modules
+   are only run with 1 channel), fed with deterministic audio, pitch, gate and CV signals.
+   For each run it reports the average cost per host sample and the slowest engine block of N samples.
+*/
+
+namespace sanguineBenchmark {
+	std::vector<BenchInfo>& getBenches() {
+		static std::vector<BenchInfo> benches;
+		return benches;
+	}
+
+	static const float kSampleRates[] = { 44100.f, 48000.f, 96000.f };
+	static const int kChannelCounts[] = { 1, 4, 16 };
+
+	static const float kTwoPi = 6.283185307f;
+
+	struct Options {
+		float seconds = 2.f;
+		int blockSize = 64;
+		bool bCsv = false;
+		std::vector<std::string> filters;
+	};
+
+	struct Result {
+		double nsPerSample;
+		double worstBlockUs;
+		double realtimeLoad;
+	};
+
+	static float generateSignal(SignalKinds kind, int64_t frame, int channel, float sampleRate) {
+		float seconds = frame / sampleRate;
+		switch (kind) {
+		case SIGNAL_AUDIO: {
+			float frequency = 110.f * (1.f + 0.07f * channel);
+			float phase = seconds * frequency;
+			return 10.f * (phase - std::floor(phase)) - 5.f;
+		}
+		case SIGNAL_PITCH: {
+			// A slow arpeggio, one step every quarter second, transposed per channel.
+			int step = static_cast<int>(seconds * 4.f) % 5;
+			return (step * 3 + channel) / 12.f - 1.f;
+		}
+		case SIGNAL_GATE: {
+			// 10 ms pulses every quarter second, staggered per channel.
+			float phase = seconds * 4.f + channel / 16.f;
+			return (phase - std::floor(phase)) < 0.04f ? 10.f : 0.f;
+		}
+		case SIGNAL_CV:
+		default:
+			return 2.5f * std::sin(kTwoPi * (0.3f + 0.05f * channel) * seconds);
+		}
+	}
+
+	static Result runBench(const BenchInfo& info, float sampleRate, int channelCount, const Options& options) {
+		std::unique_ptr<ModuleBench> bench(info.factory());
+
+		bench->channelCount = channelCount;
+		for (const PatchedInput& patchedInput : bench->patchedInputs) {
+			bench->inputs[patchedInput.port].setChannels(channelCount);
+		}
+		bench->init(sampleRate);
+
+		const int patchedCount = bench->patchedInputs.size();
+		std::vector<float> stimulus(options.blockSize * patchedCount * PORT_MAX_CHANNELS);
+
+		rack::ProcessArgs args;
+		args.sampleRate = sampleRate;
+		args.sampleTime = 1.f / sampleRate;
+		args.frame = 0;
+
+		const int64_t totalFrames = static_cast<int64_t>(options.seconds * sampleRate);
+		double totalNs = 0.;
+		double worstBlockNs = 0.;
+		volatile float sink = 0.f;
+
+		while (args.frame < totalFrames) {
+			// Signals are computed ahead of the timed section: Rack only copies voltages between cables.
+			for (int frame = 0; frame < options.blockSize; ++frame) {
+				for (int input = 0; input < patchedCount; ++input) {
+					float* voltages = &stimulus[(frame * patchedCount + input) * PORT_MAX_CHANNELS];
+					for (int channel = 0; channel < channelCount; ++channel) {
+						voltages[channel] = generateSignal(bench->patchedInputs[input].kind, args.frame + frame,
+							channel, sampleRate);
+					}
+				}
+			}
+
+			std::chrono::steady_clock::time_point blockStart = std::chrono::steady_clock::now();
+			for (int frame = 0; frame < options.blockSize; ++frame) {
+				for (int input = 0; input < patchedCount; ++input) {
+					std::memcpy(bench->inputs[bench->patchedInputs[input].port].voltages,
+						&stimulus[(frame * patchedCount + input) * PORT_MAX_CHANNELS], channelCount * sizeof(float));
+				}
+				bench->process(args);
+				++args.frame;
+			}
+			std::chrono::steady_clock::time_point blockEnd = std::chrono::steady_clock::now();
+
+			double blockNs = std::chrono::duration<double, std::nano>(blockEnd - blockStart).count();
+			totalNs += blockNs;
+			worstBlockNs = std::max(worstBlockNs, blockNs);
+
+			sink = sink + bench->outputs[0].voltages[0];
+		}
+		(void)sink;
+
+		Result result;
+		result.nsPerSample = totalNs / args.frame;
+		result.worstBlockUs = worstBlockNs / 1000.;
+		result.realtimeLoad = (totalNs * 1e-9) / (args.frame / sampleRate);
+		return result;
+	}
+
+	static bool isSelected(const BenchInfo& info, const Options& options) {
+		if (options.filters.empty()) {
+			return true;
+		}
+		for (const std::string& filter : options.filters) {
+			if (info.name.find(filter) != std::string::npos) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static bool parseOptions(int argc, char** argv, Options& options) {
+		for (int arg = 1; arg < argc; ++arg) {
+			if (std::strcmp(argv[arg], "--seconds") == 0 && arg + 1 < argc) {
+				options.seconds = std::atof(argv[++arg]);
+			} else if (std::strcmp(argv[arg], "--block") == 0 && arg + 1 < argc) {
+				options.blockSize = std::atoi(argv[++arg]);
+			} else if (std::strcmp(argv[arg], "--csv") == 0) {
+				options.bCsv = true;
+			} else if (argv[arg][0] == '-') {
+				return false;
+			} else {
+				options.filters.push_back(argv[arg]);
+			}
+		}
+		return options.seconds > 0.f && options.blockSize > 0;
+	}
+}
+
+using namespace sanguineBenchmark;
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!parseOptions(argc, argv, options)) {
+		std::fprintf(stderr, "Usage: %s [--seconds S] [--block N] [--csv] [name filter...]\n", argv[0]);
+		return 1;
+	}
+
+	std::vector<BenchInfo> benches = getBenches();
+	std::sort(benches.begin(), benches.end(), [](const BenchInfo& a, const BenchInfo& b) {
+		return a.name < b.name;
+	});
+
+	if (options.bCsv) {
+		std::printf("module,sample_rate,channels,ns_per_sample,worst_block_us,realtime_load\n");
+	} else {
+		std::printf("%-24s %8s %4s %14s %16s %10s\n", "Module", "Rate", "Ch", "ns/sample", "worst block us",
+			"RT load");
+	}
+
+	for (const BenchInfo& info : benches) {
+		if (!isSelected(info, options)) {
+			continue;
+		}
+
+		for (float sampleRate : kSampleRates) {
+			for (int channelCount : kChannelCounts) {
+				if (!info.bPolyphonic && channelCount > 1) {
+					continue;
+				}
+
+				Result result = runBench(info, sampleRate, channelCount, options);
+
+				if (options.bCsv) {
+					std::printf("%s,%.0f,%d,%.1f,%.2f,%.5f\n", info.name.c_str(), sampleRate, channelCount,
+						result.nsPerSample, result.worstBlockUs, result.realtimeLoad);
+				} else {
+					std::printf("%-24s %8.0f %4d %14.1f %16.2f %9.3f%%\n", info.name.c_str(), sampleRate,
+						channelCount, result.nsPerSample, result.worstBlockUs, result.realtimeLoad * 100.);
+				}
+				std::fflush(stdout);
+			}
+		}
+	}
+
+	return 0;
+}
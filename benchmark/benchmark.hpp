@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "rackstub.hpp"
+
+using rack::PORT_MAX_CHANNELS;
+
+namespace sanguineBenchmark {
+	enum SignalKinds {
+		SIGNAL_AUDIO,
+		SIGNAL_PITCH,
+		SIGNAL_GATE,
+		SIGNAL_CV
+	};
+
+	struct PatchedInput {
+		int port;
+		SignalKinds kind;
+	};
+
+	/*
+	   Mirrors the DoubleRingBuffer + SampleRateConverter cadence used by the modules that run at a fixed internal
+	   rate: a new block is rendered on the host sample where the output buffer runs dry.
+	   The resampling itself is not part of the measurement: the Resampler driver measures it on its own.
+	*/
+	struct BlockClock {
+		float hostFramesPerBlock = 1.f;
+		float framesAvailable = 0.f;
+		float framesConsumed = 0.f;
+		int blockSize = 1;
+
+		void init(float internalRate, int newBlockSize, float hostRate) {
+			blockSize = newBlockSize;
+			hostFramesPerBlock = newBlockSize * hostRate / internalRate;
+			framesAvailable = 0.f;
+			framesConsumed = 0.f;
+		}
+
+		// Call once per host sample; returns true when a block has to be rendered before reading.
+		bool tick() {
+			bool bWantRender = framesAvailable < 1.f;
+			if (bWantRender) {
+				framesAvailable += hostFramesPerBlock;
+				framesConsumed = 0.f;
+			}
+			framesAvailable -= 1.f;
+			framesConsumed += 1.f;
+			return bWantRender;
+		}
+
+		// Index of the internal frame currently being played back.
+		int frameIndex() const {
+			int index = static_cast<int>((framesConsumed - 1.f) * blockSize / hostFramesPerBlock);
+			return index < blockSize ? index : blockSize - 1;
+		}
+	};
+
+	struct ModuleBench {
+		static const int kMaxPorts = 16;
+
+		rack::Input inputs[kMaxPorts];
+		rack::Output outputs[kMaxPorts];
+
+		std::vector<PatchedInput> patchedInputs;
+
+		int channelCount = 1;
+
+		virtual ~ModuleBench() {}
+
+		// Called once, before the first process(), with the ports already patched.
+		virtual void init(float sampleRate) = 0;
+
+		virtual void process(const rack::ProcessArgs& args) = 0;
+
+		void patchInput(int port, SignalKinds kind) {
+			PatchedInput patchedInput;
+			patchedInput.port = port;
+			patchedInput.kind = kind;
+			patchedInputs.push_back(patchedInput);
+		}
+	};
+
+	typedef ModuleBench* (*BenchFactory)();
+
+	struct BenchInfo {
+		std::string name;
+		bool bPolyphonic;
+		BenchFactory factory;
+	};
+
+	std::vector<BenchInfo>& getBenches();
+
+	struct BenchRegistrar {
+		BenchRegistrar(const std::string& name, bool polyphonic, BenchFactory factory) {
+			BenchInfo info;
+			info.name = name;
+			info.bPolyphonic = polyphonic;
+			info.factory = factory;
+			getBenches().push_back(info);
+		}
+	};
+}
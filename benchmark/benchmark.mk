@@ -0,0 +1,47 @@
+# Headless DSP benchmark: builds the eurorack and alt_firmware sources with the plugin's flags, plus the drivers in
+# benchmark/, into a standalone executable. Does not need the Rack SDK.
+#
+#   make benchmark
+#   build/benchmark/sanguine_benchmark [--seconds N] [--block N] [--csv] [Module...]
+
+BENCHMARK_DIR := build/benchmark
+BENCHMARK_TARGET := $(BENCHMARK_DIR)/sanguine_benchmark
+
+BENCHMARK_SOURCES := $(filter eurorack/% alt_firmware/%,$(SOURCES))
+BENCHMARK_SOURCES += $(wildcard benchmark/*.cpp)
+
+BENCHMARK_OBJECTS := $(patsubst %,$(BENCHMARK_DIR)/%.o,$(BENCHMARK_SOURCES))
+
+BENCHMARK_FLAGS := $(filter-out -I./SanguineModulesCommon/%,$(FLAGS))
+BENCHMARK_FLAGS += -I./benchmark -O3 -funsafe-math-optimizations -fno-omit-frame-pointer -MMD -MP
+ifneq (,$(filter x86_64 amd64,$(shell uname -m)))
+BENCHMARK_FLAGS += -march=nehalem
+endif
+ifdef DEBUGBUILD
+BENCHMARK_FLAGS := $(filter-out -O3,$(BENCHMARK_FLAGS))
+BENCHMARK_FLAGS := $(filter-out -funsafe-math-optimizations,$(BENCHMARK_FLAGS))
+BENCHMARK_FLAGS += -Og
+endif
+
+CC ?= cc
+CXX ?= c++
+
+.PHONY: benchmark benchmark-clean
+
+benchmark: $(BENCHMARK_TARGET)
+
+$(BENCHMARK_TARGET): $(BENCHMARK_OBJECTS)
+	$(CXX) -o $@ $^ -lm
+
+$(BENCHMARK_DIR)/%.cc.o: %.cc
+	@mkdir -p $(@D)
+	$(CXX) $(BENCHMARK_FLAGS) -std=c++11 -c -o $@ $<
+
+$(BENCHMARK_DIR)/%.cpp.o: %.cpp
+	@mkdir -p $(@D)
+	$(CXX) $(BENCHMARK_FLAGS) -std=c++11 -c -o $@ $<
+
+benchmark-clean:
+	rm -rf $(BENCHMARK_DIR)
+
+-include $(BENCHMARK_OBJECTS:.o=.d)
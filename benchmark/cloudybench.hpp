@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstring>
+
+#include "benchmark.hpp"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+namespace sanguineBenchmark {
+	static const int kCloudyMaxFrames = 32;
+	static const int kCloudyBigBufferLength = 118784;
+	static const int kCloudySmallBufferLength = 65536 - 128;
+
+	/*
+	   Nebulae, Etesia and Fluctus: a single, monophonic granular processor fed with the summed polyphonic input
+	   and run in 32 frame blocks at 32 kHz.
+	*/
+	template <typename Processor, typename PlaybackMode, typename ShortFrame>
+	struct CloudyBench : ModuleBench {
+		enum InputIds {
+			INPUT_LEFT,
+			INPUT_RIGHT,
+			INPUT_POSITION,
+			INPUT_TRIGGER,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_LEFT,
+			OUTPUT_RIGHT,
+			OUTPUTS_COUNT
+		};
+
+		uint8_t* bufferLarge;
+		uint8_t* bufferSmall;
+
+		Processor* processor;
+
+		ShortFrame outputFrames[kCloudyMaxFrames] = {};
+
+		int playbackMode;
+
+		float density;
+
+		BlockClock blockClock;
+
+		explicit CloudyBench(int newPlaybackMode, float newDensity = 0.7f) :
+			playbackMode(newPlaybackMode), density(newDensity) {
+			patchInput(INPUT_LEFT, SIGNAL_AUDIO);
+			patchInput(INPUT_RIGHT, SIGNAL_AUDIO);
+			patchInput(INPUT_POSITION, SIGNAL_CV);
+			patchInput(INPUT_TRIGGER, SIGNAL_GATE);
+
+			bufferLarge = new uint8_t[kCloudyBigBufferLength]();
+			bufferSmall = new uint8_t[kCloudySmallBufferLength]();
+			processor = new Processor();
+			memset(processor, 0, sizeof(*processor));
+			processor->Init(bufferLarge, kCloudyBigBufferLength, bufferSmall, kCloudySmallBufferLength);
+		}
+
+		~CloudyBench() {
+			delete processor;
+			delete[] bufferLarge;
+			delete[] bufferSmall;
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(32000.f, kCloudyMaxFrames, sampleRate);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			if (blockClock.tick()) {
+				ShortFrame input[kCloudyMaxFrames];
+				// The input resampler is not part of the measurement: hold the current input for the whole block.
+				int16_t left = toShort(inputs[INPUT_LEFT].getVoltageSum() / 5.f);
+				int16_t right = toShort(inputs[INPUT_RIGHT].getVoltageSum() / 5.f);
+				for (int frame = 0; frame < kCloudyMaxFrames; ++frame) {
+					input[frame].l = left;
+					input[frame].r = right;
+				}
+
+				processor->set_playback_mode(static_cast<PlaybackMode>(playbackMode));
+				processor->set_num_channels(2);
+				processor->set_low_fidelity(false);
+				processor->Prepare();
+
+				bool bTriggered = inputs[INPUT_TRIGGER].getVoltage() >= 1.f;
+
+				auto* parameters = processor->mutable_parameters();
+				parameters->position = 0.5f + inputs[INPUT_POSITION].getVoltage() / 10.f;
+				parameters->size = 0.5f;
+				parameters->pitch = 0.f;
+				parameters->density = density;
+				parameters->texture = 0.5f;
+				parameters->dry_wet = 0.5f;
+				parameters->stereo_spread = 0.5f;
+				parameters->feedback = 0.5f;
+				parameters->reverb = 0.5f;
+				parameters->freeze = false;
+				parameters->trigger = bTriggered;
+				parameters->gate = bTriggered;
+
+				processor->Process(input, outputFrames, kCloudyMaxFrames);
+			}
+
+			const int frame = blockClock.frameIndex();
+			outputs[OUTPUT_LEFT].setVoltage(5.f * outputFrames[frame].l / 32768.f);
+			outputs[OUTPUT_RIGHT].setVoltage(5.f * outputFrames[frame].r / 32768.f);
+		}
+
+		static int16_t toShort(float value) {
+			value *= 32767.f;
+			return value < -32768.f ? -32768 : (value > 32767.f ? 32767 : static_cast<int16_t>(value));
+		}
+	};
+}
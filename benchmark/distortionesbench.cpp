@@ -0,0 +1,33 @@
+#include "warpiesbench.hpp"
+
+#include "distortiones/dsp/distortiones_modulator.h"
+
+namespace sanguineBenchmark {
+	struct DistortionesBench : WarpiesBench<distortiones::DistortionesModulator, distortiones::FloatFrame> {
+		DistortionesBench() {
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				modulators[channel].Init(distortiones::kInternalOscillatorSampleRate);
+			}
+		}
+
+		void configure(int channel, const rack::ProcessArgs& args) override {
+			distortiones::Parameters* parameters = modulators[channel].mutable_parameters();
+			parameters->carrier_shape = 0;
+			parameters->channel_drive[0] = 1.f;
+			parameters->channel_drive[1] = 1.f;
+			parameters->raw_level[0] = 1.f;
+			parameters->raw_level[1] = 1.f;
+			parameters->raw_algorithm_pot = 0.25f;
+			parameters->raw_algorithm_cv = 0.f;
+			parameters->modulation_algorithm = 0.25f;
+			parameters->raw_algorithm = 0.25f;
+			parameters->modulation_parameter = getTimbre(channel);
+			parameters->note = 60.f + 12.f * 2.f + 12.f;
+			parameters->note += std::log2(distortiones::kInternalOscillatorSampleRate * args.sampleTime) * 12.f;
+		}
+	};
+
+	static BenchRegistrar distortionesRegistrar("Distortiones", true, []() -> ModuleBench* {
+		return new DistortionesBench();
+	});
+}
@@ -0,0 +1,23 @@
+#include "cloudybench.hpp"
+
+#include "clouds_parasite/dsp/etesia_granular_processor.h"
+
+namespace sanguineBenchmark {
+	typedef CloudyBench<etesia::EtesiaGranularProcessor, etesia::PlaybackMode, etesia::ShortFrame> EtesiaBench;
+
+	static BenchRegistrar etesiaRegistrar("Etesia", true, []() -> ModuleBench* {
+		return new EtesiaBench(etesia::PLAYBACK_MODE_GRANULAR);
+	});
+
+	static BenchRegistrar etesiaStretchRegistrar("Etesia:stretch", true, []() -> ModuleBench* {
+		return new EtesiaBench(etesia::PLAYBACK_MODE_STRETCH);
+	});
+
+	static BenchRegistrar etesiaSpectralRegistrar("Etesia:spectral", true, []() -> ModuleBench* {
+		return new EtesiaBench(etesia::PLAYBACK_MODE_SPECTRAL);
+	});
+
+	static BenchRegistrar etesiaOliverbRegistrar("Etesia:oliverb", true, []() -> ModuleBench* {
+		return new EtesiaBench(etesia::PLAYBACK_MODE_OLIVERB);
+	});
+}
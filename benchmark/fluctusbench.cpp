@@ -0,0 +1,23 @@
+#include "cloudybench.hpp"
+
+#include "fluctus/dsp/fluctus_granular_processor.h"
+
+namespace sanguineBenchmark {
+	typedef CloudyBench<fluctus::FluctusGranularProcessor, fluctus::PlaybackMode, fluctus::ShortFrame> FluctusBench;
+
+	static BenchRegistrar fluctusRegistrar("Fluctus", true, []() -> ModuleBench* {
+		return new FluctusBench(fluctus::PLAYBACK_MODE_GRANULAR);
+	});
+
+	static BenchRegistrar fluctusStretchRegistrar("Fluctus:stretch", true, []() -> ModuleBench* {
+		return new FluctusBench(fluctus::PLAYBACK_MODE_STRETCH);
+	});
+
+	static BenchRegistrar fluctusSpectralRegistrar("Fluctus:spectral", true, []() -> ModuleBench* {
+		return new FluctusBench(fluctus::PLAYBACK_MODE_SPECTRAL_CLOUD);
+	});
+
+	static BenchRegistrar fluctusKammerlRegistrar("Fluctus:kammerl", true, []() -> ModuleBench* {
+		return new FluctusBench(fluctus::PLAYBACK_MODE_KAMMERL);
+	});
+}
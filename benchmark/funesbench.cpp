@@ -0,0 +1,132 @@
+#include "benchmark.hpp"
+
+#include "plaits/dsp/voice.h"
+#include "plaits/user_data.h"
+
+namespace sanguineBenchmark {
+	// Funes: one plaits::Voice per channel, rendered in 12 frame blocks at 48 kHz and post-processed in groups of 4.
+	struct FunesBench : ModuleBench {
+		enum InputIds {
+			INPUT_NOTE,
+			INPUT_TRIGGER,
+			INPUT_TIMBRE,
+			INPUT_MORPH,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_OUT,
+			OUTPUT_AUX,
+			OUTPUTS_COUNT
+		};
+
+		static const int kBlockSize = 12;
+
+		plaits::Voice voices[PORT_MAX_CHANNELS];
+		plaits::PostProcessorBank postProcessors[PORT_MAX_CHANNELS / plaits::kPostProcessorBankVoices];
+		plaits::Patch patch = {};
+		plaits::UserData userData;
+		char voiceRam[PORT_MAX_CHANNELS][plaits::kVoiceRamSize] = {};
+
+		plaits::Voice::Frame outputFrames[PORT_MAX_CHANNELS][kBlockSize] = {};
+
+		BlockClock blockClock;
+
+		// Steps through the three six-op engines, one block each.
+		bool bCycleSixOpBanks;
+		// Steps through the 32 patches of a bank, one block each.
+		bool bCycleSixOpPatches;
+
+		explicit FunesBench(int engine, bool newCycleSixOpBanks = false, bool newCycleSixOpPatches = false) :
+			bCycleSixOpBanks(newCycleSixOpBanks), bCycleSixOpPatches(newCycleSixOpPatches) {
+			patchInput(INPUT_NOTE, SIGNAL_PITCH);
+			patchInput(INPUT_TRIGGER, SIGNAL_GATE);
+			patchInput(INPUT_TIMBRE, SIGNAL_CV);
+			patchInput(INPUT_MORPH, SIGNAL_CV);
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				voices[channel].Init(voiceRam[channel], &userData);
+			}
+
+			for (int bank = 0; bank < PORT_MAX_CHANNELS / plaits::kPostProcessorBankVoices; ++bank) {
+				postProcessors[bank].Init();
+			}
+
+			patch.engine = engine;
+			patch.note = 60.f;
+			patch.harmonics = 0.5f;
+			patch.timbre = 0.5f;
+			patch.morph = 0.5f;
+			patch.lpg_colour = 0.5f;
+			patch.decay = 0.5f;
+			patch.timbre_modulation_amount = 0.5f;
+			patch.morph_modulation_amount = 0.5f;
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(48000.f, kBlockSize, sampleRate);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			if (blockClock.tick()) {
+				if (bCycleSixOpBanks) {
+					patch.engine = patch.engine < 4 ? patch.engine + 1 : 2;
+				}
+				if (bCycleSixOpPatches) {
+					patch.harmonics = patch.harmonics < 0.95f ? patch.harmonics + 1.f / 32.f : 0.f;
+				}
+
+				for (int channel = 0; channel < channelCount; ++channel) {
+					plaits::Modulations modulations = {};
+					modulations.note = inputs[INPUT_NOTE].getVoltage(channel) * 12.f;
+					modulations.timbre_patched = true;
+					modulations.timbre = inputs[INPUT_TIMBRE].getPolyVoltage(channel) / 8.f;
+					modulations.morph_patched = true;
+					modulations.morph = inputs[INPUT_MORPH].getPolyVoltage(channel) / 8.f;
+					modulations.trigger_patched = true;
+					modulations.trigger = inputs[INPUT_TRIGGER].getPolyVoltage(channel) / 3.f;
+
+					voices[channel].RenderEngine(patch, modulations, kBlockSize);
+				}
+
+				plaits::Voice::RenderSixOpVoices(voices, channelCount);
+
+				for (int channel = 0; channel < channelCount; channel += plaits::kPostProcessorBankVoices) {
+					int voiceCount = channelCount - channel;
+					postProcessors[channel / plaits::kPostProcessorBankVoices].Process(&voices[channel],
+						voiceCount < plaits::kPostProcessorBankVoices ? voiceCount : plaits::kPostProcessorBankVoices,
+						outputFrames[channel], kBlockSize);
+				}
+			}
+
+			const int frame = blockClock.frameIndex();
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputs[OUTPUT_OUT].setVoltage(-outputFrames[channel][frame].out / 32768.f * 5.f, channel);
+				outputs[OUTPUT_AUX].setVoltage(-outputFrames[channel][frame].aux / 32768.f * 5.f, channel);
+			}
+			outputs[OUTPUT_OUT].setChannels(channelCount);
+			outputs[OUTPUT_AUX].setChannels(channelCount);
+		}
+	};
+
+	static BenchRegistrar funesRegistrar("Funes", true, []() -> ModuleBench* {
+		// Pair of classic waveforms: the module's default model.
+		return new FunesBench(8);
+	});
+
+	static BenchRegistrar funesSixOpRegistrar("Funes:sixop", true, []() -> ModuleBench* {
+		return new FunesBench(2);
+	});
+
+	static BenchRegistrar funesSixOpBanksRegistrar("Funes:sixop-banks", true, []() -> ModuleBench* {
+		return new FunesBench(2, true);
+	});
+
+	static BenchRegistrar funesSixOpPatchesRegistrar("Funes:sixop-patches", true, []() -> ModuleBench* {
+		return new FunesBench(2, false, true);
+	});
+
+	static BenchRegistrar funesModalRegistrar("Funes:modal", true, []() -> ModuleBench* {
+		return new FunesBench(20);
+	});
+}
@@ -0,0 +1,42 @@
+#include "warpiesbench.hpp"
+
+#include "warps/dsp/modulator.h"
+
+namespace sanguineBenchmark {
+	struct IncurvationesBench : WarpiesBench<warps::Modulator, warps::FloatFrame> {
+		explicit IncurvationesBench(bool easterEgg, bool staggerBlocks = false) {
+			bStaggerBlocks = staggerBlocks;
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				modulators[channel].Init(warps::kInternalOscillatorSampleRate);
+				modulators[channel].set_easter_egg(easterEgg);
+			}
+		}
+
+		void configure(int channel, const rack::ProcessArgs& args) override {
+			warps::Parameters* parameters = modulators[channel].mutable_parameters();
+			parameters->carrier_shape = 0;
+			parameters->channel_drive[0] = 1.f;
+			parameters->channel_drive[1] = 1.f;
+			parameters->modulation_algorithm = 0.25f;
+			parameters->modulation_parameter = getTimbre(channel);
+			parameters->frequency_shift_pot = 0.25f;
+			parameters->frequency_shift_cv = 0.f;
+			parameters->phase_shift = parameters->modulation_algorithm;
+			parameters->note = 60.f + 12.f * 2.f + 12.f;
+			parameters->note += std::log2(warps::kInternalOscillatorSampleRate * args.sampleTime) * 12.f;
+		}
+	};
+
+	static BenchRegistrar incurvationesRegistrar("Incurvationes", true, []() -> ModuleBench* {
+		return new IncurvationesBench(false);
+	});
+
+	static BenchRegistrar incurvationesShifterRegistrar("Incurvationes:shifter", true, []() -> ModuleBench* {
+		return new IncurvationesBench(true);
+	});
+
+	static BenchRegistrar incurvationesStaggeredRegistrar("Incurvationes:staggered", true, []() -> ModuleBench* {
+		return new IncurvationesBench(false, true);
+	});
+}
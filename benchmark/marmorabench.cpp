@@ -0,0 +1,139 @@
+#include "benchmark.hpp"
+
+#include "marbles/random/random_generator.h"
+#include "marbles/random/random_stream.h"
+#include "marbles/random/t_generator.h"
+#include "marbles/random/x_y_generator.h"
+#include "marbles/note_filter.h"
+
+namespace sanguineBenchmark {
+	// Marmora: the t and x/y generators of a single instance, stepped in 5 frame blocks at the host rate.
+	struct MarmoraBench : ModuleBench {
+		enum InputIds {
+			INPUT_T_CLOCK,
+			INPUT_X_CLOCK,
+			INPUT_X_SPREAD,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_T1,
+			OUTPUT_X1,
+			OUTPUT_Y,
+			OUTPUTS_COUNT
+		};
+
+		static const int kBlockSize = 5;
+
+		marbles::RandomGenerator randomGenerator;
+		marbles::RandomStream randomStream;
+		marbles::TGenerator tGenerator;
+		marbles::XYGenerator xyGenerator;
+		marbles::NoteFilter noteFilter;
+		marbles::Scale scale;
+
+		stmlib::GateFlags tClocks[kBlockSize] = {};
+		stmlib::GateFlags lastTClock = 0;
+		stmlib::GateFlags xyClocks[kBlockSize] = {};
+		stmlib::GateFlags lastXYClock = 0;
+
+		bool bGates[kBlockSize * 2] = {};
+		float rampMaster[kBlockSize] = {};
+		float rampExternal[kBlockSize] = {};
+		float rampSlave[2][kBlockSize] = {};
+		float voltages[kBlockSize * 4] = {};
+
+		bool bWantTReset = false;
+		bool bWantXReset = false;
+
+		int blockIndex = 0;
+
+		MarmoraBench() {
+			patchInput(INPUT_T_CLOCK, SIGNAL_GATE);
+			patchInput(INPUT_X_CLOCK, SIGNAL_GATE);
+			patchInput(INPUT_X_SPREAD, SIGNAL_CV);
+
+			randomGenerator.Init(1);
+			randomStream.Init(&randomGenerator);
+			noteFilter.Init();
+
+			// A chromatic scale stands in for the module's preset scales, which live with the module.
+			scale.base_interval = 1.f;
+			scale.num_degrees = 12;
+			for (int degree = 0; degree < 12; ++degree) {
+				scale.degree[degree].voltage = degree / 12.f;
+				scale.degree[degree].weight = 1.f;
+			}
+		}
+
+		void init(float sampleRate) override {
+			tGenerator.Init(&randomStream, sampleRate);
+			xyGenerator.Init(&randomStream, sampleRate);
+			xyGenerator.LoadScale(0, scale);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			tClocks[blockIndex] = lastTClock = stmlib::ExtractGateFlags(lastTClock,
+				inputs[INPUT_T_CLOCK].getVoltage() >= 1.7f);
+			xyClocks[blockIndex] = lastXYClock = stmlib::ExtractGateFlags(lastXYClock,
+				inputs[INPUT_X_CLOCK].getVoltage() >= 1.7f);
+
+			if (++blockIndex >= kBlockSize) {
+				blockIndex = 0;
+				stepBlock();
+			}
+
+			outputs[OUTPUT_T1].setVoltage(bGates[blockIndex * 2] ? 10.f : 0.f);
+			outputs[OUTPUT_X1].setVoltage(voltages[blockIndex * 4]);
+			outputs[OUTPUT_Y].setVoltage(voltages[blockIndex * 4 + 3]);
+		}
+
+		void stepBlock() {
+			marbles::Ramps ramps;
+			ramps.master = rampMaster;
+			ramps.external = rampExternal;
+			ramps.slave[0] = rampSlave[0];
+			ramps.slave[1] = rampSlave[1];
+
+			tGenerator.set_model(marbles::T_GENERATOR_MODEL_COMPLEMENTARY_BERNOULLI);
+			tGenerator.set_range(marbles::T_GENERATOR_RANGE_1X);
+			tGenerator.set_rate(0.f);
+			tGenerator.set_bias(0.5f);
+			tGenerator.set_jitter(0.25f);
+			tGenerator.set_deja_vu(0.f);
+			tGenerator.set_length(8);
+			tGenerator.set_pulse_width_mean(0.f);
+			tGenerator.set_pulse_width_std(0.f);
+			tGenerator.Process(false, &bWantTReset, tClocks, ramps, bGates, kBlockSize);
+
+			float noteCV = inputs[INPUT_X_SPREAD].getVoltage() / 5.f;
+
+			marbles::GroupSettings x;
+			x.control_mode = marbles::CONTROL_MODE_IDENTICAL;
+			x.voltage_range = marbles::VOLTAGE_RANGE_FULL;
+			x.register_mode = false;
+			x.register_value = noteFilter.Process(0.5f * (noteCV + 1.f));
+			x.spread = 0.5f;
+			x.bias = 0.5f;
+			x.steps = 0.75f;
+			x.deja_vu = 0.f;
+			x.length = 8;
+			x.ratio.p = 1;
+			x.ratio.q = 1;
+			x.scale_index = 0;
+
+			marbles::GroupSettings y = x;
+			y.register_value = 0.f;
+			y.steps = 0.5f;
+			y.length = 1;
+			y.ratio.q = 4;
+
+			xyGenerator.Process(marbles::CLOCK_SOURCE_INTERNAL_T1_T2_T3, x, y, &bWantXReset, xyClocks, ramps, voltages,
+				kBlockSize);
+		}
+	};
+
+	static BenchRegistrar marmoraRegistrar("Marmora", false, []() -> ModuleBench* {
+		return new MarmoraBench();
+	});
+}
@@ -0,0 +1,42 @@
+#include "warpiesbench.hpp"
+
+#include "mutuus/dsp/mutuus_modulator.h"
+
+namespace sanguineBenchmark {
+	struct MutuusBench : WarpiesBench<mutuus::MutuusModulator, mutuus::FloatFrame> {
+		uint16_t reverbBuffers[PORT_MAX_CHANNELS][32768] = {};
+
+		MutuusBench() {
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				modulators[channel].Init(mutuus::kInternalOscillatorSampleRate, reverbBuffers[channel]);
+			}
+		}
+
+		void configure(int channel, const rack::ProcessArgs& args) override {
+			mutuus::Parameters* parameters = modulators[channel].mutable_parameters();
+			parameters->carrier_shape = 0;
+			parameters->channel_drive[0] = 1.f;
+			parameters->channel_drive[1] = 1.f;
+			parameters->raw_level_cv[0] = 1.f;
+			parameters->raw_level_cv[1] = 1.f;
+			parameters->raw_level[0] = 1.f;
+			parameters->raw_level[1] = 1.f;
+			parameters->raw_level_pot[0] = 1.f;
+			parameters->raw_level_pot[1] = 1.f;
+			parameters->raw_algorithm_pot = 0.25f;
+			parameters->raw_algorithm_cv = 0.f;
+			parameters->modulation_algorithm = 0.25f;
+			parameters->raw_algorithm = 0.25f;
+			parameters->modulation_parameter = getTimbre(channel);
+			parameters->raw_modulation = parameters->modulation_parameter;
+			parameters->raw_modulation_pot = 0.5f;
+			parameters->raw_modulation_cv = 0.f;
+			parameters->note = 60.f + 12.f * 2.f + 12.f;
+			parameters->note += std::log2(mutuus::kInternalOscillatorSampleRate * args.sampleTime) * 12.f;
+		}
+	};
+
+	static BenchRegistrar mutuusRegistrar("Mutuus", true, []() -> ModuleBench* {
+		return new MutuusBench();
+	});
+}
@@ -0,0 +1,182 @@
+#include "cloudybench.hpp"
+
+#include "clouds/dsp/granular_processor.h"
+
+namespace sanguineBenchmark {
+	typedef CloudyBench<clouds::GranularProcessor, clouds::PlaybackMode, clouds::ShortFrame> NebulaeBench;
+
+	// Nebulae recording hi-fi audio into float buffers.
+	struct NebulaeFloatBench : NebulaeBench {
+		static const int kFloatBufferLength = 8 * 32000 * 2;
+
+		float* floatBuffer;
+
+		explicit NebulaeFloatBench(int newPlaybackMode) : NebulaeBench(newPlaybackMode) {
+			floatBuffer = new float[kFloatBufferLength]();
+			processor->set_float_buffer(floatBuffer, kFloatBufferLength);
+		}
+
+		~NebulaeFloatBench() {
+			delete[] floatBuffer;
+		}
+	};
+
+	/*
+	   Nebulae processing at the host rate. Compare with Nebulae plus the Resampler:32k round trip it saves; the native
+	   path is only valid up to 96 kHz.
+	*/
+	struct NebulaeNativeBench : NebulaeBench {
+		explicit NebulaeNativeBench(int newPlaybackMode) : NebulaeBench(newPlaybackMode) {}
+
+		void init(float sampleRate) override {
+			blockClock.init(sampleRate, kCloudyMaxFrames, sampleRate);
+			processor->set_sample_rate(sampleRate);
+		}
+	};
+
+	// Polyphonic Nebulae: one granular processor per channel, all sharing one reverb.
+	struct NebulaePolyBench : ModuleBench {
+		enum InputIds {
+			INPUT_LEFT,
+			INPUT_RIGHT,
+			INPUT_POSITION,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_LEFT,
+			OUTPUT_RIGHT,
+			OUTPUTS_COUNT
+		};
+
+		uint8_t* bufferLarge[PORT_MAX_CHANNELS];
+		uint8_t* bufferSmall[PORT_MAX_CHANNELS];
+
+		clouds::GranularProcessor* processors[PORT_MAX_CHANNELS];
+		clouds::ReverbBus* reverbBus;
+
+		clouds::ShortFrame outputFrames[PORT_MAX_CHANNELS][kCloudyMaxFrames] = {};
+
+		BlockClock blockClock;
+
+		NebulaePolyBench() {
+			patchInput(INPUT_LEFT, SIGNAL_AUDIO);
+			patchInput(INPUT_RIGHT, SIGNAL_AUDIO);
+			patchInput(INPUT_POSITION, SIGNAL_CV);
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				bufferLarge[channel] = new uint8_t[kCloudyBigBufferLength]();
+				bufferSmall[channel] = new uint8_t[kCloudySmallBufferLength]();
+				processors[channel] = new clouds::GranularProcessor();
+				memset(processors[channel], 0, sizeof(*processors[channel]));
+				processors[channel]->Init(bufferLarge[channel], kCloudyBigBufferLength,
+					bufferSmall[channel], kCloudySmallBufferLength);
+			}
+
+			reverbBus = new clouds::ReverbBus();
+			memset(reverbBus, 0, sizeof(*reverbBus));
+			reverbBus->Init();
+		}
+
+		~NebulaePolyBench() {
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				delete processors[channel];
+				delete[] bufferLarge[channel];
+				delete[] bufferSmall[channel];
+			}
+			delete reverbBus;
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(32000.f, kCloudyMaxFrames, sampleRate);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			if (blockClock.tick()) {
+				clouds::ShortFrame input[PORT_MAX_CHANNELS][kCloudyMaxFrames];
+
+				reverbBus->Clear();
+				for (int channel = 0; channel < channelCount; ++channel) {
+					int16_t left = NebulaeBench::toShort(inputs[INPUT_LEFT].getVoltage(channel) / 5.f);
+					int16_t right = NebulaeBench::toShort(inputs[INPUT_RIGHT].getVoltage(channel) / 5.f);
+					for (int frame = 0; frame < kCloudyMaxFrames; ++frame) {
+						input[channel][frame].l = left;
+						input[channel][frame].r = right;
+					}
+
+					clouds::GranularProcessor* processor = processors[channel];
+					processor->set_playback_mode(clouds::PLAYBACK_MODE_GRANULAR);
+					processor->set_num_channels(2);
+					processor->set_low_fidelity(false);
+					processor->Prepare();
+
+					clouds::Parameters* parameters = processor->mutable_parameters();
+					parameters->position = 0.5f + inputs[INPUT_POSITION].getVoltage(channel) / 10.f;
+					parameters->size = 0.5f;
+					parameters->pitch = 0.f;
+					parameters->density = 0.7f;
+					parameters->texture = 0.5f;
+					parameters->dry_wet = 0.5f;
+					parameters->stereo_spread = 0.5f;
+					parameters->feedback = 0.5f;
+					parameters->reverb = 0.5f;
+					parameters->freeze = false;
+					parameters->trigger = false;
+					parameters->gate = false;
+
+					processor->Render(input[channel], kCloudyMaxFrames, reverbBus);
+				}
+				reverbBus->Process(kCloudyMaxFrames);
+				for (int channel = 0; channel < channelCount; ++channel) {
+					processors[channel]->Mix(input[channel], outputFrames[channel], kCloudyMaxFrames, reverbBus);
+				}
+			}
+
+			const int frame = blockClock.frameIndex();
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputs[OUTPUT_LEFT].setVoltage(5.f * outputFrames[channel][frame].l / 32768.f, channel);
+				outputs[OUTPUT_RIGHT].setVoltage(5.f * outputFrames[channel][frame].r / 32768.f, channel);
+			}
+			outputs[OUTPUT_LEFT].setChannels(channelCount);
+			outputs[OUTPUT_RIGHT].setChannels(channelCount);
+		}
+	};
+
+	static BenchRegistrar nebulaeRegistrar("Nebulae", true, []() -> ModuleBench* {
+		return new NebulaeBench(clouds::PLAYBACK_MODE_GRANULAR);
+	});
+
+	static BenchRegistrar nebulaeDenseRegistrar("Nebulae:dense", true, []() -> ModuleBench* {
+		return new NebulaeBench(clouds::PLAYBACK_MODE_GRANULAR, 1.f);
+	});
+
+	static BenchRegistrar nebulaeDesktopRegistrar("Nebulae:desktop", true, []() -> ModuleBench* {
+		NebulaeBench* bench = new NebulaeBench(clouds::PLAYBACK_MODE_GRANULAR, 1.f);
+		bench->processor->set_grain_budget(clouds::GRAIN_BUDGET_DESKTOP);
+		return bench;
+	});
+
+	static BenchRegistrar nebulaePolyRegistrar("Nebulae:poly", true, []() -> ModuleBench* {
+		return new NebulaePolyBench();
+	});
+
+	static BenchRegistrar nebulaeFloatRegistrar("Nebulae:float", true, []() -> ModuleBench* {
+		return new NebulaeFloatBench(clouds::PLAYBACK_MODE_GRANULAR);
+	});
+
+	static BenchRegistrar nebulaeNativeRegistrar("Nebulae:native", true, []() -> ModuleBench* {
+		return new NebulaeNativeBench(clouds::PLAYBACK_MODE_GRANULAR);
+	});
+
+	static BenchRegistrar nebulaeStretchRegistrar("Nebulae:stretch", true, []() -> ModuleBench* {
+		return new NebulaeBench(clouds::PLAYBACK_MODE_STRETCH);
+	});
+
+	static BenchRegistrar nebulaeLoopingRegistrar("Nebulae:looping", true, []() -> ModuleBench* {
+		return new NebulaeBench(clouds::PLAYBACK_MODE_LOOPING_DELAY);
+	});
+
+	static BenchRegistrar nebulaeSpectralRegistrar("Nebulae:spectral", true, []() -> ModuleBench* {
+		return new NebulaeBench(clouds::PLAYBACK_MODE_SPECTRAL);
+	});
+}
@@ -0,0 +1,176 @@
+#include <cstring>
+
+#include "benchmark.hpp"
+
+#include "braids/macro_oscillator.h"
+#include "braids/signature_waveshaper.h"
+#include "braids/vco_jitter_source.h"
+#include "braids/envelope.h"
+#include "braids/quantizer.h"
+#include "braids/quantizer_scales.h"
+
+#include "renaissance/renaissance_macro_oscillator.h"
+#include "renaissance/renaissance_signature_waveshaper.h"
+#include "renaissance/renaissance_vco_jitter_source.h"
+#include "renaissance/renaissance_envelope.h"
+#include "renaissance/renaissance_quantizer.h"
+#include "renaissance/renaissance_quantizer_scales.h"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+namespace sanguineBenchmark {
+	struct BraidsTypes {
+		typedef braids::MacroOscillator MacroOscillator;
+		typedef braids::MacroOscillatorShape MacroOscillatorShape;
+		typedef braids::SignatureWaveshaper SignatureWaveshaper;
+		typedef braids::VcoJitterSource VcoJitterSource;
+		typedef braids::Envelope Envelope;
+		typedef braids::Quantizer Quantizer;
+
+		static const braids::Scale& scale(int index) {
+			return braids::scales[index];
+		}
+
+		static void triggerAttack(Envelope& envelope) {
+			envelope.Trigger(braids::ENV_SEGMENT_ATTACK);
+		}
+	};
+
+	struct RenaissanceTypes {
+		typedef renaissance::MacroOscillator MacroOscillator;
+		typedef renaissance::MacroOscillatorShape MacroOscillatorShape;
+		typedef renaissance::SignatureWaveshaper SignatureWaveshaper;
+		typedef renaissance::VcoJitterSource VcoJitterSource;
+		typedef renaissance::Envelope Envelope;
+		typedef renaissance::Quantizer Quantizer;
+
+		static const renaissance::Scale& scale(int index) {
+			return renaissance::scales[index];
+		}
+
+		static void triggerAttack(Envelope& envelope) {
+			envelope.Trigger(renaissance::ENV_SEGMENT_ATTACK);
+		}
+	};
+
+	/*
+	   Nodi and Contextus: one macro oscillator per channel with its AD envelope, quantizer, drift and signature
+	   waveshaper, rendered in 24 frame blocks at 96 kHz.
+	*/
+	template <typename Types>
+	struct MacroOscillatorBench : ModuleBench {
+		enum InputIds {
+			INPUT_TRIGGER,
+			INPUT_PITCH,
+			INPUT_TIMBRE,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_OUT,
+			OUTPUTS_COUNT
+		};
+
+		static const int kBlockSize = 24;
+
+		typename Types::MacroOscillator oscillators[PORT_MAX_CHANNELS];
+		typename Types::SignatureWaveshaper waveShapers[PORT_MAX_CHANNELS];
+		typename Types::VcoJitterSource jitterSources[PORT_MAX_CHANNELS];
+		typename Types::Envelope envelopes[PORT_MAX_CHANNELS];
+		typename Types::Quantizer quantizers[PORT_MAX_CHANNELS];
+
+		int16_t renderBuffers[PORT_MAX_CHANNELS][kBlockSize] = {};
+		uint16_t gainLps[PORT_MAX_CHANNELS] = {};
+		bool lastTriggers[PORT_MAX_CHANNELS] = {};
+
+		int shape;
+
+		BlockClock blockClock;
+
+		explicit MacroOscillatorBench(int newShape) : shape(newShape) {
+			patchInput(INPUT_TRIGGER, SIGNAL_GATE);
+			patchInput(INPUT_PITCH, SIGNAL_PITCH);
+			patchInput(INPUT_TIMBRE, SIGNAL_CV);
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				memset(&oscillators[channel], 0, sizeof(oscillators[channel]));
+				memset(&quantizers[channel], 0, sizeof(quantizers[channel]));
+				memset(&envelopes[channel], 0, sizeof(envelopes[channel]));
+				memset(&jitterSources[channel], 0, sizeof(jitterSources[channel]));
+				memset(&waveShapers[channel], 0, sizeof(waveShapers[channel]));
+
+				oscillators[channel].Init();
+				quantizers[channel].Init();
+				envelopes[channel].Init();
+				jitterSources[channel].Init();
+				waveShapers[channel].Init(0x0ba7);
+
+				quantizers[channel].Configure(Types::scale(1));
+			}
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(96000.f, kBlockSize, sampleRate);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			bool bWantRender = blockClock.tick();
+
+			for (int channel = 0; channel < channelCount; ++channel) {
+				bool bTriggerInput = inputs[INPUT_TRIGGER].getVoltage(channel) >= 1.f;
+				bool bTriggered = bTriggerInput && !lastTriggers[channel];
+				lastTriggers[channel] = bTriggerInput;
+
+				if (bWantRender) {
+					envelopes[channel].Update(4 * 8, 7 * 8);
+					uint32_t adValue = envelopes[channel].Render();
+
+					oscillators[channel].set_shape(static_cast<typename Types::MacroOscillatorShape>(shape));
+
+					float timbre = 0.5f + inputs[INPUT_TIMBRE].getVoltage(channel) / 10.f;
+					timbre = timbre < 0.f ? 0.f : (timbre > 1.f ? 1.f : timbre);
+					oscillators[channel].set_parameters(static_cast<int16_t>(timbre * 32767.f), 16384);
+
+					int32_t pitch = (inputs[INPUT_PITCH].getVoltage(channel) * 12.f + 60.f) * 128.f;
+					pitch = quantizers[channel].Process(pitch, 60 << 7);
+					pitch += jitterSources[channel].Render(1);
+					pitch = pitch < 0 ? 0 : (pitch > 16383 ? 16383 : pitch);
+					oscillators[channel].set_pitch(pitch);
+
+					if (bTriggered) {
+						oscillators[channel].Strike();
+						Types::triggerAttack(envelopes[channel]);
+					}
+
+					const uint8_t syncBuffer[kBlockSize] = {};
+					oscillators[channel].Render(syncBuffer, renderBuffers[channel], kBlockSize);
+
+					// Signature waveshaping and VCA, as in the modules, with no decimation or bit reduction.
+					int32_t gain = adValue;
+					uint16_t signature = 4095;
+					for (int frame = 0; frame < kBlockSize; ++frame) {
+						int16_t sample = renderBuffers[channel][frame] * gainLps[channel] >> 16;
+						gainLps[channel] += (gain - gainLps[channel]) >> 4;
+						int16_t warped = waveShapers[channel].Transform(sample);
+						renderBuffers[channel][frame] = stmlib::Mix(sample, warped, signature);
+					}
+				}
+
+				outputs[OUTPUT_OUT].setVoltage(5.f * renderBuffers[channel][blockClock.frameIndex()] / 32768.f, channel);
+			}
+			outputs[OUTPUT_OUT].setChannels(channelCount);
+		}
+	};
+
+	static BenchRegistrar nodiRegistrar("Nodi", true, []() -> ModuleBench* {
+		return new MacroOscillatorBench<BraidsTypes>(braids::MACRO_OSC_SHAPE_CSAW);
+	});
+
+	static BenchRegistrar nodiPluckRegistrar("Nodi:pluk", true, []() -> ModuleBench* {
+		return new MacroOscillatorBench<BraidsTypes>(braids::MACRO_OSC_SHAPE_PLUCKED);
+	});
+
+	static BenchRegistrar contextusRegistrar("Contextus", true, []() -> ModuleBench* {
+		return new MacroOscillatorBench<RenaissanceTypes>(renaissance::MACRO_OSC_SHAPE_CSAW);
+	});
+}
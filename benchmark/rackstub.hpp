@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+   Just enough of Rack's engine types for the benchmark drivers to read inputs and write outputs
+   the way the modules do, without linking against the Rack SDK.
+*/
+
+namespace rack {
+	static const int PORT_MAX_CHANNELS = 16;
+
+	struct ProcessArgs {
+		float sampleRate;
+		float sampleTime;
+		int64_t frame;
+	};
+
+	struct Port {
+		float voltages[PORT_MAX_CHANNELS] = {};
+		uint8_t channels = 0;
+
+		float getVoltage(int channel = 0) const {
+			return voltages[channel];
+		}
+
+		float getPolyVoltage(int channel) const {
+			return isMonophonic() ? getVoltage(0) : getVoltage(channel);
+		}
+
+		float getNormalVoltage(float normalVoltage, int channel = 0) const {
+			return isConnected() ? getVoltage(channel) : normalVoltage;
+		}
+
+		float getVoltageSum() const {
+			float sum = 0.f;
+			for (int channel = 0; channel < channels; ++channel) {
+				sum += voltages[channel];
+			}
+			return sum;
+		}
+
+		void setVoltage(float voltage, int channel = 0) {
+			voltages[channel] = voltage;
+		}
+
+		int getChannels() const {
+			return channels;
+		}
+
+		void setChannels(int newChannels) {
+			channels = newChannels;
+		}
+
+		bool isConnected() const {
+			return channels > 0;
+		}
+
+		bool isMonophonic() const {
+			return channels == 1;
+		}
+	};
+
+	typedef Port Input;
+	typedef Port Output;
+}
@@ -0,0 +1,102 @@
+#include "benchmark.hpp"
+
+#include "../src/resamplercommon.hpp"
+
+namespace sanguineBenchmark {
+	/*
+	   The round trip the fixed-rate modules make: every channel's input resampled to the internal rate, and a stereo
+	   pair per channel resampled back to the host rate, one block at a time.
+	*/
+	struct ResamplerBench : ModuleBench {
+		enum InputIds {
+			INPUT_IN
+		};
+
+		enum OutputIds {
+			OUTPUT_LEFT,
+			OUTPUT_RIGHT
+		};
+
+		template <int CHANNELS>
+		struct Frame {
+			float samples[CHANNELS];
+		};
+
+		static const int kBlockSize = 32;
+		static const int kMaxHostFrames = 256;
+
+		resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS> srcInput;
+		resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS * 2> srcOutput;
+
+		Frame<PORT_MAX_CHANNELS> hostInputs[kMaxHostFrames] = {};
+		Frame<PORT_MAX_CHANNELS * 2> hostOutputs[kMaxHostFrames] = {};
+		int hostInputCount = 0;
+		int hostOutputCount = 0;
+		int hostOutputIndex = 0;
+
+		int internalRate;
+
+		BlockClock blockClock;
+
+		explicit ResamplerBench(int newInternalRate) : internalRate(newInternalRate) {
+			patchInput(INPUT_IN, SIGNAL_AUDIO);
+		}
+
+		void init(float sampleRate) override {
+			blockClock.init(internalRate, kBlockSize, sampleRate);
+			srcInput.setRates(static_cast<int>(sampleRate), internalRate);
+			srcOutput.setRates(internalRate, static_cast<int>(sampleRate));
+			srcInput.setChannels(channelCount);
+			srcOutput.setChannels(channelCount * 2);
+		}
+
+		void process(const rack::ProcessArgs& args) override {
+			if (hostInputCount < kMaxHostFrames) {
+				for (int channel = 0; channel < channelCount; ++channel) {
+					hostInputs[hostInputCount].samples[channel] = inputs[INPUT_IN].getVoltage(channel) / 5.f;
+				}
+				++hostInputCount;
+			}
+
+			if (blockClock.tick()) {
+				Frame<PORT_MAX_CHANNELS> internalInputs[kBlockSize] = {};
+				int inCount = hostInputCount;
+				int outCount = kBlockSize;
+				srcInput.process(hostInputs, &inCount, internalInputs, &outCount);
+				std::copy(&hostInputs[inCount], &hostInputs[hostInputCount], &hostInputs[0]);
+				hostInputCount -= inCount;
+
+				Frame<PORT_MAX_CHANNELS * 2> internalOutputs[kBlockSize];
+				for (int frame = 0; frame < kBlockSize; ++frame) {
+					for (int channel = 0; channel < channelCount; ++channel) {
+						internalOutputs[frame].samples[channel * 2 + 0] = internalInputs[frame].samples[channel];
+						internalOutputs[frame].samples[channel * 2 + 1] = -internalInputs[frame].samples[channel];
+					}
+				}
+
+				inCount = kBlockSize;
+				outCount = kMaxHostFrames;
+				srcOutput.process(internalOutputs, &inCount, hostOutputs, &outCount);
+				hostOutputCount = outCount;
+				hostOutputIndex = 0;
+			}
+
+			const int frame = std::min(hostOutputIndex, std::max(hostOutputCount - 1, 0));
+			++hostOutputIndex;
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputs[OUTPUT_LEFT].setVoltage(hostOutputs[frame].samples[channel * 2 + 0] * 5.f, channel);
+				outputs[OUTPUT_RIGHT].setVoltage(hostOutputs[frame].samples[channel * 2 + 1] * 5.f, channel);
+			}
+			outputs[OUTPUT_LEFT].setChannels(channelCount);
+			outputs[OUTPUT_RIGHT].setChannels(channelCount);
+		}
+	};
+
+	static BenchRegistrar resamplerRegistrar("Resampler", true, []() -> ModuleBench* {
+		return new ResamplerBench(48000);
+	});
+
+	static BenchRegistrar resampler32kRegistrar("Resampler:32k", true, []() -> ModuleBench* {
+		return new ResamplerBench(32000);
+	});
+}
@@ -0,0 +1,28 @@
+#include "warpiesbench.hpp"
+
+#include "scalaria/dsp/scalaria_modulator.h"
+
+namespace sanguineBenchmark {
+	struct ScalariaBench : WarpiesBench<scalaria::ScalariaModulator, scalaria::FloatFrame> {
+		ScalariaBench() {
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				modulators[channel].Init(scalaria::kInternalOscillatorSampleRate);
+			}
+		}
+
+		void configure(int channel, const rack::ProcessArgs& args) override {
+			scalaria::Parameters* parameters = modulators[channel].mutableParameters();
+			parameters->oscillatorShape = 0;
+			parameters->channel_drive[0] = 1.f;
+			parameters->channel_drive[1] = 1.f;
+			parameters->rawFrequency = getTimbre(channel);
+			parameters->rawResonance = 0.5f;
+			parameters->note = 60.f + 12.f * 2.f + 12.f;
+			parameters->note += std::log2(scalaria::kInternalOscillatorSampleRate * args.sampleTime) * 12.f;
+		}
+	};
+
+	static BenchRegistrar scalariaRegistrar("Scalaria", true, []() -> ModuleBench* {
+		return new ScalariaBench();
+	});
+}
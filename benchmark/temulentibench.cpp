@@ -0,0 +1,66 @@
+#include "aestusbench.hpp"
+
+#include "bumps/bumps_generator.h"
+
+namespace sanguineBenchmark {
+	struct BumpsControl {
+		static const uint8_t CONTROL_GATE = bumps::CONTROL_GATE;
+		static const uint8_t CONTROL_GATE_RISING = bumps::CONTROL_GATE_RISING;
+		static const uint8_t CONTROL_GATE_FALLING = bumps::CONTROL_GATE_FALLING;
+	};
+
+	// Temulenti: a single bumps::Generator, refilled whenever a block becomes writable.
+	struct TemulentiBench : ModuleBench {
+		bumps::Generator generator;
+
+		uint8_t lastGate = 0;
+
+		explicit TemulentiBench(bumps::Generator::FeatureMode featureMode) {
+			patchInput(INPUT_AESTUS_PITCH, SIGNAL_PITCH);
+			patchInput(INPUT_AESTUS_SHAPE, SIGNAL_CV);
+			patchInput(INPUT_AESTUS_TRIGGER, SIGNAL_GATE);
+
+			generator.Init();
+			generator.feature_mode_ = featureMode;
+			generator.set_mode(bumps::GENERATOR_MODE_LOOPING);
+			generator.set_range(bumps::GENERATOR_RANGE_HIGH);
+		}
+
+		void init(float sampleRate) override {}
+
+		void process(const rack::ProcessArgs& args) override {
+			if (generator.writable_block()) {
+				float pitchParam = 12.f * inputs[INPUT_AESTUS_PITCH].getVoltage() + 60.f;
+				int32_t pitch = static_cast<int32_t>(pitchParam * 128);
+				// Scale to the global sample rate.
+				pitch += log2f(48000.f / args.sampleRate) * 12.f * 128;
+				pitch = pitch < -32768 ? -32768 : (pitch > 32767 ? 32767 : pitch);
+
+				if (generator.feature_mode_ == bumps::Generator::FEAT_MODE_HARMONIC) {
+					generator.set_pitch_high_range(pitch, 0);
+				} else {
+					generator.set_pitch(pitch, 0);
+				}
+
+				generator.set_shape(getAestusShape(inputs[INPUT_AESTUS_SHAPE].getVoltage()));
+				generator.set_slope(0);
+				generator.set_smoothness(0);
+
+				generator.FillBuffer();
+			}
+
+			uint8_t gate = getAestusGate<BumpsControl>(inputs[INPUT_AESTUS_TRIGGER].getVoltage(), lastGate);
+			const bumps::GeneratorSample& sample = generator.Process(gate);
+			outputs[OUTPUT_AESTUS_UNI].setVoltage(static_cast<float>(sample.unipolar) / 65535 * 8.f);
+			outputs[OUTPUT_AESTUS_BI].setVoltage(static_cast<float>(-sample.bipolar) / 32768 * 5.f);
+		}
+	};
+
+	static BenchRegistrar temulentiRegistrar("Temulenti", false, []() -> ModuleBench* {
+		return new TemulentiBench(bumps::Generator::FEAT_MODE_FUNCTION);
+	});
+
+	static BenchRegistrar temulentiHarmonicRegistrar("Temulenti:harmonic", false, []() -> ModuleBench* {
+		return new TemulentiBench(bumps::Generator::FEAT_MODE_HARMONIC);
+	});
+}
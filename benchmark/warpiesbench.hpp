@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cmath>
+#include <cstring>
+
+#include "benchmark.hpp"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+namespace sanguineBenchmark {
+	static const int kWarpiesBlockSize = 60;
+
+	/*
+	   Incurvationes, Distortiones, Mutuus and Scalaria: one modulator per channel working in 60 frame blocks at the
+	   host rate, with float frames in and out.
+	*/
+	template <typename Modulator, typename FloatFrame>
+	struct WarpiesBench : ModuleBench {
+		enum InputIds {
+			INPUT_CARRIER,
+			INPUT_MODULATOR,
+			INPUT_TIMBRE,
+			INPUTS_COUNT
+		};
+
+		enum OutputIds {
+			OUTPUT_MODULATOR,
+			OUTPUT_AUX,
+			OUTPUTS_COUNT
+		};
+
+		Modulator modulators[PORT_MAX_CHANNELS];
+		FloatFrame inputFrames[PORT_MAX_CHANNELS][kWarpiesBlockSize] = {};
+		FloatFrame outputFrames[PORT_MAX_CHANNELS][kWarpiesBlockSize] = {};
+
+		int frames[PORT_MAX_CHANNELS] = {};
+		// Mirrors the modules' "Stagger channel blocks" option.
+		bool bStaggerBlocks = false;
+		int blockPhasesChannelCount = 0;
+
+		WarpiesBench() {
+			patchInput(INPUT_CARRIER, SIGNAL_AUDIO);
+			patchInput(INPUT_MODULATOR, SIGNAL_AUDIO);
+			patchInput(INPUT_TIMBRE, SIGNAL_CV);
+
+			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+				memset(&modulators[channel], 0, sizeof(Modulator));
+			}
+		}
+
+		void init(float sampleRate) override {}
+
+		virtual void configure(int channel, const rack::ProcessArgs& args) = 0;
+
+		void process(const rack::ProcessArgs& args) override {
+			int phasesChannelCount = bStaggerBlocks ? channelCount : 0;
+			if (phasesChannelCount != blockPhasesChannelCount) {
+				for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+					frames[channel] = bStaggerBlocks ? (channel % channelCount) * kWarpiesBlockSize / channelCount :
+						frames[0];
+				}
+				blockPhasesChannelCount = phasesChannelCount;
+			}
+
+			for (int channel = 0; channel < channelCount; ++channel) {
+				if (++frames[channel] >= kWarpiesBlockSize) {
+					frames[channel] = 0;
+
+					configure(channel, args);
+
+					modulators[channel].Process(inputFrames[channel], outputFrames[channel], kWarpiesBlockSize);
+				}
+
+				inputFrames[channel][frames[channel]].l = clamp(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f);
+				inputFrames[channel][frames[channel]].r = clamp(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f);
+
+				outputs[OUTPUT_MODULATOR].setVoltage(outputFrames[channel][frames[channel]].l * 5.f, channel);
+				outputs[OUTPUT_AUX].setVoltage(outputFrames[channel][frames[channel]].r * 5.f, channel);
+			}
+			outputs[OUTPUT_MODULATOR].setChannels(channelCount);
+			outputs[OUTPUT_AUX].setChannels(channelCount);
+		}
+
+		float getTimbre(int channel) const {
+			float timbre = 0.5f + inputs[INPUT_TIMBRE].getVoltage(channel) / 5.f;
+			return timbre < 0.f ? 0.f : (timbre > 1.f ? 1.f : timbre);
+		}
+
+		static float clamp(float value) {
+			return value < -1.f ? -1.f : (value > 1.f ? 1.f : value);
+		}
+	};
+}
@@ -40,6 +40,7 @@
 
 const int32_t kCrossFadeSize = 256;
 const int32_t kInterpolationTail = 8;
+const int32_t kReadBlockSize = 32;
 
 namespace clouds {
 
@@ -48,6 +49,7 @@ namespace clouds {
     RESOLUTION_8_BIT,
     RESOLUTION_8_BIT_DITHERED,
     RESOLUTION_8_BIT_MU_LAW,
+    RESOLUTION_32_BIT_FLOAT,
   };
 
   enum InterpolationMethod {
@@ -56,20 +58,37 @@ namespace clouds {
     INTERPOLATION_HERMITE
   };
 
+  // Type of the samples as stored: decoded, but not yet scaled.
+  template<Resolution resolution>
+  struct StoredSample {
+    typedef int16_t Type;
+  };
+
+  template<>
+  struct StoredSample<RESOLUTION_32_BIT_FLOAT> {
+    typedef float Type;
+  };
+
   template<Resolution resolution>
   class AudioBuffer {
   public:
+    typedef typename StoredSample<resolution>::Type Sample;
+
     AudioBuffer() {}
     ~AudioBuffer() {}
 
+    // size is in samples.
     void Init(void* buffer, int32_t size, int16_t* tail_buffer) {
+      f32_ = static_cast<float*>(buffer);
       s16_ = static_cast<int16_t*>(buffer);
       s8_ = static_cast<int8_t*>(buffer);
       size_ = size - kInterpolationTail;
       write_head_ = 0;
       quantization_error_ = 0.0f;
       crossfade_counter_ = 0;
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        std::fill(&f32_[0], &f32_[size], 0.0f);
+      } else if (resolution == RESOLUTION_16_BIT) {
         std::fill(&s16_[0], &s16_[size], 0);
       } else {
         std::fill(&s8_[0], &s8_[size], resolution == RESOLUTION_8_BIT_MU_LAW ? 127 : 0);
@@ -83,7 +102,9 @@ namespace clouds {
     }
 
     inline void Write(float in) {
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        f32_[write_head_] = in;
+      } else if (resolution == RESOLUTION_16_BIT) {
         s16_[write_head_] = stmlib::Clip16(static_cast<int32_t>(in * 32768.0f));
       } else if (resolution == RESOLUTION_8_BIT_DITHERED) {
         float sample = in * 127.0f;
@@ -103,7 +124,11 @@ namespace clouds {
         s8_[write_head_] = static_cast<int8_t>(stmlib::Clip16(in * 32768.0f) >> 8);
       }
 
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        if (write_head_ < kInterpolationTail) {
+          f32_[write_head_ + size_] = f32_[write_head_];
+        }
+      } else if (resolution == RESOLUTION_16_BIT) {
         if (write_head_ < kInterpolationTail) {
           s16_[write_head_ + size_] = s16_[write_head_];
         }
@@ -130,6 +155,14 @@ namespace clouds {
             }
           }
         }
+      } else if (!crossfade_counter_ && resolution == RESOLUTION_32_BIT_FLOAT &&
+        write_head_ >= kInterpolationTail && write_head_ < (size_ - size)) {
+        // Fast write routine for the most common case.
+        while (size--) {
+          f32_[write_head_] = *in;
+          ++write_head_;
+          in += stride;
+        }
       } else if (!crossfade_counter_ && resolution == RESOLUTION_16_BIT &&
         write_head_ >= kInterpolationTail && write_head_ < (size_ - size)) {
         // Fast write routine for the most common case.
@@ -154,7 +187,14 @@ namespace clouds {
     }
 
     inline void Write(const float* in, int32_t size, int32_t stride) {
-      if (resolution == RESOLUTION_16_BIT && write_head_ >= kInterpolationTail &&
+      if (resolution == RESOLUTION_32_BIT_FLOAT && write_head_ >= kInterpolationTail &&
+        write_head_ < (size_ - size)) {
+        while (size--) {
+          f32_[write_head_] = *in;
+          ++write_head_;
+          in += stride;
+        }
+      } else if (resolution == RESOLUTION_16_BIT && write_head_ >= kInterpolationTail &&
         write_head_ < (size_ - size)) {
         // Fast write routine for the most common case.
         while (size--) {
@@ -187,7 +227,10 @@ namespace clouds {
       }
 
       float x0, scale;
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        x0 = f32_[integral];
+        scale = 1.0f;
+      } else if (resolution == RESOLUTION_16_BIT) {
         x0 = s16_[integral];
         scale = kScaleBig;
       } else if (resolution == RESOLUTION_8_BIT_MU_LAW) {
@@ -207,7 +250,11 @@ namespace clouds {
 
       float x0, x1, scale;
       float t = static_cast<float>(fractional) / 65536.0f;
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        x0 = f32_[integral];
+        x1 = f32_[integral + 1];
+        scale = 1.0f;
+      } else if (resolution == RESOLUTION_16_BIT) {
         x0 = s16_[integral];
         x1 = s16_[integral + 1];
         scale = kScaleBig;
@@ -231,7 +278,13 @@ namespace clouds {
       float xm1, x0, x1, x2, scale;
       float t = static_cast<float>(fractional) / 65536.0f;
 
-      if (resolution == RESOLUTION_16_BIT) {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        xm1 = f32_[integral];
+        x0 = f32_[integral + 1];
+        x1 = f32_[integral + 2];
+        x2 = f32_[integral + 3];
+        scale = 1.0f;
+      } else if (resolution == RESOLUTION_16_BIT) {
         xm1 = s16_[integral];
         x0 = s16_[integral + 1];
         x1 = s16_[integral + 2];
@@ -260,6 +313,87 @@ namespace clouds {
       return ((((a * t) - b_neg) * t + c) * t + x0) * scale;
     }
 
+    /* Reads size samples, the first one at first_sample + phase / 65536, each
+       one phase_increment / 65536 samples after the previous one. The taps are
+       gathered first, then all samples are interpolated in a single pass that
+       vectorizes. */
+    template<InterpolationMethod method>
+    inline void Read(int32_t first_sample, int32_t phase, int32_t phase_increment, float* out,
+      size_t size) const {
+      int32_t integral[kReadBlockSize];
+      float t[kReadBlockSize];
+      Sample xm1[kReadBlockSize];
+      Sample x0[kReadBlockSize];
+      Sample x1[kReadBlockSize];
+      Sample x2[kReadBlockSize];
+
+      const float scale = resolution == RESOLUTION_32_BIT_FLOAT ? 1.0f :
+        resolution == RESOLUTION_16_BIT || resolution == RESOLUTION_8_BIT_MU_LAW ? kScaleBig :
+        kScaleSmall;
+      const int32_t buffer_size = size_;
+      while (size) {
+        int32_t block_size = size < kReadBlockSize ? size : kReadBlockSize;
+        for (int32_t i = 0; i < block_size; ++i) {
+          int32_t sample_phase = phase + i * phase_increment;
+          int32_t index = first_sample + (sample_phase >> 16);
+          integral[i] = index >= buffer_size ? index - buffer_size : index;
+          t[i] = static_cast<float>(sample_phase & 65535) * (1.0f / 65536.0f);
+        }
+
+        if (resolution == RESOLUTION_32_BIT_FLOAT) {
+          ReadFloat<method>(integral, t, out, block_size);
+          phase += block_size * phase_increment;
+          out += block_size;
+          size -= block_size;
+          continue;
+        }
+
+        for (int32_t i = 0; i < block_size; ++i) {
+          const int32_t index = integral[i];
+          if (method == INTERPOLATION_ZOH) {
+            x0[i] = Stored(index);
+          } else if (method == INTERPOLATION_LINEAR) {
+            x0[i] = Stored(index);
+            x1[i] = Stored(index + 1);
+          } else {
+            xm1[i] = Stored(index);
+            x0[i] = Stored(index + 1);
+            x1[i] = Stored(index + 2);
+            x2[i] = Stored(index + 3);
+          }
+        }
+
+        if (method == INTERPOLATION_ZOH) {
+          for (int32_t i = 0; i < block_size; ++i) {
+            out[i] = static_cast<float>(x0[i]) * scale;
+          }
+        } else if (method == INTERPOLATION_LINEAR) {
+          for (int32_t i = 0; i < block_size; ++i) {
+            float a = static_cast<float>(x0[i]);
+            float b = static_cast<float>(x1[i]);
+            out[i] = (a + (b - a) * t[i]) * scale;
+          }
+        } else {
+          // Laurent de Soras's Hermite interpolator.
+          for (int32_t i = 0; i < block_size; ++i) {
+            float sm1 = static_cast<float>(xm1[i]);
+            float s0 = static_cast<float>(x0[i]);
+            float s1 = static_cast<float>(x1[i]);
+            float s2 = static_cast<float>(x2[i]);
+            const float c = (s1 - sm1) * 0.5f;
+            const float v = s0 - s1;
+            const float w = c + v;
+            const float a = w + v + (s2 - s0) * 0.5f;
+            const float b_neg = w + a;
+            out[i] = ((((a * t[i]) - b_neg) * t[i] + c) * t[i] + s0) * scale;
+          }
+        }
+        phase += block_size * phase_increment;
+        out += block_size;
+        size -= block_size;
+      }
+    }
+
     inline int32_t size() const {
       return size_;
     }
@@ -269,6 +403,57 @@ namespace clouds {
     }
 
   private:
+    /* The taps of a float sample are contiguous and need no decoding: they
+       are copied together, which is cheaper than gathering them one by one,
+       then interpolated in a loop that vectorizes. */
+    template<InterpolationMethod method>
+    inline void ReadFloat(const int32_t* integral, const float* t, float* out, int32_t size) const {
+      const int32_t kNumTaps = method == INTERPOLATION_HERMITE ? 4 :
+        method == INTERPOLATION_LINEAR ? 2 : 1;
+      float taps[kReadBlockSize * kNumTaps];
+      for (int32_t i = 0; i < size; ++i) {
+        std::copy(&f32_[integral[i]], &f32_[integral[i] + kNumTaps], &taps[i * kNumTaps]);
+      }
+
+      if (method == INTERPOLATION_ZOH) {
+        std::copy(&taps[0], &taps[size], &out[0]);
+      } else if (method == INTERPOLATION_LINEAR) {
+        for (int32_t i = 0; i < size; ++i) {
+          const float a = taps[i * kNumTaps + 0];
+          const float b = taps[i * kNumTaps + 1];
+          out[i] = a + (b - a) * t[i];
+        }
+      } else {
+        // Laurent de Soras's Hermite interpolator.
+        for (int32_t i = 0; i < size; ++i) {
+          const float sm1 = taps[i * kNumTaps + 0];
+          const float s0 = taps[i * kNumTaps + 1];
+          const float s1 = taps[i * kNumTaps + 2];
+          const float s2 = taps[i * kNumTaps + 3];
+          const float c = (s1 - sm1) * 0.5f;
+          const float v = s0 - s1;
+          const float w = c + v;
+          const float a = w + v + (s2 - s0) * 0.5f;
+          const float b_neg = w + a;
+          out[i] = (((a * t[i]) - b_neg) * t[i] + c) * t[i] + s0;
+        }
+      }
+    }
+
+    // Stored sample, unscaled.
+    inline Sample Stored(int32_t index) const {
+      if (resolution == RESOLUTION_32_BIT_FLOAT) {
+        return f32_[index];
+      } else if (resolution == RESOLUTION_16_BIT) {
+        return s16_[index];
+      } else if (resolution == RESOLUTION_8_BIT_MU_LAW) {
+        return MuLaw2Lin(s8_[index]);
+      } else {
+        return s8_[index];
+      }
+    }
+
+    float* f32_;
     int16_t* s16_;
     int8_t* s8_;
 
@@ -37,6 +37,8 @@ namespace clouds {
 
 class Diffuser {
  public:
+  typedef FxEngine<2048, FORMAT_32_BIT> E;
+
   Diffuser() { }
   ~Diffuser() { }
   
@@ -98,9 +100,13 @@ class Diffuser {
   void set_amount(float amount) {
     amount_ = amount;
   }
+
+  // Stretches the allpasses to keep their lengths in seconds.
+  void set_sample_rate(float sample_rate) {
+    engine_.set_stretch(sample_rate / 32000.0f);
+  }
   
  private:
-  typedef FxEngine<2048, FORMAT_32_BIT> E;
   E engine_;
   
   float amount_;
@@ -95,25 +95,71 @@ namespace clouds {
     }
   };
 
+  /* Storage of an effect's delay memory. On the desktop, floats, which spare
+     a conversion on every tap; on the MetaModule, which is short of memory,
+     the effect's fixed point format. */
+  template<Format fixed_point_format>
+  struct DelayFormat {
+#ifndef METAMODULE
+    static const Format format = FORMAT_32_BIT;
+#else
+    static const Format format = fixed_point_format;
+#endif
+  };
+
+  /* Delay lengths and offsets are counted in samples at the module's 32 kHz.
+     At higher rates, the engine stretches them so that every delay lasts as
+     long; the delay memory is sized for rates up to kMaxDelayStretch times
+     32 kHz. The MetaModule, short of memory, only runs at 32 kHz. */
+#ifndef METAMODULE
+  const int32_t kMaxDelayStretch = 4;
+#else
+  const int32_t kMaxDelayStretch = 1;
+#endif
+
   template<
     size_t size,
     Format format = FORMAT_12_BIT>
   class FxEngine {
   public:
     typedef typename DataType<format>::T T;
+
+    // Length of the delay memory an effect must be given.
+    enum {
+      capacity = size * kMaxDelayStretch
+    };
+
     FxEngine() {}
     ~FxEngine() {}
 
     void Init(T* buffer) {
       buffer_ = buffer;
+      stretch_ = 1.0f;
+      length_ = size;
       Clear();
     }
 
     void Clear() {
-      std::fill(&buffer_[0], &buffer_[size], 0);
+      std::fill(&buffer_[0], &buffer_[length_], 0);
       write_ptr_ = 0;
     }
 
+    /* Stretches the delays by stretch, which is the sample rate divided by
+       32 kHz; clears the delay memory. */
+    void set_stretch(float stretch) {
+      CONSTRAIN(stretch, 1.0f, static_cast<float>(kMaxDelayStretch));
+      stretch_ = stretch;
+      length_ = size;
+      while (length_ < static_cast<int32_t>(size * stretch)) {
+        length_ <<= 1;
+      }
+      Clear();
+    }
+
+    inline float stretch() const {
+      return stretch_;
+    }
+
     struct Empty {};
 
     template<int32_t l, typename T = Empty>
@@ -173,11 +219,7 @@ namespace clouds {
         STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
 #endif
         T w = DataType<format>::Compress(accumulator_);
-        if (offset == -1) {
-          buffer_[(write_ptr_ + D::base + D::length - 1) & MASK] = w;
-        } else {
-          buffer_[(write_ptr_ + D::base + offset) & MASK] = w;
-        }
+        buffer_[Address<D>(offset) & mask_] = w;
         accumulator_ *= scale;
       }
 
@@ -202,12 +244,7 @@ namespace clouds {
 #ifndef METAMODULE
         STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
 #endif
-        T r;
-        if (offset == -1) {
-          r = buffer_[(write_ptr_ + D::base + D::length - 1) & MASK];
-        } else {
-          r = buffer_[(write_ptr_ + D::base + offset) & MASK];
-        }
+        T r = buffer_[Address<D>(offset) & mask_];
         float r_f = DataType<format>::Decompress(r);
         previous_read_ = r_f;
         accumulator_ += r_f * scale;
@@ -233,11 +270,11 @@ namespace clouds {
 #ifndef METAMODULE
         STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
 #endif
+        offset *= stretch_;
         MAKE_INTEGRAL_FRACTIONAL(offset);
-        float a = DataType<format>::Decompress(
-          buffer_[(write_ptr_ + offset_integral + D::base) & MASK]);
-        float b = DataType<format>::Decompress(
-          buffer_[(write_ptr_ + offset_integral + D::base + 1) & MASK]);
+        int32_t base = write_ptr_ + offset_integral + Base<D>();
+        float a = DataType<format>::Decompress(buffer_[base & mask_]);
+        float b = DataType<format>::Decompress(buffer_[(base + 1) & mask_]);
         float x = a + (b - a) * offset_fractional;
         previous_read_ = x;
         accumulator_ += x * scale;
@@ -250,22 +287,38 @@ namespace clouds {
         STATIC_ASSERT(D::base + D::length <= size, delay_memory_full);
 #endif
         offset += amplitude * lfo_value_[index];
+        offset *= stretch_;
         MAKE_INTEGRAL_FRACTIONAL(offset);
-        float a = DataType<format>::Decompress(
-          buffer_[(write_ptr_ + offset_integral + D::base) & MASK]);
-        float b = DataType<format>::Decompress(
-          buffer_[(write_ptr_ + offset_integral + D::base + 1) & MASK]);
+        int32_t base = write_ptr_ + offset_integral + Base<D>();
+        float a = DataType<format>::Decompress(buffer_[base & mask_]);
+        float b = DataType<format>::Decompress(buffer_[(base + 1) & mask_]);
         float x = a + (b - a) * offset_fractional;
         previous_read_ = x;
         accumulator_ += x * scale;
       }
 
     private:
+      template<typename D>
+      inline int32_t Base() const {
+        return static_cast<int32_t>(D::base * stretch_);
+      }
+
+      // Position of a tap; -1 is the last sample of the delay line.
+      template<typename D>
+      inline int32_t Address(int32_t offset) const {
+        int32_t base = write_ptr_ + Base<D>();
+        return offset == -1 ?
+          base + static_cast<int32_t>(D::length * stretch_) - 1 :
+          base + static_cast<int32_t>(offset * stretch_);
+      }
+
       float accumulator_;
       float previous_read_;
       float lfo_value_[2];
       T* buffer_;
       int32_t write_ptr_;
+      int32_t mask_;
+      float stretch_;
 
       DISALLOW_COPY_AND_ASSIGN(Context);
     };
@@ -278,12 +331,14 @@ namespace clouds {
     inline void Start(Context* c) {
       --write_ptr_;
       if (write_ptr_ < 0) {
-        write_ptr_ += size;
+        write_ptr_ += length_;
       }
       c->accumulator_ = 0.0f;
       c->previous_read_ = 0.0f;
       c->buffer_ = buffer_;
       c->write_ptr_ = write_ptr_;
+      c->mask_ = length_ - 1;
+      c->stretch_ = stretch_;
       if ((write_ptr_ & 31) == 0) {
         c->lfo_value_[0] = lfo_[0].Next();
         c->lfo_value_[1] = lfo_[1].Next();
@@ -294,11 +349,10 @@ namespace clouds {
     }
 
   private:
-    enum {
-      MASK = size - 1
-    };
-
     int32_t write_ptr_;
+    // Power of two holding the stretched delay lines.
+    int32_t length_;
+    float stretch_;
     T* buffer_;
     stmlib::CosineOscillator lfo_[2];
 
@@ -38,10 +38,12 @@ namespace clouds {
 
 class PitchShifter {
  public:
+  typedef FxEngine<4096, DelayFormat<FORMAT_16_BIT>::format> E;
+
   PitchShifter() { }
   ~PitchShifter() { }
   
-  void Init(uint16_t* buffer) {
+  void Init(E::T* buffer) {
     engine_.Init(buffer);
     phase_ = 0;
     size_ = 2047.0f;
@@ -65,7 +67,8 @@ class PitchShifter {
     E::Context c;
     engine_.Start(&c);
     
-    phase_ += (1.0f - ratio_) / size_;
+    // size_ is counted at 32 kHz; the engine stretches the window.
+    phase_ += (1.0f - ratio_) / (size_ * engine_.stretch());
     if (phase_ >= 1.0f) {
       phase_ -= 1.0f;
     }
@@ -98,11 +101,15 @@ class PitchShifter {
   
   inline void set_size(float size) {
     float target_size = 128.0f + (2047.0f - 128.0f) * size * size * size;
-    ONE_POLE(size_, target_size, 0.05f)
+    ONE_POLE(size_, target_size, 0.05f / engine_.stretch())
+  }
+
+  // Stretches the window to keep its length in seconds; clears it.
+  inline void set_sample_rate(float sample_rate) {
+    engine_.set_stretch(sample_rate / 32000.0f);
   }
   
  private:
-  typedef FxEngine<4096, FORMAT_16_BIT> E;
   E engine_;
   float phase_;
   float ratio_;
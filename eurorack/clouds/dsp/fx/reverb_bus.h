@@ -0,0 +1,126 @@
+// Copyright 2026 Bloodbat.
+//
+// Author: Bloodbat
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// One reverb shared by several granular processors. Each processor sends its
+// signal, scaled by its own reverb amount, and gets back an equal share of the
+// reverb's output, for the cost of a single reverb. The send levels stay per
+// processor, but there is only one decay time and one damping: they follow the
+// average of the senders' settings, so one processor's reverb or feedback
+// setting also changes the tail the others hear.
+
+#ifndef CLOUDS_DSP_FX_REVERB_BUS_H_
+#define CLOUDS_DSP_FX_REVERB_BUS_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+
+#include "clouds/dsp/frame.h"
+#include "clouds/dsp/fx/reverb.h"
+
+namespace clouds {
+
+  class ReverbBus {
+  public:
+    ReverbBus() {}
+    ~ReverbBus() {}
+
+    void Init() {
+      reverb_.Init(buffer_);
+      sample_rate_ = 32000.0f;
+      reverb_.set_amount(1.0f);
+      reverb_.set_diffusion(0.7f);
+      reverb_.set_input_gain(0.2f);
+      Clear();
+    }
+
+    inline void set_sample_rate(float sample_rate) {
+      if (sample_rate != sample_rate_) {
+        reverb_.set_sample_rate(sample_rate);
+        sample_rate_ = sample_rate;
+      }
+    }
+
+    // Starts a new block.
+    void Clear() {
+      std::fill(&bus_[0], &bus_[kMaxBlockSize], FloatFrame());
+      num_sends_ = 0;
+      amount_sum_ = 0.0f;
+      feedback_sum_ = 0.0f;
+      share_ = 0.0f;
+    }
+
+    /* Adds in, scaled by send, to the bus. amount and feedback are the
+       sender's reverb and feedback settings: the bus uses their average. */
+    void Send(const FloatFrame* in, float send, float amount, float feedback, size_t size) {
+      for (size_t i = 0; i < size; ++i) {
+        bus_[i].l += in[i].l * send;
+        bus_[i].r += in[i].r * send;
+      }
+      amount_sum_ += amount;
+      feedback_sum_ += feedback;
+      ++num_sends_;
+    }
+
+    // Reverberates the sum of the block's sends.
+    void Process(size_t size) {
+      if (!num_sends_) {
+        return;
+      }
+      share_ = 1.0f / static_cast<float>(num_sends_);
+      float amount = amount_sum_ * share_;
+      float feedback = feedback_sum_ * share_;
+      reverb_.set_time(0.35f + 0.63f * amount);
+      reverb_.set_lp(0.6f + 0.37f * feedback);
+      reverb_.Process(bus_, size);
+    }
+
+    // Adds one sender's share of the reverb's output to in_out.
+    void Return(FloatFrame* in_out, size_t size) const {
+      for (size_t i = 0; i < size; ++i) {
+        in_out[i].l += bus_[i].l * share_;
+        in_out[i].r += bus_[i].r * share_;
+      }
+    }
+
+  private:
+    Reverb reverb_;
+    Reverb::E::T buffer_[Reverb::E::capacity];
+
+    FloatFrame bus_[kMaxBlockSize];
+
+    float sample_rate_;
+    int32_t num_sends_;
+    float amount_sum_;
+    float feedback_sum_;
+    float share_;
+
+    DISALLOW_COPY_AND_ASSIGN(ReverbBus);
+  };
+
+}  // namespace clouds
+
+#endif  // CLOUDS_DSP_FX_REVERB_BUS_H_
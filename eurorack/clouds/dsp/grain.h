@@ -34,6 +34,7 @@
 #include "stmlib/dsp/dsp.h"
 
 #include "clouds/dsp/audio_buffer.h"
+#include "clouds/dsp/frame.h"
 
 #include "clouds/resources.h"
 
@@ -77,36 +78,47 @@ namespace clouds {
       recommended_quality_ = recommended_quality;
     }
 
+    /* Renders the envelope of the next samples of the grain, and returns how
+       many there are before the grain ends. */
     template<bool use_lut_for_envelope, GrainQuality quality>
-    inline void RenderEnvelope(float* destination, size_t size) {
+    inline int32_t RenderEnvelope(float* destination, size_t size) {
       const float increment = envelope_phase_increment_;
       const float smoothness = envelope_smoothness_;
       const float slope = envelope_slope_;
+      const float phase = envelope_phase_;
+
+      int32_t count = size;
+      if (phase + static_cast<float>(count) * increment >= 2.0f) {
+        // The grain ends within this block.
+        count = 0;
+        while (phase + static_cast<float>(count + 1) * increment < 2.0f) {
+          ++count;
+        }
+      }
 
-      float phase = envelope_phase_;
-      while (size--) {
-        float gain = phase;
+      for (int32_t i = 0; i < count; ++i) {
+        float gain = phase + static_cast<float>(i) * increment;
         gain = gain >= 1.0f ? 2.0f - gain : gain;
         if (use_lut_for_envelope) {
           if (quality == GRAIN_QUALITY_HIGH) {
-            float window = 0.0f;
-            window = stmlib::Interpolate(lut_window, gain, 4096.0f);
+            // lut_window, (1 - cos(pi * gain)) / 2, computed rather than read
+            // so that the loop vectorizes.
+            float x = 3.141592654f * (gain - 0.5f);
+            float x2 = x * x;
+            float window = 0.5f + 0.5f * x * (1.0f + x2 * (-0.16666667f + x2 * (0.0083333333f +
+              x2 * (-0.00019841270f + x2 * 0.0000027557319f))));
             gain += smoothness * (window - gain);
           }
         } else {
           if (quality >= GRAIN_QUALITY_MEDIUM) {
             gain *= slope;
-            if (gain >= 1.0f) gain = 1.0f;
+            gain = gain >= 1.0f ? 1.0f : gain;
           }
         }
-        phase += increment;
-        if (phase >= 2.0f) {
-          *destination = -1.0f;
-          break;
-        }
-        *destination++ = gain;
+        destination[i] = gain;
       }
-      envelope_phase_ = phase;
+      envelope_phase_ = phase + static_cast<float>(count + (count < static_cast<int32_t>(size) ? 1 : 0)) * increment;
+      return count;
     }
 
     template<int32_t num_channels, GrainQuality quality, Resolution resolution>
@@ -124,40 +136,38 @@ namespace clouds {
       }
 
       // Pre-render the envelope in one pass.
+      int32_t count;
       if (envelope_smoothness_ == 0.0f) {
-        RenderEnvelope<false, quality>(envelope, size);
+        count = RenderEnvelope<false, quality>(envelope, size);
       } else {
-        RenderEnvelope<true, quality>(envelope, size);
+        count = RenderEnvelope<true, quality>(envelope, size);
       }
 
-      const int32_t phase_increment = phase_increment_;
-      const int32_t first_sample = first_sample_;
+      // Then read the samples, and mix them in another.
+      float l[kMaxBlockSize];
+      float r[kMaxBlockSize];
       const float gain_l = gain_l_;
       const float gain_r = gain_r_;
-      int32_t phase = phase_;
-      while (size--) {
-        int32_t sample_index = first_sample + (phase >> 16);
-
-        float gain = *envelope++;
-        if (gain == -1.0f) {
-          active_ = false;
-          break;
+      buffer[0].template Read<InterpolationMethod(quality)>(first_sample_, phase_, phase_increment_, l, count);
+      if (num_channels == 1) {
+        for (int32_t i = 0; i < count; ++i) {
+          float sample = l[i] * envelope[i];
+          destination[2 * i] += sample * gain_l;
+          destination[2 * i + 1] += sample * gain_r;
         }
-
-        float l = buffer[0].template Read<InterpolationMethod(quality)>(
-          sample_index, phase & 65535) * gain;
-        if (num_channels == 1) {
-          *destination++ += l * gain_l;
-          *destination++ += l * gain_r;
-        } else if (num_channels == 2) {
-          float r = buffer[1].template Read<InterpolationMethod(quality)>(
-            sample_index, phase & 65535) * gain;
-          *destination++ += l * gain_l + r * (1.0f - gain_r);
-          *destination++ += r * gain_r + l * (1.0f - gain_l);
+      } else if (num_channels == 2) {
+        buffer[1].template Read<InterpolationMethod(quality)>(first_sample_, phase_, phase_increment_, r, count);
+        for (int32_t i = 0; i < count; ++i) {
+          float sample_l = l[i] * envelope[i];
+          float sample_r = r[i] * envelope[i];
+          destination[2 * i] += sample_l * gain_l + sample_r * (1.0f - gain_r);
+          destination[2 * i + 1] += sample_r * gain_r + sample_l * (1.0f - gain_l);
         }
-        phase += phase_increment;
       }
-      phase_ = phase;
+      phase_ += count * phase_increment_;
+      if (count < static_cast<int32_t>(size)) {
+        active_ = false;
+      }
     }
 
     inline bool active() {
@@ -37,6 +37,7 @@
 #include "clouds/dsp/fx/diffuser.h"
 #include "clouds/dsp/fx/pitch_shifter.h"
 #include "clouds/dsp/fx/reverb.h"
+#include "clouds/dsp/fx/reverb_bus.h"
 #include "clouds/dsp/granular_processor.h"
 #include "clouds/dsp/granular_sample_player.h"
 #include "clouds/dsp/looping_sample_player.h"
@@ -55,6 +56,14 @@ namespace clouds {
     PLAYBACK_MODE_LAST
   };
 
+  enum GrainBudget {
+    // As many grains as the module could afford, the last ones at a lower
+    // quality.
+    GRAIN_BUDGET_HARDWARE,
+    // Four times as many grains, all of them at the highest quality.
+    GRAIN_BUDGET_DESKTOP
+  };
+
   // State of the recording buffer as saved in one of the 4 sample memories.
   struct PersistentState {
     int32_t write_head[2];
@@ -80,6 +89,11 @@ namespace clouds {
     void Process(ShortFrame* input, ShortFrame* output, size_t size);
     void Prepare();
 
+    /* Process() in two halves, for processors sharing a reverb bus: Render()
+       every processor, process the bus, then Mix() every processor. */
+    void Render(ShortFrame* input, size_t size, ReverbBus* reverb_bus);
+    void Mix(ShortFrame* input, ShortFrame* output, size_t size, const ReverbBus* reverb_bus);
+
     inline Parameters* mutable_parameters() {
       return &parameters_;
     }
@@ -109,6 +123,26 @@ namespace clouds {
       low_fidelity_ = low_fidelity;
     }
 
+    /* Runs at sample_rate rather than at the module's 32 kHz: grain sizes,
+       the stretch mode's windows, filter cutoffs and the effects' delays are
+       rescaled to sound the same. Up to kMaxDelayStretch times 32 kHz. */
+    inline void set_sample_rate(float sample_rate) {
+      reset_buffers_ = reset_buffers_ || sample_rate != sample_rate_;
+      sample_rate_ = sample_rate;
+    }
+
+    inline void set_grain_budget(GrainBudget grain_budget) {
+      grain_budget_ = grain_budget;
+    }
+
+    /* Records hi-fi audio as floats into buffer, size floats long, instead of
+       into the 16-bit sample memory. NULL goes back to the sample memory. */
+    inline void set_float_buffer(float* buffer, size_t size) {
+      reset_buffers_ = reset_buffers_ || buffer != float_buffer_ || size != float_buffer_size_;
+      float_buffer_ = buffer;
+      float_buffer_size_ = size;
+    }
+
     inline int32_t quality() const {
       int32_t quality = 0;
       if (num_channels_ == 1) quality |= 1;
@@ -125,26 +159,49 @@ namespace clouds {
       return low_fidelity_ ? 8 : 16;
     }
 
+    inline bool float_buffers() const {
+      return float_buffer_ && !low_fidelity_;
+    }
+
     inline float sample_rate() const {
-      return 32000.0f / (low_fidelity_ ? kDownsamplingFactor : 1);
+      return sample_rate_ / (low_fidelity_ ? kDownsamplingFactor : 1);
+    }
+
+    // How much shorter a sample is than at the module's 32 kHz.
+    inline float rate_ratio() const {
+      return 32000.0f / sample_rate_;
     }
 
     void ResetFilters();
+    void InitGranularPlayer();
     void ProcessGranular(FloatFrame* input, FloatFrame* output, size_t size);
 
     PlaybackMode playback_mode_;
     PlaybackMode previous_playback_mode_;
     int32_t num_channels_;
     bool low_fidelity_;
+    float sample_rate_;
+    GrainBudget grain_budget_;
+    GrainBudget previous_grain_budget_;
 
     bool silence_;
     bool reset_buffers_;
+    bool muted_;
+    bool idle_;
+    // Consecutive silent samples written to the recording buffer, and how many
+    // it takes to overwrite all of it.
+    int32_t silent_samples_;
+    int32_t idle_hold_;
+    float reverb_send_;
     float freeze_lp_;
     float dry_wet_;
 
     void* buffer_[2];
     size_t buffer_size_[2];
 
+    float* float_buffer_;
+    size_t float_buffer_size_;
+
     Correlator correlator_;
 
     GranularSamplePlayer player_;
@@ -161,6 +218,7 @@ namespace clouds {
 
     AudioBuffer<RESOLUTION_8_BIT_MU_LAW> buffer_8_[2];
     AudioBuffer<RESOLUTION_16_BIT> buffer_16_[2];
+    AudioBuffer<RESOLUTION_32_BIT_FLOAT> buffer_float_[2];
 
     FloatFrame in_[kMaxBlockSize];
     FloatFrame in_downsampled_[kMaxBlockSize / kDownsamplingFactor];
@@ -170,6 +228,14 @@ namespace clouds {
 
     int16_t tail_buffer_[2][256];
 
+#ifndef METAMODULE
+    // The effects' delay memory, sized for the highest rate, does not fit in
+    // the workspace.
+    float diffuser_buffer_[Diffuser::E::capacity];
+    PitchShifter::E::T pitch_shifter_buffer_[PitchShifter::E::capacity];
+    Reverb::E::T reverb_buffer_[Reverb::E::capacity];
+#endif
+
     Parameters parameters_;
 
     SampleRateConverter<-kDownsamplingFactor, 45, src_filter_1x_2_45> src_down_;
@@ -0,0 +1,129 @@
+// Copyright 2026 Bloodbat.
+//
+// Author: Bloodbat
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Per-bin kernels for the phase vocoder frame transformations.
+//
+// They are branch-free and table-free, so that loops over the bins of a frame
+// vectorize. This header depends on neither stmlib nor parasites_stmlib: the
+// Etesia and Fluctus forks share it.
+
+#ifndef CLOUDS_DSP_PVOC_FRAME_KERNELS_H_
+#define CLOUDS_DSP_PVOC_FRAME_KERNELS_H_
+
+#include <stdint.h>
+
+#include <cmath>
+
+namespace clouds {
+
+  // Angles are expressed on 16 bits, 65536 being a full turn.
+  const float kAngleToRadians = 6.283185307f / 65536.0f;
+  const float kRadiansToAngle = 65536.0f / 6.283185307f;
+
+  // Magnitude and angle of (x, y). Replaces fast_atan2r.
+  inline uint16_t BinRectangularToPolar(float y, float x, float* r) {
+    float ax = std::fabs(x);
+    float ay = std::fabs(y);
+    float max = ax > ay ? ax : ay;
+    float min = ax > ay ? ay : ax;
+    float t = min / (max + 1e-30f);
+    float t2 = t * t;
+
+    // max * sqrt(1 + t^2), relative error < 2e-6. A polynomial rather than
+    // sqrtf, which keeps a branch for errno and stops the loop vectorizing.
+    *r = max * (1.00000164f + t2 * (0.499880754f + t2 * (-0.12353492f +
+      t2 * (0.0555406822f + t2 * (-0.0225568472f + t2 * 0.00488320646f)))));
+
+    // atan(t) for t in [0, 1], minimax polynomial, |error| < 2e-6 rad.
+    float a = t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f +
+      t2 * (-0.11643287f + t2 * (0.05265332f + t2 * -0.01172120f)))));
+
+    a = ay > ax ? 1.570796327f - a : a;
+    a = x < 0.0f ? 3.141592654f - a : a;
+    a = y < 0.0f ? 6.283185307f - a : a;
+    return static_cast<uint16_t>(static_cast<uint32_t>(a * kRadiansToAngle + 0.5f));
+  }
+
+  // Rectangular coordinates of (magnitude, angle). Replaces fast_p2r.
+  inline void BinPolarToRectangular(float magnitude, uint16_t angle, float* re, float* im) {
+    uint32_t quadrant = angle >> 14;
+    float x = static_cast<float>(angle & 0x3fff) * kAngleToRadians;
+    float x2 = x * x;
+
+    // sin and cos for x in [0, pi / 2), |error| < 4e-6.
+    float s = x * (1.0f + x2 * (-0.16666667f + x2 * (0.0083333333f +
+      x2 * (-0.00019841270f + x2 * 0.0000027557319f))));
+    float c = 1.0f + x2 * (-0.49999905f + x2 * (0.041663583f +
+      x2 * (-0.0013853704f + x2 * 0.000023153932f)));
+
+    float cos_q = quadrant & 1 ? s : c;
+    float sin_q = quadrant & 1 ? c : s;
+    *re = magnitude * ((quadrant + 1) & 2 ? -cos_q : cos_q);
+    *im = magnitude * (quadrant & 2 ? -sin_q : sin_q);
+  }
+
+  // Adds a random offset in [-2 * amount, 2 * amount) to each phase, drawn
+  // from the same linear congruential generator as Random::GetSample(). Words
+  // are generated a block at a time, each one four steps after the word four
+  // places before it, so that both loops vectorize. *state is left past every
+  // word drawn.
+  template<typename T>
+  inline void AddRandomPhases(T* phase, int32_t size, int32_t amount, uint32_t* state) {
+    const uint32_t kMultiplier = 1664525L;
+    const uint32_t kIncrement = 1013904223L;
+    const uint32_t kMultiplier4 = kMultiplier * kMultiplier * kMultiplier * kMultiplier;
+    const uint32_t kIncrement4 = kIncrement * (
+      kMultiplier * kMultiplier * kMultiplier + kMultiplier * kMultiplier + kMultiplier + 1);
+    const int32_t kBlockSize = 64;
+
+    uint32_t words[kBlockSize];
+    uint32_t x = *state;
+    for (int32_t i = 0; i < 4; ++i) {
+      x = x * kMultiplier + kIncrement;
+      words[i] = x;
+    }
+
+    while (size > 0) {
+      for (int32_t i = 4; i < kBlockSize; ++i) {
+        words[i] = words[i - 4] * kMultiplier4 + kIncrement4;
+      }
+      int32_t block_size = size < kBlockSize ? size : kBlockSize;
+      for (int32_t i = 0; i < block_size; ++i) {
+        int32_t sample = static_cast<int16_t>(words[i] >> 16);
+        phase[i] += sample * amount >> 14;
+      }
+      for (int32_t i = 0; i < 4; ++i) {
+        words[i] = words[kBlockSize - 4 + i] * kMultiplier4 + kIncrement4;
+      }
+      phase += block_size;
+      size -= block_size;
+    }
+    *state = words[3];
+  }
+
+}  // namespace clouds
+
+#endif  // CLOUDS_DSP_PVOC_FRAME_KERNELS_H_
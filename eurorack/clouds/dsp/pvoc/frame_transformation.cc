@@ -30,12 +30,12 @@
 
 #include <algorithm>
 
-#include "stmlib/dsp/atan.h"
 #include "stmlib/dsp/units.h"
 #include "stmlib/utils/random.h"
 
 #include "clouds/dsp/frame.h"
 #include "clouds/dsp/parameters.h"
+#include "clouds/dsp/pvoc/frame_kernels.h"
 
 namespace clouds {
 
@@ -104,7 +104,7 @@ namespace clouds {
     const float* imag = &fft_data[fft_size_ >> 1];
     float* magnitude = &fft_data[0];
     for (int32_t i = 1; i < size_; ++i) {
-      uint16_t angle = fast_atan2r(imag[i], real[i], &magnitude[i]);
+      uint16_t angle = BinRectangularToPolar(imag[i], real[i], &magnitude[i]);
       phases_delta_[i] = angle - phases_[i];
       phases_[i] = angle;
     }
@@ -112,7 +112,8 @@ namespace clouds {
 
   void FrameTransformation::SetPhases(float* destination, float phase_randomization, float pitch_ratio) {
     uint32_t* synthesis_phase = reinterpret_cast<uint32_t*>(&destination[fft_size_ >> 1]);
-    for (int32_t i = 0; i < size_; ++i) {
+    int32_t size = size_;
+    for (int32_t i = 0; i < size; ++i) {
       synthesis_phase[i] = phases_[i];
       phases_[i] += static_cast<uint16_t>(static_cast<float>(phases_delta_[i]) * pitch_ratio);
     }
@@ -121,8 +122,10 @@ namespace clouds {
     CONSTRAIN(r, 0.0f, 1.0f);
     r *= r;
     int32_t amount = static_cast<int32_t>(r * 32768.0f);
-    for (int32_t i = 0; i < size_; ++i) {
-      synthesis_phase[i] += static_cast<int32_t>(stmlib::Random::GetSample()) * amount >> 14;
+    if (amount) {
+      uint32_t rng_state = stmlib::Random::state();
+      AddRandomPhases(synthesis_phase, size, amount, &rng_state);
+      stmlib::Random::Seed(rng_state);
     }
   }
 
@@ -132,7 +135,7 @@ namespace clouds {
     float* magnitude = &fft_data[0];
     uint32_t* angle = reinterpret_cast<uint32_t*>(&fft_data[fft_size_ >> 1]);
     for (int32_t i = 1; i < size_; ++i) {
-      fast_p2r(magnitude[i], angle[i], &real[i], &imag[i]);
+      BinPolarToRectangular(magnitude[i], angle[i], &real[i], &imag[i]);
     }
     for (int32_t i = size_; i < fft_size_ >> 1; ++i) {
       real[i] = imag[i] = 0.0f;
@@ -63,12 +63,6 @@ namespace clouds {
     void ReplayMagnitudes(float* xf_polar, float position);
     void DiffuseMagnitudes(float* xf_polar, float diffusion);
 
-    inline void fast_p2r(float magnitude, uint16_t angle, float* re, float* im) {
-      angle >>= 6;
-      *re = magnitude * lut_sin[angle + 256];
-      *im = magnitude * lut_sin[angle];
-    }
-
     int32_t fft_size_;
     int32_t num_textures_;
     int32_t size_;
@@ -0,0 +1,362 @@
+// Copyright 2026 Bloodbat.
+//
+// Author: Bloodbat
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Real FFT for the desktop, a drop-in replacement for stmlib::ShyFFT: same
+// Init/Direct/Inverse interface, same data layout and same scaling.
+//
+// A real frame of size N is transformed as a complex frame of size N / 2,
+// with a radix-4 Stockham FFT (no bit reversal) on split real and imaginary
+// arrays, so that every butterfly loop vectorizes. Twiddle factors for all
+// sizes up to max_size are computed once and shared by every instance.
+//
+// Like stmlib::ShyFFT, input is used as a workspace and is lost. Layout of
+// the spectrum: output[0 .. N / 2] holds the real parts of bins 0 to N / 2,
+// output[N / 2 + k] holds minus the imaginary part of bin k. Inverse() is not
+// normalized: it returns N times the original frame.
+//
+// This header does not depend on stmlib or parasites_stmlib: the Etesia and
+// Fluctus forks share it.
+
+#ifndef CLOUDS_DSP_PVOC_REAL_FFT_H_
+#define CLOUDS_DSP_PVOC_REAL_FFT_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace clouds {
+
+  template<size_t max_size_>
+  class RealFFT {
+  public:
+    enum {
+      max_size = max_size_
+    };
+
+    RealFFT() { }
+    ~RealFFT() { }
+
+    void Init() {
+      twiddles_ = &twiddles();
+      max_num_passes_ = 0;
+      for (size_t t = max_size; t > 1; t >>= 1) {
+        ++max_num_passes_;
+      }
+    }
+
+    void Direct(float* input, float* output) {
+      Direct(input, output, max_num_passes_);
+    }
+
+    void Inverse(float* input, float* output) {
+      Inverse(input, output, max_num_passes_);
+    }
+
+    void Direct(float* input, float* output, size_t num_passes) {
+      size_t size = 1 << num_passes;
+      size_t half = size >> 1;
+
+      // z[n] = x[2n] + i x[2n + 1], split in output.
+      float* z_re = &output[0];
+      float* z_im = &output[half];
+      for (size_t i = 0; i < half; ++i) {
+        z_re[i] = input[2 * i];
+        z_im[i] = input[2 * i + 1];
+      }
+      if (Transform(z_re, z_im, &input[0], &input[half], half) != z_re) {
+        std::copy(&input[0], &input[size], &output[0]);
+      }
+
+      // Unpack the spectrum of z into the spectrum of x. Bins k and half - k
+      // are computed from, and written to, the same four locations.
+      const float* w_re = twiddles_->unpack(num_passes, 0);
+      const float* w_im = twiddles_->unpack(num_passes, 1);
+      float* x_re = &output[0];
+      float* x_im = &output[half];
+      float z0_re = z_re[0];
+      float z0_im = z_im[0];
+      // Bin 0 has no imaginary part, the slot holds bin N / 2 instead.
+      x_re[0] = z0_re + z0_im;
+      x_im[0] = z0_re - z0_im;
+      for (size_t k = 1; k <= (half >> 1); ++k) {
+        float a_re = z_re[k];
+        float a_im = z_im[k];
+        float b_re = z_re[half - k];
+        float b_im = -z_im[half - k];
+        float even_re = 0.5f * (a_re + b_re);
+        float even_im = 0.5f * (a_im + b_im);
+        // odd = -i (a - b) / 2
+        float odd_re = 0.5f * (a_im - b_im);
+        float odd_im = -0.5f * (a_re - b_re);
+        float t_re = w_re[k] * odd_re - w_im[k] * odd_im;
+        float t_im = w_re[k] * odd_im + w_im[k] * odd_re;
+        x_re[k] = even_re + t_re;
+        x_im[k] = -(even_im + t_im);
+        x_re[half - k] = even_re - t_re;
+        x_im[half - k] = even_im - t_im;
+      }
+    }
+
+    void Inverse(float* input, float* output, size_t num_passes) {
+      size_t size = 1 << num_passes;
+      size_t half = size >> 1;
+
+      // Pack the spectrum of x into the spectrum of z (times 2) in input.
+      const float* w_re = twiddles_->unpack(num_passes, 0);
+      const float* w_im = twiddles_->unpack(num_passes, 1);
+      float* x_re = &input[0];
+      float* x_im = &input[half];
+      float x0 = x_re[0];
+      float x_half = x_re[half];
+      x_re[0] = x0 + x_half;
+      x_im[0] = x0 - x_half;
+      for (size_t k = 1; k <= (half >> 1); ++k) {
+        float a_re = x_re[k];
+        float a_im = -x_im[k];
+        float b_re = x_re[half - k];
+        float b_im = x_im[half - k];
+        float even_re = a_re + b_re;
+        float even_im = a_im + b_im;
+        float d_re = a_re - b_re;
+        float d_im = a_im - b_im;
+        // odd = (a - b) * conj(w), z = even + i odd.
+        float odd_re = d_re * w_re[k] + d_im * w_im[k];
+        float odd_im = d_im * w_re[k] - d_re * w_im[k];
+        x_re[k] = even_re - odd_im;
+        x_im[k] = even_im + odd_re;
+        x_re[half - k] = even_re + odd_im;
+        x_im[half - k] = odd_re - even_im;
+      }
+
+      // Inverse transform: swapping real and imaginary parts on the way in and
+      // out turns the forward transform into the inverse one.
+      float* z_re = &input[half];
+      float* z_im = &input[0];
+      float* result_re = Transform(z_re, z_im, &output[half], &output[0], half);
+      float* result_im = result_re == z_re ? z_im : &output[0];
+      if (result_re == z_re) {
+        for (size_t i = 0; i < half; ++i) {
+          output[2 * i] = result_im[i];
+          output[2 * i + 1] = result_re[i];
+        }
+      } else {
+        std::copy(&output[0], &output[size], &input[0]);
+        for (size_t i = 0; i < half; ++i) {
+          output[2 * i] = input[i];
+          output[2 * i + 1] = input[half + i];
+        }
+      }
+    }
+
+  private:
+    enum {
+      kMaxLog2 = 20
+    };
+
+    // Twiddle factors of every transform size up to max_size, indexed by the
+    // base 2 logarithm of the size.
+    class TwiddleTables {
+    public:
+      TwiddleTables() {
+        float* radix4 = &radix4_[0];
+        float* unpack = &unpack_[0];
+        for (size_t log2 = 2, n = 4; n <= max_size; ++log2, n <<= 1) {
+          // Complex transforms are half the size of the real ones.
+          if (n <= (max_size >> 1)) {
+            for (size_t j = 0; j < 3; ++j) {
+              radix4_table_[log2][2 * j] = radix4;
+              radix4_table_[log2][2 * j + 1] = radix4 + n / 4;
+              for (size_t p = 0; p < n / 4; ++p) {
+                double phase = -2.0 * M_PI * static_cast<double>((j + 1) * p) / static_cast<double>(n);
+                radix4[p] = static_cast<float>(std::cos(phase));
+                radix4[p + n / 4] = static_cast<float>(std::sin(phase));
+              }
+              radix4 += n / 2;
+            }
+          }
+          unpack_table_[log2][0] = unpack;
+          unpack_table_[log2][1] = unpack + n / 4 + 1;
+          for (size_t k = 0; k <= n / 4; ++k) {
+            double phase = -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n);
+            unpack[k] = static_cast<float>(std::cos(phase));
+            unpack[k + n / 4 + 1] = static_cast<float>(std::sin(phase));
+          }
+          unpack += n / 2 + 2;
+        }
+      }
+
+      // exp(-2 pi i j p / n) for p < n / 4. Tables 0 to 5 hold the real and
+      // imaginary parts for j = 1, 2 and 3.
+      inline const float* radix4(size_t n, size_t table) const {
+        size_t log2 = 0;
+        while ((static_cast<size_t>(1) << log2) < n) {
+          ++log2;
+        }
+        return radix4_table_[log2][table];
+      }
+
+      // exp(-2 pi i k / n) for k <= n / 4, n being 2 ^ log2. Table 0 holds the
+      // real part, table 1 the imaginary part.
+      inline const float* unpack(size_t log2, size_t table) const {
+        return unpack_table_[log2][table];
+      }
+
+    private:
+      float radix4_[3 * max_size / 2];
+      float unpack_[max_size + 2 * kMaxLog2];
+      const float* radix4_table_[kMaxLog2 + 1][6];
+      const float* unpack_table_[kMaxLog2 + 1][2];
+    };
+
+    static const TwiddleTables& twiddles() {
+      static const TwiddleTables tables;
+      return tables;
+    }
+
+    // Forward complex FFT of size n, ping-ponging between (re, im) and
+    // (work_re, work_im). Returns the real part of the buffer holding the
+    // result; the imaginary part is at the matching position.
+    float* Transform(float* re, float* im, float* work_re, float* work_im, size_t n) {
+      float* x_re = re;
+      float* x_im = im;
+      float* y_re = work_re;
+      float* y_im = work_im;
+      size_t stride = 1;
+      while (n >= 4) {
+        Radix4Pass(n, stride, x_re, x_im, y_re, y_im);
+        std::swap(x_re, y_re);
+        std::swap(x_im, y_im);
+        n >>= 2;
+        stride <<= 2;
+      }
+      if (n == 2) {
+        for (size_t q = 0; q < stride; ++q) {
+          float a_re = x_re[q];
+          float a_im = x_im[q];
+          float b_re = x_re[q + stride];
+          float b_im = x_im[q + stride];
+          y_re[q] = a_re + b_re;
+          y_im[q] = a_im + b_im;
+          y_re[q + stride] = a_re - b_re;
+          y_im[q + stride] = a_im - b_im;
+        }
+        return y_re;
+      }
+      return x_re;
+    }
+
+    inline void Radix4Pass(
+        size_t n,
+        size_t stride,
+        const float* x_re,
+        const float* x_im,
+        float* y_re,
+        float* y_im) {
+      size_t quarter = n >> 2;
+      const float* w1_re = twiddles_->radix4(n, 0);
+      const float* w1_im = twiddles_->radix4(n, 1);
+      const float* w2_re = twiddles_->radix4(n, 2);
+      const float* w2_im = twiddles_->radix4(n, 3);
+      const float* w3_re = twiddles_->radix4(n, 4);
+      const float* w3_im = twiddles_->radix4(n, 5);
+
+      if (stride == 1) {
+        // First pass: vectorize across p.
+        for (size_t p = 0; p < quarter; ++p) {
+          Butterfly(
+              x_re[p], x_im[p],
+              x_re[p + quarter], x_im[p + quarter],
+              x_re[p + 2 * quarter], x_im[p + 2 * quarter],
+              x_re[p + 3 * quarter], x_im[p + 3 * quarter],
+              w1_re[p], w1_im[p], w2_re[p], w2_im[p], w3_re[p], w3_im[p],
+              &y_re[4 * p], &y_im[4 * p], 1);
+        }
+        return;
+      }
+
+      // Later passes: vectorize across q, the twiddles are constant.
+      for (size_t p = 0; p < quarter; ++p) {
+        const float* a_re = &x_re[stride * p];
+        const float* a_im = &x_im[stride * p];
+        size_t offset = stride * quarter;
+        float* out_re = &y_re[stride * 4 * p];
+        float* out_im = &y_im[stride * 4 * p];
+        for (size_t q = 0; q < stride; ++q) {
+          Butterfly(
+              a_re[q], a_im[q],
+              a_re[q + offset], a_im[q + offset],
+              a_re[q + 2 * offset], a_im[q + 2 * offset],
+              a_re[q + 3 * offset], a_im[q + 3 * offset],
+              w1_re[p], w1_im[p], w2_re[p], w2_im[p], w3_re[p], w3_im[p],
+              &out_re[q], &out_im[q], stride);
+        }
+      }
+    }
+
+    static inline void Butterfly(
+        float a_re, float a_im,
+        float b_re, float b_im,
+        float c_re, float c_im,
+        float d_re, float d_im,
+        float w1_re, float w1_im,
+        float w2_re, float w2_im,
+        float w3_re, float w3_im,
+        float* y_re, float* y_im,
+        size_t stride) {
+      float apc_re = a_re + c_re;
+      float apc_im = a_im + c_im;
+      float amc_re = a_re - c_re;
+      float amc_im = a_im - c_im;
+      float bpd_re = b_re + d_re;
+      float bpd_im = b_im + d_im;
+      float bmd_re = b_re - d_re;
+      float bmd_im = b_im - d_im;
+
+      float t1_re = amc_re + bmd_im;
+      float t1_im = amc_im - bmd_re;
+      float t2_re = apc_re - bpd_re;
+      float t2_im = apc_im - bpd_im;
+      float t3_re = amc_re - bmd_im;
+      float t3_im = amc_im + bmd_re;
+
+      y_re[0] = apc_re + bpd_re;
+      y_im[0] = apc_im + bpd_im;
+      y_re[stride] = t1_re * w1_re - t1_im * w1_im;
+      y_im[stride] = t1_re * w1_im + t1_im * w1_re;
+      y_re[2 * stride] = t2_re * w2_re - t2_im * w2_im;
+      y_im[2 * stride] = t2_re * w2_im + t2_im * w2_re;
+      y_re[3 * stride] = t3_re * w3_re - t3_im * w3_im;
+      y_im[3 * stride] = t3_re * w3_im + t3_im * w3_re;
+    }
+
+    const TwiddleTables* twiddles_;
+    size_t max_num_passes_;
+  };
+
+}  // namespace clouds
+
+#endif  // CLOUDS_DSP_PVOC_REAL_FFT_H_
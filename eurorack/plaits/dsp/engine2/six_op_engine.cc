@@ -60,12 +60,27 @@ namespace plaits {
     voice_.Render(parameters_, buffer, size);
   }
 
-  void FMVoice::LoadPatch(const fm::Patch* patch) {
+  /* static */
+  void FMVoice::RenderLanes(FMVoice* const* voices, float* const* buffers, int num_voices, size_t size) {
+    Voice<6>* fm_voices[kNumOperatorLanes];
+    const Voice<6>::Parameters* parameters[kNumOperatorLanes];
+    for (int i = 0; i < num_voices; ++i) {
+      fm_voices[i] = &voices[i]->voice_;
+      parameters[i] = &voices[i]->parameters_;
+    }
+    Voice<6>::RenderLanes(fm_voices, parameters, buffers, num_voices, size);
+  }
+
+  void FMVoice::LoadPatch(const fm::Patch* patch, const fm::Voice<6>::CompiledPatch* compiled) {
     if (patch == patch_) {
       return;
     }
     patch_ = patch;
-    voice_.SetPatch(patch_);
+    if (compiled) {
+      voice_.SetPatch(patch_, *compiled);
+    } else {
+      voice_.SetPatch(patch_);
+    }
     lfo_.Set(patch_->modulations);
   }
 
@@ -80,10 +95,14 @@ namespace plaits {
     }
     temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize * 4);
     acc_buffer_ = allocator->Allocate<float>(kMaxBlockSize * kNumSixOpVoices);
-    patches_ = allocator->Allocate<fm::Patch>(kNumPatchesPerBank);
+    unpacked_patches_ = allocator->Allocate<fm::Patch>(kNumPatchesPerBank);
+    patches_ = unpacked_patches_;
+    compiled_patches_ = NULL;
 
     active_voice_ = kNumSixOpVoices - 1;
     rendered_voice_ = 0;
+
+    pending_ = false;
   }
 
   void SixOpEngine::Reset() {
@@ -92,8 +111,15 @@ namespace plaits {
 
   void SixOpEngine::LoadUserData(const uint8_t* user_data) {
     for (int i = 0; i < kNumPatchesPerBank; ++i) {
-      patches_[i].Unpack(user_data + i * fm::Patch::SYX_SIZE);
+      unpacked_patches_[i].Unpack(user_data + i * fm::Patch::SYX_SIZE);
     }
+    LoadPatches(unpacked_patches_, NULL);
+  }
+
+  void SixOpEngine::LoadPatches(const fm::Patch* patches,
+    const fm::Voice<6>::CompiledPatch* compiled_patches) {
+    patches_ = patches;
+    compiled_patches_ = compiled_patches;
     for (int i = 0; i < kNumSixOpVoices; ++i) {
       voice_[i].UnloadPatch();
     }
@@ -108,7 +134,8 @@ namespace plaits {
       voice_[0].mutable_lfo()->Scrub(2.0f * kCorrectedSampleRate * t);
 
       for (int i = 0; i < kNumSixOpVoices; ++i) {
-        voice_[i].LoadPatch(&patches_[patch_index]);
+        voice_[i].LoadPatch(&patches_[patch_index],
+          compiled_patches_ ? &compiled_patches_[patch_index] : NULL);
         Voice<6>::Parameters* p = voice_[i].mutable_parameters();
         p->sustain = i == 0 ? true : false;
         p->gate = false;
@@ -121,7 +148,8 @@ namespace plaits {
     } else {
       // Note: fix glitchy voices when loading patches with trigger input connected. -Bat
       for (int voice = 0; voice < kNumSixOpVoices; ++voice) {
-        voice_[voice].LoadPatch(&patches_[patch_index]);
+        voice_[voice].LoadPatch(&patches_[patch_index],
+          compiled_patches_ ? &compiled_patches_[patch_index] : NULL);
       }
 
       if (parameters.trigger & TRIGGER_RISING_EDGE) {
@@ -158,14 +186,59 @@ namespace plaits {
     copy(&acc_buffer_[0], &acc_buffer_[(kNumSixOpVoices - 1) * size], &temp_buffer_[0]);
     fill(&temp_buffer_[(kNumSixOpVoices - 1) * size], &temp_buffer_[kNumSixOpVoices * size], 0.0f);
     rendered_voice_ = (rendered_voice_ + 1) % kNumSixOpVoices;
-    voice_[rendered_voice_].Render(temp_buffer_, size * kNumSixOpVoices);
 
+    pending_out_ = out;
+    pending_aux_ = aux;
+    pending_size_ = size;
+    pending_ = true;
+    if (!deferred_) {
+      RenderPendingVoice();
+    }
+  }
+
+  void SixOpEngine::RenderPendingVoice() {
+    voice_[rendered_voice_].Render(temp_buffer_, pending_size_ * kNumSixOpVoices);
+    FinishRender();
+  }
+
+  /* static */
+  void SixOpEngine::RenderPendingVoices(SixOpEngine* const* engines, int num_engines) {
+    const size_t size = engines[0]->pending_size_;
+    bool same_size = true;
+    for (int i = 1; i < num_engines; ++i) {
+      same_size = same_size && engines[i]->pending_size_ == size;
+    }
+
+    if (num_engines == 1 || !same_size || engines[0]->pending_algorithm() < 0 ||
+      size * kNumSixOpVoices > Voice<6>::kMaxLaneBlockSize) {
+      for (int i = 0; i < num_engines; ++i) {
+        engines[i]->RenderPendingVoice();
+      }
+      return;
+    }
+
+    FMVoice* voices[kNumOperatorLanes];
+    float* buffers[kNumOperatorLanes];
+    for (int i = 0; i < num_engines; ++i) {
+      voices[i] = &engines[i]->voice_[engines[i]->rendered_voice_];
+      buffers[i] = engines[i]->temp_buffer_;
+    }
+    FMVoice::RenderLanes(voices, buffers, num_engines, size * kNumSixOpVoices);
+
+    for (int i = 0; i < num_engines; ++i) {
+      engines[i]->FinishRender();
+    }
+  }
+
+  void SixOpEngine::FinishRender() {
+    const size_t size = pending_size_;
     for (size_t i = 0; i < size; ++i) {
-      aux[i] = out[i] = SoftClip(temp_buffer_[i] * 0.25f);
+      pending_aux_[i] = pending_out_[i] = SoftClip(temp_buffer_[i] * 0.25f);
     }
     copy(
       &temp_buffer_[size],
       &temp_buffer_[kNumSixOpVoices * size],
       &acc_buffer_[0]);
+    pending_ = false;
   }
 }  // namespace plaits
\ No newline at end of file
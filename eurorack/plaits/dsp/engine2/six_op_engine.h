@@ -46,9 +46,12 @@ namespace plaits {
     ~FMVoice() {}
 
     void Init(const fm::Algorithms<6>* algorithms, float sample_rate);
-    void LoadPatch(const fm::Patch* patch);
+    void LoadPatch(const fm::Patch* patch, const fm::Voice<6>::CompiledPatch* compiled);
     void Render(float* buffer, size_t size);
 
+    // Render() for up to fm::kNumOperatorLanes voices whose patches use the same algorithm.
+    static void RenderLanes(FMVoice* const* voices, float* const* buffers, int num_voices, size_t size);
+
     inline void UnloadPatch() {
       patch_ = NULL;
     }
@@ -85,7 +88,7 @@ namespace plaits {
 
   class SixOpEngine : public Engine {
   public:
-    SixOpEngine() {}
+    SixOpEngine() : deferred_(false), pending_(false) {}
     ~SixOpEngine() {}
 
     virtual void Init(stmlib::BufferAllocator* allocator) override;
@@ -94,18 +97,59 @@ namespace plaits {
     virtual void Render(const EngineParameters& parameters, float* out, float* aux, size_t size,
       bool* already_enveloped) override;
 
-    void LoadBank(int bank);
+    /*
+       With deferred rendering, Render() leaves the FM voice of the block
+       pending, to be rendered together with other engines' by
+       RenderPendingVoices(); out and aux are only filled then.
+    */
+    inline void set_deferred(bool deferred) {
+      deferred_ = deferred;
+    }
+
+    inline bool pending() const {
+      return pending_;
+    }
+
+    // Algorithm of the pending voice, or -1 if it has no patch to render.
+    inline int pending_algorithm() const {
+      const fm::Patch* patch = voice_[rendered_voice_].patch();
+      return patch ? patch->algorithm : -1;
+    }
+
+    void RenderPendingVoice();
+
+    /*
+       Renders the pending voices of engines whose pending_algorithm() is the
+       same, up to fm::kNumOperatorLanes of them, in lockstep.
+    */
+    static void RenderPendingVoices(SixOpEngine* const* engines, int num_engines);
+
+    /*
+       Plays a bank decoded elsewhere, instead of unpacking one of its own.
+       With its compiled patches, switching patches costs nothing.
+    */
+    void LoadPatches(const fm::Patch* patches, const fm::Voice<6>::CompiledPatch* compiled_patches);
 
   private:
+    void FinishRender();
+
     stmlib::HysteresisQuantizer2 patch_index_quantizer_;
     fm::Algorithms<6> algorithms_;
-    fm::Patch* patches_;
+    const fm::Patch* patches_;
+    const fm::Voice<6>::CompiledPatch* compiled_patches_;
+    fm::Patch* unpacked_patches_;
     FMVoice voice_[kNumSixOpVoices];
     float* temp_buffer_;
     float* acc_buffer_;
     int active_voice_;
     int rendered_voice_;
 
+    bool deferred_;
+    bool pending_;
+    float* pending_out_;
+    float* pending_aux_;
+    size_t pending_size_;
+
     DISALLOW_COPY_AND_ASSIGN(SixOpEngine);
   };
 }  // namespace plaits
@@ -399,7 +399,7 @@ const uint8_t Algorithms<6>::opcodes_[32][6] = {
   }
 };
 
-#define INSTANTIATE_RENDERER(n, m, a) { n, m, a, &RenderOperators<n, m, a> }
+#define INSTANTIATE_RENDERER(n, m, a) { n, m, a, &RenderOperators<n, m, a>, &RenderOperatorLanes<n, m, a> }
 
 /* static */
 template<>
@@ -419,7 +419,7 @@ const Algorithms<4>::RendererSpecs Algorithms<4>::renderers_[] = {
   INSTANTIATE_RENDERER(2,  0, false),
   INSTANTIATE_RENDERER(2,  0, true),*/
 
-  { 0, 0, 0, NULL}
+  { 0, 0, 0, NULL, NULL}
 };
 
 /* static */
@@ -449,7 +449,7 @@ const Algorithms<6>::RendererSpecs Algorithms<6>::renderers_[] = {
   INSTANTIATE_RENDERER(2,  0, false),
   INSTANTIATE_RENDERER(2,  0, true),*/
 
-  { 0, 0, 0, NULL}
+  { 0, 0, 0, NULL, NULL}
 };
 
 }  // namespace fm
@@ -80,6 +80,7 @@ class Algorithms {
   
   struct RenderCall {
     RenderFn render_fn;
+    LaneRenderFn lane_render_fn;
     int n;
     int input_index;
     int output_index;
@@ -105,14 +106,15 @@ class Algorithms {
     int modulation_source;
     bool additive;
     RenderFn render_fn;
+    LaneRenderFn lane_render_fn;
   };
      
-  inline RenderFn GetRenderer(int n, int modulation_source, bool additive) {
+  inline const RendererSpecs* GetRenderer(int n, int modulation_source, bool additive) {
     for (const RendererSpecs* r = renderers_; r->n; ++r) {
       if (r->n == n && \
           r->modulation_source == modulation_source && \
           r->additive == additive) {
-        return r->render_fn;
+        return r;
       }
     }
     return NULL;
@@ -160,10 +162,11 @@ class Algorithms {
             }
           }
         }
-        RenderFn fn = GetRenderer(n, modulation_source, additive);
-        if (fn) {
+        const RendererSpecs* renderer = GetRenderer(n, modulation_source, additive);
+        if (renderer) {
           RenderCall* call = &render_call_[algorithm][i];
-          call->render_fn = fn;
+          call->render_fn = renderer->render_fn;
+          call->lane_render_fn = renderer->lane_render_fn;
           call->n = n;
           call->input_index = (opcode & SOURCE_MASK) >> 4;
           call->output_index = out_opcode & DESTINATION_MASK;
@@ -85,6 +85,12 @@ class Envelope {
     std::copy(&increment[0], &increment[num_stages], &increment_[0]);
     std::copy(&level[0], &level[num_stages], &level_[0]);
   }
+
+  // Copy the variables out, for a later Set().
+  void Get(float increment[num_stages], float level[num_stages]) const {
+    std::copy(&increment_[0], &increment_[num_stages], &increment[0]);
+    std::copy(&level_[0], &level_[num_stages], &level[0]);
+  }
   
   inline float RenderAtSample(float t, const float gate_duration) {
     if (t > gate_duration) {
@@ -187,6 +193,8 @@ class Envelope {
 
 class OperatorEnvelope : public Envelope<4, true> {
  public:
+  using Envelope<4, true>::Set;
+
   void Set(const uint8_t rate[NUM_STAGES], const uint8_t level[NUM_STAGES],
            uint8_t global_level) {
     // Configure levels.
@@ -230,6 +238,8 @@ class OperatorEnvelope : public Envelope<4, true> {
 
 class PitchEnvelope : public Envelope<4, false> {
  public:
+  using Envelope<4, false>::Set;
+
   void Set(const uint8_t rate[NUM_STAGES], const uint8_t level[NUM_STAGES]) {
     // Configure levels.
     for (int i = 0; i < NUM_STAGES; ++i) {
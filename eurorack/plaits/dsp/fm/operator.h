@@ -131,6 +131,104 @@ void RenderOperators(
   }
 };
 
+// Number of voices RenderOperatorLanes() renders at once.
+const int kNumOperatorLanes = 4;
+
+typedef void (*LaneRenderFn)(
+    Operator* const* ops,
+    const float (*f)[kNumOperatorLanes],
+    const float (*a)[kNumOperatorLanes],
+    float (*fb_state)[kNumOperatorLanes],
+    const int* fb_amount,
+    const float (*modulation)[kNumOperatorLanes],
+    float (*out)[kNumOperatorLanes],
+    size_t size);
+
+// RenderOperators() for kNumOperatorLanes voices in lockstep, one voice per
+// lane: ops[lane] points to the operators of that lane's voice, and the
+// per-operator values, feedback state and samples are indexed [...][lane], so
+// that the loops over the lanes vectorize. The arithmetic is the same.
+template<int n, int modulation_source, bool additive>
+void RenderOperatorLanes(
+    Operator* const* ops,
+    const float (*f)[kNumOperatorLanes],
+    const float (*a)[kNumOperatorLanes],
+    float (*fb_state)[kNumOperatorLanes],
+    const int* fb_amount,
+    const float (*modulation)[kNumOperatorLanes],
+    float (*out)[kNumOperatorLanes],
+    size_t size) {
+  const int kLanes = kNumOperatorLanes;
+
+  float previous_0[kLanes], previous_1[kLanes];
+  float fb_scale[kLanes];
+
+  uint32_t frequency[n][kLanes];
+  uint32_t phase[n][kLanes];
+  float amplitude[n][kLanes];
+  float amplitude_increment[n][kLanes];
+
+  const float scale = 1.0f / float(size);
+  for (int lane = 0; lane < kLanes; ++lane) {
+    if (modulation_source >= Operator::MODULATION_SOURCE_FEEDBACK) {
+      previous_0[lane] = fb_state[0][lane];
+      previous_1[lane] = fb_state[1][lane];
+    }
+    fb_scale[lane] = fb_amount[lane] ? float(1 << fb_amount[lane]) / 512.0f : 0.0f;
+
+    for (int i = 0; i < n; ++i) {
+      frequency[i][lane] = static_cast<uint32_t>(std::min(f[i][lane], 0.5f) * 4294967296.0f);
+      phase[i][lane] = ops[lane][i].phase;
+      amplitude[i][lane] = ops[lane][i].amplitude;
+      amplitude_increment[i][lane] = (std::min(a[i][lane], 4.0f) - amplitude[i][lane]) * scale;
+    }
+  }
+
+  for (size_t t = 0; t < size; ++t) {
+    float pm[kLanes];
+    for (int lane = 0; lane < kLanes; ++lane) {
+      if (modulation_source >= Operator::MODULATION_SOURCE_FEEDBACK) {
+        pm[lane] = (previous_0[lane] + previous_1[lane]) * fb_scale[lane];
+      } else if (modulation_source == Operator::MODULATION_SOURCE_EXTERNAL) {
+        pm[lane] = modulation[t][lane];
+      } else {
+        pm[lane] = 0.0f;
+      }
+    }
+    for (int i = 0; i < n; ++i) {
+      for (int lane = 0; lane < kLanes; ++lane) {
+        phase[i][lane] += frequency[i][lane];
+        pm[lane] = SinePM(phase[i][lane], pm[lane]) * amplitude[i][lane];
+        amplitude[i][lane] += amplitude_increment[i][lane];
+      }
+      if (i == modulation_source) {
+        for (int lane = 0; lane < kLanes; ++lane) {
+          previous_1[lane] = previous_0[lane];
+          previous_0[lane] = pm[lane];
+        }
+      }
+    }
+    for (int lane = 0; lane < kLanes; ++lane) {
+      if (additive) {
+        out[t][lane] += pm[lane];
+      } else {
+        out[t][lane] = pm[lane];
+      }
+    }
+  }
+
+  for (int lane = 0; lane < kLanes; ++lane) {
+    for (int i = 0; i < n; ++i) {
+      ops[lane][i].phase = phase[i][lane];
+      ops[lane][i].amplitude = amplitude[i][lane];
+    }
+    if (modulation_source >= Operator::MODULATION_SOURCE_FEEDBACK) {
+      fb_state[0][lane] = previous_0[lane];
+      fb_state[1][lane] = previous_1[lane];
+    }
+  }
+}
+
 }  // namespace fm
   
 }  // namespace plaits
@@ -31,6 +31,8 @@
 
 #include "stmlib/stmlib.h"
 
+#include <algorithm>
+
 namespace plaits {
   namespace fm {
     struct Patch {
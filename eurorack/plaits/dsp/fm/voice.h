@@ -62,6 +62,54 @@ namespace plaits {
         float amp_mod;
       };
 
+      // Everything Setup() pre-computes from a patch.
+      struct CompiledPatch {
+        float pitch_envelope_increment[PitchEnvelope::NUM_STAGES];
+        float pitch_envelope_level[PitchEnvelope::NUM_STAGES];
+        float envelope_increment[num_operators][OperatorEnvelope::NUM_STAGES];
+        float envelope_level[num_operators][OperatorEnvelope::NUM_STAGES];
+        float level_headroom[num_operators];
+        float ratios[num_operators];
+      };
+
+      /*
+         Compiles a patch for voices running at sample_rate, once for all
+         of them.
+      */
+      static void Compile(const Patch& patch, float sample_rate, CompiledPatch* compiled) {
+        const float native_sr = 44100.0f;  // Legacy sample rate.
+        const float envelope_scale = native_sr * (1.0f / sample_rate);
+
+        PitchEnvelope pitch_envelope;
+        pitch_envelope.Init(envelope_scale);
+        pitch_envelope.Set(patch.pitch_envelope.rate, patch.pitch_envelope.level);
+        pitch_envelope.Get(compiled->pitch_envelope_increment, compiled->pitch_envelope_level);
+
+        for (int i = 0; i < num_operators; ++i) {
+          const Patch::Operator& op = patch.op[i];
+
+          int level = OperatorLevel(op.level);
+          OperatorEnvelope operator_envelope;
+          operator_envelope.Init(envelope_scale);
+          operator_envelope.Set(op.envelope.rate, op.envelope.level, level);
+          operator_envelope.Get(compiled->envelope_increment[i], compiled->envelope_level[i]);
+
+          /*
+             The level increase caused by keyboard scaling plus velocity
+             scaling should not exceed this number - otherwise it would be
+             equivalent to have an operator with a level above 99.
+          */
+          compiled->level_headroom[i] = float(127 - level);
+
+          /*
+             Pre-compute frequency ratios. Encode the base frequency
+             (1Hz or the root note) as the sign of the ratio.
+          */
+          float sign = op.mode == 0 ? 1.0f : -1.0f;
+          compiled->ratios[i] = sign * FrequencyRatio(op);
+        }
+      }
+
       inline void Init(const Algorithms<num_operators>* algorithms, float sample_rate) {
         algorithms_ = algorithms;
 
@@ -93,6 +141,16 @@ namespace plaits {
         dirty_ = true;
       }
 
+      /*
+         Loads a patch compiled for this voice's sample rate: it plays from
+         the next Render() on, without the blank of a Setup().
+      */
+      inline void SetPatch(const Patch* patch, const CompiledPatch& compiled) {
+        patch_ = patch;
+        Load(compiled);
+        dirty_ = false;
+      }
+
       /*
          Pre-compute everything that can be pre-computed once a patch is loaded:
          - envelope constants
@@ -103,27 +161,9 @@ namespace plaits {
           return false;
         }
 
-        pitch_envelope_.Set(patch_->pitch_envelope.rate, patch_->pitch_envelope.level);
-        for (int i = 0; i < num_operators; ++i) {
-          const Patch::Operator& op = patch_->op[i];
-
-          int level = OperatorLevel(op.level);
-          operator_envelope_[i].Set(op.envelope.rate, op.envelope.level, level);
-
-          /*
-             The level increase caused by keyboard scaling plus velocity
-             scaling should not exceed this number - otherwise it would be
-             equivalent to have an operator with a level above 99.
-          */
-          level_headroom_[i] = float(127 - level);
-
-          /*
-             Pre-compute frequency ratios. Encode the base frequency
-             (1Hz or the root note) as the sign of the ratio.
-          */
-          float sign = op.mode == 0 ? 1.0f : -1.0f;
-          ratios_[i] = sign * FrequencyRatio(op);
-        }
+        CompiledPatch compiled;
+        Compile(*patch_, sample_rate_, &compiled);
+        Load(compiled);
         dirty_ = false;
         return true;
       }
@@ -150,6 +190,117 @@ namespace plaits {
           return;
         }
 
+        float f[num_operators];
+        float a[num_operators];
+        ComputeOperators(parameters, size, f, a);
+
+        for (int i = 0; i < num_operators; ) {
+          const typename Algorithms<num_operators>::RenderCall& call =
+            algorithms_->render_call(patch_->algorithm, i);
+          (*call.render_fn)(&operator_[i], &f[i], &a[i], feedback_state_, patch_->feedback,
+            buffers[call.input_index], buffers[call.output_index], size);
+          i += call.n;
+        }
+      }
+
+      static const size_t kMaxLaneBlockSize = 64;
+
+      /*
+         Render(parameters[i], temp[i], size) for up to kNumOperatorLanes voices
+         whose patches use the same algorithm. Each group of operators is
+         rendered for all the voices at once, one voice per SIMD lane.
+         size must not exceed kMaxLaneBlockSize.
+      */
+      static void RenderLanes(Voice* const* voices, const Parameters* const* parameters, float* const* temp,
+        int num_voices, size_t size) {
+        const int kLanes = kNumOperatorLanes;
+
+        Voice* lane_voice[kLanes];
+        float* lane_temp[kLanes];
+        float f[num_operators][kLanes];
+        float a[num_operators][kLanes];
+        float fb_state[2][kLanes];
+        int fb_amount[kLanes];
+
+        int num_lanes = 0;
+        for (int i = 0; i < num_voices; ++i) {
+          Voice* voice = voices[i];
+          if (voice->Setup()) {
+            // Same blank as in Render().
+            continue;
+          }
+          float voice_f[num_operators];
+          float voice_a[num_operators];
+          voice->ComputeOperators(*parameters[i], size, voice_f, voice_a);
+
+          const int lane = num_lanes++;
+          lane_voice[lane] = voice;
+          lane_temp[lane] = temp[i];
+          for (int j = 0; j < num_operators; ++j) {
+            f[j][lane] = voice_f[j];
+            a[j][lane] = voice_a[j];
+          }
+          fb_state[0][lane] = voice->feedback_state_[0];
+          fb_state[1][lane] = voice->feedback_state_[1];
+          fb_amount[lane] = voice->patch_->feedback;
+        }
+        if (!num_lanes) {
+          return;
+        }
+
+        // Unused lanes render silent operators.
+        Operator idle_operators[num_operators];
+        for (int j = 0; j < num_operators; ++j) {
+          idle_operators[j].Reset();
+        }
+        for (int lane = num_lanes; lane < kLanes; ++lane) {
+          for (int j = 0; j < num_operators; ++j) {
+            f[j][lane] = 0.0f;
+            a[j][lane] = 0.0f;
+          }
+          fb_state[0][lane] = fb_state[1][lane] = 0.0f;
+          fb_amount[lane] = 0;
+        }
+
+        // The buffers of Render(parameters, temp, size), interleaved. The last two are one and the same.
+        float buffers[3][kMaxLaneBlockSize][kLanes];
+        for (int lane = 0; lane < kLanes; ++lane) {
+          for (int buffer = 0; buffer < 3; ++buffer) {
+            const float* source = lane < num_lanes ? lane_temp[lane] + buffer * size : NULL;
+            for (size_t t = 0; t < size; ++t) {
+              buffers[buffer][t][lane] = source ? source[t] : 0.0f;
+            }
+          }
+        }
+
+        const int algorithm = lane_voice[0]->patch_->algorithm;
+        const Algorithms<num_operators>* algorithms = lane_voice[0]->algorithms_;
+        Operator* ops[kLanes];
+        for (int i = 0; i < num_operators; ) {
+          const typename Algorithms<num_operators>::RenderCall& call = algorithms->render_call(algorithm, i);
+          for (int lane = 0; lane < kLanes; ++lane) {
+            ops[lane] = lane < num_lanes ? &lane_voice[lane]->operator_[i] : &idle_operators[i];
+          }
+          (*call.lane_render_fn)(ops, &f[i], &a[i], fb_state, fb_amount,
+            buffers[std::min(call.input_index, 2)], buffers[std::min(call.output_index, 2)], size);
+          i += call.n;
+        }
+
+        for (int lane = 0; lane < num_lanes; ++lane) {
+          for (int buffer = 0; buffer < 3; ++buffer) {
+            float* destination = lane_temp[lane] + buffer * size;
+            for (size_t t = 0; t < size; ++t) {
+              destination[t] = buffers[buffer][t][lane];
+            }
+          }
+          lane_voice[lane]->feedback_state_[0] = fb_state[0][lane];
+          lane_voice[lane]->feedback_state_[1] = fb_state[1][lane];
+        }
+      }
+
+    private:
+      // Envelopes, frequencies and amplitudes of the operators for the next size samples.
+      inline void ComputeOperators(const Parameters& parameters, size_t size, float* f, float* a) {
         const float envelope_rate = float(size);
         const float ad_scale = Pow2Fast<1>((0.5f - parameters.envelope_control) * 8.0f);
         const float r_scale = Pow2Fast<1>(-fabsf(parameters.envelope_control - 0.3f) * 8.0f);
@@ -183,8 +334,6 @@ namespace plaits {
         }
 
         // Compute frequencies and amplitudes.
-        float f[num_operators];
-        float a[num_operators];
         for (int i = 0; i < num_operators; ++i) {
           const Patch::Operator& op = patch_->op[i];
 
@@ -213,17 +362,17 @@ namespace plaits {
           a[i] = Pow2Fast<2>(-14.0f + level * level_mod);
 #endif  // FAST_LINEAR_AMPLITUDE_MODULATION
         }
+      }
 
-        for (int i = 0; i < num_operators; ) {
-          const typename Algorithms<num_operators>::RenderCall& call =
-            algorithms_->render_call(patch_->algorithm, i);
-          (*call.render_fn)(&operator_[i], &f[i], &a[i], feedback_state_, patch_->feedback,
-            buffers[call.input_index], buffers[call.output_index], size);
-          i += call.n;
+      inline void Load(const CompiledPatch& compiled) {
+        pitch_envelope_.Set(compiled.pitch_envelope_increment, compiled.pitch_envelope_level);
+        for (int i = 0; i < num_operators; ++i) {
+          operator_envelope_[i].Set(compiled.envelope_increment[i], compiled.envelope_level[i]);
+          level_headroom_[i] = compiled.level_headroom[i];
+          ratios_[i] = compiled.ratios[i];
         }
       }
 
-    private:
       const Algorithms<num_operators>* algorithms_;
       float sample_rate_;
       float one_hz_;
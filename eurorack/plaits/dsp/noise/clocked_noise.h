@@ -60,12 +60,13 @@ class ClockedNoise {
       phase_ = 1.0f;
     }
 
+    stmlib::Random::Stream stream;
     while (size--) {
       float this_sample = next_sample;
       next_sample = 0.0f;
 
       const float frequency = fm.Next();
-      const float raw_sample = stmlib::Random::GetFloat() * 2.0f - 1.0f;
+      const float raw_sample = stream.GetFloat() * 2.0f - 1.0f;
       float raw_amount = 4.0f * (frequency - 0.25f);
       CONSTRAIN(raw_amount, 0.0f, 1.0f);
       
@@ -33,9 +33,9 @@
 
 namespace plaits {
 
-inline float Dust(float frequency) {
+inline float Dust(float frequency, stmlib::Random::Stream* stream) {
   float inv_frequency = 1.0f / frequency;
-  float u = stmlib::Random::GetFloat();
+  float u = stream->GetFloat();
   if (u < frequency) {
     return u * inv_frequency;
   } else {
@@ -55,7 +55,8 @@ class Particle {
       float* out,
       float* aux,
       size_t size) {
-    float u = stmlib::Random::GetFloat();
+    stmlib::Random::Stream stream;
+    float u = stream.GetFloat();
     if (sync) {
       u = density;
     }
@@ -65,7 +66,7 @@ class Particle {
       if (u <= density) {
         s = u * gain;
         if (can_radomize_frequency) {
-          const float u = 2.0f * stmlib::Random::GetFloat() - 1.0f;
+          const float u = 2.0f * stream.GetFloat() - 1.0f;
           const float f = std::min(
               stmlib::SemitonesToRatio(spread * u) * frequency,
               0.25f);
@@ -77,7 +78,7 @@ class Particle {
       }
       *aux++ += s;
       *out++ += filter_.Process<stmlib::FILTER_MODE_BAND_PASS>(pre_gain_ * s);
-      u = stmlib::Random::GetFloat();
+      u = stream.GetFloat();
     }
   }
  
@@ -81,16 +81,18 @@ void StringVoice::Render(
 
   if (sustain) {
     const float dust_f = 0.00005f + 0.99995f * density * density;
+    Random::Stream stream;
     for (size_t i = 0; i < size; ++i) {
-      temp[i] = Dust(dust_f) * (8.0f - dust_f * 6.0f) * accent;
+      temp[i] = Dust(dust_f, &stream) * (8.0f - dust_f * 6.0f) * accent;
     }
   } else if (remaining_noise_samples_) {
     size_t noise_samples = min(remaining_noise_samples_, size);
     remaining_noise_samples_ -= noise_samples;
     size_t tail = size - noise_samples;
     float* start = temp;
+    Random::Stream stream;
     while (noise_samples--) {
-      *start++ = 2.0f * Random::GetFloat() - 1.0f;
+      *start++ = 2.0f * stream.GetFloat() - 1.0f;
     }
     while (tail--) {
       *start++ = 0.0f;
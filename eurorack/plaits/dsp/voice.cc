@@ -32,7 +32,8 @@ namespace plaits {
   using namespace std;
   using namespace stmlib;
 
-  void Voice::Init(BufferAllocator* allocator, UserData* user_data) {
+  void Voice::Init(void* ram, UserData* user_data) {
+    allocator_.Init(ram, kVoiceRamSize);
     user_data_ = user_data;
     engines_.Init();
 
@@ -63,10 +64,11 @@ namespace plaits {
     engines_.RegisterInstance(&snare_drum_engine_, true, 0.8f, 0.8f);
     engines_.RegisterInstance(&hi_hat_engine_, true, 0.8f, 0.8f);
 
+    // Its FM voices are rendered by RenderSixOpVoices().
+    six_op_engine_.set_deferred(true);
+
     for (int i = 0; i < engines_.size(); ++i) {
-      // All engines will share the same RAM space.
-      allocator->Free();
-      engines_.get(i)->Init(allocator);
+      engine_initialized_[i] = false;
     }
 
     engine_quantizer_.Init(engines_.size(), 0.05f, true);
@@ -76,6 +78,13 @@ namespace plaits {
 
     out_post_processor_.Init();
     aux_post_processor_.Init();
+    post_processing_parameters_.out_gain = 1.0f;
+    post_processing_parameters_.aux_gain = 1.0f;
+    post_processing_parameters_.lpg_bypass = true;
+    post_processing_parameters_.lpg_gain = 0.0f;
+    post_processing_parameters_.lpg_frequency = 0.0f;
+    post_processing_parameters_.lpg_hf_bleed = 0.0f;
+    post_processing_parameters_.engine_changed = false;
 
     decay_envelope_.Init();
     lpg_envelope_.Init();
@@ -87,6 +96,62 @@ namespace plaits {
   }
 
   void Voice::Render(const Patch& patch, const Modulations& modulations, Frame* frames, size_t size) {
+    RenderEngine(patch, modulations, size);
+    RenderSixOpVoices(this, 1);
+
+    const PostProcessingParameters& pp = post_processing_parameters_;
+    if (pp.engine_changed) {
+      out_post_processor_.Reset();
+    }
+
+    out_post_processor_.Process(pp.out_gain, pp.lpg_bypass, pp.lpg_gain, pp.lpg_frequency, pp.lpg_hf_bleed,
+      out_buffer_, &frames->out, size, 2);
+
+    aux_post_processor_.Process(pp.aux_gain, pp.lpg_bypass, pp.lpg_gain, pp.lpg_frequency, pp.lpg_hf_bleed,
+      aux_buffer_, &frames->aux, size, 2);
+  }
+
+  /* static */
+  void Voice::RenderSixOpVoices(Voice* voices, int num_voices) {
+    for (int i = 0; i < num_voices; ++i) {
+      SixOpEngine* engine = &voices[i].six_op_engine_;
+      if (!engine->pending()) {
+        continue;
+      }
+
+      // Gather up to fm::kNumOperatorLanes pending voices playing the same algorithm.
+      const int algorithm = engine->pending_algorithm();
+      SixOpEngine* engines[fm::kNumOperatorLanes];
+      int num_engines = 0;
+      engines[num_engines++] = engine;
+      for (int j = i + 1; j < num_voices && algorithm >= 0 && num_engines < fm::kNumOperatorLanes; ++j) {
+        SixOpEngine* other = &voices[j].six_op_engine_;
+        if (other->pending() && other->pending_algorithm() == algorithm) {
+          engines[num_engines++] = other;
+        }
+      }
+      SixOpEngine::RenderPendingVoices(engines, num_engines);
+    }
+  }
+
+  void Voice::InitEngine(int engine_index) {
+    Engine* e = engines_.get(engine_index);
+
+    /* All engines share the same RAM space, as they did when they were all
+       initialised up front: its contents do not survive the selection of
+       another engine. */
+    allocator_.Free();
+    e->Init(&allocator_);
+
+    // The three 6-op FM banks are one engine instance.
+    for (int i = 0; i < engines_.size(); ++i) {
+      if (engines_.get(i) == e) {
+        engine_initialized_[i] = true;
+      }
+    }
+  }
+
+  void Voice::RenderEngine(const Patch& patch, const Modulations& modulations, size_t size) {
     // Trigger, LPG, internal envelope.
 
     /* Delay trigger by 1ms to deal with sequencers or MIDI interfaces whose
@@ -118,15 +183,25 @@ namespace plaits {
 
     Engine* e = engines_.get(engine_index);
 
+    post_processing_parameters_.engine_changed = false;
     if (engine_index != previous_engine_index_ || reload_user_data_) {
-      const uint8_t* data = user_data_ ? user_data_->ptr(engine_index) : NULL;
-      if (!data && engine_index >= 2 && engine_index <= 4) {
-        data = fm_patches_table[engine_index - 2];
+      if (!engine_initialized_[engine_index]) {
+        InitEngine(engine_index);
+      }
+      if (engine_index >= 2 && engine_index <= 4) {
+        // The six-op banks come decoded, and are shared by all the voices.
+        if (user_data_) {
+          six_op_engine_.LoadPatches(user_data_->patches(engine_index),
+            user_data_->compiled_patches(engine_index));
+        } else {
+          six_op_engine_.LoadUserData(fm_patches_table[engine_index - 2]);
+        }
+      } else {
+        e->LoadUserData(user_data_ ? user_data_->ptr(engine_index) : NULL);
       }
-      e->LoadUserData(data);
       e->Reset();
 
-      out_post_processor_.Reset();
+      post_processing_parameters_.engine_changed = true;
       previous_engine_index_ = engine_index;
       reload_user_data_ = false;
     }
@@ -211,10 +286,122 @@ namespace plaits {
       lpg_envelope_.Init();
     }
 
-    out_post_processor_.Process(pp_s.out_gain, lpg_bypass, lpg_envelope_.gain(), lpg_envelope_.frequency(),
-      lpg_envelope_.hf_bleed(), out_buffer_, &frames->out, size, 2);
+    post_processing_parameters_.out_gain = pp_s.out_gain;
+    post_processing_parameters_.aux_gain = pp_s.aux_gain;
+    post_processing_parameters_.lpg_bypass = lpg_bypass;
+    post_processing_parameters_.lpg_gain = lpg_envelope_.gain();
+    post_processing_parameters_.lpg_frequency = lpg_envelope_.frequency();
+    post_processing_parameters_.lpg_hf_bleed = lpg_envelope_.hf_bleed();
+  }
+
+  void PostProcessorBank::Process(const Voice* voices, int num_voices, Voice::Frame* frames, size_t size) {
+    const int kLanes = kPostProcessorBankLanes;
+
+    float in[kMaxBlockSize][kLanes];
+    int32_t out[kMaxBlockSize][kLanes];
+
+    int32_t use_limiter[kLanes];
+    float limiter_gain[kLanes];
+    float limiter_peak[kLanes];
+    int32_t use_lpg[kLanes];
+    float gain[kLanes];
+    float gain_increment[kLanes];
+    float g[kLanes];
+    float r[kLanes];
+    float h[kLanes];
+    float hf_bleed[kLanes];
+    float state_1[kLanes];
+    float state_2[kLanes];
+
+    // Per-lane setup: ChannelPostProcessor::Process() and LowPassGate::Process(), minus the sample loop.
+    for (int lane = 0; lane < kLanes; ++lane) {
+      const int voice = lane >> 1;
+      const bool aux = lane & 1;
+      if (voice >= num_voices) {
+        for (size_t i = 0; i < size; ++i) {
+          in[i][lane] = 0.0f;
+        }
+        use_limiter[lane] = false;
+        limiter_gain[lane] = 0.0f;
+        use_lpg[lane] = false;
+        gain[lane] = 0.0f;
+        gain_increment[lane] = 0.0f;
+        g[lane] = r[lane] = h[lane] = hf_bleed[lane] = 0.0f;
+      } else {
+        const PostProcessingParameters& p = voices[voice].post_processing_parameters();
+        const float* buffer = aux ? voices[voice].aux_buffer() : voices[voice].out_buffer();
+        for (size_t i = 0; i < size; ++i) {
+          in[i][lane] = buffer[i];
+        }
+
+        if (!aux && p.engine_changed) {
+          limiter_peak_[lane] = 0.5f;
+        }
+
+        const float channel_gain = aux ? p.aux_gain : p.out_gain;
+        use_limiter[lane] = channel_gain < 0.0f;
+        limiter_gain[lane] = -channel_gain;
+        const float post_gain = (channel_gain < 0.0f ? 1.0f : channel_gain) * -32767.0f;
+
+        use_lpg[lane] = !p.lpg_bypass;
+        if (use_lpg[lane]) {
+          gain[lane] = lpg_previous_gain_[lane];
+          gain_increment[lane] = (post_gain * p.lpg_gain - gain[lane]) / static_cast<float>(size);
+          g[lane] = OnePole::tan<FREQUENCY_DIRTY>(p.lpg_frequency);
+          r[lane] = 1.0f / 0.4f;
+          h[lane] = 1.0f / (1.0f + r[lane] * g[lane] + g[lane] * g[lane]);
+          hf_bleed[lane] = p.lpg_hf_bleed;
+        } else {
+          gain[lane] = post_gain;
+          gain_increment[lane] = 0.0f;
+          g[lane] = r[lane] = h[lane] = hf_bleed[lane] = 0.0f;
+        }
+      }
+      limiter_peak[lane] = limiter_peak_[lane];
+      state_1[lane] = lpg_state_1_[lane];
+      state_2[lane] = lpg_state_2_[lane];
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      for (int lane = 0; lane < kLanes; ++lane) {
+        float s = in[i][lane];
+
+        // stmlib::Limiter.
+        float limited = s * limiter_gain[lane];
+        float error = fabsf(limited) - limiter_peak[lane];
+        float peak = limiter_peak[lane] + (error > 0 ? 0.05f : 0.00002f) * error;
+        limited = limited * (peak <= 1.0f ? 1.0f : 1.0f / peak) * 0.8f;
+        limiter_peak[lane] = use_limiter[lane] ? peak : limiter_peak[lane];
+        s = use_limiter[lane] ? limited : s;
+
+        // LowPassGate, or the plain gain when it is bypassed.
+        gain[lane] += gain_increment[lane];
+        s *= gain[lane];
+        float hp = (s - r[lane] * state_1[lane] - g[lane] * state_1[lane] - state_2[lane]) * h[lane];
+        float bp = g[lane] * hp + state_1[lane];
+        float lp = g[lane] * bp + state_2[lane];
+        state_1[lane] = use_lpg[lane] ? g[lane] * hp + bp : state_1[lane];
+        state_2[lane] = use_lpg[lane] ? g[lane] * bp + lp : state_2[lane];
+        float value = use_lpg[lane] ? lp + (s - lp) * hf_bleed[lane] : s;
+
+        int32_t sample = 1 + static_cast<int32_t>(value);
+        out[i][lane] = sample < -32768 ? -32768 : (sample > 32767 ? 32767 : sample);
+      }
+    }
+
+    for (int lane = 0; lane < kLanes; ++lane) {
+      limiter_peak_[lane] = limiter_peak[lane];
+      lpg_previous_gain_[lane] = use_lpg[lane] ? gain[lane] : lpg_previous_gain_[lane];
+      lpg_state_1_[lane] = state_1[lane];
+      lpg_state_2_[lane] = state_2[lane];
+    }
 
-    aux_post_processor_.Process(pp_s.aux_gain, lpg_bypass, lpg_envelope_.gain(), lpg_envelope_.frequency(),
-      lpg_envelope_.hf_bleed(), aux_buffer_, &frames->aux, size, 2);
+    for (int voice = 0; voice < num_voices; ++voice) {
+      Voice::Frame* voice_frames = frames + voice * size;
+      for (size_t i = 0; i < size; ++i) {
+        voice_frames[i].out = out[i][voice * 2];
+        voice_frames[i].aux = out[i][voice * 2 + 1];
+      }
+    }
   }
 }  // namespace plaits
\ No newline at end of file
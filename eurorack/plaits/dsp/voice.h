@@ -68,6 +68,8 @@
 
 namespace plaits {
   const int kMaxEngines = 24;
+  // Scratch RAM shared by all the engines of a voice.
+  const size_t kVoiceRamSize = 16384;
   const int kMaxTriggerDelay = 8;
   const int kTriggerDelay = 5;
 
@@ -139,6 +141,17 @@ namespace plaits {
     bool level_patched;
   };
 
+  // Everything the post-processing stage needs from the engine side of a voice.
+  struct PostProcessingParameters {
+    float out_gain;
+    float aux_gain;
+    bool lpg_bypass;
+    float lpg_gain;
+    float lpg_frequency;
+    float lpg_hf_bleed;
+    bool engine_changed;
+  };
+
   class Voice {
   public:
     Voice() {}
@@ -149,15 +162,41 @@ namespace plaits {
       short aux;
     };
 
-    void Init(stmlib::BufferAllocator* allocator, UserData* user_data);
+    /*
+       Engines are initialised the first time they are selected, in the
+       kVoiceRamSize bytes of scratch RAM at ram, which must outlive the
+       voice.
+    */
+    void Init(void* ram, UserData* user_data);
     void ReloadUserData() {
       reload_user_data_ = true;
     }
     void Render(const Patch& patch, const Modulations& modulations, Frame* frames, size_t size);
+    /*
+       First half of Render(): triggers, engine and LPG envelope. The engine
+       output is left in out_buffer() and aux_buffer(), to be post-processed
+       by a PostProcessorBank together with other voices. RenderSixOpVoices()
+       must be called in between.
+    */
+    void RenderEngine(const Patch& patch, const Modulations& modulations, size_t size);
+    /*
+       Renders the 6-op FM voices that RenderEngine() left pending. Voices
+       playing the same algorithm are rendered in lockstep, up to
+       fm::kNumOperatorLanes at a time.
+    */
+    static void RenderSixOpVoices(Voice* voices, int num_voices);
     inline int active_engine() const { return previous_engine_index_; }
 
+    inline const PostProcessingParameters& post_processing_parameters() const {
+      return post_processing_parameters_;
+    }
+
+    inline const float* out_buffer() const { return out_buffer_; }
+    inline const float* aux_buffer() const { return aux_buffer_; }
+
   private:
     void ComputeDecayParameters(const Patch& settings);
+    void InitEngine(int engine_index);
 
     inline float ApplyModulations(float base_value, float modulation_amount, bool use_external_modulation,
       float external_modulation, bool use_internal_envelope, float envelope, float default_internal_modulation,
@@ -219,11 +258,50 @@ namespace plaits {
     ChannelPostProcessor aux_post_processor_;
 
     EngineRegistry<kMaxEngines> engines_;
+    bool engine_initialized_[kMaxEngines];
+    stmlib::BufferAllocator allocator_;
 
     float out_buffer_[kMaxBlockSize];
     float aux_buffer_[kMaxBlockSize];
 
+    PostProcessingParameters post_processing_parameters_;
+
     DISALLOW_COPY_AND_ASSIGN(Voice);
   };
+
+  const int kPostProcessorBankVoices = 4;
+  const int kPostProcessorBankLanes = kPostProcessorBankVoices * 2;
+
+  /*
+     Limiter, LPG and clipping of up to 4 voices rendered with
+     Voice::RenderEngine(). The out and aux channels of each voice take one
+     lane each, so the per-sample loop vectorizes across voices; the
+     arithmetic is the same as ChannelPostProcessor's.
+  */
+  class PostProcessorBank {
+  public:
+    PostProcessorBank() {}
+    ~PostProcessorBank() {}
+
+    void Init() {
+      for (int i = 0; i < kPostProcessorBankLanes; ++i) {
+        limiter_peak_[i] = 0.5f;
+        lpg_previous_gain_[i] = 0.0f;
+        lpg_state_1_[i] = 0.0f;
+        lpg_state_2_[i] = 0.0f;
+      }
+    }
+
+    // frames receives size frames for each of the num_voices voices, one voice after the other.
+    void Process(const Voice* voices, int num_voices, Voice::Frame* frames, size_t size);
+
+  private:
+    float limiter_peak_[kPostProcessorBankLanes];
+    float lpg_previous_gain_[kPostProcessorBankLanes];
+    float lpg_state_1_[kPostProcessorBankLanes];
+    float lpg_state_2_[kPostProcessorBankLanes];
+
+    DISALLOW_COPY_AND_ASSIGN(PostProcessorBank);
+  };
 }  // namespace plaits
 #endif  // PLAITS_DSP_VOICE_H_
\ No newline at end of file
@@ -25,67 +25,217 @@
 // -----------------------------------------------------------------------------
 //
 // User data manager.
+//
+// Every engine that accepts custom data has its own slot, and the six-op
+// engines' banks are kept decoded, ready to be shared by all the voices.
+//
+// The slots are triple buffered, so that the UI thread can load a new bank
+// while the audio thread renders: the UI thread fills its back buffer and
+// publishes it; at the start of a block, the audio thread swaps the newest
+// published buffer in. Neither thread ever writes a buffer the other one may
+// read.
 
 #ifndef PLAITS_USER_DATA_H_
 #define PLAITS_USER_DATA_H_
 
 #include "stmlib/stmlib.h"
 
+#include <atomic>
 #include <cstring>
 
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/fm/patch.h"
+#include "plaits/dsp/fm/voice.h"
+#include "plaits/resources.h"
+
 namespace plaits {
 
+  const int kNumUserDataSlots = 5;
+  const int kNumSixOpBanks = 3;
+  const int kNumSixOpPatches = 32;
+
+  // The slot holding an engine's custom data, or -1 if it takes none.
+  inline int UserDataSlot(int engine) {
+    switch (engine) {
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return engine - 2;
+    case 13:
+      return 4;
+    default:
+      return -1;
+    }
+  }
+
   class UserData {
   public:
     static const size_t MAX_USER_DATA_SIZE = 4096; // 0x1000
 
-    UserData() {
-      for (size_t i = 0; i < MAX_USER_DATA_SIZE; ++i) {
-        m_buffer[i] = 0;
+    UserData() : middle_(1) {
+      memset(m_buffers[0].data, 0, sizeof(m_buffers[0].data));
+      for (int bank = 0; bank < kNumSixOpBanks; ++bank) {
+        DecodeSixOpBank(&m_buffers[0], bank);
       }
+      m_buffers[1] = m_buffers[0];
+      m_buffers[2] = m_buffers[0];
+      front_ = 0;
+      back_ = 2;
+      published_ = 0;
     }
     ~UserData() {}
 
-    inline void setBuffer(const uint8_t* buffer) {
-      memcpy(m_buffer, buffer, MAX_USER_DATA_SIZE * sizeof(uint8_t));
+    // UI thread: publishes a copy of buffer, as returned by getBuffer().
+    inline bool setBuffer(const uint8_t* buffer) {
+      if (buffer[MAX_USER_DATA_SIZE - 2] != 'U') {
+        return false;
+      }
+      int engine = buffer[MAX_USER_DATA_SIZE - 1] - ' ';
+      int slot = UserDataSlot(engine);
+      if (slot < 0) {
+        return false;
+      }
+      Buffers* back = Edit();
+      memcpy(back->data[slot], buffer, MAX_USER_DATA_SIZE * sizeof(uint8_t));
+      if (slot < kNumSixOpBanks) {
+        DecodeSixOpBank(back, slot);
+      }
+      Publish();
+      return true;
     }
 
-    inline const uint8_t* getBuffer() {
-      if (m_buffer[MAX_USER_DATA_SIZE - 2] == 'U') {
-        return m_buffer;
-      } else {
+    // UI thread: the engine's last published custom data, if it has any.
+    inline const uint8_t* getBuffer(int engine) const {
+      int slot = UserDataSlot(engine);
+      if (slot < 0) {
         return NULL;
       }
-    }
-
-    inline const uint8_t* ptr(int slot) const {
-      if (m_buffer[MAX_USER_DATA_SIZE - 2] == 'U' && m_buffer[MAX_USER_DATA_SIZE - 1] == (' ' + slot)) {
-        return m_buffer;
+      const uint8_t* buffer = m_buffers[published_].data[slot];
+      if (buffer[MAX_USER_DATA_SIZE - 2] == 'U') {
+        return buffer;
       } else {
         return NULL;
       }
     }
 
-    inline bool Save(const uint8_t* rx_buffer, int slot) {
+    /* UI thread: validates rx_buffer and publishes it as the engine's custom
+       data. NULL restores the engine's factory data. */
+    inline bool Save(const uint8_t* rx_buffer, int engine) {
+      int slot = UserDataSlot(engine);
+      if (slot < 0) {
+        return false;
+      }
+      if (rx_buffer != NULL && (engine < rx_buffer[MAX_USER_DATA_SIZE - 2] ||
+        engine > rx_buffer[MAX_USER_DATA_SIZE - 1])) {
+        return false;
+      }
+
+      Buffers* back = Edit();
+      uint8_t* buffer = back->data[slot];
       if (rx_buffer == NULL) {
-        for (size_t i = 0; i < MAX_USER_DATA_SIZE; ++i) {
-          m_buffer[i] = 0;
-        }
+        memset(buffer, 0, MAX_USER_DATA_SIZE * sizeof(uint8_t));
       } else {
-        if (slot < rx_buffer[MAX_USER_DATA_SIZE - 2] || slot > rx_buffer[MAX_USER_DATA_SIZE - 1]) {
-          return false;
-        }
-        memcpy(m_buffer, rx_buffer, MAX_USER_DATA_SIZE * sizeof(uint8_t));
-        m_buffer[MAX_USER_DATA_SIZE - 2] = 'U';
-        m_buffer[MAX_USER_DATA_SIZE - 1] = ' ' + slot;
+        memcpy(buffer, rx_buffer, MAX_USER_DATA_SIZE * sizeof(uint8_t));
+        buffer[MAX_USER_DATA_SIZE - 2] = 'U';
+        buffer[MAX_USER_DATA_SIZE - 1] = ' ' + engine;
+      }
+      if (slot < kNumSixOpBanks) {
+        DecodeSixOpBank(back, slot);
       }
+      Publish();
+
+      return true;
+    }
+
+    // UI thread: restores the factory data of every engine.
+    inline void Clear() {
+      Buffers* back = Edit();
+      memset(back->data, 0, sizeof(back->data));
+      for (int bank = 0; bank < kNumSixOpBanks; ++bank) {
+        DecodeSixOpBank(back, bank);
+      }
+      Publish();
+    }
 
+    /* Audio thread: swaps in the newest published data, if any. Returns true
+       when the voices have to reload their user data. */
+    inline bool Update() {
+      if (!(middle_.load(std::memory_order_relaxed) & kFresh)) {
+        return false;
+      }
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
       return true;
     }
 
+    // Audio thread: the engine's custom data, if it has any.
+    inline const uint8_t* ptr(int engine) const {
+      int slot = UserDataSlot(engine);
+      if (slot < 0) {
+        return NULL;
+      }
+      const uint8_t* buffer = m_buffers[front_].data[slot];
+      if (buffer[MAX_USER_DATA_SIZE - 2] == 'U') {
+        return buffer;
+      } else {
+        return NULL;
+      }
+    }
+
+    // Audio thread: the decoded patches of a six-op engine, custom or factory.
+    inline const fm::Patch* patches(int engine) const {
+      return m_buffers[front_].patches[UserDataSlot(engine)];
+    }
+
+    // Audio thread: the same patches, compiled for the engine's sample rate.
+    inline const fm::Voice<6>::CompiledPatch* compiled_patches(int engine) const {
+      return m_buffers[front_].compiled_patches[UserDataSlot(engine)];
+    }
+
   private:
-    uint8_t m_buffer[MAX_USER_DATA_SIZE];
+    static const uint8_t kIndexMask = 0x03;
+    static const uint8_t kFresh = 0x04;
+
+    struct Buffers {
+      uint8_t data[kNumUserDataSlots][MAX_USER_DATA_SIZE];
+      fm::Patch patches[kNumSixOpBanks][kNumSixOpPatches];
+      fm::Voice<6>::CompiledPatch compiled_patches[kNumSixOpBanks][kNumSixOpPatches];
+    };
+
+    static void DecodeSixOpBank(Buffers* buffers, int bank) {
+      const uint8_t* data = buffers->data[bank];
+      if (data[MAX_USER_DATA_SIZE - 2] != 'U') {
+        data = fm_patches_table[bank];
+      }
+      for (int i = 0; i < kNumSixOpPatches; ++i) {
+        buffers->patches[bank][i].Unpack(data + i * fm::Patch::SYX_SIZE);
+        fm::Voice<6>::Compile(buffers->patches[bank][i], kCorrectedSampleRate,
+          &buffers->compiled_patches[bank][i]);
+      }
+    }
+
+    // Brings the back buffer up to date with the last published one.
+    inline Buffers* Edit() {
+      m_buffers[back_] = m_buffers[published_];
+      return &m_buffers[back_];
+    }
+
+    inline void Publish() {
+      published_ = back_;
+      back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & kIndexMask;
+    }
+
+    Buffers m_buffers[3];
+
+    // Owned by the audio thread.
+    uint8_t front_;
+    // Owned by the UI thread.
+    uint8_t back_;
+    uint8_t published_;
+    // Handed over between the two, with kFresh set when the UI thread published it.
+    std::atomic<uint8_t> middle_;
 
+    DISALLOW_COPY_AND_ASSIGN(UserData);
   };
 
 }  // namespace plaits
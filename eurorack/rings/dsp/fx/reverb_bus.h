@@ -0,0 +1,129 @@
+// Copyright 2026 Bloodbat.
+//
+// Author: Bloodbat
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// One reverb shared by several parts. Each part sends its signal, scaled by
+// its own reverb amount, and keeps the dry part of its mix; every part then
+// gets back an equal share of the reverb's output, in stereo or summed to mono,
+// ahead of its limiter.
+// Mixed together, the parts sound as if each had its own reverb, for the cost
+// of a single one.
+
+#ifndef RINGS_DSP_FX_REVERB_BUS_H_
+#define RINGS_DSP_FX_REVERB_BUS_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+
+#include "rings/dsp/dsp.h"
+#include "rings/dsp/fx/reverb.h"
+
+namespace rings {
+
+  class ReverbBus {
+  public:
+    ReverbBus() {}
+    ~ReverbBus() {}
+
+    void Init() {
+      reverb_.Init(buffer_);
+      reverb_.set_amount(1.0f);
+      reverb_.set_diffusion(0.625f);
+      reverb_.set_input_gain(0.2f);
+      Clear();
+    }
+
+    // Starts a new block.
+    void Clear() {
+      std::fill(&left_[0], &left_[kMaxBlockSize], 0.0f);
+      std::fill(&right_[0], &right_[kMaxBlockSize], 0.0f);
+      num_sends_ = 0;
+      time_sum_ = 0.0f;
+      lp_sum_ = 0.0f;
+      share_ = 0.0f;
+    }
+
+    /* Adds left and right, scaled by amount, to the bus, and leaves their dry
+       part, as the sender's own reverb would. time and lp are the sender's
+       reverb settings: the bus uses their average. */
+    void Send(float* left, float* right, float amount, float time, float lp, size_t size) {
+      const float dry = 1.0f - amount;
+      for (size_t i = 0; i < size; ++i) {
+        left_[i] += left[i] * amount;
+        right_[i] += right[i] * amount;
+        left[i] *= dry;
+        right[i] *= dry;
+      }
+      time_sum_ += time;
+      lp_sum_ += lp;
+      ++num_sends_;
+    }
+
+    // Reverberates the sum of the block's sends.
+    void Process(size_t size) {
+      if (!num_sends_) {
+        return;
+      }
+      share_ = 1.0f / static_cast<float>(num_sends_);
+      reverb_.set_time(time_sum_ * share_);
+      reverb_.set_lp(lp_sum_ * share_);
+      reverb_.Process(left_, right_, size);
+    }
+
+    inline int32_t num_sends() const { return num_sends_; }
+
+    /* Adds one sender's share of the reverb's output to out and aux, where the
+       sender's own reverb would have left it. */
+    void Return(float* out, float* aux, bool mono, size_t size) const {
+      for (size_t i = 0; i < size; ++i) {
+        float l = left_[i] * share_;
+        float r = right_[i] * share_;
+        if (mono) {
+          l = r = 0.5f * (l + r);
+        }
+        out[i] += l;
+        aux[i] += r;
+      }
+    }
+
+  private:
+    Reverb reverb_;
+    uint16_t buffer_[32768];
+
+    float left_[kMaxBlockSize];
+    float right_[kMaxBlockSize];
+
+    int32_t num_sends_;
+    float time_sum_;
+    float lp_sum_;
+    float share_;
+
+    DISALLOW_COPY_AND_ASSIGN(ReverbBus);
+  };
+
+}  // namespace rings
+
+#endif  // RINGS_DSP_FX_REVERB_BUS_H_
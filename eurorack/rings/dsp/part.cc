@@ -433,7 +433,7 @@ namespace rings {
   };
 
   void Part::Process(const PerformanceState& performance_state, const Patch& patch,
-    const float* in, float* out, float* aux, size_t size) {
+    const float* in, float* out, float* aux, size_t size, ReverbBus* reverb_bus) {
     ConfigureResonators();
 
     note_filter_.Process(performance_state.note, performance_state.strum);
@@ -504,11 +504,19 @@ namespace rings {
         out[i] = l * patch.position + patchPositionFactor * r;
         aux[i] = r * patch.position + patchPositionFactor * l;
       }
-      reverb_.set_amount(0.1f + patch.damping * 0.5f);
+      const float reverb_amount = 0.1f + patch.damping * 0.5f;
+      const float reverb_time = 0.35f + 0.63f * patch.damping;
+      const float reverb_lp = 0.3f + patch.brightness * 0.6f;
+      if (reverb_bus) {
+        // Mix() adds the bus's return and applies the limiter.
+        reverb_bus->Send(out, aux, reverb_amount, reverb_time, reverb_lp, size);
+        return;
+      }
+      reverb_.set_amount(reverb_amount);
       reverb_.set_diffusion(0.625f);
-      reverb_.set_time(0.35f + 0.63f * patch.damping);
+      reverb_.set_time(reverb_time);
       reverb_.set_input_gain(0.2f);
-      reverb_.set_lp(0.3f + patch.brightness * 0.6f);
+      reverb_.set_lp(reverb_lp);
       reverb_.Process(out, aux, size);
       for (size_t i = 0; i < size; ++i) {
         aux[i] = -aux[i];
@@ -519,6 +527,14 @@ namespace rings {
     limiter_.Process(out, aux, size, model_gains_[model_]);
   }
 
+  void Part::Mix(const ReverbBus* reverb_bus, bool mono, float* out, float* aux, size_t size) {
+    reverb_bus->Return(out, aux, mono, size);
+    for (size_t i = 0; i < size; ++i) {
+      aux[i] = -aux[i];
+    }
+    limiter_.Process(out, aux, size, model_gains_[model_]);
+  }
+
   /* static */
   float Part::model_gains_[] = {
     1.4f,  // RESONATOR_MODEL_MODAL
@@ -38,6 +38,7 @@
 #include "rings/dsp/dsp.h"
 #include "rings/dsp/fm_voice.h"
 #include "rings/dsp/fx/reverb.h"
+#include "rings/dsp/fx/reverb_bus.h"
 #include "rings/dsp/limiter.h"
 #include "rings/dsp/note_filter.h"
 #include "rings/dsp/patch.h"
@@ -71,7 +72,13 @@ namespace rings {
     void Init(uint16_t* reverb_buffer);
 
     void Process(const PerformanceState& performance_state, const Patch& patch,
-      const float* in, float* out, float* aux, size_t size);
+      const float* in, float* out, float* aux, size_t size,
+      ReverbBus* reverb_bus = NULL);
+
+    /* With a reverb bus, a part that sends to it stops before its limiter:
+       process the bus, then Mix() the part's share of the return into out and
+       aux, before the limiter, as its own reverb would. */
+    void Mix(const ReverbBus* reverb_bus, bool mono, float* out, float* aux, size_t size);
 
     inline int32_t polyphony() const { return polyphony_; }
     inline void set_polyphony(int32_t polyphony) {
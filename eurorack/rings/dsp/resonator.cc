@@ -41,7 +41,13 @@ namespace rings {
 
   void Resonator::Init() {
     for (int32_t i = 0; i < kMaxModes; ++i) {
-      f_[i].Init();
+      int32_t bank = i & 1;
+      int32_t mode = i >> 1;
+      g_[bank][mode] = OnePole::tan<FREQUENCY_DIRTY>(0.01f);
+      r_[bank][mode] = 1.0f / 100.0f;
+      h_[bank][mode] = 1.0f / (1.0f + r_[bank][mode] * g_[bank][mode] +
+        g_[bank][mode] * g_[bank][mode]);
+      state_1_[bank][mode] = state_2_[bank][mode] = 0.0f;
     }
 
     set_frequency(220.0f / kSampleRate);
@@ -76,7 +82,13 @@ namespace rings {
       } else {
         num_modes = i + 1;
       }
-      f_[i].set_f_q<FREQUENCY_FAST>(partial_frequency, 1.0f + partial_frequency * q);
+      int32_t bank = i & 1;
+      int32_t mode = i >> 1;
+      float g = OnePole::tan<FREQUENCY_FAST>(partial_frequency);
+      float r = 1.0f / (1.0f + partial_frequency * q);
+      g_[bank][mode] = g;
+      r_[bank][mode] = r;
+      h_[bank][mode] = 1.0f / (1.0f + r * g + g * g);
       stretch_factor += stiffness;
       if (stiffness < 0.0f) {
         // Make sure that the partials do not fold back into negative frequencies.
@@ -94,24 +106,82 @@ namespace rings {
     return num_modes;
   }
 
+  inline float Resonator::ProcessModes(
+      int32_t bank,
+      float in,
+      const float* amplitudes,
+      int32_t size) {
+    // Same arithmetic as Svf::Process<FILTER_MODE_BAND_PASS>, one mode per
+    // SIMD lane.
+    float sum = 0.0f;
+    for (int32_t i = 0; i < size; ++i) {
+      float g = g_[bank][i];
+      float state_1 = state_1_[bank][i];
+      float state_2 = state_2_[bank][i];
+      float hp = (in - r_[bank][i] * state_1 - g * state_1 - state_2) * h_[bank][i];
+      float bp = g * hp + state_1;
+      state_1_[bank][i] = g * hp + bp;
+      float lp = g * bp + state_2;
+      state_2_[bank][i] = g * bp + lp;
+      sum += amplitudes[i] * bp;
+    }
+    return sum;
+  }
+
+  void Resonator::ComputeAmplitudes(
+      float position,
+      float amplitudes[2][kMaxModePairs],
+      int32_t num_pairs) {
+    /*
+       The amplitude of each mode is the next value of a cosine oscillator,
+       whose recurrence is serial. Run the first 9 steps of it, then step 8
+       modes at a time, with 4 lanes per bank:
+       x[n + 8] = c8 * x[n] - x[n - 8].
+    */
+    CosineOscillator amplitude;
+    amplitude.Init<COSINE_OSCILLATOR_APPROXIMATE>(position);
+    float seed[9];
+    for (int32_t i = 0; i < 9; ++i) {
+      seed[i] = amplitude.Next() - 0.5f;
+    }
+    /*
+       The sequence starts at its peak, so it is symmetric around mode 0:
+       x[-n] = x[n], and c8 = (x[8] + x[-8]) / x[0] with x[0] = 0.5.
+    */
+    float coefficient = 4.0f * seed[8];
+
+    for (int32_t bank = 0; bank < 2; ++bank) {
+      float current[4];
+      float previous[4];
+      for (int32_t j = 0; j < 4; ++j) {
+        current[j] = seed[bank + 2 * j];
+        previous[j] = seed[8 - bank - 2 * j];
+      }
+      for (int32_t i = 0; i < num_pairs; i += 4) {
+        for (int32_t j = 0; j < 4; ++j) {
+          amplitudes[bank][i + j] = current[j] + 0.5f;
+          float next = coefficient * current[j] - previous[j];
+          previous[j] = current[j];
+          current[j] = next;
+        }
+      }
+    }
+  }
+
   void Resonator::Process(const float* in, float* out, float* aux, size_t size) {
     int32_t num_modes = ComputeFilters();
+    // Modes are always processed in (odd, even) pairs.
+    int32_t num_pairs = (num_modes + 1) >> 1;
+
+    float amplitudes[2][kMaxModePairs];
 
     ParameterInterpolator position(&previous_position_, position_, size);
     while (size--) {
-      CosineOscillator amplitudes;
-      amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(position.Next());
+      ComputeAmplitudes(position.Next(), amplitudes, num_pairs);
 
       float input = *in++ * 0.125f;
-      float odd = 0.0f;
-      float even = 0.0f;
-      amplitudes.Start();
-      for (int32_t i = 0; i < num_modes;) {
-        odd += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
-        even += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
-      }
-      *out++ = odd;
-      *aux++ = even;
+      *out++ = ProcessModes(0, input, amplitudes[0], num_pairs);
+      *aux++ = ProcessModes(1, input, amplitudes[1], num_pairs);
     }
   }
 }  // namespace rings
\ No newline at end of file
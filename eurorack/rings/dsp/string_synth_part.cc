@@ -291,7 +291,7 @@ namespace rings {
   };
 
   void StringSynthPart::Process(const PerformanceState& performance_state, const Patch& patch, const float* in,
-    float* out, float* aux, size_t size) {
+    float* out, float* aux, size_t size, ReverbBus* reverb_bus) {
     // Assign note to a voice.
     uint8_t envelope_flags[kMaxStringSynthPolyphony];
 
@@ -388,14 +388,24 @@ namespace rings {
 
     case FX_REVERB:
     case FX_REVERB_2:
-      reverb_.set_amount(patch.position * 0.5f);
+    {
+      const float reverb_amount = patch.position * 0.5f;
+      const float reverb_time = fx_type_ == FX_REVERB ? (0.5f + 0.49f * patch.position) :
+        (0.3f + 0.6f * patch.position);
+      const float reverb_lp = fx_type_ == FX_REVERB ? 0.3f : 0.6f;
+      if (reverb_bus) {
+        // Mix() adds the bus's return and applies the limiter.
+        reverb_bus->Send(out, aux, reverb_amount, reverb_time, reverb_lp, size);
+        return;
+      }
+      reverb_.set_amount(reverb_amount);
       reverb_.set_diffusion(0.625f);
-      reverb_.set_time(fx_type_ == FX_REVERB ? (0.5f + 0.49f * patch.position) :
-        (0.3f + 0.6f * patch.position));
+      reverb_.set_time(reverb_time);
       reverb_.set_input_gain(0.2f);
-      reverb_.set_lp(fx_type_ == FX_REVERB ? 0.3f : 0.6f);
+      reverb_.set_lp(reverb_lp);
       reverb_.Process(out, aux, size);
-      break;
+    }
+    break;
 
     default:
       break;
@@ -409,4 +419,12 @@ namespace rings {
     limiter_.Process(out, aux, size, 1.0f);
   }
 
+  void StringSynthPart::Mix(const ReverbBus* reverb_bus, bool mono, float* out, float* aux, size_t size) {
+    reverb_bus->Return(out, aux, mono, size);
+    for (size_t i = 0; i < size; ++i) {
+      aux[i] = -aux[i];
+    }
+    limiter_.Process(out, aux, size, 1.0f);
+  }
+
 }  // namespace rings
\ No newline at end of file
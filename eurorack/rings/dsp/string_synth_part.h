@@ -37,6 +37,7 @@
 #include "rings/dsp/fx/chorus.h"
 #include "rings/dsp/fx/ensemble.h"
 #include "rings/dsp/fx/reverb.h"
+#include "rings/dsp/fx/reverb_bus.h"
 #include "rings/dsp/limiter.h"
 #include "rings/dsp/note_filter.h"
 #include "rings/dsp/patch.h"
@@ -77,7 +78,11 @@ namespace rings {
     void Init(uint16_t* reverb_buffer);
 
     void Process(const PerformanceState& performance_state, const Patch& patch,
-      const float* in, float* out, float* aux, size_t size);
+      const float* in, float* out, float* aux, size_t size,
+      ReverbBus* reverb_bus = NULL);
+
+    // See Part::Mix().
+    void Mix(const ReverbBus* reverb_bus, bool mono, float* out, float* aux, size_t size);
 
     inline void set_polyphony(int32_t polyphony) {
       int32_t old_polyphony = polyphony_;
@@ -35,6 +35,60 @@ namespace stmlib {
 
 class Random {
  public:
+  // Makes the stream held in *state the one drawn from by the calling thread
+  // until the scope ends. A module owns its stream and activates it while it
+  // processes, so instances on different engine threads never share state and
+  // each of them gives the same output from the same seed.
+  class Scope {
+   public:
+    explicit Scope(uint32_t* state) : state_(state), saved_state_(rng_state_) {
+      rng_state_ = *state;
+    }
+
+    ~Scope() {
+      *state_ = rng_state_;
+      rng_state_ = saved_state_;
+    }
+
+   private:
+    uint32_t* state_;
+    uint32_t saved_state_;
+
+    DISALLOW_COPY_AND_ASSIGN(Scope);
+  };
+
+  // A local copy of the calling thread's stream, for loops that draw once
+  // per sample: the thread-local state, which costs a function call where TLS
+  // is emulated (MinGW), is only read when the copy is made and written back
+  // when it is destroyed. Nothing may draw from Random itself in between.
+  class Stream {
+   public:
+    Stream() : state_(rng_state_) { }
+    ~Stream() {
+      rng_state_ = state_;
+    }
+
+    inline uint32_t GetWord() {
+      state_ = state_ * 1664525L + 1013904223L;
+      return state_;
+    }
+
+    inline int16_t GetSample() {
+      return static_cast<int16_t>(GetWord() >> 16);
+    }
+
+    inline float GetFloat() {
+      return static_cast<float>(GetWord()) / 4294967296.0f;
+    }
+
+   private:
+    uint32_t state_;
+
+    DISALLOW_COPY_AND_ASSIGN(Stream);
+  };
+
+  static const uint32_t kDefaultSeed = 0x21;
+
   static inline uint32_t state() { return rng_state_; }
 
   static inline void Seed(uint32_t seed) {
@@ -55,7 +109,7 @@ class Random {
   }
 
  private:
-  static uint32_t rng_state_;
+  static thread_local uint32_t rng_state_;
 
   DISALLOW_COPY_AND_ASSIGN(Random);
 };
@@ -64,7 +64,7 @@ namespace warps {
     feedback_sample_ = 0.0f;
   }
 
-  void Modulator::ProcessEasterEgg(ShortFrame* input, ShortFrame* output, size_t size) {
+  void Modulator::ProcessEasterEgg(FloatFrame* input, FloatFrame* output, size_t size) {
     float* carrier = buffer_[0];
     float* carrier_i = &src_buffer_[0][0];
     float* carrier_q = &src_buffer_[0][size];
@@ -91,7 +91,7 @@ namespace warps {
       quadrature_oscillator_.Render(shape, frequency, carrier_i, carrier_q, size);
     } else {
       for (size_t i = 0; i < size; ++i) {
-        carrier[i] = static_cast<float>(input[i].l) / 32768.0f;
+        carrier[i] = input[i].l;
       }
       quadrature_transform_[0].Process(carrier, carrier_i, carrier_q, size);
 
@@ -119,10 +119,10 @@ namespace warps {
       float modulator_i, modulator_q;
 
       // Start from the signal from input 2, with non-linear gain.
-      float in = static_cast<float>(input->r) / 32768.0f;
+      float in = input->r;
 
       if (parameters_.carrier_shape) {
-        in += static_cast<float>(input->l) / 32768.0f;
+        in += input->l;
       }
 
       float modulator = in;
@@ -156,8 +156,8 @@ namespace warps {
       main += wet_dry * (in - main);
       aux += wet_dry * (in - aux);
 
-      output->l = Clip16(static_cast<int32_t>(main * 32768.0f));
-      output->r = Clip16(static_cast<int32_t>(aux * 32768.0f));
+      output->l = ClipFrame(main);
+      output->r = ClipFrame(aux);
       ++output;
       ++input;
     }
@@ -166,6 +166,21 @@ namespace warps {
   }
 
   void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
+    FloatFrame float_input[kMaxBlockSize];
+    FloatFrame float_output[kMaxBlockSize];
+
+    for (size_t i = 0; i < size; ++i) {
+      float_input[i].l = static_cast<float>(input[i].l) / 32768.0f;
+      float_input[i].r = static_cast<float>(input[i].r) / 32768.0f;
+    }
+    Process(float_input, float_output, size);
+    for (size_t i = 0; i < size; ++i) {
+      output[i].l = Clip16(static_cast<int32_t>(float_output[i].l * 32768.0f));
+      output[i].r = Clip16(static_cast<int32_t>(float_output[i].r * 32768.0f));
+    }
+  }
+
+  void Modulator::Process(FloatFrame* input, FloatFrame* output, size_t size) {
     if (easter_egg_) {
       ProcessEasterEgg(input, output, size);
       return;
@@ -186,8 +201,8 @@ namespace warps {
       fill(&aux_output[0], &aux_output[size], 0.0f);
     }
 
-    // Convert audio inputs to float and apply VCA/saturation (5.8% per channel).
-    short* input_samples = &input->l;
+    // Apply VCA/saturation (5.8% per channel).
+    const float* input_samples = &input->l;
     for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
       amplifier_[i].Process(parameters_.channel_drive[i], 1.0f - vocoder_amount, input_samples + i,
         buffer_[i], aux_output, 2, size);
@@ -197,7 +212,7 @@ namespace warps {
     if (parameters_.carrier_shape) {
       // Scale phase-modulation input.
       for (size_t i = 0; i < size; ++i) {
-        internal_modulation_[i] = static_cast<float>(input[i].l) / 32768.0f;
+        internal_modulation_[i] = input[i].l;
       }
       // Xmod: sine, triangle saw.
       // Vocoder: saw, pulse, noise.
@@ -272,10 +287,10 @@ namespace warps {
       }
     }
 
-    // Convert back to integer and clip.
+    // Clip.
     while (size--) {
-      output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
-      output->r = Clip16(static_cast<int32_t>(*aux_output * 16384.0f));
+      output->l = ClipFrame(*main_output);
+      output->r = ClipFrame(*aux_output * 0.5f);
       ++main_output;
       ++aux_output;
       ++output;
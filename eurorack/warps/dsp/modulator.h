@@ -50,6 +50,12 @@ namespace warps {
   typedef struct { short l; short r; } ShortFrame;
   typedef struct { float l; float r; } FloatFrame;
 
+  /* Float frames span the -1.0 to 1.0 range of 16-bit frames, and are
+     clipped to it like Clip16() clips them: a NaN ends up at -1.0. */
+  inline float ClipFrame(float x) {
+    return x >= -1.0f ? (x <= 1.0f ? x : 1.0f) : -1.0f;
+  }
+
   class SaturatingAmplifier {
   public:
     SaturatingAmplifier() {}
@@ -58,13 +64,13 @@ namespace warps {
       drive_ = 0.0f;
     }
 
-    void Process(float drive, float limit, short* in, float* out, float* out_raw, size_t in_stride,
+    void Process(float drive, float limit, const float* in, float* out, float* out_raw, size_t in_stride,
       size_t size) {
       // Process noise gate and compute raw output.
       stmlib::ParameterInterpolator drive_modulation(&drive_, drive, size);
       float level = level_;
       for (size_t i = 0; i < size; ++i) {
-        float s = static_cast<float>(*in) / 32768.0f;
+        float s = *in;
         float error = s * s - level;
         level += error * (error > 0.0f ? 0.1f : 0.0001f);
         s *= level <= 0.0001f ? (1.0f / 0.0001f) * level : 1.0f;
@@ -129,8 +135,10 @@ namespace warps {
     ~Modulator() {}
 
     void Init(float sample_rate);
+    // 16-bit frames are converted to and from float frames.
     void Process(ShortFrame* input, ShortFrame* output, size_t size);
-    void ProcessEasterEgg(ShortFrame* input, ShortFrame* output, size_t size);
+    void Process(FloatFrame* input, FloatFrame* output, size_t size);
+    void ProcessEasterEgg(FloatFrame* input, FloatFrame* output, size_t size);
     inline Parameters* mutable_parameters() {
       return &parameters_;
     }
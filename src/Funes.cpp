@@ -14,7 +14,10 @@
 
 #include "plaits/dsp/voice.h"
 #include "plaits/user_data.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "Funes.hpp"
 
 using namespace sanguineCommonCode;
@@ -67,9 +70,10 @@ struct Funes : SanguineModule {
 	};
 
 	plaits::Voice voices[PORT_MAX_CHANNELS];
+	plaits::PostProcessorBank postProcessors[PORT_MAX_CHANNELS / plaits::kPostProcessorBankVoices];
 	plaits::Patch patch = {};
 	plaits::UserData userData;
-	char sharedBuffers[PORT_MAX_CHANNELS][16384] = {};
+	char voiceRam[PORT_MAX_CHANNELS][plaits::kVoiceRamSize] = {};
 
 	float triPhase = 0.f;
 	float lastLPGColor = 0.5f;
@@ -78,8 +82,6 @@ struct Funes : SanguineModule {
 
 	static const int kLightsFrequency = 16;
 
-	static const int kMaxUserDataSize = 4096;
-
 	int frequencyMode = 10;
 	int lastFrequencyMode = 10;
 	int displayModelNum = 0;
@@ -92,7 +94,7 @@ struct Funes : SanguineModule {
 	uint32_t displayTimeout = 0;
 	stmlib::HysteresisQuantizer2 octaveQuantizer;
 
-	dsp::SampleRateConverter<PORT_MAX_CHANNELS * 2> srcOutputs;
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS * 2> srcOutputs;
 	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS * 2>, 256> drbOutputBuffers;
 
 	bool bWantLowCpu = false;
@@ -109,6 +111,8 @@ struct Funes : SanguineModule {
 
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	funes::CustomDataStates customDataStates[plaits::kMaxEngines] = {};
 
 	Funes() {
@@ -145,26 +149,40 @@ struct Funes : SanguineModule {
 		configOutput(OUTPUT_OUT, "Main");
 		configOutput(OUTPUT_AUX, "Auxiliary");
 
+		// Engines are only initialized when first selected, so setting up every voice is cheap.
 		for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
-			stmlib::BufferAllocator allocator(sharedBuffers[channel], sizeof(sharedBuffers[channel]));
-			voices[channel].Init(&allocator, &userData);
+			voices[channel].Init(voiceRam[channel], &userData);
+		}
+
+		for (int bank = 0; bank < PORT_MAX_CHANNELS / plaits::kPostProcessorBankVoices; ++bank) {
+			postProcessors[bank].Init();
 		}
 
 		octaveQuantizer.Init(9, 0.01f, false);
 
 		lightsDivider.setDivision(kLightsFrequency);
 
-		resetCustomDataStates();
+		updateCustomDataStates();
 
 		init();
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		channelCount = std::max(std::max(inputs[INPUT_NOTE].getChannels(), inputs[INPUT_TRIGGER].getChannels()), 1);
 
 		if (drbOutputBuffers.empty()) {
 			const int kBlockSize = 12;
 
+			// Swap in custom data loaded since the last block.
+			if (userData.Update()) {
+				for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+					voices[channel].ReloadUserData();
+				}
+			}
+
 			// Switch models
 			if (bNotesModelSelection && inputs[INPUT_ENGINE].isConnected()) {
 				float currentModelVoltage = inputs[INPUT_ENGINE].getVoltage();
@@ -227,8 +245,7 @@ struct Funes : SanguineModule {
 
 			bool bPulseLight = false;
 
-			// Render output buffer for each voice.
-			dsp::Frame<PORT_MAX_CHANNELS * 2> outputFrames[kBlockSize];
+			// Render each voice's engine.
 			for (int channel = 0; channel < channelCount; ++channel) {
 				// Construct modulations.
 				plaits::Modulations modulations;
@@ -251,15 +268,7 @@ struct Funes : SanguineModule {
 				modulations.level_patched = inputs[INPUT_LEVEL].isConnected();
 				modulations.level = inputs[INPUT_LEVEL].getPolyVoltage(channel) / 8.f;
 
-				// Render frames
-				plaits::Voice::Frame output[kBlockSize];
-				voices[channel].Render(patch, modulations, output, kBlockSize);
-
-				// Convert output to frames
-				for (int blockNum = 0; blockNum < kBlockSize; ++blockNum) {
-					outputFrames[blockNum].samples[channel * 2 + 0] = output[blockNum].out / 32768.f;
-					outputFrames[blockNum].samples[channel * 2 + 1] = output[blockNum].aux / 32768.f;
-				}
+				voices[channel].RenderEngine(patch, modulations, kBlockSize);
 
 				if (displayChannel == channel) {
 					displayModelNum = voices[channel].active_engine();
@@ -293,6 +302,24 @@ struct Funes : SanguineModule {
 				}
 			}
 
+			// Render the 6-OP FM voices, in lockstep where they share an algorithm.
+			plaits::Voice::RenderSixOpVoices(voices, channelCount);
+
+			// Post-process the voices in groups of 4 and convert output to frames.
+			plaits::Voice::Frame output[PORT_MAX_CHANNELS][kBlockSize];
+			for (int channel = 0; channel < channelCount; channel += plaits::kPostProcessorBankVoices) {
+				postProcessors[channel / plaits::kPostProcessorBankVoices].Process(&voices[channel],
+					std::min(channelCount - channel, plaits::kPostProcessorBankVoices), output[channel], kBlockSize);
+			}
+
+			dsp::Frame<PORT_MAX_CHANNELS * 2> outputFrames[kBlockSize];
+			for (int channel = 0; channel < channelCount; ++channel) {
+				for (int blockNum = 0; blockNum < kBlockSize; ++blockNum) {
+					outputFrames[blockNum].samples[channel * 2 + 0] = output[channel][blockNum].out / 32768.f;
+					outputFrames[blockNum].samples[channel * 2 + 1] = output[channel][blockNum].aux / 32768.f;
+				}
+			}
+
 			// Update model text, custom data lights and frequency mode every 16 samples only.
 			if (lightsDivider.process()) {
 				if (displayChannel >= channelCount) {
@@ -479,7 +506,13 @@ struct Funes : SanguineModule {
 		params[PARAM_LPG_DECAY].setValue(0.5f);
 	}
 
+	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+	}
+
 	void onReset(const ResetEvent& e) override {
+		randomStream.reseed(getId());
+
 		init();
 	}
 
@@ -498,11 +531,17 @@ struct Funes : SanguineModule {
 		setJsonBoolean(rootJ, "notesModelSelection", bNotesModelSelection);
 		setJsonInt(rootJ, "displayChannel", displayChannel);
 
-		const uint8_t* userDataBuffer = userData.getBuffer();
-		if (userDataBuffer != nullptr) {
-			std::string userDataString = rack::string::toBase64(userDataBuffer, plaits::UserData::MAX_USER_DATA_SIZE);
-			setJsonString(rootJ, "userData", userDataString.c_str());
+		json_t* userDataBanksJ = json_array();
+		for (int engine = 0; engine < plaits::kMaxEngines; ++engine) {
+			const uint8_t* userDataBuffer = userData.getBuffer(engine);
+			if (userDataBuffer != nullptr) {
+				std::string userDataString = rack::string::toBase64(userDataBuffer, plaits::UserData::MAX_USER_DATA_SIZE);
+				json_array_append_new(userDataBanksJ, json_string(userDataString.c_str()));
+			}
 		}
+		json_object_set_new(rootJ, "userDataBanks", userDataBanksJ);
+
+		randomStream.dataToJson(rootJ);
 
 		return rootJ;
 	}
@@ -523,56 +562,54 @@ struct Funes : SanguineModule {
 			displayChannel = intValue;
 		}
 
+		json_t* userDataBanksJ = json_object_get(rootJ, "userDataBanks");
 		std::string userDataString;
 
-		if (getJsonString(rootJ, "userData", userDataString)) {
-			const std::vector<uint8_t> userDataVector = rack::string::fromBase64(userDataString);
-			if (userDataVector.size() > 0) {
-				const uint8_t* userDataBuffer = &userDataVector[0];
-				userData.setBuffer(userDataBuffer);
-				if (userDataBuffer[kMaxUserDataSize - 2] == 'U') {
-					for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
-						voices[channel].ReloadUserData();
-					}
-
-					resetCustomDataStates();
-					customDataStates[userDataBuffer[kMaxUserDataSize - 1] - ' '] = funes::DataCustom;
+		if (userDataBanksJ) {
+			userData.Clear();
+			size_t bankId;
+			json_t* bankJ;
+			json_array_foreach(userDataBanksJ, bankId, bankJ) {
+				if (json_is_string(bankJ)) {
+					setUserDataBuffer(json_string_value(bankJ));
 				}
 			}
+			updateCustomDataStates();
+		} else if (getJsonString(rootJ, "userData", userDataString)) {
+			// Patches saved before every engine had its own bank.
+			userData.Clear();
+			setUserDataBuffer(userDataString);
+			updateCustomDataStates();
+		}
+
+		randomStream.dataFromJson(rootJ);
+	}
+
+	void setUserDataBuffer(const std::string& userDataString) {
+		const std::vector<uint8_t> userDataVector = rack::string::fromBase64(userDataString);
+		if (userDataVector.size() >= plaits::UserData::MAX_USER_DATA_SIZE) {
+			userData.setBuffer(userDataVector.data());
 		}
 	}
 
 	void resetCustomData() {
 		bool success = userData.Save(nullptr, patch.engine);
 		if (success) {
-			for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
-				voices[channel].ReloadUserData();
-			}
-			resetCustomDataStates();
+			customDataStates[patch.engine] = funes::DataFactory;
 		}
 	}
 
 	void loadCustomData(const std::string& filePath) {
 		bIsLoading = true;
 		DEFER({ bIsLoading = false; });
-		// HACK: Sleep 100us so DSP thread is likely to finish processing before we resize the vector.
-#ifndef METAMODULE
-		std::this_thread::sleep_for(std::chrono::duration<double>(100e-6));
-#else
-		// delay_ms(1);
-#endif
 		std::string fileExtension = string::lowercase(system::getExtension(filePath));
 
 		if (fileExtension == ".bin") {
 			std::vector<uint8_t> buffer = system::readFile(filePath);
-			uint8_t* dataBuffer = buffer.data();
-			bool success = userData.Save(dataBuffer, patch.engine);
+			/* The audio thread swaps the new data in at the start of its next block:
+			   the voices never see a partially copied bank. */
+			bool success = buffer.size() >= plaits::UserData::MAX_USER_DATA_SIZE && userData.Save(buffer.data(), patch.engine);
 			if (success) {
-				for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
-					voices[channel].ReloadUserData();
-				}
-				// Only 1 engine can use custom data at a time.
-				resetCustomDataStates();
 				customDataStates[patch.engine] = funes::DataCustom;
 			} else {
 				errorTimeOut = 4;
@@ -665,12 +702,12 @@ struct Funes : SanguineModule {
 		params[PARAM_FREQ_MODE].setValue(freqModeNum);
 	}
 
-	void resetCustomDataStates() {
-		customDataStates[2] = funes::DataFactory;
-		customDataStates[3] = funes::DataFactory;
-		customDataStates[4] = funes::DataFactory;
-		customDataStates[5] = funes::DataFactory;
-		customDataStates[13] = funes::DataFactory;
+	void updateCustomDataStates() {
+		for (int engine = 0; engine < plaits::kMaxEngines; ++engine) {
+			if (plaits::UserDataSlot(engine) >= 0) {
+				customDataStates[engine] = userData.getBuffer(engine) ? funes::DataCustom : funes::DataFactory;
+			}
+		}
 	}
 };
 
@@ -838,7 +875,7 @@ struct FunesWidget : SanguineModuleWidget {
 			[=](Menu* menu) {
 
 				int engineNum = module->patch.engine;
-				if (engineNum == 2 || engineNum == 3 || engineNum == 4 || engineNum == 5 || engineNum == 13) {
+				if (plaits::UserDataSlot(engineNum) >= 0) {
 					menu->addChild(createMenuItem("Load...", "", [=]() {
 						module->showCustomDataLoadDialog();
 						}));
@@ -857,6 +894,10 @@ struct FunesWidget : SanguineModuleWidget {
 					}));
 			}
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
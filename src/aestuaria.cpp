@@ -0,0 +1,425 @@
+#include "plugin.hpp"
+#include "sanguinecomponents.hpp"
+#include "sanguinehelpers.hpp"
+#include "sanguinejson.hpp"
+
+#include "stmlib/dsp/hysteresis_quantizer.h"
+#include "stmlib/utils/gate_flags.h"
+
+#include "tides2/poly_slope_generator.h"
+#include "tides2/ramp/ramp_extractor.h"
+
+#include "aestuaria.hpp"
+
+using namespace sanguineCommonCode;
+
+struct Aestuaria : SanguineModule {
+	enum ParamIds {
+		PARAM_RAMP_MODE,
+		PARAM_OUTPUT_MODE,
+		PARAM_RANGE,
+
+		PARAM_FREQUENCY,
+		PARAM_FM,
+
+		PARAM_SHAPE,
+		PARAM_SLOPE,
+		PARAM_SMOOTHNESS,
+		PARAM_SHIFT,
+
+		PARAMS_COUNT
+	};
+
+	enum InputIds {
+		INPUT_SHAPE,
+		INPUT_SLOPE,
+		INPUT_SMOOTHNESS,
+		INPUT_SHIFT,
+
+		INPUT_TRIGGER,
+		INPUT_CLOCK,
+		INPUT_PITCH,
+		INPUT_FM,
+		INPUTS_COUNT
+	};
+
+	enum OutputIds {
+		OUTPUT_1,
+		OUTPUT_2,
+		OUTPUT_3,
+		OUTPUT_4,
+		OUTPUTS_COUNT
+	};
+
+	enum LightIds {
+		ENUMS(LIGHT_RAMP_MODE, 2),
+		ENUMS(LIGHT_OUTPUT_MODE, 2),
+		ENUMS(LIGHT_RANGE, 2),
+		ENUMS(LIGHT_PHASE, 2),
+		LIGHTS_COUNT
+	};
+
+	struct RampModeParam : ParamQuantity {
+		std::string getDisplayValueString() override {
+			Aestuaria* moduleAestuaria = static_cast<Aestuaria*>(module);
+			return aestuaria::rampModeLabels[moduleAestuaria->rampMode];
+		}
+	};
+
+	struct OutputModeParam : ParamQuantity {
+		std::string getDisplayValueString() override {
+			Aestuaria* moduleAestuaria = static_cast<Aestuaria*>(module);
+			return aestuaria::outputModeLabels[moduleAestuaria->outputMode];
+		}
+	};
+
+	struct RangeParam : ParamQuantity {
+		std::string getDisplayValueString() override {
+			Aestuaria* moduleAestuaria = static_cast<Aestuaria*>(module);
+			return aestuaria::rangeLabels[moduleAestuaria->range];
+		}
+	};
+
+	// Every channel renders a whole block of its own generator at once: the outputs lag the inputs by one block.
+	static const int kBlockSize = 8;
+	static const int kLightsFrequency = 16;
+
+	int rampMode = tides2::RAMP_MODE_LOOPING;
+	int outputMode = tides2::OUTPUT_MODE_GATES;
+	int range = 1;
+
+	int channelCount = 0;
+	int frame = 0;
+
+	bool bMustResetRampExtractors[PORT_MAX_CHANNELS] = {};
+
+	tides2::PolySlopeGenerator polySlopeGenerators[PORT_MAX_CHANNELS];
+	tides2::RampExtractor rampExtractors[PORT_MAX_CHANNELS];
+	stmlib::HysteresisQuantizer2 ratioQuantizers[PORT_MAX_CHANNELS];
+
+	stmlib::GateFlags previousTriggerFlags[PORT_MAX_CHANNELS] = {};
+	stmlib::GateFlags previousClockFlags[PORT_MAX_CHANNELS] = {};
+
+	stmlib::GateFlags triggerFlags[PORT_MAX_CHANNELS][kBlockSize] = {};
+	stmlib::GateFlags clockFlags[PORT_MAX_CHANNELS][kBlockSize] = {};
+
+	float ramps[kBlockSize] = {};
+
+	tides2::PolySlopeGenerator::OutputSample outputSamples[PORT_MAX_CHANNELS][kBlockSize] = {};
+
+	dsp::SchmittTrigger stRampMode;
+	dsp::SchmittTrigger stOutputMode;
+	dsp::SchmittTrigger stRange;
+	dsp::ClockDivider lightsDivider;
+
+	std::string displayOutputMode = aestuaria::displayOutputModes[0];
+
+	Aestuaria() {
+		config(PARAMS_COUNT, INPUTS_COUNT, OUTPUTS_COUNT, LIGHTS_COUNT);
+
+		configButton<RampModeParam>(PARAM_RAMP_MODE, "Ramp mode");
+		configButton<OutputModeParam>(PARAM_OUTPUT_MODE, "Output mode");
+		configButton<RangeParam>(PARAM_RANGE, "Frequency range");
+
+		configParam(PARAM_FREQUENCY, -48.f, 48.f, 0.f, "Frequency", " semitones");
+		configParam(PARAM_FM, -1.f, 1.f, 0.f, "FM attenuverter", "%", 0, 100);
+
+		configParam(PARAM_SHAPE, 0.f, 1.f, 0.5f, "Shape", "%", 0, 100);
+		configParam(PARAM_SLOPE, 0.f, 1.f, 0.5f, "Slope", "%", 0, 100);
+		configParam(PARAM_SMOOTHNESS, 0.f, 1.f, 0.5f, "Smoothness", "%", 0, 100);
+		configParam(PARAM_SHIFT, 0.f, 1.f, 0.5f, "Shift/level", "%", 0, 100);
+
+		configInput(INPUT_SHAPE, "Shape");
+		configInput(INPUT_SLOPE, "Slope");
+		configInput(INPUT_SMOOTHNESS, "Smoothness");
+		configInput(INPUT_SHIFT, "Shift/level");
+		configInput(INPUT_TRIGGER, "Trigger");
+		configInput(INPUT_CLOCK, "Clock");
+		configInput(INPUT_PITCH, "Pitch (1V/oct)");
+		configInput(INPUT_FM, "FM");
+
+		configOutput(OUTPUT_1, "1");
+		configOutput(OUTPUT_2, "2");
+		configOutput(OUTPUT_3, "3");
+		configOutput(OUTPUT_4, "4");
+
+		for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+			polySlopeGenerators[channel].Init();
+			ratioQuantizers[channel].Init(aestuaria::kRatiosCount, 0.05f, false);
+		}
+
+		initRampExtractors(44100.f);
+
+		lightsDivider.setDivision(kLightsFrequency);
+	}
+
+	void process(const ProcessArgs& args) override {
+		if (stRampMode.process(params[PARAM_RAMP_MODE].getValue())) {
+			rampMode = (rampMode + 1) % tides2::RAMP_MODE_LAST;
+		}
+
+		if (stOutputMode.process(params[PARAM_OUTPUT_MODE].getValue())) {
+			outputMode = (outputMode + 1) % tides2::OUTPUT_MODE_LAST;
+		}
+
+		if (stRange.process(params[PARAM_RANGE].getValue())) {
+			range = (range + 1) % 3;
+		}
+
+		channelCount = std::max(std::max(std::max(inputs[INPUT_TRIGGER].getChannels(), inputs[INPUT_CLOCK].getChannels()),
+			std::max(inputs[INPUT_PITCH].getChannels(), inputs[INPUT_FM].getChannels())), 1);
+
+		for (int channel = 0; channel < channelCount; ++channel) {
+			previousTriggerFlags[channel] = stmlib::ExtractGateFlags(previousTriggerFlags[channel],
+				inputs[INPUT_TRIGGER].getPolyVoltage(channel) >= 0.7f);
+			triggerFlags[channel][frame] = previousTriggerFlags[channel];
+
+			previousClockFlags[channel] = stmlib::ExtractGateFlags(previousClockFlags[channel],
+				inputs[INPUT_CLOCK].getPolyVoltage(channel) >= 0.7f);
+			clockFlags[channel][frame] = previousClockFlags[channel];
+
+			const tides2::PolySlopeGenerator::OutputSample& outputSample = outputSamples[channel][frame];
+			outputs[OUTPUT_1].setVoltage(outputSample.channel[0], channel);
+			outputs[OUTPUT_2].setVoltage(outputSample.channel[1], channel);
+			outputs[OUTPUT_3].setVoltage(outputSample.channel[2], channel);
+			outputs[OUTPUT_4].setVoltage(outputSample.channel[3], channel);
+		}
+
+		for (int output = 0; output < OUTPUTS_COUNT; ++output) {
+			outputs[output].setChannels(channelCount);
+		}
+
+		const float phaseValue = outputSamples[0][frame].channel[0] / 5.f;
+
+		// Buffer loop.
+		if (++frame >= kBlockSize) {
+			frame = 0;
+
+			for (int channel = 0; channel < channelCount; ++channel) {
+				renderChannel(channel, args.sampleTime);
+			}
+		}
+
+		if (lightsDivider.process()) {
+			const float sampleTime = kLightsFrequency * args.sampleTime;
+
+			long long systemTimeMs = getSystemTimeMs();
+
+			uint8_t pulseWidthModulationCounter = systemTimeMs & 15;
+			uint8_t triangle = (systemTimeMs >> 5) & 31;
+			triangle = triangle < 16 ? triangle : 31 - triangle;
+			bool bIsTrianglePulse = pulseWidthModulationCounter < triangle;
+
+			lights[LIGHT_RAMP_MODE + 0].setBrightnessSmooth(rampMode == tides2::RAMP_MODE_AD ?
+				kSanguineButtonLightValue : 0.f, sampleTime);
+			lights[LIGHT_RAMP_MODE + 1].setBrightnessSmooth(rampMode == tides2::RAMP_MODE_AR ?
+				kSanguineButtonLightValue : 0.f, sampleTime);
+
+			for (int light = 0; light < 2; ++light) {
+				LightModes lightMode = aestuaria::outputModeLights[outputMode][light];
+
+				float lightValue = static_cast<float>(lightMode == LIGHT_ON || (lightMode == LIGHT_BLINK && bIsTrianglePulse)) *
+					kSanguineButtonLightValue;
+				lights[LIGHT_OUTPUT_MODE + light].setBrightnessSmooth(lightValue, sampleTime);
+			}
+
+			lights[LIGHT_RANGE + 0].setBrightnessSmooth(range == 0 ? kSanguineButtonLightValue : 0.f, sampleTime);
+			lights[LIGHT_RANGE + 1].setBrightnessSmooth(range == 2 ? kSanguineButtonLightValue : 0.f, sampleTime);
+
+			lights[LIGHT_PHASE + 0].setBrightnessSmooth(fmaxf(0.f, phaseValue), sampleTime);
+			lights[LIGHT_PHASE + 1].setBrightnessSmooth(fmaxf(0.f, -phaseValue), sampleTime);
+
+			displayOutputMode = aestuaria::displayOutputModes[outputMode];
+		}
+	}
+
+	void renderChannel(const int channel, const float sampleTime) {
+		const tides2::Range generatorRange = range == 2 ? tides2::RANGE_AUDIO : tides2::RANGE_CONTROL;
+
+		float transposition = params[PARAM_FREQUENCY].getValue();
+		transposition += params[PARAM_FM].getValue() * inputs[INPUT_FM].getPolyVoltage(channel) * 12.f;
+
+		float frequency;
+		float* ramp = NULL;
+
+		if (inputs[INPUT_CLOCK].isConnected()) {
+			if (bMustResetRampExtractors[channel]) {
+				rampExtractors[channel].Reset();
+				bMustResetRampExtractors[channel] = false;
+			}
+
+			tides2::Ratio ratio = ratioQuantizers[channel].Lookup(aestuaria::ratios, 0.5f + transposition * 0.0105f);
+			frequency = rampExtractors[channel].Process(generatorRange == tides2::RANGE_AUDIO,
+				generatorRange == tides2::RANGE_AUDIO && rampMode == tides2::RAMP_MODE_AR, ratio,
+				clockFlags[channel], ramps, kBlockSize);
+			ramp = ramps;
+		} else {
+			float note = transposition + 12.f * inputs[INPUT_PITCH].getPolyVoltage(channel);
+			frequency = aestuaria::kRootFrequencies[range] * sampleTime * dsp::exp2_taylor5(note / 12.f);
+			bMustResetRampExtractors[channel] = true;
+		}
+
+		float shape = clamp(params[PARAM_SHAPE].getValue() + inputs[INPUT_SHAPE].getPolyVoltage(channel) / 10.f, 0.f, 1.f);
+		float slope = clamp(params[PARAM_SLOPE].getValue() + inputs[INPUT_SLOPE].getPolyVoltage(channel) / 10.f, 0.f, 1.f);
+		float smoothness = clamp(params[PARAM_SMOOTHNESS].getValue() +
+			inputs[INPUT_SMOOTHNESS].getPolyVoltage(channel) / 10.f, 0.f, 1.f);
+		float shift = clamp(params[PARAM_SHIFT].getValue() + inputs[INPUT_SHIFT].getPolyVoltage(channel) / 10.f, 0.f, 1.f);
+
+		polySlopeGenerators[channel].Render(static_cast<tides2::RampMode>(rampMode),
+			static_cast<tides2::OutputMode>(outputMode), generatorRange, frequency, slope, shape, smoothness, shift,
+			triggerFlags[channel], ramp, outputSamples[channel], kBlockSize);
+	}
+
+	void initRampExtractors(const float sampleRate) {
+		for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+			rampExtractors[channel].Init(sampleRate, 40.f / sampleRate);
+			bMustResetRampExtractors[channel] = true;
+		}
+	}
+
+	void onSampleRateChange(const SampleRateChangeEvent& e) override {
+		initRampExtractors(e.sampleRate);
+	}
+
+	void onReset() override {
+		rampMode = tides2::RAMP_MODE_LOOPING;
+		outputMode = tides2::OUTPUT_MODE_GATES;
+		range = 1;
+	}
+
+	void onRandomize() override {
+		rampMode = random::u32() % tides2::RAMP_MODE_LAST;
+		outputMode = random::u32() % tides2::OUTPUT_MODE_LAST;
+		range = random::u32() % 3;
+	}
+
+	json_t* dataToJson() override {
+		json_t* rootJ = SanguineModule::dataToJson();
+
+		setJsonInt(rootJ, "rampMode", rampMode);
+		setJsonInt(rootJ, "outputMode", outputMode);
+		setJsonInt(rootJ, "range", range);
+
+		return rootJ;
+	}
+
+	void dataFromJson(json_t* rootJ) override {
+		SanguineModule::dataFromJson(rootJ);
+
+		json_int_t intValue = 0;
+
+		if (getJsonInt(rootJ, "rampMode", intValue)) {
+			rampMode = clamp(static_cast<int>(intValue), 0, tides2::RAMP_MODE_LAST - 1);
+		}
+
+		if (getJsonInt(rootJ, "outputMode", intValue)) {
+			outputMode = clamp(static_cast<int>(intValue), 0, tides2::OUTPUT_MODE_LAST - 1);
+		}
+
+		if (getJsonInt(rootJ, "range", intValue)) {
+			range = clamp(static_cast<int>(intValue), 0, 2);
+		}
+	}
+
+	void setRampMode(int modeNum) {
+		rampMode = modeNum;
+	}
+
+	void setOutputMode(int modeNum) {
+		outputMode = modeNum;
+	}
+
+	void setRange(int rangeNum) {
+		range = rangeNum;
+	}
+};
+
+struct AestuariaWidget : SanguineModuleWidget {
+	explicit AestuariaWidget(Aestuaria* module) {
+		setModule(module);
+
+		moduleName = "aestuaria";
+		panelSize = sanguineThemes::SIZE_14;
+		backplateColor = sanguineThemes::PLATE_PURPLE;
+
+		makePanel();
+
+		addScrews(SCREW_ALL);
+
+		addParam(createLightParamCentered<VCVLightButton<MediumSimpleLight<GreenRedLight>>>(millimetersToPixelsVec(11.966, 19.002),
+			module, Aestuaria::PARAM_OUTPUT_MODE, Aestuaria::LIGHT_OUTPUT_MODE));
+
+		FramebufferWidget* aestuariaFrameBuffer = new FramebufferWidget();
+		addChild(aestuariaFrameBuffer);
+
+		SanguineTinyNumericDisplay* displayOutputMode = new SanguineTinyNumericDisplay(1, module, 23.42, 17.343);
+		displayOutputMode->displayType = DISPLAY_STRING;
+		aestuariaFrameBuffer->addChild(displayOutputMode);
+		displayOutputMode->fallbackString = aestuaria::displayOutputModes[0];
+
+		if (module) {
+			displayOutputMode->values.displayText = &module->displayOutputMode;
+		}
+
+		addParam(createLightParamCentered<VCVLightButton<MediumSimpleLight<GreenRedLight>>>(millimetersToPixelsVec(11.966, 29.086),
+			module, Aestuaria::PARAM_RAMP_MODE, Aestuaria::LIGHT_RAMP_MODE));
+
+		addChild(createLightCentered<MediumLight<GreenRedLight>>(millimetersToPixelsVec(20.888, 37.214), module,
+			Aestuaria::LIGHT_PHASE));
+
+		addParam(createParamCentered<Sanguine3PSRed>(millimetersToPixelsVec(35.56, 37.214), module, Aestuaria::PARAM_FREQUENCY));
+
+		addParam(createParamCentered<Sanguine2PSRed>(millimetersToPixelsVec(59.142, 37.214), module, Aestuaria::PARAM_FM));
+
+		addParam(createLightParamCentered<VCVLightButton<MediumSimpleLight<GreenRedLight>>>(millimetersToPixelsVec(11.966, 45.343),
+			module, Aestuaria::PARAM_RANGE, Aestuaria::LIGHT_RANGE));
+
+		addParam(createParamCentered<Sanguine1PSPurple>(millimetersToPixelsVec(8.89, 62.855), module, Aestuaria::PARAM_SHAPE));
+		addParam(createParamCentered<Sanguine1PSPurple>(millimetersToPixelsVec(26.67, 62.855), module, Aestuaria::PARAM_SLOPE));
+		addParam(createParamCentered<Sanguine1PSPurple>(millimetersToPixelsVec(44.45, 62.855), module,
+			Aestuaria::PARAM_SMOOTHNESS));
+		addParam(createParamCentered<Sanguine1PSPurple>(millimetersToPixelsVec(62.23, 62.855), module, Aestuaria::PARAM_SHIFT));
+
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(8.89, 78.995), module, Aestuaria::INPUT_SHAPE));
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(26.67, 78.995), module, Aestuaria::INPUT_SLOPE));
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(44.45, 78.995), module,
+			Aestuaria::INPUT_SMOOTHNESS));
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(62.23, 78.995), module, Aestuaria::INPUT_SHIFT));
+
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(8.89, 95.56), module, Aestuaria::INPUT_TRIGGER));
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(26.67, 95.56), module, Aestuaria::INPUT_CLOCK));
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(44.45, 95.56), module, Aestuaria::INPUT_PITCH));
+		addInput(createInputCentered<BananutPurplePoly>(millimetersToPixelsVec(62.23, 95.56), module, Aestuaria::INPUT_FM));
+
+		addOutput(createOutputCentered<BananutRedPoly>(millimetersToPixelsVec(8.89, 111.643), module, Aestuaria::OUTPUT_1));
+		addOutput(createOutputCentered<BananutRedPoly>(millimetersToPixelsVec(26.67, 111.643), module, Aestuaria::OUTPUT_2));
+		addOutput(createOutputCentered<BananutRedPoly>(millimetersToPixelsVec(44.45, 111.643), module, Aestuaria::OUTPUT_3));
+		addOutput(createOutputCentered<BananutRedPoly>(millimetersToPixelsVec(62.23, 111.643), module, Aestuaria::OUTPUT_4));
+	}
+
+	void appendContextMenu(Menu* menu) override {
+		SanguineModuleWidget::appendContextMenu(menu);
+
+		Aestuaria* module = dynamic_cast<Aestuaria*>(this->module);
+		assert(module);
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createIndexSubmenuItem("Ramp mode", aestuaria::rampModeLabels,
+			[=]() { return module->rampMode; },
+			[=](int i) { module->setRampMode(i); }
+		));
+
+		menu->addChild(createIndexSubmenuItem("Output mode", aestuaria::outputModeLabels,
+			[=]() { return module->outputMode; },
+			[=](int i) { module->setOutputMode(i); }
+		));
+
+		menu->addChild(createIndexSubmenuItem("Range", aestuaria::rangeLabels,
+			[=]() { return module->range; },
+			[=](int i) { module->setRange(i); }
+		));
+	}
+};
+
+Model* modelAestuaria = createModel<Aestuaria, AestuariaWidget>("Sanguine-Aestuaria");
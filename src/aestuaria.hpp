@@ -0,0 +1,71 @@
+#pragma once
+
+using namespace sanguineCommonCode;
+
+namespace aestuaria {
+    static const std::vector<std::string> rampModeLabels = {
+        "AD Envelope",
+        "Cyclic",
+        "AR Envelope"
+    };
+
+    static const std::vector<std::string> outputModeLabels = {
+        "Gates",
+        "Amplitude",
+        "Slope / phase",
+        "Frequency"
+    };
+
+    static const std::vector<std::string> displayOutputModes = {
+        "G",
+        "A",
+        "P",
+        "F"
+    };
+
+    static const std::vector<std::string> rangeLabels = {
+        "Low",
+        "Medium",
+        "High (audio)"
+    };
+
+    static const int kMaxOutputModes = 4;
+
+    static const LightModes outputModeLights[kMaxOutputModes][2] = {
+        { LIGHT_ON, LIGHT_OFF },
+        { LIGHT_ON, LIGHT_ON },
+        { LIGHT_OFF, LIGHT_ON },
+        { LIGHT_BLINK, LIGHT_BLINK }
+    };
+
+    static const float kRootFrequencies[3] = {
+        0.125f,
+        2.f,
+        130.81f
+    };
+
+    static const int kRatiosCount = 20;
+
+    static const tides2::Ratio ratios[kRatiosCount] = {
+        { 0.0625f, 16 },
+        { 0.125f, 8 },
+        { 0.1666666f, 6 },
+        { 0.25f, 4 },
+        { 0.3333333f, 3 },
+        { 0.5f, 2 },
+        { 0.6666666f, 3 },
+        { 0.75f, 4 },
+        { 0.8f, 5 },
+        { 1.f, 1 },
+        { 1.f, 1 },
+        { 1.25f, 4 },
+        { 1.3333333f, 3 },
+        { 1.5f, 2 },
+        { 2.f, 1 },
+        { 3.f, 1 },
+        { 4.f, 1 },
+        { 6.f, 1 },
+        { 8.f, 1 },
+        { 16.f, 1 }
+    };
+}
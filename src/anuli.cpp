@@ -7,9 +7,12 @@
 #include "rings/dsp/part.h"
 #include "rings/dsp/strummer.h"
 #include "rings/dsp/string_synth_part.h"
+#include "stmlib/utils/random.h"
 
 #include "array"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "anuli.hpp"
 
 using simd::float_4;
@@ -65,17 +68,21 @@ struct Anuli : SanguineModule {
 		LIGHTS_COUNT
 	};
 
-	dsp::SampleRateConverter<1> srcInputs[PORT_MAX_CHANNELS];
-	dsp::SampleRateConverter<2> srcOutputs[PORT_MAX_CHANNELS];
-	dsp::DoubleRingBuffer<dsp::Frame<1>, 256> drbInputBuffers[PORT_MAX_CHANNELS];
-	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbOutputBuffers[PORT_MAX_CHANNELS];
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS> srcInput;
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS * 2> srcOutput;
+	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS>, 256> drbInputBuffer;
+	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS * 2>, 256> drbOutputBuffer;
 
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	uint16_t reverbBuffers[PORT_MAX_CHANNELS][32768] = {};
 	rings::Part parts[PORT_MAX_CHANNELS];
 	rings::StringSynthPart stringSynths[PORT_MAX_CHANNELS];
 	rings::Strummer strummers[PORT_MAX_CHANNELS];
+	// Allocated when a shared reverb is first selected.
+	std::atomic<rings::ReverbBus*> reverbBus{ nullptr };
 	rings::PerformanceState performanceStates[PORT_MAX_CHANNELS] = {};
 
 	bool strums[PORT_MAX_CHANNELS] = {};
@@ -92,6 +99,8 @@ struct Anuli : SanguineModule {
 
 	int displayChannel = 0;
 
+	anuli::ReverbBusModes reverbBusMode = anuli::REVERB_BUS_OFF;
+
 	std::array<int, PORT_MAX_CHANNELS> channelModes = {};
 
 	rings::ResonatorModel resonatorModels[PORT_MAX_CHANNELS] = {};
@@ -165,7 +174,14 @@ struct Anuli : SanguineModule {
 		lightsDivider.setDivision(kLightsFrequency);
 	}
 
+	~Anuli() {
+		delete reverbBus.load();
+	}
+
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		bool bWithDisastrousPeace = false;
 
 		channelCount = std::max(std::max(std::max(inputs[INPUT_STRUM].getChannels(), inputs[INPUT_PITCH].getChannels()),
@@ -230,13 +246,23 @@ struct Anuli : SanguineModule {
 			}
 		}
 
+		// TODO: "Normalized to a pulse/burst generator that reacts to note changes on the V/OCT input."
+		if (!drbInputBuffer.full()) {
+			dsp::Frame<PORT_MAX_CHANNELS> frame = {};
+			for (int channel = 0; channel < channelCount; ++channel) {
+				frame.samples[channel] = inputs[INPUT_IN].getVoltage(channel) / 5.f;
+			}
+			drbInputBuffer.push(frame);
+		}
+
 		for (int channel = 0; channel < channelCount; ++channel) {
 			setupChannel(channel, bWithDisastrousPeace);
+		}
 
-			renderFrames(channel, parametersInfo, args.sampleRate);
+		// Every channel renders its block at the same time, so they all share one resampler per direction.
+		renderFrames(parametersInfo, args.sampleRate);
 
-			setOutputs(channel, bHaveBothOutputs);
-		}
+		setOutputs(bHaveBothOutputs);
 
 		setStrummingFlag(performanceStates[displayChannel].strum);
 
@@ -347,20 +373,24 @@ struct Anuli : SanguineModule {
 			0, rings::kNumChords - 1);
 	}
 
-	void setOutputs(const int channel, const bool withBothOutputs) {
-		if (!drbOutputBuffers[channel].empty()) {
-			dsp::Frame<2> outputFrame = drbOutputBuffers[channel].shift();
-			/*
-			"Note: you need to insert a jack into each output to split the signals:
-				   when only one jack is inserted, both signals are mixed together."
-			*/
-			if (withBothOutputs) {
-				outputs[OUTPUT_ODD].setVoltage(clamp(outputFrame.samples[0], -1.f, 1.f) * 5.f, channel);
-				outputs[OUTPUT_EVEN].setVoltage(clamp(outputFrame.samples[1], -1.f, 1.f) * 5.f, channel);
-			} else {
-				float outVoltage = clamp(outputFrame.samples[0] + outputFrame.samples[1], -1.f, 1.f) * 5.f;
-				outputs[OUTPUT_ODD].setVoltage(outVoltage, channel);
-				outputs[OUTPUT_EVEN].setVoltage(outVoltage, channel);
+	void setOutputs(const bool withBothOutputs) {
+		if (!drbOutputBuffer.empty()) {
+			dsp::Frame<PORT_MAX_CHANNELS * 2> outputFrame = drbOutputBuffer.shift();
+			for (int channel = 0; channel < channelCount; ++channel) {
+				const float odd = outputFrame.samples[channel * 2 + 0];
+				const float even = outputFrame.samples[channel * 2 + 1];
+				/*
+				"Note: you need to insert a jack into each output to split the signals:
+					   when only one jack is inserted, both signals are mixed together."
+				*/
+				if (withBothOutputs) {
+					outputs[OUTPUT_ODD].setVoltage(clamp(odd, -1.f, 1.f) * 5.f, channel);
+					outputs[OUTPUT_EVEN].setVoltage(clamp(even, -1.f, 1.f) * 5.f, channel);
+				} else {
+					float outVoltage = clamp(odd + even, -1.f, 1.f) * 5.f;
+					outputs[OUTPUT_ODD].setVoltage(outVoltage, channel);
+					outputs[OUTPUT_EVEN].setVoltage(outVoltage, channel);
+				}
 			}
 		}
 	}
@@ -373,79 +403,128 @@ struct Anuli : SanguineModule {
 		resonatorModels[channel] = bIsEasterEgg ? rings::RESONATOR_MODEL_MODAL :
 			static_cast<rings::ResonatorModel>(channelModes[channel]);
 
-		// TODO: "Normalized to a pulse/burst generator that reacts to note changes on the V/OCT input."
-		if (!drbInputBuffers[channel].full()) {
-			dsp::Frame<1> frame;
-			frame.samples[0] = inputs[INPUT_IN].getVoltage(channel) / 5.f;
-			drbInputBuffers[channel].push(frame);
-		}
-
 		if (!strums[channel]) {
 			strums[channel] = inputs[INPUT_STRUM].getVoltage(channel) >= 1.f;
 		}
 	}
 
-	void renderFrames(const int channel, const ParametersInfo& parametersInfo, const float& sampleRate) {
-		if (drbOutputBuffers[channel].empty()) {
-			float in[anuli::kBlockSize] = {};
+	void renderFrames(const ParametersInfo& parametersInfo, const float& sampleRate) {
+		if (drbOutputBuffer.empty()) {
+			dsp::Frame<PORT_MAX_CHANNELS> inputFrames[anuli::kBlockSize] = {};
 
 			// Convert input buffer.
-			srcInputs[channel].setRates(static_cast<int>(sampleRate), 48000);
-			int inLen = drbInputBuffers[channel].size();
+			srcInput.setRates(static_cast<int>(sampleRate), 48000);
+			srcInput.setChannels(channelCount);
+			int inLen = drbInputBuffer.size();
 			int outLen = anuli::kBlockSize;
-			srcInputs[channel].process(drbInputBuffers[channel].startData(), &inLen,
-				reinterpret_cast<dsp::Frame<1>*>(in), &outLen);
-			drbInputBuffers[channel].startIncr(inLen);
+			srcInput.process(drbInputBuffer.startData(), &inLen, inputFrames, &outLen);
+			drbInputBuffer.startIncr(inLen);
 
-			float out[anuli::kBlockSize];
-			float aux[anuli::kBlockSize];
+			dsp::Frame<PORT_MAX_CHANNELS * 2> outputFrames[anuli::kBlockSize] = {};
 
-			rings::Patch patch;
-			float structure;
+			float out[PORT_MAX_CHANNELS][anuli::kBlockSize];
+			float aux[PORT_MAX_CHANNELS][anuli::kBlockSize];
 
-			switch (channelModes[channel]) {
-			case 6: // Disastrous peace.
-				stringSynths[channel].set_polyphony(polyphonyMode);
+			rings::ReverbBus* sharedReverb = reverbBusMode != anuli::REVERB_BUS_OFF ?
+				reverbBus.load(std::memory_order_acquire) : nullptr;
+			bool reverbSends[PORT_MAX_CHANNELS] = {};
+			int lastSends = 0;
 
-				stringSynths[channel].set_fx(rings::FxType(fxModel));
+			if (sharedReverb) {
+				sharedReverb->Clear();
+			}
 
-				setupPatch(channel, patch, structure, parametersInfo);
-				setupPerformance(channel, performanceStates[channel], structure, parametersInfo);
+			for (int channel = 0; channel < channelCount; ++channel) {
+				float in[anuli::kBlockSize];
+				for (int frame = 0; frame < anuli::kBlockSize; ++frame) {
+					in[frame] = inputFrames[frame].samples[channel];
+				}
 
-				// Process audio.
-				strummers[channel].Process(NULL, anuli::kBlockSize, &performanceStates[channel]);
-				stringSynths[channel].Process(performanceStates[channel], patch, in, out, aux, anuli::kBlockSize);
-				break;
+				rings::Patch patch;
+				float structure;
 
-			default:
-				if (parts[channel].polyphony() != polyphonyMode) {
-					parts[channel].set_polyphony(polyphonyMode);
-				}
+				switch (channelModes[channel]) {
+				case 6: // Disastrous peace.
+					stringSynths[channel].set_polyphony(polyphonyMode);
 
-				parts[channel].set_model(resonatorModels[channel]);
+					stringSynths[channel].set_fx(rings::FxType(fxModel));
 
-				setupPatch(channel, patch, structure, parametersInfo);
-				setupPerformance(channel, performanceStates[channel], structure, parametersInfo);
+					setupPatch(channel, patch, structure, parametersInfo);
+					setupPerformance(channel, performanceStates[channel], structure, parametersInfo);
+
+					// Process audio.
+					strummers[channel].Process(NULL, anuli::kBlockSize, &performanceStates[channel]);
+					stringSynths[channel].Process(performanceStates[channel], patch, in, out[channel], aux[channel],
+						anuli::kBlockSize, sharedReverb);
+					break;
+
+				default:
+					if (parts[channel].polyphony() != polyphonyMode) {
+						parts[channel].set_polyphony(polyphonyMode);
+					}
+
+					parts[channel].set_model(resonatorModels[channel]);
+
+					setupPatch(channel, patch, structure, parametersInfo);
+					setupPerformance(channel, performanceStates[channel], structure, parametersInfo);
+
+					// Process audio.
+					strummers[channel].Process(in, anuli::kBlockSize, &performanceStates[channel]);
+					parts[channel].Process(performanceStates[channel], patch, in, out[channel], aux[channel],
+						anuli::kBlockSize, sharedReverb);
+					break;
+				}
 
-				// Process audio.
-				strummers[channel].Process(in, anuli::kBlockSize, &performanceStates[channel]);
-				parts[channel].Process(performanceStates[channel], patch, in, out, aux, anuli::kBlockSize);
-				break;
+				if (sharedReverb) {
+					reverbSends[channel] = sharedReverb->num_sends() > lastSends;
+					lastSends = sharedReverb->num_sends();
+				}
+			}
+
+			// Every channel that sent to the shared reverb gets its share back, ahead of its limiter.
+			if (sharedReverb && lastSends > 0) {
+				sharedReverb->Process(anuli::kBlockSize);
+
+				const bool bMonoReturn = reverbBusMode == anuli::REVERB_BUS_MONO;
+				for (int channel = 0; channel < channelCount; ++channel) {
+					if (reverbSends[channel]) {
+						if (channelModes[channel] == 6) {
+							stringSynths[channel].Mix(sharedReverb, bMonoReturn, out[channel], aux[channel],
+								anuli::kBlockSize);
+						} else {
+							parts[channel].Mix(sharedReverb, bMonoReturn, out[channel], aux[channel],
+								anuli::kBlockSize);
+						}
+					}
+				}
 			}
 
 			// Convert output buffer.
-			dsp::Frame<2> outputFrames[anuli::kBlockSize];
-			for (int frame = 0; frame < anuli::kBlockSize; ++frame) {
-				outputFrames[frame].samples[0] = out[frame];
-				outputFrames[frame].samples[1] = aux[frame];
+			for (int channel = 0; channel < channelCount; ++channel) {
+				for (int frame = 0; frame < anuli::kBlockSize; ++frame) {
+					outputFrames[frame].samples[channel * 2 + 0] = out[channel][frame];
+					outputFrames[frame].samples[channel * 2 + 1] = aux[channel][frame];
+				}
 			}
 
-			srcOutputs[channel].setRates(48000, static_cast<int>(sampleRate));
+			srcOutput.setRates(48000, static_cast<int>(sampleRate));
+			srcOutput.setChannels(channelCount * 2);
 			int inCount = anuli::kBlockSize;
-			int outCount = drbOutputBuffers[channel].capacity();
-			srcOutputs[channel].process(outputFrames, &inCount, drbOutputBuffers[channel].endData(), &outCount);
-			drbOutputBuffers[channel].endIncr(outCount);
+			int outCount = drbOutputBuffer.capacity();
+			srcOutput.process(outputFrames, &inCount, drbOutputBuffer.endData(), &outCount);
+			drbOutputBuffer.endIncr(outCount);
+		}
+	}
+
+	// Called from the UI thread only, so the audio thread never allocates the bus.
+	void setReverbBusMode(anuli::ReverbBusModes mode) {
+		if (mode != anuli::REVERB_BUS_OFF && !reverbBus.load(std::memory_order_relaxed)) {
+			rings::ReverbBus* newBus = new rings::ReverbBus();
+			memset(newBus, 0, sizeof(*newBus));
+			newBus->Init();
+			reverbBus.store(newBus, std::memory_order_release);
 		}
+		reverbBusMode = mode;
 	}
 
 	void setStrummingFlag(bool flag) {
@@ -457,12 +536,25 @@ struct Anuli : SanguineModule {
 		}
 	}
 
+	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+	}
+
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
 	json_t* dataToJson() override {
 		json_t* rootJ = SanguineModule::dataToJson();
 
 		setJsonBoolean(rootJ, "NotesModeSelection", bNotesModeSelection);
 		setJsonBoolean(rootJ, "useFrequencyOffset", bUseFrequencyOffset);
 		setJsonInt(rootJ, "displayChannel", displayChannel);
+		setJsonInt(rootJ, "reverbBusMode", reverbBusMode);
+
+		randomStream.dataToJson(rootJ);
 
 		return rootJ;
 	}
@@ -478,6 +570,13 @@ struct Anuli : SanguineModule {
 		if (getJsonInt(rootJ, "displayChannel", intValue)) {
 			displayChannel = intValue;
 		}
+
+		if (getJsonInt(rootJ, "reverbBusMode", intValue)) {
+			setReverbBusMode(static_cast<anuli::ReverbBusModes>(clamp(static_cast<int>(intValue),
+				static_cast<int>(anuli::REVERB_BUS_OFF), static_cast<int>(anuli::REVERB_BUS_STEREO))));
+		}
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	void setMode(int modeNum) {
@@ -623,6 +722,13 @@ struct AnuliWidget : SanguineModuleWidget {
 				menu->addChild(new MenuSeparator);
 
 				menu->addChild(createBoolPtrMenuItem("C4-F#4 direct mode selection", "", &module->bNotesModeSelection));
+
+				menu->addChild(new MenuSeparator);
+
+				menu->addChild(createIndexSubmenuItem("Reverb", anuli::reverbBusLabels,
+					[=]() {return module->reverbBusMode; },
+					[=](int i) {module->setReverbBusMode(static_cast<anuli::ReverbBusModes>(i)); }
+				));
 			}
 		));
 
@@ -633,6 +739,10 @@ struct AnuliWidget : SanguineModuleWidget {
 				menu->addChild(createBoolPtrMenuItem("Frequency knob center is C", "", &module->bUseFrequencyOffset));
 			}
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
@@ -3,6 +3,12 @@
 using namespace sanguineCommonCode;
 
 namespace anuli {
+    enum ReverbBusModes {
+        REVERB_BUS_OFF,
+        REVERB_BUS_MONO,
+        REVERB_BUS_STEREO
+    };
+
     static const std::vector<std::string> modeLabels = {
         "Modal Reso.",
         "Sym. Strings",
@@ -32,6 +38,12 @@ namespace anuli {
         "Disastrous Peace"
     };
 
+    static const std::vector<std::string> reverbBusLabels = {
+        "Per channel",
+        "Shared, mono",
+        "Shared, stereo"
+    };
+
     static const int kMaxModes = 7;
 
     static const LightModes modeLights[kMaxModes][3] = {
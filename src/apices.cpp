@@ -4,7 +4,10 @@
 #include "sanguinejson.hpp"
 
 #include "peaks/processors.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "apices.hpp"
 #ifndef METAMODULE
 #include "nix.hpp"
@@ -91,9 +94,11 @@ struct Apices : SanguineModule {
 	dsp::SchmittTrigger stSwitches[apicesCommon::kButtonCount];
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	peaks::GateFlags gateFlags[apicesCommon::kChannelCount] = {};
 
-	dsp::SampleRateConverter<apicesCommon::kChannelCount> srcOutput;
+	resamplerCommon::PolyphaseResampler<apicesCommon::kChannelCount> srcOutput;
 	dsp::DoubleRingBuffer<dsp::Frame<apicesCommon::kChannelCount>, 256> drbOutputBuffer;
 
 	struct Block {
@@ -170,6 +175,9 @@ struct Apices : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		float sampleTime = 0.f;
 
 		bool bIsLightsTurn = lightsDivider.process();
@@ -732,10 +740,14 @@ struct Apices : SanguineModule {
 	}
 
 	void onReset(const ResetEvent& e) override {
+		randomStream.reseed(getId());
+
 		init();
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		jitteredLightsFrequency = kLightsFrequency + (getId() % kLightsFrequency);
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
@@ -1039,6 +1051,8 @@ struct Apices : SanguineModule {
 		if (settings.processorFunctions[1] == apices::FUNCTION_TAP_LFO) {
 			setJsonInt(rootJ, "tapLFO1", processors[1].getPhaseIncrement());
 		}
+		randomStream.dataToJson(rootJ);
+
 		return rootJ;
 	}
 
@@ -1085,6 +1099,8 @@ struct Apices : SanguineModule {
 				processors[1].setPhaseIncrement(intValue);
 			}
 		}
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	inline Slice NextSlice(size_t size) {
@@ -1304,6 +1320,10 @@ struct ApicesWidget : SanguineModuleWidget {
 				}));
 		}
 #endif
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, apices, &apices->randomStream);
 	}
 };
 
@@ -45,6 +45,126 @@ namespace cloudyCommon {
 
 	static const int kMaxFrames = 32;
 
+	// The hardware's rate: the modules resample to it unless they process at the engine's rate.
+	static const int kModuleSampleRate = 32000;
+
+	/*
+	   Engine rates the processors can run at directly: their effects' delay memory holds up to four times the module's
+	   rate on the desktop, and only the module's rate on the MetaModule.
+	*/
+	static const int kMinNativeSampleRate = kModuleSampleRate;
+#ifndef METAMODULE
+	static const int kMaxNativeSampleRate = 96000;
+#else
+	static const int kMaxNativeSampleRate = kModuleSampleRate;
+#endif
+
+	// Outside the native range, the modules fall back to resampling.
+	inline int getProcessingRate(bool bNativeRate, float sampleRate) {
+		const int engineRate = static_cast<int>(sampleRate);
+		return bNativeRate && engineRate >= kMinNativeSampleRate && engineRate <= kMaxNativeSampleRate ?
+			engineRate : kModuleSampleRate;
+	}
+
 	static const int kBigBufferLength = 118784;
 	static const int kSmallBufferLength = 65536 - 128;
+
+	enum RecordingBuffers {
+		RECORDING_BUFFER_MODULE,
+		RECORDING_BUFFER_FLOAT_SHORT,
+		RECORDING_BUFFER_FLOAT_LONG
+	};
+
+	static const std::vector<std::string> recordingBufferLabels{
+		"Module (16-bit)",
+		"Float, 4 s mono / 2 s stereo",
+		"Float, 8 s mono / 4 s stereo"
+	};
+
+	/*
+	   Float buffer lengths, in samples at 32 kHz. The looping delay addresses its buffer in 20.12 fixed point, so they
+	   must stay below 2^18.
+	*/
+	static const int floatBufferLengths[] = {
+		0,
+		128000,
+		256000
+	};
+
+	// A hi-fi recording buffer, allocated and freed on the UI thread only.
+	struct FloatBuffer {
+		float* data;
+		int size;
+		FloatBuffer* next = nullptr;
+
+		explicit FloatBuffer(int length) :
+			data(length > 0 ? new float[length] : nullptr),
+			size(length) {
+		}
+
+		~FloatBuffer() {
+			delete[] data;
+		}
+	};
+
+	/*
+	   Hands recording buffers from the UI thread to the audio thread, and the ones it lets go of back, so the audio
+	   thread never calls new or delete. Released buffers are freed on the next request.
+	*/
+	class FloatBufferHandoff {
+	public:
+		~FloatBufferHandoff() {
+			delete pending.exchange(nullptr);
+			freeReleased();
+			delete current;
+		}
+
+		// UI thread.
+		void request(int length) {
+			freeReleased();
+			if (length != requestedSize) {
+				requestedSize = length;
+				delete pending.exchange(new FloatBuffer(length), std::memory_order_acq_rel);
+			}
+		}
+
+		// Audio thread: swaps in the requested buffer, if any; returns true when it did.
+		bool update() {
+			FloatBuffer* requested = pending.exchange(nullptr, std::memory_order_acq_rel);
+			if (!requested) {
+				return false;
+			}
+			if (current) {
+				current->next = released.load(std::memory_order_relaxed);
+				while (!released.compare_exchange_weak(current->next, current, std::memory_order_release,
+					std::memory_order_relaxed)) {
+				}
+			}
+			current = requested;
+			return true;
+		}
+
+		float* data() const {
+			return current ? current->data : nullptr;
+		}
+
+		int size() const {
+			return current ? current->size : 0;
+		}
+
+	private:
+		FloatBuffer* current = nullptr;
+		std::atomic<FloatBuffer*> pending{ nullptr };
+		std::atomic<FloatBuffer*> released{ nullptr };
+		int requestedSize = 0;
+
+		void freeReleased() {
+			FloatBuffer* buffer = released.exchange(nullptr, std::memory_order_acquire);
+			while (buffer) {
+				FloatBuffer* next = buffer->next;
+				delete buffer;
+				buffer = next;
+			}
+		}
+	};
 }
\ No newline at end of file
@@ -11,7 +11,10 @@
 #include "renaissance/renaissance_envelope.h"
 #include "renaissance/renaissance_quantizer.h"
 #include "renaissance/renaissance_quantizer_scales.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "nodicommon.hpp"
 
 #include "contextus.hpp"
@@ -100,10 +103,12 @@ struct Contextus : SanguineModule {
 	static const int kLightsFrequency = 16;
 	int jitteredLightsFrequency;
 
-	dsp::DoubleRingBuffer<dsp::Frame<1>, 256> drbOutputBuffers[PORT_MAX_CHANNELS];
-	dsp::SampleRateConverter<1> sampleRateConverters[PORT_MAX_CHANNELS];
+	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS>, 256> drbOutputBuffer;
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS> sampleRateConverter;
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	bool triggersDetected[PORT_MAX_CHANNELS] = {};
 	bool lastTriggers[PORT_MAX_CHANNELS] = {};
 	bool triggeredChannels[PORT_MAX_CHANNELS] = {};
@@ -202,6 +207,9 @@ struct Contextus : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		channelCount = std::max(std::max(inputs[INPUT_PITCH].getChannels(),
 			inputs[INPUT_TRIGGER].getChannels()), 1);
 
@@ -228,6 +236,10 @@ struct Contextus : SanguineModule {
 
 		bool bHaveMetaCable = inputs[INPUT_META].isConnected();
 
+		// Every channel renders its block at the same time, so they all share one resampler.
+		bool bMustRender = drbOutputBuffer.empty();
+		dsp::Frame<PORT_MAX_CHANNELS> renderFrames[nodiCommon::kBlockSize] = {};
+
 		for (int channel = 0; channel < channelCount; ++channel) {
 			settings[channel].quantizer_scale = knobScale;
 			settings[channel].quantizer_root = knobRoot;
@@ -278,7 +290,7 @@ struct Contextus : SanguineModule {
 			}
 
 			// Render frames.
-			if (drbOutputBuffers[channel].empty()) {
+			if (bMustRender) {
 				envelopes[channel].Update(settings[channel].ad_attack * 8, settings[channel].ad_decay * 8);
 				uint32_t adValue = envelopes[channel].Render();
 
@@ -390,33 +402,36 @@ struct Contextus : SanguineModule {
 					renderBuffer[block] = stmlib::Mix(sample, warped, signature);
 				}
 
-				if (!bWantLowCpu) {
-					// Sample rate convert.
-					dsp::Frame<1> in[nodiCommon::kBlockSize];
-					for (int block = 0; block < nodiCommon::kBlockSize; ++block) {
-						in[block].samples[0] = renderBuffer[block] / 32768.f;
-					}
-					sampleRateConverters[channel].setRates(96000, args.sampleRate);
-
-					int inLen = nodiCommon::kBlockSize;
-					int outLen = drbOutputBuffers[channel].capacity();
-					sampleRateConverters[channel].process(in, &inLen, drbOutputBuffers[channel].endData(), &outLen);
-					drbOutputBuffers[channel].endIncr(outLen);
-				} else {
-					for (int block = 0; block < nodiCommon::kBlockSize; ++block) {
-						dsp::Frame<1> inFrame;
-						inFrame.samples[0] = renderBuffer[block] / 32768.f;
-						drbOutputBuffers[channel].push(inFrame);
-					}
+				for (int block = 0; block < nodiCommon::kBlockSize; ++block) {
+					renderFrames[block].samples[channel] = renderBuffer[block] / 32768.f;
 				}
 			}
+		} // Channels.
 
-			// Output.
-			if (!drbOutputBuffers[channel].empty()) {
-				dsp::Frame<1> outFrame = drbOutputBuffers[channel].shift();
-				outputs[OUTPUT_OUT].setVoltage(5.f * outFrame.samples[0], channel);
+		if (bMustRender) {
+			if (!bWantLowCpu) {
+				// Sample rate convert.
+				sampleRateConverter.setRates(96000, args.sampleRate);
+				sampleRateConverter.setChannels(channelCount);
+
+				int inLen = nodiCommon::kBlockSize;
+				int outLen = drbOutputBuffer.capacity();
+				sampleRateConverter.process(renderFrames, &inLen, drbOutputBuffer.endData(), &outLen);
+				drbOutputBuffer.endIncr(outLen);
+			} else {
+				int len = std::min(static_cast<int>(drbOutputBuffer.capacity()), nodiCommon::kBlockSize);
+				memcpy(drbOutputBuffer.endData(), renderFrames, len * sizeof(renderFrames[0]));
+				drbOutputBuffer.endIncr(len);
 			}
-		} // Channels.
+		}
+
+		// Output.
+		if (!drbOutputBuffer.empty()) {
+			dsp::Frame<PORT_MAX_CHANNELS> outFrame = drbOutputBuffer.shift();
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputs[OUTPUT_OUT].setVoltage(5.f * outFrame.samples[channel], channel);
+			}
+		}
 
 		outputs[OUTPUT_OUT].setChannels(channelCount);
 
@@ -582,6 +597,8 @@ struct Contextus : SanguineModule {
 		setJsonInt(rootJ, "userSignSeed", userSignSeed);
 		setJsonBoolean(rootJ, "perInstanceSignSeed", bPerInstanceSignSeed);
 
+		randomStream.dataToJson(rootJ);
+
 		return rootJ;
 	}
 
@@ -607,6 +624,8 @@ struct Contextus : SanguineModule {
 		}
 
 		getJsonBoolean(rootJ, "perInstanceSignSeed", bPerInstanceSignSeed);
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	void setWaveShaperSeed(uint32_t seed) {
@@ -642,6 +661,8 @@ struct Contextus : SanguineModule {
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		if (bNeedSignSeed) {
 			userSignSeed = getInstanceSeed();
 			setWaveShaperSeed(userSignSeed);
@@ -651,6 +672,12 @@ struct Contextus : SanguineModule {
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
 
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
 	void onSampleRateChange(const SampleRateChangeEvent& e) override {
 		log2SampleRate = log2f(96000.f / e.sampleRate);
 	}
@@ -872,6 +899,10 @@ struct ContextusWidget : SanguineModuleWidget {
 				));
 			}
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
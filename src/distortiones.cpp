@@ -5,7 +5,9 @@
 #include "array"
 
 #include "distortiones/dsp/distortiones_modulator.h"
+#include "parasites_stmlib/utils/parasites_random.h"
 
+#include "randomcommon.hpp"
 #include "warpiescommon.hpp"
 
 #include "warpiespals.hpp"
@@ -52,6 +54,8 @@ struct Distortiones : SanguineModule {
 
 	int featureMode = 0;
 	int frames[PORT_MAX_CHANNELS] = {};
+	bool bStaggerBlocks = false;
+	int blockPhasesChannelCount = 0;
 
 	static const int kLightsFrequency = 128;
 	int jitteredLightsFrequency;
@@ -59,8 +63,10 @@ struct Distortiones : SanguineModule {
 	dsp::BooleanTrigger btModeSwitch;
 	dsp::ClockDivider lightsDivider;
 	distortiones::DistortionesModulator modulators[PORT_MAX_CHANNELS];
-	distortiones::ShortFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
-	distortiones::ShortFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+	distortiones::FloatFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+	distortiones::FloatFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+
+	randomCommon::RandomStream randomStream;
 
 	bool bModeSwitchEnabled = false;
 	bool bLastInModeSwitch = false;
@@ -111,12 +117,22 @@ struct Distortiones : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		parasites_stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
 		std::array <distortiones::FeatureMode, PORT_MAX_CHANNELS> channelFeatureModes;
 
 		int channelCount = std::max(std::max(inputs[INPUT_CARRIER].getChannels(), inputs[INPUT_MODULATOR].getChannels()), 1);
 
+		// Block phases follow the stagger option and, when staggered, the channel count.
+		int phasesChannelCount = bStaggerBlocks ? channelCount : 0;
+		if (phasesChannelCount != blockPhasesChannelCount) {
+			warpiescommon::setBlockPhases(frames, channelCount, bStaggerBlocks);
+			blockPhasesChannelCount = phasesChannelCount;
+		}
+
 		int32_t internalOscillator = static_cast<int32_t>(params[PARAM_CARRIER].getValue());
 
 		float algorithmValue = 0.f;
@@ -214,15 +230,11 @@ struct Distortiones : SanguineModule {
 				modulators[channel].Process(inputFrames[channel], outputFrames[channel], warpiescommon::kBlockSize);
 			}
 
-			inputFrames[channel][frames[channel]].l = clamp(static_cast<int>(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f * 32768),
-				-32768, 32767);
-			inputFrames[channel][frames[channel]].r = clamp(static_cast<int>(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f * 32768),
-				-32768, 32767);
+			inputFrames[channel][frames[channel]].l = clamp(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f, -1.f, 1.f);
+			inputFrames[channel][frames[channel]].r = clamp(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f, -1.f, 1.f);
 
-			outputs[OUTPUT_MODULATOR].setVoltage(static_cast<float>(outputFrames[channel][frames[channel]].l) /
-				32768 * 5.f, channel);
-			outputs[OUTPUT_AUX].setVoltage(static_cast<float>(outputFrames[channel][frames[channel]].r) /
-				32768 * 5.f, channel);
+			outputs[OUTPUT_MODULATOR].setVoltage(outputFrames[channel][frames[channel]].l * 5.f, channel);
+			outputs[OUTPUT_AUX].setVoltage(outputFrames[channel][frames[channel]].r * 5.f, channel);
 		}
 
 		outputs[OUTPUT_MODULATOR].setChannels(channelCount);
@@ -316,15 +328,26 @@ struct Distortiones : SanguineModule {
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		jitteredLightsFrequency = kLightsFrequency + (getId() % kLightsFrequency);
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
 
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
 	json_t* dataToJson() override {
 		json_t* rootJ = SanguineModule::dataToJson();
 
 		setJsonInt(rootJ, "mode", modulators[0].feature_mode());
 		setJsonBoolean(rootJ, "NotesModeSelection", bNotesModeSelection);
+		setJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+		randomStream.dataToJson(rootJ);
 
 		return rootJ;
 	}
@@ -340,6 +363,9 @@ struct Distortiones : SanguineModule {
 		}
 
 		getJsonBoolean(rootJ, "NotesModeSelection", bNotesModeSelection);
+		getJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	void setFeatureMode(int modeNumber) {
@@ -458,6 +484,14 @@ struct DistortionesWidget : SanguineModuleWidget {
 		menu->addChild(new MenuSeparator);
 
 		menu->addChild(createBoolPtrMenuItem("C4-G#4 direct mode selection", "", &module->bNotesModeSelection));
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createBoolPtrMenuItem("Stagger channel blocks (flatter CPU load)", "", &module->bStaggerBlocks));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
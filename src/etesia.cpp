@@ -4,7 +4,10 @@
 #include "sanguinejson.hpp"
 
 #include "clouds_parasite/dsp/etesia_granular_processor.h"
+#include "parasites_stmlib/utils/parasites_random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "etesia.hpp"
 
 #pragma GCC diagnostic ignored "-Wclass-memaccess"
@@ -85,14 +88,16 @@ struct Etesia : SanguineModule {
 	std::string textFeedback = etesia::modeDisplays[0].labelFeedback;
 	std::string textReverb = etesia::modeDisplays[0].labelReverb;
 
-	dsp::SampleRateConverter<2> srcInput;
-	dsp::SampleRateConverter<2> srcOutput;
+	resamplerCommon::PolyphaseResampler<2> srcInput;
+	resamplerCommon::PolyphaseResampler<2> srcOutput;
 	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbInputBuffer;
 	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbOutputBuffer;
 	dsp::VuMeter2 vuMeter;
 	dsp::ClockDivider lightsDivider;
 	dsp::BooleanTrigger btLedsMode;
 
+	randomCommon::RandomStream randomStream;
+
 	etesia::PlaybackMode playbackMode = etesia::PLAYBACK_MODE_GRANULAR;
 	etesia::PlaybackMode lastPlaybackMode = etesia::PLAYBACK_MODE_GRANULAR;
 	etesia::PlaybackMode lastLEDPlaybackMode = etesia::PLAYBACK_MODE_GRANULAR;
@@ -115,9 +120,13 @@ struct Etesia : SanguineModule {
 	bool bDisplaySwitched = false;
 	bool bTriggered = false;
 
+	int recordingBuffer = cloudyCommon::RECORDING_BUFFER_MODULE;
+
 	uint8_t* bufferLarge;
 	uint8_t* bufferSmall;
 
+	cloudyCommon::FloatBufferHandoff floatBuffer;
+
 	etesia::EtesiaGranularProcessor* etesiaProcessor;
 
 	Etesia() {
@@ -204,6 +213,9 @@ struct Etesia : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		parasites_stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
 		dsp::Frame<2> inputFrame;
@@ -254,6 +266,9 @@ struct Etesia : SanguineModule {
 			etesiaProcessor->set_playback_mode(playbackMode);
 			etesiaProcessor->set_num_channels(static_cast<bool>(params[PARAM_STEREO].getValue()) ? 2 : 1);
 			etesiaProcessor->set_low_fidelity(!static_cast<bool>(params[PARAM_HI_FI].getValue()));
+			if (floatBuffer.update()) {
+				etesiaProcessor->set_float_buffer(floatBuffer.data(), floatBuffer.size());
+			}
 			etesiaProcessor->Prepare();
 
 			bool bFrozen = static_cast<bool>(params[PARAM_FREEZE].getValue());
@@ -558,6 +573,44 @@ struct Etesia : SanguineModule {
 		} // lightsDivider
 	}
 
+	void setRecordingBuffer(int buffer) {
+		recordingBuffer = buffer;
+		floatBuffer.request(cloudyCommon::floatBufferLengths[recordingBuffer]);
+	}
+
+	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+	}
+
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
+	json_t* dataToJson() override {
+		json_t* rootJ = SanguineModule::dataToJson();
+
+		setJsonInt(rootJ, "recordingBuffer", recordingBuffer);
+
+		randomStream.dataToJson(rootJ);
+
+		return rootJ;
+	}
+
+	void dataFromJson(json_t* rootJ) override {
+		SanguineModule::dataFromJson(rootJ);
+
+		json_int_t intValue = 0;
+
+		if (getJsonInt(rootJ, "recordingBuffer", intValue)) {
+			setRecordingBuffer(clamp(static_cast<int>(intValue), 0,
+				static_cast<int>(cloudyCommon::recordingBufferLabels.size()) - 1));
+		}
+
+		randomStream.dataFromJson(rootJ);
+	}
+
 	int getModeParam() {
 		return params[PARAM_MODE].getValue();
 	}
@@ -767,6 +820,17 @@ struct EtesiaWidget : SanguineModuleWidget {
 			[=]() {return module->getModeParam(); },
 			[=](int i) {module->setModeParam(i); }
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createIndexSubmenuItem("Hi-Fi recording buffer", cloudyCommon::recordingBufferLabels,
+			[=]() {return module->recordingBuffer; },
+			[=](int i) {module->setRecordingBuffer(i); }
+		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
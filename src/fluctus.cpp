@@ -4,7 +4,10 @@
 #include "sanguinejson.hpp"
 
 #include "fluctus/dsp/fluctus_granular_processor.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "fluctus.hpp"
 
 #pragma GCC diagnostic ignored "-Wclass-memaccess"
@@ -82,14 +85,16 @@ struct Fluctus : SanguineModule {
 	std::string textFeedback = fluctus::modeDisplays[0].labelFeedback;
 	std::string textReverb = fluctus::modeDisplays[0].labelReverb;
 
-	dsp::SampleRateConverter<2> srcInput;
-	dsp::SampleRateConverter<2> srcOutput;
+	resamplerCommon::PolyphaseResampler<2> srcInput;
+	resamplerCommon::PolyphaseResampler<2> srcOutput;
 	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbInputBuffer;
 	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbOutputBuffer;
 	dsp::VuMeter2 vuMeter;
 	dsp::ClockDivider lightsDivider;
 	dsp::BooleanTrigger btLedsMode;
 
+	randomCommon::RandomStream randomStream;
+
 	fluctus::PlaybackMode playbackMode = fluctus::PLAYBACK_MODE_GRANULAR;
 	fluctus::PlaybackMode lastPlaybackMode = fluctus::PLAYBACK_MODE_LAST;
 	fluctus::PlaybackMode lastLEDPlaybackMode = fluctus::PLAYBACK_MODE_GRANULAR;
@@ -111,10 +116,15 @@ struct Fluctus : SanguineModule {
 	bool bLastFrozen = false;
 	bool bDisplaySwitched = false;
 	bool bTriggered = false;
+	bool bNativeRate = false;
+
+	int recordingBuffer = cloudyCommon::RECORDING_BUFFER_MODULE;
 
 	uint8_t* bufferLarge;
 	uint8_t* bufferSmall;
 
+	cloudyCommon::FloatBufferHandoff floatBuffer;
+
 	fluctus::FluctusGranularProcessor* fluctusProcessor;
 
 	Fluctus() {
@@ -198,6 +208,9 @@ struct Fluctus : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
 		dsp::Frame<2> inputFrame;
@@ -226,8 +239,9 @@ struct Fluctus : SanguineModule {
 		// Render frames.
 		if (drbOutputBuffer.empty()) {
 			fluctus::ShortFrame input[cloudyCommon::kMaxFrames] = {};
+			const int processingRate = cloudyCommon::getProcessingRate(bNativeRate, args.sampleRate);
 			// Convert input buffer.
-			srcInput.setRates(args.sampleRate, 32000);
+			srcInput.setRates(args.sampleRate, processingRate);
 			dsp::Frame<2> inputFrames[cloudyCommon::kMaxFrames];
 			int inputLength = drbInputBuffer.size();
 			int outputLength = cloudyCommon::kMaxFrames;
@@ -247,6 +261,10 @@ struct Fluctus : SanguineModule {
 			fluctusProcessor->set_playback_mode(playbackMode);
 			fluctusProcessor->set_num_channels(static_cast<bool>(params[PARAM_STEREO].getValue()) ? 2 : 1);
 			fluctusProcessor->set_low_fidelity(!static_cast<bool>(params[PARAM_HI_FI].getValue()));
+			fluctusProcessor->set_sample_rate(processingRate);
+			if (floatBuffer.update()) {
+				fluctusProcessor->set_float_buffer(floatBuffer.data(), floatBuffer.size());
+			}
 			fluctusProcessor->Prepare();
 
 #ifndef METAMODULE
@@ -337,7 +355,7 @@ struct Fluctus : SanguineModule {
 				outputFrames[frame].samples[1] = output[frame].r / 32768.f;
 			}
 
-			srcOutput.setRates(32000, args.sampleRate);
+			srcOutput.setRates(processingRate, args.sampleRate);
 			int inCount = cloudyCommon::kMaxFrames;
 			int outCount = drbOutputBuffer.capacity();
 			srcOutput.process(outputFrames, &inCount, drbOutputBuffer.endData(), &outCount);
@@ -564,6 +582,46 @@ struct Fluctus : SanguineModule {
 		} // lightsDivider
 	}
 
+	void setRecordingBuffer(int buffer) {
+		recordingBuffer = buffer;
+		floatBuffer.request(cloudyCommon::floatBufferLengths[recordingBuffer]);
+	}
+
+	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+	}
+
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
+	json_t* dataToJson() override {
+		json_t* rootJ = SanguineModule::dataToJson();
+
+		setJsonBoolean(rootJ, "nativeRate", bNativeRate);
+		setJsonInt(rootJ, "recordingBuffer", recordingBuffer);
+
+		randomStream.dataToJson(rootJ);
+
+		return rootJ;
+	}
+
+	void dataFromJson(json_t* rootJ) override {
+		SanguineModule::dataFromJson(rootJ);
+
+		getJsonBoolean(rootJ, "nativeRate", bNativeRate);
+
+		json_int_t intValue = 0;
+
+		if (getJsonInt(rootJ, "recordingBuffer", intValue)) {
+			setRecordingBuffer(clamp(static_cast<int>(intValue), 0, fluctus::kMaxRecordingBuffer));
+		}
+
+		randomStream.dataFromJson(rootJ);
+	}
+
 	int getModeParam() {
 		return params[PARAM_MODE].getValue();
 	}
@@ -764,6 +822,22 @@ struct FluctusWidget : SanguineModuleWidget {
 			[=]() {return module->getModeParam(); },
 			[=](int i) {module->setModeParam(i); }
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createBoolPtrMenuItem("Process at the engine sample rate (up to 96 kHz, higher CPU)", "",
+			&module->bNativeRate));
+
+		std::vector<std::string> recordingBufferLabels(cloudyCommon::recordingBufferLabels.begin(),
+			cloudyCommon::recordingBufferLabels.begin() + fluctus::kMaxRecordingBuffer + 1);
+		menu->addChild(createIndexSubmenuItem("Hi-Fi recording buffer", recordingBufferLabels,
+			[=]() {return module->recordingBuffer; },
+			[=](int i) {module->setRecordingBuffer(i); }
+		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
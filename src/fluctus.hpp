@@ -3,6 +3,12 @@
 #include "cloudycommon.hpp"
 
 namespace fluctus {
+    /*
+       The beat-repeat mode addresses its buffer in 20.12 fixed point, four buffer lengths at a time: longer float
+       buffers would overflow it.
+    */
+    static const int kMaxRecordingBuffer = cloudyCommon::RECORDING_BUFFER_FLOAT_SHORT;
+
     static const std::vector<cloudyCommon::ModeInfo> modeList{
         { "GRANULAR", "Granular mode" },
         { "STRETCH", "Pitch shifter/time stretcher" },
@@ -3,7 +3,9 @@
 #include "sanguinehelpers.hpp"
 
 #include "warps/dsp/modulator.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
 #include "warpiescommon.hpp"
 #include "warpiespals.hpp"
 
@@ -43,17 +45,21 @@ struct Incurvationes : SanguineModule {
 
 
 	int frames[PORT_MAX_CHANNELS] = {};
+	bool bStaggerBlocks = false;
+	int blockPhasesChannelCount = 0;
 	static const int kLightsFrequency = 128;
 	int jitteredLightsFrequency;
 
 	warps::Modulator modulators[PORT_MAX_CHANNELS];
-	warps::ShortFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
-	warps::ShortFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+	warps::FloatFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+	warps::FloatFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
 
 	bool bEasterEggEnabled = false;
 
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	warps::Parameters* parameters[PORT_MAX_CHANNELS];
 
 	Incurvationes() {
@@ -90,10 +96,20 @@ struct Incurvationes : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
 		int channelCount = std::max(std::max(inputs[INPUT_CARRIER].getChannels(), inputs[INPUT_MODULATOR].getChannels()), 1);
 
+		// Block phases follow the stagger option and, when staggered, the channel count.
+		int phasesChannelCount = bStaggerBlocks ? channelCount : 0;
+		if (phasesChannelCount != blockPhasesChannelCount) {
+			warpiescommon::setBlockPhases(frames, channelCount, bStaggerBlocks);
+			blockPhasesChannelCount = phasesChannelCount;
+		}
+
 		int32_t internalOscillator = static_cast<int32_t>(params[PARAM_CARRIER].getValue());
 
 		bEasterEggEnabled = static_cast<bool>(params[PARAM_EASTER_EGG].getValue());
@@ -142,13 +158,11 @@ struct Incurvationes : SanguineModule {
 				modulators[channel].Process(inputFrames[channel], outputFrames[channel], warpiescommon::kBlockSize);
 			}
 
-			inputFrames[channel][frames[channel]].l = clamp(static_cast<int>(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f * 32768),
-				-32768, 32767);
-			inputFrames[channel][frames[channel]].r = clamp(static_cast<int>(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f * 32768),
-				-32768, 32767);
+			inputFrames[channel][frames[channel]].l = clamp(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f, -1.f, 1.f);
+			inputFrames[channel][frames[channel]].r = clamp(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f, -1.f, 1.f);
 
-			outputs[OUTPUT_MODULATOR].setVoltage(static_cast<float>(outputFrames[channel][frames[channel]].l) / 32768 * 5.f, channel);
-			outputs[OUTPUT_AUX].setVoltage(static_cast<float>(outputFrames[channel][frames[channel]].r) / 32768 * 5.f, channel);
+			outputs[OUTPUT_MODULATOR].setVoltage(outputFrames[channel][frames[channel]].l * 5.f, channel);
+			outputs[OUTPUT_AUX].setVoltage(outputFrames[channel][frames[channel]].r * 5.f, channel);
 		}
 
 		outputs[OUTPUT_MODULATOR].setChannels(channelCount);
@@ -210,9 +224,35 @@ struct Incurvationes : SanguineModule {
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		jitteredLightsFrequency = kLightsFrequency + (getId() % kLightsFrequency);
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
+
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
+	json_t* dataToJson() override {
+		json_t* rootJ = SanguineModule::dataToJson();
+
+		setJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+		randomStream.dataToJson(rootJ);
+
+		return rootJ;
+	}
+
+	void dataFromJson(json_t* rootJ) override {
+		SanguineModule::dataFromJson(rootJ);
+
+		getJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+		randomStream.dataFromJson(rootJ);
+	}
 };
 
 struct IncurvationesWidget : SanguineModuleWidget {
@@ -284,6 +324,20 @@ struct IncurvationesWidget : SanguineModuleWidget {
 		addChild(createLightCentered<TinyLight<RedGreenBlueLight>>(millimetersToPixelsVec(36.5, 65.191), module,
 			Incurvationes::LIGHT_CHANNEL_ALGORITHM + 15 * 3));
 	}
+
+	void appendContextMenu(Menu* menu) override {
+		SanguineModuleWidget::appendContextMenu(menu);
+
+		Incurvationes* module = dynamic_cast<Incurvationes*>(this->module);
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createBoolPtrMenuItem("Stagger channel blocks (flatter CPU load)", "", &module->bStaggerBlocks));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
+	}
 };
 
 Model* modelIncurvationes = createModel<Incurvationes, IncurvationesWidget>("Sanguine-Incurvationes");
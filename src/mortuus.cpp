@@ -4,7 +4,10 @@
 #include "sanguinejson.hpp"
 
 #include "deadman/deadman_processors.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "mortuus.hpp"
 #ifndef METAMODULE
 #include "ansa.hpp"
@@ -91,9 +94,11 @@ struct Mortuus : SanguineModule {
 
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	deadman::GateFlags gateFlags[apicesCommon::kChannelCount] = {};
 
-	dsp::SampleRateConverter<apicesCommon::kChannelCount> srcOutput;
+	resamplerCommon::PolyphaseResampler<apicesCommon::kChannelCount> srcOutput;
 	dsp::DoubleRingBuffer<dsp::Frame<apicesCommon::kChannelCount>, 256> drbOutputBuffer;
 
 	struct Block {
@@ -183,6 +188,9 @@ struct Mortuus : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		float sampleTime = 0.f;
 
 		bool bIsLightsTurn = lightsDivider.process();
@@ -760,6 +768,8 @@ struct Mortuus : SanguineModule {
 	}
 
 	void onReset(const ResetEvent& e) override {
+		randomStream.reseed(getId());
+
 		init();
 	}
 
@@ -957,6 +967,8 @@ struct Mortuus : SanguineModule {
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		jitteredLightsFrequency = kLightsFrequency + (getId() % kLightsFrequency);
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
@@ -1079,6 +1091,8 @@ struct Mortuus : SanguineModule {
 			setJsonInt(rootJ, "tapPLO1", processors[1].getPLOPhaseIncrement());
 		}
 
+		randomStream.dataToJson(rootJ);
+
 		return rootJ;
 	}
 
@@ -1137,6 +1151,8 @@ struct Mortuus : SanguineModule {
 				processors[1].setPLOPhaseIncrement(intValue);
 			}
 		}
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	inline Slice NextSlice(size_t size) {
@@ -1357,6 +1373,10 @@ struct MortuusWidget : SanguineModuleWidget {
 				}));
 		}
 #endif
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, mortuus, &mortuus->randomStream);
 	}
 };
 
@@ -6,7 +6,9 @@
 #include "array"
 
 #include "mutuus/dsp/mutuus_modulator.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
 #include "warpiescommon.hpp"
 #include "warpiespals.hpp"
 
@@ -52,6 +54,8 @@ struct Mutuus : SanguineModule {
 
 	int featureMode = 0;
 	int frames[PORT_MAX_CHANNELS] = {};
+	bool bStaggerBlocks = false;
+	int blockPhasesChannelCount = 0;
 
 	static const int kLightsFrequency = 128;
 	int jitteredLightsFrequency;
@@ -59,8 +63,10 @@ struct Mutuus : SanguineModule {
 	dsp::BooleanTrigger btModeSwitch;
 	dsp::ClockDivider lightsDivider;
 	mutuus::MutuusModulator modulators[PORT_MAX_CHANNELS];
-	mutuus::ShortFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
-	mutuus::ShortFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+	mutuus::FloatFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+	mutuus::FloatFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize] = {};
+
+	randomCommon::RandomStream randomStream;
 
 	bool bModeSwitchEnabled = false;
 	bool bLastInModeSwitch = false;
@@ -115,12 +121,22 @@ struct Mutuus : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
 		std::array <mutuus::FeatureMode, PORT_MAX_CHANNELS> channelFeatureModes;
 
 		int channelCount = std::max(std::max(inputs[INPUT_CARRIER].getChannels(), inputs[INPUT_MODULATOR].getChannels()), 1);
 
+		// Block phases follow the stagger option and, when staggered, the channel count.
+		int phasesChannelCount = bStaggerBlocks ? channelCount : 0;
+		if (phasesChannelCount != blockPhasesChannelCount) {
+			warpiescommon::setBlockPhases(frames, channelCount, bStaggerBlocks);
+			blockPhasesChannelCount = phasesChannelCount;
+		}
+
 		int32_t internalOscillator = static_cast<int32_t>(params[PARAM_CARRIER].getValue());
 
 		float algorithmValue = 0.f;
@@ -231,13 +247,11 @@ struct Mutuus : SanguineModule {
 				modulators[channel].Process(inputFrames[channel], outputFrames[channel], warpiescommon::kBlockSize);
 			}
 
-			inputFrames[channel][frames[channel]].l = clamp(static_cast<int>(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f * 32768),
-				-32768, 32767);
-			inputFrames[channel][frames[channel]].r = clamp(static_cast<int>(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f * 32768),
-				-32768, 32767);
+			inputFrames[channel][frames[channel]].l = clamp(inputs[INPUT_CARRIER].getVoltage(channel) / 8.f, -1.f, 1.f);
+			inputFrames[channel][frames[channel]].r = clamp(inputs[INPUT_MODULATOR].getVoltage(channel) / 8.f, -1.f, 1.f);
 
-			outputs[OUTPUT_MODULATOR].setVoltage(static_cast<float>(outputFrames[channel][frames[channel]].l) / 32768 * 5.f, channel);
-			outputs[OUTPUT_AUX].setVoltage(static_cast<float>(outputFrames[channel][frames[channel]].r) / 32768 * 5.f, channel);
+			outputs[OUTPUT_MODULATOR].setVoltage(outputFrames[channel][frames[channel]].l * 5.f, channel);
+			outputs[OUTPUT_AUX].setVoltage(outputFrames[channel][frames[channel]].r * 5.f, channel);
 		}
 
 		outputs[OUTPUT_MODULATOR].setChannels(channelCount);
@@ -335,15 +349,26 @@ struct Mutuus : SanguineModule {
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		jitteredLightsFrequency = kLightsFrequency + (getId() % kLightsFrequency);
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
 
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
 	json_t* dataToJson() override {
 		json_t* rootJ = SanguineModule::dataToJson();
 
 		setJsonInt(rootJ, "mode", static_cast<int>(modulators[0].feature_mode()));
 		setJsonBoolean(rootJ, "NotesModeSelection", bNotesModeSelection);
+		setJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+		randomStream.dataToJson(rootJ);
 
 		return rootJ;
 	}
@@ -359,6 +384,9 @@ struct Mutuus : SanguineModule {
 		}
 
 		getJsonBoolean(rootJ, "NotesModeSelection", bNotesModeSelection);
+		getJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	void setFeatureMode(int modeNumber) {
@@ -479,6 +507,14 @@ struct MutuusWidget : SanguineModuleWidget {
 		menu->addChild(new MenuSeparator);
 
 		menu->addChild(createBoolPtrMenuItem("C4-G#4 direct mode selection", "", &module->bNotesModeSelection));
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createBoolPtrMenuItem("Stagger channel blocks (flatter CPU load)", "", &module->bStaggerBlocks));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
@@ -4,7 +4,10 @@
 #include "sanguinejson.hpp"
 
 #include "clouds/dsp/granular_processor.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "nebulae.hpp"
 
 #pragma GCC diagnostic ignored "-Wclass-memaccess"
@@ -78,14 +81,16 @@ struct Nebulae : SanguineModule {
 	std::string textPitch = nebulae::modeDisplays[0].labelPitch;
 	std::string textTrigger = nebulae::modeDisplays[0].labelTrigger;
 
-	dsp::SampleRateConverter<2> srcInput;
-	dsp::SampleRateConverter<2> srcOutput;
-	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbInputBuffer;
-	dsp::DoubleRingBuffer<dsp::Frame<2>, 256> drbOutputBuffer;
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS * 2> srcInput;
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS * 2> srcOutput;
+	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS * 2>, 256> drbInputBuffer;
+	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS * 2>, 256> drbOutputBuffer;
 	dsp::VuMeter2 vuMeter;
 	dsp::ClockDivider lightsDivider;
 	dsp::BooleanTrigger btLedsMode;
 
+	randomCommon::RandomStream randomStream;
+
 	clouds::PlaybackMode playbackMode = clouds::PLAYBACK_MODE_GRANULAR;
 	clouds::PlaybackMode lastPlaybackMode = clouds::PLAYBACK_MODE_LAST;
 	clouds::PlaybackMode lastLEDPlaybackMode = clouds::PLAYBACK_MODE_GRANULAR;
@@ -102,16 +107,34 @@ struct Nebulae : SanguineModule {
 
 	const int kClockDivider = 64;
 
+	int channelCount = 1;
+
+	int recordingBuffer = cloudyCommon::RECORDING_BUFFER_MODULE;
+
 	uint32_t displayTimeout = 0;
 
 	bool bLastFrozen = false;
 	bool bDisplaySwitched = false;
-	bool bTriggered = false;
+	bool bDesktopGrains = false;
+	bool bPolyphonic = false;
+	bool bNativeRate = false;
+
+	/*
+	   One processor per channel: the first is allocated in the constructor, the rest by the UI thread as the audio
+	   thread asks for them, so process() only ever uses processors that are ready.
+	*/
+	uint8_t* bufferLarge[PORT_MAX_CHANNELS] = {};
+	uint8_t* bufferSmall[PORT_MAX_CHANNELS] = {};
+
+	clouds::GranularProcessor* cloudsProcessors[PORT_MAX_CHANNELS] = {};
+	std::atomic<int> allocatedProcessors{ 0 };
+	std::atomic<int> wantedProcessors{ 1 };
 
-	uint8_t* bufferLarge;
-	uint8_t* bufferSmall;
+	// Float recording buffers, when one is selected.
+	cloudyCommon::FloatBufferHandoff floatBuffers[PORT_MAX_CHANNELS];
 
-	clouds::GranularProcessor* cloudsProcessor;
+	// Reverb shared by the processors of a polyphonic Nebulae.
+	clouds::ReverbBus* reverbBus = nullptr;
 
 	Nebulae() {
 		config(PARAMS_COUNT, INPUTS_COUNT, OUTPUTS_COUNT, LIGHTS_COUNT);
@@ -177,40 +200,90 @@ struct Nebulae : SanguineModule {
 		lastHiFi = 1;
 		lastStereo = 1;
 
-		bufferLarge = new uint8_t[cloudyCommon::kBigBufferLength]();
-		bufferSmall = new uint8_t[cloudyCommon::kSmallBufferLength]();
-		cloudsProcessor = new clouds::GranularProcessor();
-		memset(cloudsProcessor, 0, sizeof(*cloudsProcessor));
-		cloudsProcessor->Init(bufferLarge, cloudyCommon::kBigBufferLength,
-			bufferSmall, cloudyCommon::kSmallBufferLength);
+		allocateProcessors(1);
 
 		lightsDivider.setDivision(kClockDivider);
 	}
 
 	~Nebulae() {
-		delete cloudsProcessor;
-		delete[] bufferLarge;
-		delete[] bufferSmall;
+		for (int channel = 0; channel < allocatedProcessors.load(); ++channel) {
+			delete cloudsProcessors[channel];
+			delete[] bufferLarge[channel];
+			delete[] bufferSmall[channel];
+		}
+		delete reverbBus;
+	}
+
+	// Called from the UI thread only; the audio thread sees the new processors once the count is published.
+	void allocateProcessors(int count) {
+		int allocated = allocatedProcessors.load(std::memory_order_relaxed);
+		if (count <= allocated) {
+			return;
+		}
+		if (count > 1 && !reverbBus) {
+			reverbBus = new clouds::ReverbBus();
+			memset(reverbBus, 0, sizeof(*reverbBus));
+			reverbBus->Init();
+		}
+		while (allocated < count) {
+			bufferLarge[allocated] = new uint8_t[cloudyCommon::kBigBufferLength]();
+			bufferSmall[allocated] = new uint8_t[cloudyCommon::kSmallBufferLength]();
+			cloudsProcessors[allocated] = new clouds::GranularProcessor();
+			memset(cloudsProcessors[allocated], 0, sizeof(*cloudsProcessors[allocated]));
+			cloudsProcessors[allocated]->Init(bufferLarge[allocated],
+				cloudyCommon::kBigBufferLength, bufferSmall[allocated], cloudyCommon::kSmallBufferLength);
+			floatBuffers[allocated].request(cloudyCommon::floatBufferLengths[recordingBuffer]);
+			++allocated;
+		}
+		allocatedProcessors.store(allocated, std::memory_order_release);
+	}
+
+	// Allocates the processors the audio thread is waiting for.
+	void allocateWantedProcessors() {
+		allocateProcessors(wantedProcessors.load(std::memory_order_relaxed));
+	}
+
+	void setRecordingBuffer(int buffer) {
+		recordingBuffer = buffer;
+		for (int channel = 0; channel < allocatedProcessors.load(); ++channel) {
+			floatBuffers[channel].request(cloudyCommon::floatBufferLengths[recordingBuffer]);
+		}
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
-		dsp::Frame<2> inputFrame;
-		dsp::Frame<2> outputFrame = {};
+		dsp::Frame<PORT_MAX_CHANNELS * 2> inputFrame = {};
+		dsp::Frame<PORT_MAX_CHANNELS * 2> outputFrame = {};
+
+		// Channels without a processor yet stay silent until the UI thread has allocated one.
+		const int wantedChannels = bPolyphonic ? clamp(std::max(inputs[INPUT_LEFT].getChannels(),
+			inputs[INPUT_RIGHT].getChannels()), 1, PORT_MAX_CHANNELS) : 1;
+		wantedProcessors.store(wantedChannels, std::memory_order_relaxed);
+		channelCount = std::min(wantedChannels, allocatedProcessors.load(std::memory_order_acquire));
 
 		// Get input.
 		if (!drbInputBuffer.full()) {
-			inputFrame.samples[0] = inputs[INPUT_LEFT].getVoltageSum() * params[PARAM_IN_GAIN].getValue() / 5.f;
-			inputFrame.samples[1] = inputs[INPUT_RIGHT].isConnected() ? inputs[INPUT_RIGHT].getVoltageSum() *
-				params[PARAM_IN_GAIN].getValue() / 5.f : inputFrame.samples[0];
+			if (bPolyphonic) {
+				for (int channel = 0; channel < channelCount; ++channel) {
+					inputFrame.samples[channel * 2 + 0] = inputs[INPUT_LEFT].getPolyVoltage(channel) *
+						params[PARAM_IN_GAIN].getValue() / 5.f;
+					inputFrame.samples[channel * 2 + 1] = inputs[INPUT_RIGHT].isConnected() ?
+						inputs[INPUT_RIGHT].getPolyVoltage(channel) * params[PARAM_IN_GAIN].getValue() / 5.f :
+						inputFrame.samples[channel * 2 + 0];
+				}
+			} else {
+				inputFrame.samples[0] = inputs[INPUT_LEFT].getVoltageSum() * params[PARAM_IN_GAIN].getValue() / 5.f;
+				inputFrame.samples[1] = inputs[INPUT_RIGHT].isConnected() ? inputs[INPUT_RIGHT].getVoltageSum() *
+					params[PARAM_IN_GAIN].getValue() / 5.f : inputFrame.samples[0];
+			}
 			drbInputBuffer.push(inputFrame);
 		}
 
-		// Trigger.
-		bTriggered = inputs[INPUT_TRIGGER].getVoltage() >= 1.f;
-
-		clouds::Parameters* cloudsParameters = cloudsProcessor->mutable_parameters();
+		clouds::Parameters* cloudsParameters = cloudsProcessors[0]->mutable_parameters();
 
 		float_4 voltages1;
 
@@ -221,78 +294,114 @@ struct Nebulae : SanguineModule {
 
 		// Render frames.
 		if (drbOutputBuffer.empty()) {
-			clouds::ShortFrame input[cloudyCommon::kMaxFrames] = {};
+			const int processingRate = cloudyCommon::getProcessingRate(bNativeRate, args.sampleRate);
+
 			// Convert input buffer.
-			srcInput.setRates(args.sampleRate, 32000);
-			dsp::Frame<2> inputFrames[cloudyCommon::kMaxFrames];
+			srcInput.setRates(args.sampleRate, processingRate);
+			srcInput.setChannels(channelCount * 2);
+			dsp::Frame<PORT_MAX_CHANNELS * 2> inputFrames[cloudyCommon::kMaxFrames] = {};
 			int inputLength = drbInputBuffer.size();
 			int outputLength = cloudyCommon::kMaxFrames;
 			srcInput.process(drbInputBuffer.startData(), &inputLength, inputFrames, &outputLength);
 			drbInputBuffer.startIncr(inputLength);
 
-			/*
-			   We might not fill all of the input buffer if there is a deficiency, but this cannot be avoided due to imprecisions
-			   between the input and output SRC.
-			*/
-			for (int frame = 0; frame < outputLength; ++frame) {
-				input[frame].l = clamp(inputFrames[frame].samples[0] * 32767.0, -32768, 32767);
-				input[frame].r = clamp(inputFrames[frame].samples[1] * 32767.0, -32768, 32767);
-			}
-
-			// Set up Clouds processor.
-			cloudsProcessor->set_playback_mode(playbackMode);
-			cloudsProcessor->set_num_channels(static_cast<bool>(params[PARAM_STEREO].getValue()) ? 2 : 1);
-			cloudsProcessor->set_low_fidelity(!static_cast<bool>(params[PARAM_HI_FI].getValue()));
-			cloudsProcessor->Prepare();
-
 #ifndef METAMODULE
 			bool bFrozen = static_cast<bool>(params[PARAM_FREEZE].getValue());
 #else
 			bool bFrozen = static_cast<bool>(std::round(params[PARAM_FREEZE].getValue()));
 #endif
 
-			float_4 scaledVoltages;
+			clouds::ShortFrame input[PORT_MAX_CHANNELS][cloudyCommon::kMaxFrames] = {};
+			clouds::ShortFrame output[PORT_MAX_CHANNELS][cloudyCommon::kMaxFrames];
+
+			for (int channel = 0; channel < channelCount; ++channel) {
+				/*
+				   We might not fill all of the input buffer if there is a deficiency, but this cannot be avoided due to imprecisions
+				   between the input and output SRC.
+				*/
+				for (int frame = 0; frame < outputLength; ++frame) {
+					input[channel][frame].l = clamp(inputFrames[frame].samples[channel * 2 + 0] * 32767.0, -32768, 32767);
+					input[channel][frame].r = clamp(inputFrames[frame].samples[channel * 2 + 1] * 32767.0, -32768, 32767);
+				}
+
+				// Set up Clouds processor.
+				clouds::GranularProcessor* cloudsProcessor = cloudsProcessors[channel];
+				clouds::Parameters* channelParameters = cloudsProcessor->mutable_parameters();
+
+				cloudsProcessor->set_playback_mode(playbackMode);
+				cloudsProcessor->set_num_channels(static_cast<bool>(params[PARAM_STEREO].getValue()) ? 2 : 1);
+				cloudsProcessor->set_low_fidelity(!static_cast<bool>(params[PARAM_HI_FI].getValue()));
+				cloudsProcessor->set_grain_budget(bDesktopGrains ? clouds::GRAIN_BUDGET_DESKTOP :
+					clouds::GRAIN_BUDGET_HARDWARE);
+				cloudsProcessor->set_sample_rate(processingRate);
+				if (floatBuffers[channel].update()) {
+					cloudsProcessor->set_float_buffer(floatBuffers[channel].data(), floatBuffers[channel].size());
+				}
+				cloudsProcessor->Prepare();
 
-			scaledVoltages[0] = inputs[INPUT_BLEND].getVoltage();
-			scaledVoltages[1] = inputs[INPUT_SPREAD].getVoltage();
-			scaledVoltages[2] = inputs[INPUT_FEEDBACK].getVoltage();
-			scaledVoltages[3] = inputs[INPUT_REVERB].getVoltage();
+				float_4 scaledVoltages;
 
-			scaledVoltages /= 5.f;
+				scaledVoltages[0] = inputs[INPUT_BLEND].getPolyVoltage(channel);
+				scaledVoltages[1] = inputs[INPUT_SPREAD].getPolyVoltage(channel);
+				scaledVoltages[2] = inputs[INPUT_FEEDBACK].getPolyVoltage(channel);
+				scaledVoltages[3] = inputs[INPUT_REVERB].getPolyVoltage(channel);
 
-			scaledVoltages[0] += params[PARAM_BLEND].getValue();
-			scaledVoltages[1] += params[PARAM_SPREAD].getValue();
-			scaledVoltages[2] += params[PARAM_FEEDBACK].getValue();
-			scaledVoltages[3] += params[PARAM_REVERB].getValue();
+				scaledVoltages /= 5.f;
 
-			scaledVoltages = clamp(scaledVoltages, 0.f, 1.f);
+				scaledVoltages[0] += params[PARAM_BLEND].getValue();
+				scaledVoltages[1] += params[PARAM_SPREAD].getValue();
+				scaledVoltages[2] += params[PARAM_FEEDBACK].getValue();
+				scaledVoltages[3] += params[PARAM_REVERB].getValue();
 
-			cloudsParameters->dry_wet = scaledVoltages[0];
-			cloudsParameters->stereo_spread = scaledVoltages[1];
-			cloudsParameters->feedback = scaledVoltages[2];
-			cloudsParameters->reverb = scaledVoltages[3];
+				scaledVoltages = clamp(scaledVoltages, 0.f, 1.f);
 
-			scaledVoltages = voltages1 / 5.f;
+				channelParameters->dry_wet = scaledVoltages[0];
+				channelParameters->stereo_spread = scaledVoltages[1];
+				channelParameters->feedback = scaledVoltages[2];
+				channelParameters->reverb = scaledVoltages[3];
 
-			scaledVoltages[0] += params[PARAM_POSITION].getValue();
-			scaledVoltages[1] += params[PARAM_DENSITY].getValue();
-			scaledVoltages[2] += params[PARAM_SIZE].getValue();
-			scaledVoltages[3] += params[PARAM_TEXTURE].getValue();
+				scaledVoltages[0] = inputs[INPUT_POSITION].getPolyVoltage(channel);
+				scaledVoltages[1] = inputs[INPUT_DENSITY].getPolyVoltage(channel);
+				scaledVoltages[2] = inputs[INPUT_SIZE].getPolyVoltage(channel);
+				scaledVoltages[3] = inputs[INPUT_TEXTURE].getPolyVoltage(channel);
 
-			scaledVoltages = clamp(scaledVoltages, 0.f, 1.f);
+				scaledVoltages /= 5.f;
 
-			cloudsParameters->position = scaledVoltages[0];
-			cloudsParameters->density = scaledVoltages[1];
-			cloudsParameters->size = scaledVoltages[2];
-			cloudsParameters->texture = scaledVoltages[3];
+				scaledVoltages[0] += params[PARAM_POSITION].getValue();
+				scaledVoltages[1] += params[PARAM_DENSITY].getValue();
+				scaledVoltages[2] += params[PARAM_SIZE].getValue();
+				scaledVoltages[3] += params[PARAM_TEXTURE].getValue();
 
-			cloudsParameters->pitch = clamp((params[PARAM_PITCH].getValue() + inputs[INPUT_PITCH].getVoltage()) * 12.f, -48.f, 48.f);
-			cloudsParameters->trigger = bTriggered;
-			cloudsParameters->gate = bTriggered;
-			cloudsParameters->freeze = (inputs[INPUT_FREEZE].getVoltage() >= 1.f || bFrozen);
+				scaledVoltages = clamp(scaledVoltages, 0.f, 1.f);
 
-			clouds::ShortFrame output[cloudyCommon::kMaxFrames];
-			cloudsProcessor->Process(input, output, cloudyCommon::kMaxFrames);
+				channelParameters->position = scaledVoltages[0];
+				channelParameters->density = scaledVoltages[1];
+				channelParameters->size = scaledVoltages[2];
+				channelParameters->texture = scaledVoltages[3];
+
+				bool bChannelTriggered = inputs[INPUT_TRIGGER].getPolyVoltage(channel) >= 1.f;
+
+				channelParameters->pitch = clamp((params[PARAM_PITCH].getValue() +
+					inputs[INPUT_PITCH].getPolyVoltage(channel)) * 12.f, -48.f, 48.f);
+				channelParameters->trigger = bChannelTriggered;
+				channelParameters->gate = bChannelTriggered;
+				channelParameters->freeze = (inputs[INPUT_FREEZE].getPolyVoltage(channel) >= 1.f || bFrozen);
+			}
+
+			if (channelCount > 1) {
+				// Every processor sends to the shared reverb before any of them mixes its return.
+				reverbBus->set_sample_rate(processingRate);
+				reverbBus->Clear();
+				for (int channel = 0; channel < channelCount; ++channel) {
+					cloudsProcessors[channel]->Render(input[channel], cloudyCommon::kMaxFrames, reverbBus);
+				}
+				reverbBus->Process(cloudyCommon::kMaxFrames);
+				for (int channel = 0; channel < channelCount; ++channel) {
+					cloudsProcessors[channel]->Mix(input[channel], output[channel], cloudyCommon::kMaxFrames, reverbBus);
+				}
+			} else {
+				cloudsProcessors[0]->Process(input[0], output[0], cloudyCommon::kMaxFrames);
+			}
 
 			if (bFrozen && !bLastFrozen) {
 				bLastFrozen = true;
@@ -311,42 +420,51 @@ struct Nebulae : SanguineModule {
 			}
 
 			// Convert output buffer.
-			dsp::Frame<2> outputFrames[cloudyCommon::kMaxFrames];
-			for (int frame = 0; frame < cloudyCommon::kMaxFrames; ++frame) {
-				outputFrames[frame].samples[0] = output[frame].l / 32768.f;
-				outputFrames[frame].samples[1] = output[frame].r / 32768.f;
+			dsp::Frame<PORT_MAX_CHANNELS * 2> outputFrames[cloudyCommon::kMaxFrames] = {};
+			for (int channel = 0; channel < channelCount; ++channel) {
+				for (int frame = 0; frame < cloudyCommon::kMaxFrames; ++frame) {
+					outputFrames[frame].samples[channel * 2 + 0] = output[channel][frame].l / 32768.f;
+					outputFrames[frame].samples[channel * 2 + 1] = output[channel][frame].r / 32768.f;
+				}
 			}
 
-			srcOutput.setRates(32000, args.sampleRate);
+			srcOutput.setRates(processingRate, args.sampleRate);
+			srcOutput.setChannels(channelCount * 2);
 			int inCount = cloudyCommon::kMaxFrames;
 			int outCount = drbOutputBuffer.capacity();
 			srcOutput.process(outputFrames, &inCount, drbOutputBuffer.endData(), &outCount);
 			drbOutputBuffer.endIncr(outCount);
-
-			bTriggered = false;
 		}
 
 		// Set output.
 		if (!drbOutputBuffer.empty()) {
 			outputFrame = drbOutputBuffer.shift();
-			if (outputs[OUTPUT_LEFT].isConnected()) {
-				outputFrame.samples[0] *= params[PARAM_OUT_GAIN].getValue();
-				outputs[OUTPUT_LEFT].setVoltage(5.f * outputFrame.samples[0]);
-			}
-			if (outputs[OUTPUT_RIGHT].isConnected()) {
-				outputFrame.samples[1] *= params[PARAM_OUT_GAIN].getValue();
-				outputs[OUTPUT_RIGHT].setVoltage(5.f * outputFrame.samples[1]);
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputFrame.samples[channel * 2 + 0] *= params[PARAM_OUT_GAIN].getValue();
+				outputFrame.samples[channel * 2 + 1] *= params[PARAM_OUT_GAIN].getValue();
+				if (outputs[OUTPUT_LEFT].isConnected()) {
+					outputs[OUTPUT_LEFT].setVoltage(5.f * outputFrame.samples[channel * 2 + 0], channel);
+				}
+				if (outputs[OUTPUT_RIGHT].isConnected()) {
+					outputs[OUTPUT_RIGHT].setVoltage(5.f * outputFrame.samples[channel * 2 + 1], channel);
+				}
 			}
 		}
 
+		outputs[OUTPUT_LEFT].setChannels(channelCount);
+		outputs[OUTPUT_RIGHT].setChannels(channelCount);
+
+		// The lights follow the first channel.
 		dsp::Frame<2> lightFrame = {};
 
 		switch (ledMode) {
 		case cloudyCommon::LEDS_OUTPUT:
-			lightFrame = outputFrame;
+			lightFrame.samples[0] = outputFrame.samples[0];
+			lightFrame.samples[1] = outputFrame.samples[1];
 			break;
 		default:
-			lightFrame = inputFrame;
+			lightFrame.samples[0] = inputFrame.samples[0];
+			lightFrame.samples[1] = inputFrame.samples[1];
 			break;
 		}
 
@@ -527,6 +645,52 @@ struct Nebulae : SanguineModule {
 		} // lightsDivider
 	}
 
+	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+	}
+
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
+	json_t* dataToJson() override {
+		json_t* rootJ = SanguineModule::dataToJson();
+
+		setJsonBoolean(rootJ, "desktopGrains", bDesktopGrains);
+		setJsonBoolean(rootJ, "polyphonic", bPolyphonic);
+		setJsonInt(rootJ, "processors", allocatedProcessors.load());
+		setJsonBoolean(rootJ, "nativeRate", bNativeRate);
+		setJsonInt(rootJ, "recordingBuffer", recordingBuffer);
+
+		randomStream.dataToJson(rootJ);
+
+		return rootJ;
+	}
+
+	void dataFromJson(json_t* rootJ) override {
+		SanguineModule::dataFromJson(rootJ);
+
+		getJsonBoolean(rootJ, "desktopGrains", bDesktopGrains);
+		getJsonBoolean(rootJ, "polyphonic", bPolyphonic);
+		getJsonBoolean(rootJ, "nativeRate", bNativeRate);
+
+		json_int_t intValue = 0;
+
+		// Processors the patch was using, so it plays every channel from the start.
+		if (bPolyphonic && getJsonInt(rootJ, "processors", intValue)) {
+			allocateProcessors(clamp(static_cast<int>(intValue), 1, PORT_MAX_CHANNELS));
+		}
+
+		if (getJsonInt(rootJ, "recordingBuffer", intValue)) {
+			setRecordingBuffer(clamp(static_cast<int>(intValue), 0,
+				static_cast<int>(cloudyCommon::recordingBufferLabels.size()) - 1));
+		}
+
+		randomStream.dataFromJson(rootJ);
+	}
+
 	int getModeParam() {
 		return params[PARAM_MODE].getValue();
 	}
@@ -688,6 +852,15 @@ struct NebulaeWidget : SanguineModuleWidget {
 		}
 	}
 
+	void step() override {
+		Nebulae* module = dynamic_cast<Nebulae*>(this->module);
+		if (module) {
+			module->allocateWantedProcessors();
+		}
+
+		SanguineModuleWidget::step();
+	}
+
 	void appendContextMenu(Menu* menu) override {
 		SanguineModuleWidget::appendContextMenu(menu);
 
@@ -703,6 +876,28 @@ struct NebulaeWidget : SanguineModuleWidget {
 			[=]() {return module->getModeParam(); },
 			[=](int i) {module->setModeParam(i); }
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		menu->addChild(createBoolPtrMenuItem("More grains, all high quality (higher CPU)", "", &module->bDesktopGrains));
+
+		menu->addChild(createBoolPtrMenuItem("Polyphonic: one processor per channel (higher CPU)", "",
+			&module->bPolyphonic));
+		if (module->bPolyphonic) {
+			menu->addChild(createMenuLabel("Shared reverb: decay and damping follow the channels' average"));
+		}
+
+		menu->addChild(createBoolPtrMenuItem("Process at the engine sample rate (up to 96 kHz, higher CPU)", "",
+			&module->bNativeRate));
+
+		menu->addChild(createIndexSubmenuItem("Hi-Fi recording buffer", cloudyCommon::recordingBufferLabels,
+			[=]() {return module->recordingBuffer; },
+			[=](int i) {module->setRecordingBuffer(i); }
+		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
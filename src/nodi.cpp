@@ -11,7 +11,10 @@
 #include "braids/envelope.h"
 #include "braids/quantizer.h"
 #include "braids/quantizer_scales.h"
+#include "stmlib/utils/random.h"
 
+#include "randomcommon.hpp"
+#include "resamplercommon.hpp"
 #include "nodicommon.hpp"
 
 #include "nodi.hpp"
@@ -102,10 +105,12 @@ struct Nodi : SanguineModule {
 	static const int kLightsFrequency = 16;
 	int jitteredLightsFrequency;
 
-	dsp::DoubleRingBuffer<dsp::Frame<1>, 256> drbOutputBuffers[PORT_MAX_CHANNELS];
-	dsp::SampleRateConverter<1> sampleRateConverters[PORT_MAX_CHANNELS];
+	dsp::DoubleRingBuffer<dsp::Frame<PORT_MAX_CHANNELS>, 256> drbOutputBuffer;
+	resamplerCommon::PolyphaseResampler<PORT_MAX_CHANNELS> sampleRateConverter;
 	dsp::ClockDivider lightsDivider;
 
+	randomCommon::RandomStream randomStream;
+
 	bool triggersDetected[PORT_MAX_CHANNELS] = {};
 	bool lastTriggers[PORT_MAX_CHANNELS] = {};
 	bool triggeredChannels[PORT_MAX_CHANNELS] = {};
@@ -205,6 +210,9 @@ struct Nodi : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		stmlib::Random::Scope randomScope(&randomStream.state);
+
 		channelCount = std::max(std::max(inputs[INPUT_PITCH].getChannels(), inputs[INPUT_TRIGGER].getChannels()), 1);
 
 		bVCAEnabled = params[PARAM_VCA].getValue();
@@ -231,6 +239,10 @@ struct Nodi : SanguineModule {
 
 		bool bHaveMetaCable = inputs[INPUT_META].isConnected();
 
+		// Every channel renders its block at the same time, so they all share one resampler.
+		bool bMustRender = drbOutputBuffer.empty();
+		dsp::Frame<PORT_MAX_CHANNELS> renderFrames[nodiCommon::kBlockSize] = {};
+
 		for (int channel = 0; channel < channelCount; ++channel) {
 			settings[channel].quantizer_scale = knobScale;
 			settings[channel].quantizer_root = knobRoot;
@@ -281,7 +293,7 @@ struct Nodi : SanguineModule {
 			}
 
 			// Render frames.
-			if (drbOutputBuffers[channel].empty()) {
+			if (bMustRender) {
 				envelopes[channel].Update(settings[channel].ad_attack * 8, settings[channel].ad_decay * 8);
 				uint32_t adValue = envelopes[channel].Render();
 
@@ -399,34 +411,36 @@ struct Nodi : SanguineModule {
 					renderBuffer[block] = stmlib::Mix(sample, warped, signature);
 				}
 
-				if (!bWantLowCpu) {
-					// Convert sample rate.
-					dsp::Frame<1> in[nodiCommon::kBlockSize];
-					for (int block = 0; block < nodiCommon::kBlockSize; ++block) {
-						in[block].samples[0] = renderBuffer[block] / 32768.f;
-					}
-					sampleRateConverters[channel].setRates(96000, args.sampleRate);
-
-					int inLen = nodiCommon::kBlockSize;
-					int outLen = drbOutputBuffers[channel].capacity();
-					sampleRateConverters[channel].process(in, &inLen, drbOutputBuffers[channel].endData(),
-						&outLen);
-					drbOutputBuffers[channel].endIncr(outLen);
-				} else {
-					for (int block = 0; block < nodiCommon::kBlockSize; ++block) {
-						dsp::Frame<1> inFrame;
-						inFrame.samples[0] = renderBuffer[block] / 32768.f;
-						drbOutputBuffers[channel].push(inFrame);
-					}
+				for (int block = 0; block < nodiCommon::kBlockSize; ++block) {
+					renderFrames[block].samples[channel] = renderBuffer[block] / 32768.f;
 				}
 			}
+		} // Channels.
 
-			// Output.
-			if (!drbOutputBuffers[channel].empty()) {
-				dsp::Frame<1> outFrame = drbOutputBuffers[channel].shift();
-				outputs[OUTPUT_OUT].setVoltage(5.f * outFrame.samples[0], channel);
+		if (bMustRender) {
+			if (!bWantLowCpu) {
+				// Convert sample rate.
+				sampleRateConverter.setRates(96000, args.sampleRate);
+				sampleRateConverter.setChannels(channelCount);
+
+				int inLen = nodiCommon::kBlockSize;
+				int outLen = drbOutputBuffer.capacity();
+				sampleRateConverter.process(renderFrames, &inLen, drbOutputBuffer.endData(), &outLen);
+				drbOutputBuffer.endIncr(outLen);
+			} else {
+				int len = std::min(static_cast<int>(drbOutputBuffer.capacity()), nodiCommon::kBlockSize);
+				memcpy(drbOutputBuffer.endData(), renderFrames, len * sizeof(renderFrames[0]));
+				drbOutputBuffer.endIncr(len);
 			}
-		} // Channels.
+		}
+
+		// Output.
+		if (!drbOutputBuffer.empty()) {
+			dsp::Frame<PORT_MAX_CHANNELS> outFrame = drbOutputBuffer.shift();
+			for (int channel = 0; channel < channelCount; ++channel) {
+				outputs[OUTPUT_OUT].setVoltage(5.f * outFrame.samples[channel], channel);
+			}
+		}
 
 		outputs[OUTPUT_OUT].setChannels(channelCount);
 
@@ -594,6 +608,8 @@ struct Nodi : SanguineModule {
 		setJsonInt(rootJ, "displayChannel", displayChannel);
 		setJsonInt(rootJ, "userSignSeed", userSignSeed);
 
+		randomStream.dataToJson(rootJ);
+
 		return rootJ;
 	}
 
@@ -617,6 +633,8 @@ struct Nodi : SanguineModule {
 			setWaveShaperSeed(userSignSeed);
 			bNeedSignSeed = false;
 		}
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	void setWaveShaperSeed(uint32_t seed) {
@@ -652,6 +670,8 @@ struct Nodi : SanguineModule {
 	}
 
 	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+
 		if (bNeedSignSeed) {
 			userSignSeed = getInstanceSeed();
 			setWaveShaperSeed(userSignSeed);
@@ -661,6 +681,12 @@ struct Nodi : SanguineModule {
 		lightsDivider.setDivision(jitteredLightsFrequency);
 	}
 
+	void onReset(const ResetEvent& e) override {
+		SanguineModule::onReset(e);
+
+		randomStream.reseed(getId());
+	}
+
 	void onSampleRateChange(const SampleRateChangeEvent& e) override {
 		log2SampleRate = log2f(96000.f / e.sampleRate);
 	}
@@ -889,6 +915,10 @@ struct NodiWidget : SanguineModuleWidget {
 				));
 			}
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
@@ -38,6 +38,7 @@ void init(rack::Plugin* p)
 	p->addModel(modelTemulenti);
 	p->addModel(modelVimina);
 	p->addModel(modelScalaria);
+	p->addModel(modelAestuaria);
 
 	// MetaModule disabled modules go here!
 
@@ -36,6 +36,7 @@ extern Model* modelAestus;
 extern Model* modelTemulenti;
 extern Model* modelVimina;
 extern Model* modelScalaria;
+extern Model* modelAestuaria;
 
 // MetaModule disabled modules go here!
 #ifndef METAMODULE
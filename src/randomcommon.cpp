@@ -0,0 +1,126 @@
+#include "randomcommon.hpp"
+#include "sanguinehelpers.hpp"
+#include "sanguinejson.hpp"
+
+using namespace sanguineCommonCode;
+
+uint32_t randomCommon::RandomStream::getSeed(int64_t moduleId) const {
+	if (bUseUserSeed) {
+		return userSeed;
+	}
+	uint64_t id = static_cast<uint64_t>(moduleId);
+	return static_cast<uint32_t>(id ^ (id >> 16));
+}
+
+void randomCommon::RandomStream::init(int64_t moduleId) {
+	// The module isn't running yet, so the state can be set directly.
+	if (!bHaveState) {
+		state = getSeed(moduleId);
+		bHaveState = true;
+	}
+}
+
+void randomCommon::RandomStream::reseed(int64_t moduleId) {
+	requestState(getSeed(moduleId));
+	bHaveState = true;
+}
+
+void randomCommon::RandomStream::setUserSeed(uint32_t newSeed) {
+	userSeed = newSeed;
+	bUseUserSeed = true;
+	requestState(userSeed);
+}
+
+void randomCommon::RandomStream::useModuleSeed(int64_t moduleId) {
+	bUseUserSeed = false;
+	reseed(moduleId);
+}
+
+void randomCommon::RandomStream::requestState(uint32_t newState) {
+	pendingState.store(newState, std::memory_order_relaxed);
+	bStatePending.store(true, std::memory_order_release);
+}
+
+void randomCommon::RandomStream::dataToJson(json_t* rootJ) const {
+	// A requested state the audio thread hasn't applied yet is the one to save.
+	setJsonInt(rootJ, "randomState", bStatePending.load(std::memory_order_acquire) ?
+		pendingState.load(std::memory_order_relaxed) : state);
+	setJsonInt(rootJ, "randomSeed", userSeed);
+	setJsonBoolean(rootJ, "useRandomSeed", bUseUserSeed);
+}
+
+void randomCommon::RandomStream::dataFromJson(json_t* rootJ) {
+	json_int_t intValue;
+
+	if (getJsonInt(rootJ, "randomSeed", intValue)) {
+		userSeed = static_cast<uint32_t>(intValue);
+	}
+
+	getJsonBoolean(rootJ, "useRandomSeed", bUseUserSeed);
+
+	if (getJsonInt(rootJ, "randomState", intValue)) {
+		state = static_cast<uint32_t>(intValue);
+		bHaveState = true;
+		bStatePending.store(false, std::memory_order_relaxed);
+	}
+}
+
+randomCommon::SeedTextField::SeedTextField(RandomStream* theStream) {
+	stream = theStream;
+	multiline = false;
+	box.size = Vec(150, 20);
+	text = string::f("%u", stream->userSeed);
+}
+
+void randomCommon::SeedTextField::step() {
+	// Keep selected.
+	APP->event->setSelectedWidget(this);
+	TextField::step();
+}
+
+void randomCommon::SeedTextField::onSelectKey(const SelectKeyEvent& e) {
+	if (e.action == GLFW_PRESS && (e.key == GLFW_KEY_ENTER || e.key == GLFW_KEY_KP_ENTER)) {
+		uint32_t newValue = 0;
+		if (strToUInt32(text.c_str(), newValue)) {
+			stream->setUserSeed(newValue);
+		}
+
+		ui::MenuOverlay* overlay = getAncestorOfType<ui::MenuOverlay>();
+		overlay->requestDelete();
+		e.consume(this);
+	}
+
+	if (!e.getTarget()) {
+		TextField::onSelectKey(e);
+	}
+}
+
+void randomCommon::appendSeedMenu(Menu* menu, Module* module, RandomStream* stream) {
+	menu->addChild(createSubmenuItem("Random seed", "",
+		[=](Menu* menu) {
+			menu->addChild(createCheckMenuItem("Instance seed", "",
+				[=]() {return !stream->bUseUserSeed; },
+				[=]() {stream->useModuleSeed(module->getId()); }));
+
+			menu->addChild(createMenuItem("Restart from seed", "", [=]() {
+				stream->reseed(module->getId());
+				}));
+
+			menu->addChild(new MenuSeparator);
+
+			menu->addChild(createMenuItem("Random seed", "", [=]() {
+				stream->setUserSeed(random::u32());
+				}));
+
+			menu->addChild(new MenuSeparator);
+
+			menu->addChild(createMenuLabel("Min: 0, Max: 4294967295, ENTER to set"));
+
+			menu->addChild(createSubmenuItem("User seed", "",
+				[=](Menu* menu) {
+					menu->addChild(new SeedTextField(stream));
+				}
+			));
+		}
+	));
+}
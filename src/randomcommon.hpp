@@ -0,0 +1,59 @@
+#pragma once
+
+#include "plugin.hpp"
+
+namespace randomCommon {
+	/* The stream a module's DSP code draws its random numbers from, while a
+	   Random::Scope is open on state. It starts from a seed derived from the
+	   module's ID or, if the user set one, from that seed, so a duplicated or
+	   reset module can replay the same stream. The seed and the current state
+	   are saved with the patch.
+	   Only the audio thread writes state once the module is running: reseeding
+	   from the UI thread requests a new state, which process() applies before
+	   it opens its Random::Scope. */
+	struct RandomStream {
+		static const uint32_t kDefaultState = 0x21;
+
+		uint32_t state = kDefaultState;
+		uint32_t userSeed = 0;
+		bool bUseUserSeed = false;
+		bool bHaveState = false;
+
+		std::atomic<uint32_t> pendingState{ kDefaultState };
+		std::atomic<bool> bStatePending{ false };
+
+		uint32_t getSeed(int64_t moduleId) const;
+
+		// Seeds the stream, unless its state was loaded from the patch.
+		void init(int64_t moduleId);
+		// Restarts the stream from its seed.
+		void reseed(int64_t moduleId);
+
+		void setUserSeed(uint32_t newSeed);
+		void useModuleSeed(int64_t moduleId);
+
+		void requestState(uint32_t newState);
+
+		// Audio thread, before a Random::Scope is opened on state.
+		inline void applyPendingState() {
+			if (bStatePending.load(std::memory_order_relaxed) &&
+				bStatePending.exchange(false, std::memory_order_acquire)) {
+				state = pendingState.load(std::memory_order_relaxed);
+			}
+		}
+
+		void dataToJson(json_t* rootJ) const;
+		void dataFromJson(json_t* rootJ);
+	};
+
+	struct SeedTextField : ui::TextField {
+		RandomStream* stream;
+
+		SeedTextField(RandomStream* theStream);
+
+		void step() override;
+		void onSelectKey(const SelectKeyEvent& e) override;
+	};
+
+	void appendSeedMenu(Menu* menu, Module* module, RandomStream* stream);
+}
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/*
+   Multi-channel polyphase resampler for the modules that render at a fixed internal rate.
+   Every channel is filtered in one pass over an interleaved history, four channels at a time, and the filter tables
+   are built once per rate pair and shared by every instance. Unlike dsp::SampleRateConverter, changing the channel
+   count neither resets the other channels nor costs anything for the channels that are not in use.
+   Does not depend on Rack, so the headless benchmark can use it too.
+*/
+
+namespace resamplerCommon {
+	// Taps per phase when upsampling; downsampling lengthens the filter by the rate ratio, up to kMaxTaps.
+	static const int kBaseTaps = 48;
+	static const int kMaxTaps = 192;
+	// Rate pairs needing more phases than this are approximated, with a pitch error below 0.05 %.
+	static const int kMaxPhases = 2048;
+
+	// Cutoff, relative to the lower rate's Nyquist frequency.
+	static const float kCutoff = 0.9f;
+	static const double kKaiserBeta = 7.;
+
+	static const double kPi = 3.14159265358979323846;
+
+	// Polyphase filter bank for one rate pair: out / in = phases / step.
+	struct FilterBank {
+		int phases;
+		int step;
+		int taps;
+		// phases * taps coefficients; each phase's taps run from the oldest input to the newest.
+		std::vector<float> coefficients;
+	};
+
+	inline double besselI0(double x) {
+		double sum = 1.;
+		double term = 1.;
+		for (int k = 1; k < 32; ++k) {
+			term *= (x / (2. * k)) * (x / (2. * k));
+			sum += term;
+		}
+		return sum;
+	}
+
+	inline int greatestCommonDivisor(int a, int b) {
+		while (b != 0) {
+			int remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+		return a;
+	}
+
+	inline void designFilterBank(FilterBank& bank) {
+		const int phases = bank.phases;
+		const int taps = bank.taps;
+		const int length = phases * taps;
+
+		// Windowed sinc at phases times the input rate.
+		const double cutoff = 0.5 * kCutoff * std::min(1., static_cast<double>(phases) / bank.step) / phases;
+		const double center = 0.5 * (length - 1);
+		const double windowScale = 1. / besselI0(kKaiserBeta);
+
+		std::vector<double> prototype(length);
+		double sum = 0.;
+		for (int i = 0; i < length; ++i) {
+			const double x = i - center;
+			const double sinc = x == 0. ? 2. * cutoff : std::sin(2. * kPi * cutoff * x) / (kPi * x);
+			const double ratio = x / (center + 1.);
+			const double window = besselI0(kKaiserBeta * std::sqrt(std::max(0., 1. - ratio * ratio))) * windowScale;
+			prototype[i] = sinc * window;
+			sum += prototype[i];
+		}
+
+		// Unity gain for every phase.
+		const double gain = phases / sum;
+		bank.coefficients.resize(length);
+		for (int phase = 0; phase < phases; ++phase) {
+			for (int tap = 0; tap < taps; ++tap) {
+				bank.coefficients[phase * taps + tap] =
+					static_cast<float>(prototype[phase + (taps - 1 - tap) * phases] * gain);
+			}
+		}
+	}
+
+	/*
+	   Returns the shared bank for a rate pair, building it the first time the pair is used.
+	   Only called when a rate changes, so a spin lock is enough (and std::mutex is not available everywhere).
+	*/
+	inline const FilterBank* getFilterBank(int inRate, int outRate) {
+		static std::atomic_flag banksLock = ATOMIC_FLAG_INIT;
+		static std::map<std::pair<int, int>, std::unique_ptr<FilterBank>> banks;
+
+		const int divisor = greatestCommonDivisor(inRate, outRate);
+		int phases = outRate / divisor;
+		int step = inRate / divisor;
+		if (phases > kMaxPhases) {
+			step = std::max(1, static_cast<int>(std::round(static_cast<double>(step) * kMaxPhases / phases)));
+			phases = kMaxPhases;
+		}
+
+		while (banksLock.test_and_set(std::memory_order_acquire)) {
+		}
+		std::unique_ptr<FilterBank>& bank = banks[std::make_pair(phases, step)];
+		if (!bank) {
+			bank.reset(new FilterBank());
+			bank->phases = phases;
+			bank->step = step;
+			// A multiple of four taps, for the resamplers' unrolled loop.
+			bank->taps = std::min(kMaxTaps, static_cast<int>(std::ceil(kBaseTaps *
+				std::max(1., static_cast<double>(step) / phases) / 4.)) * 4);
+			designFilterBank(*bank);
+		}
+		const FilterBank* result = bank.get();
+		banksLock.clear(std::memory_order_release);
+		return result;
+	}
+
+	template <int MAX_CHANNELS>
+	class PolyphaseResampler {
+	public:
+		PolyphaseResampler() {
+			reset();
+		}
+
+		void setRates(int inRate, int outRate) {
+			if (inRate == lastInRate && outRate == lastOutRate) {
+				return;
+			}
+			lastInRate = inRate;
+			lastOutRate = outRate;
+			bank = inRate == outRate ? nullptr : getFilterBank(inRate, outRate);
+			reset();
+		}
+
+		// Channels that come back into use start from silence; the others are not disturbed.
+		void setChannels(int newChannels) {
+			newChannels = std::max(1, std::min(newChannels, MAX_CHANNELS));
+			if (newChannels > channels) {
+				for (int frame = 0; frame < 2 * kMaxTaps; ++frame) {
+					std::fill_n(history[frame] + channels, newChannels - channels, 0.f);
+				}
+			}
+			channels = newChannels;
+		}
+
+		void reset() {
+			std::memset(history, 0, sizeof(history));
+			position = 0;
+			phase = 0;
+			pendingInputs = 1;
+		}
+
+		/*
+		   Same contract as dsp::SampleRateConverter::process(): reads up to *inFrames frames, writes up to *outFrames
+		   and returns how many of each it used.
+		*/
+		template <typename FRAME>
+		void process(const FRAME* in, int* inFrames, FRAME* out, int* outFrames) {
+			if (!bank) {
+				const int frames = std::min(*inFrames, *outFrames);
+				for (int frame = 0; frame < frames; ++frame) {
+					std::copy(&in[frame].samples[0], &in[frame].samples[channels], &out[frame].samples[0]);
+				}
+				*inFrames = frames;
+				*outFrames = frames;
+				return;
+			}
+
+			// Works on local copies: as far as the compiler knows, the output frames could alias the members.
+			const int taps = bank->taps;
+			const int phases = bank->phases;
+			const int step = bank->step;
+			const float* bankCoefficients = bank->coefficients.data();
+			const int activeChannels = channels;
+			const int vectors = (activeChannels + kVectorSize - 1) / kVectorSize;
+			int currentPosition = position;
+			int currentPhase = phase;
+			int currentPendingInputs = pendingInputs;
+			int inFrame = 0;
+			int outFrame = 0;
+
+			while (true) {
+				while (currentPendingInputs > 0 && inFrame < *inFrames) {
+					const float* samples = in[inFrame].samples;
+					float* first = history[currentPosition];
+					float* second = history[currentPosition + taps];
+					for (int channel = 0; channel < activeChannels; ++channel) {
+						first[channel] = samples[channel];
+						second[channel] = samples[channel];
+					}
+					currentPosition = currentPosition + 1 < taps ? currentPosition + 1 : 0;
+					++inFrame;
+					--currentPendingInputs;
+				}
+				if (currentPendingInputs > 0 || outFrame >= *outFrames) {
+					break;
+				}
+
+				const float* coefficients = &bankCoefficients[currentPhase * taps];
+				float* destination = out[outFrame].samples;
+				switch (vectors) {
+				case 1:
+					convolve<1>(coefficients, history[currentPosition], taps, activeChannels, destination);
+					break;
+				case 2:
+					convolve<2>(coefficients, history[currentPosition], taps, activeChannels, destination);
+					break;
+				default:
+					for (int vector = 0; vector < vectors; vector += 4) {
+						convolve<4>(coefficients, &history[currentPosition][vector * kVectorSize], taps,
+							activeChannels - vector * kVectorSize, &destination[vector * kVectorSize]);
+					}
+					break;
+				}
+				++outFrame;
+
+				currentPhase += step;
+				currentPendingInputs = currentPhase / phases;
+				currentPhase -= currentPendingInputs * phases;
+			}
+
+			position = currentPosition;
+			phase = currentPhase;
+			pendingInputs = currentPendingInputs;
+			*inFrames = inFrame;
+			*outFrames = outFrame;
+		}
+
+	private:
+		// GCC/Clang vector extension: SSE on x86, NEON on ARM.
+		typedef float Vector __attribute__((vector_size(16), may_alias));
+
+		static const int kVectorSize = 4;
+		static const int kWidth = (MAX_CHANNELS + kVectorSize - 1) / kVectorSize * kVectorSize;
+
+		/*
+		   Each frame is stored twice, taps frames apart, so the last taps frames are always contiguous, from the
+		   oldest at position.
+		*/
+		alignas(16) float history[2 * kMaxTaps][kWidth];
+
+		const FilterBank* bank = nullptr;
+
+		int lastInRate = 0;
+		int lastOutRate = 0;
+		int channels = MAX_CHANNELS;
+		int position = 0;
+		int phase = 0;
+		int pendingInputs = 1;
+
+		/*
+		   Filters VECTORS groups of four channels. Narrow groups interleave several taps, so every accumulator chain
+		   has others to overlap with.
+		*/
+		template <int VECTORS>
+		static inline void convolve(const float* coefficients, const float* samples, int taps, int channelCount,
+			float* destination) {
+			static const int kTapGroup = VECTORS >= 4 ? 1 : 4 / VECTORS;
+
+			Vector sums[kTapGroup][VECTORS] = {};
+			for (int tap = 0; tap < taps; tap += kTapGroup) {
+				for (int group = 0; group < kTapGroup; ++group) {
+					const float coefficient = coefficients[tap + group];
+					const Vector broadcast = { coefficient, coefficient, coefficient, coefficient };
+					const Vector* frame = reinterpret_cast<const Vector*>(&samples[(tap + group) * kWidth]);
+					for (int vector = 0; vector < VECTORS; ++vector) {
+						sums[group][vector] += broadcast * frame[vector];
+					}
+				}
+			}
+
+			for (int vector = 0; vector < VECTORS; ++vector) {
+				Vector sum = sums[0][vector];
+				for (int group = 1; group < kTapGroup; ++group) {
+					sum += sums[group][vector];
+				}
+				const int lanes = std::min(kVectorSize, channelCount - vector * kVectorSize);
+				for (int lane = 0; lane < lanes; ++lane) {
+					destination[vector * kVectorSize + lane] = sum[lane];
+				}
+			}
+		}
+	};
+}
@@ -63,6 +63,8 @@ struct Scalaria : SanguineModule {
     };
 
     short frames[PORT_MAX_CHANNELS] = {};
+    bool bStaggerBlocks = false;
+    int blockPhasesChannelCount = 0;
 
     static const int kLightsFrequency = 128;
     int jitteredLightsFrequency;
@@ -71,8 +73,8 @@ struct Scalaria : SanguineModule {
 
     dsp::ClockDivider lightsDivider;
     scalaria::ScalariaModulator modulators[PORT_MAX_CHANNELS];
-    scalaria::ShortFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize];
-    scalaria::ShortFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize];
+    scalaria::FloatFrame inputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize];
+    scalaria::FloatFrame outputFrames[PORT_MAX_CHANNELS][warpiescommon::kBlockSize];
 
     scalaria::Parameters* parameters[PORT_MAX_CHANNELS];
 
@@ -125,6 +127,13 @@ struct Scalaria : SanguineModule {
         int channelCount = std::max(std::max(inputs[INPUT_CHANNEL_1].getChannels(),
             inputs[INPUT_CHANNEL_2].getChannels()), 1);
 
+        // Block phases follow the stagger option and, when staggered, the channel count.
+        int phasesChannelCount = bStaggerBlocks ? channelCount : 0;
+        if (phasesChannelCount != blockPhasesChannelCount) {
+            warpiescommon::setBlockPhases(frames, channelCount, bStaggerBlocks);
+            blockPhasesChannelCount = phasesChannelCount;
+        }
+
         float_4 f4Voltages;
 
         knobFrequency = params[PARAM_FREQUENCY].getValue();
@@ -179,44 +188,24 @@ struct Scalaria : SanguineModule {
         float_4 inVoltagesChannel2;
         float_4 outVoltagesChannel1;
         float_4 outVoltagesAux;
-        int currentChannel;
         for (int channel = 0; channel < channelCount; channel += 4) {
             inVoltagesChannel1 = inputs[INPUT_CHANNEL_1].getVoltageSimd<float_4>(channel);
             inVoltagesChannel2 = inputs[INPUT_CHANNEL_2].getVoltageSimd<float_4>(channel);
 
             inVoltagesChannel1 /= 8.f;
             inVoltagesChannel2 /= 8.f;
-            inVoltagesChannel1 *= 32768.f;
-            inVoltagesChannel2 *= 32768.f;
-
-            inVoltagesChannel1 = simd::clamp(inVoltagesChannel1, -32768.f, 32767.f);
-            inVoltagesChannel2 = simd::clamp(inVoltagesChannel2, -32768.f, 32767.f);
-
-            inputFrames[channel][frames[channel]].l = static_cast<short>(inVoltagesChannel1[0]);
-            inputFrames[channel][frames[channel]].r = static_cast<short>(inVoltagesChannel2[0]);
-            outVoltagesChannel1[0] = static_cast<float>(outputFrames[channel][frames[channel]].l);
-            outVoltagesAux[0] = static_cast<float>(outputFrames[channel][frames[channel]].r);
-
-            currentChannel = channel + 1;
-            inputFrames[currentChannel][frames[currentChannel]].l = static_cast<short>(inVoltagesChannel1[1]);
-            inputFrames[currentChannel][frames[currentChannel]].r = static_cast<short>(inVoltagesChannel2[1]);
-            outVoltagesChannel1[1] = static_cast<float>(outputFrames[currentChannel][frames[currentChannel]].l);
-            outVoltagesAux[1] = static_cast<float>(outputFrames[currentChannel][frames[currentChannel]].r);
-
-            currentChannel = channel + 2;
-            inputFrames[currentChannel][frames[currentChannel]].l = static_cast<short>(inVoltagesChannel1[2]);
-            inputFrames[currentChannel][frames[currentChannel]].r = static_cast<short>(inVoltagesChannel2[2]);
-            outVoltagesChannel1[2] = static_cast<float>(outputFrames[currentChannel][currentChannel].l);
-            outVoltagesAux[2] = static_cast<float>(outputFrames[currentChannel][frames[currentChannel]].r);
-
-            currentChannel = channel + 3;
-            inputFrames[currentChannel][frames[currentChannel]].l = static_cast<short>(inVoltagesChannel1[3]);
-            inputFrames[currentChannel][frames[currentChannel]].r = static_cast<short>(inVoltagesChannel2[3]);
-            outVoltagesChannel1[3] = static_cast<float>(outputFrames[currentChannel][currentChannel].l);
-            outVoltagesAux[3] = static_cast<float>(outputFrames[currentChannel][frames[currentChannel]].r);
-
-            outVoltagesChannel1 /= 32768.f;
-            outVoltagesAux /= 32768.f;
+
+            inVoltagesChannel1 = simd::clamp(inVoltagesChannel1, -1.f, 1.f);
+            inVoltagesChannel2 = simd::clamp(inVoltagesChannel2, -1.f, 1.f);
+
+            for (int lane = 0; lane < 4; ++lane) {
+                int currentChannel = channel + lane;
+                inputFrames[currentChannel][frames[currentChannel]].l = inVoltagesChannel1[lane];
+                inputFrames[currentChannel][frames[currentChannel]].r = inVoltagesChannel2[lane];
+                outVoltagesChannel1[lane] = outputFrames[currentChannel][frames[currentChannel]].l;
+                outVoltagesAux[lane] = outputFrames[currentChannel][frames[currentChannel]].r;
+            }
+
             outVoltagesChannel1 *= 5.f;
             outVoltagesAux *= 5.f;
 
@@ -295,6 +284,20 @@ struct Scalaria : SanguineModule {
         jitteredLightsFrequency = kLightsFrequency + (getId() % kLightsFrequency);
         lightsDivider.setDivision(jitteredLightsFrequency);
     }
+
+    json_t* dataToJson() override {
+        json_t* rootJ = SanguineModule::dataToJson();
+
+        setJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        SanguineModule::dataFromJson(rootJ);
+
+        getJsonBoolean(rootJ, "staggerBlocks", bStaggerBlocks);
+    }
 };
 
 #ifndef METAMODULE
@@ -621,6 +624,16 @@ struct ScalariaWidget : SanguineModuleWidget {
         addChild(bloodLogo);
 #endif
     }
+
+    void appendContextMenu(Menu* menu) override {
+        SanguineModuleWidget::appendContextMenu(menu);
+
+        Scalaria* module = dynamic_cast<Scalaria*>(this->module);
+
+        menu->addChild(new MenuSeparator);
+
+        menu->addChild(createBoolPtrMenuItem("Stagger channel blocks (flatter CPU load)", "", &module->bStaggerBlocks));
+    }
 };
 
 Model* modelScalaria = createModel<Scalaria, ScalariaWidget>("Sanguine-Scalaria");
\ No newline at end of file
@@ -5,7 +5,9 @@
 
 #include "bumps/bumps_generator.h"
 #include "bumps/bumps_cv_scaler.h"
+#include "parasites_stmlib/utils/parasites_random.h"
 
+#include "randomcommon.hpp"
 #include "aestuscommon.hpp"
 #include "temulenti.hpp"
 
@@ -105,6 +107,8 @@ struct Temulenti : SanguineModule {
 	bool bUseCalibrationOffset = true;
 	bool bLastExternalSync = false;
 
+	randomCommon::RandomStream randomStream;
+
 	Temulenti() {
 		config(PARAMS_COUNT, INPUTS_COUNT, OUTPUTS_COUNT, LIGHTS_COUNT);
 		configButton<ModeParam>(PARAM_MODE, aestusCommon::modelModeHeaders[0]);
@@ -143,6 +147,9 @@ struct Temulenti : SanguineModule {
 	}
 
 	void process(const ProcessArgs& args) override {
+		randomStream.applyPendingState();
+		parasites_stmlib::Random::Scope randomScope(&randomStream.state);
+
 		using simd::float_4;
 
 		bumps::GeneratorMode mode = generator.mode();
@@ -328,7 +335,13 @@ struct Temulenti : SanguineModule {
 		}
 	}
 
+	void onAdd(const AddEvent& e) override {
+		randomStream.init(getId());
+	}
+
 	void onReset() override {
+		randomStream.reseed(getId());
+
 		generator.set_mode(bumps::GENERATOR_MODE_LOOPING);
 		generator.set_range(bumps::GENERATOR_RANGE_MEDIUM);
 		params[PARAM_MODEL].setValue(0.f);
@@ -346,6 +359,8 @@ struct Temulenti : SanguineModule {
 		setJsonInt(rootJ, "range", static_cast<int>(generator.range()));
 		setJsonBoolean(rootJ, "useCalibrationOffset", bUseCalibrationOffset);
 
+		randomStream.dataToJson(rootJ);
+
 		return rootJ;
 	}
 
@@ -363,6 +378,8 @@ struct Temulenti : SanguineModule {
 		}
 
 		getJsonBoolean(rootJ, "useCalibrationOffset", bUseCalibrationOffset);
+
+		randomStream.dataFromJson(rootJ);
 	}
 
 	void setModel(int modelNum) {
@@ -512,6 +529,10 @@ struct TemulentiWidget : SanguineModuleWidget {
 				menu->addChild(createBoolPtrMenuItem("Frequency knob center is C4", "", &module->bUseCalibrationOffset));
 			}
 		));
+
+		menu->addChild(new MenuSeparator);
+
+		randomCommon::appendSeedMenu(menu, module, &module->randomStream);
 	}
 };
 
@@ -4,4 +4,16 @@ using namespace sanguineCommonCode;
 
 namespace warpiescommon {
     static const int kBlockSize = 60;
-}
\ No newline at end of file
+
+    /*
+       Sets the block phase of every channel. When staggered, the blocks of the active channels are
+       offset from each other so their Process() calls are spread evenly across the block instead
+       of all landing on the same sample; otherwise every channel follows channel 1.
+    */
+    template <typename T>
+    inline void setBlockPhases(T* frames, int channelCount, bool bStaggered) {
+        for (int channel = 0; channel < PORT_MAX_CHANNELS; ++channel) {
+            frames[channel] = bStaggered ? (channel % channelCount) * kBlockSize / channelCount : frames[0];
+        }
+    }
+}